@@ -0,0 +1,82 @@
+// SPDX-FileCopyrightText: 2021 Philipp Basler, Margarete Mühlleitner and Jonas
+// Müller
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file
+ * Piecewise Chebyshev representation of the thermal integrals which is
+ * continuously differentiable over its full domain
+ */
+
+#ifndef INCLUDE_BSMPT_THERMALFUNCTIONS_THERMALFUNCTIONCHEBYSHEV_H_
+#define INCLUDE_BSMPT_THERMALFUNCTIONS_THERMALFUNCTIONCHEBYSHEV_H_
+
+#include <cstddef>
+
+namespace BSMPT
+{
+namespace ThermalFunctions
+{
+
+/**
+ * @brief C_ChebyshevDegree Degree of the Chebyshev series on every piece. Has
+ * to match the --degree option of
+ * tools/ThermalFunctions/ThermalFunctionChebyshev.py.
+ */
+const std::size_t C_ChebyshevDegree = 12;
+/**
+ * @brief C_ChebyshevColumns Number of entries of every piece in
+ * BosonChebyshev and FermionChebyshev
+ */
+const std::size_t C_ChebyshevColumns = C_ChebyshevDegree + 10;
+
+/**
+ * @brief C_BosonChebyshevPieces Number of pieces in BosonChebyshev
+ */
+extern const std::size_t C_BosonChebyshevPieces;
+/**
+ * @brief BosonChebyshev Pieces of J_- for C_TableMinRatio <= x <=
+ * C_TableMaxRatio, sorted in x. Every piece contains its ends xa and xb, the
+ * analytic part G and dG/dx at both ends, the branch point x_b with its
+ * coefficient c and the coefficient l of the logarithm, followed by the
+ * Chebyshev coefficients. On the piece
+ * J_-(x) = G(x) + c (x - x_b)^{3/2} theta(x - x_b) + l x^2 log|x|.
+ * Generated with tools/ThermalFunctions/ThermalFunctionChebyshev.py.
+ */
+extern const double BosonChebyshev[][C_ChebyshevColumns];
+
+/**
+ * @brief C_FermionChebyshevPieces Number of pieces in FermionChebyshev
+ */
+extern const std::size_t C_FermionChebyshevPieces;
+/**
+ * @brief FermionChebyshev Pieces of J_+, same layout as BosonChebyshev
+ */
+extern const double FermionChebyshev[][C_ChebyshevColumns];
+
+/**
+ * Piecewise Chebyshev representation of J_- and its first derivative. In
+ * contrast to JbosonInterpolated it has no seams, J_- and dJ_-/dx are
+ * continuous for all x. Agrees with the integral within the tolerance the
+ * tables were generated with (1e-9 relative to max(1, |J_-|)). Outside of
+ * the tables the large x expansion or the numerical integration is used.
+ * @param x The ratio m^2/T^2
+ * @param diff Returns J_- for diff = 0 and dJ_-/dx for diff = 1, other values
+ * are passed to JbosonNumericalIntegration
+ */
+double JbosonChebyshev(const double &x, int diff = 0);
+
+/**
+ * Piecewise Chebyshev representation of J_+ and its first derivative, see
+ * JbosonChebyshev
+ * @param x The ratio m^2/T^2
+ * @param diff Returns J_+ for diff = 0 and dJ_+/dx for diff = 1, other values
+ * are passed to JfermionNumericalIntegration
+ */
+double JfermionChebyshev(const double &x, int diff = 0);
+
+} // namespace ThermalFunctions
+} // namespace BSMPT
+
+#endif /* INCLUDE_BSMPT_THERMALFUNCTIONS_THERMALFUNCTIONCHEBYSHEV_H_ */
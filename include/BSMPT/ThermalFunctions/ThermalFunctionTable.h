@@ -0,0 +1,80 @@
+// SPDX-FileCopyrightText: 2021 Philipp Basler, Margarete Mühlleitner and Jonas
+// Müller
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file
+ * Precomputed interpolation tables for the thermal integrals and their first
+ * derivatives
+ */
+
+#ifndef INCLUDE_BSMPT_THERMALFUNCTIONS_THERMALFUNCTIONTABLE_H_
+#define INCLUDE_BSMPT_THERMALFUNCTIONS_THERMALFUNCTIONTABLE_H_
+
+#include <cstddef>
+
+namespace BSMPT
+{
+namespace ThermalFunctions
+{
+
+/**
+ * @brief C_TableMinRatio Smallest m^2/T^2 covered by the tables, below the
+ * numerical integration is used
+ */
+const double C_TableMinRatio = -3000;
+/**
+ * @brief C_TableMaxRatio Largest m^2/T^2 covered by the tables, above the
+ * large x expansion JInterpolatedHigh is used
+ */
+const double C_TableMaxRatio = 400;
+
+/**
+ * @brief C_BosonTableRows Number of knots in BosonTable
+ */
+extern const std::size_t C_BosonTableRows;
+/**
+ * @brief BosonTable Cubic Hermite data of J_- for C_TableMinRatio <= x <=
+ * C_TableMaxRatio. Every row contains s = sign(x) sqrt(|x|), J_-, dJ_-/ds,
+ * dJ_-/dx and d^2J_-/(dx ds). Generated with
+ * tools/ThermalFunctions/ThermalFunctionTables.py.
+ */
+extern const double BosonTable[][5];
+
+/**
+ * @brief C_FermionTableRows Number of knots in FermionTable
+ */
+extern const std::size_t C_FermionTableRows;
+/**
+ * @brief FermionTable Cubic Hermite data of J_+, same layout as BosonTable
+ */
+extern const double FermionTable[][5];
+
+/**
+ * Interpolation of J_- and its first derivative from BosonTable. The
+ * variable s is used since the x^{3/2} term of J_- is smooth in it. Agrees
+ * with the integral within a relative tolerance of 1e-7 or an absolute
+ * tolerance of 1e-9, except within 1e-6 in s of the branch points
+ * x = -(2 pi n)^2, where d^2J_-/dx^2 diverges.
+ * Outside of the table the large x expansion or the numerical integration is
+ * used.
+ * @param x The ratio m^2/T^2
+ * @param diff Returns J_- for diff = 0 and dJ_-/dx for diff = 1, other values
+ * are passed to JbosonNumericalIntegration
+ */
+double JbosonTabulated(const double &x, int diff = 0);
+
+/**
+ * Interpolation of J_+ and its first derivative from FermionTable, see
+ * JbosonTabulated. The branch points are at x = -((2n+1) pi)^2.
+ * @param x The ratio m^2/T^2
+ * @param diff Returns J_+ for diff = 0 and dJ_+/dx for diff = 1, other values
+ * are passed to JfermionNumericalIntegration
+ */
+double JfermionTabulated(const double &x, int diff = 0);
+
+} // namespace ThermalFunctions
+} // namespace BSMPT
+
+#endif /* INCLUDE_BSMPT_THERMALFUNCTIONS_THERMALFUNCTIONTABLE_H_ */
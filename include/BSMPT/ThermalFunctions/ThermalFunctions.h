@@ -12,6 +12,7 @@
 #define INCLUDE_BSMPT_THERMALFUNCTIONS_THERMALFUNCTIONS_H_
 
 #include <BSMPT/utility/spline/spline.h>
+#include <cstddef>
 namespace BSMPT
 {
 namespace ThermalFunctions
@@ -50,8 +51,8 @@ const double C_euler_gamma = 0.5772156649015328606065;
  * -\sqrt{k^2+x} \right) \right] \f$
  * @param x The ratio m^2/T^2
  * @param k The integration variable
- * @param diff Returns the integrand of J_- for diff = 0 and for the dJ_-/dx for
- * diff = 1
+ * @param diff Returns the integrand of J_- for diff = 0, for the dJ_-/dx for
+ * diff = 1 and for d^2J_-/dx^2 for diff = 2
  */
 double JbosonIntegrand(const double &x, const double &k, int diff = 0);
 /**
@@ -59,8 +60,8 @@ double JbosonIntegrand(const double &x, const double &k, int diff = 0);
  * \int\limits_{0}^{\infty} \,\mathrm{d}k \, k^2 \log\left[ 1 - \exp\left(
  * -\sqrt{k^2+x} \right) \right] \f$
  * @param x The ratio m^2/T^2
- * @param diff Returns the numerical integration of J_- for diff = 0 and J_-/dx
- * for diff = 1
+ * @param diff Returns the numerical integration of J_- for diff = 0, J_-/dx
+ * for diff = 1 and d^2J_-/dx^2 for diff = 2 (only for x > 0)
  */
 double JbosonNumericalIntegration(const double &x, int diff = 0);
 /**
@@ -71,24 +72,24 @@ double JbosonNumericalIntegration(const double &x, int diff = 0);
  * c.f. Eq. (2.38) in the manual
  * @param x The ratio m^2/T^2
  * @param n The order of the taylor expansion
- * @param diff Returns the expansion for diff = 0 and its derivative for diff =
- * 1
+ * @param diff Returns the expansion for diff = 0, its derivative for diff =
+ * 1 and its second derivative for diff = 2
  */
 double JbosonInterpolatedLow(const double &x, const int &n, int diff = 0);
 /**
  * Using linear interpolation with data points to interpolate the thermal
  * integral for bosons for x=m^2/T^2 < 0
  * @param x The ratio m^2/T^2
- * @param diff Returns the interpolation of J_- for diff = 0 and for dJ_-/dx for
- * diff = 1
+ * @param diff Returns the interpolation of J_- for diff = 0, for dJ_-/dx for
+ * diff = 1 and for d^2J_-/dx^2 for diff = 2
  */
 double JbosonInterpolatedNegative(const double &x, int diff = 0);
 
 /**
  * Puts together the separate interpolations for J_-
  * @param x The ratio m^2/T^2
- * @param diff Returns the interpolation of J_- for diff = 0 and for dJ_-/dx for
- * diff = 1
+ * @param diff Returns the interpolation of J_- for diff = 0, for dJ_-/dx for
+ * diff = 1 and for d^2J_-/dx^2 for diff = 2
  */
 double JbosonInterpolated(const double &x, int diff = 0);
 
@@ -98,8 +99,8 @@ double JbosonInterpolated(const double &x, int diff = 0);
  * -\sqrt{k^2+x} \right) \right] \f$
  * @param x The ratio m^2/T^2
  * @param k The integration variable
- * @param diff Returns the integrand of J_+ for diff = 0 and for the dJ_+/dx for
- * diff = 1
+ * @param diff Returns the integrand of J_+ for diff = 0, for the dJ_+/dx for
+ * diff = 1 and for d^2J_+/dx^2 for diff = 2
  */
 double JfermionIntegrand(const double &x, const double &k, int diff = 0);
 /**
@@ -107,8 +108,8 @@ double JfermionIntegrand(const double &x, const double &k, int diff = 0);
  * \int\limits_{0}^{\infty} \,\mathrm{d}k \, k^2 \log\left[ 1 + \exp\left(
  * -\sqrt{k^2+x} \right) \right] \f$
  * @param x The ratio m^2/T^2
- * @param diff Returns the integrand of J_+ for diff = 0 and for the dJ_+/dx for
- * diff = 1
+ * @param diff Returns the numerical integration of J_+ for diff = 0, dJ_+/dx
+ * for diff = 1 and d^2J_+/dx^2 for diff = 2 (only for x > 0)
  */
 double JfermionNumericalIntegration(const double &x, int diff = 0);
 /**
@@ -119,15 +120,16 @@ double JfermionNumericalIntegration(const double &x, int diff = 0);
  * see J_{+,s} in Eq. (2.37) in the manual
  * @param x The ratio m^2/T^2
  * @param n The order of the taylor expansion
- * @param diff Returns the expansion for diff = 0 and dJ_+/dx for diff = 1
+ * @param diff Returns the expansion for diff = 0, dJ_+/dx for diff = 1 and
+ * d^2J_+/dx^2 for diff = 2
  */
 double JfermionInterpolatedLow(const double &x, const int &n, int diff = 0);
 /**
  * Puts together the separate interpolations for J_+, see Eq. (2.44) in the
  * manual
  * @param x The ratio m^2/T^2
- * @param diff Returns the interpolation of J_+ for diff = 0 and dJ_+/dx for
- * diff = 1
+ * @param diff Returns the interpolation of J_+ for diff = 0, dJ_+/dx for
+ * diff = 1 and d^2J_+/dx^2 for diff = 2
  */
 double JfermionInterpolated(const double &x, int diff = 0);
 
@@ -138,11 +140,37 @@ double JfermionInterpolated(const double &x, int diff = 0);
  * x^{-l/2} \f$, cf. Eq. (2.41) in the manual
  * @param x The ratio m^2/T^2
  * @param n The order of the expansion
- * @param diff Returns the expansion for diff = 0 and for its derivative for
- * diff = 1
+ * @param diff Returns the expansion for diff = 0, for its derivative for
+ * diff = 1 and for its second derivative for diff = 2
  */
 double JInterpolatedHigh(const double &x, const int &n, int diff = 0);
 
+/**
+ * Evaluates JbosonInterpolated for n arguments. The arguments are sorted
+ * into the low x, high x and negative x regions. The expansions of the low
+ * and high x regions are evaluated with precomputed Horner coefficients on
+ * packets of four arguments, using the vectorised square root, exponential
+ * and logarithm of Eigen. These use AVX2 or AVX-512 instructions if the build
+ * enables them, e.g. with the BSMPTUseVectorization option, and SSE2
+ * otherwise.
+ * @param x Array of n ratios m^2/T^2
+ * @param out Array of n results, must not overlap with x
+ * @param n Number of arguments
+ * @param diff Returns J_- for diff = 0, dJ_-/dx for diff = 1 and d^2J_-/dx^2
+ * for diff = 2
+ */
+void JbosonBatch(const double *x, double *out, std::size_t n, int diff = 0);
+
+/**
+ * Evaluates JfermionInterpolated for n arguments, see JbosonBatch
+ * @param x Array of n ratios m^2/T^2
+ * @param out Array of n results, must not overlap with x
+ * @param n Number of arguments
+ * @param diff Returns J_+ for diff = 0, dJ_+/dx for diff = 1 and d^2J_+/dx^2
+ * for diff = 2
+ */
+void JfermionBatch(const double *x, double *out, std::size_t n, int diff = 0);
+
 } // namespace ThermalFunctions
 } // namespace BSMPT
 
@@ -12,6 +12,8 @@
  * @file
  */
 
+#include <BSMPT/utility/EvaluationBudget.h>
+#include <BSMPT/utility/NumericalDerivatives.h>
 #include <BSMPT/utility/const_velocity_spline.h>
 #include <BSMPT/utility/utility.h>
 #include <Eigen/Dense>
@@ -115,7 +117,8 @@ public:
     BackwardsPropagationFailed,
     NeverUndershootOvershoot,
     UndershootOvershootNegativeGrad,
-    NotEnoughPointsForSpline
+    NotEnoughPointsForSpline,
+    BudgetExhausted
   };
 
   /**
@@ -202,6 +205,13 @@ public:
    */
   int MaxSinglePathDeformations = 200;
 
+  /**
+   * @brief Optional EvaluationBudget polled by the shooting and path
+   * deformation loops, not owned by this class
+   *
+   */
+  const EvaluationBudget *Budget = nullptr;
+
   /**
    * @brief list of \f$ \rho \f$ of the solution
    */
@@ -219,11 +229,18 @@ public:
    */
   std::vector<double> dldrho_sol;
 
+  /**
+   * @brief Default step for the numerical derivatives, also used for the
+   * Hessian passed to the constructor by BounceSolution
+   *
+   */
+  static constexpr double DefaultEps = 0.01;
+
   /**
    * @brief Step for the numerical derivative
    *
    */
-  double eps = 0.01;
+  double eps = DefaultEps;
 
   /**
    * @brief  Number of basis function that are used + 1
@@ -265,6 +282,13 @@ public:
    * TODO: Calculate hessian from analytical gradient
    */
   std::function<std::vector<std::vector<double>>(std::vector<double>)> Hessian;
+  /**
+   * @brief Optional batched potential, used to calculate the gradients in
+   * RasterizedVdl() with a single evaluation of all finite differences
+   * stencils
+   *
+   */
+  BatchFunction VBatch;
   /**
    * @brief First path given to class
    *
@@ -326,6 +350,27 @@ public:
                   double T_In,
                   int MaxPathIntegrations_in);
 
+  /**
+   * @brief Construct a new Bounce Action Int object
+   *
+   * @param init_path is the initial path guess
+   * @param TrueVacuumIn is the true vacuum candidate of the potential
+   * @param FalseVacuumIn is the false vacuum
+   * @param V is the class potential
+   * @param Hessian_In is the Hessian of the class potential
+   * @param VBatch_In optional batched evaluation of V_In, see VBatch
+   */
+  BounceActionInt(
+      std::vector<std::vector<double>> InitPath_In,
+      std::vector<double> TrueVacuum_In,
+      std::vector<double> FalseVacuum_In,
+      std::function<double(std::vector<double>)> &V_In,
+      const std::function<std::vector<std::vector<double>>(std::vector<double>)>
+          &Hessian_In,
+      double T_In,
+      int MaxPathIntegrations_in,
+      const BatchFunction &VBatch_In = BatchFunction());
+
   /**
    * @brief Used set the path of the class.
    *
@@ -179,6 +179,12 @@ public:
    */
   void CalculateOptimalDiscreteSymmetry();
 
+  /**
+   * @brief IsBudgetExhausted returns true if the EvaluationBudget of MinTracer
+   * is used up
+   */
+  bool IsBudgetExhausted() const;
+
   /**
    * @brief Storage of the tunneling rate per volume of the transition from
    * false to true vacuum
@@ -231,7 +237,8 @@ public:
   CoexPhases phase_pair;
 
   /**
-   * @brief status of bounce solver
+   * @brief status of bounce solver, StatusGW::BudgetExhausted if the
+   * EvaluationBudget of MinTracer was used up
    *
    */
   StatusGW status_bounce_sol = StatusGW::NotSet;
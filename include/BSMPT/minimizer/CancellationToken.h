@@ -0,0 +1,142 @@
+// SPDX-FileCopyrightText: 2021 Philipp Basler, Margarete Mühlleitner and Jonas
+// Müller
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file
+ * Cooperative cancellation of minimizers running in parallel
+ */
+
+#ifndef CANCELLATIONTOKEN_H_
+#define CANCELLATIONTOKEN_H_
+
+#include <BSMPT/utility/EvaluationBudget.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <exception>
+
+namespace BSMPT
+{
+namespace Minimizer
+{
+
+/**
+ * @brief The MinimizerCancelled exception is thrown from the objective
+ * function of minimizers which can only be interrupted by an exception, e.g.
+ * libcmaes, once their CancellationToken is cancelled
+ */
+class MinimizerCancelled : public std::exception
+{
+public:
+  const char *what() const noexcept override
+  {
+    return "The minimization was cancelled";
+  }
+};
+
+/**
+ * @brief The CancellationToken class is shared by minimizers running in
+ * parallel. Every minimizer polls IsCancelled() and stops as soon as possible
+ * once another thread called Cancel() or the optional time budget is used up.
+ * A token can additionally be linked to an EvaluationBudget, which counts the
+ * evaluations of the effective potential of all minimizers polling the token.
+ */
+class CancellationToken
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  CancellationToken() = default;
+  /**
+   * @brief CancellationToken which is cancelled automatically after Budget
+   * seconds, a non-positive Budget means no limit, or once Evaluations is
+   * exhausted
+   */
+  explicit CancellationToken(double Budget,
+                             EvaluationBudget *Evaluations = nullptr)
+      : HasDeadline{Budget > 0}
+      , Deadline{Clock::now() +
+                 std::chrono::duration_cast<Clock::duration>(
+                     std::chrono::duration<double>(Budget > 0 ? Budget : 0))}
+      , Evaluations{Evaluations}
+  {
+  }
+  /**
+   * @brief CancellationToken which is cancelled automatically once Evaluations
+   * is exhausted
+   */
+  explicit CancellationToken(EvaluationBudget *Evaluations)
+      : CancellationToken(0, Evaluations)
+  {
+  }
+  CancellationToken(const CancellationToken &)            = delete;
+  CancellationToken &operator=(const CancellationToken &) = delete;
+
+  /**
+   * @brief Cancel signals all minimizers polling this token to stop
+   */
+  void Cancel() { Cancelled = true; }
+
+  /**
+   * @brief IsCancelled returns true if Cancel() was called or the time budget
+   * is used up
+   */
+  bool IsCancelled() const { return Cancelled or BudgetExhausted(); }
+
+  /**
+   * @brief BudgetExhausted returns true if the time budget or the linked
+   * EvaluationBudget is used up
+   */
+  bool BudgetExhausted() const
+  {
+    return (HasDeadline and Clock::now() >= Deadline) or
+           BSMPT::BudgetExhausted(Evaluations);
+  }
+
+  /**
+   * @brief CountEvaluations books Number evaluations of the effective
+   * potential in the linked EvaluationBudget, if any
+   */
+  void CountEvaluations(std::size_t Number = 1) const
+  {
+    if (Evaluations != nullptr) Evaluations->Consume(Number);
+  }
+
+  /**
+   * @brief GetEvaluationBudget returns the linked EvaluationBudget, nullptr if
+   * there is none
+   */
+  EvaluationBudget *GetEvaluationBudget() const { return Evaluations; }
+
+private:
+  std::atomic<bool> Cancelled{false};
+  bool HasDeadline{false};
+  Clock::time_point Deadline{};
+  EvaluationBudget *Evaluations{nullptr};
+};
+
+/**
+ * @brief IsCancelled returns true if Token is set and cancelled
+ */
+inline bool IsCancelled(const CancellationToken *Token)
+{
+  return Token != nullptr and Token->IsCancelled();
+}
+
+/**
+ * @brief CountEvaluations books Number evaluations of the effective potential
+ * in the EvaluationBudget linked to Token, if any
+ */
+inline void CountEvaluations(const CancellationToken *Token,
+                             std::size_t Number = 1)
+{
+  if (Token != nullptr) Token->CountEvaluations(Number);
+}
+
+} // namespace Minimizer
+} // namespace BSMPT
+
+#endif // CANCELLATIONTOKEN_H_
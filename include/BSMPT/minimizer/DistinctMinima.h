@@ -0,0 +1,99 @@
+// SPDX-FileCopyrightText: 2021 Philipp Basler, Margarete Mühlleitner and Jonas
+// Müller
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file
+ * Set of the distinct local minima found by a multistart
+ */
+
+#ifndef DISTINCTMINIMA_H_
+#define DISTINCTMINIMA_H_
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <vector>
+
+namespace BSMPT
+{
+namespace Minimizer
+{
+
+/**
+ * @brief SymmetryReduction maps a point to the representative of its orbit
+ * under the discrete symmetries of a model
+ */
+using SymmetryReduction = std::function<void(std::vector<double> &)>;
+
+/**
+ * @brief The DistinctMinimum struct stores one local minimum of a
+ * DistinctMinima set
+ */
+struct DistinctMinimum
+{
+  /**
+   * @brief Point the deepest of the clustered minima
+   */
+  std::vector<double> Point;
+  /**
+   * @brief PotVal the potential value at Point
+   */
+  double PotVal{0};
+  /**
+   * @brief Multiplicity number of minima in the cluster, i.e. how often the
+   * minimum was found
+   */
+  std::size_t Multiplicity{1};
+};
+
+/**
+ * @brief The DistinctMinima class clusters local minima which agree within
+ * Tolerance (in GeV) in every VEV. The clusters are indexed by their first
+ * VEV, so that a new minimum is only compared with the clusters within
+ * Tolerance in that direction instead of all of them.
+ */
+class DistinctMinima
+{
+public:
+  explicit DistinctMinima(double Tolerance = 1e-2);
+
+  /**
+   * @brief Insert adds the minimum Point with the potential value PotVal. If
+   * it belongs to a known cluster, the cluster keeps the deeper of both
+   * points.
+   * @return true if Point is a new distinct minimum
+   */
+  bool Insert(const std::vector<double> &Point, const double &PotVal);
+
+  /**
+   * @brief SortedByPotential returns the distinct minima in ascending order
+   * of their potential values, i.e. the candidate for the global minimum
+   * first
+   */
+  std::vector<DistinctMinimum> SortedByPotential() const;
+
+  /**
+   * @brief size returns the number of distinct minima
+   */
+  std::size_t size() const { return Minima.size(); }
+
+private:
+  /**
+   * @brief Key returns the coordinate used to index Point
+   */
+  static double Key(const std::vector<double> &Point);
+
+  double Tolerance;
+  std::vector<DistinctMinimum> Minima;
+  /**
+   * @brief Index maps the first VEV of each cluster to its position in Minima
+   */
+  std::multimap<double, std::size_t> Index;
+};
+
+} // namespace Minimizer
+} // namespace BSMPT
+
+#endif // DISTINCTMINIMA_H_
@@ -7,6 +7,7 @@
 #ifndef MINIMIZELIBCMAES_H
 #define MINIMIZELIBCMAES_H
 
+#include <BSMPT/minimizer/CancellationToken.h>
 #include <memory>
 #include <vector>
 /**
@@ -30,17 +31,24 @@ struct LibCMAESReturn
 {
   std::vector<double> result;
   int CMAESStatus;
+  /**
+   * @brief Cancelled true if the minimization was stopped by its
+   * CancellationToken, result is empty in this case
+   */
+  bool Cancelled{false};
 };
 
 /**
  * Calculating the global minimum with libcmaes in the 2HDM for the parameter
  * point par and counterterms parCT and write the solution in sol. The initial
- * guess is given in start.
+ * guess is given in start. The minimization is stopped once the optional
+ * Token is cancelled.
  * @return the libcmaes run_status of the system
  */
 LibCMAESReturn min_cmaes_gen_all(const Class_Potential_Origin &model,
                                  const double &Temp,
-                                 const std::vector<double> &VevMinimum);
+                                 const std::vector<double> &VevMinimum,
+                                 const CancellationToken *Token = nullptr);
 
 /**
  * Finds a candidate for the local minimum using the CMAES algorithm.
@@ -6,6 +6,7 @@
 #ifndef MINIMIZENLOPT_H
 #define MINIMIZENLOPT_H
 
+#include <BSMPT/minimizer/CancellationToken.h>
 #include <memory>
 #include <nlopt.hpp>
 #include <vector>
@@ -31,10 +32,16 @@ struct ShareInformationNLOPT
 {
   const Class_Potential_Origin &model;
   double Temp;
+  /**
+   * @brief Token the minimization is stopped once it is cancelled, optional
+   */
+  const CancellationToken *Token;
   ShareInformationNLOPT(const Class_Potential_Origin &modelIn,
-                        const double &TempIn)
+                        const double &TempIn,
+                        const CancellationToken *TokenIn = nullptr)
       : model{modelIn}
       , Temp{TempIn}
+      , Token{TokenIn}
   {
   }
 };
@@ -67,9 +74,11 @@ struct NLOPTReturnType
 /**
  * @brief NLOPTVEff
  * @param x VEV configuration to evaluate the effective potential
- * @param grad NULL as a derivative free method is used
+ * @param grad empty for the derivative free methods, otherwise filled with the
+ * analytic gradient w.r.t. x, see Class_Potential_Origin::VEffGradient
  * @param data pointer to ShareInformationNLOPT struct
  * @return
+ * @throws nlopt::forced_stop if the CancellationToken of data is cancelled
  */
 double
 NLOPTVEff(const std::vector<double> &x, std::vector<double> &grad, void *data);
@@ -79,11 +88,35 @@ NLOPTVEff(const std::vector<double> &x, std::vector<double> &grad, void *data);
  * LN_COBYLA algorithm
  * @param model model reference
  * @param Temp Temperature at which the potential should be minimized
+ * @param Token the minimization is stopped unsuccessfully once it is
+ * cancelled, optional
  * @return A ShareInformationNLOPT with the global minimum, the potential value
  * and the nlopt::result of the minimization
  */
 NLOPTReturnType MinimizeUsingNLOPT(const Class_Potential_Origin &model,
-                                   const double &Temp);
+                                   const double &Temp,
+                                   const CancellationToken *Token = nullptr);
+
+/**
+ * @brief MinimizeUsingNLOPTGradient minimizes the effective potential with the
+ * NLopt G_MLSL_LDS multistart, which runs the gradient-based LocalAlgorithm
+ * from low-discrepancy starting points in the same region as
+ * MinimizeUsingNLOPT. The best point is polished with LocalAlgorithm, if this
+ * does not converge the derivative-free LN_COBYLA is used instead.
+ * @param model model reference
+ * @param Temp Temperature at which the potential should be minimized
+ * @param LocalAlgorithm gradient-based local algorithm, e.g. nlopt::LD_LBFGS
+ * or nlopt::LD_SLSQP
+ * @param Token the minimization is stopped unsuccessfully once it is
+ * cancelled, optional
+ * @return A ShareInformationNLOPT with the global minimum, the potential value
+ * and the nlopt::result of the minimization
+ */
+NLOPTReturnType
+MinimizeUsingNLOPTGradient(const Class_Potential_Origin &model,
+                           const double &Temp,
+                           nlopt::algorithm LocalAlgorithm = nlopt::LD_LBFGS,
+                           const CancellationToken *Token  = nullptr);
 
 /**
  * @brief MinimizePlaneUsingNLOPT minimizes the effective potential in a given
@@ -11,6 +11,8 @@
 #ifndef MINIMIZEGSL_H_
 #define MINIMIZEGSL_H_
 
+#include <BSMPT/minimizer/CancellationToken.h>
+#include <BSMPT/minimizer/MinimumContinuation.h>
 #include <cmath>
 #include <gsl/gsl_vector_double.h> // for gsl_vector
 #include <memory>
@@ -34,6 +36,15 @@ struct GSL_params
 {
   const Class_Potential_Origin &model;
   double Temp;
+  /**
+   * @brief Token the minimisation stops early once it is cancelled, optional
+   */
+  const CancellationToken *Token{nullptr};
+  /**
+   * @brief MaxIter maximal number of iterations of a single local
+   * minimisation, taken from the EvaluationBudget of Token if it has one
+   */
+  std::size_t MaxIter{600};
   GSL_params(const Class_Potential_Origin &modelIN, const double &temperature)
       : model{modelIN}
       , Temp{temperature} {};
@@ -45,6 +56,45 @@ struct GSL_params
  */
 double GSL_VEFF_gen_all(const gsl_vector *v, void *p);
 
+/**
+ * Calculates the gradient of the effective potential w.r.t. the nVEV
+ * minimisation directions at the vev v and temperature p->Temp for the gsl
+ * interface
+ */
+void GSL_NablaVEFF_gen_all(const gsl_vector *v, void *p, gsl_vector *df);
+
+/**
+ * Calculates the value and the gradient of the effective potential at the vev
+ * v and temperature p->Temp for the gsl interface
+ */
+void GSL_VEFF_NablaVEFF_gen_all(const gsl_vector *v,
+                                void *p,
+                                double *f,
+                                gsl_vector *df);
+
+/**
+ * Calculates the next local minimum in the model from the point start using
+ * the analytic gradient Class_Potential_Origin::VEffGradient and the BFGS
+ * algorithm of gsl. This is meant as a fast local refinement of a candidate
+ * found by one of the derivative-free minimisers.
+ * @returns The final status of the gsl minimization process.
+ */
+int GSL_Minimize_Gradient_From_S_gen_all(struct GSL_params &params,
+                                         std::vector<double> &sol,
+                                         const std::vector<double> &start);
+
+/**
+ * Calculates the next local minimum in the model from the point start with
+ * GSL_Minimize_Gradient_From_S_gen_all. If the gradient-based minimisation
+ * does not converge the derivative-free GSL_Minimize_From_S_gen_all is used
+ * instead.
+ * @returns The final status of the gsl minimization process.
+ */
+int GSL_Minimize_Gradient_Polished_From_S_gen_all(
+    struct GSL_params &params,
+    std::vector<double> &sol,
+    const std::vector<double> &start);
+
 /**
  * Calculates the next local minimum in the model from the point start
  * @returns The final status of the gsl minimization process.
@@ -105,6 +155,10 @@ GSL_Minimize_gen_all(const Class_Potential_Origin &model,
  * @param MaxSol numbers of local minima to find
  * @param UseMultiThreading Decides if the algorithm should use multithreading
  * or not
+ * @param Token no further local minimisations are started once it is
+ * cancelled, the minima found so far are kept
+ * @param WarmStart minima of previous temperatures, they are used as
+ * starting points before the random ones, see MinimumContinuation
  * @return first: vector with the solution, second: True if a candidate for the
  * global minimum is found and false otherwise
  */
@@ -114,7 +168,60 @@ GSL_Minimize_gen_all(const Class_Potential_Origin &model,
                      const int &seed,
                      std::vector<std::vector<double>> &saveAllMinima,
                      const std::size_t &MaxSol,
-                     bool UseMultiThreading = true);
+                     bool UseMultiThreading               = true,
+                     const CancellationToken *Token       = nullptr,
+                     const MinimumContinuation *WarmStart = nullptr);
+
+/**
+ * Same as GSL_Minimize_gen_all, but the local minimisations use the analytic
+ * gradient of the potential, see
+ * GSL_Minimize_Gradient_Polished_From_S_gen_all. The BFGS algorithm
+ * typically converges within a few dozen evaluations, whereas the simplex
+ * algorithm needs hundreds.
+ * @param model model reference
+ * @param Temp Temperature at which to minimise the parameter point
+ * @param seed seed used to find the random starting points for the local
+ * optimisations
+ * @param MaxSol numbers of local minima to find
+ * @param UseMultiThreading Decides if the algorithm should use multithreading
+ * or not
+ * @return first: vector with candidate for the global minimum, second: True if
+ * a candidate for the global minimum is found and false otherwise
+ */
+std::pair<std::vector<double>, bool>
+GSL_Minimize_Gradient_gen_all(const Class_Potential_Origin &model,
+                              const double &Temp,
+                              const int &seed,
+                              const std::size_t &MaxSol,
+                              bool UseMultiThreading = true);
+
+/**
+ * Same as GSL_Minimize_gen_all, but the local minimisations use the analytic
+ * gradient of the potential, see GSL_Minimize_Gradient_gen_all
+ * @param model model reference
+ * @param Temp Temperature at which to minimise the parameter point
+ * @param seed seed used to find the random starting points for the local
+ * optimisations
+ * @param saveAllMinima List of all local minima
+ * @param MaxSol numbers of local minima to find
+ * @param UseMultiThreading Decides if the algorithm should use multithreading
+ * or not
+ * @param Token no further local minimisations are started once it is
+ * cancelled, the minima found so far are kept
+ * @param WarmStart minima of previous temperatures, they are used as
+ * starting points before the random ones, see MinimumContinuation
+ * @return first: vector with the solution, second: True if a candidate for the
+ * global minimum is found and false otherwise
+ */
+std::pair<std::vector<double>, bool>
+GSL_Minimize_Gradient_gen_all(const Class_Potential_Origin &model,
+                              const double &Temp,
+                              const int &seed,
+                              std::vector<std::vector<double>> &saveAllMinima,
+                              const std::size_t &MaxSol,
+                              bool UseMultiThreading               = true,
+                              const CancellationToken *Token       = nullptr,
+                              const MinimumContinuation *WarmStart = nullptr);
 
 } // namespace Minimizer
 } // namespace BSMPT
@@ -12,9 +12,15 @@
 #define MINIMIZER_H_
 
 #include <BSMPT/config.h>
+#include <BSMPT/minimizer/CancellationToken.h>
+#include <BSMPT/minimizer/DistinctMinima.h>
+#include <BSMPT/minimizer/MinimumContinuation.h>
 #include <BSMPT/models/IncludeAllModels.h>
+#include <BSMPT/utility/EvaluationBudget.h>
 #include <memory>
+#include <string>
 #include <thread>
+#include <unordered_map>
 #include <vector> // for vector
 
 namespace BSMPT
@@ -56,14 +62,21 @@ const std::size_t Num_threads = std::thread::hardware_concurrency();
  * @param UseGSL Should GSL be used?
  * @param UseCMAES Should CMAES be used?
  * @param UseNLopt Should NLopt be used?
+ * @param UseGSLGradient Should the GSL multistart with the gradient-based
+ * BFGS algorithm be used?
+ * @param UseNLoptGradient Should the NLopt multistart with the gradient-based
+ * LBFGS algorithm be used?
  * @return
  */
-constexpr int CalcWhichMinimizer(bool UseGSL   = UseGSLDefault,
-                                 bool UseCMAES = UseLibCMAESDefault,
-                                 bool UseNLopt = UseNLoptDefault)
+constexpr int CalcWhichMinimizer(bool UseGSL           = UseGSLDefault,
+                                 bool UseCMAES         = UseLibCMAESDefault,
+                                 bool UseNLopt         = UseNLoptDefault,
+                                 bool UseGSLGradient   = false,
+                                 bool UseNLoptGradient = false)
 {
   return static_cast<int>(UseCMAES) + 2 * static_cast<int>(UseGSL) +
-         4 * static_cast<int>(UseNLopt);
+         4 * static_cast<int>(UseNLopt) + 8 * static_cast<int>(UseGSLGradient) +
+         16 * static_cast<int>(UseNLoptGradient);
 }
 
 /**
@@ -74,10 +87,24 @@ struct MinimizersToUse
   bool UseCMAES{UseLibCMAESDefault};
   bool UseGSL{UseGSLDefault};
   bool UseNLopt{UseNLoptDefault};
-  MinimizersToUse(bool useCMAES, bool useGSL, bool useNLopt)
+  /**
+   * @brief UseGSLGradient GSL multistart using the analytic gradient
+   */
+  bool UseGSLGradient{false};
+  /**
+   * @brief UseNLoptGradient NLopt multistart using the analytic gradient
+   */
+  bool UseNLoptGradient{false};
+  MinimizersToUse(bool useCMAES,
+                  bool useGSL,
+                  bool useNLopt,
+                  bool useGSLGradient   = false,
+                  bool useNLoptGradient = false)
       : UseCMAES{useCMAES}
       , UseGSL{useGSL}
       , UseNLopt{useNLopt}
+      , UseGSLGradient{useGSLGradient}
+      , UseNLoptGradient{useNLoptGradient}
   {
   }
 };
@@ -101,14 +128,163 @@ constexpr int WhichMinimizerDefault = CalcWhichMinimizer();
  * a given Temperature Temp and writes the solution in the std::vector sol. The
  * Minimization Debugging Options are written in the std::vector Check. The
  * std::vector Start gives the start value for the CMA-ES Minimization.
+ * If UseGradientRefinement is set, the best candidate is polished with a
+ * gradient-based local minimisation using
+ * Class_Potential_Origin::VEffGradient. The refined point is only accepted if
+ * it converged and lowers the potential.
+ * If WarmStart is given, the minima it holds for nearby temperatures are used
+ * as the first starting points of GSL and the minima found at Temp are added
+ * to it, see MinimumContinuation.
+ * If Budget is given, every evaluation of the effective potential by the
+ * minimizers is booked in it and they stop as soon as it is exhausted. The
+ * best candidate found until then is returned, the caller is responsible for
+ * checking Budget. The maximal number of iterations of each local GSL
+ * minimisation is taken from Budget.
  */
 std::vector<double>
 Minimize_gen_all(const std::shared_ptr<Class_Potential_Origin> &modelPointer,
                  const double &Temp,
                  std::vector<double> &Check,
                  const std::vector<double> &start,
-                 const int &WhichMinimizer = WhichMinimizerDefault,
-                 bool UseMultithreading    = true);
+                 const int &WhichMinimizer      = WhichMinimizerDefault,
+                 bool UseMultithreading         = true,
+                 bool UseGradientRefinement     = false,
+                 MinimumContinuation *WarmStart = nullptr,
+                 EvaluationBudget *Budget       = nullptr);
+
+/**
+ * @brief The MinimizerBackend enum labels the minimizer which found a
+ * candidate for the global minimum
+ */
+enum class MinimizerBackend
+{
+  Origin,
+  GSL,
+  CMAES,
+  NLopt,
+  GSLGradient,
+  NLoptGradient
+};
+/**
+ * @brief Map to convert MinimizerBackend to strings
+ */
+const std::unordered_map<MinimizerBackend, std::string>
+    MinimizerBackendToString{{MinimizerBackend::Origin, "origin"},
+                             {MinimizerBackend::GSL, "GSL"},
+                             {MinimizerBackend::CMAES, "CMAES"},
+                             {MinimizerBackend::NLopt, "NLopt"},
+                             {MinimizerBackend::GSLGradient, "GSL_gradient"},
+                             {MinimizerBackend::NLoptGradient,
+                              "NLopt_gradient"}};
+
+/**
+ * @brief The MinimizerRaceSettings struct configures Minimize_gen_all_race
+ */
+struct MinimizerRaceSettings
+{
+  /**
+   * @brief VEVTolerance two minima agree if all their VEVs, after both were
+   * mapped with the SymmetryReduction passed to Minimize_gen_all_race, differ
+   * by at most VEVTolerance (in GeV) ...
+   */
+  double VEVTolerance{1e-2};
+  /**
+   * @brief PotentialTolerance ... and their potential values by at most
+   * PotentialTolerance * max(1, |V|)
+   */
+  double PotentialTolerance{1e-6};
+  /**
+   * @brief Budget wall-clock time in seconds after which all minimizers are
+   * cancelled, no limit if non-positive
+   */
+  double Budget{0};
+};
+
+/**
+ * @brief The MinimizerRaceResult struct returned by Minimize_gen_all_race
+ */
+struct MinimizerRaceResult
+{
+  /**
+   * @brief Minimum the candidate for the global minimum
+   */
+  std::vector<double> Minimum;
+  /**
+   * @brief PotVal the potential value at Minimum
+   */
+  double PotVal{0};
+  /**
+   * @brief Winner the minimizer which found Minimum
+   */
+  MinimizerBackend Winner{MinimizerBackend::Origin};
+  /**
+   * @brief Agreement true if the race was stopped because two minimizers
+   * agreed
+   */
+  bool Agreement{false};
+  /**
+   * @brief BudgetExhausted true if the race was stopped by the time budget
+   */
+  bool BudgetExhausted{false};
+};
+
+/**
+ * @brief Minimize_gen_all_race Minimizes the potential like Minimize_gen_all,
+ * but the minimizers race each other. As soon as the candidates of two
+ * minimizers agree within the tolerances of Settings, or the time budget is
+ * used up, the remaining minimizers are cancelled through a shared
+ * CancellationToken. The lowest candidate found until then is returned
+ * together with the minimizer which found it.
+ * @param modelPointer model to minimize
+ * @param Temp temperature at which the potential is minimized
+ * @param start starting point for the CMA-ES minimization
+ * @param WhichMinimizer minimizers taking part in the race, see
+ * CalcWhichMinimizer
+ * @param Settings agreement tolerances and time budget
+ * @param UseMultithreading run the minimizers in parallel, otherwise they run
+ * one after another and the remaining ones are skipped once two agreed
+ * @param Reduce maps the candidates to a representative of their orbit under
+ * the discrete symmetries of the model before they are compared, e.g.
+ * MinimumTracer::ReduceVEV. Without it the VEVs are compared as they are, so
+ * minima related by a symmetry do not agree.
+ * @return MinimizerRaceResult with the candidate and the winner
+ */
+MinimizerRaceResult Minimize_gen_all_race(
+    const std::shared_ptr<Class_Potential_Origin> &modelPointer,
+    const double &Temp,
+    const std::vector<double> &start,
+    const int &WhichMinimizer             = WhichMinimizerDefault,
+    const MinimizerRaceSettings &Settings = MinimizerRaceSettings(),
+    bool UseMultithreading                = true,
+    const SymmetryReduction &Reduce       = nullptr);
+
+/**
+ * @brief Minimize_gen_all_distinct runs the same minimizers as
+ * Minimize_gen_all, but returns all distinct local minima they found instead
+ * of only the deepest one. This includes every local minimum of the GSL
+ * multistart, not only its candidate for the global minimum.
+ * @param modelPointer model to minimize
+ * @param Temp temperature at which the potential is minimized
+ * @param start starting point for the CMA-ES minimization
+ * @param WhichMinimizer minimizers to use, see CalcWhichMinimizer
+ * @param Reduce maps every minimum to a representative of its orbit under
+ * the discrete symmetries of the model before the clustering, e.g.
+ * MinimumTracer::ReduceVEV. Minima related by a symmetry are then counted
+ * once.
+ * @param Tolerance two minima are the same if all their VEVs agree within
+ * Tolerance in GeV, see DistinctMinima
+ * @param UseMultithreading run the minimizers in parallel
+ * @return the distinct minima with their potential values in ascending order
+ * of the potential
+ */
+std::vector<DistinctMinimum> Minimize_gen_all_distinct(
+    const std::shared_ptr<Class_Potential_Origin> &modelPointer,
+    const double &Temp,
+    const std::vector<double> &start,
+    const int &WhichMinimizer       = WhichMinimizerDefault,
+    const SymmetryReduction &Reduce = nullptr,
+    const double &Tolerance         = 1e-2,
+    bool UseMultithreading          = true);
 
 /**
  * @brief The MinimizerStatus enum for the Statusflags of the minimizer
@@ -120,7 +296,8 @@ enum class MinimizerStatus
   NOTNLOSTABLE            = -2,
   NUMERICALLYUNSTABLE     = -3,
   BELOWTHRESHOLD          = -4,
-  NLOVEVZEROORINF         = -5
+  NLOVEVZEROORINF         = -5,
+  BUDGETEXHAUSTED         = -6
 
 };
 
@@ -137,6 +314,8 @@ enum class MinimizerStatus
  * the last VEVs encountered
  * @param StatusFlag = BELOWTHRESHOLD: v/T < C_PT during the bisection =>  vc =
  * Last VEV, TC = Last Temp
+ * @param StatusFlag = BUDGETEXHAUSTED: the EvaluationBudget was used up before
+ * the bisection converged => vc and Tc are the last VEVs encountered
  * @param vc = critical VEV
  * @param Tc = critical Temperature
  * @param EWMinimum: The broken EW minimum
@@ -160,6 +339,13 @@ struct EWPTReturnType
  * method
  *  @param WhichMinimizer Which minimizers should be taken? 1 = CMAES, 2 = GSL,
  * 4 = NLOPT, to use multiple add the numbers
+ *  @param UseMultithreading Should the minimizers run in parallel?
+ *  @param SkipRandomStarts The minima found at the previous temperatures of
+ * the bisection are always continued to the next one. If SkipRandomStarts is
+ * set, the random starting points of GSL are dropped once the continued
+ * minima are confirmed, see MinimumContinuation.
+ *  @param Budget The bisection stops with BUDGETEXHAUSTED once the
+ * EvaluationBudget is used up, optional
  *  @return The information are returned in a EWPTReturnType struct
  */
 EWPTReturnType
@@ -167,7 +353,9 @@ PTFinder_gen_all(const std::shared_ptr<Class_Potential_Origin> &modelPointer,
                  const double &TempStart,
                  const double &TempEnd,
                  const int &WhichMinimizer = WhichMinimizerDefault,
-                 bool UseMultithreading    = true);
+                 bool UseMultithreading    = true,
+                 bool SkipRandomStarts     = false,
+                 EvaluationBudget *Budget  = nullptr);
 
 /**
  * @brief Minimize_gen_all_tree_level Minimizes the tree-level potential
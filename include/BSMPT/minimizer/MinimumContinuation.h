@@ -0,0 +1,134 @@
+// SPDX-FileCopyrightText: 2021 Philipp Basler, Margarete Mühlleitner and Jonas
+// Müller
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file
+ * Cache of the minima found at previous temperatures, used as starting points
+ * for the minimization at the next temperature
+ */
+
+#ifndef MINIMUMCONTINUATION_H_
+#define MINIMUMCONTINUATION_H_
+
+#include <cstddef>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace BSMPT
+{
+namespace Minimizer
+{
+
+/**
+ * @brief The MinimumContinuation class stores the distinct minima found at
+ * each temperature. Sweeps in the temperature, like the bisection in
+ * PTFinder_gen_all or the evolution in VEVEVO, use them as priority starting
+ * points of the local minimisations at the next temperature, so that the
+ * phases are followed instead of searched for from scratch.
+ *
+ * The minima at the cached temperature closest to T are continued to T. If
+ * Extrapolate is set, each of them is moved along the line through the
+ * nearest minimum at the second closest cached temperature, which
+ * interpolates between the bracketing temperatures of a bisection and
+ * extrapolates in an evolution. These predictions are followed by the minima
+ * at both temperatures themselves.
+ *
+ * If SkipRandomStarts is set, the random starting points of the GSL
+ * multistart are dropped as soon as every continued minimum is confirmed,
+ * i.e. the local minimisation from its prediction converged to a point at
+ * most ConfirmationTolerance away. New phases emerging far away from the
+ * known ones are then only found by the other minimizers.
+ *
+ * Insert must not be called while a minimisation reads the cache.
+ */
+class MinimumContinuation
+{
+public:
+  /**
+   * @param SkipRandomStarts drop the random starting points once the
+   * continued minima are confirmed
+   * @param Extrapolate move the continued minima linearly in the temperature
+   * @param ConfirmationTolerance maximal distance in GeV in every VEV between
+   * a prediction and the minimum confirming it
+   * @param DistinctTolerance two minima closer than DistinctTolerance in GeV
+   * in every VEV are considered the same
+   */
+  explicit MinimumContinuation(bool SkipRandomStarts        = false,
+                               bool Extrapolate             = true,
+                               double ConfirmationTolerance = 1,
+                               double DistinctTolerance     = 1e-2);
+
+  /**
+   * @brief Insert adds the distinct Minima found at Temp to the cache
+   */
+  void Insert(const double &Temp,
+              const std::vector<std::vector<double>> &Minima);
+
+  /**
+   * @brief StartingPoints returns the priority starting points for the
+   * minimisation at Temp, the predictions of the continued minima first.
+   * Empty if nothing is cached.
+   */
+  std::vector<std::vector<double>> StartingPoints(const double &Temp) const;
+
+  /**
+   * @brief Confirms checks if every continued minimum at Temp is confirmed by
+   * one of Minima
+   */
+  bool Confirms(const double &Temp,
+                const std::vector<std::vector<double>> &Minima) const;
+
+  /**
+   * @brief GetSkipRandomStarts returns true if the random starting points are
+   * dropped once the continued minima are confirmed
+   */
+  bool GetSkipRandomStarts() const { return SkipRandomStarts; }
+
+  /**
+   * @brief NumberOfTemperatures returns the number of cached temperatures
+   */
+  std::size_t NumberOfTemperatures() const { return Cache.size(); }
+
+  /**
+   * @brief Clear removes all cached minima
+   */
+  void Clear() { Cache.clear(); }
+
+private:
+  using MinimaAtTemperature =
+      std::map<double, std::vector<std::vector<double>>>;
+
+  /**
+   * @brief Neighbours returns the cached temperatures closest and second
+   * closest to Temp, the second one is Cache.end() if only one is cached
+   */
+  std::pair<MinimaAtTemperature::const_iterator,
+            MinimaAtTemperature::const_iterator>
+  Neighbours(const double &Temp) const;
+
+  /**
+   * @brief Predictions returns the minima at the closest cached temperature
+   * continued to Temp
+   */
+  std::vector<std::vector<double>> Predictions(const double &Temp) const;
+
+  /**
+   * @brief AddDistinct appends Point to Points unless it is already contained
+   */
+  void AddDistinct(std::vector<std::vector<double>> &Points,
+                   const std::vector<double> &Point) const;
+
+  bool SkipRandomStarts;
+  bool Extrapolate;
+  double ConfirmationTolerance;
+  double DistinctTolerance;
+  MinimaAtTemperature Cache;
+};
+
+} // namespace Minimizer
+} // namespace BSMPT
+
+#endif // MINIMUMCONTINUATION_H_
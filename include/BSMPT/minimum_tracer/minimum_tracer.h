@@ -14,12 +14,15 @@
 #include "Eigen/Eigenvalues"                   // Eigenvalues utility
 #include <BSMPT/minimizer/Minimizer.h>         // for Minimizer
 #include <BSMPT/models/ClassPotentialOrigin.h> // for Class_Potential_Origin
+#include <BSMPT/utility/EvaluationBudget.h>
 #include <BSMPT/utility/Logger.h>              // for Logger Class
+#include <BSMPT/utility/NumericalDerivatives.h>
 #include <BSMPT/utility/asciiplotter/asciiplotter.h>
 #include <BSMPT/utility/utility.h>
 #include <Eigen/Dense> // Eigenvalues matrix
 #include <chrono>
 #include <cmath>    // std::pow
+#include <map>
 #include <memory>   // for shared_ptr
 #include <optional> // std::optional
 #include <stdlib.h> // std::strtol
@@ -90,7 +93,8 @@ enum class StatusTracing
   NoCoverage,
   NoMinsAtBoundaries,
   NoGlobMinCoverage,
-  Failure
+  Failure,
+  BudgetExhausted
 };
 /**
  * @brief Map to convert StatusTracingToString to strins
@@ -102,7 +106,8 @@ const std::unordered_map<StatusTracing, std::string> StatusTracingToString{
     {StatusTracing::NoCoverage, "no_coverage"},
     {StatusTracing::NoMinsAtBoundaries, "no_mins_at_boundaries"},
     {StatusTracing::NoGlobMinCoverage, "no_glob_min_coverage"},
-    {StatusTracing::Failure, "failure"}};
+    {StatusTracing::Failure, "failure"},
+    {StatusTracing::BudgetExhausted, "budget_exhausted"}};
 /**
  * @brief Possible status for the coex phase
  *
@@ -172,7 +177,8 @@ enum class StatusGW
 {
   NotSet,
   Success,
-  Failure
+  Failure,
+  BudgetExhausted
 };
 /**
  * @brief Map to convert StatusGWToString to strins
@@ -181,7 +187,8 @@ enum class StatusGW
 const std::unordered_map<StatusGW, std::string> StatusGWToString{
     {StatusGW::NotSet, "not_set"},
     {StatusGW::Success, "success"},
-    {StatusGW::Failure, "failure"}};
+    {StatusGW::Failure, "failure"},
+    {StatusGW::BudgetExhausted, "budget_exhausted"}};
 
 /**
  * @brief Override << operator to handle StatusNLOStability
@@ -240,6 +247,56 @@ std::ostream &operator<<(std::ostream &os, const StatusGW &status);
  */
 std::ostream &operator<<(std::ostream &os, const StatusTemperature &status);
 
+/**
+ * @brief The PhaseStepController class chooses the temperature steps of the
+ * predictor-corrector mode of MinimumTracer::TrackPhase. The error of the
+ * linear prediction, measured by the displacement of the corrector, grows
+ * quadratically with the step, so the step is scaled by sqrt(Tolerance /
+ * Error). Additionally the step is limited such that the linearly
+ * extrapolated smallest eigenvalue of the Hessian stays above half of its
+ * current value. The end of a phase is then approached in shrinking steps
+ * instead of being jumped over.
+ */
+class PhaseStepController
+{
+public:
+  /**
+   * @param Tolerance target displacement of the corrector in GeV
+   * @param MaxStep maximal absolute temperature step
+   * @param MinStep smallest step the eigenvalue limit reduces the step to
+   */
+  PhaseStepController(const double &Tolerance,
+                      const double &MaxStep,
+                      const double &MinStep);
+
+  /**
+   * @brief Accepted returns the step following the accepted step dT
+   * @param dT accepted temperature step
+   * @param Error displacement of the corrector from the predicted minimum
+   * @param T temperature of the accepted minimum
+   * @param SEV smallest eigenvalue of the Hessian at the accepted minimum,
+   * ignored if NaN
+   */
+  double Accepted(const double &dT,
+                  const double &Error,
+                  const double &T,
+                  const double &SEV = std::nan(""));
+
+  /**
+   * @brief Rejected returns the reduced step after the corrector failed for
+   * the step dT with the displacement Error
+   */
+  double Rejected(const double &dT, const double &Error) const;
+
+private:
+  double Tolerance;
+  double MaxStep;
+  double MinStep;
+  bool HasPrevious{false};
+  double PreviousT{0};
+  double PreviousSEV{0};
+};
+
 /**
  * @brief struct to store minimum and temperature
  * @param point coordinates in field space
@@ -248,6 +305,8 @@ std::ostream &operator<<(std::ostream &os, const StatusTemperature &status);
  * @param is_glob_min true if minimum is global minimum
  * @param EdgeOfPhase 1 = starting minimum | 0 = Middle minimum | -1 = Ending
  * minimum (sum of EdgeOfPhase is the number of coexisting phases)
+ * @param tangent temperature derivative dphi/dT of point, empty if not yet
+ * calculated
  */
 struct Minimum
 {
@@ -256,6 +315,7 @@ struct Minimum
   double potential;
   bool is_glob_min = false;
   int EdgeOfPhase  = 0;
+  std::vector<double> tangent;
 
   bool operator<(const Minimum &a) const { return temp < a.temp; }
 };
@@ -279,6 +339,14 @@ public:
    */
   double GradientThreshold = 1e-3;
 
+  /**
+   * @brief Use Class_Potential_Origin::VEffHessian for the Hessian matrices.
+   * If false, the Hessian is calculated with finite differences of the
+   * potential.
+   *
+   */
+  bool UseAnalyticHessian = true;
+
   /**
    * @brief Add a constant to the diagonals of the hessian matrix in the
    * LocateMinimum function. Helps with convergence.
@@ -298,6 +366,38 @@ public:
    */
   std::vector<Minimum> SavedMinimaFromVEVSplitting;
 
+  /**
+   * @brief Optional bound on the evaluations of the effective potential and
+   * the wall time spent on the parameter point. It is shared with the
+   * minimizers and the BounceSolution. Once it is exhausted the phase tracking
+   * stops and the Vacuum and BounceSolution report BudgetExhausted.
+   *
+   */
+  std::shared_ptr<EvaluationBudget> Budget;
+
+  /**
+   * @brief Use the predictor-corrector mode in TrackPhase. The minimum at the
+   * next temperature is predicted along the tangent of the phase, see
+   * PhaseTangent(), and the temperature step is chosen by a
+   * PhaseStepController instead of being capped at the initial step size.
+   *
+   */
+  bool UsePredictorCorrector = false;
+
+  /**
+   * @brief Target displacement of the corrector from the predicted minimum in
+   * GeV per VEV direction in the predictor-corrector mode
+   *
+   */
+  double PredictorTolerance = 0.1;
+
+  /**
+   * @brief Maximal temperature step in the predictor-corrector mode in units
+   * of the initial step size of TrackPhase
+   *
+   */
+  double PredictorMaxStepFactor = 20;
+
   /**
    * @brief default constructor
    */
@@ -364,6 +464,36 @@ public:
    */
   std::vector<double> GetGlobalMinimum(const double &Temp);
 
+  /**
+   * @brief GetUseMultithreading returns true if the minimizers run on the
+   * ThreadPool
+   */
+  bool GetUseMultithreading() const { return UseMultithreading; }
+
+  /**
+   * @brief get all distinct local minima found by the minimizers, see
+   * Minimizer::Minimize_gen_all_distinct. The minima are mapped with ReduceVEV
+   * and ConvertToNonFlatDirections before they are clustered, so minima
+   * related by a symmetry of the potential are only returned once.
+   * @param Temp temperature
+   * @param Tolerance two minima are the same if all their VEVs agree within
+   * Tolerance in GeV
+   * @return minima in reduced VEV dimension in ascending order of the
+   * potential, the first one is marked as the global minimum
+   */
+  std::vector<Minimum> GetDistinctMinima(const double &Temp,
+                                         const double &Tolerance = 1e-2);
+
+  /**
+   * @brief PotentialMultiT evaluates the effective potential at a fixed point
+   * for several temperatures, see Class_Potential_Origin::VEffMultiT
+   * @param point point in reduced VEV dimension
+   * @param Temps temperatures
+   * @return potential at point for each entry of Temps
+   */
+  std::vector<double> PotentialMultiT(const std::vector<double> &point,
+                                      const std::vector<double> &Temps);
+
   /**
    * @brief IsGlobMin checks whether current minimum is the global minimum
    * @param min Minimum to check, sets is_glob_min to true if min is global
@@ -396,6 +526,44 @@ public:
    */
   int IsThereEWSymmetryRestoration();
 
+  /**
+   * @brief GetHessian returns the Hessian of VEff(vev, T) / Normalisation in
+   * the VEV space. If UseAnalyticHessian is set,
+   * Class_Potential_Origin::VEffHessian is used, otherwise finite differences
+   * of the potential. An analytic Hessian consumes as many units of Budget as
+   * the finite-difference stencil, 1 + 2 dim^2.
+   * @param T temperature, captured by value
+   * @param eps step size of the finite differences
+   * @param Normalised if true, the potential is normalised by 1 + T^2
+   * @return Hessian function
+   */
+  std::function<std::vector<std::vector<double>>(std::vector<double>)>
+  GetHessian(const double &T, const double &eps, const bool &Normalised = true);
+
+  /**
+   * @brief GetHessian returns the finite-difference Hessian of the potential
+   * wrapper V
+   * @param V potential wrapper
+   * @param eps step size of the finite differences
+   * @return Hessian function
+   */
+  std::function<std::vector<std::vector<double>>(std::vector<double>)>
+  GetHessian(const std::function<double(std::vector<double>)> &V,
+             const double &eps);
+
+  /**
+   * @brief GetPotentialBatch returns the potential wrapper
+   * VEff(vev, T) / Normalisation for a block of VEV configurations, evaluated
+   * with Class_Potential_Origin::VEffBatch. Large blocks are distributed over
+   * several threads if UseMultithreading is set.
+   * @param T temperature. It is captured by reference, so it has to outlive
+   * the returned function.
+   * @param Normalised if true, the potential is normalised by 1 + T^2
+   * @return batched potential wrapper
+   */
+  BatchFunction GetPotentialBatch(const double &T,
+                                  const bool &Normalised = true);
+
   /**
    * @brief SmallestEigenvalue calculate Eigenvalues of Hessian and returns
    * smallest
@@ -421,6 +589,17 @@ public:
                                                  std::vector<double> point_2,
                                                  double T_2);
 
+  /**
+   * @brief PhaseTangent calculates the temperature derivative of the minimum
+   * point, dphi/dT = -H^{-1} d/dT grad V, from the Hessian H and the
+   * derivative of the gradient of the potential at temperature T
+   * @param point minimum at temperature T
+   * @param T temperature
+   * @return tangent of the phase, zero if the Hessian is singular
+   */
+  std::vector<double> PhaseTangent(const std::vector<double> &point,
+                                   const double &T);
+
   /**
    * @brief TrackPhase with enforced global minimum tracing (= phase is checked
    * if it is still the global minimum until it is no longer, then the current
@@ -598,6 +777,28 @@ bool almost_the_same(const std::vector<double> &a,
                      const double &rel_precision     = 0.01,
                      const double &num_zero          = 1e-10);
 
+/**
+ * @brief Locates a root of f in the bracket [a, b] with the Illinois variant of
+ * the regula falsi. Each step replaces one end of the bracket by the secant
+ * root and halves the function value at the end which was kept, which
+ * converges superlinearly for simple roots unlike the bisection.
+ * @param f function with a sign change between a and b
+ * @param a lower end of the bracket
+ * @param b upper end of the bracket
+ * @param fa f(a)
+ * @param fb f(b)
+ * @param rel_precision relative width of the final bracket
+ * @param max_iter maximal number of evaluations of f
+ * @return root of f
+ */
+double FindRootIllinois(const std::function<double(double)> &f,
+                        double a,
+                        double b,
+                        double fa,
+                        double fb,
+                        const double &rel_precision = 1e-10,
+                        const int &max_iter         = 100);
+
 /**
  * @brief Phase object
  *
@@ -620,10 +821,18 @@ struct Phase
   double T_high = 0;
 
   /**
-   * @brief Set of Minimum that compose the phase
+   * @brief Set of Minimum that compose the phase, sorted by temperature
    */
   std::vector<Minimum> MinimumPhaseVector;
 
+  /**
+   * @brief Get() interpolates between the minima of MinimumPhaseVector if the
+   * estimated error of the interpolation is below InterpolationTolerance (in
+   * GeV), otherwise the phase is tracked to the temperature. A non-positive
+   * value always tracks the phase.
+   */
+  double InterpolationTolerance = 1e-3;
+
   /**
    * @brief MinTracer object
    */
@@ -645,6 +854,37 @@ struct Phase
    */
   Minimum Get(double T);
 
+  /**
+   * @brief Interpolates the minimum of the phase at temperature T with a cubic
+   * Hermite spline between the two neighbouring minima in MinimumPhaseVector.
+   * The tangents dphi/dT at both minima are calculated with
+   * MinimumTracer::PhaseTangent() once and stored in the minima.
+   *
+   * The error is estimated by the difference to the quadratic interpolation
+   * using only the tangent of the closer minimum. It vanishes if the phase is
+   * quadratic in T and is of lower order in the spacing of the minima than the
+   * error of the cubic spline, i.e. a conservative estimate.
+   *
+   * @param T temperature strictly between T_low and T_high
+   * @param ErrorEstimate estimated distance in GeV to the exact minimum
+   * @return interpolated minimum at temperature T
+   */
+  Minimum Interpolate(const double &T, double &ErrorEstimate);
+
+  /**
+   * @brief Approximates the potential of the phase at several temperatures
+   * without tracking the phase. Each temperature is assigned to the closest
+   * minimum in MinimumPhaseVector and the potential is evaluated at its field
+   * configuration. Since the minima are stationary points, the error is of
+   * second order in the distance to the exact minimum. All temperatures
+   * assigned to the same minimum are evaluated with one call of
+   * MinimumTracer::PotentialMultiT.
+   *
+   * @param Temps temperatures in ascending order
+   * @return potential of the phase at each entry of Temps
+   */
+  std::vector<double> GetPotentials(const std::vector<double> &Temps);
+
   /**
    * @brief empty constructor
    */
@@ -725,6 +965,22 @@ struct Phase
         const double &LowT,
         const double &HighT,
         std::shared_ptr<MinimumTracer> &MinTracerIn);
+
+  /**
+   * @brief Construct a new Phase:: Phase object like the constructor above,
+   * but with the global minimum at initialT already known
+   *
+   * @param initialT Temperature of the phase given as input
+   * @param LowT Lowest temperature
+   * @param HighT Highest temperature
+   * @param GlobalMinimum global minimum at initialT in VEV dimension
+   * @param MinTracerIn MinTracer pointer
+   */
+  Phase(const double &initialT,
+        const double &LowT,
+        const double &HighT,
+        const std::vector<double> &GlobalMinimum,
+        std::shared_ptr<MinimumTracer> &MinTracerIn);
 };
 
 /**
@@ -756,7 +1012,12 @@ struct CoexPhases
              const double &Thigh_in);
 
   /**
-   * @brief CalculateTc critical temperature for coexising phase pair
+   * @brief CalculateTc critical temperature for coexising phase pair. The
+   * root of dV(T) = V(true phase) - V(false phase) is located with
+   * FindRootIllinois, first on the phases interpolated between their tracked
+   * minima and then, in a narrow bracket around this estimate, with the
+   * interpolation tolerance of the phases, so that the phases are only tracked
+   * again close to Tc.
    */
   void CalculateTc();
 };
@@ -799,6 +1060,20 @@ struct Vacuum
    */
   int num_points = 0;
 
+  /**
+   * @brief number of times the grid of intermediate points is refined by the
+   * midpoints of neighbouring points that belong to different phases
+   */
+  int num_refinements = 0;
+
+  /**
+   * @brief temperatures of the grid scanned by the default multi-step mode,
+   * including T_low and T_high if num_refinements > 0, mapped to the index in
+   * PhasesList of the phase containing the global minimum there, -1 if there
+   * is none. The indices refer to PhasesList before it is sorted.
+   */
+  std::map<double, int> GridPhases;
+
   /**
    * @brief vacuum status code = success, no_coverage, no_glob_min_coverage
    */
@@ -847,14 +1122,17 @@ struct Vacuum
    * @param do_only_tracing if true only tracing and no identification of all
    * possible coexisting phase pairs and their critical temperatures is done, if
    * false identification and calculation of Tc is done
+   * @param num_refinementsIn number of refinements of the intermediate points
+   * at phase boundaries
    */
   Vacuum(const double &T_lowIn,
          const double &T_highIn,
          std::shared_ptr<MinimumTracer> &MinTracerIn,
          std::shared_ptr<Class_Potential_Origin> &modelPointerIn,
          const int &UseMultiStepPTModeIn,
-         const int &num_pointsIn     = 10,
-         const bool &do_only_tracing = false);
+         const int &num_pointsIn      = 10,
+         const bool &do_only_tracing  = false,
+         const int &num_refinementsIn = 0);
 
   /**
    * @brief MultiStepPTTracer traces all phases between T_high and T_low
@@ -865,6 +1143,37 @@ struct Vacuum
    */
   void MultiStepPTTracer(const double &Temp, const double &deltaT = 0);
 
+  /**
+   * @brief ScanGlobalMinima calculates the global minima at several
+   * temperatures, concurrently on the ThreadPool if the MinTracer uses
+   * multithreading
+   * @param Temps temperatures
+   * @return global minimum in VEV dimension for each entry of Temps
+   */
+  std::vector<std::vector<double>>
+  ScanGlobalMinima(const std::vector<double> &Temps);
+
+  /**
+   * @brief MergeGridPoint traces a new phase from the global minimum at
+   * temperature Temp unless it belongs to an already traced phase
+   * @param Temp temperature
+   * @param GlobalMinimum global minimum at Temp in VEV dimension
+   * @return index of the phase containing the global minimum, -1 if none
+   */
+  int MergeGridPoint(const double &Temp,
+                     const std::vector<double> &GlobalMinimum);
+
+  /**
+   * @brief TraceConcurrently runs independent phase traces, as tasks on the
+   * ThreadPool if the MinTracer uses multithreading and one after another
+   * otherwise. Each trace only fills its own Phase, the phases are added to
+   * PhasesList by the caller afterwards in a fixed order. The log messages
+   * of each trace are collected in a LogBuffer and written in the order of
+   * Traces once all of them have finished.
+   * @param Traces phase traces
+   */
+  void TraceConcurrently(const std::vector<std::function<void()>> &Traces);
+
   /**
    * @brief print info on phase
    * @param phase Phase object
@@ -0,0 +1,235 @@
+// SPDX-FileCopyrightText: 2021 Philipp Basler, Margarete Mühlleitner and Jonas
+// Müller
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file
+ * Eigenvalues of self-adjoint matrices with a known block structure
+ */
+#ifndef BLOCKEIGENSOLVER_H_
+#define BLOCKEIGENSOLVER_H_
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <vector>
+
+#include <Eigen/Dense>
+
+namespace BSMPT
+{
+
+/**
+ * @brief The MatrixBlocks struct stores a decomposition of the indices of a
+ * square matrix into blocks which are not coupled by any entry of the matrix.
+ * After reordering the indices block by block the matrix is block diagonal.
+ */
+struct MatrixBlocks
+{
+  /**
+   * @brief Dimension of the matrix
+   */
+  std::size_t Dimension = 0;
+  /**
+   * @brief Blocks the indices of each block in ascending order
+   */
+  std::vector<std::vector<std::size_t>> Blocks;
+
+  /**
+   * @brief IsTrivial true if there is no decomposition into smaller blocks
+   */
+  bool IsTrivial() const { return Blocks.size() <= 1; }
+};
+
+/**
+ * @brief FindMatrixBlocks determines the connected components of the graph
+ * with an edge between i and j for every non-vanishing entry (i,j) of Pattern
+ * @param Pattern Pattern(i,j) is true if the matrix entry (i,j) can be
+ * non-vanishing
+ */
+MatrixBlocks FindMatrixBlocks(
+    const Eigen::Matrix<bool, Eigen::Dynamic, Eigen::Dynamic> &Pattern);
+
+/**
+ * @brief ClosedFormEigenvalues2x2 calculates the eigenvalues of the
+ * self-adjoint 2x2 matrix ((a, b), (b^*, d))
+ * @param EV the two eigenvalues
+ */
+template <typename Scalar>
+void ClosedFormEigenvalues2x2(double a, const Scalar &b, double d, double *EV)
+{
+  // The eigenvalue with the larger modulus is calculated directly, the other
+  // one from the determinant to avoid cancellations
+  const double Mean     = 0.5 * (a + d);
+  const double Split    = std::sqrt(std::pow(0.5 * (a - d), 2) + std::norm(b));
+  const double Product  = a * d - std::norm(b);
+  const double Dominant = (Mean >= 0) ? Mean + Split : Mean - Split;
+  EV[0]                 = Dominant;
+  EV[1]                 = (Dominant == 0) ? 0 : Product / Dominant;
+}
+
+/**
+ * @brief ClosedFormEigenvalues3x3 calculates the eigenvalues of a self-adjoint
+ * 3x3 matrix from the trigonometric solution of its characteristic polynomial
+ * @param A the matrix, only the upper triangle is used
+ * @param EV the three eigenvalues
+ */
+template <typename Scalar>
+void ClosedFormEigenvalues3x3(const Eigen::Matrix<Scalar, 3, 3> &A, double *EV)
+{
+  const double a00 = std::real(A(0, 0));
+  const double a11 = std::real(A(1, 1));
+  const double a22 = std::real(A(2, 2));
+  const double n01 = std::norm(A(0, 1));
+  const double n02 = std::norm(A(0, 2));
+  const double n12 = std::norm(A(1, 2));
+
+  const double Shift = (a00 + a11 + a22) / 3.;
+  const double b00   = a00 - Shift;
+  const double b11   = a11 - Shift;
+  const double b22   = a22 - Shift;
+  const double p2 =
+      (b00 * b00 + b11 * b11 + b22 * b22 + 2 * (n01 + n02 + n12)) / 6.;
+  if (p2 == 0)
+  {
+    EV[0] = EV[1] = EV[2] = Shift;
+    return;
+  }
+  const double p = std::sqrt(p2);
+  // det(A - Shift), the determinant of a self-adjoint matrix is real
+  const double Det =
+      b00 * b11 * b22 - b00 * n12 - b11 * n02 - b22 * n01 +
+      2 * std::real(A(0, 1) * A(1, 2) * std::conj(A(0, 2)));
+  const double r   = std::clamp(Det / (2 * p2 * p), -1., 1.);
+  const double phi = std::acos(r) / 3.;
+  EV[0]            = Shift + 2 * p * std::cos(phi);
+  EV[2]            = Shift + 2 * p * std::cos(phi + 2 * M_PI / 3.);
+  EV[1]            = 3 * Shift - EV[0] - EV[2];
+}
+
+/**
+ * @brief The BlockEigenvalueSolver class calculates the eigenvalues and
+ * optionally the eigenvectors of a self-adjoint matrix block by block. For
+ * eigenvalues only, blocks of dimension one to three are solved in closed
+ * form, larger blocks with Eigen::SelfAdjointEigenSolver. With eigenvectors all
+ * blocks larger than one are solved with Eigen::SelfAdjointEigenSolver. The
+ * buffers for the blocks are kept between calls, so repeated calls with the
+ * same block structure do not allocate memory.
+ */
+template <typename MatrixType> class BlockEigenvalueSolver
+{
+public:
+  /**
+   * @brief compute calculates the eigenvalues of Matrix
+   * @param Matrix self-adjoint matrix, block diagonal w.r.t. Blocks. It can be
+   * of any size type with the scalar type of MatrixType
+   * @param Blocks block structure of Matrix
+   * @param Options Eigen::EigenvaluesOnly or Eigen::ComputeEigenvectors
+   */
+  template <typename Derived>
+  void compute(const Eigen::MatrixBase<Derived> &Matrix,
+               const MatrixBlocks &Blocks,
+               int Options = Eigen::EigenvaluesOnly)
+  {
+    using Scalar           = typename MatrixType::Scalar;
+    const bool WithVectors = Options == Eigen::ComputeEigenvectors;
+    const auto Dimension   = static_cast<Eigen::Index>(Blocks.Dimension);
+    Eigenvalues.resize(Dimension);
+    if (WithVectors) Eigenvectors.setZero(Dimension, Dimension);
+    if (BlockMatrices.size() < Blocks.Blocks.size())
+    {
+      BlockMatrices.resize(Blocks.Blocks.size());
+      BlockSolvers.resize(Blocks.Blocks.size());
+      BlockSolverSizes.resize(Blocks.Blocks.size(), 0);
+    }
+
+    Eigen::Index Position = 0;
+    for (std::size_t n = 0; n < Blocks.Blocks.size(); n++)
+    {
+      const auto &Index = Blocks.Blocks[n];
+      double *EV        = Eigenvalues.data() + Position;
+      if (Index.size() == 1)
+      {
+        EV[0] = std::real(Matrix(Index[0], Index[0]));
+        if (WithVectors) Eigenvectors(Index[0], Position) = 1;
+      }
+      else if (Index.size() == 2 and not WithVectors)
+      {
+        ClosedFormEigenvalues2x2(std::real(Matrix(Index[0], Index[0])),
+                                 Matrix(Index[0], Index[1]),
+                                 std::real(Matrix(Index[1], Index[1])),
+                                 EV);
+      }
+      else if (Index.size() == 3 and not WithVectors)
+      {
+        Eigen::Matrix<Scalar, 3, 3> Block;
+        for (std::size_t i = 0; i < 3; i++)
+        {
+          for (std::size_t j = i; j < 3; j++)
+          {
+            Block(i, j) = Matrix(Index[i], Index[j]);
+          }
+        }
+        ClosedFormEigenvalues3x3(Block, EV);
+      }
+      else
+      {
+        const auto Size = static_cast<Eigen::Index>(Index.size());
+        auto &Block     = BlockMatrices[n];
+        auto &Solver    = BlockSolvers[n];
+        if (BlockSolverSizes[n] != Size)
+        {
+          Solver              = Eigen::SelfAdjointEigenSolver<MatrixType>(Size);
+          BlockSolverSizes[n] = Size;
+        }
+        Block.resize(Size, Size);
+        for (Eigen::Index i = 0; i < Size; i++)
+        {
+          for (Eigen::Index j = 0; j < Size; j++)
+          {
+            Block(i, j) = Matrix(Index[i], Index[j]);
+          }
+        }
+        Solver.compute(Block, Options);
+        for (Eigen::Index i = 0; i < Size; i++)
+        {
+          EV[i] = Solver.eigenvalues()[i];
+        }
+        if (WithVectors)
+        {
+          for (Eigen::Index i = 0; i < Size; i++)
+          {
+            Eigenvectors.row(Index[i]).segment(Position, Size) =
+                Solver.eigenvectors().row(i);
+          }
+        }
+      }
+      Position += Index.size();
+    }
+  }
+
+  /**
+   * @brief eigenvalues the eigenvalues ordered block by block, not sorted
+   */
+  const Eigen::VectorXd &eigenvalues() const { return Eigenvalues; }
+
+  /**
+   * @brief eigenvectors the normalised eigenvectors as columns in the order of
+   * eigenvalues(). Only available after compute() with
+   * Eigen::ComputeEigenvectors
+   */
+  const MatrixType &eigenvectors() const { return Eigenvectors; }
+
+private:
+  Eigen::VectorXd Eigenvalues;
+  MatrixType Eigenvectors;
+  std::vector<MatrixType> BlockMatrices;
+  std::vector<Eigen::SelfAdjointEigenSolver<MatrixType>> BlockSolvers;
+  std::vector<Eigen::Index> BlockSolverSizes;
+};
+
+} // namespace BSMPT
+
+#endif /* BLOCKEIGENSOLVER_H_ */
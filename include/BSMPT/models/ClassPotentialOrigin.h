@@ -13,9 +13,13 @@
 
 #include "Eigen/Eigenvalues"
 #include <BSMPT/minimizer/Minimizer.h>
+#include <BSMPT/models/CurvatureStorage.h>
+#include <BSMPT/models/EvaluationWorkspace.h>
 #include <BSMPT/models/IncludeAllModels.h>
 #include <BSMPT/models/SMparam.h>
 #include <iostream>
+#include <memory>
+#include <utility>
 #include <vector>
 
 namespace BSMPT
@@ -26,6 +30,46 @@ namespace BSMPT
  */
 const bool C_UseParwani = false;
 
+/**
+ * @brief The ThermalDerivativeMethod enum selects how the derivative of the
+ * thermal integrals w.r.t. m^2/T^2 is evaluated in
+ * Class_Potential_Origin::boson and Class_Potential_Origin::fermion
+ */
+enum class ThermalDerivativeMethod
+{
+  /**
+   * Precomputed interpolation tables, see ThermalFunctions::JbosonTabulated
+   */
+  Tabulated,
+  /**
+   * Numerical integration for every call, kept as a reference
+   */
+  NumericalIntegration,
+  /**
+   * Piecewise Chebyshev representation, see
+   * ThermalFunctions::JbosonChebyshev
+   */
+  Chebyshev
+};
+
+/**
+ * @brief The ThermalFunctionMethod enum selects how the thermal integrals
+ * entering the effective potential are evaluated
+ */
+enum class ThermalFunctionMethod
+{
+  /**
+   * Low and high x expansions and the spline for negative x, see
+   * ThermalFunctions::JbosonInterpolated
+   */
+  Interpolated,
+  /**
+   * Piecewise Chebyshev representation without seams, see
+   * ThermalFunctions::JbosonChebyshev
+   */
+  Chebyshev
+};
+
 /**
  * @brief C_PT Lower threshold to stop the EWPT calculation
  */
@@ -48,6 +92,8 @@ const double C_CWcbGB = 5.0 / 6.0;
  */
 const double C_CWcbHiggs = 1.5;
 
+class V1LoopKernel;
+
 /**
  * @brief The Class_Potential_Origin class
  * Base class for all models. This class contains all numerical calculations on
@@ -67,6 +113,19 @@ protected:
    */
   bool UseTreeLevel = false;
 
+  /**
+   * @brief ThermalDerivatives method used for the derivatives of the thermal
+   * integrals in boson() and fermion()
+   */
+  ThermalDerivativeMethod ThermalDerivatives =
+      ThermalDerivativeMethod::Tabulated;
+
+  /**
+   * @brief ThermalValues method used for the thermal integrals in the
+   * effective potential and its gradient
+   */
+  ThermalFunctionMethod ThermalValues = ThermalFunctionMethod::Interpolated;
+
   /**
    * MSBar renormalization scale
    */
@@ -181,6 +240,44 @@ protected:
    * @brief SetCurvatureDone Used to check if the tensors are set
    */
   bool SetCurvatureDone = false;
+  /**
+   * @brief SparseCurvatureDone Used to check if SparseCurvature is set
+   */
+  bool SparseCurvatureDone = false;
+  /**
+   * @brief SparseCurvature Contiguous copy of the non-vanishing entries of the
+   * curvature tensors, set by SetSparseCurvatureArrays
+   */
+  CurvatureStorage SparseCurvature;
+  /**
+   * @brief Kernel optional specialised evaluation of the one-loop potential in
+   * the VEV subspace, see SetV1LoopKernel
+   */
+  std::unique_ptr<V1LoopKernel> Kernel;
+  /**
+   * Calculates the eigenvalues of the mass matrices without thermal
+   * corrections at v and stores them in Workspace.HiggsEigenvalues,
+   * Workspace.GaugeEigenvalues, Workspace.QuarkEigenvalues and
+   * Workspace.LeptonEigenvalues. Workspace.HiggsMass and Workspace.GaugeMass
+   * keep the boson mass matrices for V1LoopFromEigenvalues().
+   * @param v VEV configuration, either with NHiggs or with nVEV entries
+   * @param Workspace buffers used for the evaluation
+   * @return true if v lies in the VEV subspace, in which case the block
+   * structures of the mass matrices were used
+   */
+  bool CalculateMassEigenvalues(const std::vector<double> &v,
+                                EvaluationWorkspace &Workspace) const;
+  /**
+   * Calculates the one-loop potential at the temperature Temp from the mass
+   * eigenvalues stored by CalculateMassEigenvalues(). Only the Debye corrected
+   * boson mass matrices are diagonalised.
+   * @param Temp temperature
+   * @param InVEVSubspace return value of CalculateMassEigenvalues()
+   * @param Workspace buffers filled by CalculateMassEigenvalues()
+   */
+  double V1LoopFromEigenvalues(double Temp,
+                               bool InVEVSubspace,
+                               EvaluationWorkspace &Workspace) const;
   /**
    * @brief CalcCouplingsdone Used to check if CalculatePhysicalCouplings has
    * already been called
@@ -657,7 +754,10 @@ public:
 
   /**
    * Calculates the effective potential and its derivatives.
-   * @param v vev configuration at which the potential should be evaluated
+   * @param v vev configuration at which the potential should be evaluated. For
+   * diff = 0 it can be given directly in the nVEV dimensional VEV subspace,
+   * which avoids the expansion with MinimizeOrderVEV and the contraction of
+   * the full curvature tensors.
    * @param Temp temperature at which the potential should be evaluated
    * @param diff Switch for the derivative of the potential. Default is 0 for
    * the value of the potential
@@ -668,10 +768,85 @@ public:
                       double Temp = 0,
                       int diff    = 0,
                       int Order   = 1) const;
+  /**
+   * Calculates the effective potential with the buffers of Workspace. Once the
+   * workspace is sized for the model, no memory is allocated. VEff() with
+   * diff = 0 forwards to this function with GetThreadWorkspace().
+   * @param v vev configuration at which the potential should be evaluated,
+   * either with NHiggs or with nVEV entries
+   * @param Temp temperature at which the potential should be evaluated
+   * @param Workspace buffers used for the evaluation
+   * @param Order 0 returns the tree level potential and 1 the NLO potential.
+   * Default value is the NLO potential
+   */
+  double VEff(const std::vector<double> &v,
+              double Temp,
+              EvaluationWorkspace &Workspace,
+              int Order = 1) const;
+  /**
+   * Calculates the effective potential at a fixed VEV configuration for
+   * several temperatures. The mass matrices and their eigenvalues without
+   * thermal corrections are only calculated once, for every temperature only
+   * the Debye corrected boson mass matrices are diagonalised. Models which
+   * override VEff() have to override this function as well.
+   * @param v vev configuration at which the potential should be evaluated,
+   * either with NHiggs or with nVEV entries
+   * @param Temps temperatures at which the potential should be evaluated
+   * @param Order 0 returns the tree level potential and 1 the NLO potential.
+   * Default value is the NLO potential
+   * @return the potential at v for each entry of Temps
+   */
+  virtual std::vector<double> VEffMultiT(const std::vector<double> &v,
+                                         const std::vector<double> &Temps,
+                                         int Order = 1) const;
+  /**
+   * Calculates the effective potential at a fixed VEV configuration for
+   * several temperatures with the buffers of Workspace, see VEffMultiT()
+   * above.
+   * @param v vev configuration at which the potential should be evaluated,
+   * either with NHiggs or with nVEV entries
+   * @param Temps temperatures at which the potential should be evaluated
+   * @param res the potential at v for each entry of Temps
+   * @param Workspace buffers used for the evaluation
+   * @param Order 0 returns the tree level potential and 1 the NLO potential.
+   * Default value is the NLO potential
+   */
+  void VEffMultiT(const std::vector<double> &v,
+                  const std::vector<double> &Temps,
+                  std::vector<double> &res,
+                  EvaluationWorkspace &Workspace,
+                  int Order = 1) const;
+  /**
+   * Calculates the effective potential for a block of VEV configurations at
+   * the temperature Temp. Each thread evaluates a contiguous range of
+   * configurations with its own EvaluationWorkspace, see GetThreadWorkspace().
+   * Models which override VEff() have to override this function as well.
+   * @param Points one VEV configuration per row, either with NHiggs or with
+   * nVEV columns. As Eigen stores matrices column by column, each field
+   * direction is contiguous in memory for all configurations.
+   * @param Temp temperature at which the potential should be evaluated
+   * @param res the potential for each row of Points
+   * @param UseMultithreading distribute the configurations over the workers
+   * of ThreadPool::Global(), with at least 16 configurations per worker
+   * @param Order 0 returns the tree level potential and 1 the NLO potential.
+   * Default value is the NLO potential
+   */
+  virtual void VEffBatch(const Eigen::MatrixXd &Points,
+                         double Temp,
+                         std::vector<double> &res,
+                         bool UseMultithreading = false,
+                         int Order              = 1) const;
+  /**
+   * @brief GetThreadWorkspace returns the EvaluationWorkspace of the calling
+   * thread, sized for this model. Every thread keeps one workspace per set of
+   * dimensions, models of equal dimensions share it. Alternating between
+   * models of different dimensions therefore does not reallocate.
+   */
+  EvaluationWorkspace &GetThreadWorkspace() const;
   /**
    * Calculates the tree-level potential and its derivatives.
    * @param v the configuration of all VEVs at which the potential should be
-   * calculated
+   * calculated, either with NHiggs or with nVEV entries
    * @param diff 0 returns the potential and i!= 0 returns the derivative of the
    * potential w.r.t v_i
    * @param ForceExplicitCalculation Calculate the tensors directly from the
@@ -683,7 +858,7 @@ public:
   /**
    * Calculates the counterterm potential and its derivatives
    * @param v the configuration of all VEVs at which the potential should be
-   * calculated
+   * calculated, either with NHiggs or with nVEV entries
    * @param diff 0 returns the potential and i!= 0 returns the derivative of the
    * potential w.r.t v_i
    * @param ForceExplicitCalculation Calculate the tensors directly from the
@@ -703,6 +878,137 @@ public:
    * @return the value of the one-loop part of the effective potential
    */
   double V1Loop(const std::vector<double> &v, double Temp, int diff) const;
+  /**
+   * Calculates the Coleman-Weinberg and temperature-dependent 1-loop part of
+   * the effective potential with the buffers of Workspace
+   * @param v the configuration of all VEVs at which the potential should be
+   * calculated, either with NHiggs or with nVEV entries
+   * @param Temp the temperature at which the potential should be evaluated
+   * @param Workspace buffers used for the evaluation
+   * @return the value of the one-loop part of the effective potential
+   */
+  double V1Loop(const std::vector<double> &v,
+                double Temp,
+                EvaluationWorkspace &Workspace) const;
+  /**
+   * Calculates the Coleman-Weinberg and temperature-dependent 1-loop part of
+   * the effective potential for several temperatures. The mass eigenvalues
+   * without thermal corrections are only calculated once, see VEffMultiT().
+   * @param v the configuration of all VEVs at which the potential should be
+   * calculated, either with NHiggs or with nVEV entries
+   * @param Temps the temperatures at which the potential should be evaluated
+   * @param res the one-loop part of the effective potential for each entry of
+   * Temps
+   * @param Workspace buffers used for the evaluation
+   */
+  void V1LoopMultiT(const std::vector<double> &v,
+                    const std::vector<double> &Temps,
+                    std::vector<double> &res,
+                    EvaluationWorkspace &Workspace) const;
+
+  /**
+   * Calculates the gradient of the effective potential w.r.t. all Higgs
+   * fields. In contrast to calling VEff() with diff = 1, ..., NHiggs every mass
+   * matrix is only diagonalised once and the derivatives of the mass
+   * eigenvalues are obtained with the Hellmann-Feynman theorem.
+   * @param v vev configuration at which the gradient should be evaluated
+   * @param Temp temperature at which the gradient should be evaluated
+   * @param Order 0 returns the gradient of the tree level potential and 1 the
+   * one of the NLO potential. Default value is the NLO potential
+   * @return vector with the derivatives of the potential w.r.t. v_1, ...,
+   * v_NHiggs
+   */
+  std::vector<double> VEffGradient(const std::vector<double> &v,
+                                   double Temp = 0,
+                                   int Order   = 1) const;
+  /**
+   * Calculates the gradient of the effective potential w.r.t. all Higgs fields
+   * with the buffers of Workspace, see VEffGradient() above.
+   * @param v vev configuration at which the gradient should be evaluated,
+   * either with NHiggs or with nVEV entries
+   * @param Temp temperature at which the gradient should be evaluated
+   * @param Gradient resized to NHiggs and filled with the derivatives of the
+   * potential w.r.t. v_1, ..., v_NHiggs
+   * @param Workspace buffers used for the evaluation
+   * @param Order 0 returns the gradient of the tree level potential and 1 the
+   * one of the NLO potential. Default value is the NLO potential
+   */
+  void VEffGradient(const std::vector<double> &v,
+                    double Temp,
+                    std::vector<double> &Gradient,
+                    EvaluationWorkspace &Workspace,
+                    int Order = 1) const;
+
+  /**
+   * Calculates the gradient of the Coleman-Weinberg and temperature-dependent
+   * 1-loop part of the effective potential w.r.t. all Higgs fields with one
+   * diagonalisation per mass matrix.
+   * @param v the configuration of all VEVs at which the gradient should be
+   * calculated
+   * @param Temp the temperature at which the gradient should be evaluated
+   * @return vector with the derivatives of the one-loop part w.r.t. v_1, ...,
+   * v_NHiggs
+   */
+  std::vector<double> V1LoopGradient(const std::vector<double> &v,
+                                     double Temp) const;
+  /**
+   * Calculates the gradient of the 1-loop part of the effective potential with
+   * the buffers of Workspace, see V1LoopGradient() above.
+   * @param v the configuration of all VEVs with NHiggs entries
+   * @param Temp the temperature at which the gradient should be evaluated
+   * @param Workspace buffers used for the evaluation
+   * @param Gradient NHiggs dimensional vector in which the derivatives are
+   * stored
+   */
+  void V1LoopGradient(const std::vector<double> &v,
+                      double Temp,
+                      EvaluationWorkspace &Workspace,
+                      std::vector<double> &Gradient) const;
+
+  /**
+   * Calculates the Hessian of the effective potential w.r.t. all Higgs fields.
+   * The one-loop part uses second order perturbation theory of the mass
+   * eigenvalues, see V1LoopHessian().
+   * @param v vev configuration at which the Hessian should be evaluated
+   * @param Temp temperature at which the Hessian should be evaluated
+   * @param Order 0 returns the Hessian of the tree level potential and 1 the
+   * one of the NLO potential. Default value is the NLO potential
+   * @return NHiggs x NHiggs matrix with the second derivatives of the potential
+   */
+  std::vector<std::vector<double>> VEffHessian(const std::vector<double> &v,
+                                               double Temp = 0,
+                                               int Order   = 1) const;
+
+  /**
+   * Calculates the Hessian of the Coleman-Weinberg and temperature-dependent
+   * 1-loop part of the effective potential. For each sector
+   * d^2/dv_k dv_l sum_i f(m_i^2) = sum_i f'(m_i^2) (U^dagger M_kl U)_ii +
+   * sum_ij F_ij (U^dagger M_k U)_ij (U^dagger M_l U)_ji, where
+   * F_ij = (f'(m_i^2) - f'(m_j^2))/(m_i^2 - m_j^2). For (nearly) degenerate
+   * eigenvalues F_ij is replaced by its limit f''(m_i^2), so repeated
+   * eigenvalues do not need special treatment.
+   * @param v the configuration of all VEVs at which the Hessian should be
+   * calculated
+   * @param Temp the temperature at which the Hessian should be evaluated
+   * @return NHiggs x NHiggs matrix with the second derivatives of the one-loop
+   * part
+   */
+  Eigen::MatrixXd V1LoopHessian(const std::vector<double> &v,
+                                double Temp) const;
+  /**
+   * Calculates the Hessian of the 1-loop part of the effective potential with
+   * the buffers of Workspace, see V1LoopHessian() above. The field derivatives
+   * of the mass matrices are taken from the sparse curvature storage.
+   * @param v the configuration of all VEVs with NHiggs entries
+   * @param Temp the temperature at which the Hessian should be evaluated
+   * @param Workspace buffers used for the evaluation
+   * @param Hessian NHiggs x NHiggs matrix in which the second derivatives are
+   * stored
+   */
+  void V1LoopHessian(const std::vector<double> &v,
+                     double Temp,
+                     EvaluationWorkspace &Workspace,
+                     Eigen::MatrixXd &Hessian) const;
 
   /**
    * This function calculates the EW breaking VEV from all contributing field
@@ -773,6 +1079,30 @@ public:
    * This has to be specified in the model file.
    */
   virtual void SetCurvatureArrays() = 0;
+  /**
+   * Collects the non-vanishing entries of the curvature tensors set in
+   * SetCurvatureArrays in SparseCurvature and pre-contracts the mass matrices
+   * with the VEV directions in VevOrder. Afterwards the mass matrices are
+   * built from the sparse storage.
+   */
+  void SetSparseCurvatureArrays();
+  /**
+   * Determines the block structure of the mass matrices in the VEV subspace
+   * from the sparsity pattern of SparseCurvature and the Debye corrections.
+   * The eigenvalues of the mass matrices in V1Loop() are then calculated block
+   * by block. Called by SetSparseCurvatureArrays(), CalculateDebye() and
+   * CalculateDebyeGauge().
+   */
+  void SetMassMatrixBlocks();
+  /**
+   * Attaches a specialised implementation of the one-loop potential, e.g. a
+   * FixedDimensionKernel with the dimensions of the model. It is used by
+   * V1Loop() for all nVEV dimensional VEV configurations and kept up to date
+   * by SetMassMatrixBlocks(). Passing a nullptr restores the generic
+   * evaluation. Throws a std::runtime_error if the dimensions of the kernel
+   * differ from NHiggs, NGauge, NQuarks and NLepton of the model.
+   */
+  void SetV1LoopKernel(std::unique_ptr<V1LoopKernel> KernelIn);
   /**
     Calculates all triple and quartic couplings in the physical basis
  */
@@ -863,6 +1193,73 @@ public:
    */
   bool UseVCounterSimplified = false;
 
+  /**
+   * @brief UseMassMatricesSimplified Decides whether the field dependent mass
+   * matrices and their first derivatives are taken from the
+   * *MassMatrixSimplified functions instead of contracting the curvature
+   * tensors. Set in the constructor of the implemented models. The functions
+   * can be generated with tools/ModelGeneration/sympy.
+   */
+  bool UseMassMatricesSimplified = false;
+  /**
+   * You can give the explicit form of the Higgs mass matrix without thermal
+   * corrections here, used if UseMassMatricesSimplified is set
+   * @param v the configuration of all NHiggs fields
+   * @param res the NHiggs x NHiggs mass matrix
+   */
+  virtual void HiggsMassMatrixSimplified(const std::vector<double> &v,
+                                         Eigen::MatrixXd &res) const;
+  /**
+   * You can give the explicit form of the derivative of the Higgs mass matrix
+   * w.r.t. v_k here, used if UseMassMatricesSimplified is set
+   */
+  virtual void
+  HiggsMassMatrixDerivativeSimplified(const std::vector<double> &v,
+                                      std::size_t k,
+                                      Eigen::MatrixXd &res) const;
+  /**
+   * You can give the explicit form of the gauge boson mass matrix without
+   * thermal corrections here, used if UseMassMatricesSimplified is set
+   */
+  virtual void GaugeMassMatrixSimplified(const std::vector<double> &v,
+                                         Eigen::MatrixXd &res) const;
+  /**
+   * You can give the explicit form of the derivative of the gauge boson mass
+   * matrix w.r.t. v_k here, used if UseMassMatricesSimplified is set
+   */
+  virtual void
+  GaugeMassMatrixDerivativeSimplified(const std::vector<double> &v,
+                                      std::size_t k,
+                                      Eigen::MatrixXd &res) const;
+  /**
+   * You can give the explicit form of the quark mass matrix M^{IJ} here, used
+   * if UseMassMatricesSimplified is set
+   */
+  virtual void QuarkMassMatrixSimplified(const std::vector<double> &v,
+                                         Eigen::MatrixXcd &res) const;
+  /**
+   * You can give the explicit form of the derivative of the quark mass matrix
+   * M^{IJ} w.r.t. v_k here, used if UseMassMatricesSimplified is set
+   */
+  virtual void
+  QuarkMassMatrixDerivativeSimplified(const std::vector<double> &v,
+                                      std::size_t k,
+                                      Eigen::MatrixXcd &res) const;
+  /**
+   * You can give the explicit form of the lepton mass matrix M^{IJ} here,
+   * used if UseMassMatricesSimplified is set
+   */
+  virtual void LeptonMassMatrixSimplified(const std::vector<double> &v,
+                                          Eigen::MatrixXcd &res) const;
+  /**
+   * You can give the explicit form of the derivative of the lepton mass
+   * matrix M^{IJ} w.r.t. v_k here, used if UseMassMatricesSimplified is set
+   */
+  virtual void
+  LeptonMassMatrixDerivativeSimplified(const std::vector<double> &v,
+                                       std::size_t k,
+                                       Eigen::MatrixXcd &res) const;
+
   /**
    * Calculates the Higgs mass matrix and saves all eigenvalues
    * @param v the configuration of all VEVs at which the eigenvalues should be
@@ -881,7 +1278,8 @@ public:
   /**
    * @brief HiggsMassMatrix calculates the Higgs mass matrix
    * @param v the configuration of all VEVs at which the Mass Matrix should be
-   * evaluated
+   * evaluated. For diff = 0 it can also be given in the nVEV dimensional VEV
+   * subspace, then the pre-contracted SparseCurvature.HiggsVEV is used.
    * @param Temp The temperature at which the Debye corrected masses should be
    * calculated
    * @param diff 0 returns the masses and i!=0 returns the derivative the Mass
@@ -891,6 +1289,18 @@ public:
   Eigen::MatrixXd HiggsMassMatrix(const std::vector<double> &v,
                                   double Temp = 0,
                                   int diff    = 0) const;
+  /**
+   * @brief FillHiggsMassMatrix stores the Higgs mass matrix in res. Does not
+   * allocate memory if res is already of size NHiggs x NHiggs.
+   * @param v the configuration of all VEVs, either with NHiggs or with nVEV
+   * entries if SetSparseCurvatureArrays() was called
+   * @param Temp The temperature at which the Debye corrected masses should be
+   * calculated
+   * @param res matrix in which the mass matrix is stored
+   */
+  void FillHiggsMassMatrix(const std::vector<double> &v,
+                           double Temp,
+                           Eigen::MatrixXd &res) const;
 
   /**
    * Calculates the gauge mass matrix and saves all eigenvalues
@@ -906,6 +1316,24 @@ public:
   std::vector<double> GaugeMassesSquared(const std::vector<double> &v,
                                          const double &Temp = 0,
                                          const int &diff    = 0) const;
+
+  /**
+   * @brief GaugeMassMatrix calculates the gauge boson mass matrix
+   * @param v the configuration of all VEVs at which the Mass Matrix should be
+   * evaluated, either with NHiggs or with nVEV entries
+   * @param Temp The temperature at which the Debye corrected masses should be
+   * calculated
+   * @return the gauge boson mass matrix
+   */
+  Eigen::MatrixXd GaugeMassMatrix(const std::vector<double> &v,
+                                  double Temp = 0) const;
+  /**
+   * @brief FillGaugeMassMatrix stores the gauge boson mass matrix in res, see
+   * FillHiggsMassMatrix()
+   */
+  void FillGaugeMassMatrix(const std::vector<double> &v,
+                           double Temp,
+                           Eigen::MatrixXd &res) const;
   /**
    * Calculates the quark mass matrix and saves all eigenvalues, this assumes
    * the same masses for different colours.
@@ -944,11 +1372,17 @@ public:
    * @brief QuarkMassMatrix calculates the Mass Matrix for the Quarks of the
    * form $ M^{IJ} = Y^{IJ} + Y^{IJk} v_k $
    * @param v the configuration of all VEVs at which the matrix should be
-   * calculated
+   * calculated, either with NHiggs or with nVEV entries
    * @return the Mass Matrix for the Quarks of the form $ M^{IJ} = Y^{IJ} +
    * Y^{IJk} v_k $
    */
   Eigen::MatrixXcd QuarkMassMatrix(const std::vector<double> &v) const;
+  /**
+   * @brief FillQuarkMassMatrix stores the quark mass matrix M^{IJ} in res, see
+   * FillHiggsMassMatrix()
+   */
+  void FillQuarkMassMatrix(const std::vector<double> &v,
+                           Eigen::MatrixXcd &res) const;
   /**
    * Calculates the quark mass matrix and saves all eigenvalues, this assumes
    * the same masses for different colours.
@@ -963,11 +1397,17 @@ public:
    * @brief LeptonMassMatrix calculates the Mass Matrix for the Leptons of the
    * form $ M^{IJ} = Y^{IJ} + Y^{IJk} v_k $
    * @param v the configuration of all VEVs at which the matrix should be
-   * calculated
+   * calculated, either with NHiggs or with nVEV entries
    * @return the Mass Matrix for the Leptons of the form $ M^{IJ} = Y^{IJ} +
    * Y^{IJk} v_k $
    */
   Eigen::MatrixXcd LeptonMassMatrix(const std::vector<double> &v) const;
+  /**
+   * @brief FillLeptonMassMatrix stores the lepton mass matrix M^{IJ} in res,
+   * see FillHiggsMassMatrix()
+   */
+  void FillLeptonMassMatrix(const std::vector<double> &v,
+                            Eigen::MatrixXcd &res) const;
 
   /**
    * Calculates the triple Higgs couplings at NLO in the mass basis.
@@ -1029,6 +1469,11 @@ public:
    *
    */
   double boson(double MassSquared, double Temp, double cb, int diff = 0) const;
+  /**
+   * @brief Jboson J_- for diff = 0 and dJ_-/dx for diff = 1 at x = Ratio,
+   * evaluated with the selected ThermalDerivativeMethod
+   */
+  double Jboson(double Ratio, int diff) const;
   /**
    * Deprecated version of boson() as present in the v1.X release. Still here
    * for legacy reasons
@@ -1048,6 +1493,30 @@ public:
    * w.r.t. m^2 and diff=-1 w.r.t Temp
    */
   double fermion(double MassSquared, double Temp, int diff = 0) const;
+  /**
+   * @brief OneLoopSum sum of boson() and fermion() with diff = 0 over all
+   * particles in Terms, weighted with their degrees of freedom. The thermal
+   * functions are evaluated in one batch per particle type.
+   * @param Terms mass eigenvalues collected with OneLoopTerms::AddBoson and
+   * OneLoopTerms::AddFermion
+   * @param Temp temperature
+   */
+  double OneLoopSum(OneLoopTerms &Terms, double Temp) const;
+  /**
+   * @brief Jfermion J_+ for diff = 0 and dJ_+/dx for diff = 1 at x = Ratio,
+   * evaluated with the selected ThermalDerivativeMethod
+   */
+  double Jfermion(double Ratio, int diff) const;
+  /**
+   * @brief JbosonPotential J_- for diff = 0 and dJ_-/dx for diff = 1 at
+   * x = Ratio, evaluated with the selected ThermalFunctionMethod
+   */
+  double JbosonPotential(double Ratio, int diff = 0) const;
+  /**
+   * @brief JfermionPotential J_+ for diff = 0 and dJ_+/dx for diff = 1 at
+   * x = Ratio, evaluated with the selected ThermalFunctionMethod
+   */
+  double JfermionPotential(double Ratio, int diff = 0) const;
   /**
    * Deprecated version of fermion() as present in the v1.X release. Still here
    * for legacy reasons
@@ -1056,6 +1525,28 @@ public:
       "Use this only if you want to calculate the effective potential with the "
       "exact same routine used in BSMPT v1.x. Use fermion otherwise.")]] double
   fermion_legacy(double Mass, double Temp, int diff = 0) const;
+  /**
+   * @brief BosonMassDerivatives first and second derivative of boson() w.r.t.
+   * m^2, using the interpolated thermal functions. The second derivative of
+   * the Coleman-Weinberg and thermal part is set to zero for |m^2| below
+   * C_threshold, where it is not finite.
+   * @param MassSquared m^2 of the particle
+   * @param Temp temperature
+   * @param cb parameter of the renormalisation scheme of the Coleman-Weinberg
+   * potential
+   * @return pair of d/dm^2 and d^2/(dm^2)^2
+   */
+  std::pair<double, double>
+  BosonMassDerivatives(double MassSquared, double Temp, double cb) const;
+  /**
+   * @brief FermionMassDerivatives first and second derivative of fermion()
+   * w.r.t. m^2, see BosonMassDerivatives()
+   * @param MassSquared m^2 of the particle
+   * @param Temp temperature
+   * @return pair of d/dm^2 and d^2/(dm^2)^2
+   */
+  std::pair<double, double> FermionMassDerivatives(double MassSquared,
+                                                   double Temp) const;
   /**
    * Calculates the large m^2/T^2 approximation to order n for the
    * temperature-dependent std::size_tegrals.
@@ -1172,6 +1663,16 @@ public:
    */
   void SetUseTreeLevel(bool val);
 
+  /**
+   * Set the method used for the derivatives of the thermal integrals
+   */
+  void SetThermalDerivativeMethod(ThermalDerivativeMethod Method);
+
+  /**
+   * Set the method used for the thermal integrals in the effective potential
+   */
+  void SetThermalFunctionMethod(ThermalFunctionMethod Method);
+
   /**
    * Gets the parameter line as an Input and calls
    * resetbools, ReadAndSet, calc_CT, set_CT_Pot_Par,CalculateDebye and
@@ -56,6 +56,28 @@ public:
   bool CalculateDebyeGaugeSimplified() override;
   double VTreeSimplified(const std::vector<double> &v) const override;
   double VCounterSimplified(const std::vector<double> &v) const override;
+  void HiggsMassMatrixSimplified(const std::vector<double> &v,
+                                 Eigen::MatrixXd &res) const override;
+  void HiggsMassMatrixDerivativeSimplified(const std::vector<double> &v,
+                                           std::size_t k,
+                                           Eigen::MatrixXd &res) const override;
+  void GaugeMassMatrixSimplified(const std::vector<double> &v,
+                                 Eigen::MatrixXd &res) const override;
+  void GaugeMassMatrixDerivativeSimplified(const std::vector<double> &v,
+                                           std::size_t k,
+                                           Eigen::MatrixXd &res) const override;
+  void QuarkMassMatrixSimplified(const std::vector<double> &v,
+                                 Eigen::MatrixXcd &res) const override;
+  void
+  QuarkMassMatrixDerivativeSimplified(const std::vector<double> &v,
+                                      std::size_t k,
+                                      Eigen::MatrixXcd &res) const override;
+  void LeptonMassMatrixSimplified(const std::vector<double> &v,
+                                  Eigen::MatrixXcd &res) const override;
+  void
+  LeptonMassMatrixDerivativeSimplified(const std::vector<double> &v,
+                                       std::size_t k,
+                                       Eigen::MatrixXcd &res) const override;
   void Debugging(const std::vector<double> &input,
                  std::vector<double> &output) const override;
 };
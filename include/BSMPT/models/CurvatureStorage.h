@@ -0,0 +1,261 @@
+// SPDX-FileCopyrightText: 2021 Philipp Basler, Margarete Mühlleitner and Jonas
+// Müller
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file
+ * Flat storage of the non-vanishing entries of the curvature tensors
+ */
+#ifndef CURVATURESTORAGE_H_
+#define CURVATURESTORAGE_H_
+
+#include <array>
+#include <complex>
+#include <cstddef>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include <BSMPT/models/BlockEigenSolver.h>
+
+namespace BSMPT
+{
+
+/**
+ * @brief The SparseTensor struct stores the non-vanishing entries of a tensor
+ * of rank Rank as a contiguous list of index tuples and the corresponding
+ * values
+ */
+template <typename Scalar, std::size_t Rank> struct SparseTensor
+{
+  /**
+   * @brief Indices Index tuple of the n-th non-vanishing entry
+   */
+  std::vector<std::array<std::size_t, Rank>> Indices;
+  /**
+   * @brief Values Value of the n-th non-vanishing entry
+   */
+  std::vector<Scalar> Values;
+
+  /**
+   * @brief size number of stored entries
+   */
+  std::size_t size() const { return Values.size(); }
+
+  void clear()
+  {
+    Indices.clear();
+    Values.clear();
+  }
+
+  void push_back(const std::array<std::size_t, Rank> &Index,
+                 const Scalar &Value)
+  {
+    Indices.push_back(Index);
+    Values.push_back(Value);
+  }
+};
+
+/**
+ * @brief MakeSparse collects all non-vanishing entries of a rank 3 tensor
+ */
+template <typename Scalar>
+SparseTensor<Scalar, 3>
+MakeSparse(const std::vector<std::vector<std::vector<Scalar>>> &Tensor)
+{
+  SparseTensor<Scalar, 3> res;
+  for (std::size_t i = 0; i < Tensor.size(); i++)
+  {
+    for (std::size_t j = 0; j < Tensor[i].size(); j++)
+    {
+      for (std::size_t k = 0; k < Tensor[i][j].size(); k++)
+      {
+        if (Tensor[i][j][k] != Scalar(0))
+          res.push_back({i, j, k}, Tensor[i][j][k]);
+      }
+    }
+  }
+  return res;
+}
+
+/**
+ * @brief MakeSparse collects all non-vanishing entries of a rank 4 tensor
+ */
+template <typename Scalar>
+SparseTensor<Scalar, 4> MakeSparse(
+    const std::vector<std::vector<std::vector<std::vector<Scalar>>>> &Tensor)
+{
+  SparseTensor<Scalar, 4> res;
+  for (std::size_t i = 0; i < Tensor.size(); i++)
+  {
+    for (std::size_t j = 0; j < Tensor[i].size(); j++)
+    {
+      for (std::size_t k = 0; k < Tensor[i][j].size(); k++)
+      {
+        for (std::size_t l = 0; l < Tensor[i][j][k].size(); l++)
+        {
+          if (Tensor[i][j][k][l] != Scalar(0))
+            res.push_back({i, j, k, l}, Tensor[i][j][k][l]);
+        }
+      }
+    }
+  }
+  return res;
+}
+
+/**
+ * @brief The VEVSubspaceExpansion struct stores a field dependent matrix
+ * restricted to the directions with a VEV,
+ * M(v) = A + sum_a B_a v_a + sum_{a <= b} C_ab v_a v_b ,
+ * where a and b run over the nVEV entries of VevOrder.
+ */
+template <typename MatrixType> struct VEVSubspaceExpansion
+{
+  /**
+   * @brief Dimension number of VEV directions
+   */
+  std::size_t Dimension = 0;
+  /**
+   * @brief Constant the field independent part A
+   */
+  MatrixType Constant;
+  /**
+   * @brief Linear the coefficients B_a, empty if there is no linear part
+   */
+  std::vector<MatrixType> Linear;
+  /**
+   * @brief Quadratic the coefficients C_ab with a <= b, packed row by row.
+   * Empty if there is no quadratic part
+   */
+  std::vector<MatrixType> Quadratic;
+
+  /**
+   * @brief Evaluate calculates M(v)
+   * @param vev nVEV dimensional VEV configuration
+   */
+  MatrixType Evaluate(const std::vector<double> &vev) const
+  {
+    MatrixType res;
+    EvaluateInto(vev, res);
+    return res;
+  }
+
+  /**
+   * @brief EvaluateInto calculates M(v) and stores it in res. Does not
+   * allocate memory if res already has the correct size.
+   * @param vev nVEV dimensional VEV configuration
+   * @param res matrix to store M(v) in
+   */
+  void EvaluateInto(const std::vector<double> &vev, MatrixType &res) const
+  {
+    res           = Constant;
+    std::size_t n = 0;
+    for (std::size_t a = 0; a < Dimension; a++)
+    {
+      if (vev[a] == 0)
+      {
+        n += Dimension - a;
+        continue;
+      }
+      if (not Linear.empty()) res += vev[a] * Linear[a];
+      if (Quadratic.empty()) continue;
+      for (std::size_t b = a; b < Dimension; b++, n++)
+      {
+        if (vev[b] != 0) res += (vev[a] * vev[b]) * Quadratic[n];
+      }
+    }
+  }
+};
+
+/**
+ * @brief The CurvatureStorage struct holds a contiguous copy of the curvature
+ * tensors of Class_Potential_Origin. The rank 2 tensors are stored as dense
+ * matrices, the higher rank tensors only through their non-vanishing entries.
+ * Additionally the mass matrices are stored pre-contracted in the VEV subspace.
+ * It is built once after SetCurvatureArrays() and used in the mass matrix
+ * builders and CalculatePhysicalCouplings.
+ */
+struct CurvatureStorage
+{
+  /**
+   * @brief HiggsL2 Curvature_Higgs_L2
+   */
+  Eigen::MatrixXd HiggsL2;
+  /**
+   * @brief HiggsL3 Non-vanishing entries of Curvature_Higgs_L3
+   */
+  SparseTensor<double, 3> HiggsL3;
+  /**
+   * @brief HiggsL4 Non-vanishing entries of Curvature_Higgs_L4
+   */
+  SparseTensor<double, 4> HiggsL4;
+  /**
+   * @brief GaugeG2H2 Non-vanishing entries of Curvature_Gauge_G2H2
+   */
+  SparseTensor<double, 4> GaugeG2H2;
+  /**
+   * @brief QuarkF2 Curvature_Quark_F2
+   */
+  Eigen::MatrixXcd QuarkF2;
+  /**
+   * @brief QuarkF2H1 Non-vanishing entries of Curvature_Quark_F2H1
+   */
+  SparseTensor<std::complex<double>, 3> QuarkF2H1;
+  /**
+   * @brief LeptonF2 Curvature_Lepton_F2
+   */
+  Eigen::MatrixXcd LeptonF2;
+  /**
+   * @brief LeptonF2H1 Non-vanishing entries of Curvature_Lepton_F2H1
+   */
+  SparseTensor<std::complex<double>, 3> LeptonF2H1;
+
+  /**
+   * @brief HiggsVEV Higgs mass matrix without thermal corrections in the VEV
+   * subspace
+   */
+  VEVSubspaceExpansion<Eigen::MatrixXd> HiggsVEV;
+  /**
+   * @brief GaugeVEV gauge boson mass matrix without thermal corrections in the
+   * VEV subspace
+   */
+  VEVSubspaceExpansion<Eigen::MatrixXd> GaugeVEV;
+  /**
+   * @brief QuarkVEV quark mass matrix M^{IJ} in the VEV subspace
+   */
+  VEVSubspaceExpansion<Eigen::MatrixXcd> QuarkVEV;
+  /**
+   * @brief LeptonVEV lepton mass matrix M^{IJ} in the VEV subspace
+   */
+  VEVSubspaceExpansion<Eigen::MatrixXcd> LeptonVEV;
+
+  /**
+   * @brief NonVEVDirections the fields which are not in VevOrder
+   */
+  std::vector<std::size_t> NonVEVDirections;
+  /**
+   * @brief HiggsBlocks block structure of the Higgs mass matrix including the
+   * Debye corrections, valid for all VEV configurations in the VEV subspace
+   */
+  MatrixBlocks HiggsBlocks;
+  /**
+   * @brief GaugeBlocks block structure of the gauge boson mass matrix, see
+   * HiggsBlocks
+   */
+  MatrixBlocks GaugeBlocks;
+  /**
+   * @brief QuarkBlocks block structure of the squared quark mass matrix M^* M
+   * in the VEV subspace
+   */
+  MatrixBlocks QuarkBlocks;
+  /**
+   * @brief LeptonBlocks block structure of the squared lepton mass matrix
+   * M^* M in the VEV subspace
+   */
+  MatrixBlocks LeptonBlocks;
+};
+
+} // namespace BSMPT
+
+#endif /* CURVATURESTORAGE_H_ */
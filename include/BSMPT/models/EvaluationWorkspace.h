@@ -0,0 +1,325 @@
+// SPDX-FileCopyrightText: 2021 Philipp Basler, Margarete Mühlleitner and Jonas
+// Müller
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file
+ * Preallocated buffers for the evaluation of the effective potential
+ */
+#ifndef EVALUATIONWORKSPACE_H_
+#define EVALUATIONWORKSPACE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include <BSMPT/models/BlockEigenSolver.h>
+
+namespace BSMPT
+{
+
+/**
+ * @brief The OneLoopTerms struct collects the mass eigenvalues entering the
+ * one-loop potential together with their degrees of freedom, so that the
+ * thermal functions of all particles are evaluated in one call of
+ * ThermalFunctions::JbosonBatch and ThermalFunctions::JfermionBatch, see
+ * Class_Potential_Origin::OneLoopSum
+ */
+struct OneLoopTerms
+{
+  /**
+   * @brief BosonMassSquared, BosonCb, BosonDegrees m^2, the constant cb of the
+   * Coleman-Weinberg potential and the weight of every boson
+   */
+  std::vector<double> BosonMassSquared, BosonCb, BosonDegrees;
+  /**
+   * @brief FermionMassSquared, FermionDegrees m^2 and the (negative) weight of
+   * every fermion
+   */
+  std::vector<double> FermionMassSquared, FermionDegrees;
+  /**
+   * @brief Ratios, Values buffers for m^2/T^2 and the thermal functions
+   */
+  std::vector<double> Ratios, Values;
+
+  void Clear()
+  {
+    BosonMassSquared.clear();
+    BosonCb.clear();
+    BosonDegrees.clear();
+    FermionMassSquared.clear();
+    FermionDegrees.clear();
+  }
+
+  void AddBoson(double MassSquared, double cb, double Degrees)
+  {
+    BosonMassSquared.push_back(MassSquared);
+    BosonCb.push_back(cb);
+    BosonDegrees.push_back(Degrees);
+  }
+
+  void AddFermion(double MassSquared, double Degrees)
+  {
+    FermionMassSquared.push_back(MassSquared);
+    FermionDegrees.push_back(Degrees);
+  }
+
+  void Reserve(std::size_t NBosons, std::size_t NFermions)
+  {
+    BosonMassSquared.reserve(NBosons);
+    BosonCb.reserve(NBosons);
+    BosonDegrees.reserve(NBosons);
+    FermionMassSquared.reserve(NFermions);
+    FermionDegrees.reserve(NFermions);
+    Ratios.reserve(std::max(NBosons, NFermions));
+    Values.reserve(std::max(NBosons, NFermions));
+  }
+};
+
+/**
+ * @brief The HessianBuffers struct holds the buffers for the contribution of
+ * one sector with N x N mass matrices to the one-loop Hessian w.r.t. the
+ * NHiggs fields, see Class_Potential_Origin::V1LoopHessian
+ */
+template <typename MatrixType> struct HessianBuffers
+{
+  /**
+   * @brief Derivatives N^2 x NHiggs matrix, column k is the flattened
+   * derivative of the mass matrix w.r.t. v_k
+   */
+  MatrixType Derivatives;
+  /**
+   * @brief Rotated the columns of Derivatives rotated into the eigenbasis of
+   * the mass matrix
+   */
+  MatrixType Rotated;
+  /**
+   * @brief Weighted the rows of Rotated multiplied with Mixing
+   */
+  MatrixType Weighted;
+  /**
+   * @brief Product N x N buffer for the rotation
+   */
+  MatrixType Product;
+  /**
+   * @brief Contracted NHiggs x NHiggs buffer for the contractions
+   */
+  MatrixType Contracted;
+  /**
+   * @brief Mixing the flattened divided differences F_ij of the first
+   * derivatives, stored with the scalar type of the mass matrix
+   */
+  Eigen::Matrix<typename MatrixType::Scalar, Eigen::Dynamic, 1> Mixing;
+  /**
+   * @brief Eigenvalues, First, Second m_i^2, f'(m_i^2) and f''(m_i^2)
+   */
+  Eigen::VectorXd Eigenvalues, First, Second;
+
+  void Resize(std::size_t N, std::size_t NHiggs)
+  {
+    const auto NSquared = static_cast<Eigen::Index>(N * N);
+    Derivatives.resize(NSquared, NHiggs);
+    Rotated.resize(NSquared, NHiggs);
+    Weighted.resize(NSquared, NHiggs);
+    Product.resize(N, N);
+    Contracted.resize(NHiggs, NHiggs);
+    Mixing.resize(NSquared);
+    Eigenvalues.resize(N);
+    First.resize(N);
+    Second.resize(N);
+  }
+};
+
+/**
+ * @brief The EvaluationWorkspace struct holds all matrices, eigensolvers and
+ * buffers needed to evaluate the effective potential, its gradient and its
+ * Hessian. It is sized on the first evaluation for a model, afterwards repeated
+ * evaluations do not allocate memory. A workspace must not be shared between
+ * threads, see Class_Potential_Origin::GetThreadWorkspace.
+ */
+struct EvaluationWorkspace
+{
+  std::size_t NHiggs{0}, NGauge{0}, NQuarks{0}, NLepton{0}, nVEV{0};
+
+  /**
+   * @brief VEVInput buffer for callers to collect an nVEV dimensional VEV
+   * configuration, e.g. from a gsl_vector. It is not touched by the evaluation
+   */
+  std::vector<double> VEVInput;
+  /**
+   * @brief Gradient buffer for callers to store the gradient w.r.t. all NHiggs
+   * fields. It is not touched by the evaluation
+   */
+  std::vector<double> Gradient;
+  /**
+   * @brief VEV the NHiggs dimensional expansion of an nVEV dimensional VEV
+   * configuration
+   */
+  std::vector<double> VEV;
+  /**
+   * @brief VEVSubspace the nVEV dimensional restriction of an NHiggs
+   * dimensional VEV configuration inside the VEV subspace
+   */
+  std::vector<double> VEVSubspace;
+
+  /**
+   * @brief HiggsMass, GaugeMass mass matrices without thermal corrections
+   */
+  Eigen::MatrixXd HiggsMass, GaugeMass;
+  /**
+   * @brief HiggsMassThermal, GaugeMassThermal Debye corrected mass matrices
+   */
+  Eigen::MatrixXd HiggsMassThermal, GaugeMassThermal;
+  /**
+   * @brief QuarkMIJ, LeptonMIJ the fermion mass matrices M^{IJ}
+   */
+  Eigen::MatrixXcd QuarkMIJ, LeptonMIJ;
+  /**
+   * @brief QuarkMass, LeptonMass the squared fermion mass matrices M^* M
+   */
+  Eigen::MatrixXcd QuarkMass, LeptonMass;
+
+  Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> HiggsSolver, GaugeSolver;
+  Eigen::SelfAdjointEigenSolver<Eigen::MatrixXcd> QuarkSolver, LeptonSolver;
+  /**
+   * @brief HiggsBlockSolver, GaugeBlockSolver, QuarkBlockSolver,
+   * LeptonBlockSolver eigenvalue solvers using the block structure of the mass
+   * matrices, sized on their first use
+   */
+  BlockEigenvalueSolver<Eigen::MatrixXd> HiggsBlockSolver, GaugeBlockSolver;
+  BlockEigenvalueSolver<Eigen::MatrixXcd> QuarkBlockSolver, LeptonBlockSolver;
+  /**
+   * @brief HiggsEigenvalues, GaugeEigenvalues, QuarkEigenvalues,
+   * LeptonEigenvalues mass eigenvalues without thermal corrections, see
+   * Class_Potential_Origin::CalculateMassEigenvalues
+   */
+  Eigen::VectorXd HiggsEigenvalues, GaugeEigenvalues, QuarkEigenvalues,
+      LeptonEigenvalues;
+
+  /**
+   * @brief HiggsWeights, GaugeWeights, QuarkWeights, LeptonWeights derivatives
+   * f'(m_i^2) of the one-loop potential w.r.t. the mass eigenvalues
+   */
+  Eigen::VectorXd HiggsWeights, GaugeWeights, QuarkWeights, LeptonWeights;
+  /**
+   * @brief HiggsScaled, GaugeScaled U diag(f'(m_i^2)) of the bosonic sectors
+   */
+  Eigen::MatrixXd HiggsScaled, GaugeScaled;
+  /**
+   * @brief QuarkScaled, LeptonScaled U diag(f'(m_i^2)) of the fermionic
+   * sectors
+   */
+  Eigen::MatrixXcd QuarkScaled, LeptonScaled;
+  /**
+   * @brief PHiggs, PGauge U diag(f'(m_i^2)) U^T of the bosonic sectors
+   */
+  Eigen::MatrixXd PHiggs, PGauge;
+  /**
+   * @brief PQuark, PLepton U diag(f'(m_i^2)) U^dagger of the fermionic sectors
+   */
+  Eigen::MatrixXcd PQuark, PLepton;
+  /**
+   * @brief QuarkProjected1, QuarkProjected2, LeptonProjected1,
+   * LeptonProjected2 M P and P M^* of the fermionic sectors
+   */
+  Eigen::MatrixXcd QuarkProjected1, QuarkProjected2, LeptonProjected1,
+      LeptonProjected2;
+
+  /**
+   * @brief HiggsHessian, GaugeHessian, QuarkHessian, LeptonHessian buffers for
+   * Class_Potential_Origin::V1LoopHessian
+   */
+  HessianBuffers<Eigen::MatrixXd> HiggsHessian, GaugeHessian;
+  HessianBuffers<Eigen::MatrixXcd> QuarkHessian, LeptonHessian;
+
+  /**
+   * @brief OneLoop mass eigenvalues collected for
+   * Class_Potential_Origin::OneLoopSum
+   */
+  OneLoopTerms OneLoop;
+
+  /**
+   * @brief Matches checks if the workspace is sized for the given dimensions
+   */
+  bool Matches(std::size_t NHiggsIn,
+               std::size_t NGaugeIn,
+               std::size_t NQuarksIn,
+               std::size_t NLeptonIn,
+               std::size_t nVEVIn) const
+  {
+    return NHiggs == NHiggsIn and NGauge == NGaugeIn and
+           NQuarks == NQuarksIn and NLepton == NLeptonIn and nVEV == nVEVIn;
+  }
+
+  /**
+   * @brief Resize allocates all buffers for the given dimensions. Does
+   * nothing if the workspace already has the requested dimensions.
+   */
+  void Resize(std::size_t NHiggsIn,
+              std::size_t NGaugeIn,
+              std::size_t NQuarksIn,
+              std::size_t NLeptonIn,
+              std::size_t nVEVIn)
+  {
+    if (Matches(NHiggsIn, NGaugeIn, NQuarksIn, NLeptonIn, nVEVIn)) return;
+    NHiggs  = NHiggsIn;
+    NGauge  = NGaugeIn;
+    NQuarks = NQuarksIn;
+    NLepton = NLeptonIn;
+    nVEV    = nVEVIn;
+
+    VEVInput.assign(nVEV, 0);
+    Gradient.assign(NHiggs, 0);
+    VEV.assign(NHiggs, 0);
+    VEVSubspace.assign(nVEV, 0);
+
+    HiggsMass.resize(NHiggs, NHiggs);
+    GaugeMass.resize(NGauge, NGauge);
+    HiggsMassThermal.resize(NHiggs, NHiggs);
+    GaugeMassThermal.resize(NGauge, NGauge);
+    QuarkMIJ.resize(NQuarks, NQuarks);
+    LeptonMIJ.resize(NLepton, NLepton);
+    QuarkMass.resize(NQuarks, NQuarks);
+    LeptonMass.resize(NLepton, NLepton);
+
+    HiggsSolver  = Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd>(NHiggs);
+    GaugeSolver  = Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd>(NGauge);
+    QuarkSolver  = Eigen::SelfAdjointEigenSolver<Eigen::MatrixXcd>(NQuarks);
+    LeptonSolver = Eigen::SelfAdjointEigenSolver<Eigen::MatrixXcd>(NLepton);
+    HiggsEigenvalues.resize(NHiggs);
+    GaugeEigenvalues.resize(NGauge);
+    QuarkEigenvalues.resize(NQuarks);
+    LeptonEigenvalues.resize(NLepton);
+
+    HiggsWeights.resize(NHiggs);
+    GaugeWeights.resize(NGauge);
+    QuarkWeights.resize(NQuarks);
+    LeptonWeights.resize(NLepton);
+    HiggsScaled.resize(NHiggs, NHiggs);
+    GaugeScaled.resize(NGauge, NGauge);
+    QuarkScaled.resize(NQuarks, NQuarks);
+    LeptonScaled.resize(NLepton, NLepton);
+    PHiggs.resize(NHiggs, NHiggs);
+    PGauge.resize(NGauge, NGauge);
+    PQuark.resize(NQuarks, NQuarks);
+    PLepton.resize(NLepton, NLepton);
+    QuarkProjected1.resize(NQuarks, NQuarks);
+    QuarkProjected2.resize(NQuarks, NQuarks);
+    LeptonProjected1.resize(NLepton, NLepton);
+    LeptonProjected2.resize(NLepton, NLepton);
+
+    HiggsHessian.Resize(NHiggs, NHiggs);
+    GaugeHessian.Resize(NGauge, NHiggs);
+    QuarkHessian.Resize(NQuarks, NHiggs);
+    LeptonHessian.Resize(NLepton, NHiggs);
+
+    OneLoop.Reserve(NHiggs + NGauge, NQuarks + NLepton);
+  }
+};
+
+} // namespace BSMPT
+
+#endif /* EVALUATIONWORKSPACE_H_ */
@@ -0,0 +1,288 @@
+// SPDX-FileCopyrightText: 2021 Philipp Basler, Margarete Mühlleitner and Jonas
+// Müller
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file
+ * Evaluation of the one-loop potential with mass matrices of fixed dimension
+ */
+#ifndef FIXEDDIMENSIONKERNEL_H_
+#define FIXEDDIMENSIONKERNEL_H_
+
+#include <array>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include <BSMPT/models/BlockEigenSolver.h>
+#include <BSMPT/models/ClassPotentialOrigin.h>
+#include <BSMPT/models/CurvatureStorage.h>
+#include <BSMPT/models/EvaluationWorkspace.h>
+
+namespace BSMPT
+{
+
+/**
+ * @brief The V1LoopKernel class is the interface for specialised
+ * implementations of the one-loop potential in the VEV subspace. A kernel is
+ * attached to a model with Class_Potential_Origin::SetV1LoopKernel and is
+ * then used by Class_Potential_Origin::V1Loop for all nVEV dimensional VEV
+ * configurations.
+ */
+class V1LoopKernel
+{
+public:
+  virtual ~V1LoopKernel() = default;
+
+  /**
+   * @brief Dimensions of the Higgs, gauge boson, quark and lepton mass
+   * matrices the kernel is built for
+   */
+  virtual std::array<std::size_t, 4> Dimensions() const = 0;
+
+  /**
+   * @brief Update copies the model dependent input of the kernel. Called by
+   * the model every time the mass matrices or the Debye corrections change.
+   * @param Curvature the VEV subspace expansions and block structures of the
+   * mass matrices
+   * @param DebyeHiggs Debye corrections to the Higgs mass matrix, can be empty
+   * @param DebyeGauge Debye corrections to the gauge boson mass matrix, can be
+   * empty
+   * @param NColour number of colours of the quarks
+   */
+  virtual void Update(const CurvatureStorage &Curvature,
+                      const std::vector<std::vector<double>> &DebyeHiggs,
+                      const std::vector<std::vector<double>> &DebyeGauge,
+                      std::size_t NColour) = 0;
+
+  /**
+   * @brief V1Loop calculates the one-loop correction to the effective
+   * potential, see Class_Potential_Origin::V1Loop
+   * @param v nVEV dimensional VEV configuration
+   * @param Temp temperature
+   * @param Model the model providing the thermal functions
+   * @param Workspace buffers for the block eigenvalue solvers, sized for the
+   * model
+   */
+  virtual double V1Loop(const std::vector<double> &v,
+                        double Temp,
+                        const Class_Potential_Origin &Model,
+                        EvaluationWorkspace &Workspace) const = 0;
+};
+
+/**
+ * @brief The FixedDimensionKernel class evaluates the one-loop potential with
+ * Eigen matrices whose dimensions are known at compile time. The mass matrices
+ * are then stack allocated and the eigenvalue problems of unsplit sectors are
+ * solved by fixed size solvers. One instance per model is created in
+ * ModelID::FChoose.
+ */
+template <int NHiggs, int NGauge, int NQuarks, int NLepton>
+class FixedDimensionKernel : public V1LoopKernel
+{
+public:
+  using HiggsMatrix = Eigen::Matrix<double, NHiggs, NHiggs>;
+  using GaugeMatrix = Eigen::Matrix<double, NGauge, NGauge>;
+  using QuarkMatrix = Eigen::Matrix<std::complex<double>, NQuarks, NQuarks>;
+  using LeptonMatrix = Eigen::Matrix<std::complex<double>, NLepton, NLepton>;
+
+  std::array<std::size_t, 4> Dimensions() const override
+  {
+    return {{NHiggs, NGauge, NQuarks, NLepton}};
+  }
+
+  void Update(const CurvatureStorage &Curvature,
+              const std::vector<std::vector<double>> &DebyeHiggsIn,
+              const std::vector<std::vector<double>> &DebyeGaugeIn,
+              std::size_t NColourIn) override
+  {
+    Assign(HiggsVEV, Curvature.HiggsVEV);
+    Assign(GaugeVEV, Curvature.GaugeVEV);
+    Assign(QuarkVEV, Curvature.QuarkVEV);
+    Assign(LeptonVEV, Curvature.LeptonVEV);
+    Assign(DebyeHiggs, DebyeHiggsIn);
+    Assign(DebyeGauge, DebyeGaugeIn);
+
+    HiggsBlocks  = Curvature.HiggsBlocks;
+    GaugeBlocks  = Curvature.GaugeBlocks;
+    QuarkBlocks  = Curvature.QuarkBlocks;
+    LeptonBlocks = Curvature.LeptonBlocks;
+    NColour      = NColourIn;
+  }
+
+  double V1Loop(const std::vector<double> &v,
+                double Temp,
+                const Class_Potential_Origin &Model,
+                EvaluationWorkspace &Workspace) const override
+  {
+    double VDebye = 0;
+    auto &Terms   = Workspace.OneLoop;
+    Terms.Clear();
+
+    HiggsMatrix HiggsMass;
+    HiggsVEV.EvaluateInto(v, HiggsMass);
+    BosonContribution(HiggsMass,
+                      DebyeHiggs,
+                      HiggsBlocks,
+                      Workspace.HiggsBlockSolver,
+                      Temp,
+                      C_CWcbHiggs,
+                      1,
+                      Terms,
+                      VDebye);
+
+    GaugeMatrix GaugeMass;
+    GaugeVEV.EvaluateInto(v, GaugeMass);
+    BosonContribution(GaugeMass,
+                      DebyeGauge,
+                      GaugeBlocks,
+                      Workspace.GaugeBlockSolver,
+                      Temp,
+                      C_CWcbGB,
+                      3,
+                      Terms,
+                      VDebye);
+
+    QuarkMatrix QuarkMIJ;
+    QuarkVEV.EvaluateInto(v, QuarkMIJ);
+    FermionContribution(QuarkMIJ,
+                        QuarkBlocks,
+                        Workspace.QuarkBlockSolver,
+                        -2.0 * NColour,
+                        Terms);
+
+    LeptonMatrix LeptonMIJ;
+    LeptonVEV.EvaluateInto(v, LeptonMIJ);
+    FermionContribution(
+        LeptonMIJ, LeptonBlocks, Workspace.LeptonBlockSolver, -2, Terms);
+
+    VDebye *= -Temp / (12 * M_PI);
+
+    return Model.OneLoopSum(Terms, Temp) + VDebye;
+  }
+
+private:
+  VEVSubspaceExpansion<HiggsMatrix> HiggsVEV;
+  VEVSubspaceExpansion<GaugeMatrix> GaugeVEV;
+  VEVSubspaceExpansion<QuarkMatrix> QuarkVEV;
+  VEVSubspaceExpansion<LeptonMatrix> LeptonVEV;
+  HiggsMatrix DebyeHiggs = HiggsMatrix::Zero();
+  GaugeMatrix DebyeGauge = GaugeMatrix::Zero();
+  MatrixBlocks HiggsBlocks, GaugeBlocks, QuarkBlocks, LeptonBlocks;
+  std::size_t NColour = 3;
+
+  template <typename FixedMatrix, typename DynamicMatrix>
+  static void Assign(VEVSubspaceExpansion<FixedMatrix> &Target,
+                     const VEVSubspaceExpansion<DynamicMatrix> &Source)
+  {
+    Target.Dimension = Source.Dimension;
+    Target.Constant  = Source.Constant;
+    Target.Linear.assign(Source.Linear.begin(), Source.Linear.end());
+    Target.Quadratic.assign(Source.Quadratic.begin(), Source.Quadratic.end());
+  }
+
+  template <typename FixedMatrix>
+  static void Assign(FixedMatrix &Target,
+                     const std::vector<std::vector<double>> &Source)
+  {
+    Target.setZero();
+    for (std::size_t i = 0; i < Source.size(); i++)
+    {
+      for (std::size_t j = 0; j < Source[i].size(); j++)
+      {
+        Target(i, j) = Source[i][j];
+      }
+    }
+  }
+
+  /**
+   * @brief Eigenvalues of Matrix, with a fixed size solver if Matrix does not
+   * split into blocks and block by block otherwise
+   */
+  template <typename FixedMatrix, typename BlockSolverType>
+  static void
+  Eigenvalues(const FixedMatrix &Matrix,
+              const MatrixBlocks &Blocks,
+              BlockSolverType &BlockSolver,
+              Eigen::Matrix<double, FixedMatrix::RowsAtCompileTime, 1> &EV)
+  {
+    if (Blocks.IsTrivial())
+    {
+      Eigen::SelfAdjointEigenSolver<FixedMatrix> Solver(Matrix,
+                                                        Eigen::EigenvaluesOnly);
+      EV = Solver.eigenvalues();
+    }
+    else
+    {
+      BlockSolver.compute(Matrix, Blocks);
+      EV = BlockSolver.eigenvalues();
+    }
+  }
+
+  /**
+   * @brief BosonContribution adds the eigenvalues of Mass to Terms and their
+   * Debye contributions to VDebye
+   */
+  template <typename FixedMatrix, typename BlockSolverType>
+  static void BosonContribution(FixedMatrix &Mass,
+                                const FixedMatrix &Debye,
+                                const MatrixBlocks &Blocks,
+                                BlockSolverType &BlockSolver,
+                                double Temp,
+                                double cb,
+                                double Degrees,
+                                OneLoopTerms &Terms,
+                                double &VDebye)
+  {
+    const double ZeroMassBoson = std::pow(10, -5);
+    Eigen::Matrix<double, FixedMatrix::RowsAtCompileTime, 1> EV;
+
+    Eigenvalues(Mass, Blocks, BlockSolver, EV);
+    for (Eigen::Index i = 0; i < EV.size(); i++)
+    {
+      double m2 = (std::abs(EV[i]) < ZeroMassBoson) ? 0 : EV[i];
+      Terms.AddBoson(m2, cb, Degrees);
+      if (m2 > 0) VDebye += -std::pow(m2, 1.5);
+    }
+    if (Temp != 0)
+    {
+      Mass += std::pow(Temp, 2) * Debye;
+      Eigenvalues(Mass, Blocks, BlockSolver, EV);
+      for (Eigen::Index i = 0; i < EV.size(); i++)
+      {
+        double m2 = (std::abs(EV[i]) < ZeroMassBoson) ? 0 : EV[i];
+        if (m2 > 0) VDebye += std::pow(m2, 1.5);
+      }
+    }
+  }
+
+  /**
+   * @brief FermionContribution adds the eigenvalues of MIJ^* MIJ to Terms
+   */
+  template <typename FixedMatrix, typename BlockSolverType>
+  static void FermionContribution(const FixedMatrix &MIJ,
+                                  const MatrixBlocks &Blocks,
+                                  BlockSolverType &BlockSolver,
+                                  double Degrees,
+                                  OneLoopTerms &Terms)
+  {
+    const double ZeroMassFermion = std::pow(10, -10);
+    Eigen::Matrix<double, FixedMatrix::RowsAtCompileTime, 1> EV;
+
+    const FixedMatrix Mass = MIJ.conjugate() * MIJ;
+    Eigenvalues(Mass, Blocks, BlockSolver, EV);
+    for (Eigen::Index i = 0; i < EV.size(); i++)
+    {
+      double m2 = (std::abs(EV[i]) < ZeroMassFermion) ? 0 : EV[i];
+      Terms.AddFermion(m2, Degrees);
+    }
+  }
+};
+
+} // namespace BSMPT
+
+#endif /* FIXEDDIMENSIONKERNEL_H_ */
@@ -38,6 +38,7 @@ TestResults CheckTadpoleRelations(const Class_Potential_Origin &point);
 TestResults CheckNLOMasses(const Class_Potential_Origin &point);
 TestResults CheckVTreeSimplified(const Class_Potential_Origin &point);
 TestResults CheckVCounterSimplified(const Class_Potential_Origin &point);
+TestResults CheckMassMatricesSimplified(const Class_Potential_Origin &point);
 TestResults
 CheckCTConditionsFirstDerivative(const Class_Potential_Origin &point);
 TestResults
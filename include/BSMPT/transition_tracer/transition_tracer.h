@@ -70,6 +70,16 @@ struct user_input
   bool gw_calculation                        = false;
   int which_transition_temp                  = 3;
   size_t number_of_initial_scan_temperatures = 25;
+
+  // limits of the EvaluationBudget of the point, 0 means no limit
+  size_t max_evaluations = 0;
+  double max_wall_time   = 0;
+
+  // see MinimumTracer::UsePredictorCorrector
+  bool use_predictor_corrector = false;
+
+  // see Vacuum::num_refinements
+  int num_refinements = 0;
 };
 
 /**
@@ -0,0 +1,96 @@
+// SPDX-FileCopyrightText: 2021 Philipp Basler, Margarete Mühlleitner and Jonas
+// Müller
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+
+/**
+ * @file
+ * Bound on the work spent on a single minimisation or parameter point
+ */
+namespace BSMPT
+{
+
+/**
+ * @brief The EvaluationBudget class limits the number of evaluations of the
+ * effective potential and the wall time spent on a task, e.g. a single
+ * minimisation or the phase tracing and bounce solution of a parameter point.
+ * The evaluations are counted from every thread sharing the budget, the wall
+ * time is measured from the construction of the budget. Once one of both
+ * limits is reached the budget is exhausted and the calculations polling it
+ * stop with a dedicated status instead of running on.
+ */
+class EvaluationBudget
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  /**
+   * @param MaxEvaluations maximal number of evaluations of the effective
+   * potential, 0 means no limit
+   * @param MaxWallTime maximal wall time in seconds, a non-positive value means
+   * no limit
+   * @param MaxIterationsPerStart maximal number of iterations of a single local
+   * GSL minimisation
+   */
+  explicit EvaluationBudget(std::size_t MaxEvaluations        = 0,
+                            double MaxWallTime                = 0,
+                            std::size_t MaxIterationsPerStart = 600);
+  EvaluationBudget(const EvaluationBudget &)            = delete;
+  EvaluationBudget &operator=(const EvaluationBudget &) = delete;
+
+  /**
+   * @brief Consume books Evaluations evaluations of the effective potential
+   */
+  void Consume(std::size_t Evaluations = 1)
+  {
+    Evaluated.fetch_add(Evaluations, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Exhausted returns true if the number of evaluations or the wall
+   * time exceeds its limit
+   */
+  bool Exhausted() const;
+
+  /**
+   * @brief Evaluations returns the number of evaluations booked so far
+   */
+  std::size_t Evaluations() const
+  {
+    return Evaluated.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief ElapsedTime returns the wall time in seconds since the construction
+   */
+  double ElapsedTime() const;
+
+  /**
+   * @brief GetMaxIterationsPerStart returns the maximal number of iterations
+   * of a single local GSL minimisation
+   */
+  std::size_t GetMaxIterationsPerStart() const { return MaxIterationsPerStart; }
+
+private:
+  std::size_t MaxEvaluations;
+  double MaxWallTime;
+  std::size_t MaxIterationsPerStart;
+  Clock::time_point Start;
+  std::atomic<std::size_t> Evaluated{0};
+};
+
+/**
+ * @brief BudgetExhausted returns true if Budget is set and exhausted
+ */
+inline bool BudgetExhausted(const EvaluationBudget *Budget)
+{
+  return Budget != nullptr and Budget->Exhausted();
+}
+
+} // namespace BSMPT
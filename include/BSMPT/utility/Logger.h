@@ -9,6 +9,9 @@
 #include <fstream>
 #include <iostream>
 #include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
 #include <vector>
 
 /**
@@ -70,23 +73,34 @@ private:
     auto pos = mCurrentSetup.find(level);
     if (pos != mCurrentSetup.end() and pos->second)
     {
+      std::stringstream Line;
       if (not file.empty())
       {
-        mOstream << "file: " << file << "; ";
+        Line << "file: " << file << "; ";
       }
       if (line >= 0)
       {
-        mOstream << "Line: " << line << "; ";
+        Line << "Line: " << line << "; ";
       }
-      mOstream << toWrite << std::endl;
+      Line << toWrite << std::endl;
+      Emit(Line.str());
     }
   }
+  /**
+   * @brief Emit appends Text to the LogBuffer of the calling thread if there
+   * is one, otherwise it is written to the output under mLock
+   */
+  void Emit(const std::string &Text);
   void SetLevel(const std::map<LoggingLevel, bool> &level);
   void SetLevel(LoggingLevel level, bool enable);
   void Disable();
 
   std::ostream mOstream;
   std::ofstream mfilestream;
+  /**
+   * @brief mLock serialises the output of threads writing at the same time
+   */
+  std::mutex mLock;
 
   std::map<LoggingLevel, bool> mCurrentSetup{
       {LoggingLevel::Default, true},
@@ -141,6 +155,15 @@ public:
 
   static void Disable() { Instance().Disable(); }
 
+  /**
+   * @brief WriteBuffered writes the content of a LogBuffer as it is, the
+   * logging levels were already checked when it was collected
+   */
+  static void WriteBuffered(const std::string &Text)
+  {
+    Instance().Emit(Text);
+  }
+
 private:
   static BSMPTLogger &Instance()
   {
@@ -149,4 +172,25 @@ private:
   }
 };
 
+/**
+ * @brief The LogBuffer class collects the messages written by the calling
+ * thread during its lifetime in Text instead of writing them to the output.
+ * Tasks running concurrently use it to keep their messages together, they
+ * are written afterwards with Logger::WriteBuffered in a fixed order.
+ * Buffers on the same thread can be nested.
+ */
+class LogBuffer
+{
+public:
+  explicit LogBuffer(std::string &Text);
+  LogBuffer(const LogBuffer &)            = delete;
+  LogBuffer &operator=(const LogBuffer &) = delete;
+  ~LogBuffer();
+
+private:
+  friend BSMPTLogger;
+  std::string &Text;
+  LogBuffer *Previous;
+};
+
 } // namespace BSMPT
@@ -1,9 +1,17 @@
 #pragma once
+#include <Eigen/Core>
 #include <functional>
 #include <vector>
 
 namespace BSMPT
 {
+/**
+ * @brief BatchFunction evaluates a function for a block of points at once, one
+ * point per row, e.g. with Class_Potential_Origin::VEffBatch
+ */
+using BatchFunction =
+    std::function<std::vector<double>(const Eigen::MatrixXd &)>;
+
 /**
  * @brief Numerical method to calculate the
  * gradient of a function f using finite differences method.
@@ -53,4 +61,47 @@ std::vector<std::vector<double>>
 HessianNumerical(const std::vector<double> &phi,
                  const std::function<double(std::vector<double>)> &V,
                  double eps);
+
+/**
+ * @brief Numerical gradient as in NablaNumerical() above, evaluated at several
+ * points. All points of the finite differences stencils are passed to f in a
+ * single block.
+ *
+ * @param phis Points where we want to calculate the gradient
+ * @param f batched function
+ * @param eps Size of finite differences step
+ * @return std::vector<std::vector<double>> The gradient of f at each point of
+ * phis
+ */
+std::vector<std::vector<double>>
+NablaNumerical(const std::vector<std::vector<double>> &phis,
+               const BatchFunction &f,
+               const double &eps);
+
+/**
+ * @brief Numerical gradient as in NablaNumerical() above with all points of
+ * the finite differences stencil passed to f in a single block.
+ *
+ * @param phi Where we want to calculate the gradient
+ * @param f batched function
+ * @param eps Size of finite differences step
+ * @return std::vector<double> The \f$ dim \times 1 \f$ gradient of f taken at
+ * phi
+ */
+std::vector<double> NablaNumerical(const std::vector<double> &phi,
+                                   const BatchFunction &f,
+                                   const double &eps);
+
+/**
+ * @brief Numerical Hessian matrix as in HessianNumerical() above with all
+ * points of the finite differences stencil passed to V in a single block.
+ *
+ * @param phi Where we want to calculate the Hessian matrix
+ * @param V batched potential (or other function)
+ * @param eps Size of finite differences step
+ * @return std::vector<std::vector<double>> The \f$ dim \times \dim \f$
+ *  hessian matrix of V taken at phi
+ */
+std::vector<std::vector<double>> HessianNumerical(
+    const std::vector<double> &phi, const BatchFunction &V, double eps);
 } // namespace BSMPT
\ No newline at end of file
@@ -0,0 +1,172 @@
+// SPDX-FileCopyrightText: 2021 Philipp Basler, Margarete Mühlleitner and Jonas
+// Müller
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @file
+ * Persistent work-stealing thread pool shared by the minimizers
+ */
+namespace BSMPT
+{
+
+/**
+ * @brief The ThreadPool class keeps a fixed set of worker threads alive for
+ * the lifetime of the program. Every worker owns a task queue, it takes new
+ * tasks from the back of its own queue and steals from the front of the
+ * queues of the other workers once its own queue is empty. Tasks submitted by
+ * a worker are placed in its own queue, tasks submitted from outside of the
+ * pool are distributed round-robin.
+ */
+class ThreadPool
+{
+public:
+  /**
+   * @brief ThreadPool starts NumThreads workers, at least one
+   */
+  explicit ThreadPool(std::size_t NumThreads);
+  ThreadPool(const ThreadPool &)            = delete;
+  ThreadPool(ThreadPool &&)                 = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+  ThreadPool &operator=(ThreadPool &&)      = delete;
+  /**
+   * @brief ~ThreadPool finishes the queued tasks and joins the workers
+   */
+  ~ThreadPool();
+
+  /**
+   * @brief Global returns the process-wide pool with one worker per hardware
+   * thread. It is created on first use.
+   */
+  static ThreadPool &Global();
+
+  /**
+   * @brief Size returns the number of workers. The queues are complete before
+   * the first worker starts, Workers is still growing at that point.
+   */
+  std::size_t Size() const { return Queues.size(); }
+
+  /**
+   * @brief The GroupQueue struct holds the queued tasks of one TaskGroup. The
+   * worker queues only refer to it, a thread waiting for the group takes its
+   * tasks from here without searching the worker queues. Changed is notified
+   * whenever a task is added.
+   */
+  struct GroupQueue
+  {
+    std::mutex Lock;
+    std::condition_variable Changed;
+    std::deque<std::function<void()>> Tasks;
+  };
+
+  /**
+   * @brief Submit queues Task for execution by one of the workers. Task must
+   * not throw, use TaskGroup to propagate exceptions.
+   * @param Group the queue of the group the task belongs to, nullptr for none
+   */
+  void Submit(std::function<void()> Task,
+              const std::shared_ptr<GroupQueue> &Group = nullptr);
+
+private:
+  /**
+   * @brief The QueuedTask struct is an entry of a worker queue. Either Run is
+   * the task itself or Group refers to the queue holding it. In the latter
+   * case the task may already have been taken by a waiting thread.
+   */
+  struct QueuedTask
+  {
+    std::shared_ptr<GroupQueue> Group;
+    std::function<void()> Run;
+  };
+
+  struct TaskQueue
+  {
+    std::mutex Lock;
+    std::deque<QueuedTask> Tasks;
+  };
+
+  /**
+   * @brief TryPop takes a task from the queue of worker Index or steals one
+   * from the other workers
+   */
+  bool TryPop(std::size_t Index, std::function<void()> &Task);
+  /**
+   * @brief TakeTask moves the task referred to by Queued into Task
+   * @return false if Queued refers to a group whose task has already been
+   * taken by a waiting thread
+   */
+  static bool TakeTask(QueuedTask &Queued, std::function<void()> &Task);
+  void WorkerLoop(std::size_t Index);
+  /**
+   * @brief CurrentWorker returns the index of the calling worker, Size() if
+   * the calling thread is not a worker of this pool
+   */
+  std::size_t CurrentWorker() const;
+
+  std::vector<std::unique_ptr<TaskQueue>> Queues;
+  std::vector<std::thread> Workers;
+  std::atomic<std::size_t> NextQueue{0};
+  std::atomic<std::size_t> Pending{0};
+  std::mutex SleepLock;
+  std::condition_variable WakeUp;
+  bool Stop{false};
+};
+
+/**
+ * @brief The TaskGroup class collects tasks submitted to a ThreadPool and
+ * waits for their completion. While waiting the calling thread executes
+ * queued tasks of the same group itself, so groups can be nested inside tasks
+ * of the same pool without exhausting the workers. Tasks of other groups are
+ * never run by a waiting thread, a long unrelated task can therefore not delay
+ * the return of Wait. The first exception thrown by a task is rethrown by
+ * Wait.
+ */
+class TaskGroup
+{
+public:
+  explicit TaskGroup(ThreadPool &Pool = ThreadPool::Global());
+  TaskGroup(const TaskGroup &)            = delete;
+  TaskGroup &operator=(const TaskGroup &) = delete;
+  /**
+   * @brief ~TaskGroup waits for all tasks, exceptions are discarded
+   */
+  ~TaskGroup();
+
+  /**
+   * @brief Run submits Task to the pool
+   */
+  void Run(std::function<void()> Task);
+
+  /**
+   * @brief Wait returns once all tasks of the group have finished and
+   * rethrows the first exception thrown by one of them
+   */
+  void Wait();
+
+private:
+  void WaitForTasks();
+
+  ThreadPool &Pool;
+  /**
+   * @brief Queue holds the queued tasks of the group, its lock also guards
+   * Outstanding and Error
+   */
+  std::shared_ptr<ThreadPool::GroupQueue> Queue;
+  std::size_t Outstanding{0};
+  std::exception_ptr Error;
+};
+
+} // namespace BSMPT
@@ -0,0 +1,108 @@
+// SPDX-FileCopyrightText: 2021 Philipp Basler, Margarete Mühlleitner and Jonas
+// Müller
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file
+ */
+
+#include <BSMPT/ThermalFunctions/ThermalFunctionChebyshev.h>
+#include <BSMPT/ThermalFunctions/ThermalFunctionTable.h>
+#include <BSMPT/ThermalFunctions/ThermalFunctions.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace BSMPT
+{
+namespace ThermalFunctions
+{
+
+namespace
+{
+/**
+ * Evaluates the piece of Table containing x, see BosonChebyshev for the
+ * layout
+ */
+double EvaluatePieces(const double (*Table)[C_ChebyshevColumns],
+                      std::size_t Pieces,
+                      double x,
+                      int diff)
+{
+  // last piece starting at or below x
+  auto Upper = std::upper_bound(Table + 1,
+                                Table + Pieces,
+                                x,
+                                [](double Value,
+                                   const double(&Piece)[C_ChebyshevColumns])
+                                { return Value < Piece[0]; });
+  const double *Piece = *(Upper - 1);
+
+  const double xa = Piece[0], xb = Piece[1];
+  const double Ga = Piece[2], dGa = Piece[3], Gb = Piece[4], dGb = Piece[5];
+  const double BranchPoint = Piece[6], BranchCoefficient = Piece[7];
+  const double LogCoefficient = Piece[8];
+  const double *Coefficients  = Piece + 9;
+
+  const double w  = xb - xa;
+  const double u  = (x - xa) / w;
+  const double t  = 2 * u - 1;
+  const double u2 = u * u;
+  const double u3 = u2 * u;
+
+  // Chebyshev series and its derivative w.r.t. t
+  double Tkm1 = 1, Tk = t, dTkm1 = 0, dTk = 1;
+  double g  = Coefficients[0] + Coefficients[1] * t;
+  double dg = Coefficients[1];
+  for (std::size_t k = 2; k <= C_ChebyshevDegree; k++)
+  {
+    double Tkp1  = 2 * t * Tk - Tkm1;
+    double dTkp1 = 2 * Tk + 2 * t * dTk - dTkm1;
+    g += Coefficients[k] * Tkp1;
+    dg += Coefficients[k] * dTkp1;
+    Tkm1  = Tk;
+    Tk    = Tkp1;
+    dTkm1 = dTk;
+    dTk   = dTkp1;
+  }
+  const double Weight = (1 - t * t) * (1 - t * t);
+
+  const double Distance = std::max(x - BranchPoint, 0.0);
+  const double LogX     = std::log(x == 0 ? 1 : std::abs(x));
+
+  if (diff == 0)
+  {
+    double Hermite = (2 * u3 - 3 * u2 + 1) * Ga + (u3 - 2 * u2 + u) * w * dGa +
+                     (-2 * u3 + 3 * u2) * Gb + (u3 - u2) * w * dGb;
+    return Hermite + Weight * g +
+           BranchCoefficient * Distance * std::sqrt(Distance) +
+           LogCoefficient * x * x * LogX;
+  }
+  double dHermite = (6 * u2 - 6 * u) * Ga / w + (3 * u2 - 4 * u + 1) * dGa +
+                    (-6 * u2 + 6 * u) * Gb / w + (3 * u2 - 2 * u) * dGb;
+  double dWeight  = -4 * t * (1 - t * t);
+  return dHermite + (dWeight * g + Weight * dg) * 2 / w +
+         1.5 * BranchCoefficient * std::sqrt(Distance) +
+         LogCoefficient * (2 * x * LogX + x);
+}
+} // namespace
+
+double JbosonChebyshev(const double &x, int diff)
+{
+  if (diff != 0 and diff != 1) return JbosonNumericalIntegration(x, diff);
+  if (x > C_TableMaxRatio) return JInterpolatedHigh(x, 3, diff);
+  if (x < C_TableMinRatio) return JbosonNumericalIntegration(x, diff);
+  return EvaluatePieces(BosonChebyshev, C_BosonChebyshevPieces, x, diff);
+}
+
+double JfermionChebyshev(const double &x, int diff)
+{
+  if (diff != 0 and diff != 1) return JfermionNumericalIntegration(x, diff);
+  if (x > C_TableMaxRatio) return -JInterpolatedHigh(x, 3, diff);
+  if (x < C_TableMinRatio) return JfermionNumericalIntegration(x, diff);
+  return EvaluatePieces(FermionChebyshev, C_FermionChebyshevPieces, x, diff);
+}
+
+} // namespace ThermalFunctions
+} // namespace BSMPT
@@ -0,0 +1,287 @@
+// SPDX-FileCopyrightText: 2021 Philipp Basler, Margarete Mühlleitner and Jonas
+// Müller
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file
+ * Generated by tools/ThermalFunctions/ThermalFunctionChebyshev.py with
+ * tolerance = 1e-09 and degree = 12, do not edit.
+ */
+
+#include <BSMPT/ThermalFunctions/ThermalFunctionChebyshev.h>
+
+namespace BSMPT
+{
+namespace ThermalFunctions
+{
+
+static_assert(C_ChebyshevDegree == 12,
+              "C_ChebyshevDegree does not match the generated data");
+
+const std::size_t C_BosonChebyshevPieces = 16;
+
+const double BosonChebyshev[16][22] = {
+    {-3000, -2763.3093633394378, 215.17806832148514,
+     -3.8180418985430786, -425.87764609584349, -0.45687746779186472,
+     -3000, 0, 0,
+     -3.1467904293651152, 0.60124588062706052, -0.067744395871690274,
+     0.0084870072477154848, -0.0011381901116643406, 0.00016032760895591844,
+     -2.3443063568196777e-05, 3.5300250114453583e-06, -5.4470584200426128e-07,
+     8.5601706202053364e-08, -1.3886847603463192e-08, 2.2078395863681743e-09,
+     -4.200735912964258e-10},
+    {-2763.3093633394378, -2526.6187266788756, -425.87764609584349,
+     -0.45687746779186472, 410.29541595929669, 8.238621743501259,
+     -3000, 0, 0,
+     -0.74423146578213495, 0.081137756609807904, -0.0048596569906249444,
+     0.00033555351745791115, -2.4879937461124841e-05, 1.9371763716896214e-06,
+     -1.6379797637902436e-07, 8.111184237090077e-09, -5.3318624472818392e-09,
+     -3.3154667899992774e-09, -2.5306475462180891e-09, -1.7088405989385846e-09,
+     -8.4075869556985949e-10},
+    {-2526.6187266788756, -1934.4424626135142, 410.29541595929669,
+     8.238621743501259, 15424.793692059538, 45.935585683551302,
+     -2526.6187266788756, -1.0471975511965976, 0,
+     -5.7427475967974217, 1.5067914138518299, -0.10218128547940039,
+     0.010923046958954895, -0.001117535970031178, 0.00012734840617179853,
+     -1.4871190571624355e-05, 1.7626168597163228e-06, -2.3674983628242131e-07,
+     1.9253729550865293e-09, -1.1585131213328518e-08, -1.2741713154659132e-08,
+     -2.7098332979245647e-09},
+    {-1934.4424626135142, -1421.2230337568676, 334.24219830379752,
+     7.7107722044767888, 12438.965847885775, 42.729404007423611,
+     -1934.4424626135142, -1.0471975511965976, 0,
+     -3.5114001827734946, 1.2380608753600184, -0.073266427557551625,
+     0.0083953355887188136, -0.00081460728557111945, 9.3582554096604252e-05,
+     -1.0718972603398833e-05, 1.196814772141098e-06, -1.9349880883914659e-07,
+     -3.8886699877265912e-08, -2.4465688142072395e-08, -2.8928171482188141e-08,
+     -7.361894700690204e-09},
+    {-1421.2230337568676, -986.96044010893581, 263.56547067868559,
+     7.1440392707508842, 9675.4121806047078, 39.262086459513924,
+     -1421.2230337568676, -1.0471975511965976, 0,
+     -1.5050934796638313, 1.0131144342149627, -0.045868208498052454,
+     0.0063137217606616782, -0.00053847007309324975, 6.5365750723996784e-05,
+     -7.0111892970322528e-06, 7.5204017228987129e-07, -9.2429266941051181e-08,
+     -5.4796599018986242e-08, 3.4514717238100556e-09, -3.3470563107420922e-08,
+     1.6400587725502629e-09},
+    {-986.96044010893581, -631.65468166971891, 198.70960081019504,
+     6.528311831860198, 7153.7062541939104, 35.456965050501836,
+     -986.96044010893581, -1.0471975511965976, 0,
+     0.25379475520606576, 0.84348316602806539, -0.018897865643493137,
+     0.0048882002725744601, -0.00027406598226707393, 4.5151883462725741e-05,
+     -3.782300179354915e-06, 4.5522331670877492e-07, -5.7707381394801217e-08,
+     -4.4798626756932421e-08, -2.850062796877495e-09, -2.5906815274231359e-08,
+     -6.8784110458690428e-10},
+    {-631.65468166971891, -493.48022005446791, 140.25169974573629,
+     5.8481518472337601, 1646.3228125852861, 16.579970028362322,
+     -631.65468166971891, -1.0471975511965976, 0,
+     -0.0059701985032354398, 0.023275019914703186, -0.00034454173959113304,
+     4.2616772082232681e-05, -1.3987439382984618e-06, 1.023705042530337e-07,
+     1.2658464736350693e-08, -1.4854728119581765e-08, 1.3192561023312754e-08,
+     -1.0176691368341412e-08, 7.9269532303045e-09, -5.0831017758983501e-09,
+     2.6416366385338996e-09},
+    {-493.48022005446791, -355.3057584392169, 1646.3228125852861,
+     16.579970028362322, 4899.7625194612529, 31.190296103523625,
+     -631.65468166971891, -1.0471975511965976, 0,
+     0.22803224346407358, 0.027394722444951638, 0.00071602878519688295,
+     4.9021674139504423e-05, 1.8500217173029915e-06, 1.1349489182654028e-07,
+     -9.1047197473633687e-09, -1.2415050679811438e-08, -1.0906640417730228e-08,
+     -8.552957376527761e-09, -6.5610227848968465e-09, -4.273416633380724e-09,
+     -2.1873603382631499e-09},
+    {-355.3057584392169, -157.91367041742973, 88.984886955243212,
+     5.0777773196525997, 2950.2787618648586, 26.236718272083912,
+     -355.3057584392169, -1.0471975511965976, 0,
+     2.9009523474587371, 0.78846788724433647, 0.055695709639497132,
+     0.0083880710016580855, 0.00087136124077670843, 0.00013423585572016104,
+     1.7083281528154425e-05, 2.6327448935466928e-06, 3.7511758010921881e-07,
+     3.0315664235357736e-08, 4.438286029294038e-09, -1.393686224546378e-08,
+     -1.4193479895670162e-09},
+    {-157.91367041742973, -98.696044010893587, 46.100772818262428,
+     4.1676119202170057, 472.59393317512894, 10.637957157271952,
+     -157.91367041742973, -1.0471975511965976, 0,
+     0.095511761417719485, 0.01344409086455607, 0.00062280791274375749,
+     4.8572075769139825e-05, 3.2602172143774829e-06, 2.5724618807343447e-07,
+     3.1579311157501003e-08, -6.4147948726393897e-09, 7.5363563424045967e-09,
+     -5.4826274588680128e-09, 4.4303444107773871e-09, -2.7446969355424335e-09,
+     1.4772368253859534e-09},
+    {-98.696044010893587, -39.478417604357432, 472.59393317512894,
+     10.637957157271952, 1363.4506742100371, 20.08836737331611,
+     -157.91367041742973, -1.0471975511965976, 0,
+     0.44538236260255093, 0.084789977321212559, 0.0095026984020712031,
+     0.0012345137384087116, 0.00017462142271372174, 2.6343054566049584e-05,
+     4.1608593713228826e-06, 6.7545319023019598e-07, 1.0737276578110821e-07,
+     1.3037122163879372e-08, -1.7687315800019887e-09, -2.9376952387788053e-09,
+     -1.6693484949071602e-09},
+    {-39.478417604357432, 0, 192.73665036125692,
+     -7.3095492417596653, 257.59292962325082, 10.692071434513471,
+     -39.478417604357432, -1.0471975511965976, -0.03125,
+     -0.019299772292070076, 0.0012730479787685725, -5.1754500388261825e-05,
+     2.3511065020676444e-06, -1.0552192431650953e-07, -4.0482707149121122e-09,
+     7.9659567179770115e-09, -7.5486968099947038e-09, 5.9033451799460028e-09,
+     -5.0518867900404789e-09, 3.5355050092150249e-09, -2.5286091572625984e-09,
+     1.177194666799416e-09},
+    {0, 50, -2.1646464674222758,
+     0.8224670334241132, 490.72128062167252, 19.342663380822842,
+     0, -0.52359877559829882, -0.03125,
+     -0.34914471624522464, 0.067307613557345825, -0.0078506782523958263,
+     0.0010192362943640847, -0.00014187930482049225, 2.0755315232251066e-05,
+     -3.1518813726589997e-06, 4.9294077016840493e-07, -7.8645637592044381e-08,
+     1.2795034181739979e-08, -1.9284321789009722e-09, 3.0324503591954838e-10,
+     1.3297258593370798e-11},
+    {50, 100, 490.72128062167252,
+     19.342663380822842, 1962.7123077220526, 39.761388541738128,
+     0, -0.52359877559829882, -0.03125,
+     -0.086243164533082992, 0.00856901417740423, -0.00052836776138305249,
+     3.6814072000598189e-05, -2.7739423761736089e-06, 2.2053370740468752e-07,
+     -1.8528763534159538e-08, 1.4776915930197605e-09, -3.3351773693218306e-10,
+     -4.6752228157241296e-11, -1.2386380382905643e-10, -3.0056580621820379e-11,
+     -4.1823903848761459e-11},
+    {100, 200, 1962.7123077220526,
+     39.761388541738128, 8103.8576329221978, 83.586176171333022,
+     0, -0.52359877559829882, -0.03125,
+     -0.46396021274067545, 0.053536061743840083, -0.0038791517362844947,
+     0.00032083239650745248, -2.891341453075808e-05, 2.7669043399108491e-06,
+     -2.7620512986172343e-07, 2.903289349957069e-08, -2.8058097383948808e-09,
+     6.3712129589204713e-10, 9.8504409757210336e-11, 1.5913877267241636e-10,
+     4.3562098372973423e-11},
+    {200, 400, 8103.8576329221978,
+     83.586176171333022, 34146.112940073122, 177.99457695153154,
+     0, -0.52359877559829882, -0.03125,
+     -2.2093554557742934, 0.27472698564755438, -0.021530169572781321,
+     0.0019354869523506334, -0.00019057968330981313, 2.0012643938881727e-05,
+     -2.2106169572484628e-06, 2.4824638078513317e-07, -3.302214040673973e-08,
+     7.0803424661719949e-10, -2.495570861071883e-09, -1.429535942612312e-09,
+     -7.0576664170993397e-10}};
+
+const std::size_t C_FermionChebyshevPieces = 16;
+
+const double FermionChebyshev[16][22] = {
+    {-3000, -2852.3156719148246, -357.11953413565033,
+     2.6831902502965761, 450.2243345354247, 8.4902516674062216,
+     -3000, 0, 0,
+     -0.078274524870915727, 0.0046020754650890339, -0.00014612493954198016,
+     5.3903368298208617e-06, -2.2153987637120775e-07, 1.3531943066080743e-09,
+     -5.8976778012535922e-09, -5.692148897528372e-09, -3.8793616833856008e-09,
+     -3.7966941353649268e-09, -2.3064948012416422e-09, -1.893508157427068e-09,
+     -7.6600871399140202e-10},
+    {-2852.3156719148246, -2220.660990245105, 450.2243345354247,
+     8.4902516674062216, 16996.105565795133, 47.457479649827,
+     -2852.3156719148246, -1.0471975511965976, 0,
+     -6.9371577562703788, 1.6552991502324563, -0.11733891080698693,
+     0.012322644790324069, -0.0012801936187461121, 0.00014592789723266719,
+     -1.7157453026191896e-05, 2.03316592061443e-06, -2.6736209827268237e-07,
+     -4.5619226686819907e-09, -8.2738571549612061e-09, -1.8340805523892484e-08,
+     -1.3970457952876376e-09},
+    {-2220.660990245105, -1667.9631437841017, 371.62069599202795,
+     7.9790620454695498, 13905.140419694453, 44.361485659732303,
+     -2220.660990245105, -1.0471975511965976, 0,
+     -4.6001376240586307, 1.3674591865200791, -0.087501365071735601,
+     0.0096107398185139373, -0.00096240279766121812, 0.00010981886855122325,
+     -1.273164234770154e-05, 1.4453554212624253e-06, -2.1734106207068532e-07,
+     -3.4907592303913873e-08, -2.0102695508228408e-08, -2.8956387988242884e-08,
+     -5.7376547786429475e-09},
+    {-1667.9631437841017, -1194.2221325318121, 298.2064727922226,
+     7.432807447859731, 11028.297342806165, 41.032413712736059,
+     -1667.9631437841017, -1.0471975511965976, 0,
+     -2.4788503202713574, 1.1195426552820131, -0.059420064870160917,
+     0.0072899860522341537, -0.00067351471792748575, 7.876606226795083e-05,
+     -8.7055737277425423e-06, 1.0164207740086358e-06, -7.4174690184874564e-08,
+     -1.1281064424486852e-08, 3.0003126205713215e-08, -1.3322982033842507e-08,
+     1.0633984539086219e-08},
+    {-1194.2221325318121, -799.437956488238, 230.37767624652392,
+     6.8431011661517047, 8382.8936022368398, 37.40799277356642,
+     -1194.2221325318121, -1.0471975511965976, 0,
+     -0.59308455014942796, 0.92037034980676957, -0.03245150242732546,
+     0.0054968012280610405, -0.00040698643849998656, 5.4028035582196151e-05,
+     -5.4475425577298172e-06, 6.305470434675442e-07, -1.2852631031251988e-07,
+     -2.0510516857568792e-08, -3.2297877996010875e-08, -1.4914970583376977e-08,
+     -1.0394323500208568e-08},
+    {-799.437956488238, -483.61061565337855, 168.63780292661065,
+     6.1975632613020339, 5991.3006104208471, 33.3919692625945,
+     -799.437956488238, -1.0471975511965976, 0,
+     1.0316358475409262, 0.78554465240881244, -0.0047291523738853432,
+     0.0045755646970355559, -0.00012965544902208224, 4.0330477105665619e-05,
+     -2.0789218410686665e-06, 3.5485383089215963e-07, -3.6627875655580716e-08,
+     -5.5234321351725306e-08, -3.4645862610440159e-09, -3.0359190549321084e-08,
+     -9.987790284997462e-10},
+    {-483.61061565337855, -365.17536284030626, 113.65761783538937,
+     5.4765124640389837, 1309.9913051772223, 15.308126208948929,
+     -483.61061565337855, -1.0471975511965976, 0,
+     0.038006135428007015, 0.019957140420303107, -8.1236126550552121e-05,
+     3.5863610711707461e-05, -5.2606078618393763e-07, 7.2125323809022145e-08,
+     1.8790141069426807e-08, -1.7710795592649296e-08, 1.5240836141738878e-08,
+     -1.2011078315437276e-08, 9.1506426406559393e-09, -6.0053749096964033e-09,
+     3.0500181853956652e-09},
+    {-365.17536284030626, -246.74011002723395, 1309.9913051772223,
+     15.308126208948929, 3884.0366331771711, 28.820488631244018,
+     -483.61061565337855, -1.0471975511965976, 0,
+     0.27080679585156386, 0.031260626342181082, 0.0012053885903887246,
+     7.9418066968202255e-05, 4.3462368171568544e-06, 2.8972293752982381e-07,
+     5.4116725118219096e-09, -1.0539613267605082e-08, -1.0281475137075857e-08,
+     -7.967912364092145e-09, -6.2241881563315146e-09, -3.9796302951751352e-09,
+     -2.073303431715523e-09},
+    {-246.74011002723395, -88.826439609804225, 66.395523711222879,
+     4.6449938854479251, 2106.4529398337972, 23.367389377665802,
+     -246.74011002723395, -1.0471975511965976, 0,
+     3.3476819142362331, 0.89860417322961361, 0.097736334954700146,
+     0.015331567924714608, 0.0023044670912695073, 0.00039657661097627705,
+     6.8847026525337577e-05, 1.2636472759081513e-05, 2.3713911002045163e-06,
+     4.3226999986327564e-07, 8.6321240394964931e-08, 4.1705374538463067e-09,
+     2.1103845679540165e-09},
+    {-88.826439609804225, -49.348022005446794, 28.392331108412325,
+     3.6281805754870859, 262.97959627136618, 8.5642513922963648,
+     -88.826439609804225, -1.0471975511965976, 0,
+     0.075965306629223281, 0.010643217165139166, 0.00072353469517419822,
+     6.2453383838896275e-05, 5.6437655381378438e-06, 5.4359861952282605e-07,
+     6.3876329136326205e-08, -5.2840285138863962e-10, 6.0105546309316633e-09,
+     -4.2788083994741521e-09, 3.2227323704968871e-09, -2.1757708135172749e-09,
+     1.0722079260774628e-09},
+    {-49.348022005446794, -29.608813203268078, 262.97959627136618,
+     8.5642513922963648, 463.41470510254095, 11.862794255712664,
+     -88.826439609804225, -1.0471975511965976, 0,
+     0.015912338663262103, 0.0016770060505952042, 0.0001060014031507591,
+     7.7218050886982289e-06, 6.1385549580640955e-07, 5.243987735314341e-08,
+     4.5633865425758886e-09, 7.218708141926583e-10, -1.5561742866543327e-11,
+     2.0999194664122608e-10, -3.4951587030579011e-11, 1.0611777108747125e-10,
+     -1.1818572562912659e-11},
+    {-29.608813203268078, -9.869604401089358, 463.41470510254095,
+     11.862794255712664, 737.54260800748614, 16.142603403017858,
+     -88.826439609804225, -1.0471975511965976, 0,
+     0.072476718625090017, 0.015787519077909731, 0.0021363306150109711,
+     0.00033026885626765296, 5.5780170629315098e-05, 1.0034589653416483e-05,
+     1.8907650585721681e-06, 3.6671360718033309e-07, 7.134707770417581e-08,
+     1.2241517407123998e-08, 1.0509694199313846e-09, -9.4681287089405974e-10,
+     -5.9677385882865696e-10},
+    {-9.869604401089358, 0, 9.8064275380568482,
+     0.46419597627633591, 34.363762670328633, 4.5235686838326226,
+     -9.869604401089358, -1.0471975511965976, -0.03125,
+     -0.00024668298488205549, 6.8413932988926129e-06, -1.1053040793854625e-07,
+     -2.3692008902816691e-09, 4.0418354837038558e-09, -3.6616897731165179e-09,
+     3.1953139359660395e-09, -2.7656883196416279e-09, 2.2925305981880422e-09,
+     -1.853409067454767e-09, 1.3796983630425289e-09, -9.3051133595242752e-10,
+     4.6028079558250256e-10},
+    {0, 100, 34.363762670328633,
+     4.5235686838326226, 2645.1113121051794, 48.372103741381018,
+     -9.869604401089358, -1.0471975511965976, -0.03125,
+     -0.8862464086045645, 0.15031821107436699, -0.015797714051447347,
+     0.001870603437363552, -0.00023894923269140146, 3.2176018205274045e-05,
+     -4.5040513958483075e-06, 6.504953529504412e-07, -9.5459879727417714e-08,
+     1.4776130054559536e-08, -1.8175033871077499e-09, 4.8911933477805513e-10,
+     8.4022122592841697e-11},
+    {100, 200, 2645.1113121051794,
+     48.372103741381018, 9806.7492192835143, 95.234898472069872,
+     -9.869604401089358, -1.0471975511965976, -0.03125,
+     -0.25489374949356358, 0.023027274236659984, -0.0013127263690529711,
+     8.5554552847328261e-05, -6.0775231847152686e-06, 4.5887170469792997e-07,
+     -3.5674079626244129e-08, 3.3203521171848012e-09, 8.9809873213489224e-11,
+     2.9025624211834833e-10, 2.0820352066340211e-10, 1.3975944760465847e-10,
+     7.1171069038200585e-11},
+    {200, 400, 9806.7492192835143,
+     95.234898472069872, 38646.87074174283, 194.08775693534457,
+     -9.869604401089358, -1.0471975511965976, -0.03125,
+     -1.4942941111444821, 0.16051051118990139, -0.010930862277825864,
+     0.00085600335528591444, -7.3480057755725124e-05, 6.733556629748924e-06,
+     -6.425400426766605e-07, 6.7031197549847732e-08, -3.5907745836556599e-09,
+     2.4886417883716554e-09, 1.7868270623794686e-09, 9.2004454482336617e-10,
+     6.2470518074748004e-10}};
+
+} // namespace ThermalFunctions
+} // namespace BSMPT
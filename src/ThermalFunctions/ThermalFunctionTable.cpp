@@ -0,0 +1,76 @@
+// SPDX-FileCopyrightText: 2021 Philipp Basler, Margarete Mühlleitner and Jonas
+// Müller
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file
+ */
+
+#include <BSMPT/ThermalFunctions/ThermalFunctionTable.h>
+#include <BSMPT/ThermalFunctions/ThermalFunctions.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace BSMPT
+{
+namespace ThermalFunctions
+{
+
+namespace
+{
+/**
+ * Cubic Hermite interpolation in the table at s. Column 1 interpolates J and
+ * column 3 dJ/dx, the following column holds the derivative w.r.t. s.
+ */
+double InterpolateTable(const double (*Table)[5],
+                        std::size_t Rows,
+                        double s,
+                        int Column)
+{
+  // first row with a larger s, duplicate knots at x = 0 hold the one-sided
+  // limits of both segments
+  auto Upper = std::upper_bound(Table + 1,
+                                Table + Rows - 1,
+                                s,
+                                [](double Value, const double(&Row)[5])
+                                { return Value < Row[0]; });
+  const double *Low  = *(Upper - 1);
+  const double *High = *Upper;
+
+  double h  = High[0] - Low[0];
+  double t  = (s - Low[0]) / h;
+  double t2 = t * t;
+  double t3 = t2 * t;
+  return (2 * t3 - 3 * t2 + 1) * Low[Column] +
+         (t3 - 2 * t2 + t) * h * Low[Column + 1] +
+         (-2 * t3 + 3 * t2) * High[Column] + (t3 - t2) * h * High[Column + 1];
+}
+
+double RatioToS(double x)
+{
+  return (x >= 0) ? std::sqrt(x) : -std::sqrt(-x);
+}
+} // namespace
+
+double JbosonTabulated(const double &x, int diff)
+{
+  if (diff != 0 and diff != 1) return JbosonNumericalIntegration(x, diff);
+  if (x > C_TableMaxRatio) return JInterpolatedHigh(x, 3, diff);
+  if (x < C_TableMinRatio) return JbosonNumericalIntegration(x, diff);
+  return InterpolateTable(
+      BosonTable, C_BosonTableRows, RatioToS(x), (diff == 0) ? 1 : 3);
+}
+
+double JfermionTabulated(const double &x, int diff)
+{
+  if (diff != 0 and diff != 1) return JfermionNumericalIntegration(x, diff);
+  if (x > C_TableMaxRatio) return -JInterpolatedHigh(x, 3, diff);
+  if (x < C_TableMinRatio) return JfermionNumericalIntegration(x, diff);
+  return InterpolateTable(
+      FermionTable, C_FermionTableRows, RatioToS(x), (diff == 0) ? 1 : 3);
+}
+
+} // namespace ThermalFunctions
+} // namespace BSMPT
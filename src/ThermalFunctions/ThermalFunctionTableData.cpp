@@ -0,0 +1,9642 @@
+// SPDX-FileCopyrightText: 2021 Philipp Basler, Margarete Mühlleitner and Jonas
+// Müller
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file
+ * Generated by tools/ThermalFunctions/ThermalFunctionTables.py with
+ * reltol = 1e-07 and abstol = 1e-09, do not edit.
+ */
+
+#include <BSMPT/ThermalFunctions/ThermalFunctionTable.h>
+
+namespace BSMPT
+{
+namespace ThermalFunctions
+{
+
+const std::size_t C_BosonTableRows = 2329;
+
+const double BosonTable[2329][5] = {
+    {-54.772255750516614, 215.17806832148713, -418.24553466637894,
+     -3.8180418985430782, -0.26924824819730026},
+    {-54.701837417968491, 185.68629796030132, -419.16630204994289,
+     -3.8313731479178328, -0.11061455065386915},
+    {-54.631419085420362, 156.17216992664189, -418.89037135183702,
+     -3.8337862933495304, 0.040952342280321338},
+    {-54.561000752872239, 126.7179342578452, -417.4742747016615,
+     -3.8257571245124615, 0.18605963895430694},
+    {-54.490582420324117, 97.402026942945753, -414.96990345841255,
+     -3.8077213073027769, 0.32524171960463061},
+    {-54.420164087775994, 68.299377075888714, -411.42505143798081,
+     -3.7800791152924531, 0.4589710498632491},
+    {-54.384954921501929, 53.850547639143642, -409.27637572330258,
+     -3.7627720415880024, 0.52392389152248231},
+    {-54.349745755227872, 39.481678657822769, -406.88387830369203,
+     -3.7431994634910883, 0.58766715744383491},
+    {-54.314536588953814, 25.201266019000087, -404.25257648194975,
+     -3.7214031626679143, 0.65024623580504348},
+    {-54.279327422679749, 11.017632161743961, -401.38730704329424,
+     -3.697423366336527, 0.71170406568609801},
+    {-54.261722839542713, 3.9646621401639814, -399.86839897286103,
+     -3.6846268239151887, 0.74202530300358294},
+    {-54.244118256405685, -3.0610677375698141, -398.29273583111092,
+     -3.6712988304872716, 0.77208130560934651},
+    {-54.208909090131627, -17.026839905504605, -394.97336667131958,
+     -3.6430669174195009, 0.83141648809198343},
+    {-54.173699923857569, -30.871846415309811, -391.43354969889958,
+     -3.6127636680628128, 0.88974616156300701},
+    {-54.138490757583504, -44.588399914055366, -387.67748913497633,
+     -3.5804238695061148, 0.94710502084841131},
+    {-54.068072425035382, -71.606121535006608, -379.53276771086496,
+     -3.5097678786041593, 1.0590405195105994},
+    {-53.997654092487252, -98.021333182508641, -370.57018284625519,
+     -3.4313544641359983, 1.1674678072085671},
+    {-53.92723575993913, -123.77747635922209, -360.81880033916411,
+     -3.3454227280012487, 1.272608831850458},
+    {-53.856817427391007, -148.81997710427635, -350.30594590383492,
+     -3.2521968678906101, 1.3746653665982502},
+    {-53.786399094842878, -173.09612900281618, -339.05735948576131,
+     -3.1518875142384335, 1.4738213297516745},
+    {-53.715980762294755, -196.55498643305879, -327.09733213739639,
+     -3.0446929153623326, 1.5702447858947657},
+    {-53.645562429746633, -219.14726690833189, -314.44882781511501,
+     -2.9307999913964191, 1.6640896788396571},
+    {-53.57514409719851, -240.82526152428846, -301.13359208882508,
+     -2.8103852743960385, 1.755497337874756},
+    {-53.504725764650388, -261.54275265080793, -287.17224945149923,
+     -2.6836157493328261, 1.8445977915826928},
+    {-53.434307432102258, -281.25493811763045, -272.58439066425274,
+     -2.5506496084993655, 1.9315109176509586},
+    {-53.363889099554136, -299.9183612363928, -257.38865136326604,
+     -2.4116369300135641, 2.0163474523598985},
+    {-53.293470767006013, -317.49084608168192, -241.60278298001199,
+     -2.2667202895855327, 2.0992098795704508},
+    {-53.223052434457884, -333.93143752244373, -225.24371687962895,
+     -2.1160353134293435, 2.1801932158701898},
+    {-53.152634101909761, -349.2003455543844, -208.3276224987024,
+     -1.9597111791230797, 2.2593857059332842},
+    {-53.082215769361639, -363.25889353520904, -190.86996015928773,
+     -1.7978710703091578, 2.3368694399984338},
+    {-53.011797436813517, -376.06946996896636, -172.88552914738099,
+     -1.6306325903535801, 2.4127209035831063},
+    {-52.941379104265394, -387.59548352450651, -154.38851156852434,
+     -1.4581081394240212, 2.4870114680645625},
+    {-52.870960771717272, -397.80132100682681, -135.3925124287185,
+     -1.2804052588840529, 2.5598078295135083},
+    {-52.800542439169149, -406.65230802961315, -115.91059633350153,
+     -1.0976269464185968, 2.6311724021210874},
+    {-52.730124106621027, -414.11467216325582, -95.955321150491415,
+     -0.9098719448912016, 2.7011636716794905},
+    {-52.659705774072904, -420.15550835544593, -75.538768939615281,
+     -0.71723500757582015, 2.7698365138320518},
+    {-52.589287441524775, -424.74274644160045, -54.672574419797165,
+     -0.51980714209703682, 2.8372424811772543},
+    {-52.518869108976652, -427.84512058021352, -33.367951210015981,
+     -0.31767583514391262, 2.9034300627738578},
+    {-52.44845077642853, -429.43214046392529, -11.635716055894198,
+     -0.11092525978978526, 2.9684449191358904},
+    {-52.413241610154465, -429.64806968660798, -0.61252125984203143,
+     -0.0058431919208309611, 3.000526123705316},
+    {-52.3780324438804, -429.47406417126155, 10.513688770384331,
+     0.10036353295295172, 3.0323300954136387},
+    {-52.307614111332278, -427.94187253637756, 33.070174729479419,
+     0.31611243689200186, 3.0951262151200774},
+    {-52.237195778784155, -424.80724492533102, 56.023987784176406,
+     0.53624612643286484, 3.156871656472231},
+    {-52.166777446236033, -420.04253631735287, 79.365690544775944,
+     0.76069190421596933, 3.2176027131666727},
+    {-52.09635911368791, -413.62075559852002, 103.08614567072203,
+     0.98937955957498913, 3.2773537411920106},
+    {-51.955522448591665, -395.70116048593997, 151.62817225479318,
+     1.4592113129535405, 3.3940442409421943},
+    {-51.81468578349542, -370.84485252657487, 201.58240830229531,
+     1.9452246525685344, 3.5071840778885592},
+    {-51.673849118399168, -338.85747337471486, 252.88510860166227,
+     2.446935083374882, 3.6169906817717745},
+    {-51.533012453302916, -299.5533883940243, 305.47607747719007,
+     2.9638872533795677, 3.7236609294124592},
+    {-51.392175788206671, -252.75520976766396, 359.29834878784192,
+     3.4956522396381269, 3.8273736427109935},
+    {-51.251339123110426, -198.29336193538703, 414.29790385783991,
+     4.0418251595598145, 3.9282917217112829},
+    {-51.180920790562297, -168.1376074276979, 442.22302590443678,
+     4.3201941179806029, 3.9777497816570122},
+    {-51.110502458014174, -136.00568440995875, 470.42342190320829,
+     4.6020230606189774, 4.0265639743495525},
+    {-51.040084125466052, -101.87842170923028, 498.89306195417214,
+     4.8872672381162214, 4.074750957396593},
+    {-50.969665792917922, -65.737067724966124, 527.62605842131563,
+     5.1758830493904044, 4.1223266927875732},
+    {-50.8992474603698, -27.563280612016836, 556.61666027591343,
+     5.4678279940120493, 4.1693064850721502},
+    {-50.864038294095735, -7.7086025200224659, 571.20680205747828,
+     5.6150358997722725, 4.1925775142662127},
+    {-50.828829127821678, 12.66088114884319, 585.8592477440917,
+     5.763060627176789, 4.2157050169739074},
+    {-50.758410795273555, 54.952967813592622, 615.34832723845102,
+     6.0615405171013554, 4.2615363826416388},
+    {-50.687992462725433, 99.330147090215021, 645.07852655519957,
+     6.3632282046835131, 4.306814118722003},
+    {-50.61757413017731, 145.80921252452328, 675.04459031961198,
+     6.6680851652782218, 4.3515512334219233},
+    {-50.547155797629188, 194.4065915736042, 705.24137566399054,
+     6.9760737724541615, 4.395760233712644},
+    {-50.406319132532943, 298.02021627987443, 766.30707773599033,
+     7.6012997072960742, 4.4826415640999686},
+    {-50.335900799984813, 353.06755500409076, 797.16623533423171,
+     7.9184659722477067, 4.5253366235000403},
+    {-50.300691633710755, 381.4079901777996, 812.67530470243378,
+     8.0781722706750134, 4.5465025176338596},
+    {-50.283087050573727, 395.78321139361094, 820.44945617804774,
+     8.1583043554272638, 4.5570406310720353},
+    {-50.265482467436691, 410.29540767693084, 828.23658901380827,
+     8.2386216978058631, 4.5672539430806065},
+    {-50.265482447436689, 410.2954242406089, 828.07826549781964,
+     8.2370468279475144, -78743.471275425312},
+    {-50.26548045006588, 410.29707553608597, 825.99420237168556,
+     8.2163165951654893, -5553.5277805888563},
+    {-50.265478452695064, 410.29872437699879, 825.06984337353549,
+     8.2071221519358488, -3930.5030596438924},
+    {-50.265476455324254, 410.30037161489736, 824.3602338730559,
+     8.2000638609856189, -3209.7420420793528},
+    {-50.265474457953445, 410.30201755618214, 823.76196527795912,
+     8.1941130981169543, -2779.6860370878485},
+    {-50.265472460582629, 410.30366237813678, 823.23489947496091,
+     8.1888706021865048, -2486.0558560232957},
+    {-50.26547046321182, 410.30530620042038, 822.75843148608044,
+     8.184131411723671, -2269.239635310701},
+    {-50.26546846584101, 410.30694911092951, 822.32031407221348,
+     8.1797737012143745, -2100.6941581009555},
+    {-50.265466468470194, 410.30859117777698, 821.91256446566604,
+     8.1757180646202059, -1964.8123681791913},
+    {-50.265462473728576, 410.31187299021866, 821.16749052213584,
+     8.168307323854048, -1757.0094682632903},
+    {-50.26545847898695, 410.31515197655182, 820.49402738186404,
+     8.1616089080821244, -1603.5918628606382},
+    {-50.265454484245325, 410.31842838552024, 819.87483452672063,
+     8.1554503280547639, -1484.3430192602393},
+    {-50.265450489503706, 410.32170240987608, 819.29861151266414,
+     8.1497191762336616, -1388.2117900466494},
+    {-50.265442500020463, 410.32824389836003, 818.24580746065055,
+     8.1392480277112593, -1241.2109778797792},
+    {-50.265434510537219, 410.33477740064984, 817.29431520382718,
+     8.1297846438838253, -1132.6910283761961},
+    {-50.265426521053975, 410.34130362057499, 816.41959715398502,
+     8.121084945056845, -1048.3448540100253},
+    {-50.265418531570731, 410.34782310349777, 815.6056642001181,
+     8.1129898847639357, -980.35269922542727},
+    {-50.265402552604243, 410.36084353766341, 814.1187458608216,
+     8.0982017900764056, -876.38545937949505},
+    {-50.265386573637748, 410.37384141521545, 812.77513182426742,
+     8.0848391629652419, -799.63702403827961},
+    {-50.265370594671253, 410.38681872723117, 811.54011049118105,
+     8.0725567213585236, -739.98656431769234},
+    {-50.265354615704766, 410.39977701643301, 810.3910642570321,
+     8.0611294842415759, -691.90276194775481},
+    {-50.265338636738278, 410.41271752405589, 809.31228233912407,
+     8.0504011739374643, -652.07364046042198},
+    {-50.26532265777179, 410.42564127694607, 808.29232551523341,
+     8.0402580027033714, -618.37898351179285},
+    {-50.265290699838808, 410.45144186849416, 806.39627023618755,
+     8.0214026320032161, -564.10489799777486},
+    {-50.265258741905825, 410.47718442321673, 804.6538015050902,
+     8.0040749977703332, -521.92251518388343},
+    {-50.265226783972849, 410.50287330500333, 803.03292918364605,
+     7.9879568895100901, -487.91992380540626},
+    {-50.265194826039874, 410.5285120248073, 801.51143245134892,
+     7.9728272736757209, -459.75485298910223},
+    {-50.265162868106891, 410.55410348716799, 800.07313224305699,
+     7.9585252149924015, -435.92788651101853},
+    {-50.265098952240933, 410.60515411533942, 797.39999018148501,
+     7.9319448961905907, -397.54853884586669},
+    {-50.265035036374975, 410.65604112052989, 794.94406409023031,
+     7.9075252162358804, -367.71989085979266},
+    {-50.264971120509017, 410.70677684631283, 792.66011007094085,
+     7.8848161294130454, -343.67556236057453},
+    {-50.264907204643059, 410.75737122368815, 790.51670128692012,
+     7.8635050301445562, -323.75919312769344},
+    {-50.264843288777101, 410.80783246831106, 788.49095586688168,
+     7.8433643106864341, -306.91046554526491},
+    {-50.264779372911143, 410.85816752431282, 786.56559973183801,
+     7.8242221446587754, -292.41495738460503},
+    {-50.264715457045185, 410.9083823621686, 784.72721256518184,
+     7.8059450394759295, -279.77139453862827},
+    {-50.264587625313268, 411.00847158981151, 781.27067428026703,
+     7.7715814571491562, -258.67879301297506},
+    {-50.264459793581352, 411.10813506592433, 778.05735385940227,
+     7.7396370820915328, -241.67644770212075},
+    {-50.264331961849436, 411.20740088109153, 775.04280534291752,
+     7.7096698105047334, -227.59308977397683},
+    {-50.26420413011752, 411.30629227401732, 772.19466769069913,
+     7.6813577480679962, -215.67893571281263},
+    {-50.264076298385604, 411.40482888686847, 769.48851079179508,
+     7.654457889804192, -205.42879706507506},
+    {-50.263948466653687, 411.50302760776935, 766.9053547813088,
+     7.6287814445187516, -196.48820946792759},
+    {-50.263820634921771, 411.60090316028624, 764.43010589577761,
+     7.6041782761403818, -188.6001434226971},
+    {-50.263692803189855, 411.69846852999638, 762.05052611377721,
+     7.5805266546732479, -181.57306975700828},
+    {-50.263437139726022, 411.89271380174887, 757.53968695662729,
+     7.5356932401057497, -169.55023161240683},
+    {-50.26318147626219, 412.08584288191986, 753.30997891612014,
+     7.4936559603960413, -159.5914651367072},
+    {-50.262925812798358, 412.27792150571679, 749.31563481123737,
+     7.4539595804870604, -151.16658294785759},
+    {-50.262670149334525, 412.46900523536675, 745.52210385243063,
+     7.4162604338112477, -143.91835636991686},
+    {-50.262414485870686, 412.65914184318262, 741.90254331422977,
+     7.3802915250200201, -137.59613695013377},
+    {-50.262158822406846, 412.84837297891664, 738.43560643213516,
+     7.3458405262821795, -132.01817441299204},
+    {-50.261903158943014, 413.03673537630891, 735.10398520899992,
+     7.3127352826690979, -127.04903504577732},
+    {-50.261647495479181, 413.22426175072832, 731.89341527397153,
+     7.2808339135700058, -122.58545347316357},
+    {-50.261391832015349, 413.41098148273511, 728.7919754242904,
+     7.2500178453083217, -118.54713171754936},
+    {-50.260880505087684, 413.7821049425603, 722.877613985479,
+     7.1912549752516313, -111.50477123483307},
+    {-50.260369178160012, 414.15029171723972, 717.29617247845977,
+     7.1358028622494825, -105.54704903559734},
+    {-50.25985785123234, 414.51569899291979, 711.99878552199266,
+     7.0831754800171494, -100.42136264474267},
+    {-50.259346524304675, 414.87846192101216, 706.94748907017743,
+     7.0329952333175294, -95.950474266003624},
+    {-50.25883519737701, 415.23869833447935, 702.11209191132934,
+     6.9849618395848969, -92.005865155193305},
+    {-50.258323870449338, 415.59651216057506, 697.46811480567976,
+     6.9388318301615097, -88.491767779259561},
+    {-50.257812543521666, 415.95199595987532, 692.99538308611204,
+     6.8944045513918866, -85.335161370221797},
+    {-50.257301216594001, 416.30523285985794, 688.67703601771461,
+     6.8515123111139777, -82.479265788583831},
+    {-50.256789889666337, 416.65629805694516, 684.49881132647749,
+     6.8100132621803429, -79.879174228924612},
+    {-50.256278562738665, 417.0052600035167, 680.44851687228572,
+     6.7697861474445533, -77.498840562344355},
+    {-50.255255908883328, 417.69711976914488, 672.691007481567,
+     6.6927428317269735, -73.285390061932489},
+    {-50.254233255027998, 418.38125693602177, 665.33539327848973,
+     6.6196950006387985, -69.660294148714101},
+    {-50.253210601172661, 419.05805395179692, 658.32797772828428,
+     6.550108638361527, -66.498224370487804},
+    {-50.252187947317324, 419.72784427315048, 651.62605769235131,
+     6.4835590678707744, -63.708302395150135},
+    {-50.251165293461995, 420.39092201944084, 645.19500873682739,
+     6.4197019608296673, -61.222808879621191},
+    {-50.250142639606658, 421.04754915487774, 639.00629462848349,
+     6.3582535398101054, -58.99010915352553},
+    {-50.249119985751321, 421.69796095802815, 633.0360662512137,
+     6.2989766430806942, -56.970052615363855},
+    {-50.248097331895984, 422.34237027073897, 627.26414969444113,
+     6.2416706601970446, -55.130884539857703},
+    {-50.247074678040647, 422.98097085589814, 621.67329902110794,
+     6.1861641001440848, -53.447115772169298},
+    {-50.246052024185317, 423.61394009092288, 616.24863371762672,
+     6.1323089963466488, -51.898017879656066},
+    {-50.245029370329981, 424.24144115703774, 610.97720792323253,
+     6.079976622364347, -50.466537714716075},
+    {-50.242984062619314, 425.48063102361846, 600.8500265243855,
+     5.979442082655047, -47.902011075646065},
+    {-50.24093875490864, 426.69962327240609, 591.21579610772824,
+     5.8838052269670742, -45.664912293833986},
+    {-50.238893447197967, 427.89936211398481, 582.01410757496626,
+     5.7924654350386335, -43.690978347843433},
+    {-50.2368481394873, 429.08068046209655, 573.19597893323476,
+     5.7049357211035874, -41.932322548701293},
+    {-50.234802831776634, 430.24432025175548, 564.72103991319852,
+     5.6208147347995299, -40.352432127399879},
+    {-50.23275752406596, 431.39094791261294, 556.55555024582475,
+     5.5397670531941747, -38.922915036653656},
+    {-50.230712216355286, 432.52116638929107, 548.67096837712518,
+     5.4615089470946829, -37.621316211763187},
+    {-50.22866690864462, 433.63552464083932, 541.04289454389288,
+     5.3857978704465337, -36.429611175109002},
+    {-50.226621600933953, 434.73452526101596, 533.65027506450531,
+     5.3124245475290159, -35.333141916474844},
+    {-50.224576293223279, 435.81863067208212, 526.47479302115562,
+     5.2412069137972201, -34.31984934929168},
+    {-50.222530985512606, 436.88826821817349, 519.50039459361869,
+     5.1719854057482273, -33.379709359148478},
+    {-50.220485677801939, 437.94383439766676, 512.71291586265011,
+     5.1046192499217051, -32.504311553443571},
+    {-50.216395062380599, 440.01420517375408, 499.64978335089108,
+     4.9749666690550791, -30.920327430463246},
+    {-50.212304446959259, 442.03242009793718, 487.1999135784784,
+     4.851399661343188, -29.52245295907499},
+    {-50.208213831537918, 444.00084127846077, 475.29399088827824,
+     4.7332294321703774, -28.276824543811429},
+    {-50.204123216116578, 445.92157332433396, 463.87488324688184,
+     4.6198883032974498, -27.157621623659988},
+    {-50.200032600695238, 447.79650712852498, 452.89483884620313,
+     4.5109018399315826, -26.144766207247784},
+    {-50.195941985273898, 449.62735388162349, 442.31346132468303,
+     4.4058687199698889, -25.222378659557204},
+    {-50.191851369852557, 451.41567195293891, 432.0962145488362,
+     4.3044458687608032, -24.377712463100462},
+    {-50.187760754431217, 453.16288845474446, 422.21329690764787,
+     4.2063372679002171, -23.600401729317788},
+    {-50.183670139009877, 454.87031677028034, 412.63877928002893,
+     4.1112853856345142, -22.881918430818533},
+    {-50.179579523588536, 456.53917096815661, 403.34993490033384,
+     4.0190645151851676, -22.21517360230456},
+    {-50.175488908167196, 458.17057778032728, 394.32671135528824,
+     3.9294755261577796, -21.594219451831954},
+    {-50.171398292745849, 459.7655866489759, 385.55130951589234,
+     3.8423416790801124, -21.01402353076708},
+    {-50.167307677324509, 461.32517822521226, 377.00784406704668,
+     3.7575052511483813, -20.470295228628533},
+    {-50.163217061903168, 462.85027161352122, 368.68206710124258,
+     3.6748247889113252, -19.959350843000838},
+    {-50.159126446481821, 464.34173059040933, 360.56114102153009,
+     3.5941728511384392, -19.478007481995704},
+    {-50.155035831060481, 465.80036897683806, 352.63345040997854,
+     3.5154341390341144, -19.023498789841792},
+    {-50.15094521563914, 467.22695530704357, 344.88844498816036,
+     3.4385039355211382, -18.5934073815862},
+    {-50.14276398479646, 469.98684348157866, 329.90884258050977,
+     3.2896954252515855, -17.798234022321864},
+    {-50.134582753953779, 472.62678083472065, 315.55469734143526,
+     3.1470761299648951, -17.078287602322675},
+    {-50.126401523111099, 475.15164399131567, 301.76878447853744,
+     3.0100782752119661, -16.42233739256239},
+    {-50.118220292268418, 477.56587658324878, 288.50217488723723,
+     2.8782164770098948, -15.821368420549936},
+    {-50.110039061425738, 479.87355030351353, 275.71264202510025,
+     2.751071912826959, -15.268049321320673},
+    {-50.10185783058305, 482.07841453576617, 263.3634418887072,
+     2.6282802004993271, -14.756348497332699},
+    {-50.093676599740363, 484.18393717038538, 251.42236454001227,
+     2.5095219756870013, -14.281252089714656},
+    {-50.085495368897682, 486.19333852354225, 239.86098676530523,
+     2.3945154679877159, -13.838553311371696},
+    {-50.077314138055002, 488.10961978972506, 228.65407606490183,
+     2.2830105807446039, -13.424692738909656},
+    {-50.069132907212321, 489.93558711120386, 217.77911012126054,
+     2.1747841182395438, -13.036635608135553},
+    {-50.06095167636964, 491.67387209660404, 207.21588551929187,
+     2.0696358996417596, -12.671776389567119},
+    {-50.05277044552696, 493.32694943517748, 196.9461962546184,
+     1.9673855662890563, -12.327863754223708},
+    {-50.044589214684279, 494.89715211516454, 186.95356739188372,
+     1.8678699368465101, -12.002940972741875},
+    {-50.036407983841599, 496.38668464977508, 177.22303273124058,
+     1.7709407996320572, -11.69529813126149},
+    {-50.028226752998918, 497.79763463428748, 167.74094790776451,
+     1.6764630569052636, -11.403433491421639},
+    {-50.020045522156238, 499.13198289573393, 158.49483225613821,
+     1.5843131548724139, -11.126021995876771},
+    {-50.011864291313557, 500.3916124482825, 149.4732342069793,
+     1.4943777474112372, -10.861889408399142},
+    {-50.00368306047087, 501.57831642920081, 140.66561607078097,
+     1.4065525523456948, -10.609990934680221},
+    {-49.995501829628182, 502.69380516000712, 132.06225490136367,
+     1.3207413674073909, -10.369393434284124},
+    {-49.987320598785502, 503.73971245306075, 123.65415677774452,
+     1.236855219448878, -10.139260531942824},
+    {-49.979139367942821, 504.71760126430451, 115.43298234881426,
+     1.1548116254964393, -9.9188400857427403},
+    {-49.970958137100141, 505.62896877680117, 107.39098188294814,
+     1.0745339481815681, -9.7074535835824971},
+    {-49.96277690625746, 506.47525098677175, 99.520938379957414,
+     0.99595083122264538, -9.5044871267785247},
+    {-49.95459567541478, 507.25782685307638, 91.8161175546538,
+     0.91899570313048518, -9.3093837274813023},
+    {-49.946414444572099, 507.97802206217716, 84.270223703830553,
+     0.84360633932340845, -9.1216366994860394},
+    {-49.938233213729418, 508.63711245323623, 76.877360632034453,
+     0.76972447446237158, -8.9407839636128479},
+    {-49.930051982886738, 509.23632714184765, 69.631996944832892,
+     0.69729545814111005, -8.7664031217539797},
+    {-49.921870752044057, 509.77685137566243, 62.528935127208108,
+     0.62626794814823572, -8.5981071798996318},
+    {-49.913689521201377, 510.25982915082426, 55.563283914252331,
+     0.5565936364076155, -8.4355408214532481},
+    {-49.905508290358689, 510.68636561437194, 48.730433535613322,
+     0.48822700344109726, -8.2783771490724707},
+    {-49.897327059516002, 511.05752927464101, 42.026033476391085,
+     0.42112509780597784, -8.1263148269721839},
+    {-49.889145828673321, 511.37435403894136, 35.445972448700331,
+     0.355247337471231, -7.9790755667893416},
+    {-49.880964597830641, 511.63784109552608, 28.986360311026008,
+     0.29055533052268445, -7.8364019092371153},
+    {-49.87278336698796, 511.84896065481956, 22.643511708691225,
+     0.22701271294675254, -7.6980552612816098},
+    {-49.86460213614528, 512.00865356316729, 16.413931239224038,
+     0.16458500154487443, -7.5638141547675586},
+    {-49.856420905302599, 512.11783280085069, 10.294299972431183,
+     0.10323946028921932, -7.4334726975597416},
+    {-49.848239674459919, 512.17738487488509, 4.281463176889412,
+     0.042944978647691832, -7.3068391925407337},
+    {-49.844149059038578, 512.1888208411691, 1.3141489747552351,
+     0.01318258009780319, -7.2448565917561245},
+    {-49.840058443617238, 512.18817111586452, -1.6275808765878255,
+     -0.016328039406585622, -7.1837349033807021},
+    {-49.831877212774558, 512.1510288872264, -7.4356911478141425,
+     -0.074607776825914754, -7.0639929489928113},
+    {-49.823695981931877, 512.06677271439935, -13.145593195953907,
+     -0.13192109634661628, -6.9474573111122195},
+    {-49.815514751089196, 511.93619534053829, -18.759887771668371,
+     -0.1882936256445909, -6.8339819415674947},
+    {-49.807333520246509, 511.76006871487624, -24.281058709999215,
+     -0.24374983555513013, -6.7234299576208647},
+    {-49.799152289403821, 511.53914491911206, -29.711480192277229,
+     -0.29831311203463184, -6.6156729152907827},
+    {-49.790971058561141, 511.27415703678031, -35.053423437729371,
+     -0.35200582246630263, -6.5105901518780245},
+    {-49.77460859687578, 510.61483120771987, -45.480481866366617,
+     -0.45686428430520404, -6.3080001967169919},
+    {-49.758246135190419, 509.7876057841757, -55.578567783090776,
+     -0.55848600081368283, -6.1148290960770302},
+    {-49.741883673505058, 508.79773888167972, -65.362717634777098,
+     -0.65701892256236027, -5.9303374315950652},
+    {-49.725521211819697, 507.65025222411168, -74.84681110185025,
+     -0.75259956334112044, -5.7538647793656779},
+    {-49.709158750134328, 506.34994905308338, -84.043692655735114,
+     -0.84535420402289552, -5.5848191775491722},
+    {-49.69279628844896, 504.90143018265297, -92.965277153805872,
+     -0.93539993819401501, -5.4226682611425607},
+    {-49.676433826763599, 503.30910843955519, -101.62264196239249,
+     -1.022845584254102, -5.266931760740948},
+    {-49.660071365078238, 501.57722169206198, -110.02610765165285,
+     -1.1077924842555198, -5.1171751240036363},
+    {-49.643708903392877, 499.70984464030374, -118.18530894943811,
+     -1.190335206213418, -4.973004066485295},
+    {-49.627346441707516, 497.71089951553415, -126.10925735454522,
+     -1.270562163772686, -4.8340598959202463},
+    {-49.610983980022148, 495.58416581506219, -133.8063965777757,
+     -1.3485561648168298, -4.7000154834705796},
+    {-49.59462151833678, 493.3332891818954, -141.28465179054007,
+     -1.4243948987321382, -4.5705717787322326},
+    {-49.578259056651419, 490.96178952350948, -148.55147350638441,
+     -1.4981513705093963, -4.44545478383555},
+    {-49.545534133280697, 485.87041611468334, -162.47847641375958,
+     -1.6396884124478501, -4.207214706530352},
+    {-49.512809209909967, 480.33595815443334, -175.63890843304509,
+     -1.7736714118605397, -3.9835120369048371},
+    {-49.480084286539238, 474.38273459568359, -188.07880564831851,
+     -1.9005505786848895, -3.7728262009154263},
+    {-49.447359363168516, 468.03363637671015, -199.83952429046784,
+     -2.0207299931098119, -3.5738515092550407},
+    {-49.414634439797787, 461.31026864469607, -210.95838770614637,
+     -2.1345739991576638, -3.385459604377782},
+    {-49.381909516427058, 454.23307369036502, -221.46922248939393,
+     -2.2424125014416609, -3.2066696303138547},
+    {-49.349184593056336, 446.82143783841599, -231.40280614998903,
+     -2.3445453866987349, -3.0366243157600246},
+    {-49.316459669685607, 439.09378489490012, -240.78724354154915,
+     -2.4412462406497415, -2.8745706331619956},
+    {-49.283734746314877, 431.06765825476407, -249.6482854432239,
+     -2.532765492796698, -2.7198440337542835},
+    {-49.251009822944155, 422.75979338364095, -258.0095998099344,
+     -2.6193330932448986, -2.5718555025085323},
+    {-49.218284899573426, 414.18618208143698, -265.89300401840552,
+     -2.7011608039668813, -2.4300808555866955},
+    {-49.185559976202697, 405.36212969129195, -273.31866475768459,
+     -2.7784441703004252, -2.2940518351579366},
+    {-49.152835052831975, 396.30230622210604, -280.30527091311717,
+     -2.8513642256019494, -2.1633486553792096},
+    {-49.120110129461246, 387.02079219505356, -286.87018377760552,
+     -2.9200889719254377, -2.0375937280744534},
+    {-49.087385206090516, 377.53111989633459, -293.02956812497587,
+     -2.9847746716871182, -1.9164463536074674},
+    {-49.054660282719787, 367.84631061336006, -298.79850704663045,
+     -3.0455669790040982, -1.7995982062256881},
+    {-49.021935359349058, 357.97890834533757, -304.19110294653245,
+     -3.1026019343860893, -1.6867694770756179},
+    {-48.956485512607607, 337.74429529039531, -313.89929651451621,
+     -3.2059010489394582, -1.4721742226079544},
+    {-48.891035665866156, 316.91918371400334, -322.25049774262135,
+     -3.2955990127204884, -1.2708775664569123},
+    {-48.825585819124697, 295.58953871033395, -329.33012322525195,
+     -3.3725158408263813, -1.0813826409924325},
+    {-48.760135972383246, 273.83604507083885, -335.21436503309695,
+     -3.4373813602873828, -0.90242215596953901},
+    {-48.694686125641795, 251.73466436366243, -339.97156860953731,
+     -3.4908487522883327, -0.73291492387090174},
+    {-48.629236278900336, 229.35711052704238, -343.6633555633299,
+     -3.5335055808026485, -0.57193204671206166},
+    {-48.563786432158885, 206.77125876790541, -346.34554689093778,
+     -3.5658828556826463, -0.41867032484674677},
+    {-48.498336585417434, 184.04149939695213, -348.0689284080579,
+     -3.588462542370122, -0.27243113253400331},
+    {-48.432886738675975, 161.22904584031346, -348.87989020411493,
+     -3.6016838319645075, -0.13260347957403049},
+    {-48.367436891934524, 138.39220423721167, -348.82096461482718,
+     -3.6059484131253869, 0.0013496874937974563},
+    {-48.301987045193073, 115.58661061643117, -347.9312817664902,
+     -3.6016249335762649, 0.1299026524670307},
+    {-48.236537198451614, 92.865440537661939, -346.24695765355386,
+     -3.589052798597951, 0.25347609999059162},
+    {-48.171087351710163, 70.279595210731799, -343.80142660112648,
+     -3.5685454232218081, 0.37244469822784265},
+    {-48.105637504968712, 47.877867411554774, -340.62572757728572,
+     -3.5403930312960026, 0.48714340880672069},
+    {-48.072912581597983, 36.760755660505453, -338.77317143704329,
+     -3.5235349102471853, 0.54298669226686813},
+    {-48.040187658227254, 25.707089957318519, -336.74875197156246,
+     -3.5048650763741511, 0.5978727691243173},
+    {-48.007462734856524, 14.722440032572509, -334.55578037366138,
+     -3.4844143109728671, 0.65183455692412506},
+    {-47.974737811485795, 3.8122690538833623, -332.1974590121095,
+     -3.462212345145709, 0.70490333919606452},
+    {-47.958375349800434, -1.613207870815742, -330.95726446637559,
+     -3.4504636786841525, 0.73111220822435874},
+    {-47.942012888115073, -7.018062900591759, -329.67688673778497,
+     -3.4382879115565106, 0.75710886906301067},
+    {-47.909287964744344, -17.763295536797397, -326.99706385726341,
+     -3.4126687929269077, 0.80847946491630385},
+    {-47.876563041373615, -28.41826519707417, -324.16089679905684,
+     -3.3853818675217546, 0.85904209886628002},
+    {-47.843838118002893, -38.977901860455042, -321.17120249548918,
+     -3.3564531518494274, 0.90882247860458054},
+    {-47.778388271261434, -59.79134726280077, -314.74207686740118,
+     -3.293770345291426, 1.0061334336985692},
+    {-47.712938424519983, -80.164838811491222, -307.73058304439098,
+     -3.2248127363944357, 1.100595451708938},
+    {-47.647488577778532, -100.06091161853796, -300.15642482979121,
+     -3.1497612338982317, 1.1923757448143306},
+    {-47.582038731037073, -119.44335417586541, -292.03821476715291,
+     -3.068786274774105, 1.2816273658116186},
+    {-47.516588884295622, -138.27713993611022, -283.39356422811636,
+     -2.9820487000675548, 1.3684907278480478},
+    {-47.451139037554171, -156.52836447152688, -274.23916399558186,
+     -2.8897005378368394, 1.453094928920206},
+    {-47.385689190812712, -174.16418762932545, -264.59085654562415,
+     -2.791885704987529, 1.5355589101285396},
+    {-47.320239344071254, -191.15278017463243, -254.46370105521888,
+     -2.6887406380701306, 1.6159924718190755},
+    {-47.254789497329803, -207.46327447449931, -243.87203201569125,
+     -2.580394861662346, 1.6944971677891152},
+    {-47.189339650588352, -223.06571882985551, -232.82951220844339,
+     -2.4669715017461629, 1.7711670944978302},
+    {-47.123889803846893, -237.93103510824011, -221.34918069576719,
+     -2.3485877504714994, 1.8460895895625444},
+    {-47.058439957105442, -252.0309793700535, -209.44349639182079,
+     -2.2253552878371239, 1.9193458516254247},
+    {-46.992990110363991, -265.33810521542216, -197.12437770448793,
+     -2.0973806650900202, 1.9910114918544266},
+    {-46.927540263622532, -277.82572960887092, -184.40323867562617,
+     -1.9647656540244085, 2.0611570258256231},
+    {-46.862090416881081, -289.46790096507675, -171.29102199309389,
+     -1.8276075658309718, 2.1298483132675226},
+    {-46.731190723398171, -310.11555828722624, -143.93494840033168,
+     -1.5400308249396251, 2.2631106321830581},
+    {-46.600291029915262, -327.08700542508768, -115.13535851596427,
+     -1.2353502088865993, 2.3912462149052613},
+    {-46.53484118317381, -334.13625107787834, -100.21737734116104,
+     -1.0767993915212706, 2.4535166699335633},
+    {-46.469391336432352, -340.19814743799049, -84.965605427630635,
+     -0.91421044029273701, 2.514649765163413},
+    {-46.403941489690901, -345.25112329505032, -69.388407280202657,
+     -0.74765639569235709, 2.5746878512623654},
+    {-46.33849164294945, -349.27414538830442, -53.493859652241575,
+     -0.57720760598366216, 2.6336708766951888},
+    {-46.273041796207991, -352.24670009592, -37.28976731707683,
+     -0.40293187857959956, 2.6916365636393573},
+    {-46.20759194946654, -354.14877611882554, -20.783677704542598,
+     -0.22489462042592487, 2.7486205683020417},
+    {-46.142142102725089, -354.96084808810042, -3.9828945019209732,
+     -0.043158968357536971, 2.8046566272513571},
+    {-46.07669225598363, -354.66386103112387, 13.10550969148886,
+     0.14221408970374763, 2.8597766911846341},
+    {-46.011242409242179, -353.23921563718397, 30.474681576040563,
+     0.33116560193035754, 2.9140110473923846},
+    {-45.945792562500728, -350.66875426829318, 48.117976157392206,
+     0.5236385474462828, 2.9673884320328887},
+    {-45.814892869017818, -342.01988230415628, 84.201334035977879,
+     0.9189297274655287, 3.0716800857151143},
+    {-45.683993175534908, -328.58032823292888, 121.30621571065517,
+     1.327666511600152, 3.1728542339178527},
+    {-45.553093482051999, -310.21945510460591, 159.38599461997529,
+     1.7494530276277906, 3.2710944375077484},
+    {-45.422193788569089, -286.81256351236016, 198.39654001166494,
+     2.1839163134123352, 3.3665675284136585},
+    {-45.291294095086187, -258.24057934764613, 238.29600051383505,
+     2.630704258676599, 3.4594255698003247},
+    {-45.160394401603277, -224.38976822678802, 279.04461243230645,
+     3.0894837847386012, 3.5498075400107667},
+    {-45.029494708120367, -185.15147358271653, 320.60452935602171,
+     3.5599392291004954, 3.637840785301627},
+    {-44.898595014637465, -140.42187582581425, 362.93967020066617,
+     4.0417709071112764, 3.7236422781217207},
+    {-44.767695321154555, -90.101770323253604, 406.01558326936475,
+     4.5346938272865023, 3.8073197110932964},
+    {-44.702245474413104, -62.815486815508102, 427.82097849363049,
+     4.7852291753275438, 3.8483932590554093},
+    {-44.636795627671646, -34.096362238122516, 449.7993242788703,
+     5.038436540458413, 3.8889724515740669},
+    {-44.571345780930187, -3.9332050974433819, 471.94672012062159,
+     5.2942839379391549, 3.9290685458172931},
+    {-44.505895934188736, 27.684923482475089, 494.25934660539588,
+     5.5527401058981214, 3.9686923774220668},
+    {-44.440446087447285, 60.768714972758858, 516.73346254654416,
+     5.8137744784306005, 4.0078543812920495},
+    {-44.374996240705826, 95.328618469705987, 539.36540225835267,
+     6.077357160016895, 4.0465646111362661},
+    {-44.244096547222924, 168.91737496409971, 585.08845230254008,
+     6.6120510753119266, 4.1226681667380811},
+    {-44.113196853740014, 248.53011867841406, 631.40058562734112,
+     7.1565951989467926, 4.1970765214594401},
+    {-44.047747006998563, 290.61916637208833, 654.76912637898101,
+     7.4324928159770289, 4.2336665720380253},
+    {-44.015022083627834, 312.23837187139702, 666.50507759161042,
+     7.5713363988010896, 4.2518116632622389},
+    {-43.998659621942465, 323.19213566067435, 672.38579681008571,
+     7.6409804592633748, 4.2608471607084937},
+    {-43.982297160257104, 334.24219152104666, 678.27494511053283,
+     7.7107721617986522, 4.2695949680878211},
+    {-43.982297140257103, 334.24220508568379, 678.14535924175573,
+     7.7092990059067157, -73657.77626520308},
+    {-43.982295142886294, 334.24355739670312, 676.43957518401101,
+     7.6899076433647471, -5194.8522328470926},
+    {-43.982293145515484, 334.24490769867811, 675.6829945374036,
+     7.6813070239642274, -3676.6516172373599},
+    {-43.982291148144668, 334.24625668860864, 675.1021836823902,
+     7.6747045919965498, -3002.4414091582607},
+    {-43.982289150773859, 334.24760461726316, 674.61250398192215,
+     7.6691381577401643, -2600.1608465176091},
+    {-43.98228715340305, 334.2489516297473, 674.18110288682738,
+     7.6642342465660507, -2325.494958287245},
+    {-43.982285156032233, 334.25029782401361, 673.79111547459354,
+     7.6598011345277062, -2122.6819493924995},
+    {-43.982283158661424, 334.2516432719886, 673.43251753608172,
+     7.6557248643362295, -1965.02208770895},
+    {-43.982281161290615, 334.25298802942325, 673.09877527442188,
+     7.6519311584368772, -1837.9163084106656},
+    {-43.982277166548997, 334.25567564436614, 672.48893296506401,
+     7.6449990347081185, -1643.5344869260448},
+    {-43.982273171807371, 334.25836094613612, 671.93770321942134,
+     7.6387332300292892, -1500.0254510886111},
+    {-43.982269177065746, 334.2610441383315, 671.43089303807403,
+     7.6329723954782569, -1388.478365737785},
+    {-43.982265182324127, 334.26372537871589, 670.95925314735803,
+     7.6276113834287846, -1298.5558290901527},
+    {-43.982257192840883, 334.26908248992157, 670.09752911132068,
+     7.6178165001089848, -1161.0491499526395},
+    {-43.98224920335764, 334.27443306439079, 669.31872755348229,
+     7.6089642944225098, -1059.5380228605839},
+    {-43.982241213874389, 334.27977767820511, 668.60276475937962,
+     7.6008264507046759, -980.63939252230387},
+    {-43.982233224391145, 334.28511677772326, 667.93655384017575,
+     7.5932541946251089, -917.03854744311445},
+    {-43.98221724542465, 334.29577980841674, 666.71949591189627,
+     7.5794211577777295, -819.7860849720854},
+    {-43.982201266458162, 334.30642437625318, 665.61973087085016,
+     7.5669215239855117, -747.99448422779506},
+    {-43.982185287491674, 334.31705211091258, 664.60884769544816,
+     7.5554323114142736, -692.19657624184447},
+    {-43.982169308525187, 334.32766427510802, 663.66833415076758,
+     7.544743069575321, -647.21828631339622},
+    {-43.982153329558699, 334.33826188476826, 662.7853311516235,
+     7.5347076140789042, -609.9615440052828},
+    {-43.982137350592211, 334.34884578035019, 661.95047583282781,
+     7.5252195062311449, -578.4430684288842},
+    {-43.982105392659228, 334.36997517121131, 660.3985116830595,
+     7.5075818425154601, -527.67429147944245},
+    {-43.982073434726246, 334.39105705753315, 658.97225646340075,
+     7.4913732459814666, -488.21626823534052},
+    {-43.98204147679327, 334.41209501110455, 657.64552662508743,
+     7.4762960579272812, -456.40974046653747},
+    {-43.982009518860295, 334.43309190561672, 656.40013468730433,
+     7.4621435203617503, -430.06371416126376},
+    {-43.981977560927312, 334.45405011840165, 655.22283827409683,
+     7.4487650920928958, -407.77561371585472},
+    {-43.981913645061354, 334.4958582546098, 653.03477415349801,
+     7.4239013270722705, -371.87499499007225},
+    {-43.981849729195396, 334.53753245912043, 651.02449931110368,
+     7.4010586562364384, -343.97282557182484},
+    {-43.981785813329438, 334.57908283503951, 649.15498212533817,
+     7.3798161002434854, -321.48139329124382},
+    {-43.98172189746348, 334.62051751080389, 647.40050007845377,
+     7.3598812432556295, -302.85131472646282},
+    {-43.981657981597522, 334.66184321086666, 645.74232460747783,
+     7.3410411776389211, -287.09075333770772},
+    {-43.981594065731564, 334.70306561894535, 644.16631706369265,
+     7.3231351744660547, -273.53142815322332},
+    {-43.981530149865605, 334.74418962183211, 642.66149305897511,
+     7.3060383627982857, -261.70444004821536},
+    {-43.981402318133689, 334.82615895083006, 639.8321069880808,
+     7.2738938876930233, -241.97408410324425},
+    {-43.981274486401766, 334.90777977534555, 637.20179355449056,
+     7.2440123779439602, -226.06981491500332},
+    {-43.981146654669843, 334.98907508739643, 634.73417417096164,
+     7.2159802830375579, -212.89601037346347},
+    {-43.981018822937926, 335.0700639077811, 632.40276162768691,
+     7.189496498178694, -201.75131190061853},
+    {-43.98089099120601, 335.15076231357142, 630.1875600972038,
+     7.1643337128300786, -192.16315872663534},
+    {-43.980763159474094, 335.23118412768002, 628.07303472264812,
+     7.1403153288320338, -183.79997961283709},
+    {-43.980635327742178, 335.31134140134583, 626.04683138226005,
+     7.1173009066033339, -176.42134532868641},
+    {-43.980507496010262, 335.39124476327237, 624.09893335124252,
+     7.0951765780312828, -169.84809661752161},
+    {-43.980251832546429, 335.55032665062532, 620.40638827124462,
+     7.0532382423982529, -158.60171741287363},
+    {-43.979996169082597, 335.70849482712816, 616.94395032328032,
+     7.013915462286743, -149.28610324739904},
+    {-43.979740505618764, 335.86580309741578, 613.67415935263614,
+     6.9767824036414483, -141.4053087836088},
+    {-43.979484842154932, 336.02229693960959, 610.56873572582901,
+     6.9415175952742239, -134.62517685033123},
+    {-43.979229178691099, 336.17801545581432, 607.60570879782165,
+     6.9078712854319413, -128.71124702295202},
+    {-43.978973515227267, 336.33299273686021, 604.76760632583353,
+     6.8756448592011701, -123.49350727424975},
+    {-43.978717851763435, 336.48725884982792, 602.04026176944751,
+     6.8446772800279261, -118.84527079481539},
+    {-43.978462188299602, 336.64084057277603, 599.41199977599081,
+     6.8148358304290984, -114.66994152966501},
+    {-43.978206524835763, 336.79376195423208, 596.87306286116154,
+     6.7860095945942014, -110.89240748013381},
+    {-43.977695197908091, 337.09770875582649, 592.03134757006887,
+     6.7310410982864601, -104.30482542495548},
+    {-43.977183870980426, 337.39925146837521, 587.46213568400844,
+     6.6791695599187939, -98.731832881700029},
+    {-43.976672544052761, 337.69851875304369, 583.1254308109277,
+     6.6299403419709995, -93.937141386365155},
+    {-43.976161217125096, 337.99562123551453, 578.99015926237678,
+     6.5830002351013279, -89.754959785148088},
+    {-43.975649890197431, 338.29065536624819, 575.03160939357201,
+     6.5380683495225815, -86.065069501673591},
+    {-43.975138563269759, 338.58370621380772, 571.22974479816173,
+     6.4949169401285465, -82.777887968830328},
+    {-43.974627236342087, 338.87484954305563, 567.56805235860463,
+     6.453358311694199, -79.825110312662929},
+    {-43.974115909414422, 339.1641533977841, 564.03273141071327,
+     6.4132356017413352, -77.153623408904039},
+    {-43.973604582486757, 339.45167933014386, 560.61210813277808,
+     6.3744161236676451, -74.721420646080986},
+    {-43.973093255559085, 339.73748337221053, 557.29620311132612,
+     6.3367864511200001, -72.494783837204736},
+    {-43.972070601703749, 340.30412684354098, 550.94522516168661,
+     6.2647177813402717, -68.553388095901894},
+    {-43.971047947848419, 340.86444789258383, 544.92322620926677,
+     6.1963866184809779, -65.16235165955716},
+    {-43.970025293993082, 341.41875958062911, 539.18625464086801,
+     6.1312934326936626, -62.204439963621411},
+    {-43.969002640137745, 341.96733486889582, 533.69935701484758,
+     6.0690409716918658, -59.594643689102838},
+    {-43.967979986282415, 342.51041452008252, 528.43419238047045,
+     6.0093071428950884, -57.269616847763217},
+    {-43.966957332427079, 343.04821297706474, 523.36740304359785,
+     5.9518264942295334, -55.18105934526892},
+    {-43.965934678571742, 343.58092283974736, 518.47946777353695,
+     5.8963771788779358, -53.291413496578713},
+    {-43.964912024716405, 344.10871834286013, 513.75387354734755,
+     5.8427715408428762, -51.570975276120457},
+    {-43.963889370861068, 344.63175810433665, 509.17650393525497,
+     5.7908491630489509, -49.995901591859976},
+    {-43.962866717005738, 345.15018732997748, 504.73517864856609,
+     5.7404716336812971, -48.546802623047796},
+    {-43.961844063150401, 345.66413960542195, 500.41930094974083,
+     5.691518538563777, -47.207726482451896},
+    {-43.959798755439735, 346.67909813957561, 492.12783271699811,
+     5.5974759513213259, -44.808737475921738},
+    {-43.957753447729061, 347.67752015642338, 484.23992325051228,
+     5.5080149151199285, -42.716034069029462},
+    {-43.955708140018388, 348.66017864915756, 476.70612433731799,
+     5.4225735917937889, -40.869503110968331},
+    {-43.953662832307714, 349.62775550797301, 469.48634119328727,
+     5.3406964396172674, -39.224350220525864},
+    {-43.95161752459704, 350.58085815109212, 462.54752801957977,
+     5.2620080223523074, -37.746420429778368},
+    {-43.949572216886374, 351.52003219026278, 455.86206591928135,
+     5.1861945739727737, -36.409155076107282},
+    {-43.947526909175707, 352.44577126989049, 449.40659135573156,
+     5.1129906841458803, -35.191549087090031},
+    {-43.945481601465033, 353.35852484272453, 443.1611310318691,
+     5.0421694663723429, -34.076741866071771},
+    {-43.94343629375436, 354.25870440740403, 437.10845057894522,
+     4.9735351561601826, -33.051021891471045},
+    {-43.941390986043686, 355.14668857839553, 431.23355581049498,
+     4.9069174431398856, -32.103108739300588},
+    {-43.939345678333012, 356.02282725520456, 425.52330501011335,
+     4.842167065086084, -31.223625550131725},
+    {-43.937300370622346, 356.8874450867815, 419.96610345631569,
+     4.7791523365545263, -30.40470498180235},
+    {-43.933209755201005, 358.58330754429369, 409.27078976664905,
+     4.6578748974538309, -28.922906778104199},
+    {-43.929119139779665, 360.23646801742387, 399.07763718261617,
+     4.5422904555948014, -27.61520429236494},
+    {-43.925028524358325, 361.84886071292726, 389.32990139295015,
+     4.4317546791921822, -26.449920345339144},
+    {-43.920937908936985, 363.42220903784693, 379.98081135316568,
+     4.3257365330061361, -25.402901448296348},
+    {-43.916847293515644, 364.95806143968645, 370.99127454794979,
+     4.2237922051695973, -24.455365887446341},
+    {-43.912756678094304, 366.4578192496615, 362.32821958665443,
+     4.1255462762532549, -23.592459224620423},
+    {-43.908666062672964, 367.92275868752398, 353.96337226834095,
+     4.03067781384103, -22.802257842769976},
+    {-43.904575447251624, 369.35404851412164, 345.87233411184883,
+     3.9389099039050159, -22.075065046189721},
+    {-43.900484831830283, 370.75276438004596, 338.03387671640638,
+     3.8500016345071555, -21.402903339221862},
+    {-43.896394216408943, 372.11990062553349, 330.42939320208973,
+     3.7637418642300657, -20.779141377244358},
+    {-43.892303600987603, 373.45638008594636, 323.04246599366849,
+     3.6799443124511679, -20.198215312039604},
+    {-43.888212985566263, 374.76306231649352, 315.85852213780026,
+     3.5984436441018715, -19.65541754295992},
+    {-43.884122370144922, 376.0407505496031, 308.86455541371475,
+     3.5190923132581577, -19.146734414352359},
+    {-43.880031754723582, 377.29019762557277, 302.04890006653415,
+     3.4417579931903686, -18.668719997283862},
+    {-43.875941139302242, 378.51211108349293, 295.40104490408629,
+     3.3663214649483422, -18.218396842133018},
+    {-43.871850523880902, 379.70715755946708, 288.91147929007906,
+     3.2926748682827385, -17.793177145228512},
+    {-43.867759908459561, 380.8759666088103, 282.57156458897845,
+     3.2207202416835363, -17.39079954575346},
+    {-43.859578677616881, 383.13722487643116, 270.30986164156741,
+     3.0815373721261512, -16.646860213126253},
+    {-43.851397446774193, 385.30029793307051, 258.56055287335346,
+     2.9481449614825643, -15.973295477715968},
+    {-43.843216215931506, 387.36918095314621, 247.27677913124805,
+     2.8200118567190557, -15.359599389328242},
+    {-43.835034985088825, 389.34751454478305, 236.41847306518287,
+     2.6966839783018801, -14.797338730270576},
+    {-43.826853754246144, 391.23863473611596, 225.95105490847166,
+     2.5777695129048648, -14.279655219764356},
+    {-43.818672523403464, 393.04561360879518, 215.84443368792756,
+     2.4629275746845765, -13.800906452335635},
+    {-43.810491292560783, 394.77129271615581, 206.07223073209789,
+     2.3518593908930883, -13.356402074685546},
+    {-43.802310061718103, 396.41831085497148, 196.61116783417779,
+     2.244301357133331, -12.942206717462371},
+    {-43.794128830875422, 397.98912736176061, 187.4405793010794,
+     2.140019499245426, -12.554990596140588},
+    {-43.785947600032742, 399.48604182074268, 178.54201853917823,
+     2.0388050085165306, -12.191914726717224},
+    {-43.777766369190061, 400.91121086457315, 169.8989377074019,
+     1.9404706064100778, -11.850541660404863},
+    {-43.769585138347381, 402.26666259732957, 161.4964245035284,
+     1.8448475578768766, -11.528765292376882},
+    {-43.7614039075047, 403.55430905584149, 153.3209841005376,
+     1.751783197182168, -11.224755107611189},
+    {-43.753222676662013, 404.77595703980688, 145.36035711179738,
+     1.6611388626846526, -10.936911480745994},
+    {-43.745041445819325, 405.93331757548515, 137.60336656497449,
+     1.5727881608639456, -10.663829529819482},
+    {-43.736860214976645, 407.028014227087, 130.03978842600259,
+     1.4866154976240564, -10.404269654313046},
+    {-43.728678984133964, 408.06159043026514, 122.66024138866236,
+     1.4025148282339728, -10.157133344101849},
+    {-43.720497753291284, 409.0355159909418, 115.45609253716128,
+     1.320388587392852, -9.9214431799085254},
+    {-43.712316522448603, 409.95119286784961, 108.41937617330848,
+     1.2401467686759331, -9.6963261931278399},
+    {-43.704135291605922, 410.80996033723653, 101.5427236298583,
+     1.1617061286344819, -9.4809999378728573},
+    {-43.695954060763242, 411.61309962217177, 94.819302305172101,
+     1.0849894955184769, -9.2747607678014514},
+    {-43.687772829920561, 412.36183805578844, 88.242762479973706,
+     1.0099251662874726, -9.0769739167687682},
+    {-43.679591599077881, 413.05735283717502, 81.807190735238464,
+     0.93644637850695345, -8.8870650642007654},
+    {-43.6714103682352, 413.70077442976077, 75.507068996304994,
+     0.86449084606648918, -8.7045131294930407},
+    {-43.66322913739252, 414.29318964485219, 69.337238394156842,
+     0.79400034953870935, -8.5288440892443909},
+    {-43.655047906549832, 414.83564444687528, 63.292867268747585,
+     0.72492037351826355, -8.3596256500418349},
+    {-43.646866675707145, 415.32914651182182, 57.369422748400339,
+     0.65719978451890637, -8.1964626403119762},
+    {-43.638685444864464, 415.77466756616394, 51.562645428401829,
+     0.59079054401797848, -8.0389930092716408},
+    {-43.630504214021784, 416.17314552987631, 45.868526745392039,
+     0.52564745207151431, -7.886884340661422},
+    {-43.622322983179103, 416.52548648420452, 40.283288704791701,
+     0.46172791761141485, -7.7398308047725592},
+    {-43.614141752336423, 416.83256648219424, 34.803365668756896,
+     0.39899175210632765, -7.5975504850966971},
+    {-43.605960521493742, 417.09523321776533, 29.425387954293118,
+     0.33740098374612226, -7.4597830263702907},
+    {-43.597779290651062, 417.31430756729299, 24.146167026283074,
+     0.27691968970838021, -7.3262875593238084},
+    {-43.589598059808381, 417.49058501589167, 18.962682099838048,
+     0.21751384440181976, -7.1968408644671147},
+    {-43.5814168289657, 417.62483697933834, 13.872067991316856,
+     0.15915118186447996, -7.0712357430366843},
+    {-43.57323559812302, 417.71781203119963, 8.8716040786609245,
+     0.10180107073621912, -6.949279568038321},
+    {-43.565054367280339, 417.77023704377223, 3.9587042496077101,
+     0.045434400428304142, -6.8307929923164163},
+    {-43.560963751858992, 417.78146476192057, 1.5343172131723433,
+     0.017611148618203669, -6.7727981027216826},
+    {-43.556873136437652, 417.78281825046241, -0.86909226815643303,
+     -0.0099765227112846959, -6.7156087939271751},
+    {-43.548691905594964, 417.75624223642632, -5.6141292877249178,
+     -0.064458070289404451, -6.6035708418957517},
+    {-43.540510674752284, 417.69117686359925, -10.278641336072909,
+     -0.11803537874020799, -6.4945331677986591},
+    {-43.532329443909603, 417.5882721355913, -14.86476069121974,
+     -0.17073242899133895, -6.388359130607892},
+    {-43.524148213066923, 417.44816100739718, -19.374523846738267,
+     -0.22257211964140866, -6.284920663923252},
+    {-43.515966982224242, 417.2714601443638, -23.809877459579788,
+     -0.27357633428329697, -6.1840975961558771},
+    {-43.507785751381562, 417.05877063443739, -28.172683830838,
+     -0.32376600353585444, -6.0857770354521445},
+    {-43.491423289696201, 416.52775611399011, -36.687712236574527,
+     -0.42178100256914813, -5.8962249728210532},
+    {-43.475060828010839, 415.859639059335, -44.933003233590121,
+     -0.51676757177346988, -5.7154869905639281},
+    {-43.458698366325471, 415.05873078745998, -52.920888018843762,
+     -0.60886416308144875, -5.5428712790506642},
+    {-43.442335904640103, 414.12914874671435, -60.662749961678607,
+     -0.69819852798476223, -5.3777599325603536},
+    {-43.425973442954742, 413.07483119157172, -68.169124174941658,
+     -0.78488884382165935, -5.2195990959338481},
+    {-43.409610981269381, 411.89955033820956, -75.449784012919608,
+     -0.86904469203231394, -5.0678906708718419},
+    {-43.39324851958402, 410.60692419754514, -82.513816535603837,
+     -0.95076791149162432, -4.9221852982627441},
+    {-43.376886057898659, 409.20042725212147, -89.369688613057946,
+     -1.0301533458829772, -4.7820763908165631},
+    {-43.360523596213291, 407.68340011835585, -96.025305051510102,
+     -1.1072895007648855, -4.6471950351362921},
+    {-43.344161134527923, 406.05905831502236, -102.48805988798978,
+     -1.1822591233210864, -4.517205617371002},
+    {-43.327798672842562, 404.33050024166266, -108.76488181044091,
+     -1.2551397156326531, -4.3918020541183322},
+    {-43.311436211157201, 402.50071445632028, -114.86227450568431,
+     -1.3260039905591416, -4.2707045320268318},
+    {-43.295073749471833, 400.57258632990312, -120.78635261114566,
+     -1.3949202778828753, -4.1536566768954524},
+    {-43.262348826101103, 396.43236469259801, -132.13726778227951,
+     -1.5271624330133255, -3.9307871762774034},
+    {-43.229623902730381, 391.93107424072122, -142.85990408311832,
+     -1.652338040281855, -3.7215250057249447},
+    {-43.196898979359652, 387.0886456534717, -152.99205661198397,
+     -1.7708685140232712, -3.5244473500002651},
+    {-43.164174055988923, 381.92383713375636, -162.56768383532574,
+     -1.8831321042359881, -3.338332445915599},
+    {-43.131449132618201, 376.45435100993416, -171.61743774128112,
+     -1.9894698786215284, -3.1621244483945525},
+    {-43.098724209247472, 370.69693453101081, -180.16910319046414,
+     -2.0901906784494351, -2.9949055216316776},
+    {-43.065999285876742, 364.66746751357357, -188.24796479096264,
+     -2.1855752555670702, -2.8358734624845137},
+    {-43.03327436250602, 358.38103897157123, -195.87711540569759,
+     -2.2758797501168209, -2.6843236050138639},
+    {-43.000549439135291, 351.85201445206843, -203.07771726400654,
+     -2.3613386330266652, -2.5396340705935385},
+    {-42.967824515764562, 345.09409548157367, -209.86922429118007,
+     -2.4421672106552741, -2.4012536562684015},
+    {-42.93509959239384, 338.12037227608658, -216.26957247789281,
+     -2.5185637687003992, -2.2686918211657869},
+    {-42.902374669023111, 330.9433706684564, -222.29534373644074,
+     -2.590711416924727, -2.1415103545039864},
+    {-42.869649745652382, 323.57509404636573, -227.96190762600477,
+     -2.6587796842114799, -2.0193164013055025},
+    {-42.836924822281659, 316.02706096511872, -233.28354449770717,
+     -2.7229259040598142, -1.901756591839163},
+    {-42.80419989891093, 308.31033899424864, -238.27355295561514,
+     -2.7832964232287583, -1.788512074105548},
+    {-42.771474975540201, 300.4355752711059, -242.94434401074741,
+     -2.8400276603703802, -1.6792942896415077},
+    {-42.738750052169479, 292.4130241637348, -247.30752389056508,
+     -2.8932470368071912, -1.5738413646553768},
+    {-42.673300205428021, 275.96376186583103, -255.15388132509929,
+     -2.9896197399403839, -1.3732978692011051},
+    {-42.607850358686569, 259.03763176777306, -261.89195702891715,
+     -3.0732829141135558, -1.1852127895689661},
+    {-42.542400511945118, 241.70482347387099, -267.59210853163864,
+     -3.1450048106300881, -1.0081851085815909},
+    {-42.47695066520366, 224.03117637456529, -272.3171197888758,
+     -3.2054692665586395, -0.84102864885685791},
+    {-42.411500818462208, 206.0786370602471, -276.12333139415415,
+     -3.2552883777453414, -0.68273139256933701},
+    {-42.346050971720757, 187.90564989325833, -279.06156163832605,
+     -3.2950128197867494, -0.53242384117338126},
+    {-42.280601124979299, 169.56749286548558, -281.17786393398529,
+     -3.3251403297559308, -0.38935413263610996},
+    {-42.21515127823784, 151.11656827884798, -282.51415485136852,
+     -3.3461227343392967, -0.25286827389680916},
+    {-42.149701431496389, 132.60265582575812, -283.10873884497556,
+     -3.3583718179486604, -0.12239429026257487},
+    {-42.084251584754938, 114.0731341460412, -282.99674975196035,
+     -3.3622642567615033, 0.0025705938745007148},
+    {-42.01880173801348, 95.573175775400927, -282.21052468344078,
+     -3.358145794387696, 0.12247040530482284},
+    {-41.953351891272028, 77.145919493037908, -280.77992257575926,
+     -3.3463347970793804, 0.23769900399629904},
+    {-41.887902044530577, 58.832623360264854, -278.73259711950243,
+     -3.327125297695559, 0.34860717926083928},
+    {-41.822452197789119, 40.672801172775785, -276.09423182753716,
+     -3.3007896156090588, 0.45550855494682163},
+    {-41.789727274418397, 31.662344240169784, -274.56094725275619,
+     -3.2850291825286546, 0.5075457712466902},
+    {-41.757002351047667, 22.704344592934902, -272.88874348793934,
+     -3.2675806226915696, 0.55868453298671106},
+    {-41.724277427676938, 13.803303225464871, -271.08036309233836,
+     -3.248472829304442, 0.60895566314026672},
+    {-41.691552504306216, 4.9636328598392918, -269.13845906394465,
+     -3.2277337121968057, 0.65838845513347488},
+    {-41.675190042620855, 0.56816734780467404, -268.11824133814616,
+     -3.2167608721633179, 0.68279923429859291},
+    {-41.658827580935487, -3.8103391953985666, -267.06559919774458,
+     -3.2053902462675521, 0.70701076981353084},
+    {-41.626102657564758, -12.514368324517395, -264.86427017103955,
+     -3.181468516881504, 0.75484912499293932},
+    {-41.593377734194036, -21.144290013415912, -262.53688137651875,
+     -3.155993762447987, 0.80192877823274411},
+    {-41.560652810823306, -29.696017380014517, -260.08576852194119,
+     -3.1289904143927347, 0.84827380346020342},
+    {-41.495202964081855, -46.548915752988563, -254.82136513960697,
+     -3.0704918513132675, 0.93885076819832891},
+    {-41.429753117340397, -63.041834156614399, -249.08839566349758,
+     -3.0061535119218679, 1.0267515102568996},
+    {-41.364303270598946, -79.144645302302763, -242.90321369003968,
+     -2.9361453534102098, 1.1121326271383549},
+    {-41.298853423857494, -94.828262393833299, -236.28127377546605,
+     -2.8606275257870868, 1.1951374607066019},
+    {-41.233403577116036, -110.06458275370835, -229.23720547328202,
+     -2.7797511918286739, 1.2758975196404221},
+    {-41.167953730374578, -124.82643603404868, -221.78487956797977,
+     -2.6936592600708043, 1.3545337191708728},
+    {-41.102503883633126, -139.08753653446854, -213.93746749251864,
+     -2.6024870418868544, 1.4311574652308867},
+    {-41.037054036891675, -152.82243920907931, -205.70749477242128,
+     -2.5063628420730866, 1.5058716056001236},
+    {-40.971604190150217, -166.00649899589973, -197.10688921861876,
+     -2.4054084910105162, 1.5787712669271501},
+    {-40.906154343408765, -178.61583314582975, -188.14702448999171,
+     -2.299739825338873, 1.6499445934830446},
+    {-40.840704496667314, -190.62728626607708, -178.83875956139283,
+     -2.1894671231245098, 1.719473401011447},
+    {-40.775254649925856, -202.01839782557968, -169.19247456102116,
+     -2.0746954986990964, 1.7874337569845122},
+    {-40.709804803184404, -212.76737189831738, -159.21810337998951,
+     -1.955525261662949, 1.8538964968703804},
+    {-40.644354956442953, -222.85304894497477, -148.92516340499915,
+     -1.8320522439659421, 1.918927684598889},
+    {-40.578905109701495, -232.25487945493163, -138.32278268072207,
+     -1.7043680984834191, 1.9825890242262283},
+    {-40.448005416218585, -248.9277065824437, -116.22441155112088,
+     -1.4367137557853218, 2.1060293516256694},
+    {-40.317105722735675, -262.63275875098515, -92.989122207272601,
+     -1.15322169759366, 2.2246370255203667},
+    {-40.251655875994224, -268.32682271243556, -80.964461626236627,
+     -1.0057283342040495, 2.2822459239027921},
+    {-40.186206029252773, -273.22527513375303, -68.678210955241923,
+     -0.85449981151802368, 2.3387818977494947},
+    {-40.120756182511315, -277.31122527448997, -56.137366529595816,
+     -0.69960504077022057, 2.3942846343508295},
+    {-40.055306335769863, -280.56823243473343, -43.348686487277618,
+     -0.54111041024003759, 2.4487915710077188},
+    {-39.989856489028412, -282.98029079558364, -30.318703760304473,
+     -0.37907992703878157, 2.5023380597401181},
+    {-39.924406642286954, -284.53181507893595, -17.053738132827277,
+     -0.21357534860348276, 2.5549575173933476},
+    {-39.858956795545495, -285.20762696813432, -3.5599074475401205,
+     -0.044656304802462417, 2.6066815626517807},
+    {-39.793506948804044, -284.99294223625799, 10.156861966344673,
+     0.12761958853503269, 2.6575401412919422},
+    {-39.728057102062593, -283.87335853324566, 24.09082557765807,
+     0.30319662393466668, 2.7075616408529242},
+    {-39.662607255321134, -281.83484378721323, 38.236411590987714,
+     0.4820209037803222, 2.7567729957676765},
+    {-39.531707561838232, -274.94667865232901, 67.140977095818528,
+     0.84920411028023468, 2.8528663151848654},
+    {-39.400807868355322, -264.22318996854619, 96.829130682323623,
+     1.2287708795952346, 2.9460099916910529},
+    {-39.269908174872413, -249.56439245996472, 127.26172033539142,
+     1.6203465484141648, 3.0363760964420403},
+    {-39.13900848138951, -230.87528805801227, 158.40166752822165,
+     2.0235779299767036, 3.124121025883738},
+    {-39.0081087879066, -208.06560640924968, 190.2137886486932,
+     2.4381313854885449, 3.2093873374679154},
+    {-38.877209094423691, -181.04956739258915, 222.66463678338374,
+     2.8636911183951397, 3.292305326735578},
+    {-38.746309400940781, -149.74566317045631, 255.72236104844592,
+     3.2999576605125243, 3.3729943879174678},
+    {-38.615409707457871, -114.07645763595973, 289.35658110691014,
+     3.7466465240044586, 3.4515641924560723},
+    {-38.54995986071642, -94.581735634954512, 306.38075743008812,
+     3.9738142210402065, 3.4900862421689993},
+    {-38.484510013974969, -73.968401402153987, 323.53827488084846,
+     4.2034869972797013, 3.5281157136843091},
+    {-38.419060167233511, -52.22784049988995, 340.82570139702904,
+     4.4356329893737128, 3.5656640162291535},
+    {-38.353610320492059, -29.351660719659591, 358.23967777058016,
+     4.6702210662443848, 3.6027421209521178},
+    {-38.288160473750608, -5.3316874002280521, 375.77691502873785,
+     4.9072208011450558, 3.6393605830472859},
+    {-38.22271062700915, 19.840041087081978, 393.43419194433756,
+     5.146602445122336, 3.675529562507887},
+    {-38.157260780267691, 46.171277694185243, 411.20835266742432,
+     5.388336901794494, 3.711258843609377},
+    {-38.09181093352624, 73.669570900781139, 429.09630447084635,
+     5.632395703365999, 3.7465578532133739},
+    {-37.96091124004333, 132.19652289630852, 465.20151324170786,
+     6.1273754771063924, 3.815901080541471},
+    {-37.830011546560428, 195.4773463886265, 501.72625977689989,
+     6.63132575520609, 3.8836281401542365},
+    {-37.764561699818969, 228.9172699922344, 520.13884055559151,
+     6.8865997266173071, 3.9169058352582153},
+    {-37.731836776448247, 246.08994055381663, 529.3814687552466,
+     7.0150503392095667, 3.9334015973771113},
+    {-37.715474314762886, 254.78979761813596, 534.01171815889745,
+     7.0794776926598315, 3.9416141152727602},
+    {-37.699111853077518, 263.56546529220503, 538.64786812917953,
+     7.1440392313275103, 3.9494565459893534},
+    {-37.699111833077517, 263.56547606447907, 538.54503391023775,
+     7.1426753539285484, -68193.853952690784},
+    {-37.699109835706707, 263.5665499953729, 537.19138718590307,
+     7.1247224341236608, -4809.5018983976897},
+    {-37.699107838335891, 263.56762233196156, 536.59099041255763,
+     7.1167598012346458, -3403.9212418078955},
+    {-37.699105840965082, 263.56869362734835, 536.13007754105922,
+     7.1106471305014711, -2779.7238747888027},
+    {-37.699103843594273, 263.56976408054209, 535.74148272054867,
+     7.1054936072648891, -2407.2844371995561},
+    {-37.699101846223456, 263.57083380669332, 535.39913547875631,
+     7.1009534612081273, -2152.9932299223465},
+    {-37.699099848852647, 263.57190288352569, 535.08965248904451,
+     7.0968491904897526, -1965.2248644262918},
+    {-37.699097851481838, 263.5729713681244, 534.80507893678976,
+     7.0930752911341646, -1819.2601903477373},
+    {-37.699095854111022, 263.57403930473333, 534.54022985971653,
+     7.0895629954667188, -1701.5830995405699},
+    {-37.699091859369403, 263.57617367020879, 534.05627427940192,
+     7.0831450830648084, -1521.620493216338},
+    {-37.699087864627778, 263.57830620000931, 533.61883130275555,
+     7.0773440622609636, -1388.7569351618424},
+    {-37.699083869886152, 263.58043705569895, 533.2166379312298,
+     7.0720105529827038, -1285.4843939379227},
+    {-37.699079875144534, 263.58256636247245, 532.84235430985859,
+     7.0670472074461435, -1202.2322950950827},
+    {-37.69907188566129, 263.58682071483719, 532.15850648136552,
+     7.0579788820181824, -1074.9258349100596},
+    {-37.699063896178046, 263.59106987976804, 531.54046265838713,
+     7.0497833065859625, -980.94478147656412},
+    {-37.699055906694802, 263.59531431441212, 530.97228520430463,
+     7.0422491019199729, -907.89883307355376},
+    {-37.699047917211558, 263.59955437299357, 530.44358888252418,
+     7.0352385297288818, -849.01588238504803},
+    {-37.699031938245071, 263.60802245272663, 529.47774451962425,
+     7.0224315757890521, -758.977579771107},
+    {-37.699015959278576, 263.61647588051375, 528.60497921326009,
+     7.0108591134612697, -692.51145638884975},
+    {-37.698999980312081, 263.62491594959511, 527.8027471025456,
+     7.000222119660803, -640.85261657034482},
+    {-37.698984001345593, 263.63334366200399, 527.05635761002293,
+     6.990325755081499, -599.21079770990355},
+    {-37.698968022379105, 263.64175982394892, 526.35560627274481,
+     6.9810346792554929, -564.71774369027776},
+    {-37.698952043412618, 263.65016510238416, 525.69306308984949,
+     6.9722503490877168, -535.53729306489129},
+    {-37.698920085479635, 263.6669451846152, 524.46141585283772,
+     6.9559209476512658, -488.53451584487152},
+    {-37.698888127546653, 263.68368756689415, 523.3295264719336,
+     6.9409146060402733, -452.00346362306067},
+    {-37.698856169613677, 263.70039508365693, 522.27661670806128,
+     6.926955745795687, -422.55632119757837},
+    {-37.698824211680702, 263.71707001535714, 521.28825368594983,
+     6.9138529461673839, -398.16462199691398},
+    {-37.698792253747719, 263.73371424856236, 520.35392877139395,
+     6.9014668330610043, -377.52983314059151},
+    {-37.698728337881761, 263.76691677421127, 518.61743008394558,
+     6.8784472706312778, -344.29228625966113},
+    {-37.698664422015803, 263.80001300818907, 517.02201862280731,
+     6.8572988798095116, -318.4598671754851},
+    {-37.698600506149845, 263.83301096797192, 515.53830751401983,
+     6.8376319093054807, -297.63681939156737},
+    {-37.698536590283886, 263.86591710400069, 514.14588434851419,
+     6.8191756345394321, -280.38869221089277},
+    {-37.698472674417928, 263.89873675257013, 512.82988684834129,
+     6.8017329412438787, -265.79722314845623},
+    {-37.69840875855197, 263.93147442409776, 511.57909511408275,
+     6.7851550232611588, -253.24370403701317},
+    {-37.698344842686012, 263.96413399657837, 510.38479234626061,
+     6.7693262724939256, -242.29401847794375},
+    {-37.698217010954096, 264.02923196906602, 508.13923705004908,
+     6.7395659176984068, -224.02721656085612},
+    {-37.69808917922218, 264.09405334824191, 506.05165980295533,
+     6.7119006668628796, -209.30268564427232},
+    {-37.697961347490264, 264.15861637989343, 504.0931918805029,
+     6.6859476462652649, -197.10607621220637},
+    {-37.697833515758347, 264.2229361584042, 502.24281398281249,
+     6.6614280867475619, -186.78805599912116},
+    {-37.697705684026431, 264.28702544210262, 500.48465812882051,
+     6.6381315394067846, -177.91111844787082},
+    {-37.697577852294515, 264.35089520050076, 498.80639639826825,
+     6.6158945059106458, -170.16828800879881},
+    {-37.697450020562599, 264.41455499717858, 497.19822498523632,
+     6.5945869642911212, -163.33697028288509},
+    {-37.697322188830682, 264.47801326682935, 495.65219495688984,
+     6.5741034930028315, -157.25129587955877},
+    {-37.69706652536685, 264.60435450711651, 492.72143080873082,
+     6.5352755031637821, -146.83911774990725},
+    {-37.696810861903018, 264.72997053378378, 489.97327558783633,
+     6.4988690606054815, -138.21448414248766},
+    {-37.696555198439185, 264.85490404530742, 487.3780021072547,
+     6.4644899187954774, -130.91823833498188},
+    {-37.696299534975353, 264.97919113249912, 484.91316852213993,
+     6.4318404525652202, -124.64101047894859},
+    {-37.696043871511513, 265.10286282636088, 482.56133958514289,
+     6.4006894361378173, -119.16573207211447},
+    {-37.695788208047674, 265.22594618108525, 480.30864982963578,
+     6.3708529873251818, -114.33500230140089},
+    {-37.695532544583841, 265.34846505774397, 478.1438570850637,
+     6.3421820147990484, -110.03153176026714},
+    {-37.695276881120009, 265.47044070732085, 476.05769610657973,
+     6.3145536456454199, -106.16588970488658},
+    {-37.695021217656176, 265.59189221472104, 474.04242360860229,
+     6.287865191419006, -102.66853579137384},
+    {-37.694509890728511, 265.83329030938182, 470.19929511322522,
+     6.236973188884428, -96.569549520585625},
+    {-37.693998563800839, 266.07278013952276, 466.57242775906491,
+     6.188948447182443, -91.409894686843302},
+    {-37.693487236873167, 266.31046381212445, 463.13008128052286,
+     6.1433700518357961, -86.970810082848004},
+    {-37.692975909945503, 266.54642912157999, 459.84759621515826,
+     6.0999109928837552, -83.098802461500838},
+    {-37.692464583017838, 266.78075261310784, 456.70536184421348,
+     6.0583112154727594, -79.682570678820625},
+    {-37.691953256090166, 267.01350179943785, 453.68747759581606,
+     6.018359867334687, -76.639177094026294},
+    {-37.691441929162494, 267.24473681002758, 450.78083889183796,
+     5.9798831753244936, -73.905383434950721},
+    {-37.690930602234829, 267.47451164698907, 447.97449369246152,
+     5.9427359119901846, -71.43201629726579},
+    {-37.690419275307164, 267.70287516074842, 445.25917777170872,
+     5.906795232487899, -69.180184941172627},
+    {-37.689907948379492, 267.92987182103951, 442.62697154954168,
+     5.8719561235831144, -67.11867224226107},
+    {-37.688885294524155, 268.37992415182276, 437.58544352174192,
+     5.8052319682869342, -63.469557868410334},
+    {-37.687862640668826, 268.82495759583912, 432.80501478927374,
+     5.7419681624799219, -60.329982117889209},
+    {-37.686839986813489, 269.26522062058712, 428.25080534143945,
+     5.6817022267094179, -57.591406217393605},
+    {-37.685817332958152, 269.70092987007001, 423.89507598336064,
+     5.624066372744462, -55.175126308180829},
+    {-37.684794679102822, 270.13227643534418, 419.71533511056515,
+     5.5687623972024447, -53.022494977454699},
+    {-37.683772025247485, 270.55943051980131, 415.69304578045723,
+     5.5155445360134063, -51.088794677898512},
+    {-37.682749371392148, 270.98254499195571, 411.81271563782934,
+     5.4642073960567723, -49.339253457995156},
+    {-37.681726717536812, 271.40175814538856, 408.06123962463795,
+     5.4145772390351885, -47.746370487017799},
+    {-37.680704063681475, 271.81719587985719, 404.42741461150257,
+     5.3665055452255963, -46.288071140121104},
+    {-37.679681409826145, 272.22897345091798, 400.90157398895008,
+     5.3198641680181851, -44.946403749478087},
+    {-37.678658755970808, 272.63719689202037, 397.47530785600253,
+     5.2745416235525635, -43.706599578891435},
+    {-37.676613448260142, 273.4433662263848, 390.89288404192263,
+     5.1874737173329146, -41.485451292469151},
+    {-37.674568140549468, 274.23640752190244, 384.63079779101184,
+     5.1046477341969894, -39.547874399517511},
+    {-37.672522832838794, 275.0169343734824, 378.64980461763491,
+     5.0255435015301035, -37.83821419787219},
+    {-37.670477525128128, 275.78548807196097, 372.918083057449,
+     4.9497392594597933, -36.314998549981098},
+    {-37.668432217417461, 276.54255080277841, 367.40940585916894,
+     4.8768874124960657, -34.946605606308339},
+    {-37.666386909706787, 277.28855569758605, 362.10185269262695,
+     4.8066974615942231, -33.70844641057279},
+    {-37.664341601996114, 278.02389464283107, 356.97688040463601,
+     4.7389236771593684, -32.581073695532325},
+    {-37.662296294285447, 278.74892445080138, 352.01863644988873,
+     4.6733559963960696, -31.548877283577976},
+    {-37.660250986574781, 279.46397180996524, 347.213442001109,
+     4.6098131704550314, -30.599162515020858},
+    {-37.658205678864107, 280.16933730867066, 342.54939613558338,
+     4.5481375169162837, -29.721485522663411},
+    {-37.656160371153433, 280.86529874402072, 338.01606813875196,
+     4.4881908405840782, -28.907164825330614},
+    {-37.654115063442767, 281.5521138713932, 333.60425507175626,
+     4.4298512195768271, -28.148916506382367},
+    {-37.650024448021426, 282.89924949698081, 325.11337833493656,
+     4.3175719418692413, -26.776893814300283},
+    {-37.645933832600086, 284.21248466931007, 317.02122216484571,
+     4.2105639293547847, -25.566059941244227},
+    {-37.641843217178746, 285.49335519756863, 309.28274563122039,
+     4.1082306178098085, -24.487086670944489},
+    {-37.637752601757406, 286.74322956658182, 301.86082337795318,
+     4.0100803383762411, -23.517611520015162},
+    {-37.633661986336065, 287.96333738257556, 294.72442440890137,
+     3.9157021779585142, -22.640245416970767},
+    {-37.629571370914725, 289.15479147217007, 287.84729668093848,
+     3.8247485447499172, -21.841235330959975},
+    {-37.625480755493385, 290.31860534765445, 281.20699571399763,
+     3.7369222939821296, -21.109541715871714},
+    {-37.621390140072045, 291.45570721801835, 274.78415324986378,
+     3.6519670355984561, -20.436186812009609},
+    {-37.617299524650704, 292.5669513777886, 268.5619172040341,
+     3.5696597123890412, -19.813784576966366},
+    {-37.613208909229364, 293.6531275729497, 262.52551628430535,
+     3.4898048305031479, -19.236195301160134},
+    {-37.609118293808024, 294.71496878394464, 256.66191694601775,
+     3.4122299137796412, -18.698267617317775},
+    {-37.605027678386676, 295.75315775403055, 250.95954981919272,
+     3.3367818788155104, -18.195642916910938},
+    {-37.600937062965336, 296.76833251175975, 245.40808914748419,
+     3.2633241125950079, -17.724605083019359},
+    {-37.596846447543996, 297.76109107851801, 239.99827319854347,
+     3.1917340930893592, -17.281963631535827},
+    {-37.592755832122648, 298.73199550959396, 234.72175670996947,
+     3.1219014343902129, -16.864961823142878},
+    {-37.588665216701308, 299.68157538541084, 229.57098865092598,
+     3.053726267312673, -16.471203675508008},
+    {-37.584574601279968, 300.61033084557198, 224.53911018433431,
+     2.9871178876757525, -16.098595446662767},
+    {-37.576393370437287, 302.40723745685472, 214.80754621037715,
+     2.858277856695183, -15.409689818933748},
+    {-37.568212139594607, 304.12622069420325, 205.48308992983274,
+     2.7347999575586148, -14.785946107603325},
+    {-37.560030908751926, 305.77045490074056, 196.52853316541561,
+     2.6161923780475664, -14.217636995317475},
+    {-37.551849677909246, 307.34283287322359, 187.91205943945673,
+     2.5020346674161353, -13.696954243408758},
+    {-37.543668447066565, 308.84600554430153, 179.60620871571993,
+     2.3919640267565976, -13.217547803270618},
+    {-37.535487216223878, 310.2824142407149, 171.58708457078464,
+     2.2856648107743216, -12.774193375000619},
+    {-37.52730598538119, 311.65431721397186, 163.83373781298582,
+     2.1828603667527782, -12.362548143058989},
+    {-37.51912475453851, 312.96381168885586, 156.32768079656034,
+     2.0833066045557223, -11.978968317416401},
+    {-37.510943523695829, 314.21285235924017, 149.05250007206442,
+     1.986786868982745, -11.620370809565504},
+    {-37.502762292853149, 315.40326703531207, 141.99354407758938,
+     1.8931078058835269, -11.284126957039854},
+    {-37.494581062010468, 316.53676998293662, 135.13766882966453,
+     1.8020959963009975, -10.967979875021951},
+    {-37.486399831167788, 317.61497337538947, 128.47302896616088,
+     1.7135951911197265, -10.669979467943879},
+    {-37.478218600325107, 318.63939718780205, 121.98890462955008,
+     1.6274640202415047, -10.388430807918672},
+    {-37.470037369482426, 319.61147779658648, 115.67555695038666,
+     1.5435740804010905, -10.121852747735181},
+    {-37.461856138639746, 320.53257549407459, 109.52410655862548,
+     1.4618083278267902, -9.8689444536422126},
+    {-37.453674907797065, 321.40398108830777, 103.52643078986172,
+     1.3820597183683796, -9.6285581269485672},
+    {-37.445493676954385, 322.22692172645816, 97.675076185470729,
+     1.3042300500578565, -9.3996766058214138},
+    {-37.437312446111697, 323.00256605557536, 91.963183593605677,
+     1.2282289724453381, -9.1813948478978116},
+    {-37.42913121526901, 323.73202881462294, 86.384423721180198,
+     1.1539731342460353, -8.9729045232684346},
+    {-37.420949984426329, 324.41637493598893, 80.932941407455345,
+     1.0813854464028523, -8.7734811186514765},
+    {-37.412768753583649, 325.0566232218934, 75.603307218333825,
+     1.0103944420191038, -8.5824730829352944},
+    {-37.404587522740968, 325.65374965074329, 70.390475218861553,
+     0.94093371803747428, -8.3992926428560697},
+    {-37.396406291898288, 326.20869036004626, 65.289745986372765,
+     0.87294144625492276, -8.2234079933566431},
+    {-37.388225061055607, 326.72234434545959, 60.296734090436537,
+     0.80635994343099926, -8.0543366258873696},
+    {-37.380043830212927, 327.19557590984368, 55.407339397252684,
+     0.74113529198792638, -7.8916396037381924},
+    {-37.371862599370246, 327.62921689133157, 50.617721662605703,
+     0.67721700421025666, -7.7349166295203773},
+    {-37.363681368527565, 328.02406869542381, 45.924277964004148,
+     0.61455772399728525, -7.583801778426321},
+    {-37.355500137684885, 328.38090415276389, 41.323622593483968,
+     0.5531129611593123, -7.4379597936015474},
+    {-37.347318906842204, 328.70046922136669, 36.812569090781174,
+     0.49284085401960326, -7.2970828581525202},
+    {-37.339137675999517, 328.98348454966037, 32.388114144749807,
+     0.43370195672151152, -7.1608877729700211},
+    {-37.330956445156829, 329.23064691467408, 28.047423130837398,
+     0.37565904816880413, -7.0291134814172738},
+    {-37.322775214314149, 329.44263054789303, 23.787817085827051,
+     0.31867695996925588, -6.9015188915983714},
+    {-37.314593983471468, 329.62008835985949, 19.606760948929374,
+     0.26272242112046301, -6.7778809548287295},
+    {-37.306412752628788, 329.76365307322152, 15.501852921939713,
+     0.20776391748959272, -6.6579929654319168},
+    {-37.298231521786107, 329.87393827288815, 11.470814820862739,
+     0.15377156439927414, -6.5416630523494605},
+    {-37.290050290943427, 329.95153938090561, 7.5114833083649986,
+     0.100716990856262, -6.4287128375024229},
+    {-37.281869060100746, 329.99703456289689, 3.6218019106874619,
+     0.048573234148332083, -6.3189762395474238},
+    {-37.273687829258066, 330.01098557208502, -0.20018626517467838,
+     -0.0026853563040459567, -6.2122984047628869},
+    {-37.265506598415385, 329.99393853635547, -3.9563451876343887,
+     -0.053083206814671637, -6.1085347494022235},
+    {-37.257325367572705, 329.9464246932061, -7.6484519947874592,
+     -0.10264359987370923, -6.0075501000319687},
+    {-37.249144136730024, 329.86896107693042, -11.278202583672041,
+     -0.15138874791690873, -5.9092179202234858},
+    {-37.240962905887336, 329.76205116197769, -14.847216744804856,
+     -0.1993398610869121, -5.8134196135292164},
+    {-37.232781675044649, 329.62618546600248, -18.357042886398045,
+     -0.24651720957370601, -5.7200438940067784},
+    {-37.224600444201968, 329.46184211581578, -21.809162387675219,
+     -0.29294018105535063, -5.6289862166877489},
+    {-37.208237982516607, 329.04957616457926, -28.545895640930578,
+     -0.38359644515206165, -5.453437463859542},
+    {-37.191875520831246, 328.52884994027926, -35.068072220748675,
+     -0.47144802096773764, -5.2860533462635297},
+    {-37.175513059145885, 327.90309276612339, -41.385503128627683,
+     -0.5566231602881142, -5.12619319125504},
+    {-37.159150597460524, 327.17557971141787, -47.507246118191816,
+     -0.63924020536463078, -4.9732847619309384},
+    {-37.142788135775156, 326.34944325402546, -53.441684793266653,
+     -0.71940863187102455, -4.8268151332260247},
+    {-37.126425674089788, 325.42768373596732, -59.196597323045069,
+     -0.79722995478605774, -4.6863230121549329},
+    {-37.110063212404427, 324.41317876837348, -64.77921639397043,
+     -0.87279851860124691, -4.5513922395913218},
+    {-37.093700750719066, 323.30869171791204, -70.196281727464722,
+     -0.94620218941222733, -4.4216462645808097},
+    {-37.077338289033705, 322.11687938712885, -75.454086260705651,
+     -1.0175229633868104, -4.296743423715327},
+    {-37.060975827348344, 320.84029898466542, -80.558516901228927,
+     -1.0868375036388345, -4.1763728905148971},
+    {-37.044613365662975, 319.48141446775469, -85.515090615300565,
+     -1.154217615543605, -4.060251185248843},
+    {-37.028250903977607, 318.04260232797697, -90.328986487270413,
+     -1.2197306689089005, -3.948119155797269},
+    {-37.011888442292246, 316.5261568817013, -95.005074286787931,
+     -1.2834399740899036, -3.8397393562140776},
+    {-36.979163518921524, 313.26916115403498, -103.96190869765698,
+     -1.4056822654257941, -3.6333817756310927},
+    {-36.946438595550795, 309.72731298295486, -112.4192721162311,
+     -1.5213817134971295, -3.439633050985663},
+    {-36.913713672180066, 305.91645580350291, -120.40727897651132,
+     -1.6309288201915049, -3.2571753587576122},
+    {-36.880988748809344, 301.85149874599466, -127.95299250901226,
+     -1.7346741078510681, -3.0848770699388077},
+    {-36.848263825438615, 297.54650937170805, -135.08084610343127,
+     -1.8329336592810741, -2.9217602144955923},
+    {-36.815538902067885, 293.01479384522543, -141.81299252513273,
+     -1.9259937074718096, -2.7669746363170766},
+    {-36.782813978697163, 288.26896665559286, -148.16959554397704,
+     -2.0141144670142657, -2.6197772710876888},
+    {-36.750089055326434, 283.32101157963524, -154.16907518308997,
+     -2.0975333549667305, -2.4795153885966474},
+    {-36.717364131955705, 278.18233525677556, -159.82831530408961,
+     -2.1764677160606483, -2.3456129331439572},
+    {-36.684639208584983, 272.86381449143437, -165.16284037219773,
+     -2.2511171424243712, -2.2175593070625381},
+    {-36.651914285214254, 267.37583819958621, -170.18696682129561,
+     -2.3216654592301982, -2.0949000971329528},
+    {-36.619189361843524, 261.72834475723687, -174.9139333467308,
+     -2.3882824332669101, -1.9772293582462588},
+    {-36.586464438472802, 255.93085538140411, -179.35601360791696,
+     -2.4511252502894711, -1.8641831543834755},
+    {-36.553739515102073, 249.99250407150328, -183.52461416216047,
+     -2.5103397982898277, -1.7554341217240181},
+    {-36.521014591731344, 243.92206455551459, -187.4303599311371,
+     -2.5660617869796649, -1.6506868680412135},
+    {-36.488289668360615, 237.72797461702143, -191.08316908902543,
+     -2.6184177283419738, -1.5496740604734269},
+    {-36.455564744989886, 231.41835812296898, -194.49231893187212,
+     -2.6675257987685042, -1.4521530831483624},
+    {-36.390114898248434, 218.48358957213259, -200.61388769465222,
+     -2.756433831764411, -1.2667229287825323},
+    {-36.324665051506983, 205.17718837872187, -205.858517568536,
+     -2.8335914078854754, -1.0928502530784074},
+    {-36.259215204765525, 191.55467187459365, -210.28251037615621,
+     -2.8997112759974866, -0.92923695248461924},
+    {-36.193765358024073, 177.668075376404, -213.93613295381175,
+     -2.9554279699498385, -0.7747839372069566},
+    {-36.128315511282622, 163.56631671443338, -216.86451660830954,
+     -3.0013095481933592, -0.62855345207361635},
+    {-36.062865664541164, 149.29550756319568, -219.10839022446277,
+     -3.0378671548542693, -0.48973976985155454},
+    {-35.997415817799713, 134.8992212197675, -220.70468321207241,
+     -3.0655628771960366, -0.35764614320352262},
+    {-35.931965971058261, 120.41872441650671, -221.6870255224481,
+     -3.0848162566585975, -0.23166649432253522},
+    {-35.866516124316803, 105.89317919617591, -222.08616547232873,
+     -3.096009725373893, -0.11127073245938272},
+    {-35.801066277575352, 91.359819684115919, -221.93032134474893,
+     -3.0994931774386707, 0.0040071208721988889},
+    {-35.7356164308339, 76.854107668509783, -221.24547919067831,
+     -3.0955878376814598, 0.11457861241868068},
+    {-35.670166584092442, 62.409870177995529, -220.05564658849363,
+     -3.0845895556684924, 0.22080880721598029},
+    {-35.604716737350991, 48.05942167660087, -218.38307009135883,
+     -3.0667716261068425, 0.32302286234149846},
+    {-35.539266890609539, 33.833673043107616, -216.24842253677897,
+     -3.0423872164048187, 0.42151149748550393},
+    {-35.50654196723881, 26.776861253379867, -215.01389241252292,
+     -3.0278067153218133, 0.4694413585254158},
+    {-35.473817043868081, 19.762229138990044, -213.67096518747536,
+     -3.0116714663556343, 0.51653557475050182},
+    {-35.441092120497352, 12.793287621880619, -212.22185108483774,
+     -2.994008344371804, 0.56282272088331031},
+    {-35.408367197126623, 5.8734764758851963, -210.66868873130977,
+     -2.9748433125773373, 0.60832995424637282},
+    {-35.375642273755901, -0.99383338774223451, -209.01354863178562,
+     -2.9542014674154249, 0.65308310460081775},
+    {-35.342917350385171, -7.8053377449201307, -207.25843642668323,
+     -2.9321070806344247, 0.69710675710777115},
+    {-35.310192427014442, -14.557796986590354, -205.4052959483771,
+     -2.9085836387460406, 0.74042432902645228},
+    {-35.27746750364372, -21.24803414350373, -203.45601209174313,
+     -2.8836538800684699, 0.78305814070072566},
+    {-35.212017656902262, -34.429436306110688, -199.2762751659227,
+     -2.8296628314177354, 0.86635866997422828},
+    {-35.146567810160811, -47.325311780021799, -194.73322469450622,
+     -2.7703021493639159, 0.94716735266606555},
+    {-35.081117963419359, -59.912318245585269, -189.84007378120683,
+     -2.705730102147279, 1.0256293932997147},
+    {-35.015668116677901, -72.167954285146735, -184.60931580489429,
+     -2.6360958641392482, 1.101877710800484},
+    {-34.95021826993645, -84.070514246622992, -179.05278349294844,
+     -2.5615402758008869, 1.1760342565084874},
+    {-34.884768423194998, -95.599046765290922, -173.18170177611913,
+     -2.4821965230672141, 1.2482111629160419},
+    {-34.81931857645354, -106.73331656318362, -167.00673521122559,
+     -2.3981907463887504, 1.3185117482594972},
+    {-34.753868729712082, -117.45376919311228, -160.53803064288061,
+     -2.3096425881592864, 1.3870313978858},
+    {-34.68841888297063, -127.74149843501057, -153.78525567934136,
+     -2.2166656860056282, 1.4538583398857026},
+    {-34.622969036229179, -137.578216087219, -146.75763347705382,
+     -2.1193681183651218, 1.5190743296806895},
+    {-34.557519189487721, -146.94622392541956, -139.46397426067304,
+     -2.0178528078933615, 1.5827552559448939},
+    {-34.492069342746269, -155.82838762792719, -131.91270394807214,
+     -1.9122178874984426, 1.6449716783394519},
+    {-34.426619496004818, -164.20811248862776, -124.11189020126335,
+     -1.8025570331653742, 1.705789305958205},
+    {-34.36116964926336, -172.06932075842877, -116.06926618284767,
+     -1.6889597671966323, 1.7652694240690945},
+    {-34.295719802521909, -179.39643047323372, -107.79225226226789,
+     -1.5715117350349572, 1.8234692756373276},
+    {-34.164820109038999, -192.38838767679181, -90.563289799044284,
+     -1.3253880674624703, 1.9362389558435364},
+    {-34.033920415556089, -203.06852154136919, -72.478825070029174,
+     -1.0648027641990494, 2.044487596152734},
+    {-33.968470568814638, -207.50744158520254, -63.131522516123276,
+     -0.92926648534600642, 2.0970253686462037},
+    {-33.90302072207318, -211.32815500921558, -53.588789728751969,
+     -0.79032470540098532, 2.1485583646837632},
+    {-33.837570875331728, -214.51805872190164, -43.856332169333356,
+     -0.64804196984047557, 2.1991234114150253},
+    {-33.772121028590277, -217.06491671362355, -33.939663370720623,
+     -0.50248048296979198, 2.2487552492652161},
+    {-33.706671181848819, -218.95684783941402, -23.844115334449111,
+     -0.35370023942455142, 2.2974866846154223},
+    {-33.641221335107367, -220.18231425752754, -13.574848182694154,
+     -0.20175914613016277, 2.3453487289503641},
+    {-33.575771488365916, -220.7301104771015, -3.1368591300194621,
+     -0.046713135558275873, 2.3923707258724161},
+    {-33.543046564995187, -220.74646885687855, 2.1438869578944852,
+     0.031957248631849088, 2.4155754491483554},
+    {-33.510321641624458, -220.58935297237286, 7.4650091666368716,
+     0.11138372896672374, 2.4385804672160343},
+    {-33.444871794883007, -219.74947032450424, 18.226060827177758,
+     0.27247915523429073, 2.484004299354122},
+    {-33.379421948141555, -218.20019385533089, 29.14173948941486,
+     0.43652253077793884, 2.5286672206635283},
+    {-33.248522254658646, -212.93384543062325, 51.419409721067282,
+     0.77325857262517295, 2.6158041140035238},
+    {-33.117622561175736, -204.71388512753848, 74.264112422117265,
+     1.1212174467677241, 2.7001673995941911},
+    {-32.986722867692826, -193.46820645715536, 97.643781385539356,
+     1.4800467111749922, 2.7819167950163091},
+    {-32.855823174209917, -179.12878883449363, 121.52802944242842,
+     1.8494138588166844, 2.8611974731131178},
+    {-32.724923480727014, -161.6314873583708, 145.88800523561818,
+     2.2290045280249062, 2.9381417641553167},
+    {-32.594023787244105, -140.91584024714783, 170.696266275601,
+     2.6185209195067864, 3.0128706182613039},
+    {-32.463124093761195, -116.92489195031183, 195.92666603414591,
+     3.0176803912689252, 3.0854948671360622},
+    {-32.332224400278292, -89.605030225204473, 221.55425319038133,
+     3.4262142073416135, 3.1561163170154516},
+    {-32.266774553536834, -74.680879929540637, 234.50949917935773,
+     3.6339160393962064, 3.1907055753117515},
+    {-32.201324706795383, -58.905835695248712, 247.5551814383802,
+     3.8438664199758699, 3.2248286989852941},
+    {-32.135874860053931, -42.274071142658826, 260.68847855525036,
+     4.056035189496205, 3.2584962786850435},
+    {-32.070425013312473, -24.779942597796683, 273.90662850764613,
+     4.2703928681011734, 3.2917184982633634},
+    {-32.004975166571015, -6.4179852748012536, 287.20692655744153,
+     4.4869106297171459, 3.3245051552974174},
+    {-31.972250243200289, 3.0900889184077069, 293.88705105709607,
+     4.5959707061844766, 3.3407381087430803},
+    {-31.939525319829563, 12.817090407227385, 300.58672324850068,
+     4.7055602774077903, 3.3568656803398098},
+    {-31.874075473088109, 32.930402379602668, 314.04342250167866,
+     4.9263142199501839, 3.3888091549912724},
+    {-31.808625626346654, 53.926900357699303, 327.57447980114074,
+     5.1491454495571674, 3.4203443288798603},
+    {-31.677725932863748, 98.588431909441553, 354.84973800647901,
+     5.600934529810166, 3.4822232078557431},
+    {-31.546826239380842, 146.8380418245963, 382.39310933375066,
+     6.0607223438597124, 3.5425662583804911},
+    {-31.481376392639387, 172.31905421036339, 396.25947729963298,
+     6.2935538833728026, 3.5721806202268076},
+    {-31.448651469268661, 185.4003895741412, 403.21533237452712,
+     6.4106935200154052, 3.5868516405606368},
+    {-31.432289007583297, 192.02647909288777, 406.69880488870461,
+     6.4694430111434968, 3.5941534893535123},
+    {-31.415926545897932, 198.70959670833582, 410.18592769720533,
+     6.5283117958964745, 3.6011393218871781},
+    {-31.41592652589793, 198.70960491153383, 410.10769900930194,
+     6.5270667518149894, -62252.191855468183},
+    {-31.415924528527121, 198.71042272255099, 409.07794017098399,
+     6.5106780448164461, -4390.4586608799091},
+    {-31.415922531156308, 198.71123932072609, 408.62119799870982,
+     6.5034091803840131, -3107.3449268689019},
+    {-31.415920533785496, 198.71205512682766, 408.27056483194917,
+     6.4978290926233475, -2537.5332832551539},
+    {-31.415918536414686, 198.71287029224078, 407.97494587770234,
+     6.493124582762273, -2197.5441384779597},
+    {-31.415916539043877, 198.71368490455893, 407.71450865510798,
+     6.4889800071310688, -1965.4090801013936},
+    {-31.415914541673065, 198.71449902291835, 407.47907211982266,
+     6.4852333294213604, -1794.0007900968913},
+    {-31.415912544302252, 198.715312690741, 407.26258483995656,
+     6.4817882381363416, -1660.7538753281349},
+    {-31.415910546931443, 198.71612594168093, 407.06110248208631,
+     6.4785819572854324, -1553.3298740953751},
+    {-31.415906552189821, 198.71775129655893, 406.69293533085045,
+     6.4727232151526479, -1389.0472306403969},
+    {-31.415902557448199, 198.71937525495088, 406.36015153060612,
+     6.4674276154810766, -1267.7599404714131},
+    {-31.415898562706573, 198.72099793976335, 406.05418302588953,
+     6.4625587935261457, -1173.4854301220744},
+    {-31.415894567964951, 198.72261944624069, 405.76944619880231,
+     6.4580278833213427, -1097.4870002021589},
+    {-31.415886578481704, 198.72585921748936, 405.24920630380188,
+     6.4497496400654999, -981.27261709304389},
+    {-31.41587858899846, 198.72909504236605, 404.77902525115644,
+     6.4422681050356836, -895.48003066778267},
+    {-31.415870599515216, 198.73232726863955, 404.34677886645341,
+     6.4353903162672967, -828.79849423037945},
+    {-31.415862610031972, 198.7355561657748, 403.94456682986953,
+     6.4289905364699207, -775.04594765098659},
+    {-31.415846631065484, 198.74200480240904, 403.20978598398096,
+     6.4172993763164721, -692.85257549618927},
+    {-31.415830652098993, 198.74844229231857, 402.54581288622705,
+     6.4067351480221273, -632.17756275445799},
+    {-31.415814673132502, 198.75486961930741, 401.93549630927652,
+     6.3970248820734961, -585.01969042132703},
+    {-31.415798694166014, 198.76128754565784, 401.36766074416272,
+     6.3879907153004778, -547.00606663389215},
+    {-31.415782715199526, 198.76769668466491, 400.83454338735879,
+     6.3795090993137622, -515.51834356478321},
+    {-31.415766736233035, 198.77409754370436, 400.33049204035279,
+     6.3714900769656522, -488.88034260624039},
+    {-31.415734778300056, 198.78687607713462, 399.39347113010842,
+     6.3565833164275283, -445.97284419224911},
+    {-31.415702820367077, 198.79962592884291, 398.53233887651021,
+     6.3428843396452388, -412.62468151260862},
+    {-31.415670862434098, 198.81234925507201, 397.73128871577131,
+     6.3301415789813085, -385.74321604320915},
+    {-31.415638904501119, 198.82504779062401, 396.97934117074641,
+     6.3181802919479804, -363.47671928469015},
+    {-31.41560694656814, 198.83772297066378, 396.26850203838177,
+     6.3068732479426179, -344.63979806908924},
+    {-31.415543030702182, 198.86300794631245, 394.94735520035294,
+     6.2858591177999656, -314.29816626670356},
+    {-31.415479114836224, 198.88821205374367, 393.73353785202966,
+     6.2665531283603073, -290.71646375430674},
+    {-31.415415198970262, 198.91334139210872, 392.60469458033566,
+     6.2485994868087005, -271.70767336550381},
+    {-31.4153512831043, 198.93840086846711, 391.54529709072244,
+     6.2317510563904159, -255.96232626800185},
+    {-31.415287367238342, 198.96339454231827, 390.54403922504338,
+     6.2158278970945373, -242.64216697780807},
+    {-31.415223451372384, 198.98832584489742, 389.59238568237549,
+     6.2006941679951035, -231.18239452252132},
+    {-31.415159535506426, 199.01319772633005, 388.68370533938554,
+     6.1862443337281592, -221.18671645340717},
+    {-31.41503170377451, 199.06277321018004, 386.97516831905386,
+     6.1590765205651357, -204.51143058247348},
+    {-31.414903872042593, 199.11213824604033, 385.38681134928737,
+     6.1338212734793505, -191.06978473589021},
+    {-31.414776040310677, 199.16130671421197, 383.89667310921101,
+     6.1101290777404262, -179.93580803315183},
+    {-31.414648208578761, 199.21029009761764, 382.4887635614628,
+     6.0877454527250157, -170.51674341947569},
+    {-31.414520376846845, 199.2590981020756, 381.15101142731237,
+     6.0664782854400761, -162.41320349532489},
+    {-31.414392545114929, 199.30773907259373, 379.87403845705387,
+     6.0461783227466208, -155.34495890836357},
+    {-31.414264713383012, 199.35622028463203, 378.65038657053651,
+     6.026726871140565, -149.10880946701906},
+    {-31.414136881651096, 199.40454815488684, 377.47400874576721,
+     6.0080276941533395, -143.5533376347054},
+    {-31.41388121818726, 199.50076614639809, 375.2439593560344,
+     5.9725819415587624, -134.04829362498779},
+    {-31.413625554723424, 199.59643231145932, 373.15283070701167,
+     5.9393467662140571, -126.17505144149945},
+    {-31.413369891259592, 199.69157913324418, 371.17800823836291,
+     5.9079622708934343, -119.51445954488014},
+    {-31.413114227795759, 199.78623406823442, 369.30241958722053,
+     5.8781567613637753, -113.78410265348384},
+    {-31.412858564331927, 199.880420723713, 367.51280107674313,
+     5.8497191575878986, -108.78582482208549},
+    {-31.412602900868094, 199.97415968165188, 365.79860468435095,
+     5.8224815982097748, -104.37593909004889},
+    {-31.412347237404258, 200.06746909488226, 364.1512780205943,
+     5.7963079815153247, -100.4473750971967},
+    {-31.412091573940423, 200.1603651306296, 362.56377261414417,
+     5.7710861398820112, -96.918493894159866},
+    {-31.41183591047659, 200.25286230828689, 361.03019780370471,
+     5.7467223315542117, -93.725813936193063},
+    {-31.411324583548922, 200.43671144707821, 358.10563193992016,
+     5.7002631485249609, -88.158136701861579},
+    {-31.410813256621253, 200.61910841272285, 355.34559568267377,
+     5.6564214491926368, -83.447953035871748},
+    {-31.410301929693588, 200.80013088768831, 352.72594262131935,
+     5.6148129905091979, -79.395561427285415},
+    {-31.40979060276592, 200.97984566612078, 350.22791300285883,
+     5.5751392524727317, -75.860841759011549},
+    {-31.409279275838252, 201.15831098430132, 347.83658786903493,
+     5.5371628367259289, -72.742189980226243},
+    {-31.408767948910587, 201.33557820698729, 345.53987073425753,
+     5.5006912607382707, -69.963894346869878},
+    {-31.408256621982918, 201.51169308205377, 343.32779215322182,
+     5.4655658906092173, -67.468226163056485},
+    {-31.40774529505525, 201.68669669592421, 341.19202021839067,
+     5.4316541511196448, -65.210296193766638},
+    {-31.407233968127581, 201.86062621579197, 339.12550702474925,
+     5.3988438996076136, -63.154601990198643},
+    {-31.406722641199913, 202.03351547617251, 337.12222760722312,
+     5.3670392714739998, -61.272646156306408},
+    {-31.40569998734458, 202.37629462810963, 333.28525174419059,
+     5.3061267839674509, -57.941359449311513},
+    {-31.404677333489246, 202.71525400727256, 329.646937796717,
+     5.2483732645326189, -55.075222022180917},
+    {-31.40365467963391, 203.05058266609583, 326.1807497620282,
+     5.193356523143227, -52.575151144357719},
+    {-31.402632025778573, 203.38244544626258, 322.86558408071926,
+     5.1407408114020079, -50.369299683386359},
+    {-31.401609371923236, 203.71098774911093, 319.68432936395766,
+     5.0902539035116039, -48.404129579591967},
+    {-31.400586718067899, 204.03633908478216, 316.62288279423063,
+     5.041671444502752, -46.638819037821129},
+    {-31.399564064212566, 204.35861577508751, 313.66945778122584,
+     4.9948059332888706, -45.041625381468165},
+    {-31.398541410357232, 204.67792305319247, 310.81408392334384,
+     4.949498765901553, -43.587443586186012},
+    {-31.397518756501896, 204.99435672293802, 308.04823775892476,
+     4.9056143599744351, -42.256122099036865},
+    {-31.396496102646559, 205.30800448991403, 305.36456477714103,
+     4.8630357314203669, -41.031273131686632},
+    {-31.395473448791222, 205.61894704335472, 302.75666654749386,
+     4.8216611073140303, -39.899414531819076},
+    {-31.393428141080552, 206.2330093724604, 297.74642325242314,
+     4.7421775970812279, -37.871644499189429},
+    {-31.391382833369882, 206.83707918667639, 292.97996424996137,
+     4.6665667104431572, -36.102746252500637},
+    {-31.389337525659212, 207.43162345343387, 288.42743060679982,
+     4.594353582184155, -34.541913287794557},
+    {-31.387292217948541, 208.01705412768024, 284.06461082017506,
+     4.5251531869597734, -33.151286130730895},
+    {-31.385246910237871, 208.59373819345811, 279.87154949647277,
+     4.4586482033566321, -31.901997483201498},
+    {-31.383201602527201, 209.16200531125722, 275.83156799901093,
+     4.3945734328265438, -30.771600274559383},
+    {-31.381156294816531, 209.72215375891278, 271.93055710859807,
+     4.3327045465420744, -29.742341213874475},
+    {-31.379110987105861, 210.2744551266494, 268.15645468609512,
+     4.2728497757040431, -28.799969842553345},
+    {-31.377065679395191, 210.81915808344613, 264.49885242351542,
+     4.2148436556514515, -27.932897245861806},
+    {-31.375020371684521, 211.35649143839743, 260.94869470811005,
+     4.1585422354595867, -27.131589234886903},
+    {-31.37297506397385, 211.88666665824167, 257.49804452468254,
+     4.1038193540715904, -26.388120487046262},
+    {-31.37092975626318, 212.40987995932227, 254.13989901022256,
+     4.0505637063479725, -25.695841505337135},
+    {-31.36683914084184, 213.43613967629469, 247.67692726876561,
+     3.9480695864294586, -24.443177608691325},
+    {-31.3627485254205, 214.43659562919655, 241.51751274354334,
+     3.8503881850116826, -23.337667887586942},
+    {-31.35865790999916, 215.41241710599587, 235.62738001545009,
+     3.7569748790224358, -22.352538383584797},
+    {-31.354567294577819, 216.36464606183694, 229.97827651175331,
+     3.6673808053400201, -21.467374143684264},
+    {-31.350476679156476, 217.29421876317801, 224.54658684637315,
+     3.5812308237670925, -20.666300444591617},
+    {-31.346386063735132, 218.20198260300353, 219.31233198880525,
+     3.4982076010754128, -19.93676191372645},
+    {-31.342295448313791, 219.088709390433, 214.25843017065759,
+     3.418039858056801, -19.26868033139522},
+    {-31.338204832892451, 219.95510601213883, 209.37014042956005,
+     3.3404935213424545, -18.653859696737044},
+    {-31.334114217471111, 220.80182309856326, 204.6346364800319,
+     3.265364947925236, -18.085557101821284},
+    {-31.330023602049771, 221.62946215096591, 200.04067543677078,
+     3.192475658136483, -17.558167429734468},
+    {-31.32593298662843, 222.43858146401615, 195.57833679282587,
+     3.1216681858495496, -17.066987834289197},
+    {-31.32184237120709, 223.22970109373551, 191.23881425631151,
+     3.0528027692283781, -16.608039190895433},
+    {-31.31775175578575, 224.00330706005951, 187.01424792216784,
+     2.9857546828472157, -16.177928916755487},
+    {-31.31366114036441, 224.75985492928453, 182.89758761811584,
+     2.9204120654923105, -15.773744289549693},
+    {-31.309570524943069, 225.4997728893909, 178.88248062594923,
+     2.8566741355241647, -15.392968561985773},
+    {-31.305479909521729, 226.22346440696634, 174.96317866521616,
+     2.7944497124926708, -15.033414330410093},
+    {-31.301389294100385, 226.9313105362437, 171.13446024752946,
+     2.7336559831193257, -14.693170114237422},
+    {-31.293208063257701, 228.30089064501061, 163.73014047296144,
+     2.6160651241315511, -14.064094223153559},
+    {-31.285026832415021, 229.61118421927333, 156.63604188525298,
+     2.5033707454417038, -13.494512588580198},
+    {-31.27684560157234, 230.86461024939146, 149.82383515619668,
+     2.3951238092351739, -12.975544534097677},
+    {-31.26866437072966, 232.06337335782914, 143.26929468877972,
+     2.2909404282533559, -12.500061383840592},
+    {-31.260483139886979, 233.20949400260437, 136.95151076971933,
+     2.1904893497147415, -12.062265705799227},
+    {-31.252301909044295, 234.30483303084378, 130.8522862005197,
+     2.0934823710161901, -11.657387816723391},
+    {-31.244120678201611, 235.35111187344754, 124.95566720005961,
+     1.9996668891251377, -11.281462785504651},
+    {-31.23593944735893, 236.3499293285727, 119.24757376424944,
+     1.9088200302925753, -10.931163860130477},
+    {-31.22775821651625, 237.30277564122437, 113.7155048594928,
+     1.820743968732105, -10.603676186437635},
+    {-31.219576985673569, 238.21104441481629, 108.34830072314138,
+     1.7352621525407215, -10.296599784817367},
+    {-31.211395754830889, 239.07604276617488, 103.13594930323787,
+     1.6522162307860666, -10.007874096797117},
+    {-31.203214523988205, 239.8990000438173, 98.069427212980713,
+     1.5714635288230887, -9.735718654006055},
+    {-31.195033293145521, 240.68107536090085, 93.140567961628975,
+     1.4928749568299826, -9.4785859501919152},
+    {-31.18685206230284, 241.42336414244895, 88.341951952120397,
+     1.4163332640248081, -9.2351236567604555},
+    {-31.17867083146016, 242.12690384685405, 83.666814004743003,
+     1.3417315711919449, -9.0041440686122201},
+    {-31.170489600617479, 242.79267899099105, 79.108965109449485,
+     1.2689721291365657, -8.7845992000198958},
+    {-31.162308369774799, 243.42162558435368, 74.662725818490742,
+     1.1979652619526131, -8.5755603358626757},
+    {-31.154127138932115, 244.01463505872948, 70.322869229848862,
+     1.1286284625507783, -8.3762011258451174},
+    {-31.145945908089431, 244.57255776495273, 66.084571925299329,
+     1.0608856144602661, -8.1857835183345653},
+    {-31.13776467724675, 245.09620609621879, 61.943371546942615,
+     0.99466631900212155, -8.0036459868014642},
+    {-31.129583446404069, 245.58635728778418, 57.895129945980997,
+     0.92990531090239736, -7.8291936199404999},
+    {-31.121402215561389, 246.04375593493785, 53.936001034216062,
+     0.86654194853802036, -7.6618897365578311},
+    {-31.113220984718708, 246.4691162647228, 50.062402624690229,
+     0.80451976748531484, -7.5012487554910479},
+    {-31.105039753876024, 246.86312419155624, 46.270991672466188,
+     0.74378608801971269, -7.3468301044296034},
+    {-31.09685852303334, 247.22643918249361, 42.558642426676819,
+     0.68429166880560899, -7.198232993345294},
+    {-31.08867729219066, 247.55969595424804, 38.922427085904879,
+     0.62599040030053033, -7.0550919111308099},
+    {-31.080496061347979, 247.86350602100552, 35.359598614903994,
+     0.56883903244513445, -6.9170727300765202},
+    {-31.072314830505299, 248.13845910949033, 31.867575434518493,
+     0.51279693206558985, -6.7838693235419445},
+    {-31.064133599662618, 248.38512445560326, 28.443927741023273,
+     0.45782586611931447, -6.6552006187858668},
+    {-31.055952368819934, 248.60405199508946, 25.086365247716117,
+     0.40388980749633585, -6.5308080202976626},
+    {-31.04777113797725, 248.79577345910366, 21.792726172064093,
+     0.35095476057228953, -6.4104531498112882},
+    {-31.03958990713457, 248.9608033842664, 18.560967317043193,
+     0.29898860411130757, -6.2939158580055699},
+    {-31.031408676291889, 249.09964004559029, 15.389155116618021,
+     0.24796094945530772, -6.1809924701150374},
+    {-31.023227445449209, 249.21276631971074, 12.275457533175128,
+     0.19784301221979747, -6.0714942336088571},
+    {-31.015046214606528, 249.30065048496257, 9.2181367098504374,
+     0.14860749595641676, -5.9652459409949206},
+    {-31.006864983763844, 249.36374696416217, 6.2155422934732538,
+     0.10022848644530662, -5.8620847048674252},
+    {-30.99868375292116, 249.4024970152324, 3.2661053547922068,
+     0.052681355454075131, -5.7618588656995886},
+    {-30.990502522078479, 249.41732937432249, 0.3683328418919235,
+     0.0059426729468086735, -5.6644270157071084},
+    {-30.982321291235799, 249.4086608555304, -2.4791974892695436,
+     -0.040009873146123059, -5.5696571244806616},
+    {-30.974140060393118, 249.37689691093763, -5.2778417164573037,
+     -0.085197550378583758, -5.4774257540803823},
+    {-30.965958829550438, 249.32243215426439, -8.0288940082437801,
+     -0.12964064914699014, -5.3876173529714189},
+    {-30.957777598707754, 249.2456508511475, -10.733590534823771,
+     -0.17335854456283409, -5.3001236196087831},
+    {-30.94959636786507, 249.14692737871238, -13.393113066395502,
+     -0.21636975337587205, -5.214842927694181},
+    {-30.941415137022389, 249.02662665688143, -16.008592289106399,
+     -0.25869198642358809, -5.1316798061635787},
+    {-30.925052675337028, 248.72270826614772, -21.111706261116264,
+     -0.34133662572469953, -4.9713523815308998},
+    {-30.908690213651663, 248.33664070627162, -26.051066910082721,
+     -0.42141978081259102, -4.8184838190481427},
+    {-30.892327751966299, 247.87104127453125, -30.834164838181188,
+     -0.49905861878955676, -4.6724890357914219},
+    {-30.875965290280934, 247.32840948916251, -35.467916470034396,
+     -0.57436125699362195, -4.5328454397398144},
+    {-30.85960282859557, 246.71113597958427, -39.958724312491391,
+     -0.64742771536035881, -4.399084598942685},
+    {-30.843240366910209, 246.02151045717292, -44.3125293067733,
+     -0.71835074362539175, -4.270785229253339},
+    {-30.826877905224844, 245.26172888555294, -48.534856506230952,
+     -0.78721654290531939, -4.1475672608633554},
+    {-30.810515443539479, 244.43389995105127, -52.630855091824309,
+     -0.8541053976891555, -4.0290867928123362},
+    {-30.794152981854118, 243.54005091893879, -56.605333560854532,
+     -0.91909223147345553, -3.9150317825658369},
+    {-30.777790520168754, 242.58213294856401, -60.462790782512847,
+     -0.98224709702425594, -3.8051183473531029},
+    {-30.761428058483389, 241.5620259301399, -64.207443498959023,
+     -1.043635610428884, -3.6990875772256584},
+    {-30.745065596798028, 240.48154289726855, -67.843250757253955,
+     -1.1033193366209559, -3.5967027782102132},
+    {-30.728703135112664, 239.34243406196717, -71.373935680980992,
+     -1.1613561328500124, -3.4977470785954936},
+    {-30.695978211741938, 236.89504761173922, -78.133766125115741,
+     -1.2727036354102526, -3.3093423494553296},
+    {-30.663253288371209, 234.23274508111001, -84.512692190361392,
+     -1.3780777172527245, -3.1324618572148699},
+    {-30.630528365000483, 231.36760772893621, -90.533752268401969,
+     -1.4778353019180859, -2.9659018947057945},
+    {-30.597803441629758, 228.31100194184063, -96.217656567039938,
+     -1.5722967949413531, -2.8086287984442651},
+    {-30.565078518259028, 225.07364999982241, -101.58310834897026,
+     -1.6617511433560743, -2.6597492378824739},
+    {-30.532353594888303, 221.66569126336805, -106.6470701925266,
+     -1.7464600274114037, -2.5184866139277662},
+    {-30.499628671517577, 218.09673539167895, -111.42498636535947,
+     -1.8266613598055861, -2.3841621354004867},
+    {-30.466903748146848, 214.37590888255775, -115.93096984970218,
+     -1.9025722273592323, -2.2561795156143494},
+    {-30.434178824776122, 210.51189597758119, -120.1779606604328,
+     -1.9743913800394259, -2.1340124980141404},
+    {-30.401453901405397, 206.51297478333538, -124.17786067029947,
+     -2.0423013496824733, -2.0171946127954454},
+    {-30.368728978034667, 202.38704930734184, -127.94164907238576,
+     -2.1064702636209174, -1.9053107077378488},
+    {-30.336004054663938, 198.1416779863809, -131.47948177780791,
+     -2.1670534052686792, -1.7979899011047167},
+    {-30.303279131293213, 193.78409918795722, -134.80077740225926,
+     -2.2241945635357805, -1.6948996827281781},
+    {-30.270554207922487, 189.32125408740154, -137.91429199171128,
+     -2.2780272049927648, -1.595740948516212},
+    {-30.237829284551758, 184.75980725944251, -140.82818424137872,
+     -2.3286754964472038, -1.5002437986772388},
+    {-30.205104361181032, 180.10616527105719, -143.55007264777538,
+     -2.3762552006319657, -1.408163964593663},
+    {-30.172379437810307, 175.36649351950143, -146.08708578269886,
+     -2.4208744637426713, -1.3192797561111207},
+    {-30.106929591068852, 165.65260684981874, -150.63281213185803,
+     -2.5016302588448425, -1.150308992488271},
+    {-30.041479744327397, 155.66319514359753, -154.51415865455724,
+     -2.5716802229712648, -0.99191861783733182},
+    {-29.976029897585946, 145.44029677856923, -157.77445195365888,
+     -2.6316769180692088, -0.84292234585338},
+    {-29.910580050844491, 135.02326967739262, -160.45240095974552,
+     -2.6822014265018463, -0.70231570546972233},
+    {-29.845130204103036, 124.44907026978741, -162.58278390989753,
+     -2.7237740763407032, -0.56924162354195929},
+    {-29.779680357361581, 113.75249181965201, -164.19700838100277,
+     -2.7568631766796825, -0.44296365442265473},
+    {-29.714230510620126, 102.96636947876729, -165.32357197981426,
+     -2.7818921967494021, -0.32284492593448155},
+    {-29.648780663878672, 92.121757857905095, -165.9884444613223,
+     -2.7992457150783818, -0.20833141265497898},
+    {-29.583330817137217, 81.248085717136945, -166.21538709652364,
+     -2.8092743870517336, -0.098938522932932649},
+    {-29.517880970395762, 70.373291466634015, -166.02622147430944,
+     -2.812299122027448, 0.0057597494913308421},
+    {-29.452431123654307, 59.523942464542237, -165.4410572179435,
+     -2.8086146186599827, 0.10613966951511271},
+    {-29.386981276912856, 48.725340547658156, -164.47848606250139,
+     -2.7984923751205399, 0.20253502395137934},
+    {-29.321531430171401, 38.001615796165702, -163.15574819338551,
+     -2.782183266619914, 0.29524312759192495},
+    {-29.256081583429946, 27.375810188019688, -161.48887555909212,
+     -2.7599197640082491, 0.38452982150252002},
+    {-29.223356660059221, 22.106548750709209, -160.5310991901521,
+     -2.7466232072094008, 0.42796565296917916},
+    {-29.190631736688495, 16.86995252146318, -159.49281595190919,
+     -2.7319178527994872, 0.47063365756901254},
+    {-29.157906813317766, 11.668627836900392, -158.37574261848462,
+     -2.7158283966074528, 0.51255996801639125},
+    {-29.12518188994704, 6.5051257602986681, -157.18154093187107,
+     -2.6983787007030582, 0.55376942144374408},
+    {-29.092456966576314, 1.3819438385029772, -155.91182026249092,
+     -2.6795918344334853, 0.5942856414935801},
+    {-29.07609450489095, -1.1637608010906395, -155.24912953422216,
+     -2.669703964335846, 0.61429085835227482},
+    {-29.059732043205585, -3.6984722254652942, -154.56814010357607,
+     -2.659490112877958, 0.63413111412730117},
+    {-29.027007119834856, -8.7337269788820127, -153.15201241194325,
+     -2.6380951329165927, 0.673327257711827},
+    {-28.99428219646413, -13.72147370004663, -151.66490380662978,
+     -2.615427807092348, 0.71189448788793686},
+    {-28.928832349722676, -23.545291182489748, -148.48339592187915,
+     -2.5663565353563706, 0.78721921321150101},
+    {-28.863382502981224, -33.152072048204353, -145.03451820718328,
+     -2.5124310740815465, 0.86025073863517976},
+    {-28.797932656239769, -42.524657096823901, -141.3285673430685,
+     -2.4537971011687576, 0.93112189365135412},
+    {-28.732482809498315, -51.646542642580208, -137.37528567862554,
+     -2.3905919754559526, 0.99995427563435091},
+    {-28.667032962756863, -60.501845742982056, -133.18390651247537,
+     -2.3229454315258735, 1.0668594543888419},
+    {-28.601583116015409, -69.075272231857227, -128.76319461566746,
+     -2.2509802008750825, 1.1319400220265667},
+    {-28.536133269273954, -77.352087265567448, -124.12148259753555,
+     -2.1748125687929543, 1.1952905111303589},
+    {-28.470683422532499, -85.318088127509483, -119.26670362759386,
+     -2.0945528749268245, 1.2569982003185869},
+    {-28.405233575791044, -92.959579067203919, -114.20642095316374,
+     -2.010305964364584, 1.3171438231913266},
+    {-28.339783729049593, -100.26334797688502, -108.94785459088585,
+     -1.9221715951065859, 1.375802194077153},
+    {-28.274333882308138, -107.21664473161611, -103.49790551848338,
+     -1.8302448069916204, 1.4330427618930996},
+    {-28.208884035566683, -113.8071610387351, -97.863177649383857,
+     -1.734616256460106, 1.488930101690862},
+    {-28.143434188825232, -120.02301165978919, -92.049997835679562,
+     -1.6353725209596024, 1.5435243520202988},
+    {-28.077984342083777, -125.8527168830296, -86.0644341133182,
+     -1.5325963763061743, 1.5968816050403072},
+    {-28.012534495342322, -131.28518613770675, -79.912312376426271,
+     -1.4263670498953493, 1.6490542553036687},
+    {-27.947084648600867, -136.3097026528024, -73.599231644539643,
+     -1.3167604522968426, 1.7000913123003929},
+    {-27.881634801859413, -140.91590907293653, -67.130578066633163,
+     -1.2038493894582583, 1.7500386811352522},
+    {-27.750735108376507, -148.83367906079766, -53.747108796865099,
+     -0.96839072166851603, 1.8468339435232672},
+    {-27.685285261635052, -152.12620742421979, -46.842111834920907,
+     -0.84597488146225586, 1.8937602773941986},
+    {-27.619835414893601, -154.96233206484146, -39.801200484501898,
+     -0.7205184224783554, 1.9397541957982658},
+    {-27.554385568152146, -157.33330536621594, -32.628870485723937,
+     -0.59208125699302427, 1.9848494147506859},
+    {-27.488935721410691, -159.23066902918842, -25.329468368127142,
+     -0.46072115386406948, 2.0290777406531673},
+    {-27.423485874669236, -160.64624457126197, -17.907199454024102,
+     -0.32649385887453464, 2.072469209912168},
+    {-27.358036027927781, -161.57212433077316, -10.366135289894416,
+     -0.18945320635063864, 2.1150522161864709},
+    {-27.29258618118633, -162.00066294011856, -2.710220555681814,
+     -0.049651222820907628, 2.1568536265423255},
+    {-27.259861257815601, -162.02610985767174, 1.1596061607962198,
+     0.021269480241095363, 2.1774692381022129},
+    {-27.227136334444875, -161.92446923532566, 5.0567205032322509,
+     0.092861776595194595, 2.1978988876443011},
+    {-27.16168648770342, -161.33639857210076, 12.9309780810934,
+     0.23803709845019169, 2.2382121229794056},
+    {-27.096236640961969, -160.22954552092943, 20.908951217585326,
+     0.38582758732585049, 2.2778162219984521},
+    {-27.030786794220514, -158.59723691611549, 28.987142571613898,
+     0.53618754778184397, 2.3167329219594617},
+    {-26.965336947479059, -156.43302523564154, 37.162153533437206,
+     0.68907267144146378, 2.3549828831711728},
+    {-26.83443725399615, -150.48419320466868, 53.789506327324219,
+     1.0022477054053733, 2.4295602560060936},
+    {-26.70353756051324, -142.33574943094823, 70.765628451644488,
+     1.3250234784676294, 2.5016945844338379},
+    {-26.57263786703033, -131.94362896608121, 88.066453575407238,
+     1.6570890330138166, 2.5715187918657945},
+    {-26.441738173547424, -119.26683718550814, 105.66911960840071,
+     1.9981500254418436, 2.6391540383529621},
+    {-26.310838480064518, -104.26729869790152, 123.55187064831671,
+     2.3479272760906276, 2.7047110585086211},
+    {-26.179938786581609, -86.909718365593761, 141.69396972831953,
+     2.7061554819399354, 2.768291315906608},
+    {-26.049039093098699, -67.161453119685547, 160.07562091792161,
+     3.0725820700298163, 2.8299880031072022},
+    {-25.983589246357248, -56.381308518545012, 169.35033232127276,
+     3.2587940548862915, 2.8601570852977707},
+    {-25.918139399615793, -44.992393427650626, 178.67789955562435,
+     3.4469661730091832, 2.8898869112368435},
+    {-25.852689552874338, -32.991321996597229, 188.05608289447807,
+     3.6370699943977343, 2.9191871727990937},
+    {-25.787239706132887, -20.374853418643717, 197.48268957758447,
+     3.8290777110707559, 2.9480671888598855},
+    {-25.721789859391432, -7.1398889106048662, 206.9555721799118,
+     4.0229621132751197, 2.9765359240762392},
+    {-25.689064936020706, -0.28954042796603868, 211.70870789349758,
+     4.120599726396498, 2.9906187703247626},
+    {-25.656340012649977, 6.7165312031382074, 216.47262706039126,
+     4.2186965668848018, 3.0046020065053969},
+    {-25.590890165908522, 21.197230307594321, 226.03179288561256,
+     4.416254991917512, 3.0322737441456344},
+    {-25.525440319167068, 36.304898219806262, 235.63104922396278,
+     4.6156118421006687, 3.059559140476849},
+    {-25.459990472425616, 52.042093821677241, 245.26841520604034,
+     4.8167420854237504, 3.0864659090720123},
+    {-25.394540625684161, 68.411247607193758, 254.94194824746342,
+     5.0196211856184139, 3.1130014873449654},
+    {-25.263640932201255, 103.05452448096, 274.38992934083308,
+     5.4305301852017163, 3.1649875187007193},
+    {-25.198191085459801, 121.33288842160428, 284.16067295730841,
+     5.6385133360084447, 3.1904515786222793},
+    {-25.165466162089075, 130.71212034384314, 289.05693955019024,
+     5.7431270632618912, 3.203054230933482},
+    {-25.132741238718346, 140.25169680613348, 293.96017259044959,
+     5.8481518151626863, 3.2154634583375934},
+    {-25.132741218718344, 140.25170268496402, 293.90419664553679,
+     5.847038213775166, -55680.059259936417},
+    {-25.132739221347535, 140.25228877172165, 293.1673559473906,
+     5.832379697362569, -3926.9512081262505},
+    {-25.132737223976722, 140.25287399062898, 292.84053261345343,
+     5.8258782162032574, -2779.2993762716287},
+    {-25.132735226605909, 140.25345864276414, 292.58963471162593,
+     5.8208872228496231, -2269.6443335142671},
+    {-25.1327332292351, 140.25404283644815, 292.3781017825504,
+     5.816679370201725, -1965.548784995809},
+    {-25.132731231864291, 140.25462663436187, 292.19174285737711,
+     5.8129723379790219, -1757.9208657686831},
+    {-25.132729234493478, 140.25521007881466, 292.02327297317458,
+     5.8096211964991546, -1604.6086204777787},
+    {-25.132727237122666, 140.25579320088161, 291.86836207706187,
+     5.8065398021340364, -1485.4289475149442},
+    {-25.132725239751856, 140.25637602463985, 291.7241878338005,
+     5.8036720063367229, -1389.3459913740687},
+    {-25.132721245010234, 140.25754085139778, 291.46073846941772,
+     5.7984317660643958, -1242.4071123564609},
+    {-25.132717250268612, 140.25870467886784, 291.22260738524329,
+     5.7936952157875163, -1133.9244480706777},
+    {-25.132713255526987, 140.25986759500077, 291.00366377790436,
+     5.7893403871527704, -1049.6027495733699},
+    {-25.132709260785365, 140.2610296679409, 290.79991233512305,
+     5.7852877960287978, -981.62767530949282},
+    {-25.132701271302118, 140.26335149412415, 290.42763829436547,
+     5.7778834666290226, -877.68234902683594},
+    {-25.132693281818874, 140.2656704963494, 290.09118348763064,
+     5.771191734900218, -800.94710705581622},
+    {-25.13268529233563, 140.26798692345901, 289.78187255782524,
+     5.7650400103922843, -741.30530939976768},
+    {-25.132677302852386, 140.27030096826658, 289.4940524937054,
+     5.7593158302488092, -693.22755313010464},
+    {-25.132661323885898, 140.27492250471781, 288.96824509986527,
+     5.7488588529467028, -619.71153504610652},
+    {-25.132645344919407, 140.27953606456657, 288.49310372501304,
+     5.7394098346144098, -565.44212574032304},
+    {-25.132629365952916, 140.28414235176984, 288.05635593926678,
+     5.7307246238528409, -523.26281663866473},
+    {-25.132613386986428, 140.28874191177115, 287.65000519140466,
+     5.7226441349777959, -489.26237389154215},
+    {-25.13259740801994, 140.29333518341437, 287.26849686461287,
+     5.7150578629199709, -461.0988756594744},
+    {-25.132581429053449, 140.29792252974613, 286.90778656956167,
+     5.7078853475412226, -437.2731019883326},
+    {-25.13254947112047, 140.30708063088713, 286.23722821030788,
+     5.6945521690750054, -398.89542912730701},
+    {-25.132517513187491, 140.31621820648215, 285.62097165855533,
+     5.6822992664520138, -369.06788929859101},
+    {-25.132485555254512, 140.32533679942287, 285.04770663492013,
+     5.6709016306452131, -345.02434184336715},
+    {-25.132453597321533, 140.33443765103829, 284.50957684662302,
+     5.6602029671497007, -325.10854997670015},
+    {-25.132421639388554, 140.3435217882604, 284.00086209217568,
+     5.6500894773919832, -308.26026547301279},
+    {-25.132357723522595, 140.3616432697946, 283.05536771134882,
+     5.631293546455125, -281.12182929477422},
+    {-25.132293807656637, 140.37970687662911, 282.18667292066817,
+     5.6140254264156946, -260.02966224167562},
+    {-25.132229891790676, 140.39771697301549, 281.37878142356675,
+     5.597966886246688, -243.02763574356831},
+    {-25.132165975924714, 140.41567707020775, 280.62058202453795,
+     5.5828968799059666, -228.94452461060052},
+    {-25.132102060058756, 140.43359007299543, 279.90398465203691,
+     5.5686544639828375, -217.03056986537132},
+    {-25.132038144192798, 140.45145843661075, 279.22288190527644,
+     5.555118138514282, -206.78059779853399},
+    {-25.13197422832684, 140.46928427203403, 278.5725289071259,
+     5.5421935096754202, -197.84015338615666},
+    {-25.131846396594923, 140.50481550273318, 277.34969257063938,
+     5.5178932775949381, -182.92525259773888},
+    {-25.131718564863007, 140.54019611004114, 276.21285230735089,
+     5.4953037054443179, -170.90261247763317},
+    {-25.131590733131091, 140.57543602616391, 275.14629372706293,
+     5.4741121771559076, -160.94401855934817},
+    {-25.131462901399175, 140.61054346787273, 274.13857516782565,
+     5.454091077852917, -152.51929213637473},
+    {-25.131335069667259, 140.64552538033021, 273.1810590220469,
+     5.435068576037728, -145.27120974564369},
+    {-25.131207237935342, 140.68038773496642, 272.2670346714317,
+     5.4169111752905952, -138.94912623672028},
+    {-25.131079406203426, 140.71513573789903, 271.39116547057017,
+     5.3995127126051576, -133.37129351614996},
+    {-25.13095157447151, 140.74977398075305, 270.54912445421775,
+     5.3827871111941219, -128.40227936505542},
+    {-25.130695911007674, 140.81873712669173, 268.95284849449229,
+     5.3510823863951646, -119.9006165915263},
+    {-25.130440247543838, 140.88730526959009, 267.45598194617469,
+     5.321354884984852, -112.85848764139006},
+    {-25.130184584080006, 140.95550165395986, 266.04234280035575,
+     5.2932827037190533, -106.90099102012366},
+    {-25.129928920616173, 141.02334592741784, 264.69971477547597,
+     5.2666228307219916, -101.77552609553831},
+    {-25.129673257152341, 141.09085498325442, 263.41860690493712,
+     5.2411864692662409, -97.304856238732143},
+    {-25.129417593688508, 141.15804354996263, 262.19147141848129,
+     5.2168234787170951, -93.36046347722106},
+    {-25.129161930224672, 141.22492461782693, 261.01218853058128,
+     5.1934121252297496, -89.846580806202098},
+    {-25.128906266760836, 141.291509756306, 259.87571459312039,
+     5.1708520823460988, -86.690187830159076},
+    {-25.128650603297004, 141.3578093557224, 258.77783443700167,
+     5.1490595042745495, -83.834504679165335},
+    {-25.128139276369335, 141.48958869014979, 256.68411077246498,
+     5.1075033441463846, -78.854502054901644},
+    {-25.127627949441667, 141.62032838847929, 254.70813013431339,
+     5.0682883924977284, -74.641471979299126},
+    {-25.127116622514002, 141.75008404332152, 252.83261392837557,
+     5.031070968601238, -71.016794965487918},
+    {-25.126605295586334, 141.87890345585237, 251.04413805510629,
+     4.9955840652140138, -67.855142973987341},
+    {-25.126093968658665, 142.00682830339176, 249.33202675537842,
+     4.9616153443186537, -65.065637945516485},
+    {-25.125582641731, 142.13389534611076, 247.68762394041744,
+     4.9289926421255172, -62.580560723802392},
+    {-25.125071314803332, 142.26013732478808, 246.10379556756456,
+     4.8975740702189317, -60.348276770209296},
+    {-25.124559987875664, 142.38558364451009, 244.57457937055315,
+     4.8672410479741197, -58.328635578539668},
+    {-25.124048660947995, 142.51026090577696, 243.09493188238739,
+     4.8378932703678101, -56.489882493990926},
+    {-25.123537334020327, 142.63419332422293, 241.66054162787293,
+     4.8094449920599986, -54.806528414839796},
+    {-25.122514680164993, 142.87991052795599, 238.91313600002152,
+     4.7549606208141828, -51.826778981056776},
+    {-25.12149202630966, 143.12289261325881, 236.30792093174247,
+     4.7033018716455599, -49.26308014044313},
+    {-25.120469372454323, 143.36327489454814, 233.825906787408,
+     4.6540911182935174, -47.026808478037736},
+    {-25.119446718598986, 143.60117536051055, 231.4519913298785,
+     4.6070280512688679, -45.053701069070883},
+    {-25.11842406474365, 143.83669808776429, 229.17392909423626,
+     4.5618691782480489, -43.295871290819491},
+    {-25.117401410888313, 144.0699357806177, 226.98162754359183,
+     4.5184138245526473, -41.716806421079944},
+    {-25.11637875703298, 144.30097170523797, 224.86665163908253,
+     4.4764942791786089, -40.288114446483235},
+    {-25.115356103177646, 144.52988119219603, 222.82186601905497,
+     4.4359686779607932, -38.987340327444329},
+    {-25.114333449322309, 144.75673282389164, 220.84117076844936,
+     4.3967157482813581, -37.796459605333823},
+    {-25.113310795466973, 144.98158938708437, 218.9193024917476,
+     4.358630852672424, -36.700814284545025},
+    {-25.112288141611636, 145.20450864712686, 217.05168198372562,
+     4.3216229592409388, -35.688345289929948},
+    {-25.110242833900966, 145.64474492450549, 213.463603023057,
+     4.2505284483920436, -33.874453577758274},
+    {-25.108197526190295, 146.07782502657531, 210.05006414200693,
+     4.1828981137117518, -32.292114165072199},
+    {-25.106152218479625, 146.50408329194008, 206.78969504412004,
+     4.118307203043055, -30.895883066456406},
+    {-25.104106910768955, 146.92381468589508, 203.66516699237053,
+     4.0564113217866336, -29.651896711547145},
+    {-25.102061603058285, 147.33728198669795, 200.66219715342206,
+     3.9969266334876368, -28.534334557551222},
+    {-25.100016295347615, 147.74472125845111, 197.76884774859946,
+     3.9396159233820232, -27.523118626753647},
+    {-25.097970987636945, 148.14634610281712, 194.97501985959482,
+     3.8842785330263934, -26.602369294690092},
+    {-25.095925679926275, 148.54235101914716, 192.27207962409204,
+     3.8307429276834091, -25.75934005224752},
+    {-25.093880372215605, 148.9329141000139, 189.65257680958601,
+     3.7788611007242379, -24.983665017690186},
+    {-25.091835064504934, 149.3181992222051, 187.1100293053741,
+     3.7285042888326072, -24.266816169318119},
+    {-25.089789756794264, 149.69835784853063, 184.63875558902677,
+     3.6795596411689138, -23.601704546681763},
+    {-25.087744449083594, 150.07353052505891, 182.23374272570391,
+     3.6319275950764185, -22.982382362051148},
+    {-25.083653833662254, 150.8094329709561, 177.60517955433176,
+     3.5402573471171426, -21.861718364966652},
+    {-25.079563218240914, 151.52685576405869, 173.19408203240266,
+     3.4528927103968625, -20.872685924635281},
+    {-25.075472602819573, 152.22663660720255, 168.97591218634247,
+     3.3693465096913515, -19.991336232632548},
+    {-25.071381987398233, 152.90952204308581, 164.93044299874057,
+     3.2892172254732603, -19.199408403312564},
+    {-25.067291371976889, 153.57618294661592, 161.04076668003935,
+     3.2121692824791852, -18.48270265255481},
+    {-25.063200756555545, 154.22722656112828, 157.29257835269991,
+     3.1379188133334956, -17.829988267936571},
+    {-25.059110141134205, 154.86320601123103, 153.67364705718975,
+     3.0662231458278413, -17.232250292747501},
+    {-25.055019525712865, 155.48462793455045, 150.17341747067184,
+     2.9968728884157416, -16.68215737719278},
+    {-25.050928910291525, 156.09195868540738, 146.78270490137069,
+     2.9296858696738552, -16.173677938445572},
+    {-25.046838294870184, 156.68562943681022, 143.49345817022822,
+     2.8645024270312187, -15.701798131995238},
+    {-25.042747679448844, 157.26604042032477, 140.29857277571679,
+     2.8011816948275974, -15.262311184827142},
+    {-25.038657064027504, 157.83356448262245, 137.19174189131743,
+     2.7395986442183804, -14.851657687400923},
+    {-25.034566448606164, 158.38855009415761, 134.16733623259086,
+     2.6796416967720411, -14.466802889188902},
+    {-25.030475833184823, 158.93132391396134, 131.2203062372912,
+     2.6212107814451207, -14.10514127421426},
+    {-25.026385217763483, 159.46219299142572, 128.34610169247054,
+     2.5642157382235875, -13.764421526865492},
+    {-25.022294602342143, 159.98144666857337, 125.54060514907465,
+     2.5085749957025079, -13.442686931026685},
+    {-25.018203986920799, 160.48935823330228, 122.80007633859535,
+     2.4542144672494013, -13.138227585977724},
+    {-25.010022756078115, 161.47217639824655, 117.50057358568571,
+     2.3490697056069227, -12.575304427903179},
+    {-25.001841525235434, 162.41256341269124, 112.42360892997857,
+     2.2483065660684352, -12.065607742557058},
+    {-24.993660294392754, 163.31225465453016, 107.54888565601182,
+     2.1515233140969765, -11.601193216260397},
+    {-24.985479063550073, 164.17283191018103, 102.85904572273844,
+     2.0583764966266704, -11.175683745853719},
+    {-24.977297832707393, 164.99574500373501, 98.339105703792143,
+     1.9685697460639351, -10.783893069101781},
+    {-24.969116601864709, 165.78232938098412, 93.976024790097568,
+     1.8818452067919653, -10.421554284881587},
+    {-24.960935371022025, 166.53382057255254, 89.758368915846475,
+     1.7979768702908852, -10.085120379086556},
+    {-24.952754140179344, 167.25136621456539, 85.67604608652664,
+     1.7167653238840204, -9.7716152215207277},
+    {-24.944572909336664, 167.93603613323631, 81.720095282509988,
+     1.6380335630425336, -9.4785206040440144},
+    {-24.936391678493983, 168.58883087700295, 77.882516248175307,
+     1.5616236152430969, -9.2036894502426279},
+    {-24.928210447651303, 169.21068899082556, 74.156130883266684,
+     1.48739379104234, -8.9452783196527914},
+    {-24.920029216808619, 169.80249326161521, 70.534469346298209,
+     1.4152164255634689, -8.7016943337443795},
+    {-24.911847985965935, 170.36507611480582, 67.011675688019537,
+     1.344976007515992, -8.4715530177999252},
+    {-24.903666755123254, 170.89922430499772, 63.582429070381316,
+     1.276567617443342, -8.253644500815227},
+    {-24.895485524280573, 171.40568301520818, 60.241877534925891,
+     1.2098956149333173, -8.0469061831167554},
+    {-24.887304293437893, 171.88515945738638, 56.98558195978439,
+     1.1448725279340508, -7.8504004581302267},
+    {-24.879123062595212, 172.33832604962114, 53.809468352109512,
+     1.0814181073972406, -7.6632964196346416},
+    {-24.870941831752528, 172.7658232320405, 50.709787008501486,
+     1.0194585181281859, -7.4848547383636053},
+    {-24.862760600909844, 173.16826197260275, 47.683077371914187,
+     0.9589256425967686, -7.3144150787749629},
+    {-24.854579370067164, 173.54622600539861, 44.726137642636814,
+     0.89975647901129518, -7.1513855666671393},
+    {-24.846398139224483, 173.90027383712871, 41.835998379913761,
+     0.8418926185093234, -6.9952339239588879},
+    {-24.838216908381803, 174.23094055176347, 39.009899471541054,
+     0.78527978911354412, -6.8454799674591245},
+    {-24.830035677539122, 174.53873943879833, 36.245269960492571,
+     0.72986745631782357, -6.7016892303410094},
+    {-24.821854446696438, 174.82416346667441, 33.539710306792955,
+     0.67560847193785689, -6.5634675129810045},
+    {-24.813673215853754, 175.08768661984632, 30.890976734542424,
+     0.62245876428335101, -6.4304562072509057},
+    {-24.805491985011074, 175.32976511528298, 28.296967371985279,
+     0.57037706385916387, -6.3023282677734498},
+    {-24.797310754168393, 175.55083851208391, 25.755709939680553,
+     0.51932465973857778, -6.1787847269354117},
+    {-24.789129523325713, 175.75133072597612, 23.265350780455247,
+     0.46926518251807425, -6.0595516689958986},
+    {-24.780948292483032, 175.93165095894165, 20.824145056520756,
+     0.42016441039178232, -5.9443775934804135},
+    {-24.772767061640348, 176.09219455292273, 18.430447965411048,
+     0.37199009540500361, -5.8330311100220031},
+    {-24.764585830797664, 176.233343775375, 16.08270684817257,
+     0.32471180737801475, -5.725298916504113},
+    {-24.756404599954983, 176.35546854353896, 13.779454081410433,
+     0.27830079335178359, -5.620984020253541},
+    {-24.748223369112303, 176.45892709344491, 11.519300660028623,
+     0.23272985070931598, -5.519904168489675},
+    {-24.740042138269622, 176.54406659896566, 9.3009303903330505,
+     0.18797321238078499, -5.4218904595453195},
+    {-24.731860907426942, 176.61122374560497, 7.1230946239559758,
+     0.1440064427545143, -5.3267861107557115},
+    {-24.723679676584258, 176.66072526322608, 4.9846074722485447,
+     0.10080634309805946, -5.2344453625467704},
+    {-24.715498445741574, 176.69288842140008, 2.8843414486063974,
+     0.058350865448626291, -5.144732501279262},
+    {-24.707317214898893, 176.70802149069186, 0.82122349282282026,
+     0.016619034063471889, -5.057520985932368},
+    {-24.703226599477553, 176.70929572235792, -0.19672630939993882,
+     -0.0039817938075364491, -5.0148160028509077},
+    {-24.699135984056213, 176.70642417286106, -1.2057686626976789,
+     -0.024409126365311458, -4.9726926658322856},
+    {-24.690954753213532, 176.68838800258851, -3.1976098201479357,
+     -0.064752656430423494, -4.8901370784161617},
+    {-24.682773522370852, 176.65419672314982, -5.1552303680010212,
+     -0.10442972227834642, -4.8097508175298778},
+    {-24.674592291528167, 176.60412663813614, -7.0795190845748701,
+     -0.14345767097042508, -4.7314369640364795},
+    {-24.666411060685483, 176.53844694118882, -8.9713257177048593,
+     -0.18185308141571901, -4.6551045715990567},
+    {-24.658229829842803, 176.45742002545194, -10.831463362023824,
+     -0.2196318113012915, -4.5806682014280833},
+    {-24.641867368157442, 176.25034183512304, -14.459813794261292,
+     -0.29339931057632551, -4.4371668190458324},
+    {-24.625504906472077, 175.98486583070527, -17.970421407097433,
+     -0.36487417162306479, -4.3003443702929252},
+    {-24.609142444786713, 175.66287389208475, -21.368675163350954,
+     -0.43416131243284689, -4.1696772311493033},
+    {-24.592779983101348, 175.28616315714919, -24.659551927111067,
+     -0.50135755177038954, -4.0446976951590035},
+    {-24.576417521415983, 174.8564524027978, -27.847659676515654,
+     -0.56655246136360393, -3.924986519577534},
+    {-24.560055059730622, 174.37538776656982, -30.937275048516483,
+     -0.62982910610901144, -3.8101666512134789},
+    {-24.543692598045258, 173.84454789419712, -33.932376099326106,
+     -0.69126468977265043, -3.6998979174596998},
+    {-24.527330136359893, 173.26544858520549, -36.836671005834368,
+     -0.75093112053045707, -3.5938725117919113},
+    {-24.510967674674532, 172.6395469979409, -39.653623306756018,
+     -0.80889550818769451, -3.4918111369351483},
+    {-24.494605212989168, 171.96824546645485, -42.386474180563283,
+     -0.8652206029041507, -3.39345969537864},
+    {-24.478242751303803, 171.25289497423407, -45.038262174964906,
+     -0.91996518362344448, -3.2985864377369203},
+    {-24.461880289618442, 170.49479832353879, -47.611840735774997,
+     -0.97318440308084853, -3.2069794959281044},
+    {-24.445517827933077, 169.6952130339015, -50.109893828210872,
+     -1.0249300951799019, -3.1184447412605203},
+    {-24.412792904562352, 167.97639592668588, -54.889394387328572,
+     -1.124193258057554, -2.9498930116959339},
+    {-24.380067981191623, 166.10569387876393, -59.395341699559602,
+     -1.2181127170232062, -2.7916676815330508},
+    {-24.347343057820897, 164.09178197401008, -63.644359601623243,
+     -1.3070083140176416, -2.6426911809476992},
+    {-24.314618134450171, 161.94281935629914, -67.651398414520983,
+     -1.3911671990988228, -2.5020381284667974},
+    {-24.281893211079442, 159.66650010148558, -71.42996555306911,
+     -1.4708483587366399, -2.3689087434600307},
+    {-24.249168287708716, 157.27009721275283, -74.992316694726156,
+     -1.5462863675357033, -2.2426077252291039},
+    {-24.216443364337991, 154.76050089409691, -78.349615460854267,
+     -1.6176945202497148, -2.1225273180096589},
+    {-24.183718440967262, 152.14425202793549, -81.512067733888713,
+     -1.685267464820611, -2.0081336153879636},
+    {-24.150993517596536, 149.42757160572569, -84.489035373559673,
+     -1.749183430321418, -1.8989553963036181},
+    {-24.11826859422581, 146.61638672214011, -87.289133072295996,
+     -1.8096061234925052, -1.79457495748476},
+    {-24.085543670855081, 143.71635363426734, -89.920311312464548,
+     -1.8666863522220052, -1.69462053359689},
+    {-24.052818747484352, 140.73287830048935, -92.38992779143652,
+     -1.9205634225531143, -1.5987599899968854},
+    {-24.020093824113626, 137.67113474418829, -94.704809218340714,
+     -1.9713663466890194, -1.5066955430147833},
+    {-23.987368900742901, 134.53608153123815, -96.871305025423808,
+     -2.0192148923516089, -1.4181593155828534},
+    {-23.954643977372172, 131.33247660459065, -98.895334252736674,
+     -2.0642204982498242, -1.3329095763506225},
+    {-23.921919054001446, 128.06489068192951, -100.78242663945225,
+     -2.1064870759729928, -1.2507275414164736},
+    {-23.88919413063072, 124.73771939153546, -102.53775877505778,
+     -2.1461117150784061, -1.1714146418194353},
+    {-23.823744283889265, 117.92139293316075, -105.67227077921753,
+     -2.2177930874341629, -1.0206893026203681},
+    {-23.758294437147811, 110.91555565661912, -108.33434581010879,
+     -2.2799268292744155, -0.87946790374206052},
+    {-23.692844590406359, 103.75007695739191, -110.55551385355702,
+     -2.3330992070560166, -0.7466876951072603},
+    {-23.627394743664905, 96.452874661288163, -112.36397180587802,
+     -2.3778324488358078, -0.62144873648170829},
+    {-23.56194489692345, 89.050116429310748, -113.78507798490186,
+     -2.41459434869825, -0.50298308539176118},
+    {-23.496495050181995, 81.566391908015405, -114.84175537668901,
+     -2.4438060896193003, -0.39063082988606052},
+    {-23.43104520344054, 74.02486091830734, -115.55482344638042,
+     -2.4658486730547708, -0.2838212383091101},
+    {-23.365595356699085, 66.447381847224392, -115.94327343736352,
+     -2.4810682472963768, -0.18205778278692816},
+    {-23.30014550995763, 58.854623552807212, -116.02449852806261,
+     -2.4897805569170797, -0.084906129194849411},
+    {-23.234695663216176, 51.26616343783148, -115.81448760405705,
+     -2.492274684436858, 0.0080155769379750517},
+    {-23.169245816474721, 43.70057384163222, -115.32798946076494,
+     -2.4888162172883468, 0.097044630085841521},
+    {-23.10379596973327, 36.175498503204636, -114.57865279061424,
+     -2.4796499445527487, 0.18248026913249166},
+    {-23.038346122991815, 28.707720536362963, -113.57914619762352,
+     -2.4650021661987656, 0.26458905614940975},
+    {-22.97289627625036, 21.313223109157715, -112.34126162934579,
+     -2.4450826808782806, 0.34360935285316396},
+    {-22.907446429508909, 14.00724382038662, -110.87600395526765,
+     -2.4200865054177192, 0.4197550684341928},
+    {-22.874721506138179, 10.392018496833606, -110.06135339715026,
+     -2.4057419314944775, 0.45681090555936538},
+    {-22.841996582767454, 6.804323605028352, -109.19366890437416,
+     -2.3901953690587727, 0.49321881497035003},
+    {-22.809271659396728, 3.2458751474201994, -108.27413780894385,
+     -2.3734676719573855, 0.52899998342640187},
+    {-22.776546736025999, -0.28164913058451102, -107.30391116787052,
+     -2.3555790175634121, 0.56417457807010163},
+    {-22.74382181265527, -3.7766085814946351, -106.2841054549945,
+     -2.3365489391025562, 0.59876180920981148},
+    {-22.711096889284544, -7.2373985502747802, -105.21580415031471,
+     -2.3163963560024525, 0.63277998842895478},
+    {-22.678371965913819, -10.662449319334689, -104.10005923436523,
+     -2.2951396024112825, 0.66624658242804735},
+    {-22.645647042543089, -14.050225100945486, -102.93789259452262,
+     -2.2727964540191556, 0.69917826296526642},
+    {-22.580197195801638, -20.707972464851867, -100.47823909816201,
+     -2.2249194333175275, 0.76349987091684657},
+    {-22.514747349060183, -27.198997380063357, -97.844465372050308,
+     -2.1728972538555835, 0.82586396983476151},
+    {-22.449297502318728, -33.51214200896878, -95.043788953477758,
+     -2.1168544125637103, 0.88637964814430037},
+    {-22.383847655577277, -39.636708577609745, -92.083055975962907,
+     -2.0569085662316642, 0.94514700435892485},
+    {-22.318397808835822, -45.562436044845526, -88.968770504747241,
+     -1.9931710884175706, 1.002258087757774},
+    {-22.252947962094368, -51.279478591123002, -85.707120871162928,
+     -1.9257475687526051, 1.0577977210864642},
+    {-22.187498115352913, -56.778385742863676, -82.304003375688623,
+     -1.854738261785752, 1.1118442223974605},
+    {-22.122048268611458, -62.050083970873018, -78.765043676670842,
+     -1.7802384914879021, 1.1644700403420738},
+    {-22.056598421870007, -67.0858596204436, -75.095616137372815,
+     -1.7023390166752206, 1.2157423149318138},
+    {-21.991148575128552, -71.877343047414712, -71.30086136671423,
+     -1.6211263618889318, 1.265723373900596},
+    {-21.925698728387097, -76.416493848800798, -67.385702157543918,
+     -1.5366831176581837, 1.3144711732418046},
+    {-21.860248881645646, -80.695587089028407, -63.354857999540975,
+     -1.4490882135549503, 1.3620396892027904},
+    {-21.794799034904191, -84.707200433659665, -59.212858321076524,
+     -1.3584171670096068, 1.4084792679440585},
+    {-21.729349188162736, -88.444202111923858, -54.964054594921379,
+     -1.2647423104798636, 1.4538369381715346},
+    {-21.663899341421281, -91.899739637658357, -50.61263142601247,
+     -1.1681329992436158, 1.498156691296429},
+    {-21.598449494679826, -95.067229225487822, -46.162616725161257,
+     -1.0686558018095726, 1.5414797330421963},
+    {-21.532999647938375, -97.94034584548902, -41.617891060230498,
+     -0.96637467470109539, 1.5838447098818429},
+    {-21.46754980119692, -100.51301386520846, -36.982196265610597,
+     -0.86135112316238016, 1.6252879132341269},
+    {-21.402099954455466, -102.77939823286353, -32.259143381567284,
+     -0.75364434915770062, 1.6658434639605799},
+    {-21.336650107714014, -104.73389615999693, -27.452219986953939,
+     -0.64331138787875874, 1.7055434793756965},
+    {-21.271200260972559, -106.37112926576457, -22.564796981767209,
+     -0.53040723384020982, 1.7444182247003603},
+    {-21.205750414231105, -107.68593614852325, -17.600134869873354,
+     -0.41498495752505804, 1.7824962506467907},
+    {-21.14030056748965, -108.67336535349865, -12.561389586847232,
+     -0.29709581343806934, 1.8198045186150507},
+    {-21.074850720748195, -109.32866870811591, -7.4516179131427824,
+     -0.17678934033460705, 1.8563685148017102},
+    {-21.009400874006744, -109.64729499904105, -2.273782508648809,
+     -0.054113454312302141, 1.8922123543659672},
+    {-20.976675950636015, -109.67898436354803, 0.33975783713217456,
+     0.0080984670290879211, 1.9098714001139563},
+    {-20.943951027265289, -109.62488396723165, 2.9692433989872167,
+     0.070885464617487681, 1.927358876664065},
+    {-20.878501180523834, -109.25726059931814, 8.2746716431254832,
+     0.19816249192361507, 1.9618297324458871},
+    {-20.813051333782383, -108.54042969542147, 13.639795037732007,
+     0.32767408341497684, 1.9956454638058858},
+    {-20.747601487040928, -107.47057069517047, 19.061983564091907,
+     0.45937800511538962, 2.0288255775915345},
+    {-20.682151640299473, -106.04403274514927, 24.538680803191863,
+     0.5932332677461345, 2.0613886128949219},
+    {-20.551251946816564, -102.10713708932053, 35.64572390249441,
+     0.86723971840596348, 2.1247331335771888},
+    {-20.420352253333654, -96.703756380798865, 46.941823094691337,
+     1.1493881817594016, 2.1858102264693784},
+    {-20.289452559850744, -89.810339273664098, 58.408861232871963,
+     1.4393897780281371, 2.2447391162328159},
+    {-20.158552866367838, -81.405646004560779, 70.02962440865673,
+     1.7369705274204699, 2.3016284486081169},
+    {-20.027653172884932, -71.470634946943363, 81.787730205926934,
+     2.0418700458788108, 2.3565774908470156},
+    {-19.896753479402022, -59.988358029972773, 93.667563815078864,
+     2.3538403868763709, 2.4096771675522373},
+    {-19.765853785919113, -46.943864063757445, 105.65422095830807,
+     2.6726450094853607, 2.4610109580579036},
+    {-19.700403939177662, -39.831637279276677, 111.68313235771478,
+     2.83453914707844, 2.4860398916111972},
+    {-19.634954092436207, -32.324109138996988, 117.73345673970132,
+     2.9980578560419122, 2.5106556767995816},
+    {-19.569504245694752, -24.419933510247439, 123.80350897938858,
+     3.1631743815540214, 2.5348669857329127},
+    {-19.504054398953301, -16.117873376004397, 129.89163966842196,
+     3.3298625252858374, 2.5586821543700191},
+    {-19.438604552211846, -7.4167985367761586, 135.99623391708522,
+     3.4980966239577813, 2.5821091993751164},
+    {-19.373154705470391, 1.6843166110310326, 142.11571021465994,
+     3.6678515289647375, 2.6051558339311947},
+    {-19.307704858728936, 11.186395223975174, 148.24851934452153,
+     3.8391025870042488, 2.6278294825862649},
+    {-19.242255011987481, 21.090260091126144, 154.39314335069631,
+     4.011825621646552, 2.6501372952020064},
+    {-19.17680516524603, 31.396635647578755, 160.54809455284919,
+     4.1859969157899464, 2.6720861600685466},
+    {-19.111355318504575, 42.106149925012254, 166.71191460688019,
+     4.3615931949489033, 2.6936827162440942},
+    {-18.980455625021669, 64.736636038030269, 179.06046923733064,
+     4.7169697286212067, 2.7358442816336859},
+    {-18.915005778280214, 76.658398650190378, 185.24242593927377,
+     4.896705507539008, 2.756421424056704},
+    {-18.882280854909489, 82.771038512854531, 188.33472945787179,
+     4.9870757379637167, 2.7665866352642507},
+    {-18.865918393224124, 85.865309633823273, 189.88113948894946,
+     5.0323852656212882, 2.7716387092476156},
+    {-18.84955593153876, 88.984885040965793, 191.42769414472127,
+     5.077777291942132, 2.7764505023003831},
+    {-18.849555911538758, 88.984888869277583, 191.39133664508603,
+     5.0768128846984082, -48220.354660099758},
+    {-18.849553914167949, 88.985270532407938, 190.91273887013543,
+     5.0641182210322517, -3400.8475354670009},
+    {-18.849551916797136, 88.985651631844078, 190.70045519857544,
+     5.0584877571715436, -2406.9518646400156},
+    {-18.849549919426323, 88.986032363137156, 190.5374865513368,
+     5.0541654141823589, -1965.577629261199},
+    {-18.849547922055514, 88.986412796645169, 190.40008621127672,
+     5.0505212909773034, -1702.2231410235743},
+    {-18.849545924684705, 88.986792973083382, 190.27903687263483,
+     5.0473108910133497, -1522.412072356306},
+    {-18.849543927313892, 88.987172919930785, 190.16960681272153,
+     5.0444087015059464, -1389.6397588037992},
+    {-18.849541929943079, 88.987552657371282, 190.06898357916745,
+     5.0417401198815606, -1286.4271212045073},
+    {-18.84953993257227, 88.987932201042781, 189.97533401094705,
+     5.0392565200667576, -1203.2168279523455},
+    {-18.849535937830648, 88.988690755252733, 189.80420734208883,
+     5.0347183073392143, -1075.9640034406743},
+    {-18.849531943089026, 88.989448660362726, 189.64952539454313,
+     5.0306163030238009, -982.01523986385882},
+    {-18.849527948347401, 88.990205973496458, 189.50730609364246,
+     5.0268448794299161, -908.9904881868224},
+    {-18.849523953605779, 88.99096273891503, 189.37495440663943,
+     5.0233352012694557, -850.12232963866984},
+    {-18.849515964122531, 88.992474762930868, 189.13313287590958,
+     5.0169228015164569, -760.10300464575857},
+    {-18.849507974639288, 88.993984952551443, 188.91457666567956,
+     5.0111275296907243, -693.64830697272987},
+    {-18.849499985156044, 88.995493469407819, 188.71365096222715,
+     5.0057999180572139, -641.99696865910471},
+    {-18.8494919956728, 88.997000438736691, 188.52668402388355,
+     5.0008425709075564, -600.36038579080912},
+    {-18.849476016706312, 89.00001012045027, 188.1851175632805,
+     4.9917864400180623, -536.69360165629416},
+    {-18.849460037739821, 89.003014620500835, 187.87645977586905,
+     4.9836032278831457, -489.69487400379035},
+    {-18.849444058773329, 89.00601439612015, 187.5927394732737,
+     4.9760814931292385, -453.1664835490779},
+    {-18.849428079806842, 89.009009801586487, 187.32876273421698,
+     4.9690834634632752, -423.72120172933313},
+    {-18.849412100840354, 89.012001121938184, 187.08092172227589,
+     4.962513438653489, -399.3308642753604},
+    {-18.849396121873863, 89.014988592985304, 186.84658952361292,
+     4.9563017381439076, -378.69710826769574},
+    {-18.849364163940884, 89.020952756460801, 186.41096138135356,
+     4.9447546283274777, -345.46101150186774},
+    {-18.849332206007904, 89.026903585407382, 186.01060362797475,
+     4.9341430665826724, -319.62955180098385},
+    {-18.849300248074925, 89.032842081971054, 185.63816999662225,
+     4.9242721892443049, -298.80718011508139},
+    {-18.849268290141946, 89.038769052427924, 185.28855765533643,
+     4.9150066411925719, -281.55955263731278},
+    {-18.849236332208967, 89.044685163797354, 184.95805120774534,
+     4.906247869885715, -266.96846698427811},
+    {-18.849172416343009, 89.056486985374448, 184.34376230095003,
+     4.8899696556734868, -243.46581147369574},
+    {-18.849108500477051, 89.068251205252437, 183.77935712108729,
+     4.8750145694274085, -225.19938520330874},
+    {-18.849044584611089, 89.079980658146994, 183.25444569829409,
+     4.8611070146204751, -210.47512976850632},
+    {-18.848980668745128, 89.091677624741209, 182.76181104268744,
+     4.8480555594642354, -198.27873344972679},
+    {-18.84891675287917, 89.103343991802092, 182.29619845171038,
+     4.8357208226267074, -187.96088523146489},
+    {-18.848852837013212, 89.114981354091583, 181.85364101255641,
+     4.8239975818436314, -179.08409132557003},
+    {-18.848788921147253, 89.126591082780863, 181.43105680301989,
+     4.8128040894835609, -171.34138426982068},
+    {-18.848661089415337, 89.149732279967509, 180.63646814232081,
+     4.7917586104765579, -158.4245978169586},
+    {-18.848533257683421, 89.172775601959373, 179.89773798297122,
+     4.7721946191658615, -148.01258994499369},
+    {-18.848405425951505, 89.195727500210751, 179.20465936869891,
+     4.7538413812438538, -139.38810453956759},
+    {-18.848277594219589, 89.218593311950144, 178.54980058936459,
+     4.7365017757411012, -132.09199239196371},
+    {-18.848149762487672, 89.241377548457677, 177.92755124210976,
+     4.7200269916209008, -125.81488816848817},
+    {-18.848021930755756, 89.264084088541182, 177.33355255604602,
+     4.7043014170807318, -120.33972622638244},
+    {-18.84789409902384, 89.286716313913558, 176.76433819419856,
+     4.6892331118136283, -115.50910764223715},
+    {-18.847766267291924, 89.309277207148298, 176.21709763607308,
+     4.6747475307425974, -111.20574430351559},
+    {-18.847510603828088, 89.354195351719682, 175.17965323974417,
+     4.6472888892860924, -103.8429541844624},
+    {-18.847254940364252, 89.398856773334032, 174.20678345231912,
+     4.621542606696238, -97.744165949438909},
+    {-18.846999276900419, 89.443276571306967, 173.28797737528487,
+     4.5972299045947604, -92.584703993785979},
+    {-18.846743613436587, 89.487467508612596, 172.41529998370643,
+     4.5741403268409924, -88.145808706345946},
+    {-18.846487949972754, 89.531440559165048, 171.58258644113079,
+     4.5521103692260825, -84.273987850953077},
+    {-18.846232286508922, 89.575205290733365, 170.78493408910578,
+     4.5310100048846946, -80.857940951892417},
+    {-18.845976623045086, 89.618770142031863, 170.01836780054003,
+     4.5107338081020307, -77.814730825856017},
+    {-18.84572095958125, 89.662142628869987, 169.27961144306042,
+     4.4911948926262193, -75.081119523305361},
+    {-18.845465296117418, 89.705329501138777, 168.56592701622469,
+     4.4723206449817132, -72.607933873292907},
+    {-18.844953969189749, 89.79117027812714, 167.20484591885048,
+     4.4363293800616157, -68.294950834863329},
+    {-18.844442642262081, 89.876335198846746, 165.92025764228288,
+     4.4023657476124178, -64.646195589114555},
+    {-18.843931315334416, 89.960860379950986, 164.7009385126654,
+     4.3701321066331458, -61.506977642655585},
+    {-18.843419988406747, 90.044776876980151, 163.53816854971083,
+     4.3393972179765212, -58.768758579640746},
+    {-18.842908661479079, 90.128111767547665, 162.42501297147064,
+     4.3099771879571653, -56.352834777631422},
+    {-18.842397334551414, 90.21088893515649, 161.35584888979605,
+     4.2817229152130469, -54.200558985558693},
+    {-18.841886007623746, 90.293129652356086, 160.3260420793932,
+     4.2545115179691297, -52.267213770219001},
+    {-18.841374680696077, 90.374853024844839, 159.33171945994667,
+     4.228240299875516, -50.518027262642093},
+    {-18.840863353768409, 90.456076336452981, 158.36960477404136,
+     4.2028223919570395, -48.925498693120971},
+    {-18.840352026840741, 90.536815321790669, 157.43689724542244,
+     4.1781835344990199, -47.467553482815717},
+    {-18.839329372985407, 90.69689677723629, 155.65035124831113,
+     4.1309950096075454, -44.886789533410308},
+    {-18.838306719130074, 90.855199643085228, 153.95620367223654,
+     4.0862537691855252, -42.666348132322554},
+    {-18.837284065274737, 91.01181185140598, 152.342118202455,
+     4.0436327677217392, -40.729477524796813},
+    {-18.8362614114194, 91.166810078785389, 150.79828374338683,
+     4.002871919476708, -39.020523092394242},
+    {-18.835238757564063, 91.320261963824933, 149.31674495208884,
+     3.9637603450108791, -37.498012754942465},
+    {-18.834216103708727, 91.472227756977205, 147.890945037021,
+     3.9261242470266433, -36.130324703437694},
+    {-18.833193449853393, 91.622761576990243, 146.51540393559719,
+     3.889818376413952, -34.892870010982229},
+    {-18.83217079599806, 91.771912386983658, 145.18548587846993,
+     3.8547198687610313, -33.766201432085943},
+    {-18.831148142142723, 91.919724765828249, 143.89722774753542,
+     3.8207236930366459, -32.73470880558942},
+    {-18.830125488287386, 92.066239526929238, 142.64720985365483,
+     3.787739225168294, -31.785697484465679},
+    {-18.829102834432049, 92.21149422119683, 141.43245698338905,
+     3.7556876242865114, -30.908723611409492},
+    {-18.827057526721379, 92.498359712132881, 139.09862261035059,
+     3.694114771066241, -29.337559879115044},
+    {-18.825012219010709, 92.780570477673521, 136.87826602972237,
+     3.6355425546947022, -27.966941234520288},
+    {-18.822966911300039, 93.058343897859686, 134.75750143062342,
+     3.5796031004475739, -26.757510203540935},
+    {-18.820921603589369, 93.33187176865286, 132.72506870764011,
+     3.5259981286550786, -25.67993859168336},
+    {-18.818876295878699, 93.601324970731881, 130.77168664742081,
+     3.4744818072920638, -24.711863931373941},
+    {-18.816830988168029, 93.866857025204013, 128.88959762551073,
+     3.4248486821866062, -23.835897162990012},
+    {-18.814785680457359, 94.128606855981303, 127.07223875486666,
+     3.3769249597898616, -23.038285264852156},
+    {-18.812740372746688, 94.386700972936225, 125.31399903854658,
+     3.3305620700555747, -22.307988698139972},
+    {-18.810695065036018, 94.641255223279416, 123.61003653451843,
+     3.2856318202796229, -21.636029709097603},
+    {-18.808649757325348, 94.892376215164816, 121.95613834373042,
+     3.2420226841704181, -21.015022260281317},
+    {-18.806604449614678, 95.140162488427436, 120.34861176481148,
+     3.19963691710646, -20.438826646341454},
+    {-18.804559141904008, 95.384705487458419, 118.784198532934,
+     3.1583882833029504, -19.902291503687788},
+    {-18.800468526482668, 95.864396733691351, 115.77345412760694,
+     3.0790044930137364, -18.931410702462568},
+    {-18.796377911061327, 96.332067652042596, 112.90423681823127,
+     3.0033508943174945, -18.074544728273491},
+    {-18.792287295639987, 96.788263459595129, 110.16059520383125,
+     2.9310055096217504, -17.310951209347746},
+    {-18.788196680218647, 97.233470110991234, 107.52937940229052,
+     2.8616205491265685, -16.624814028132551},
+    {-18.784106064797303, 97.668124366480882, 104.99959665387132,
+     2.7949053388983929, -16.003834367919335},
+    {-18.780015449375959, 98.092621614263578, 102.5619458661745,
+     2.7306139907776945, -15.438284925996474},
+    {-18.775924833954619, 98.507322053126714, 100.20847386892517,
+     2.6685362972828615, -14.920357477622581},
+    {-18.771834218533279, 98.912555652725644, 97.932316599522977,
+     2.608490876795492, -14.4437019875904},
+    {-18.767743603111938, 99.308626185841177, 95.72750089596029,
+     2.5503199244497194, -14.003094168999059},
+    {-18.763652987690598, 99.695814544706437, 93.588790401616237,
+     2.4938851316162345, -13.594191219003481},
+    {-18.759562372269258, 100.07438149705706, 91.511564143834207,
+     2.4390644709044049, -13.21334936002448},
+    {-18.755471756847918, 100.44456999810491, 89.491719696568637,
+     2.3857496323411276, -12.857485515808388},
+    {-18.751381141426577, 100.80660714642197, 87.525595103211842,
+     2.3338439564285083, -12.523971035977512},
+    {-18.747290526005237, 101.16070585135559, 85.609905299346991,
+     2.2832607512161163, -12.210549047664134},
+    {-18.743199910583897, 101.5070662644867, 83.741689873494607,
+     2.2339219096256722, -11.915269467130015},
+    {-18.739109295162557, 101.84587701642124, 81.918269787949711,
+     2.1857567640393842, -11.636437378212216},
+    {-18.735018679741213, 102.17731629171278, 80.137211249666279,
+     2.1387011302081396, -11.372571645329348},
+    {-18.726837448898529, 102.81874644187734, 76.693492306812473,
+     2.0476893793757851, -10.884688993822813},
+    {-18.718656218055848, 103.43260624097131, 73.394923670087493,
+     1.9604752289667944, -10.442920846367963},
+    {-18.710474987213168, 104.02002770402581, 70.228294161979363,
+     1.8767106182492355, -10.040385501373521},
+    {-18.702293756370487, 104.58204286618363, 67.182303803900112,
+     1.7960979727691442, -9.6715587518336541},
+    {-18.694112525527807, 105.11959785000816, 64.247197099919845,
+     1.7183805064879885, -9.3319478915540302},
+    {-18.685931294685123, 105.63356430282963, 61.414482162761658,
+     1.6433347954198543, -9.0178565698757414},
+    {-18.677750063842439, 106.12474880491523, 58.676712324087923,
+     1.570765004444459, -8.7262120133874816},
+    {-18.669568832999758, 106.59390068945672, 56.027314031274962,
+     1.5004983385648092, -8.4544359628771062},
+    {-18.661387602157077, 107.04171860359659, 53.460449573749798,
+     1.4323814153983458, -8.2003468274960039},
+    {-18.653206371314397, 107.46885605989149, 50.970906390295909,
+     1.36627734062603, -7.962084507618532},
+    {-18.645025140471716, 107.87592616971769, 48.554006922902573,
+     1.3020633267345159, -7.73805192997236},
+    {-18.636843909629032, 108.26350570754728, 46.205534538136121,
+     1.2396287365551006, -7.5268690744870792},
+    {-18.628662678786348, 108.63213862310073, 43.92167214734846,
+     1.178873462488665, -7.3273364562516488},
+    {-18.620481447943668, 108.98233909431201, 41.698950961344821,
+     1.1197065735899594, -7.1384058470605947},
+    {-18.612300217100987, 109.31459419561253, 39.534207405672205,
+     1.0620451783103133, -6.9591565992367306},
+    {-18.604118986258307, 109.62936624175349, 37.424546661643426,
+     1.0058134623113997, -6.7887763473464595},
+    {-18.595937755415626, 109.92709485624835, 35.36731162820621,
+     0.95094186949260784, -6.6265451621570248},
+    {-18.587756524572942, 110.20819880474164, 33.360056350524616,
+     0.89736640100764054, -6.4718224499140282},
+    {-18.579575293730258, 110.47307762660218, 31.400523153532976,
+     0.84502801213462586, -6.3240360519550487},
+    {-18.571394062887578, 110.72211309246957, 29.486622867665965,
+     0.79387209080310772, -6.1826731208138419},
+    {-18.563212832044897, 110.95567051094464, 27.616417650307881,
+     0.74384800465776091, -6.0472724404693734},
+    {-18.555031601202217, 111.17409990395183, 25.788105998070566,
+     0.69490870595983534, -5.917417928132795},
+    {-18.546850370359536, 111.37773706728109, 24.000009617600611,
+     0.64701038554653967, -5.7927331085674512},
+    {-18.538669139516852, 111.56690453038242, 22.250561880622335,
+     0.60011216860203975, -5.6728763934700428},
+    {-18.530487908674168, 111.74191242738054, 20.538297635521488,
+     0.55417584622549143, -5.5575370308591934},
+    {-18.522306677831487, 111.90305928965275, 18.861844185490099,
+     0.50916563777839263, -5.4464316149036174},
+    {-18.514125446988807, 112.05063276878209, 17.21991327390883,
+     0.46504797980369983, -5.3393010667894893},
+    {-18.505944216146126, 112.18491029762576, 15.611293942778619,
+     0.42179133797339635, -5.2359080132903273},
+    {-18.497762985303446, 112.30615969612117, 14.034846150612303,
+     0.37936603906545485, -5.1360345025674858},
+    {-18.489581754460762, 112.41463972765088, 12.489495053293444,
+     0.33774412042284979, -5.039480007098768},
+    {-18.481400523618078, 112.51060061104845, 10.974225865564055,
+     0.29689919472119219, -4.9460596720293672},
+    {-18.473219292775397, 112.59428449269555, 9.4880792326306533,
+     0.25680632818399174, -4.8556027740770746},
+    {-18.465038061932717, 112.66592588262927, 8.0301470512801298,
+     0.21744193064608347, -4.7679513617174827},
+    {-18.456856831090036, 112.72575205811737, 6.5995686882393061,
+     0.17878365608608193, -4.6829590519737385},
+    {-18.448675600247356, 112.77398343776926, 5.1955275505358811,
+     0.14081031243419503, -4.6004899629308165},
+    {-18.440494369404671, 112.81083392888465, 3.817247968597933,
+     0.10350177961962004, -4.5204177642428647},
+    {-18.432313138561987, 112.83651125046951, 2.4639923579004943,
+     0.066838934955635323, -4.4426248305222105},
+    {-18.424131907719307, 112.85121723406729, 1.1350586292975655,
+     0.030803585074800754, -4.3670014846885845},
+    {-18.415950676876626, 112.85514810432606, -0.17022217810244861,
+     -0.004621596275129646, -4.2934453201945626},
+    {-18.407769446033946, 112.84849474102869, -1.4524880644741958,
+     -0.039453125179899032, -4.2218605925897412},
+    {-18.399588215191265, 112.83144292415167, -2.7123480574358854,
+     -0.073706759784887124, -4.152157672192299},
+    {-18.391406984348581, 112.80417356330837, -3.9503840386643421,
+     -0.10739754826877003, -4.084252550744341},
+    {-18.383225753505897, 112.76686291287203, -5.1671524247380294,
+     -0.14053987298046952, -4.0180663958685763},
+    {-18.375044522663217, 112.71968277389119, -6.3631857161931649,
+     -0.17314749110798089, -3.9535251479467113},
+    {-18.366863291820536, 112.6628006838216, -7.5389939272172102,
+     -0.20523357220649133, -3.890559154726879},
+    {-18.358682060977856, 112.59638009502088, -8.6950659070419611,
+     -0.23681073287727136, -3.8291028395563229},
+    {-18.342319599292491, 112.43555780404762, -10.949857993432165,
+     -0.29848618475316852, -3.7104755311787652},
+    {-18.325957137607126, 112.23844796990961, -13.131093765103488,
+     -0.35826488260623679, -3.5971893052356338},
+    {-18.309594675921762, 112.00622711494218, -15.242035986654638,
+     -0.41623084116380932, -3.4888387047781868},
+    {-18.293232214236397, 111.74002038084318, -17.285706567441427,
+     -0.47246179256362136, -3.3850602746141991},
+    {-18.276869752551036, 111.44090526479414, -19.264911039392498,
+     -0.52702982787037567, -3.2855271245601565},
+    {-18.260507290865672, 111.10991498125567, -21.182259918098694,
+     -0.58000195670069232, -3.1899443289767948},
+    {-18.244144829180307, 110.7480414964747, -23.040187419417176,
+     -0.6314405973845898, -3.0980450146772678},
+    {-18.227782367494946, 110.35623827565568, -24.840967921490169,
+     -0.68140400792222311, -3.0095870186848508},
+    {-18.211419905809581, 109.93542277698674, -26.58673049586514,
+     -0.72994666625043803, -2.9243500202589088},
+    {-18.195057444124217, 109.48647872181725, -28.279471777834605,
+     -0.77711960692289483, -2.842133069642665},
+    {-18.178694982438856, 109.01025816625656, -29.921067402550786,
+     -0.82297072016047912, -2.7627524502583323},
+    {-18.162332520753491, 108.50758339607269, -31.513282197788367,
+     -0.86754501828934116, -2.6860398224422379},
+    {-18.145970059068127, 107.97924866385678, -33.057779294899667,
+     -0.91088487381195782, -2.6118406059190211},
+    {-18.129607597382766, 107.42602178500856, -34.556128295260535,
+     -0.95303023271858189, -2.5400125655505383},
+    {-18.096882674012036, 106.24783936476177, -37.420236068848979,
+     -1.0338862428109283, -2.4029555045017585},
+    {-18.064157750641311, 104.97870298528363, -40.116553118058569,
+     -1.1103909097736471, -2.2739340863401134},
+    {-18.031432827270585, 103.62393960956986, -42.654931777533903,
+     -1.1827937409672444, -2.1521456963511132},
+    {-17.998707903899856, 102.18856961344459, -45.044279716264306,
+     -1.2513198157547847, -2.0368966132803008},
+    {-17.96598298052913, 100.67733559406425, -47.292684809055245,
+     -1.3161730382442562, -1.9275837020839692},
+    {-17.933258057158405, 99.094727440485642, -49.407519464517762,
+     -1.3775388528688406, -1.8236797344351625},
+    {-17.900533133787675, 97.445004270472737, -51.395528401757858,
+     -1.4355865274411184, -1.7247215167767425},
+    {-17.86780821041695, 95.732213722303996, -53.262902981528491,
+     -1.4904710850454552, -1.6303002125225741},
+    {-17.835083287046224, 93.960209000066527, -55.015344530932126,
+     -1.5423349486371687, -1.5400533946349388},
+    {-17.802358363675495, 92.132663999824999, -56.658118594014283,
+     -1.5913093489237171, -1.4536584743676837},
+    {-17.769633440304766, 90.25308678743103, -58.196101651650807,
+     -1.6375155359043998, -1.3708272330843811},
+    {-17.73690851693404, 88.324831653351609, -59.633821552862017,
+     -1.6810658265482834, -1.2913012447476919},
+    {-17.704183593563315, 86.351109933287063, -60.975492664334396,
+     -1.7220645149235565, -1.2148480225173917},
+    {-17.671458670192585, 84.334999753528095, -62.225046559615713,
+     -1.7606086662380083, -1.1412577578353866},
+    {-17.63873374682186, 82.279454835622204, -63.386158922431548,
+     -1.7967888124013562, -1.0703405472350029},
+    {-17.606008823451134, 80.187312474840027, -64.462273221128086,
+     -1.8306895636467191, -1.0019240229229665},
+    {-17.540558976709679, 75.904045330902619, -66.372243491171716,
+     -1.891964890608693, -0.87197932138903855},
+    {-17.475109129968224, 71.505828125760701, -67.978598353102853,
+     -1.9450121268921217, -0.75032483484783485},
+    {-17.409659283226773, 67.011830833972212, -69.302380430131322,
+     -1.9903428120761748, -0.63603778906740216},
+    {-17.344209436485318, 62.439920042311513, -70.362435579570288,
+     -2.0284128785817042, -0.52833668006965151},
+    {-17.278759589743864, 57.806791743554768, -71.175737295288741,
+     -2.0596309858242501, -0.42655454935314624},
+    {-17.213309743002409, 53.128084934712412, -71.757651365524183,
+     -2.0843653090799479, -0.33011819449745722},
+    {-17.147859896260954, 48.418479485282916, -72.122153749585991,
+     -2.1029491197706847, -0.23853181714904309},
+    {-17.082410049519499, 43.691781003184587, -72.282011433509851,
+     -2.115685410430217, -0.15136403041643665},
+    {-17.016960202778044, 38.96099486724281, -72.248933702095954,
+     -2.1228507571611175, -0.068237439044690582},
+    {-16.951510356036589, 34.238391166949171, -72.033699558012074,
+     -2.1246985680057766, 0.01117978906793545},
+    {-16.886060509295135, 29.535561958726976, -71.646265748877951,
+     -2.1214618326589378, 0.087180794887121604},
+    {-16.820610662553683, 24.863471988671552, -71.095858907762519,
+     -2.113355464140112, 0.16002567262282585},
+    {-16.755160815812228, 20.232503827141414, -70.391054585924508,
+     -2.1005783041931432, 0.2299461376454866},
+    {-16.689710969070774, 15.652498197780242, -69.539845398633915,
+     -2.0833148497150296, 0.29714941160781144},
+    {-16.624261122329322, 11.132790152896456, -68.549700072489884,
+     -2.0617367463151646, 0.36182147541955251},
+    {-16.591536198958593, 8.8983347401227029, -68.004729869724471,
+     -2.0493801494400787, 0.39326129755714717},
+    {-16.558811275587868, 6.6822416416079813, -67.427614844679127,
+     -2.0360040863587088, 0.42412980822214835},
+    {-16.526086352217142, 4.4855495045014582, -66.819163070107507,
+     -2.0216269492366243, 0.45444543156098427},
+    {-16.493361428846413, 2.3092709312855138, -66.180158398362082,
+     -2.0062665419619949, 0.48422570573521023},
+    {-16.460636505475684, 0.15439325390716868, -65.511361578678191,
+     -1.9899401082359613, 0.51348733742900121},
+    {-16.427911582104958, -1.9781207275239931, -64.813511307032044,
+     -1.9726643579465653, 0.54224625230116275},
+    {-16.395186658734232, -4.0873320393658021, -64.087325213521368,
+     -1.9544554919531836, 0.57051764173387265},
+    {-16.362461735363503, -6.1723248604292049, -63.333500791788168,
+     -1.9353292253973045, 0.59831600619546688},
+    {-16.329736811992777, -8.232205877470637, -62.552716274624174,
+     -1.9153008096457691, 0.62565519550361159},
+    {-16.297011888622052, -10.266103668537683, -61.745631459548122,
+     -1.8943850529634991, 0.65254844624769859},
+    {-16.231562041880597, -14.252569823574547, -60.055112580207776,
+     -1.8499486502055029, 0.70504721875937038},
+    {-16.166112195139142, -18.125167947999191, -58.266882371152654,
+     -1.802130334981606, 0.75590721653401172},
+    {-16.100662348397691, -21.87765759756849, -56.385629684155461,
+     -1.7510344749812996, 0.80521551612391873},
+    {-16.035212501656236, -25.50409758756323, -54.415813429294744,
+     -1.6967599719577857, 0.85305219482174433},
+    {-15.969762654914781, -28.998831524128637, -52.361680020563462,
+     -1.6394006959285921, 0.89949104523763401},
+    {-15.904312808173326, -32.356474419432814, -50.22727908629507,
+     -1.5790458755465044, 0.94460020231517217},
+    {-15.838862961431873, -35.571900284038385, -48.016477652856452,
+     -1.515780449953323, 0.98844269520663963},
+    {-15.77341311469042, -38.640230602613279, -45.732972980967972,
+     -1.4496853866832093, 1.0310769344374142},
+    {-15.707963267948966, -41.556823609947855, -43.380304209522691,
+     -1.3808379695551383, 1.0725571431527878},
+    {-15.642513421207511, -44.31726429375837, -40.96186294107104,
+     -1.3093120599639869, 1.112933739889139},
+    {-15.577063574466058, -46.917355058890834, -38.480902885571787,
+     -1.2351783345305765, 1.1522536791906717},
+    {-15.511613727724605, -49.353106994698905, -35.940548664049878,
+     -1.1585045016886837, 1.190560755459902},
+    {-15.44616388098315, -51.620731693585476, -33.343803861021456,
+     -1.0793554994607217, 1.2278958746500488},
+    {-15.380714034241695, -53.716633574131691, -30.69355840358514,
+     -0.99779367639411432, 1.2642972977531735},
+    {-15.315264187500242, -55.637402667057536, -27.992595335658432,
+     -0.91387895739026703, 1.2998008594869326},
+    {-15.249814340758789, -57.379807826416339, -25.243597047706519,
+     -0.82766899595088672, 1.3344401651172375},
+    {-15.184364494017334, -58.940790332177706, -22.449151015280634,
+     -0.73921931418748665, 1.3682467679595802},
+    {-15.118914647275879, -60.317457853628625, -19.611755093581507,
+     -0.64858343178473943, 1.4012503297661998},
+    {-15.053464800534424, -61.507078745931622, -16.733822409955941,
+     -0.55581298497346143, 1.4334787659200714},
+    {-14.98801495379297, -62.507076654759295, -13.817685891608214,
+     -0.4609578364515648, 1.4649583771118329},
+    {-14.922565107051517, -63.315025406252694, -10.865602461760762,
+     -0.36406617708862682, 1.4957139689657308},
+    {-14.857115260310064, -63.928644161585204, -7.8797569339513727,
+     -0.2651846201597996, 1.5257689608999929},
+    {-14.791665413568609, -64.345792817255742, -4.8622656310416668,
+     -0.16435828877596975, 1.5551454853511408},
+    {-14.726215566827156, -64.564467633904485, -1.8151797527659392,
+     -0.061630897107566578, 1.583864478357049},
+    {-14.693490643456428, -64.598787443626406, -0.28116281719788144,
+     -0.0095675977894025457, 1.5979836364674711},
+    {-14.660765720085703, -64.582797077886838, 1.2595114867696717,
+     0.042955174061751152, 1.6119457623767266},
+    {-14.595315873344248, -64.399037861193904, 4.359877932365305,
+     0.14935880696929102, 1.6394081221232697},
+    {-14.529866026602795, -64.011571166525158, 7.4840457544091539,
+     0.25754008126112732, 1.6662693740980863},
+    {-14.464416179861342, -63.418899045341213, 10.630194893271501,
+     0.36746021274165946, 1.6925464304373241},
+    {-14.398966333119887, -62.619640977763865, 13.796556667214434,
+     0.47908149613073903, 1.718255357613947},
+    {-14.268066639636977, -60.396412478118037, 20.183086973223972,
+     0.70728177415274152, 1.7680291820795218},
+    {-14.137166946154069, -57.333068600495515, 26.630432992562199,
+     0.94185889909883413, 1.8157044169702194},
+    {-14.006267252671162, -53.422474704874269, 33.126083198982641,
+     1.1825450207893577, 1.8613841525706334},
+    {-13.875367559188252, -48.659091603920395, 39.65816387391483,
+     1.429085164942288, 1.9051622151607461},
+    {-13.744467865705344, -43.038895294554528, 46.215390842734713,
+     1.6812360905600987, 1.9471242111695284},
+    {-13.613568172222436, -36.55930265510645, 52.787026464588493,
+     1.9387652743494848, 1.98734842811553},
+    {-13.548118325480981, -32.996802402024777, 56.075031903619283,
+     2.0694767552389428, 2.00683152724678},
+    {-13.482668478739528, -29.219102467287371, 59.362841178883038,
+     2.2014500049634376, 2.0259066150470626},
+    {-13.417218631998075, -25.226255275394124, 62.649249326413752,
+     2.3346585847906134, 2.0445817497997805},
+    {-13.35176878525662, -21.018391206116366, 65.933079019617225,
+     2.4690765725520309, 2.0628646611255821},
+    {-13.286318938515166, -16.595716815168306, 69.213179674248664,
+     2.6046785416843115, 2.0807627666705031},
+    {-13.220869091773713, -11.958513112001889, 72.488426597805926,
+     2.7414395413274937, 2.0982831877345314},
+    {-13.15541924503226, -7.1071338918821185, 75.757720180609709,
+     2.8793350774137161, 2.1154327639192996},
+    {-13.089969398290805, -2.0420041196209562, 79.019985126046578,
+     3.0183410946844704, 2.1322180668669057},
+    {-13.057244474920077, 0.57056534826167804, 80.648152296573699,
+     3.0882531322546654, 2.1404760994346388},
+    {-13.02451955154935, 3.2363816375306156, 82.274169717631253,
+     3.1584339595791162, 2.148645413155803},
+    {-12.959069704807897, 8.7274607301613543, 85.519245120713308,
+     3.2995904439415558, 2.1647208764142363},
+    {-12.893619858066444, 14.430603902358046, 88.754204716803258,
+     3.4417877094956109, 2.1804502987066194},
+    {-12.828170011324989, 20.345116724807298, 91.978063468637799,
+     3.5850032930432616, 2.1958393012439821},
+    {-12.697270317842081, 32.805156052488599, 98.388642588281428,
+     3.8744013526287873, 2.2256174875315788},
+    {-12.631820471100628, 39.348980172601316, 101.57349546940659,
+     4.0205406537319304, 2.2400168972767629},
+    {-12.599095547729901, 42.698941188236709, 103.16041386400934,
+     4.0939610892385341, 2.2470963256612055},
+    {-12.582733086044538, 44.393380626740104, 103.95244716877298,
+     4.1307578591199015, 2.2506062295356024},
+    {-12.566370624359173, 46.10077177082681, 104.74351145173847,
+     4.1676118977702004, 2.2539312406564354},
+    {-12.566370604359172, 46.100773865565166, 104.72372087323336,
+     4.1668244623036008, -39371.768132724312},
+    {-12.566368606988361, 46.100982702170263, 104.46319899811103,
+     4.1564592868944397, -2776.7933181002481},
+    {-12.56636660961755, 46.101191231926165, 104.34764017551589,
+     4.1518620066222809, -1965.2808570006432},
+    {-12.566364612246739, 46.10139956127653, 104.25892506196553,
+     4.1483328026451831, -1604.9002680533877},
+    {-12.566362614875928, 46.101607728525181, 104.18412757990335,
+     4.1453573628605653, -1389.8721990217066},
+    {-12.566360617505117, 46.101815755826138, 104.11823046269802,
+     4.142736056677375, -1243.0570501586903},
+    {-12.566358620134306, 46.10202365814262, 104.0586580860038,
+     4.140366403330118, -1134.6488866659506},
+    {-12.566356622763493, 46.10223144645893, 104.00387954396915,
+     4.1381874900625508, -1050.3760992503896},
+    {-12.566354625392682, 46.102439129289685, 103.95289698974844,
+     4.1361596138506256, -982.43515911090731},
+    {-12.566350630651058, 46.1028542047139, 103.8597350721367,
+     4.1324541278837357, -878.53362616305367},
+    {-12.566346635909436, 46.103268926761992, 103.77552454460424,
+     4.1291048047352357, -801.82474869976352},
+    {-12.566342641167815, 46.10368332652979, 103.69809783871389,
+     4.1260253997449903, -742.20025811449352},
+    {-12.566338646426193, 46.104097428111075, 103.62604239621091,
+     4.1231597091202721, -694.13457948102393},
+    {-12.566330656942949, 46.10492481091503, 103.49438684991458,
+     4.1179239061616411, -620.6340564878351},
+    {-12.566322667459703, 46.105751195005773, 103.37539538951367,
+     4.113191986435405, -566.37397608957497},
+    {-12.566314677976457, 46.106576668361839, 103.26600080665901,
+     4.108841910016845, -524.20079179918457},
+    {-12.566306688493214, 46.107401299154652, 103.16420445494833,
+     4.1047941536161261, -490.20462409972322},
+    {-12.566290709526724, 46.109048242972285, 102.97823045622472,
+     4.0973996558170951, -438.22083922305291},
+    {-12.566274730560234, 46.110692365469276, 102.81016981023883,
+     4.090717894310087, -399.84647257124232},
+    {-12.566258751593745, 46.112333915535565, 102.65568353920459,
+     4.084576227836509, -370.02110581754351},
+    {-12.566242772627255, 46.113973086019264, 102.51194442084464,
+     4.0788621657120911, -345.97907729075172},
+    {-12.566226793660766, 46.115610032075757, 102.3769885900842,
+     4.0734975689651689, -326.0643970332132},
+    {-12.566210814694276, 46.117244882064661, 102.24938612978667,
+     4.0684255436102319, -309.21695559650442},
+    {-12.566178856761297, 46.120508712602678, 102.01216415947417,
+     4.0589969839791831, -282.07970292905856},
+    {-12.566146898828318, 46.123765281677635, 101.79414131672094,
+     4.0503322990045714, -260.9883187047796},
+    {-12.566114940895337, 46.1270151348021, 101.59131877321811,
+     4.0422723829541747, -243.9868437336134},
+    {-12.566082982962357, 46.130258710865192, 101.40091887724786,
+     4.0347067186621182, -229.9041401028837},
+    {-12.566051025029378, 46.133496372958128, 101.22091920514423,
+     4.0275548381719064, -217.99049790596337},
+    {-12.565987109163419, 46.139955139785918, 100.88635399765843,
+     4.0142629910900389, -198.80052880454451},
+    {-12.565923193297461, 46.146393426812736, 100.57894306427802,
+     4.0020514814990209, -183.88593372079174},
+    {-12.565859277431503, 46.152812777127494, 100.29303074501888,
+     3.9906952851663267, -171.86351752114297},
+    {-12.565795361565545, 46.15921443223268, 100.02468854642096,
+     3.9800380981995835, -161.90509659943717},
+    {-12.565731445699587, 46.165599419208597, 99.771056119613817,
+     3.969966115810903, -153.48050959907246},
+    {-12.565667529833629, 46.171968606186567, 99.529974107603522,
+     3.9603934240380667, -146.23254348380908},
+    {-12.565603613967671, 46.178322739583869, 99.299764887304207,
+     3.9512532759239916, -139.91055970624217},
+    {-12.565475782235755, 46.190988371851695, 98.866880682043771,
+     3.9340683311735511, -129.36387874678593},
+    {-12.565347950503837, 46.203600681131491, 98.464404621348194,
+     3.9180930368665212, -120.8623529658573},
+    {-12.565220118771919, 46.21616317947808, 98.086780567314676,
+     3.9031063379772029, -113.82034299975567},
+    {-12.565092287040002, 46.228678772412337, 97.729963064848434,
+     3.8889472847585025, -107.86295348846841},
+    {-12.564964455308086, 46.241149915850706, 97.390898075324287,
+     3.8754943725360627, -102.73758748616611},
+    {-12.56483662357617, 46.253578721422535, 97.067212879386304,
+     3.8626532038328762, -98.267010698745523},
+    {-12.564708791844254, 46.265967030158428, 96.757020550638757,
+     3.8503487089746042, -94.32270669678141},
+    {-12.564580960112336, 46.278316465816346, 96.458791154753627,
+     3.8385200215181396, -90.808909531906622},
+    {-12.564325296648502, 46.302904355126437, 95.893384667967865,
+     3.8160976576094843, -84.796997431347663},
+    {-12.564069633184667, 46.327352325798451, 95.363135008285724,
+     3.795073483053979, -79.817152451979865},
+    {-12.563813969720833, 46.351668598558504, 94.862320358525878,
+     3.7752198730077864, -75.604275808717532},
+    {-12.563558306257001, 46.37586012229518, 94.386621092741706,
+     3.7563649880040173, -71.979749317970501},
+    {-12.563302642793166, 46.399932871972752, 93.932681201962566,
+     3.7383753250522171, -68.818245765820564},
+    {-12.563046979329332, 46.423892057075882, 93.497831757976456,
+     3.7211447156017781, -66.028887638496769},
+    {-12.5627913158655, 46.447742272450419, 93.07990874726346,
+     3.7045870781007566, -63.543956153301991},
+    {-12.562535652401666, 46.471487610517677, 92.677128665802414,
+     3.6886314686034223, -61.311817035019835},
+    {-12.562279988937831, 46.495131746739254, 92.28800095222978,
+     3.6732185970021884, -59.292319968011697},
+    {-12.561768662010163, 46.542129415102977, 91.54584217550736,
+     3.6438277379030315, -55.770499450549366},
+    {-12.561257335082496, 46.588758544012691, 90.845338763814212,
+     3.6160925749881385, -52.791035116133976},
+    {-12.56074600815483, 46.635038801802772, 90.18038034546619,
+     3.5897700776258934, -50.227620288871655},
+    {-12.560234681227161, 46.680987101426474, 89.54621952394254,
+     3.5646714331612186, -47.991631845678313},
+    {-12.559723354299493, 46.726618190125443, 88.939080749285324,
+     3.5406464872030545, -46.018807054700446},
+    {-12.559212027371824, 46.771945076135843, 88.3559026625326,
+     3.5175734938612306, -44.261259425303372},
+    {-12.558700700444156, 46.816979346160153, 87.794162135299089,
+     3.4953521160112579, -42.682476328441936},
+    {-12.558189373516489, 46.861731407134428, 87.251750412684999,
+     3.4738984983252066, -41.254065818144618},
+    {-12.557166719661154, 46.950425718373751, 86.218036897037578,
+     3.4330211114440035, -38.762973166929463},
+    {-12.556144065805817, 47.038093899643783, 85.243311017571173,
+     3.3944860209797416, -36.655420265517272},
+    {-12.555121411950482, 47.124791659030699, 84.318927230015461,
+     3.3579494958032519, -34.842089354491087},
+    {-12.554098758095147, 47.210566907264834, 83.438168116098055,
+     3.3231444854731356, -33.260310233465972},
+    {-12.553076104239812, 47.295461426096864, 82.595691117372169,
+     3.2898586143947379, -31.864638985400077},
+    {-12.552053450384477, 47.379512075633031, 81.787164063783223,
+     3.2579196856940578, -30.621212086789384},
+    {-12.551030796529142, 47.462751692611683, 81.009016260182847,
+     3.2271857815289979, -29.504209027939726},
+    {-12.550008142673807, 47.545209774515079, 80.25826327435928,
+     3.1975382948739699, -28.493551855125304},
+    {-12.548985488818472, 47.626913011035555, 79.532380388658169,
+     3.1688768968425349, -27.573360961661578},
+    {-12.547962834963137, 47.707885704082891, 78.829209149022702,
+     3.1411158203854486, -26.730889851875606},
+    {-12.546940181107802, 47.788150104736346, 78.146887008545278,
+     3.1141810624957285, -25.955772654373},
+    {-12.545917527252467, 47.867726687111691, 77.483793450526989,
+     3.088008241813136, -25.239481355531069},
+    {-12.543872219541797, 48.024890721963438, 76.209777749360271,
+     3.0377293556384801, -23.956161809115027},
+    {-12.541826911831127, 48.179513730401659, 74.997652047536462,
+     2.9899014144737022, -22.836610984960192},
+    {-12.539781604120456, 48.331714279474411, 73.839851988412391,
+     2.9442240032373967, -21.848690655077018},
+    {-12.537736296409786, 48.481596998734176, 72.73024316053224,
+     2.9004535364712822, -20.968452028871791},
+    {-12.535690988699116, 48.629255122882761, 71.663768890664343,
+     2.8583892565343625, -20.177634233659109},
+    {-12.533645680988444, 48.774772428312687, 70.636202311930717,
+     2.8178633778946955, -19.462037495057068},
+    {-12.531600373277772, 48.918224737634027, 69.643967284983034,
+     2.7787339689466544, -18.810431108182232},
+    {-12.529555065567102, 49.059681108780602, 68.68400614959458,
+     2.7408796956544546, -18.213800122325527},
+    {-12.527509757856432, 49.199204788973525, 67.753680154401835,
+     2.7041958643022079, -17.664813192595098},
+    {-12.525464450145762, 49.336853990186498, 66.850693205543934,
+     2.6685913912264536, -17.15743874026591},
+    {-12.523419142435092, 49.472682526887276, 65.973032587110097,
+     2.6339864471821111, -16.686662924332438},
+    {-12.521373834724422, 49.606740346026804, 65.11892225237051,
+     2.6003106013727479, -16.248278974837088},
+    {-12.517283219303081, 49.869726880745802, 63.475215306703276,
+     2.5355028800825261, -15.454973706601802},
+    {-12.513192603881741, 50.126151102149819, 61.908849599531564,
+     2.4737431748763581, -14.754791429741102},
+    {-12.509101988460399, 50.376311000181694, 60.411127550226368,
+     2.4146868258790843, -14.130792648486951},
+    {-12.505011373039057, 50.620472249489318, 58.974878133950497,
+     2.358049759998659, -13.570060738563182},
+    {-12.500920757617717, 50.858873695757666, 57.59410584431793,
+     2.3035945495943437, -13.062551403047165},
+    {-12.496830142196377, 51.091731618633666, 56.263737120193611,
+     2.2511203433187177, -12.600320340601439},
+    {-12.492739526775036, 51.319243101354402, 54.979433067295162,
+     2.2004554305106825, -12.176990459821491},
+    {-12.488648911353696, 51.541588734381335, 53.73744844331214,
+     2.1514516431980999, -11.787375509794888},
+    {-12.484558295932354, 51.758934813397182, 52.534523658600762,
+     2.1039800693516426, -11.427208600395879},
+    {-12.480467680511012, 51.971435147193581, 51.367800807707212,
+     2.0579277204459681, -11.092942728261946},
+    {-12.476377065089672, 52.179232560244031, 50.234757501401184,
+     2.0131949058338328, -10.781601773740446},
+    {-12.472286449668331, 52.382460153273641, 49.133154092592342,
+     1.9696931388991195, -10.49066753907136},
+    {-12.468195834246991, 52.581242369768695, 48.060991123627723,
+     1.9273434489862717, -10.217992958084833},
+    {-12.464105218825651, 52.77569590525583, 47.016474674147005,
+     1.8860750069380763, -9.9617346004461016},
+    {-12.460014603404309, 52.965930487978163, 45.997987886945538,
+     1.8458239958393798, -9.7202995976541295},
+    {-12.455923987982967, 53.152049553456891, 45.004067376351465,
+     1.806532675527315, -9.4923034849324601},
+    {-12.451833372561627, 53.334150830818814, 44.033383532978505,
+     1.768148601715501, -9.2765364011393139},
+    {-12.443652141718946, 53.686665417771316, 42.156979491567377,
+     1.693915058515284, -8.8775639538411237},
+    {-12.435470910876264, 54.024159940321411, 40.360245282248194,
+     1.6227871695211988, -8.5162748659962428},
+    {-12.427289680033581, 54.347255861790686, 38.635959008874536,
+     1.5544805023314678, -8.1870474393911987},
+    {-12.419108449190901, 54.656519983976565, 36.977941797634351,
+     1.4887518676931857, -7.8853687742415008},
+    {-12.410927218348219, 54.952472124881133, 35.380857802008173,
+     1.4253913982229058, -7.6075685178101491},
+    {-12.402745987505536, 55.235591362070792, 33.840061005418569,
+     1.364216482362409, -7.3506268089275961},
+    {-12.394564756662856, 55.506321169192312, 32.351476090859293,
+     1.3050670485814497, -7.1120331583444898},
+    {-12.386383525820174, 55.765073686100138, 30.911504548613404,
+     1.2478018496753505, -6.8896810323518594},
+    {-12.378202294977491, 56.012233302109657, 29.516949776808339,
+     1.1922954995163138, -6.6817879326153093},
+    {-12.370021064134811, 56.248159688371345, 28.164956678086391,
+     1.1384360839831891, -6.486833990615926},
+    {-12.361839833292128, 56.473190383835231, 26.852962462498702,
+     1.0861232156632541, -6.3035142120057488},
+    {-12.353658602449446, 56.687643015999242, 25.578656214528635,
+     1.0352664355423007, -6.1307009238500294},
+    {-12.345477371606766, 56.891817220300616, 24.339945387396003,
+     0.9857838888990712, -5.9674139446523187},
+    {-12.337296140764083, 57.08599630882437, 23.134927826263873,
+     0.9376012200040722, -5.8127966676484855},
+    {-12.329114909921401, 57.270448728991454, 21.961868243917483,
+     0.89065064298510499, -5.6660967200876433},
+    {-12.320933679078721, 57.445429345085074, 20.8191783117909,
+     0.8448701557067233, -5.5266501984639387},
+    {-12.312752448236038, 57.611180569382128, 19.705399709166024,
+     0.80020287064201789, -5.3938687236522167},
+    {-12.304571217393356, 57.767933364906042, 18.619189610091532,
+     0.7565964421324991, -5.2672287385437988},
+    {-12.296389986550674, 57.915908137964259, 17.559308192473676,
+     0.71400257358783281, -5.1462626030405882},
+    {-12.288208755707991, 58.055315535600883, 16.524607835036768,
+     0.67237659139542727, -5.0305511402090666},
+    {-12.280027524865311, 58.186357160637137, 15.51402373128629,
+     0.63167707482221014, -4.9197173621283872},
+    {-12.271846294022628, 58.30922621494615, 14.526565699547751,
+     0.59186553316852375, -4.8134211609276694},
+    {-12.263665063179946, 58.424108079982503, 13.561311007763369,
+     0.55290612300230846, -4.7113547942906218},
+    {-12.255483832337266, 58.53118084225639, 12.617398063353903,
+     0.51476539955369582, -4.6132390286279712},
+    {-12.247302601494583, 58.630615770268207, 11.69402084388156,
+     0.4774120973566251, -4.5188198295980015},
+    {-12.239121370651901, 58.722577748572661, 10.790423964826505,
+     0.44081693603843097, -4.4278655104733913},
+    {-12.230940139809221, 58.807225673778831, 9.9058982975127527,
+     0.40495244782006046, -4.3401642653248738},
+    {-12.222758908966538, 58.884712816703185, 9.0397770639263211,
+     0.36979282383189277, -4.255522027113452},
+    {-12.214577678123856, 58.955187154313343, 8.1914323464269909,
+     0.33531377679548169, -4.1737606012926811},
+    {-12.206396447281175, 59.018791674621987, 7.3602719596628763,
+     0.30149241798967974, -4.094716033991145},
+    {-12.198215216438493, 59.075664657323934, 6.5457366397361341,
+     0.26830714672565392, -4.0182371807052037},
+    {-12.190033985595811, 59.125939932595024, 5.7472975121197392,
+     0.23573755081039791, -3.9441844470174185},
+    {-12.18185275475313, 59.169747120208719, 4.9644538052258191,
+     0.20376431669184239, -3.8724286774252374},
+    {-12.173671523910448, 59.207211850843549, 4.196730781080297,
+     0.17236914815869026, -3.8028501721210652},
+    {-12.165490293067766, 59.238455971273666, 3.4436778584011685,
+     0.14153469261997076, -3.7353378146663117},
+    {-12.157309062225085, 59.263597734910292, 2.7048669066283102,
+     0.11124447411774746, -3.6697882960726393},
+    {-12.149127831382403, 59.28275197902213, 1.9798906922309365,
+     0.081482832336189692, -3.6061054229450833},
+    {-12.140946600539721, 59.296030289809579, 1.2683614609819704,
+     0.052234866963568806, -3.5441994991304178},
+    {-12.13276536969704, 59.303541156396207, 0.56990964191479754,
+     0.02348638684376983, -3.4839867718149975},
+    {-12.124584138854358, 59.305390114655452, -0.11581733958097698,
+     -0.0047761365773292602, -3.4253889342796509},
+    {-12.116402908011676, 59.3016798817549, -0.78915615056325639,
+     -0.032565611945829492, -3.3683326785869938},
+    {-12.108221677168995, 59.292510482137928, -1.4504285509885959,
+     -0.05989436721841214, -3.3127492923804662},
+    {-12.100040446326313, 59.277979365675684, -2.0999423144292404,
+     -0.086774185745255208, -3.258574294743934},
+    {-12.09185921548363, 59.25818151856754, -2.7379920766969219,
+     -0.11321633951836464, -3.205747106726681},
+    {-12.08367798464095, 59.233209567579181, -3.364860119167485,
+     -0.1392316198530123, -3.154210752699222},
+    {-12.075496753798268, 59.203153878119387, -3.9808170928523818,
+     -0.16483036574045049, -3.1039115891869686},
+    {-12.059134292112905, 59.128141987581117, -5.1810262583273818,
+     -0.21481750401087887, -3.0068254627750299},
+    {-12.04277183042754, 59.03382692429026, -6.3405764502870694,
+     -0.26325236995136059, -2.9141173819299402},
+    {-12.026409368742176, 58.920858979093531, -7.4612766167859306,
+     -0.3102038350772644, -2.82545562539846},
+    {-12.010046907056813, 58.789859947471435, -8.5448032223566628,
+     -0.35573563069666042, -2.7405428166418986},
+    {-11.99368444537145, 58.641425184934498, -9.5927136723195012,
+     -0.39990687248827356, -2.6591114795872537},
+    {-11.977321983686085, 58.476125457127992, -10.606458030490147,
+     -0.4427725181362267, -2.5809202778613201},
+    {-11.960959522000721, 58.294508610366691, -11.587389288611066,
+     -0.48438376817919504, -2.5057508166384874},
+    {-11.944597060315358, 58.097101084498924, -12.536772400815627,
+     -0.52478841845857271, -2.433404910245947},
+    {-11.928234598629995, 57.884409286832579, -13.455792260236457,
+     -0.56403117112493362, -2.3637022374158829},
+    {-11.911872136944631, 57.656920843162162, -14.345560765585766,
+     -0.60215391000937035, -2.296478320810559},
+    {-11.895509675259266, 57.415105739758708, -15.207123101703427,
+     -0.63919594522846634, -2.2315827791092784},
+    {-11.879147213573903, 57.159417368299223, -16.041463338562046,
+     -0.67519423112426813, -2.1688778092344214},
+    {-11.86278475188854, 56.890293484150661, -16.849509437175438,
+     -0.71018356100969537, -2.108236863735315},
+    {-11.846422290203176, 56.608157087073117, -17.632137737587886,
+     -0.74419674166813288, -2.0495434943446207},
+    {-11.81369736683245, 56.006469778816985, -19.124412005708447,
+     -0.80941687483044877, -1.9375782222094566},
+    {-11.780972443461723, 55.357473631163977, -20.524408146137713,
+     -0.87108293668611692, -1.8322167570947938},
+    {-11.748247520090995, 54.664096642344923, -21.837642844472771,
+     -0.92940001507150871, -1.7328018171267487},
+    {-11.71552259672027, 53.929095031177404, -23.069110335119962,
+     -0.98455319191557444, -1.6387652268358519},
+    {-11.682797673349542, 53.15506917518583, -24.223351142838276,
+     -1.0367102050434323, -1.5496129432897878},
+    {-11.650072749978815, 52.344477490547781, -25.304509541593799,
+     -1.0860236706092592, -1.4649130485913671},
+    {-11.617347826608087, 51.499648585720308, -26.316381920027375,
+     -1.1326329517203997, -1.3842860382022513},
+    {-11.58462290323736, 50.622791957334535, -27.262457757224976,
+     -1.1766657397888365, -1.3073969035997717},
+    {-11.551897979866634, 49.716007447389636, -28.14595454715808,
+     -1.2182394008418616, -1.2339486300852502},
+    {-11.519173056495907, 48.781293641810265, -28.969847732418369,
+     -1.2574621281551828, -1.1636768201252758},
+    {-11.48644813312518, 47.820555359252729, -29.736896494631985,
+     -1.2944339342322573, -1.0963452189239844},
+    {-11.453723209754454, 46.835610354248914, -30.449666083730669,
+     -1.3292475086964954, -1.0317419685384399},
+    {-11.420998286383726, 45.828195338554337, -31.110547239164578,
+     -1.3619889636204134, -0.96967645432802374},
+    {-11.388273363012999, 44.799971408246627, -31.721773154467478,
+     -1.3927384838466346, -0.90997663609689317},
+    {-11.355548439642272, 43.75252895071943, -32.285434355903767,
+     -1.4215708967078668, -0.85248677824980301},
+    {-11.322823516271544, 42.687392094630376, -32.803491801459749,
+     -1.4485561730393155, -0.79706551029852224},
+    {-11.290098592900819, 41.606022756797763, -33.277788454580651,
+     -1.4737598693560405, -0.74358416234098912},
+    {-11.257373669530091, 40.509824332342916, -33.71005954508756,
+     -1.4972435194333695, -0.69192533057977645},
+    {-11.191923822788638, 38.278281153600631, -34.454981063287129,
+     -1.5392787517518209, -0.59365464761498143},
+    {-11.126473976047183, 36.002940655717801, -35.05030671593348,
+     -1.5750859972076046, -0.50149627899730997},
+    {-11.061024129305729, 33.693233632198591, -35.506855297465933,
+     -1.6050437501258124, -0.41480883439557381},
+    {-10.995574282564275, 31.357918081127398, -35.834394140883916,
+     -1.6294917036623839, -0.33304482874178248},
+    {-10.930124435822822, 29.005143051651061, -36.041786189153228,
+     -1.6487363158935526, -0.25573365395881359},
+    {-10.864674589081368, 26.642503745304772, -36.137111183054962,
+     -1.66305538590965, -0.18246818342483084},
+    {-10.799224742339913, 24.277089381889418, -36.127766351011608,
+     -1.6727018472616608, -0.11289412699072073},
+    {-10.73377489559846, 21.915525031188473, -36.020550707192299,
+     -1.677906936634336, -0.046701492730768811},
+    {-10.668325048857007, 19.564008375356924, -35.821736123713769,
+     -1.6788828592896909, 0.016382320498747275},
+    {-10.602875202115552, 17.228342183632744, -35.537127642717095,
+     -1.6758250458152382, 0.076598155687981853},
+    {-10.537425355374097, 14.913963137693477, -35.172114967078528,
+     -1.6689140744015194, 0.13415972469889617},
+    {-10.471975508632642, 12.625967532760944, -34.731716667531778,
+     -1.6583173174393151, 0.18925743534051187},
+    {-10.406525661891187, 10.369134289480916, -34.220618335903794,
+     -1.6441903593828666, 0.24206157708055068},
+    {-10.341075815149734, 8.1479456392100609, -33.643205675299413,
+     -1.6266782236530908, 0.29272498876304576},
+    {-10.275625968408281, 5.966605786876678, -33.003593331286837,
+     -1.6059164391908658, 0.3413853050951392},
+    {-10.242901045037554, 4.8921211419765998, -32.661680261024287,
+     -1.5943569169228724, 0.3650036300249736},
+    {-10.210176121666827, 3.829057807972347, -32.305650120913846,
+     -1.5820319716306668, 0.38816685838293263},
+    {-10.177451198296099, 2.7778703854495279, -31.935951737902318,
+     -1.5689562698787005, 0.41088871850813741},
+    {-10.144726274925372, 1.7389989971788689, -31.553021199473481,
+     -1.5551440395914278, 0.43318229640181688},
+    {-10.112001351554646, 0.71286969582628357, -31.15728240945619,
+     -1.5406090904381646, 0.45506007408862326},
+    {-10.095638889869281, 0.20471271824371187, -30.954739188018415,
+     -1.5330748021841745, 0.46584678214764291},
+    {-10.079276428183919, -0.30010514598934002, -30.749147611450091,
+     -1.5253648330086758, 0.47653396520164376},
+    {-10.046551504813191, -1.2995264622612219, -30.329017882170376,
+     -1.5094242968664462, 0.49761534802573221},
+    {-10.013826581442466, -2.2850081358564971, -29.897283596820774,
+     -1.4928001475592834, 0.51831509621122995},
+    {-9.9811016580717382, -3.2561766555585372, -29.454324868430025,
+     -1.4755047026602643, 0.53864360734994721},
+    {-9.9483767347010108, -4.2126707871004401, -29.00051196293207,
+     -1.4575499469061699, 0.55861082958725261},
+    {-9.882926887959556, -6.0802504512672781, -28.061757782509389,
+     -1.4197088625990566, 0.59749909987968708},
+    {-9.8174770412181029, -7.8850911011440541, -27.083800637668631,
+     -1.3793666399197513, 0.6350514054077383},
+    {-9.7520271944766499, -9.6247141740770612, -26.069285596290229,
+     -1.3366085366873948, 0.67133347899150242},
+    {-9.6865773477351951, -11.296810096601321, -25.020733079378093,
+     -1.2915156809865436, 0.70640587466356253},
+    {-9.6211275009937403, -12.899230422351868, -23.940547754959354,
+     -1.2441653929067358, 0.74032448253696947},
+    {-9.5556776542522872, -14.429980523432999, -22.831026574808671,
+     -1.194631474652603, 0.77314098201275727},
+    {-9.4902278075108342, -15.887212782516515, -21.694366054114518,
+     -1.1429844727723493, 0.80490324187876017},
+    {-9.4247779607693793, -17.269220239007119, -20.532668880581745,
+     -1.089291915737906, 0.83565567451036216},
+    {-9.3593281140279245, -18.574430647897927, -19.3479499279469,
+     -1.0336185296756428, 0.86543955027614716},
+    {-9.2938782672864715, -19.801400914531065, -18.142141739100573,
+     -0.97602643467792727, 0.8942932773329122},
+    {-9.2284284205450184, -20.948811872429598, -16.917099535681174,
+     -0.91657532381239804, 0.92225265122953848},
+    {-9.1629785738035636, -22.015463374892111, -15.674605803881267,
+     -0.85532262667808023, 0.94935107809982111},
+    {-9.0975287270621088, -23.000269674064253, -14.416374500097552,
+     -0.79232365912809122, 0.97561977468787009},
+    {-9.032078880320654, -23.902255063884436, -13.144054914799566,
+     -0.72763176058161982, 1.0010879479978838},
+    {-8.9666290335791992, -24.72054976567053, -11.85923522845613,
+     -0.66129842017799489, 1.0257829569783867},
+    {-8.9011791868377461, -25.454386037190119, -10.563445789431569,
+     -0.59337339287876778, 1.0497304583273899},
+    {-8.8357293400962931, -26.103094487902251, -9.2581621403561627,
+     -0.52390480649644178, 1.0729545382297427},
+    {-8.7702794933548383, -26.666100584688476, -7.9448078165092184,
+     -0.45293926051780492, 1.0954778316031666},
+    {-8.7048296466133834, -27.142921333861022, -6.6247569371655173,
+     -0.38052191749340442, 1.1173216302286073},
+    {-8.6393797998719304, -27.533162126505953, -5.2993366085916751,
+     -0.30669658768041613, 1.1385059809682232},
+    {-8.5739299531304773, -27.836513735406552, -3.9698291553943337,
+     -0.23150580755239819, 1.1590497751260653},
+    {-8.5084801063890225, -28.052749452801677, -2.6374741951777505,
+     -0.15499091272466334, 1.1789708298786379},
+    {-8.4430302596475677, -28.181722359166745, -1.3034705699312257,
+     -0.077192105787006596, 1.1982859625918965},
+    {-8.3775804129061147, -28.223362714053746, 0.031021853789893552,
+     0.0018514805147141716, 1.2170110587454295},
+    {-8.3121305661646616, -28.177675460757136, 1.3648805050258055,
+     0.082101724351015662, 1.2351611341011652},
+    {-8.2466807194232068, -28.044737837253233, 2.6970185391162524,
+     0.16352145977738838, 1.2527503916814964},
+    {-8.181230872681752, -27.824697086482104, 4.0263833700919518,
+     0.24607442527606671, 1.2697922740582335},
+    {-8.1157810259402972, -27.517768259571159, 5.3519552967398427,
+     0.32972521557897522, 1.2862995113984932},
+    {-7.9848813324573893, -26.644433046106066, 7.9877984106404165,
+     0.50018266258830735, 1.3177576713255061},
+    {-7.8539816389744823, -25.427730601188177, 10.597000988185393,
+     0.67462603525828169, 1.3472140595511066},
+    {-7.7230819454915745, -23.871617299943825, 13.172467685728007,
+     0.85279864817552309, 1.3747489580594867},
+    {-7.5921822520086666, -21.980950463735443, 15.707523511596236,
+     1.034453796695969, 1.4004347321005519},
+    {-7.4612825585257587, -19.761435183507889, 18.195886145987124,
+     1.2193537775348886, 1.4243366777902973},
+    {-7.3958327117843048, -18.530361720831973, 19.420695544811124,
+     1.3129485415392612, 1.435637368512056},
+    {-7.3303828650428509, -17.219574562320133, 20.631641308488437,
+     1.4072690122965243, 1.4465137507309078},
+    {-7.2649330183013969, -15.830003622681085, 21.828038053000306,
+     1.5022876327980164, 1.4569723062186597},
+    {-7.1994831715599421, -14.362623004666379, 23.009220778426688,
+     1.5979772596260673, 1.4670191942349597},
+    {-7.1340333248184882, -12.818449683587168, 24.174544304249405,
+     1.694311142348391, 1.4766602667101922},
+    {-7.0685834780770342, -11.198542227799464, 25.323382734398283,
+     1.7912629038716084, 1.4859010823840417},
+    {-7.0031336313355803, -9.5039995532763655, 26.455128950239164,
+     1.8888065216880532, 1.494746919976323},
+    {-6.9376837845941264, -7.7359597105046731, 27.569194129838777,
+     1.9869163099548541, 1.5032027904598206},
+    {-6.8722339378526724, -5.8955987020161036, 28.665007291965388,
+     2.0855669023486545, 1.5112734484987977},
+    {-6.8067840911112185, -3.9841293290032822, 29.742014863396779,
+     2.1847332356432467, 1.5189634031111658},
+    {-6.7413342443697646, -2.0028000655225457, 30.799680268212697,
+     2.2843905339611377, 1.5262769276072972},
+    {-6.6758843976283107, 0.047106041103096394, 31.837483537842463,
+     2.3845142936532211, 1.5332180688538986},
+    {-6.6104345508868567, 2.1642724450118465, 32.854920940728341,
+     2.4850802687639137, 1.539790655907094},
+    {-6.5449847041454028, 4.3473501529000789, 33.85150463054562,
+     2.5860644570418216, 1.5459983080551329},
+    {-6.4795348574039489, 6.5949587526822331, 34.826762311993768,
+     2.6874430864584657, 1.5518444423077313},
+    {-6.4140850106624949, 8.90568742081682, 35.780236923243372,
+     2.789192602199992, 1.5573322803656322},
+    {-6.3486351639210401, 11.278095909380832, 36.711486334187292,
+     2.8912896540989421, 1.5624648551014322},
+    {-6.3159102405503127, 12.486972201670657, 37.168642435918194,
+     2.9424612621378583, 1.5648988163540707},
+    {-6.2995477788649499, 13.096997183436471, 37.395080402821215,
+     2.9680765759315384, 1.5660828658032566},
+    {-6.2831853171795862, 13.710715513883072, 37.620083059674045,
+     2.9937110844727601, 1.5671276885859422},
+    {-6.2831852971795863, 13.710716266238229, 37.613085966464979,
+     2.9931542830154036, -27840.072422135931},
+    {-6.2831832998087727, 13.710791274894945, 37.520970851870295,
+     2.9858249442613141, -1963.51579118215},
+    {-6.2831813024379581, 13.710866175049913, 37.480107932584296,
+     2.9825741235607444, -1389.689729745113},
+    {-6.2831793050671436, 13.710941004339814, 37.448735708218592,
+     2.9800785470197884, -1134.862097060595},
+    {-6.2831773076963291, 13.711015776302624, 37.422284118204544,
+     2.9779745410308252, -982.81422859403779},
+    {-6.2831753103255146, 13.711090498774103, 37.398979289760554,
+     2.9761209454318895, -879.0001861089296},
+    {-6.2831733129547001, 13.711165177043071, 37.377910601351616,
+     2.9744452953641694, -802.34398865714695},
+    {-6.2831713155838855, 13.711239814993215, 37.358536795466847,
+     2.9729045189972809, -742.75408338032855},
+    {-6.283169318213071, 13.71131441563583, 37.34050507949258,
+     2.9714705420442331, -694.71254120218316},
+    {-6.283165323471442, 13.711463514267557, 37.30755406080047,
+     2.9688502641681316, -621.24298466937364},
+    {-6.2831613287298138, 13.711612487908049, 37.277767855044374,
+     2.9664818317326529, -567.0015467335395},
+    {-6.2831573339881857, 13.711761347552152, 37.250380109408326,
+     2.9643042605272414, -524.84060029792579},
+    {-6.2831533392465566, 13.711910101718487, 37.224891407854393,
+     2.9622778084481869, -490.85297267148428},
+    {-6.2831453497632985, 13.712207319852258, 37.178317675190414,
+     2.9585753317477379, -438.88014425069861},
+    {-6.2831373602800413, 13.712504184675341, 37.136221425635803,
+     2.9552291551350574, -400.51237389582872},
+    {-6.2831293707967841, 13.712800727294315, 37.097518232629163,
+     2.9521529832772413, -370.69133779623729},
+    {-6.283121381313526, 13.713096971812341, 37.061501464341475,
+     2.9492905846579025, -346.65233194038234},
+    {-6.2831054023470116, 13.713688640763454, 36.995697202548158,
+     2.9440614818214463, -309.89408965602797},
+    {-6.2830894233804964, 13.714279311389138, 36.936226415795339,
+     2.9393363620091932, -282.75917431674611},
+    {-6.2830734444139811, 13.714869071687046, 36.88155503064862,
+     2.9349931492077714, -261.66932617025373},
+    {-6.2830574654474667, 13.71545798984207, 36.830683462914685,
+     2.9309523003297628, -244.66892472265246},
+    {-6.2830414864809514, 13.716046120710999, 36.78291737324269,
+     2.9271585626473651, -230.5870065943148},
+    {-6.2830255075144361, 13.716633509678898, 36.737751202815346,
+     2.9235717059303163, -218.67396000803086},
+    {-6.2829935495814064, 13.717806209969822, 36.653777103467363,
+     2.9169039259883816, -199.48482671595647},
+    {-6.2829615916483768, 13.718976339644376, 36.576591302272689,
+     2.9107762930535901, -184.57078411395182},
+    {-6.2829296337153462, 13.720144091584203, 36.504779971141311,
+     2.9050763019252996, -172.5487568373392},
+    {-6.2828976757823156, 13.721309620971176, 36.437361038739766,
+     2.899725804797765, -162.5906229954318},
+    {-6.2828657178492859, 13.722473056184905, 36.373619451167592,
+     2.894667901928262, -154.16625593177153},
+    {-6.2828018019832257, 13.724794062939541, 36.255129470060496,
+     2.8852676411514544, -140.59662024205525},
+    {-6.2827378861171654, 13.727107816029182, 36.146241048761262,
+     2.8766313113772304, -130.05015330471002},
+    {-6.2826739702511052, 13.729414861085301, 36.044954528108974,
+     2.8685997951496702, -121.54878371393042},
+    {-6.2826100543850449, 13.73171563710768, 35.94988091042336,
+     2.8610625678838355, -114.50689392759918},
+    {-6.2825461385189847, 13.7340105072811, 35.860008855487379,
+     2.8539391565806183, -108.5496008546491},
+    {-6.2824822226529244, 13.736299778590343, 35.774574869519036,
+     2.8471688101659591, -103.42431492211033},
+    {-6.2824183067868642, 13.738583714983982, 35.692985783814265,
+     2.840704330787343, -98.95380650526927},
+    {-6.2822904750547437, 13.743136476375806, 35.539544665070864,
+     2.8285499378123848, -91.495818353971458},
+    {-6.2821626433226232, 13.747670335132089, 35.396857236977382,
+     2.8172509410116175, -85.483998817586937},
+    {-6.2820348115905027, 13.752186533294147, 35.262958922880017,
+     2.8066510279295986, -80.504233666782284},
+    {-6.2819069798583822, 13.756686098441209, 35.136419285149636,
+     2.7966363874701741, -76.291428454429948},
+    {-6.2817791481262617, 13.761169899176377, 35.016158428532613,
+     2.7871211007933385, -72.666967603781416},
+    {-6.2816513163941421, 13.765638682362239, 34.901337358672897,
+     2.7780384170310266, -69.50552555200197},
+    {-6.2815234846620225, 13.770093099176391, 34.79128884923761,
+     2.7693352523627124, -66.71622587652665},
+    {-6.281395652929902, 13.77453372397019, 34.685471901108976,
+     2.7609685663511931, -64.231350541672725},
+    {-6.281139989465661, 13.783375591561816, 34.484822432718467,
+     2.7451085703036613, -59.979821714593974},
+    {-6.28088432600142, 13.792167800124782, 34.296610061643626,
+     2.7302373584292523, -56.458104039494458},
+    {-6.280628662537179, 13.800913257933123, 34.118811386423744,
+     2.7161939687611465, -53.478739565435191},
+    {-6.280372999072938, 13.809614423490197, 33.949898822154147,
+     2.7028568866184841, -50.915422538262824},
+    {-6.2801173356086979, 13.818273410880927, 33.788685525355064,
+     2.6901317061204328, -48.679530418697816},
+    {-6.2798616721444578, 13.826892063478395, 33.634227612654641,
+     2.6779433503962173, -46.706800860723277},
+    {-6.2796060086802168, 13.835472007277932, 33.485759747400365,
+     2.6662309467435885, -44.94934763785573},
+    {-6.2793503452159758, 13.844014690588592, 33.342651149871244,
+     2.6549443267864388, -43.370658307374363},
+    {-6.2790946817517348, 13.852521414244684, 33.204374633206143,
+     2.6440415630062475, -41.942341058072664},
+    {-6.2785833548232537, 13.869431584527939, 32.940598727086531,
+     2.6232508884174743, -39.451433786766977},
+    {-6.2780720278947726, 13.886210754109872, 32.691569263507297,
+     2.6036312675493281, -37.344065160184073},
+    {-6.2775607009662906, 13.902865886265282, 32.455124862652497,
+     2.5850108353119352, -35.530917744846377},
+    {-6.2770493740378095, 13.919402969602038, 32.229586174533317,
+     2.5672560668262783, -33.949321546828024},
+    {-6.2765380471093284, 13.935827226604371, 32.013617563033613,
+     2.5502607745505141, -32.553832785546263},
+    {-6.2760267201808464, 13.952143264558782, 31.806135988406709,
+     2.5339388602451809, -31.310588030923714},
+    {-6.2755153932523653, 13.968355187824901, 31.606248779128347,
+     2.5182193651466775, -30.193766839173595},
+    {-6.2750040663238842, 13.984466683362779, 31.413209829045847,
+     2.5030429858708283, -29.183291304241848},
+    {-6.2739814124669211, 14.016401436712686, 31.045243561064382,
+     2.474126198347903, -27.420992021450282},
+    {-6.272958758609958, 14.047970875647833, 30.698185136150144,
+     2.4468664881636046, -25.929945652976198},
+    {-6.2719361047529958, 14.079194748163346, 30.368974955999729,
+     2.4210207541005979, -24.646987757242613},
+    {-6.2709134508960327, 14.110090042690173, 30.055235529002918,
+     2.3964001229125889, -23.527798179719628},
+    {-6.2698907970390696, 14.140671578326842, 29.755075773116481,
+     2.3728543874454875, -22.540238740803023},
+    {-6.2688681431821074, 14.170952431990994, 29.466962092076074,
+     2.3502617553157292, -21.660360683068294},
+    {-6.2678454893251443, 14.200944256252617, 29.189630323811659,
+     2.3285218480197805, -20.869903157260893},
+    {-6.2668228354681812, 14.230657521397388, 28.922023757583723,
+     2.3075507730882756, -20.154666405984813},
+    {-6.2658001816112181, 14.260101703495264, 28.663248364344263,
+     2.2872775649999788, -19.503419736948423},
+    {-6.264777527754255, 14.289285433036731, 28.412539734683371,
+     2.2676415570074089, -18.907148208964163},
+    {-6.2637548738972928, 14.318216614179132, 28.169238186297889,
+     2.2485904025145111, -18.358520484468517},
+    {-6.2627322200403297, 14.346902521680052, 27.93276970117445,
+     2.2300785599447659, -17.851504990463734},
+    {-6.2606869123264044, 14.403564932619954, 27.478378393584066,
+     2.1945178523049154, -16.943062418235169},
+    {-6.2586416046124782, 14.459320990105097, 27.045996358555605,
+     2.1606922130373558, -16.150473399683776},
+    {-6.256596296898552, 14.514212868889715, 26.632942945725965,
+     2.1283891178121994, -15.45100644707459},
+    {-6.2545509891846267, 14.568277804083428, 26.237043801407996,
+     2.0974362385706908, -14.827722077338361},
+    {-6.2525056814707014, 14.621548991465582, 25.856506210553945,
+     2.0676915406234411, -14.267703675449649},
+    {-6.2504603737567752, 14.674056273279101, 25.489831337493527,
+     2.0390363119903379, -13.760906951454304},
+    {-6.248415066042849, 14.725826671098044, 25.135750832682678,
+     2.0113701288254262, -13.299387609427356},
+    {-6.2463697583289237, 14.776884807025077, 24.793180013136794,
+     1.9846071376160139, -12.876768562287284},
+    {-6.2443244506149984, 14.827253241651142, 24.461182608734983,
+     1.958673256185929, -12.487863562666503},
+    {-6.2422791429010722, 14.876952748801578, 24.138943762410204,
+     1.9335040303237492, -12.128405723415506},
+    {-6.2402338351871469, 14.926002541524213, 23.825749038043472,
+     1.9090429675644462, -11.794848043726843},
+    {-6.2381885274732216, 14.974420459906986, 23.520967878481066,
+     1.8852402243771427, -11.484214406184222},
+    {-6.2340979120453701, 15.069426090391378, 22.934466814244512,
+     1.8394374886165248, -10.922017605871243},
+    {-6.2300072966175186, 15.162090318882305, 22.375631729779521,
+     1.7957949858203222, -10.425732780615574},
+    {-6.225916681189668, 15.252519784056831, 21.841371879032771,
+     1.7540687578603487, -9.9833746510803074},
+    {-6.2218260657618165, 15.340809638831947, 21.329137936964617,
+     1.7140577148513572, -9.5858038132824639},
+    {-6.217735450333965, 15.427045496422869, 20.836797599974567,
+     1.6755937725571284, -9.2259128873329885},
+    {-6.2136448349061135, 15.511304942818631, 20.362545709593025,
+     1.6385347288602068, -8.8980801843063961},
+    {-6.209554219478262, 15.593658732605675, 19.904837862012673,
+     1.6027590031805146, -8.597792813286496},
+    {-6.2054636040504114, 15.674171748678864, 19.462340409348005,
+     1.5681616758371288, -8.3213804300945782},
+    {-6.2013729886225599, 15.752903782665218, 19.033892160312455,
+     1.5346514550272388, -8.0658231818841877},
+    {-6.1972823731947084, 15.829910176974614, 18.618474597637928,
+     1.5021483189283884, -7.8286105875458665},
+    {-6.1931917577668578, 15.905242358571543, 18.215188405014104,
+     1.4705816578479509, -7.6076361213644663},
+    {-6.1891011423390063, 15.978948286871395, 17.823234742234579,
+     1.4398887925992725, -7.4011172928794089},
+    {-6.1850105269111548, 16.051072832786918, 17.44190014437207,
+     1.4100137799670567, -7.2075342413456438},
+    {-6.1809199114833033, 16.121658101970421, 17.070544222507564,
+     1.3809064400586093, -7.0255819801035893},
+    {-6.1768292960554518, 16.190743712403023, 16.70858955549151,
+     1.3525215571492062, -6.854132843832172},
+    {-6.1727386806276012, 16.258367034314134, 16.355513313524561,
+     1.3248182176295893, -6.6922066585825206},
+    {-6.1686480651997497, 16.32456339876931, 16.010840263963871,
+     1.2977592573556405, -6.5389468250785061},
+    {-6.1604668343440476, 16.452807455595938, 15.345006414652373,
+     1.2454418493989241, -6.2555052212326112},
+    {-6.1522856034883446, 16.575724149279743, 14.708035924397844,
+     1.1953310421787304, -5.9987753134239119},
+    {-6.1441043726326416, 16.693538756959857, 14.097342740736527,
+     1.1472252004319436, -5.7647760121390554},
+    {-6.1359231417769395, 16.806456974321502, 13.510712448047668,
+     1.1009518972018135, -5.5503111323594316},
+    {-6.1277419109212374, 16.914667651874602, 12.946231154595088,
+     1.0563623062780696, -5.352780958919289},
+    {-6.1195606800655344, 17.018345021122546, 12.402231000582734,
+     1.0133269076800722, -5.1700463153121108},
+    {-6.1113794492098314, 17.117650526966695, 11.877247768985715,
+     0.97173214882945769, -5.0003286779654514},
+    {-6.1031982183541293, 17.212734351772426, 11.369987465006995,
+     0.93147781361697102, -4.842135557566694},
+    {-6.0950169874984272, 17.303736694914431, 10.879299646673278,
+     0.89247492410504825, -4.694203924752105},
+    {-6.0868357566427242, 17.39078885612706, 10.404155909578998,
+     0.85464404869349964, -4.5554567396686947},
+    {-6.0786545257870213, 17.474014159829352, 9.9436323571233842,
+     0.81791392444991373, -4.424969142808477},
+    {-6.0704732949313192, 17.553528749290063, 9.4968951885535855,
+     0.78222032510078221, -4.3019418676632544},
+    {-6.062292064075617, 17.629442273358237, 9.063188752029701,
+     0.74750512316430784, -4.1856801199716447},
+    {-6.0541108332199141, 17.701858483800862, 8.6418255656412324,
+     0.71371550700906372, -4.0755766428742817},
+    {-6.0459296023642111, 17.770875757707458, 8.2321779236583765,
+     0.68080332265523336, -3.9710980214791998},
+    {-6.037748371508509, 17.836587556674399, 7.8336707903214871,
+     0.64872451684867694, -3.8717735190090385},
+    {-6.0295671406528069, 17.899082832302106, 7.4457757474122355,
+     0.61743866298552397, -3.7771859093771281},
+    {-6.0213859097971039, 17.958446385842173, 7.0680058104403756,
+     0.58690855529956709, -3.6869638974732535},
+    {-6.0132046789414009, 18.014759188468521, 6.6999109655726716,
+     0.55709985966685593, -3.6007758120513618},
+    {-6.0050234480856988, 18.068098667576226, 6.3410743083123702,
+     0.52798081165976118, -3.5183243261413755},
+    {-5.9968422172299967, 18.118538963611488, 5.9911086874980821,
+     0.49952195426157442, -3.4393420128053735},
+    {-5.9886609863742937, 18.16615116124132, 5.6496537759521521,
+     0.471695909052669, -3.3635875843764302},
+    {-5.9804797555185907, 18.211003498075204, 5.3163735031972008,
+     0.44447717578940266, -3.2908426943110722},
+    {-5.9722985246628886, 18.253161553684635, 4.9909537969138036,
+     0.41784195618348818, -3.220909204799034},
+    {-5.9641172938071865, 18.292688421248084, 4.6731005888613462,
+     0.39176799840218085, -3.1536068420199146},
+    {-5.9559360629514835, 18.329644863841523, 4.3625380483049403,
+     0.36623445938597521, -3.0887711756725942},
+    {-5.9477548320957805, 18.364089457094508, 4.0590070119500261,
+     0.34122178254948132, -3.0262518710665094},
+    {-5.9395736012400784, 18.396078719719647, 3.762263584261579,
+     0.31671158881473283, -2.9659111713518507},
+    {-5.9313923703843763, 18.425667233202702, 3.4720778860568902,
+     0.29268657924175456, -2.9076225749075659},
+    {-5.9232111395286733, 18.452907751808588, 3.1882329325775962,
+     0.26913044778201956, -2.8512696789018257},
+    {-5.9150299086729703, 18.477851303870409, 2.9105236250011126,
+     0.24602780289694978, -2.7967451648965378},
+    {-5.9068486778172673, 18.500547285254385, 2.6387558416508665,
+     0.22336409696430168, -2.7439499063222264},
+    {-5.8986674469615643, 18.521043545746316, 2.3727456170924035,
+     0.20112556254672551, -2.6927921808854798},
+    {-5.8904862161058622, 18.539386469059053, 2.1123183989223966,
+     0.17929915472400748, -2.6431869736306344},
+    {-5.8823049852501601, 18.555621047034386, 1.8573083734285178,
+     0.15787249879815021, -2.5950553585738194},
+    {-5.8741237543944571, 18.569790948591205, 1.6075578524592011,
+     0.13683384277157765, -2.5483239486481435},
+    {-5.8659425235387541, 18.581938583884337, 1.3629167148305352,
+     0.11617201407629262, -2.5029244052149564},
+    {-5.8577612926830511, 18.59210516408951, 1.1232418964418092,
+     0.095876380098046526, -2.4587929996630367},
+    {-5.8495800618273481, 18.600330757209431, 0.88839692399452652,
+     0.075936812096302903, -2.4158702206805991},
+    {-5.841398830971646, 18.606654340215755, 0.65825148783055687,
+     0.056343652169446604, -2.3741004216797195},
+    {-5.8332176001159439, 18.611113847856096, 0.4326810499413089,
+     0.03708768295671918, -2.3334315036088231},
+    {-5.8250363692602409, 18.61374621837221, 0.21156648366298009,
+     0.018160099804651372, -2.2938146290296051},
+    {-5.8168551384045379, 18.614587436400356, -0.0052062580262375365,
+     -0.00044751484284560699, -2.2552039638794139},
+    {-5.8086739075488358, 18.613672573259578, -0.21774644834121099,
+     -0.018743215044162841, -2.2175564438049187},
+    {-5.8004926766931337, 18.611035824837334, -0.42615886908810074,
+     -0.03673471313914789, -2.1808315623500918},
+    {-5.7923114458374307, 18.60671054725298, -0.63054407178990624,
+     -0.054429399876541384, -2.1449911786226363},
+    {-5.7841302149817277, 18.60072929046266, -0.83099861947178866,
+     -0.071834363040391355, -2.1099993423560148},
+    {-5.7759489841260256, 18.593123829965833, -1.0276153108336517,
+     -0.088956404710103479, -2.075822134537157},
+    {-5.7595865224146205, 18.573163705522937, -1.4096887317411242,
+     -0.1223775983097944, -2.0097852244832848},
+    {-5.7432240607032155, 18.547069986138993, -1.7774389886804625,
+     -0.15474226409188954, -1.9466444989476386},
+    {-5.7268615989918104, 18.515071847519625, -2.1314924042501087,
+     -0.1860960289860461, -1.8861884001806755},
+    {-5.7104991372804053, 18.477388579068219, -2.4724318230292872,
+     -0.2164812360173799, -1.8282266087403041},
+    {-5.6941366755690002, 18.434230259840383, -2.8008008510001265,
+     -0.24593726938599081, -1.7725873747262431},
+    {-5.6777742138575951, 18.385798369511992, -3.1171075735231666,
+     -0.27450083924747515, -1.7191152480254634},
+    {-5.66141175214619, 18.332286342243691, -3.4218278284305872,
+     -0.30220623214107356, -1.6676691389060376},
+    {-5.6450492904347849, 18.273880070190948, -3.7154080978376074,
+     -0.3290855320017449, -1.6181206535815911},
+    {-5.6286868287233798, 18.21075836244783, -3.9982680717789525,
+     -0.35516881587510385, -1.5703526598129955},
+    {-5.6123243670119747, 18.143093364416448, -4.2708029282354154,
+     -0.3804843277892373, -1.5242580458805268},
+    {-5.5959619053005696, 18.071050941933152, -4.5333853671211779,
+     -0.40505863369326151, -1.4797386428434984},
+    {-5.5795994435891645, 17.994791033904036, -4.7863674300476866,
+     -0.42891675992504413, -1.4367042852795762},
+    {-5.5632369818777594, 17.914467976730588, -5.0300821329188583,
+     -0.45208231730055248, -1.3950719899465391},
+    {-5.5305120584549492, 17.742223519709871, -5.4909550604550885,
+     -0.49642374905056152, -1.3157133272267485},
+    {-5.4977871350321381, 17.555451024063551, -5.9183400938606612,
+     -0.53824747562057662, -1.2411171204628646},
+    {-5.465062211609327, 17.35521125552814, -6.3143491536644065,
+     -0.57770148894654438, -1.1708146490571223},
+    {-5.4323372881865168, 17.142499112878792, -6.6809003910543803,
+     -0.61491951223123265, -1.1044006126178796},
+    {-5.3996123647637067, 16.91824954538059, -7.0197433191648617,
+     -0.65002289469644681, -1.0415224879971909},
+    {-5.3668874413408965, 16.683342717275515, -7.3324798479003626,
+     -0.68312219401310659, -0.98187199296854999},
+    {-5.3341625179180863, 16.438608539890822, -7.6205820136892788,
+     -0.71431850717810319, -0.92517818062418455},
+    {-5.3014375944952761, 16.184830669011202, -7.8854070205545677,
+     -0.7437045971023355, -0.8712018085014136},
+    {-5.2687126710724659, 15.922750047277296, -8.128210077135348,
+     -0.77136585201948582, -0.81973071323226376},
+    {-5.2359877476496557, 15.653068057189971, -8.3501554140517076,
+     -0.79738110710820009, -0.77057598506736702},
+    {-5.2032628242268455, 15.376449339079839, -8.5523257889884441,
+     -0.82182335179842059, -0.72356878369127042},
+    {-5.1705379008040353, 15.093524319307573, -8.735730727159206,
+     -0.84476034164654046, -0.67855767196303896},
+    {-5.1378129773812251, 14.804891486704015, -8.9013136981193153,
+     -0.86625513008225241, -0.63540637082219409},
+    {-5.105088053958414, 14.511119449265506, -9.0499583930916341,
+     -0.88636653251009279, -0.59399185888318684},
+    {-5.0723631305356029, 14.212748798274353, -9.1824942377449261,
+     -0.90514953301217271, -0.55420275583584189},
+    {-5.0396382071127928, 13.910293802964322, -9.2997012519935875,
+     -0.92265564211219286, -0.51593794085415268},
+    {-5.0069132836899826, 13.604243955561575, -9.4023143495755068,
+     -0.93893321262458651, -0.47910536665148484},
+    {-4.9741883602671724, 13.295065383695732, -9.4910271549282967,
+     -0.95402771945074838, -0.4436210372395315},
+    {-4.908738513421552, 12.669077416034597, -9.6293399732170979,
+     -0.98083651704897312, -0.37639619392537138},
+    {-4.8432886665759316, 12.035638278600603, -9.7194833880456137,
+     -1.0033970776015106, -0.31372162182717261},
+    {-4.7778388197303112, 11.397755347386527, -9.7658241135292378,
+     -1.0219917918956167, -0.25513839259271476},
+    {-4.7123889728846899, 10.758163930199373, -9.772319359299015,
+     -1.0368752893202795, -0.20025482641646247},
+    {-4.6469391260390687, 10.119352202466764, -9.7425720602765633,
+     -1.048278425435377, -0.14873434140608757},
+    {-4.5814892791934483, 9.4835828549809715, -9.6798765007294918,
+     -1.0564115630140243, -0.1002858920769593},
+    {-4.5160394323478279, 8.8529120144128601, -9.5872563150008823,
+     -1.06146729436512, -0.054656368935008297},
+    {-4.4505895855022066, 8.2292058838241182, -9.4674963789679278,
+     -1.0636227175168311, -0.01162450067718691},
+    {-4.3851397386565854, 7.6141554631545256, -9.3231697614661755,
+     -1.0630413529675096, 0.029004079993185806},
+    {-4.319689891810965, 7.0092896419466797, -9.1566606478833705,
+     -1.0598747684691525, 0.06740086057876972},
+    {-4.2542400449653446, 6.415986903501036, -8.9701839543409854,
+     -1.0542639648362928, 0.1037177548859249},
+    {-4.1887901981197242, 5.8354858376818566, -8.7658022032275262,
+     -1.0463405647724184, 0.13808983760555588},
+    {-4.1233403512741038, 5.2688946261142213, -8.5454401172406858,
+     -1.0362278382622674, 0.17063762044920977},
+    {-4.0578905044284825, 4.7171996366005979, -8.3108973008814129,
+     -1.0240415915377106, 0.20146895782046439},
+    {-3.9924406575828622, 4.1812732417816925, -8.0638593092641191,
+     -1.0098909415157358, 0.23068065103918778},
+    {-3.9269908107372413, 3.6618809593046193, -7.805907349578554,
+     -0.99387899358403342, 0.25835980567584815},
+    {-3.8615409638916205, 3.1596879961664981, -7.5385268171738442,
+     -0.97610343741849059, 0.28458498543180671},
+    {-3.7960911170460001, 2.6752652678651572, -7.2631148335063465,
+     -0.95665707296803193, 0.30942719737987429},
+    {-3.7306412702003797, 2.209094952998087, -6.9809869251937435,
+     -0.93562827669286752, 0.33295073664499419},
+    {-3.6651914233547589, 1.7615756355839671, -6.6933829607052067,
+     -0.91310141648464527, 0.35521391330705832},
+    {-3.6324664999319483, 1.5449129825954879, -6.547895542764536,
+     -0.90130157330937621, 0.36588960728194375},
+    {-3.5997415765091381, 1.3330270804177056, -6.4014724426823681,
+     -0.88915722234847461, 0.37626968011186646},
+    {-3.5670166530863279, 1.1259463137589101, -6.254249629571933,
+     -0.87667794095669582, 0.38636000298322687},
+    {-3.5342917296635172, 0.92369468082266626, -6.1063592386757133,
+     -0.86387311882387674, 0.39616617623151484},
+    {-3.5015668062407066, 0.72629191675842164, -5.9579296933144974,
+     -0.85075196661904473, 0.40569354260205553},
+    {-3.4688418828178964, 0.53375361322117421, -5.8090858205321982,
+     -0.83732352421512168, 0.41494719963284588},
+    {-3.4361169593950862, 0.34609133425267868, -5.6599489608186406,
+     -0.82359666852187863, 0.4239320112234275},
+    {-3.4033920359722756, 0.16331272865652841, -5.5106370722646059,
+     -0.80958012095282106, 0.43265261844823194},
+    {-3.38702957426087, 0.073756149954995368, -5.435951453646032,
+     -0.8024658973980594, 0.43691523733239063},
+    {-3.3706671125494649, -0.014578360945642212, -5.3612648294774647,
+     -0.79528245454983171, 0.44111344966778959},
+    {-3.3379421891266547, -0.18758179220980087, -5.2119437175622148,
+     -0.78071210078774267, 0.44931872998669037},
+    {-3.3052172657038446, -0.35570102017168154, -5.062782121450951,
+     -0.76587735607946994, 0.4572724901030103},
+    {-3.2724923422810344, -0.51894299719109171, -4.9138854108438768,
+     -0.75078638800094755, 0.46497857459021796},
+    {-3.2397674188582242, -0.6773180756148458, -4.7653560210064407,
+     -0.73544724125379846, 0.47244064964911753},
+    {-3.207042495435414, -0.83083991301499216, -4.6172935296504338,
+     -0.7198678433825294, 0.47966221036429479},
+    {-3.1743175720126038, -0.97952537988242239, -4.4697947301110643,
+     -0.70405601026193054, 0.48664658749667955},
+    {-3.1415926485897931, -1.1233944696578626, -4.3229537010176111,
+     -0.68801945136937326, 0.49339695384124471},
+    {-3.0761428017441723, -1.3967785820974705, -4.0316080900974409,
+     -0.65530249242842686, 0.50620759082998834},
+    {-3.0106929548985519, -1.6512113747634429, -3.7439574755713592,
+     -0.6217767025162344, 0.51811656103359893},
+    {-2.9452431080529311, -1.8869565354289439, -3.4606631332121527,
+     -0.5875004212300764, 0.52914411945144912},
+    {-2.8797932612073103, -2.1043197866197536, -3.1823485462155681,
+     -0.55253073008466869, 0.53930847710498797},
+    {-2.8143434143616894, -2.3036464637481497, -2.9096009585624354,
+     -0.5169235821958762, 0.54862592321883819},
+    {-2.7488935675160686, -2.4853191901639673, -2.6429727856277121,
+     -0.48073392452511943, 0.55711093063825345},
+    {-2.6834437206704482, -2.6497556402071893, -2.3829828944739666,
+     -0.44401581373180193, 0.56477624595885212},
+    {-2.6179938738248274, -2.7974063820832487, -2.1301177647111853,
+     -0.40682252659345103, 0.57163296557561727},
+    {-2.5525440269792066, -2.9287527930860016, -1.8848325394375069,
+     -0.36920666588229256, 0.57769059861723138},
+    {-2.4870941801335862, -3.0443050402224006, -1.6475519745665226,
+     -0.33122026253103726, 0.58295711751204282},
+    {-2.4216443332879658, -3.1446001198508542, -1.4186712937709487,
+     -0.29291487487858314, 0.58743899672689326},
+    {-2.356194486442345, -3.2301999503613654, -1.1985569553079569,
+     -0.25434168575737498, 0.59114124002383828},
+    {-2.2907446395967241, -3.3016895123070946, -0.98754733611923606,
+     -0.2155515981678974, 0.59406739638663608},
+    {-2.2252947927511038, -3.3596750307336576, -0.78595333780235044,
+     -0.17659533028221538, 0.59621956457295366},
+    {-2.1598449459054829, -3.4047821947172112, -0.59405891831418822,
+     -0.1375235105280064, 0.59759838604317339},
+    {-2.0943950990598621, -3.4376544093587111, -0.41212155257856203,
+     -0.098386773527964308, 0.5982030257954708},
+    {-2.0289452522142417, -3.4589510756733062, -0.24037262451540994,
+     -0.059235857708108422, 0.59803114039119254},
+    {-1.9634954053686209, -3.4693458939442059, -0.079017752376307052,
+     -0.020121705444345689, 0.59707883217464575},
+    {-1.9307704819458107, -3.4706691382124175, -0.0022953629721965208,
+     -0.00059441632075379501, 0.59630836186046732},
+    {-1.8980455585230003, -3.4695251862235916, 0.071762951352497606,
+     0.01890443330779196, 0.59534058836477699},
+    {-1.8325957116773797, -3.4601862337198876, 0.2118146848453992,
+     0.057790892856429493, 0.59280920330736664},
+    {-1.7671458648317588, -3.4420356248387964, 0.34100782664142409,
+     0.096485477918906756, 0.58947568170492814},
+    {-1.701696017986138, -3.4157876096129227, 0.45923787084467133,
+     0.13493534273769814, 0.58532912006096305},
+    {-1.6362461711405172, -3.3821624561940369, 0.56642542923720152,
+     0.17308686163109077, 0.58035656284998971},
+    {-1.5707963242948964, -3.3418848049559031, 0.66251630252054672,
+     0.21088548918585576, 0.57454282900682674},
+    {-1.5053464774492757, -3.2956820155947644, 0.74748162380009553,
+     0.24827560797387349, 0.56787030315206133},
+    {-1.4398966306036551, -3.2442825023596873, 0.82131807845481453,
+     0.2852003612615196, 0.56031868444405708},
+    {-1.3744467837580345, -3.1884140522538504, 0.88404820573424858,
+     0.32160146765270525, 0.55186468394230448},
+    {-1.3089969369124139, -3.1288021206414998, 0.93572078884889209,
+     0.35741901392680719, 0.54248165869850495},
+    {-1.2435470900667933, -3.0661680981998827, 0.97641134203909408,
+     0.39259122144970365, 0.53213916719335974},
+    {-1.1780972432211727, -3.0012275425395498, 1.0062227052162473,
+     0.42705418037691728, 0.52080242581494185},
+    {-1.1126473963755521, -2.9346883670270443, 1.0252857593965603,
+     0.4607415443277123, 0.50843163923726298},
+    {-1.0471975495299315, -2.8672489783974373, 1.0337602794709859,
+     0.4935841761351632, 0.49498116789939989},
+    {-0.98174770268431066, -2.7995963535022126, 1.0318359451265737,
+     0.52550973244210863, 0.48039848188841133},
+    {-0.91629785583868983, -2.7324040440018313, 1.0197335363174667,
+     0.55644217097076032, 0.46462283011957689},
+    {-0.850848008993069, -2.6663300959060035, 0.99770634711082073,
+     0.58630115870609512, 0.44758352304055571},
+    {-0.78539816214744818, -2.6020148682378892, 0.96604186180641471,
+     0.61500135113955934, 0.429197679804871},
+    {-0.71994831530182735, -2.5400787319003433, 0.92506375118745487,
+     0.64245150070226642, 0.40936721579854318},
+    {-0.65449846845620652, -2.4811196253561905, 0.87513426657678606,
+     0.6685533341590566, 0.38797472316598475},
+    {-0.58904862161058569, -2.4257104377965186, 0.8166571382963107,
+     0.69320010974933988, 0.36487768659387698},
+    {-0.52359877476496486, -2.3743961821475068, 0.75008112872919208,
+     0.7162747172831827, 0.33990010055887976},
+    {-0.45814892791934425, -2.3276909084102027, 0.67590445847812086,
+     0.73764710260013078, 0.31281984409850783},
+    {-0.39269908107372364, -2.2860742901349904, 0.59468043615161481,
+     0.75717064899366548, 0.28334873504900138},
+    {-0.35997415765091334, -2.2673137919059885, 0.55161540288305455,
+     0.76618750424021576, 0.26760070661932112},
+    {-0.32724923422810304, -2.2499877894690723, 0.50702481696895785,
+     0.77467685778531958, 0.25109903565760128},
+    {-0.29452431080529273, -2.2341447745971603, 0.46099703619409199,
+     0.78261287656293477, 0.23376982213649328},
+    {-0.26179938738248243, -2.2198302612599887, 0.41362577931623223,
+     0.78996704967826226, 0.21552246591074031},
+    {-0.22907446395967213, -2.2070866010172239, 0.36501070802504326,
+     0.79670754591245563, 0.19624334910762609},
+    {-0.19634954053686182, -2.1959527770408211, 0.31525815874547908,
+     0.80279831030797311, 0.17578585841253352},
+    {-0.16362461711405152, -2.1864641708891219, 0.26448209000980455,
+     0.80819773538553863, 0.15395363318259625},
+    {-0.13089969369124121, -2.1786522933365098, 0.21280535661229802,
+     0.81285658740444133, 0.13047006753949209},
+    {-0.098174770268430911, -2.1725444655577766, 0.1603615155532789,
+     0.81671449352423275, 0.10491613333972895},
+    {-0.081812308557025759, -2.1701368682735325, 0.1338972401824963,
+     0.81831965473242751, 0.091160065257994208},
+    {-0.065449846845620607, -2.1681634272156178, 0.10729759099002475,
+     0.81969321672449624, 0.076579830367258517},
+    {-0.049087385134215455, -2.1666261855337785, 0.08058382557607735,
+     0.82082010842239672, 0.060965613124549463},
+    {-0.032724923422810304, -2.165526825398187, 0.053778881715848569,
+     0.82168078777478504, 0.043961112478782045},
+    {-0.016362461711405152, -2.1648666361087074, 0.026907979101039127,
+     0.82224727475705617, 0.024816004810920989},
+    {-0.0081812308557025759, -2.164701515125389, 0.013456591504680846,
+     0.82240629448203251, 0.013825707933259644},
+    {-0.004090615427851288, -2.1646602297297615, 0.0067286565805378248,
+     0.8224503988721622, 0.0076217043858344772},
+    {-0.002045307713925644, -2.1646499080248898, 0.0033643778417752936,
+     0.82246251233216727, 0.0041652771094345276},
+    {0, -2.1646464674222758, 0,
+     0.8224670334241132, 0},
+    {0, -2.1646464674222758, 0,
+     0.8224670334241132, -0.78539816339744828},
+    {0.001953125, -2.1646433338525339, 0.0032067859272200748,
+     0.82093719736833914, -0.7813980983265586},
+    {0.00390625, -2.1646339486600596, 0.0064016744429970717,
+     0.81941432870362518, -0.7780749346290422},
+    {0.0078125, -2.1645965159303175, 0.012756044521922714,
+     0.81638684940305373, -0.77210550758651142},
+    {0.015625, -2.1644476416119001, 0.025324905953508097,
+     0.81039699051225911, -0.76152044706047528},
+    {0.03125, -2.1638588881925327, 0.049915371398155856,
+     0.79864594237049369, -0.74305785595963514},
+    {0.046875, -2.1628914785889108, 0.073796811210201124,
+     0.78716598624214529, -0.72663902870336106},
+    {0.0625, -2.1615563145867274, 0.096991451817356716,
+     0.77593161453885373, -0.71154727636395509},
+    {0.078125, -2.159863967127766, 0.11951953391174192,
+     0.76492501703514826, -0.697442173846339},
+    {0.09375, -2.1578247028030684, 0.14139983688718907,
+     0.75413246339834172, -0.68412317940621192},
+    {0.125, -2.1527450860689346, 0.18328662485275535,
+     0.73314649941102139, -0.65935166522787803},
+    {0.15625, -2.1463941948591025, 0.22278204337308841,
+     0.71290253879388288, -0.63655136226211217},
+    {0.1875, -2.1388448803020674, 0.26000465010583218,
+     0.69334573361555252, -0.61532066647803552},
+    {0.21875, -2.1301664380661296, 0.29506375467846002,
+     0.67443143926505145, -0.59539397685465556},
+    {0.25, -2.1204248710183138, 0.32806100556776335,
+     0.65612201113552671, -0.57658232063913795},
+    {0.28125, -2.109683110147849, 0.35909151390575028,
+     0.63838491361022276, -0.55874422993615847},
+    {0.3125, -2.0980012051684809, 0.38824469273075679,
+     0.62119150836921089, -0.54176974477722339},
+    {0.34375, -2.08543649198382, 0.41560490852886184,
+     0.60451623058743542, -0.52557088504416472},
+    {0.375, -2.0720437419860214, 0.44125200229849004,
+     0.58833600306465339, -0.51007561753142239},
+    {0.40625, -2.0578752965829863, 0.46526171618552192,
+     0.57262980453602697, -0.4952238484622089},
+    {0.4375, -2.0429811895779868, 0.48770604954420965,
+     0.55737834233623962, -0.48096465651205333},
+    {0.5, -2.0112052518854076, 0.52816962714155713,
+     0.52816962714155713, -0.45405487515235399},
+    {0.5625, -1.9770740983158266, 0.56315435127229896,
+     0.50058164557537688, -0.42905934208583613},
+    {0.625, -1.9409153382347586, 0.59312752883009479,
+     0.4745020230640758, -0.40575419332645085},
+    {0.6875, -1.9030286162714145, 0.61851752016060746,
+     0.44983092375316902, -0.38395958198034397},
+    {0.75, -1.8636879070281267, 0.63971805489276146,
+     0.42647870326184101, -0.36352761803982381},
+    {0.8125, -1.8231435649559575, 0.65709178894507891,
+     0.40436417781235628, -0.344334358872321},
+    {0.875, -1.7816241704926816, 0.67097329326922328,
+     0.38341331043955618, -0.3262742804951928},
+    {0.9375, -1.7393382036242315, 0.68167160546821448,
+     0.3635581895830477, -0.30925633786562612},
+    {1, -1.6964755691408631, 0.68947243750832299,
+     0.34473621875416149, -0.29320108151695368},
+    {1.0625, -1.6532089928209011, 0.69464010761150485,
+     0.32688946240541406, -0.27803849877558567},
+    {1.125, -1.6096953041388751, 0.6974192472184273,
+     0.30996410987485656, -0.26370636547328552},
+    {1.1875, -1.5660766182823529, 0.69803632182150099,
+     0.293910030240632, -0.25014896574480561},
+    {1.25, -1.5224814281229933, 0.69670099576569899,
+     0.27868039830627961, -0.23731608264724105},
+    {1.3125, -1.4790256151390315, 0.69360736472367035,
+     0.2642313770375887, -0.22516219161770873},
+    {1.375, -1.4358133869411223, 0.68893507477265747,
+     0.25052184537187544, -0.2136458082704932},
+    {1.4375, -1.3929381479865326, 0.68285034337053396,
+     0.23751316291149008, -0.20272895529946358},
+    {1.5, -1.3504833092230837, 0.67550689473154013,
+     0.22516896491051336, -0.19237672246739057},
+    {1.5625, -1.3085230416677607, 0.66704681992045656,
+     0.2134549823745461, -0.18255690018466866},
+    {1.625, -1.267122978362043, 0.65760137026244037,
+     0.20233888315767395, -0.17323967187074657},
+    {1.6875, -1.2263408686210131, 0.64729169129335229,
+     0.19179013075358586, -0.16439735371685912},
+    {1.75, -1.1862271881179329, 0.6362295033711628,
+     0.18177985810604652, -0.15600417300431207},
+    {1.8125, -1.1468257079490005, 0.62451773417293144,
+     0.17228075425460176, -0.14803607803331598},
+    {1.875, -1.1081740255623194, 0.61225110756892331,
+     0.16326696201837956, -0.14047057415868389},
+    {1.9375, -1.0703040601331817, 0.59951669276162101,
+     0.15471398522880542, -0.1332865815333461},
+    {2, -1.0332425147779167, 0.58639441707668016,
+     0.14659860426917004, -0.12646431101558203},
+    {2.0625, -0.99701130777002467, 0.57295754537492227,
+     0.13889879887876905, -0.11998515536365836},
+    {2.125, -0.96162797477139039, 0.55927312870362922,
+     0.1315936773420304, -0.11383159336759298},
+    {2.1875, -0.92710604392338192, 0.54540242450919107,
+     0.12466341131638654, -0.10798710498542015},
+    {2.25, -0.89345538550406534, 0.53140129048183027,
+     0.11808917566262894, -0.1024360958854226},
+    {2.3125, -0.86068253774925596, 0.51732055388856846,
+     0.11185309273266346, -0.097163830064848564},
+    {2.375, -0.82879101031040958, 0.50320635806683212,
+     0.10593818064564886, -0.092156369433766233},
+    {2.4375, -0.79778156673304479, 0.48910048759259156,
+     0.10032830514719827, -0.087400519430580248},
+    {2.5, -0.76765248723877377, 0.47504067349982948,
+     0.095008134699965899, -0.082883779881651742},
+    {2.5625, -0.7383998130258087, 0.46106087980882982,
+     0.089963098499283869, -0.078594300437767425},
+    {2.625, -0.7100175732101428, 0.44719157251651309,
+     0.08517934714600249, -0.07452084001990722},
+    {2.6875, -0.68249799547950729, 0.43345997211051585,
+     0.080643715741491317, -0.070652729789776381},
+    {2.75, -0.65583170145349712, 0.41989029058791932,
+     0.076343689197803516, -0.066979839229991567},
+    {2.8125, -0.63000788768424254, 0.40650395388795091,
+     0.072267369580080162, -0.063492544977107407},
+    {2.875, -0.60501449320177747, 0.3933198105842019,
+     0.068403445318991632, -0.060181702099816929},
+    {2.9375, -0.58083835441130294, 0.38035432762482163,
+     0.064741162148905809, -0.057038617556243232},
+    {3, -0.55746534815128879, 0.36762177385783174,
+     0.061270295642971956, -0.054055025599535379},
+    {3.0625, -0.53488052363630934, 0.35513439203233144,
+     0.0579811252297684, -0.051223064931051943},
+    {3.125, -0.51306822400460084, 0.34290255992426644,
+     0.054864409587882634, -0.048535257426093069},
+    {3.1875, -0.49201219810854735, 0.33093494119705402,
+     0.051911363325028083, -0.045984488279144635},
+    {3.25, -0.47169570318716231, 0.31923862657220459,
+     0.049113634857262244, -0.043563987434490574},
+    {3.3125, -0.45210159900008023, 0.30781926585271452,
+     0.04646328541173049, -0.041267312184319054},
+    {3.375, -0.43321243399208248, 0.29668119131216053,
+     0.043952769083283043, -0.039088330830484984},
+    {3.4375, -0.41501052399013377, 0.28582753293468027,
+     0.041574913881408042, -0.037021207318235209},
+    {3.5, -0.39747802394791698, 0.27526032596525851,
+     0.039322903709322649, -0.035060386760722123},
+    {3.5625, -0.3805969931978429, 0.26498061120562205,
+     0.037190261221841693, -0.033200581782268347},
+    {3.625, -0.36434945464879365, 0.25498852846849263,
+     0.035170831512895531, -0.031436759616293747},
+    {3.6875, -0.34871744834288682, 0.24528340358169307,
+     0.033258766587348214, -0.029764129900738984},
+    {3.75, -0.33368307977322959, 0.23586382931363642,
+     0.031448510575151523, -0.028178133119867541},
+    {3.8125, -0.31922856332128779, 0.22672774057280493,
+     0.02973478564889245, -0.026674429646611115},
+    {3.875, -0.30533626116356588, 0.21787248421596844,
+     0.028112578608512056, -0.025248889344252668},
+    {3.9375, -0.2919887179748008, 0.2092948837829044,
+     0.026577128099416432, -0.023897581690301224},
+    {4, -0.2791686917386445, 0.2009912994592806,
+     0.025123912432410075, -0.022616766388976577},
+    {4.0625, -0.26685918095244837, 0.19295768355402901,
+     0.023748637975880494, -0.021402884441860868},
+    {4.125, -0.25504344849479804, 0.18518963176293141,
+     0.022447228092476533, -0.020252549649037711},
+    {4.1875, -0.24370504241236199, 0.17768243047622531,
+     0.021215812594176157, -0.019162540515479425},
+    {4.25, -0.23282781387847995, 0.1704311003747509,
+     0.020050717691147163, -0.018129792539600977},
+    {4.3125, -0.22239593252067066, 0.1634304365464832,
+     0.018948456411186459, -0.017151390862809202},
+    {4.375, -0.21239389935666039, 0.15667504534318805,
+     0.017905719467792919, -0.016224563260571003},
+    {4.4375, -0.20280655751612536, 0.15015937818536435,
+     0.016919366556097392, -0.015346673457032599},
+    {4.5, -0.19361910094446089, 0.14387776251258846,
+     0.015986418056954273, -0.014515214746563256},
+    {4.5625, -0.18481708125282476, 0.13782443006581144,
+     0.015104047130499884, -0.013727803906796301},
+    {4.625, -0.1763864128819452, 0.13199354267807062,
+     0.01426957218141304, -0.012982175388813062},
+    {4.6875, -0.16831337672540128, 0.12637921574043043,
+     0.013480449678979245, -0.01227617577107718},
+    {4.75, -0.16058462235448073, 0.12097553950076854,
+     0.012734267315870374, -0.01160775846459264},
+    {4.8125, -0.15318716898150148, 0.11577659834422313,
+     0.012028737490308897, -0.010974978657538834},
+    {4.875, -0.14610840526825192, 0.11077648819573105,
+     0.011361691096998056, -0.010375988488342416},
+    {4.9375, -0.13933608810832279, 0.10596933217707893,
+     0.010731071612868752, -0.0098090324367854989},
+    {5, -0.13285834048151832, 0.10134929464325701,
+     0.0101349294643257, -0.0092724429233324787},
+    {5.0625, -0.12666364847747866, 0.096910593715628116,
+     0.0095714166632719123, -0.0087646361073900093},
+    {5.125, -0.12074085757664811, 0.09264751242249461,
+     0.0090387816997555721, -0.0082841078757011303},
+    {5.1875, -0.11507916828533989, 0.088554408551050207,
+     0.0085353646796192967, -0.0078294300125225612},
+    {5.25, -0.10966813118248388, 0.084625723308421386,
+     0.0080595926960401326, -0.0073992465436468436},
+    {5.3125, -0.10449764146455461, 0.080855988883543436,
+     0.0076099754243335004, -0.0069922702467125524},
+    {5.375, -0.099557933049459021, 0.077239834995935161,
+     0.0071851009298544337, -0.006607279320600427},
+    {5.4375, -0.09483957230235382, 0.073771994512062983,
+     0.0067836316792701593, -0.0062431142070431805},
+    {5.5, -0.090333451434523829, 0.070447308204865805,
+     0.0064043007458968911, -0.0058986745578848993},
+    {5.5625, -0.086030781631083672, 0.067260728727175964,
+     0.0060459082001955928, -0.0055729163417152254},
+    {5.625, -0.081923085954378194, 0.064207323865177773,
+     0.0057073176769046911, -0.0052648490838748023},
+    {5.6875, -0.078002192061968137, 0.061282279133698367,
+     0.0053874531106548017, -0.0049735332340845014},
+    {5.75, -0.074260224784828591, 0.058480899771018627,
+     0.005085295632262489, -0.0046980776561929248},
+    {5.8125, -0.070689598597165226, 0.05579861218699974,
+     0.0047998806182365369, -0.0044376372347658668},
+    {5.875, -0.067283010007025079, 0.053230964914651263,
+     0.0045302948863532987, -0.0041914105934590055},
+    {5.9375, -0.064033429911977691, 0.050773629111801721,
+     0.0042756740304675132, -0.0039586379203222907},
+    {6, -0.06093409592573909, 0.048422398656259094,
+     0.0040351998880215909, -0.0037385988953818963},
+    {6.0625, -0.057978504713657328, 0.046173189874769795,
+     0.0038080981340016325, -0.0035306107160341356},
+    {6.125, -0.055160404361342993, 0.044022040943182086,
+     0.0035936359953618029, -0.0033340262159663771},
+    {6.1875, -0.052473786782979433, 0.041965110992486176,
+     0.0033911200802009033, -0.0031482320734924074},
+    {6.25, -0.049912880196759879, 0.039998678952837458,
+     0.0031998943162269968, -0.0029726471053557117},
+    {6.3125, -0.047472141677463914, 0.03811914216525486,
+     0.0030193379932875138, -0.0028067206422130965},
+    {6.375, -0.045146249809265432, 0.036323014788420357,
+     0.0028488639049741456, -0.0026499309821637279},
+    {6.4375, -0.042930097435383271, 0.034606926025881272,
+     0.0026879165845344675, -0.0025017839188360121},
+    {6.5, -0.040818784530666265, 0.032967618196963762,
+     0.0025359706305356738, -0.0023618113406856851},
+    {6.5625, -0.038807611189279681, 0.03140194467284213,
+     0.0023925291179308292, -0.0022295698982948979},
+    {6.625, -0.03689207075922929, 0.029906867697460641,
+     0.002257122090374388, -0.0021046397365929717},
+    {6.6875, -0.035067843104356546, 0.028479456111373737,
+     0.0021293051298223353, -0.0019866232890458262},
+    {6.75, -0.033330788014487141, 0.027116882995045864,
+     0.002008657999633027, -0.0018751441309826197},
+    {6.8125, -0.031676938770235807, 0.025816423246728403,
+     0.001894783357558048, -0.0017698458893454071},
+    {6.875, -0.030102495850774687, 0.024575451108704734,
+     0.0017873055351785262, -0.0016703912062605653},
+    {6.9375, -0.028603820807774474, 0.023391437654458242,
+     0.0016858693805014949, -0.0015764607539394406},
+    {7, -0.027177430289851139, 0.022261948248167046,
+     0.0015901391605833604, -0.0014877522985206489},
+    {7.0625, -0.025819990231703435, 0.021184639986859859,
+     0.0014997975211936184, -0.001403979810567413},
+    {7.125, -0.024528310197497218, 0.020157259134572499,
+     0.0014145445006717543, -0.0013248726200306296},
+    {7.1875, -0.023299337892518972, 0.019177638556923338,
+     0.0013340965952642321, -0.0012501746135821388},
+    {7.25, -0.022130153826083829, 0.018243695163669412,
+     0.0012581858733565112, -0.0011796434723127817},
+    {7.3125, -0.02101796614358508, 0.017353427366014605,
+     0.0011865591361377508, -0.0011130499478768769},
+    {7.375, -0.01996010560566517, 0.016504912554706604,
+     0.0011189771223529901, -0.0010501771752481842},
+    {7.4375, -0.01895402073236219, 0.015696304604284707,
+     0.0010552137549098963, -0.00099082002033297023},
+    {7.5, -0.017997273105319005, 0.01492583140821385,
+     0.00099505542721425671, -0.00093478446076310446},
+    {7.5625, -0.01708753280752081, 0.014191792449066008,
+     0.00093830032721097575, -0.00088188699826652068},
+    {7.625, -0.01622257403347268, 0.013492556407378552,
+     0.00088475779720515097, -0.0008319541010838534},
+    {7.6875, -0.015400270833313148, 0.012826558812333739,
+     0.00083424772763146266, -0.00078482167496881142},
+    {7.75, -0.014618593006606673, 0.012192299736954118,
+     0.00078659998302929796, -0.00074033456137575864},
+    {7.8125, -0.013875602140099837, 0.011588341540100836,
+     0.0007416538585664535, -0.00069834606150142361},
+    {7.875, -0.013169447785016197, 0.011013306657185088,
+     0.0006992575655355612, -0.00065871748490840842},
+    {7.9375, -0.01249836377040936, 0.010465875441161484,
+     0.00065926774432513283, -0.00062131772151656733},
+    {8, -0.011860664645809581, 0.0099447840550590753,
+     0.0006215490034411922, -0.00058602283580427752},
+    {8.0625, -0.011254742262986067, 0.0094488224170219369,
+     0.0005859734832261666, -0.00055271568211530018},
+    {8.125, -0.01067906247412085, 0.0089768321985726398,
+     0.00055242044298908549, -0.00052128554001836522},
+    {8.1875, -0.010132161961238062, 0.0085277048765790339,
+     0.00052077587032543717, -0.00049162776871593619},
+    {8.25, -0.0096126451820411993, 0.0081003798391922673,
+     0.00049093211146619806, -0.00046364347954576813},
+    {8.3125, -0.0091191814344280791, 0.0076938425458346529,
+     0.00046278752155396407, -0.00043723922566411225},
+    {8.375, -0.0086505020290888763, 0.0073071227411444992,
+     0.00043624613379967159, -0.00041232670804270251},
+    {8.4375, -0.008205397582947558, 0.0069392927226315706,
+     0.00041121734652631531, -0.00038882249695301301},
+    {8.5, -0.0077827154046456858, 0.006589465661660983,
+     0.00038761562715652843, -0.0003666477681509188},
+    {8.5625, -0.0073813569977244677, 0.0062567939772611774,
+     0.00036536023224882787, -0.00034572805301275354},
+    {8.625, -0.0070002756516209458, 0.0059404677621447046,
+     0.00034437494273302635, -0.0003259930019099286},
+    {8.6875, -0.0066384741402753852, 0.0056397132602364463,
+     0.0003245878135387883, -0.00030737616014391906},
+    {8.75, -0.0062950025040272974, 0.0053537913949206258,
+     0.0003059309368526072, -0.00028981475579641618},
+    {8.8125, -0.0059689559298386234, 0.0050819963471474038,
+     0.00028834021827786686, -0.00027324949888104784},
+    {8.875, -0.0056594727136524562, 0.0048236541824778515,
+     0.00027175516521001981, -0.00025762439121317831},
+    {8.9375, -0.0053657323122837872, 0.0045781215260937034,
+     0.00025611868677447291, -0.00024288654644306367},
+    {9, -0.0050869534712104482, 0.0043447842847548872,
+     0.00024137690470860484, -0.00022898601972509114},
+    {9.125, -0.0045713412252708805, 0.0039123787340647458,
+     0.00021437691693505459, -0.00020351089006787602},
+    {9.25, -0.0041071055215053829, 0.0035220647058322426,
+     0.00019038187599093202, -0.00018085236099436489},
+    {9.375, -0.0036892375117146517, 0.0031698635856661529,
+     0.00016905939123552815, -0.00016070140042690172},
+    {9.5, -0.0033132027822103389, 0.0028521576887636608,
+     0.00015011356256650846, -0.00014278255720448781},
+    {9.625, -0.0029748981879805748, 0.0025656594856801112,
+     0.00013328101224312265, -0.00012685035699704197},
+    {9.75, -0.0026706123803161637, 0.002307383188613074,
+     0.00011832734300579867, -0.00011268607875147081},
+    {9.875, -0.0023969897530498577, 0.0020746185541331667,
+     0.00010504397742446414, -0.00010009487237673133},
+    {10, -0.0021509975248751086, 0.0018649067613950058,
+     9.3245338069750287e-05, -8.8903182306374043e-05},
+    {10.125, -0.0019298957167581941, 0.00167601822898244,
+     8.2766332295429142e-05, -7.8956445133163437e-05},
+    {10.25, -0.0017312097918917959, 0.0015059322384326748,
+     7.34601091918378e-05, -7.0117032724386968e-05},
+    {10.375, -0.0015527057306462333, 0.0013528182379337994,
+     6.519605965946021e-05, -6.2262415129082092e-05},
+    {10.5, -0.001392367347696404, 0.0012150187055246107,
+     5.7858033596410031e-05, -5.5283520207861006e-05},
+    {10.625, -0.0012483756573953108, 0.0010910334571993627,
+     5.1342750927028835e-05, -4.9083269278215886e-05},
+    {10.75, -0.0011190901185491053, 0.00097950529151465929,
+     4.5558385651844619e-05, -4.3575270197017628e-05},
+    {10.875, -0.0010030315925383096, 0.00087920686851389112,
+     4.0423304299489248e-05, -3.868265121916653e-05},
+    {11, -0.00089886687235989906, 0.00078902872694934956,
+     3.5864942134061346e-05, -3.4337020697003702e-05},
+    {11.125, -0.00080539463834115464, 0.00070796834983118443,
+     3.1818802239603794e-05, -3.0477539237378494e-05},
+    {11.25, -0.00072153272973222581, 0.00063512019421838582,
+     2.8227564187483816e-05, -2.7050092328831694e-05},
+    {11.375, -0.00064630659378645829, 0.00056966660685316421,
+     2.5040290411128099e-05, -2.4006552705350454e-05},
+    {11.5, -0.00057883882262726029, 0.00051086955270002762,
+     2.2211719682609895e-05, -2.130412283936416e-05},
+    {11.625, -0.0005183396880646436, 0.00045806308866552759,
+     1.970163822217323e-05, -1.8904748967615514e-05},
+    {11.75, -0.00046409855370555837, 0.00041064651973230832,
+     1.7474319988608865e-05, -1.6774598960625979e-05},
+    {11.875, -0.00041547612268439435, 0.0003680781794349023,
+     1.549802860778536e-05, -1.4883597159995214e-05},
+    {12, -0.00037189741166919661, 0.00032986978103274721,
+     1.37445742096978e-05, -1.3205010037071334e-05},
+    {12.125, -0.00033284540839976384, 0.00029558128989939865,
+     1.2188919171109222e-05, -1.1715077180054232e-05},
+    {12.25, -0.00029785533232312689, 0.00026481627155036522,
+     1.0808827410218989e-05, -1.0392682701997476e-05},
+    {12.375, -0.00026650945542862982, 0.00023721767338172,
+     9.5845524598674754e-06, -9.2190626863567761e-06},
+    {12.5, -0.00023843241982344891, 0.00021246400159595608,
+     8.4985600638382432e-06, -8.1775447559318564e-06},
+    {12.625, -0.0002132870153922011, 0.00019026585795990064,
+     7.5352815033624022e-06, -7.2533162708883059e-06},
+    {12.75, -0.00019077036298355645, 0.00017036280398212626,
+     6.680894273808873e-06, -6.4332180370938637e-06},
+    {12.875, -0.00017061048129541717, 0.00015252052282528023,
+     5.9231271000108824e-06, -5.7055607418286098e-06},
+    {13, -0.00015256317825996257, 0.0001365282517932223,
+     5.2510866074316275e-06, -5.0599616341414301e-06},
+    {13.25, -0.00012195199989468528, 0.00010935475250170442,
+     4.126594434026582e-06, -3.9790841054739149e-06},
+    {13.5, -9.7439556514818888e-05, 8.7544473318320289e-05,
+     3.2423879006785291e-06, -3.1285211743875156e-06},
+    {13.75, -7.782072996723928e-05, 7.0049306368101589e-05,
+     2.547247504294603e-06, -2.4593375035477018e-06},
+    {14, -6.212623837165707e-05, 5.6023551869557311e-05,
+     2.0008411381984754e-06, -1.9329607181621191e-06},
+    {14.25, -4.9577020419732579e-05, 4.4785393749913824e-05,
+     1.5714173245583798e-06, -1.5189953475740187e-06},
+    {14.5, -3.9547309833185752e-05, 3.5785575028609327e-05,
+     1.2339853458141148e-06, -1.1934958046014484e-06},
+    {14.75, -3.1534788250759458e-05, 2.8581958873349811e-05,
+     9.6887996180846817e-07, -9.3760254009132289e-07},
+    {15, -2.5136476779691392e-05, 2.2818893520663641e-05,
+     7.6062978402212134e-07, -7.364653961155857e-07},
+    {15.25, -2.002927510328779e-05, 1.8210492328990456e-05,
+     5.9706532226198217e-07, -5.7839397600028926e-07},
+    {15.5, -1.5954271838529419e-05, 1.4527100252148204e-05,
+     4.6861613716607107e-07, -4.5418738588187338e-07},
+    {15.75, -1.2704105486126728e-05, 1.158435029456967e-05,
+     3.6775715220856095e-07, -3.5660564636702938e-07},
+    {16, -1.0112784453110636e-05, 9.2343225841888295e-06,
+     2.8857258075590092e-07, -2.7995295547538283e-07},
+    {16.25, -8.0474999817156339e-06, 7.3584084435992775e-06,
+     2.2641256749536239e-07, -2.1974922906306544e-07},
+    {16.5, -6.4020442054674301e-06, 5.8615555295685072e-06,
+     1.7762289483540931e-07, -1.7247128989111815e-07},
+    {16.75, -5.09152009510454e-06, 4.6676305028341325e-06,
+     1.3933225381594426e-07, -1.353489900620234e-07},
+    {17, -4.0480973485669492e-06, 3.7156850969259074e-06,
+     1.0928485579193845e-07, -1.0620464734369026e-07},
+    {17.25, -3.2176033220820562e-06, 2.9569518084836616e-06,
+     8.5708748071990193e-08, -8.3326623700667571e-08},
+    {17.5, -2.5567922763026971e-06, 2.3524283406495582e-06,
+     6.7212238304273091e-08, -6.5369808964004704e-08},
+    {17.75, -2.0311533959541497e-06, 1.870936730619872e-06,
+     5.2702443116052735e-08, -5.1277300965531374e-08},
+    {18, -1.6131610865434101e-06, 1.4875648873180545e-06,
+     4.1321246869945958e-08, -4.0218780470356946e-08},
+    {18.25, -1.2808642541358516e-06, 1.1824159676247394e-06,
+     3.2394958017116147e-08, -3.1542032095479833e-08},
+    {18.5, -1.0167668674892152e-06, 9.396053810203559e-07,
+     2.5394740027577186e-08, -2.4734814357722832e-08},
+    {18.75, -8.0692988706743563e-07, 7.4645685037516448e-07,
+     1.9905516010004386e-08, -1.9394875212281156e-08},
+    {19, -6.4024854978010809e-07, 5.9285837747128666e-07,
+     1.5601536249244385e-08, -1.5206377286264289e-08},
+    {19.25, -5.0788105840557096e-07, 4.7074658036076921e-07,
+     1.2227183905474524e-08, -1.192136586680127e-08},
+    {19.5, -4.0279022542070913e-07, 3.7369402480452777e-07,
+     9.581898071910968e-09, -9.3452034316054551e-09},
+    {19.75, -3.1937545474945482e-07, 2.9657914039802436e-07,
+     7.5083326683044145e-09, -7.3251235967117237e-09},
+    {20, -2.5318227854655897e-07, 2.3532231895222352e-07,
+     5.8830579738055879e-09, -5.7412378237293712e-09}};
+
+const std::size_t C_FermionTableRows = 2478;
+
+const double FermionTable[2478][5] = {
+    {-54.772255750516614, -357.1195341356518, 293.92876523307137,
+     2.6831902502965566, 3.7598167773351352},
+    {-54.686931961173485, -330.55340470950608, 328.86976301782721,
+     3.0068404939165125, 3.8263950652487977},
+    {-54.60160817183035, -300.98435250828203, 364.31542452821355,
+     3.3361235751675942, 3.8918577129982435},
+    {-54.516284382487214, -268.36987886045267, 400.25266625452258,
+     3.6709459456769173, 3.9562428591002226},
+    {-54.430960593144079, -232.66858384980625, 436.66881309631532,
+     4.0112172221274056, 4.0195865797165427},
+    {-54.345636803800943, -193.84013238118143, 473.55157722110096,
+     4.3568500165958186, 4.0819230342652135},
+    {-54.260313014457815, -151.84522198677357, 510.88903838600373,
+     4.7077597787712344, 4.1432845985134783},
+    {-54.174989225114686, -106.64555225350168, 548.66962559844342,
+     5.0638646490407488, 4.2037019864110459},
+    {-54.089665435771551, -58.203795762009577, 586.88210000417109,
+     5.4250853215302355, 4.26320436177771},
+    {-54.004341646428415, -6.4835704370427996, 625.51553890188438,
+     5.7913449162772359, 4.3218194408341217},
+    {-53.961679751756847, 20.617085449434157, 644.98678944021708,
+     5.976340918290429, 4.3508025330889097},
+    {-53.919017857085286, 48.55058678309927, 664.55932079343916,
+     6.1625688597934287, 4.3795735864544572},
+    {-53.833694067742158, 106.93324504273366, 704.00311138720144,
+     6.5386847733439231, 4.436491894923968},
+    {-53.748370278399022, 168.69810350868494, 743.83685047985307,
+     6.9196223683343403, 4.4925982758995548},
+    {-53.663046489055887, 233.87801422594373, 784.05073964882968,
+     7.3053133482528807, 4.54791552619748},
+    {-53.577722699712751, 302.50500395555048, 824.63523069373809,
+     7.6956913166650818, 4.6024653979672019},
+    {-53.492398910369616, 374.61029505624384, 865.58101477059517,
+     8.090691690803947, 4.6562686617524651},
+    {-53.449737015698048, 411.97684558916785, 886.18654560278458,
+     8.2899055737403717, 4.6828965524981712},
+    {-53.407075121026487, 450.22432546663157, 906.87901217000149,
+     8.4902516203603255, 4.709206160351405},
+    {-53.407075101026486, 450.22434360305812, 906.70561631533076,
+     8.4886282819287349, -81166.925045143144},
+    {-53.407073103655677, 450.22615169100811, 904.42315287478834,
+     8.4672600492394441, -5724.4442010673893},
+    {-53.40707110628486, 450.22795709072261, 903.41079733859976,
+     8.4577826365045485, -4051.4686131446624},
+    {-53.407069108914051, 450.22976073482647, 902.6336354317674,
+     8.450507119113853, -3308.5251615471275},
+    {-53.407067111543242, 450.23156295888037, 901.97841407641226,
+     8.4443732155576594, -2865.2335814010899},
+    {-53.407065114172426, 450.23336395704348, 901.40117401142061,
+     8.4389693768457921, -2562.5665210571287},
+    {-53.407063116801616, 450.23516386037795, 900.87934866587182,
+     8.4340843335238489, -2339.0774780226811},
+    {-53.407061119430807, 450.23696276513567, 900.39952486661991,
+     8.4295925107460405, -2165.3447788700619},
+    {-53.407059122059991, 450.23876074592562, 899.9529598842023,
+     8.4254120586137393, -2025.2810374192645},
+    {-53.407055127318372, 450.24235416528501, 899.13695966537477,
+     8.4177732466422306, -1811.0827142037765},
+    {-53.407051132576747, 450.24594448949995, 898.39938758708865,
+     8.4108686824602756, -1652.9434693644082},
+    {-53.407047137835121, 450.24953199101088, 897.721252314259,
+     8.4045205682068769, -1530.0245774879691},
+    {-53.407043143093503, 450.25311688090528, 897.09017760403731,
+     8.3986130368654131, -1430.9347771517957},
+    {-53.407035153610259, 450.26027947599772, 895.93715605213993,
+     8.3878196334549333, -1279.4098129720287},
+    {-53.407027164127015, 450.26743332469152, 894.89509115239434,
+     8.3780650100806096, -1167.5500137049346},
+    {-53.407019174643771, 450.27457919781256, 893.93710934071828,
+     8.3690975751473484, -1080.6079710555437},
+    {-53.407011185160528, 450.28171769263872, 893.04569934647498,
+     8.3607533873250457, -1010.5232657445814},
+    {-53.40699520619404, 450.2959743866291, 891.4172450807722,
+     8.345510186813387, -903.3562945297665},
+    {-53.406979227227545, 450.31020637691086, 889.94573762329946,
+     8.3317363245438347, -824.24582416808857},
+    {-53.40696324826105, 450.32441584410878, 888.59316083835461,
+     8.3190758919183398, -762.7595431987661},
+    {-53.406947269294562, 450.33860447782865, 887.33474392974813,
+     8.3072969838130639, -713.19589931426503},
+    {-53.406931290328075, 450.35277363745922, 886.15328045307376,
+     8.2962385128983716, -672.14098542304851},
+    {-53.406915311361587, 450.36692444758631, 885.03624217583274,
+     8.2857831894622969, -637.40933259537076},
+    {-53.406883353428604, 450.39517468828183, 882.95971918330906,
+     8.2663475543047671, -581.46489424557137},
+    {-53.406851395495622, 450.42336136821388, 881.05140402893574,
+     8.2484866735960054, -537.98429706496199},
+    {-53.406819437562646, 450.45148926670498, 879.27626112589007,
+     8.2318725434852258, -502.93523536579187},
+    {-53.406787479629671, 450.47956222896721, 877.60995424077475,
+     8.2162773278163499, -473.90335167817756},
+    {-53.406755521696688, 450.5075834360357, 876.03476407025914,
+     8.2015351383250277, -449.34308322101293},
+    {-53.40669160583073, 450.56348096244255, 873.10721098944839,
+     8.1741368425649306, -409.78256909189651},
+    {-53.406627689964772, 450.61919929355912, 870.41755243303862,
+     8.1489656816188756, -379.03591346950418},
+    {-53.406563774098814, 450.67475194804376, 867.91623731656239,
+     8.1255577590397756, -354.2515971276523},
+    {-53.406499858232856, 450.7301498022963, 865.56884699457282,
+     8.1035908484193744, -333.72228317369786},
+    {-53.406435942366898, 450.78540185408787, 863.35032126248029,
+     8.0828303370979242, -316.35502132417002},
+    {-53.406372026500939, 450.84051570860925, 861.24174156735421,
+     8.0630991105330541, -301.4134020836928},
+    {-53.406308110634981, 450.89549790469613, 859.22840999362222,
+     8.0442595677430955, -288.38072398881968},
+    {-53.406180278903065, 451.00508945154024, 855.44294853878728,
+     8.0088385283445476, -266.63898335317089},
+    {-53.406052447171149, 451.11421473304517, 851.92385825672523,
+     7.9759111488294483, -249.11338122604471},
+    {-53.405924615439233, 451.22290451389131, 848.622462003019,
+     7.9450217191604331, -234.5966015296313},
+    {-53.405796783707316, 451.33118424499401, 845.50331802438427,
+     7.9158384383689677, -222.31578525068622},
+    {-53.4056689519754, 451.43907543833359, 842.53967051229347,
+     7.8881108227474899, -211.7501961612769},
+    {-53.405541120243484, 451.54659658968239, 839.71073276056336,
+     7.8616442708626462, -202.53446084435743},
+    {-53.405413288511568, 451.65376382418572, 836.99997411596235,
+     7.8362840260616009, -194.40363942516822},
+    {-53.405285456779652, 451.76059136354701, 834.39399152939484,
+     7.8119046119944562, -187.16030820649638},
+    {-53.405029793315819, 451.97327672894369, 829.45398474404533,
+     7.765691620753107, -174.76747023526394},
+    {-53.404774129851987, 452.18473970853512, 824.82187008723929,
+     7.7223608144256124, -164.50222737695626},
+    {-53.404518466388154, 452.39505229485729, 820.4475235032636,
+     7.6814429477501847, -155.81807519283734},
+    {-53.404262802924322, 452.60427533904829, 816.29310510326366,
+     7.6425837775871788, -148.3467909473116},
+    {-53.404007139460482, 452.8124611607397, 812.32921685103713,
+     7.6055080916465823, -141.83001225009878},
+    {-53.403751475996643, 453.01965537418687, 808.53247987150178,
+     7.5699970275956403, -136.08039530110992},
+    {-53.40349581253281, 453.22589820963566, 804.88393853577247,
+     7.5358731323622559, -130.95833830274054},
+    {-53.403240149068978, 453.43122549644158, 801.36797058439731,
+     7.5029901589067549, -126.35739780658322},
+    {-53.402984485605145, 453.63566941169995, 797.97151998749496,
+     7.4712258844127835, -122.19480460540289},
+    {-53.402473158677481, 454.04202094218272, 791.49459850014409,
+     7.4106548974645428, -114.93573144857604},
+    {-53.401961831749809, 454.44515646239432, 785.38228396595605,
+     7.3534965479396659, -108.79467634639474},
+    {-53.401450504822137, 454.84524811914275, 779.58105940025757,
+     7.2992498521164855, -103.51126284700625},
+    {-53.400939177894472, 455.2424439269891, 774.04934690737832,
+     7.2475255943419725, -98.902798582560564},
+    {-53.400427850966807, 455.63687293346055, 768.75408135753582,
+     7.1980142509627631, -94.836809599641697},
+    {-53.399916524039135, 456.02864895670825, 763.66845333860419,
+     7.1504648606971344, -91.21458109473221},
+    {-53.399405197111463, 456.41787336621644, 758.77036777898468,
+     7.1046705949079456, -87.960845073806951},
+    {-53.398893870183798, 456.80463720043809, 754.04135900272365,
+     7.0604586008452488, -85.017073984585977},
+    {-53.398382543256133, 457.18902281184995, 749.46580714889149,
+     7.0176826661535658, -82.336979015665833},
+    {-53.397871216328461, 457.57110516691813, 745.03035955098528,
+     6.9762178021355599, -79.883404722718907},
+    {-53.396848562473124, 458.32862910560897, 736.53519081679065,
+     6.8968039373621544, -75.540312794302736},
+    {-53.395825908617795, 459.07769611974226, 728.48015959967495,
+     6.8215084906299976, -71.803681085611885},
+    {-53.394803254762458, 459.81872504796326, 720.80645837729242,
+     6.7497810127524094, -68.544324226601191},
+    {-53.393780600907121, 460.55208107489642, 713.46731947630064,
+     6.6811837581714464, -65.668567168727094},
+    {-53.392757947051791, 461.27808630369202, 706.42482292581474,
+     6.6153618026845313, -63.106606566655671},
+    {-53.391735293196454, 461.99702762186615, 699.64771647453745,
+     6.5520226363919232, -60.805218748738881},
+    {-53.390712639341118, 462.70916269143981, 693.10988113741314,
+     6.490921799634239, -58.723017529510351},
+    {-53.389689985485781, 463.41472460228499, 686.78922296031158,
+     6.4318525088553447, -56.827270978079518},
+    {-53.388667331630444, 464.11392554949413, 680.66685465971307,
+     6.3746379960344859, -55.091705552586376},
+    {-53.387644677775114, 464.80695978325082, 674.72647952434215,
+     6.319125741514739, -53.494954940648135},
+    {-53.386622023919777, 465.49400600648795, 668.9539196404246,
+     6.2651830578520311, -52.01944121826515},
+    {-53.384576716209111, 466.85078299317479, 657.86400531383674,
+     6.1615549450829503, -49.376030311934606},
+    {-53.382531408498437, 468.185442312546, 647.31392430015603,
+     6.0629751645414141, -47.070122099287907},
+    {-53.380486100787763, 469.49901797109936, 637.23751882774707,
+     5.9688246152777449, -45.035476045634013},
+    {-53.378440793077097, 470.7924220873889, 627.58114582264977,
+     5.8786013275985738, -43.22273190201264},
+    {-53.37639548536643, 472.0664671439327, 618.30059355138974,
+     5.791891602355407, -41.594253349081086},
+    {-53.374350177655757, 473.32188293322548, 609.35891127508216,
+     5.7083496965006582, -40.120774686055441},
+    {-53.372304869945083, 474.55932972210019, 600.72484173455246,
+     5.6276831513869245, -38.77914989031872},
+    {-53.370259562234416, 475.77940865521003, 592.37166363005099,
+     5.5496419587325923, -37.550799865280169},
+    {-53.36821425452375, 476.98267010052592, 584.27632017867961,
+     5.4740104043218336, -36.420615574456278},
+    {-53.366168946813076, 478.16962043255904, 576.41875180472516,
+     5.4006008223974993, -35.376166878260761},
+    {-53.364123639102402, 479.34072761046508, 568.7813773924139,
+     5.3292487405868414, -34.407121228196189},
+    {-53.362078331391736, 480.49642581312645, 561.34868557138452,
+     5.2598090547117566, -33.504809453647979},
+    {-53.357987715970395, 482.76318583401684, 547.04376052832276,
+     5.1261655840573326, -31.872128948903729},
+    {-53.353897100549055, 484.97283195895233, 533.41036333190721,
+     4.9987947677623152, -30.431283123136989},
+    {-53.349806485127715, 487.12795070007337, 520.37258515816848,
+     4.8769866232151413, -29.147366492479382},
+    {-53.345715869706375, 489.2308465783002, 507.86786006866743,
+     4.7601560105510945, -27.993764088450416},
+    {-53.341625254285034, 491.28359007237157, 495.84389483391902,
+     4.6478139020903466, -26.949780205708798},
+    {-53.337534638863694, 493.28805486869192, 484.25645147747161,
+     4.5395466321818381, -25.999046672532987},
+    {-53.333444023442354, 495.24594729988542, 473.06770977729195,
+     4.4350005745865415, -25.128424834490879},
+    {-53.329353408021014, 497.15882996054063, 462.2450344449361,
+     4.333870606946193, -24.32722991201117},
+    {-53.325262792599673, 499.02814090269902, 451.76003106961662,
+     4.2358912775232547, -23.58667153205284},
+    {-53.321172177178333, 500.85520942146297, 441.58781222155295,
+     4.1408299385675758, -22.899442658439181},
+    {-53.317081561756993, 502.64126917233864, 431.70641921188417,
+     4.0484813362471845, -22.259412537549949},
+    {-53.312990946335646, 504.38746917380269, 422.0963609629606,
+     3.9586632964171793, -21.661393919928901},
+    {-53.308900330914305, 506.09488311433734, 412.74024224090931,
+     3.8712132465576068, -21.100964216790622},
+    {-53.304809715492965, 507.76451728593452, 403.6224609527614,
+     3.7859853839366497, -20.574326418508001},
+    {-53.300719100071618, 509.39731739414822, 394.72895944484736,
+     3.7028483490414765, -20.078199732799721},
+    {-53.296628484650277, 510.99417444150833, 386.04701847392846,
+     3.6216832982700971, -19.609732717494083},
+    {-53.292537869228937, 512.55592984031705, 377.56508522881751,
+     3.5423822952033146, -19.166433636524868},
+    {-53.284356638386257, 515.57727965018842, 361.16001770457331,
+     3.3889873171931311, -18.346843380652306},
+    {-53.276175407543576, 518.46726311475652, 345.43969442319303,
+     3.2419715921864101, -17.604792447620859},
+    {-53.267994176700896, 521.23121906443009, 330.34145456873216,
+     3.1007498937628624, -16.928704723380253},
+    {-53.259812945858215, 523.87401220771665, 315.81172172313279,
+     2.9648219197105918, -16.309288006206916},
+    {-53.251631715015534, 526.40009998973949, 301.80425922165966,
+     2.8337559761249431, -15.738985487216583},
+    {-53.243450484172847, 528.81358693975756, 288.27883410276718,
+     2.7071764835043979, -15.21158010251933},
+    {-53.235269253330159, 531.11826936695968, 275.20017843782364,
+     2.5847542643978301, -14.721903828896014},
+    {-53.227088022487479, 533.31767250348798, 262.53717092462733,
+     2.4661988911896717, -14.265620536688116},
+    {-53.218906791644798, 535.41508166103142, 250.26218420526487,
+     2.3512525838331881, -13.83906136915741},
+    {-53.210725560802118, 537.41356858767904, 238.35055864537401,
+     2.2396852902618174, -13.439098263739877},
+    {-53.202544329959437, 539.31601393621042, 226.78017385388665,
+     2.1312906808310492, -13.06304559248794},
+    {-53.194363099116757, 541.12512655202727, 215.53109662758072,
+     2.0258828574183965, -12.708582820021826},
+    {-53.186181868274076, 542.84346013734705, 204.58528929016515,
+     1.9232936272513452, -12.373693069537959},
+    {-53.178000637431396, 544.47342773367438, 193.92636622437067,
+     1.8233702273479993, -12.056613869069839},
+    {-53.169819406588715, 546.01731437671867, 183.53938920617287,
+     1.7259734117455829, -11.755797323121813},
+    {-53.161638175746035, 547.47728821014073, 173.41069423934803,
+     1.6309758332321604, -11.469877649607538},
+    {-53.153456944903354, 548.85541029148237, 163.52774415900473,
+     1.5382606659855702, -11.197644524681056},
+    {-53.145275714060666, 550.15364328179396, 153.87900246604491,
+     1.4477204266844463, -10.938021046080991},
+    {-53.137094483217979, 551.37385917730717, 144.4538247696951,
+     1.3592559602154877, -10.690045398074833},
+    {-53.128913252375298, 552.51784621487786, 135.24236492417813,
+     1.2727755627311998, -10.452855504918871},
+    {-53.120732021532618, 553.58731506139145, 126.23549349880879,
+     1.1881942199858893, -10.225676113693698},
+    {-53.112550790689937, 554.58390437992921, 117.4247266564962,
+     1.1054329429521534, -10.007807864714568},
+    {-53.104369559847257, 555.50918585116312, 108.80216386096109,
+     1.0244181859493111, -9.798617997899262},
+    {-53.096188329004576, 556.36466871669631, 100.36043310871385,
+     0.94508133509360104, -9.5975324133514164},
+    {-53.088007098161896, 557.15180390135799, 92.092642603558332,
+     0.86735825695316904, -9.4040288589609364},
+    {-53.079825867319215, 557.87198776339721, 83.992337970741673,
+     0.79118889896787525, -9.2176310606997962},
+    {-53.071644636476535, 558.52656551460643, 76.053464253619424,
+     0.71651693455668142, -9.0379036452216681},
+    {-53.063463405633854, 559.11683434694396, 68.270332055158434,
+     0.64328944695221346, -8.864447731396103},
+    {-53.055282174791174, 559.6440462972073, 60.63758728461503,
+     0.57145664671845375, -8.696897089054028},
+    {-53.047100943948486, 560.10941087736023, 53.150184050968321,
+     0.50097161866704798, -8.5349147806643995},
+    {-53.038919713105798, 560.51409749462459, 45.803360311995071,
+     0.43179009451692474, -8.3781902157878232},
+    {-53.030738482263118, 560.85923768245254, 38.592615943999952,
+     0.36387024816661567, -8.2264365596549993},
+    {-53.022557251420437, 561.14592716099776, 31.513692944384537,
+     0.29717251088960167, -8.0793884466286414},
+    {-53.014376020577757, 561.37522774347804, 24.562557518882816,
+     0.23165940413359531, -7.9367999570451611},
+    {-53.006194789735076, 561.5481691029629, 17.73538383853116,
+     0.16729538791535464, -7.7984428223133797},
+    {-52.998013558892396, 561.66575041245676, 11.028539280042464,
+     0.10404672306998207, -7.664104828448032},
+    {-52.989832328049715, 561.72894186973497, 4.4385709871919747,
+     0.041881345837382983, -7.5335883926200147},
+    {-52.985741712628375, 561.7404370190909, 1.1863825387837033,
+     0.011195299909342841, -7.469705199176822},
+    {-52.981651097207035, 561.73868611714681, -2.0378063885087672,
+     -0.019231246538258522, -7.4067092909911691},
+    {-52.973469866364354, 561.69589956553864, -8.4037218919556125,
+     -0.079320100355476042, -7.2832955191908644},
+    {-52.965288635521674, 561.60147363042006, -14.662158522359546,
+     -0.13841290116680521, -7.1631862693937487},
+    {-52.957107404678993, 561.45627588777563, -20.815962640854469,
+     -0.19653606155059072, -7.0462310101544441},
+    {-52.948926173836306, 561.26115115607786, -26.867852612400473,
+     -0.25371480173356853, -6.9322886570187316},
+    {-52.940744942993618, 561.01692251049826, -32.820426756823039,
+     -0.30997322376332204, -6.8212268235138263},
+    {-52.932563712150937, 560.72439223462379, -38.676170675349823,
+     -0.36533437985048428, -6.7129211434701981},
+    {-52.916201250465576, 559.9975372802553, -50.106586699577612,
+     -0.47345222744174931, -6.5041172517092871},
+    {-52.899838788780215, 559.08662141027469, -61.176975583167788,
+     -0.57823404554630808, -6.3050204831655465},
+    {-52.883476327094854, 557.9973991096233, -71.903791991552055,
+     -0.67983231233526287, -6.114868729614571},
+    {-52.867113865409493, 556.73536617923753, -82.302224265958245,
+     -0.77838771826551223, -5.9329813032996048},
+    {-52.850751403724125, 555.30577934149017, -92.386327510268885,
+     -0.87403040691450684, -5.7587480809332492},
+    {-52.834388942038757, 553.71367381506241, -102.16913920017572,
+     -0.96688105271983915, -5.5916203660999795},
+    {-52.818026480353396, 551.96387912223588, -111.66278004171559,
+     -1.0570518010858523, -5.4311031575681614},
+    {-52.801664018668035, 550.06103335100818, -120.87854231711793,
+     -1.1446470917505678, -5.2767485748076863},
+    {-52.785301556982674, 548.00959606117715, -129.82696756526383,
+     -1.2297643826578626, -5.1281502414320945},
+    {-52.768939095297313, 545.81385999604481, -138.5179151300959,
+     -1.3124947886477445, -4.9849384658607923},
+    {-52.752576633611945, 543.47796173829045, -146.96062285639334,
+     -1.3929236469063351, -4.8467760888235798},
+    {-52.736214171926576, 541.00589142954948, -155.16376100558642,
+     -1.4711310191866767, -4.7133548913310852},
+    {-52.719851710241215, 538.4015016569864, -163.13548029537847,
+     -1.547192139234415, -4.584392475844723},
+    {-52.687126786870493, 532.81053449146293, -178.41492055558626,
+     -1.6931547745743354, -4.3388275441178763},
+    {-52.654401863499764, 526.73342320655445, -192.85528258080382,
+     -1.8313310545313766, -4.1082434260532041},
+    {-52.621676940129035, 520.19678758046211, -206.50692162753265,
+     -1.9621849172774222, -3.8910729535128823},
+    {-52.588952016758313, 513.22568544945125, -219.41507100586028,
+     -2.0861327578456037, -3.6859704356935703},
+    {-52.556227093387584, 505.84376836459501, -231.62055029977961,
+     -2.2035500178524154, -3.4917729532858495},
+    {-52.523502170016855, 498.07341613361831, -243.16035224459756,
+     -2.3147766447246365, -3.307469612609351},
+    {-52.490777246646132, 489.9358538001365, -254.06813275776867,
+     -2.4201216488369126, -3.1321768946182291},
+    {-52.458052323275403, 481.4512539078504, -264.37462297955625,
+     -2.5198669343491278, -2.9651187204135359},
+    {-52.425327399904674, 472.63882635222296, -274.10797798743988,
+     -2.6142705404252591, -2.805610202510354},
+    {-52.392602476533952, 463.51689769606918, -283.29407369612528,
+     -2.7035694001172157, -2.6530443025892132},
+    {-52.359877553163223, 454.10298148990353, -291.95676105979965,
+     -2.7879817018609665, -2.5068808005948666},
+    {-52.327152629792494, 444.41384087081303, -300.1180848555008,
+     -2.8677089213968467, -2.3666371163711211},
+    {-52.294427706421772, 434.46554449967476, -307.798472903456,
+     -2.942937578659631, -2.2318806270008174},
+    {-52.261702783051042, 424.27351672391916, -315.01690046888473,
+     -3.0138407638245539, -2.102222200050365},
+    {-52.228977859680313, 413.85258271255157, -321.79103371495,
+     -3.080579468542175, -1.9773107216280716},
+    {-52.196252936309584, 403.2170091953169, -328.13735538286835,
+     -3.1433037519308615, -1.8568284432920494},
+    {-52.163528012938855, 392.38054134343486, -334.07127532102987,
+     -3.2021537657323087, -1.7404870068093059},
+    {-52.098078166197404, 370.15749341068636, -344.75875910712028,
+     -3.3087473784283352, -1.5192001828347683},
+    {-52.032628319455952, 347.28416894100371, -353.95874606764909,
+     -3.4013152660145116, -1.3116127751088706},
+    {-51.967178472714494, 323.85481134299386, -361.76453855697656,
+     -3.4807021392062105, -1.11618222367516},
+    {-51.901728625973043, 299.95789670300474, -368.25934909457891,
+     -3.54765976821716, -0.93160257074957087},
+    {-51.836278779231591, 275.67674310135942, -373.5178081046455,
+     -3.6028609392993007, -0.75675965416149893},
+    {-51.770828932490133, 251.09003076575709, -377.60719246059676,
+     -3.6469108206959722, -0.59069625847231766},
+    {-51.705379085748682, 226.2722492496143, -380.58843561935629,
+     -3.68035630285376, -0.43258470947711891},
+    {-51.63992923900723, 201.29408436447704, -382.51696507456728,
+     -3.7036937376903456, -0.28170510301697632},
+    {-51.574479392265772, 176.22275497840661, -383.44340194912701,
+     -3.7173754002704396, -0.13742784813474299},
+    {-51.509029545524314, 151.12230778854266, -383.41414953639219,
+     -3.7218149217655716, 0.00080045095357853229},
+    {-51.443579698782862, 126.05387662573662, -382.47189164331803,
+     -3.7173918872170475, 0.13346850360844814},
+    {-51.378129852041411, 101.07591163765942, -380.65601710977489,
+     -3.7044557500047879, 0.26100978380177459},
+    {-51.312680005299953, 76.24438274161632, -378.00298347439127,
+     -3.6833291833066246, 0.38381034469000147},
+    {-51.247230158558502, 51.612960978364832, -374.54663014492996,
+     -3.6543109645739471, 0.50221532149585901},
+    {-51.214505235187772, 39.388474157322584, -372.52713496028827,
+     -3.6369299405467785, 0.55986749020234017},
+    {-51.18178031181705, 27.233180789467465, -370.31844940806553,
+     -3.6176784702677192, 0.61653437529173083},
+    {-51.149055388446321, 15.153212739630582, -367.92418192528476,
+     -3.5965882373694082, 0.67224989300378168},
+    {-51.116330465075592, 3.1545857489160531, -365.3478220331707,
+     -3.5736898434326063, 0.72704627575779535},
+    {-51.08360554170487, -8.7567967697560274, -362.59274614007796,
+     -3.5490128613186447, 0.78095417892640462},
+    {-51.050880618334141, -20.575140120013952, -359.66222298058454,
+     -3.5225858851435499, 0.83400277943357704},
+    {-51.018155694963411, -32.294754882773546, -356.55941871836393,
+     -3.4944365771493775, 0.88621986690672017},
+    {-50.985430771592689, -43.910053638843443, -353.28740173796717,
+     -3.4645917117052845, 0.93763192803916684},
+    {-50.919980924851231, -66.805844844392453, -346.24754102008183,
+     -3.3999182121756992, 1.0381408666928773},
+    {-50.854531078109773, -89.2197391241736, -338.56539693351721,
+     -3.3287633349081451, 1.1357182625321838},
+    {-50.789081231368321, -111.11040799083183, -330.26242319506986,
+     -3.25131322705532, 1.2305363890563488},
+    {-50.72363138462687, -132.43788752501209, -321.35888157516501,
+     -3.1677432471106681, 1.3227529294887801},
+    {-50.658181537885412, -153.16350364667764, -311.87394039620756,
+     -3.0782188674002087, 1.4125125428839385},
+    {-50.59273169114396, -173.24980348513481, -301.82576263473629,
+     -2.9828964808355032, 1.4999482290343136},
+    {-50.527281844402509, -192.6604922115994, -291.23158494401065,
+     -2.8819241240885565, 1.5851825220531048},
+    {-50.461831997661051, -211.36037477775076, -280.10778872066265,
+     -2.7754421275633225, 1.6683285375023384},
+    {-50.396382150919599, -229.31530207185531, -268.46996417803012,
+     -2.6635837010487791, 1.7494908938603151},
+    {-50.330932304178148, -246.49212106256792, -256.33296825381188,
+     -2.5464754626900956, 1.828766525787366},
+    {-50.26548245743669, -262.85862855072315, -243.71097706616314,
+     -2.4242379178647129, 1.9062454039073509},
+    {-50.200032610695231, -278.38352819307175, -230.61753353637977,
+     -2.296985893663007, 1.9820111735591353},
+    {-50.13458276395378, -293.03639049957633, -217.06559071496991,
+     -2.164828933921414, 2.0561417230953491},
+    {-50.069132917212329, -306.78761553873079, -203.06755127869226,
+     -2.0278716591163843, 2.1287096907433214},
+    {-50.003683070470871, -319.6083981138928, -188.6353036070312,
+     -1.8862140948816202, 2.199782917736993},
+    {-49.872783376987968, -342.34719544224816, -158.51336092288338,
+     -1.589177003864835, 2.3376949244041283},
+    {-49.741883683505058, -361.03704853974483, -126.78577174323266,
+     -1.2744367759566388, 2.4703389647466563},
+    {-49.676433836763607, -368.79918828203688, -110.34497272061652,
+     -1.1106370183818879, 2.5348144459355155},
+    {-49.610983990022149, -375.47305594961387, -93.532166494384555,
+     -0.94265582913247514, 2.5981215915675882},
+    {-49.54553414328069, -381.03460251398849, -76.356429503969224,
+     -0.77056823409304787, 2.6603040221035865},
+    {-49.480084296539239, -385.46036263512633, -58.826524495811391,
+     -0.59444648621916218, 2.7214028831996537},
+    {-49.414634449797788, -388.72743470112852, -40.950917750786665,
+     -0.41436022148853763, 2.781457026966669},
+    {-49.349184603056329, -390.81346195422782, -22.737795071131394,
+     -0.23037660352470324, 2.8405031771559797},
+    {-49.283734756314878, -391.6966146255441, -4.1950766354510147,
+     -0.042560457889339307, 2.8985760799333744},
+    {-49.218284909573427, -391.35557300771927, 14.669569180703236,
+     0.14902560306251006, 2.9557086417078566},
+    {-49.152835062831969, -389.76951140068837, 33.848712930975864,
+     0.34432106396006579, 3.011932055311858},
+    {-49.087385216090517, -386.91808287122467, 53.335152092093224,
+     0.54326739810343694, 3.0672759156819795},
+    {-48.956485522607608, -377.34004496917447, 93.202174643372516,
+     0.95188792300391634, 3.1754359956238556},
+    {-48.825585829124698, -362.4677262617576, 134.21714698293746,
+     1.3744550598190293, 3.2803975108368197},
+    {-48.694686135641788, -342.15419706507998, 176.32956382599048,
+     1.8105626898879126, 3.3823494973525556},
+    {-48.563786442158886, -316.25895826622462, 219.49163672081255,
+     2.2598282877122289, 3.4814637592459698},
+    {-48.432886748675976, -284.647601470425, 263.65805780144581,
+     2.7218908008684148, 3.5778968881606126},
+    {-48.301987055193067, -247.1914982603939, 308.78579055468953,
+     3.1964087750867303, 3.6717919982111549},
+    {-48.171087361710157, -203.76751528340341, 354.83388386530021,
+     3.6830586903810238, 3.763280222657865},
+    {-48.040187668227247, -154.25775233018044, 401.76330620251179,
+     4.1815334796061743, 3.8524820102217645},
+    {-47.909287974744345, -98.549300947181237, 449.53679730175668,
+     4.6915412053163115, 3.9395082521173683},
+    {-47.843838128002886, -68.336592912233868, 473.72887610736785,
+     4.9507825317017726, 3.9822378281605824},
+    {-47.778388281261435, -36.534021442850758, 498.11873509945258,
+     5.2128038744958411, 4.0244612654379646},
+    {-47.712938434519984, -3.1287803275117714, 522.70215785188566,
+     5.4775724887414841, 4.0661901550871828},
+    {-47.647488587778525, 31.891663580539632, 547.4750160129131,
+     5.7450563737932159, 4.1074356541420443},
+    {-47.582038741037074, 68.539576024689012, 572.43326618161484,
+     6.0152242456135072, 4.1482085069573476},
+    {-47.516588894295623, 106.8269608069097, 597.57294693532458,
+     6.2880455104287103, 4.1885190653362665},
+    {-47.385689200812713, 188.36688433798156, 648.38114754775654,
+     6.841529146067967, 4.2677928556560616},
+    {-47.254789507329804, 276.60242164612959, 699.8694617446705,
+     7.4052754127294556, 4.3453326801763694},
+    {-47.189339660588345, 323.25841634990633, 725.85955243881847,
+     7.690927205801132, 4.3834745681212697},
+    {-47.156614737217623, 347.22561815954191, 738.91452827040291,
+     7.8346858907073553, 4.4023922102464601},
+    {-47.140252275532262, 359.36958933365725, 745.45680807040026,
+     7.9067969737756698, 4.4118131540966603},
+    {-47.123889813846894, 371.62068847193819, 752.00887713157385,
+     7.9790620012718412, 4.4208501972292682},
+    {-47.123889793846892, 371.62070351115722, 751.86516200892061,
+     7.977537139846782, -76243.026318834411},
+    {-47.123887796476083, 371.6222028284455, 749.97339218341597,
+     7.9574651758624517, -5377.1814364026459},
+    {-47.123885799105267, 371.62369991764564, 749.13432112183068,
+     7.9485626919167851, -3805.6945070834586},
+    {-47.123883801734458, 371.62519555173469, 748.49018472646594,
+     7.9417285285271495, -3107.820650163048},
+    {-47.123881804363648, 371.6266900088462, 747.94711586653852,
+     7.935966724596943, -2691.4207116393909},
+    {-47.123879806992832, 371.62818344990188, 747.46867995308514,
+     7.9308906971849797, -2407.1145087865698},
+    {-47.123877809622023, 371.6296759835206, 747.0361732195895,
+     7.9263019932015801, -2197.1831036195995},
+    {-47.123875812251214, 371.63116768948805, 746.6384784748285,
+     7.9220826556112582, -2033.9896453271476},
+    {-47.123873814880398, 371.63265862963408, 746.26834951481067,
+     7.9181557998226371, -1902.4226661357914},
+    {-47.123869820138779, 371.63563840284741, 745.59201876310794,
+     7.9109803758569184, -1701.2183697778423},
+    {-47.123865825397154, 371.63861561069035, 744.98069132632872,
+     7.9044946576181081, -1552.6724090066657},
+    {-47.123861830655528, 371.64159047896584, 744.41862668664362,
+     7.8985316331011761, -1437.2102096383669},
+    {-47.12385783591391, 371.64456318264206, 743.89556708656175,
+     7.8929824641779014, -1344.1315444278466},
+    {-47.123849846430666, 371.65050263501632, 742.93989595991206,
+     7.8828438081888281, -1201.7986151822979},
+    {-47.123841856947422, 371.65643483800994, 742.07618865415191,
+     7.8736809162000476, -1096.7246213312399},
+    {-47.123833867464178, 371.66236043050827, 741.28217165195861,
+     7.8652574590685393, -1015.056784981559},
+    {-47.123825877980934, 371.66827990755763, 740.54333114876943,
+     7.8574194407122135, -949.22366030878754},
+    {-47.123809899014447, 371.68010203966804, 739.19359258738996,
+     7.8431009098316729, -848.55780610233217},
+    {-47.123793920047952, 371.69190369617701, 737.97393575878993,
+     7.8301625821009342, -774.24644671146655},
+    {-47.123777941081457, 371.7036866844403, 736.8528518827228,
+     7.8182701395886065, -716.4901315559415},
+    {-47.123761962114969, 371.71545240484556, 735.80981026628842,
+     7.8072057453503065, -669.93318461718445},
+    {-47.123745983148481, 371.72720198409263, 734.83054975088328,
+     7.7968180841741628, -631.36879841682321},
+    {-47.123730004181994, 371.73893635427419, 733.90468660380463,
+     7.7869969815491507, -598.7440822598943},
+    {-47.123698046249011, 371.76236250834285, 732.18354503973944,
+     7.7687403089751825, -546.19341589749467},
+    {-47.123666088316028, 371.78573597952368, 730.60181879560264,
+     7.7519628611487645, -505.35049105935434},
+    {-47.123634130383053, 371.80906072904219, 729.13046943900929,
+     7.7363565320708263, -472.42761581627411},
+    {-47.123602172450077, 371.83233994391588, 727.74932644514638,
+     7.7217073069024771, -445.15689602113724},
+    {-47.123570214517095, 371.85557626068345, 726.44370357771004,
+     7.7078593607272836, -422.08652809117791},
+    {-47.123506298651137, 371.90192880135635, 724.01714348862708,
+     7.6821230035396511, -384.92587179989744},
+    {-47.123442382785178, 371.94813281215539, 721.78775732229394,
+     7.6584786766975732, -356.04439591332738},
+    {-47.12337846691922, 371.99419949774318, 719.71447578566438,
+     7.6364906252520335, -332.76356411067195},
+    {-47.123314551053262, 372.04013787281076, 717.76877175893082,
+     7.6158561701055874, -313.47961235357991},
+    {-47.123250635187304, 372.08595539497452, 715.92987465185911,
+     7.5963549309697722, -297.16589241607772},
+    {-47.123186719321346, 372.13165836766001, 714.18210424067934,
+     7.5778205376319754, -283.13066786606566},
+    {-47.123122803455388, 372.17725221045612, 712.51327848199981,
+     7.5601237364276868, -270.8885820752418},
+    {-47.122994971723472, 372.26813084841569, 709.37554269941575,
+     7.5268512021050675, -250.4657421052741},
+    {-47.122867139991556, 372.35862300209402, 706.45858413723374,
+     7.495921057164268, -234.00327685222658},
+    {-47.122739308259639, 372.44875417029021, 703.72205777995566,
+     7.46690523630709, -220.36710993113343},
+    {-47.122611476527723, 372.53854544760281, 701.13658847281283,
+     7.4394920665852364, -208.83126641935431},
+    {-47.122483644795807, 372.62801466392079, 698.68000021544924,
+     7.4134462593485484, -198.9065995838418},
+    {-47.122355813063891, 372.71717714920982, 696.33506436810308,
+     7.3885850182288184, -190.24990069031935},
+    {-47.122227981331974, 372.80604626859338, 694.08807982842279,
+     7.3647629745286443, -182.61230192411946},
+    {-47.122100149600058, 372.89463380956857, 691.92793774211646,
+     7.3418622636239732, -175.80835590273242},
+    {-47.121844486136226, 373.07100507780694, 687.83306354651234,
+     7.2984522470133841, -164.1672717122492},
+    {-47.121588822672393, 373.24636308184148, 683.99338312260943,
+     7.2577495815835942, -154.52471766807545},
+    {-47.121333159208561, 373.42076749213993, 680.36735205714206,
+     7.2193134875703642, -146.36734182550748},
+    {-47.121077495744728, 373.59426874481386, 676.92360742021458,
+     7.1828112109845552, -139.34925884089347},
+    {-47.120821832280889, 373.76691020479672, 673.63778314418767,
+     7.1479842344632143, -133.22777926509988},
+    {-47.120566168817049, 373.93872967936704, 670.49050202640979,
+     7.1146269722680024, -127.82692404805347},
+    {-47.120310505353217, 374.10976051336132, 667.4660529876312,
+     7.0825727359309534, -123.01555997869276},
+    {-47.120054841889385, 374.28003240400045, 664.55148774984571,
+     7.0516841499838865, -118.69370071878662},
+    {-47.119799178425552, 374.44957202139011, 661.73598500765263,
+     7.0218464058165759, -114.78359802859211},
+    {-47.119287851497887, 374.78654877229803, 656.36688148107362,
+     6.9649490835864594, -107.96483426625575},
+    {-47.118776524570215, 375.12085957239623, 651.29998603431386,
+     6.9112574017567248, -102.1962686003435},
+    {-47.118265197642543, 375.45264710758596, 646.49094171685135,
+     6.8603007666461915, -97.233319501848527},
+    {-47.117753870714878, 375.78203406198253, 641.90528710249134,
+     6.8117135725930158, -92.904377030777468},
+    {-47.117242543787214, 376.10912739908571, 637.51561644239473,
+     6.7652050716883076, -89.085003303519088},
+    {-47.116731216859542, 376.43402145961761, 633.29970895018278,
+     6.7205395259208087, -85.682471687700016},
+    {-47.11621988993187, 376.75680026632614, 629.23925125677056,
+     6.6775226527800342, -82.626080032102877},
+    {-47.115708563004205, 377.07753927912523, 625.31893817180787,
+     6.6359920846315728, -79.860851122373575},
+    {-47.11519723607654, 377.39630675860531, 621.52582322470278,
+     6.595810478203779, -77.34330406272764},
+    {-47.114685909148868, 377.7131648434729, 617.8488390839675,
+     6.5568604264428707, -75.038537280620019},
+    {-47.113663255293531, 378.3413757990532, 610.8063078762533,
+     6.4822629538112295, -70.958845778912917},
+    {-47.112640601438201, 378.96257590343271, 604.12860614624572,
+     6.4115341279321498, -67.448828080727125},
+    {-47.111617947582864, 379.57711233289024, 597.7669910499576,
+     6.3441568883819981, -64.387135176902603},
+    {-47.110595293727528, 380.18528779230189, 591.68269889460259,
+     6.2797200418032224, -61.685774296237426},
+    {-47.109572639872198, 380.78736927812218, 585.84429936273091,
+     6.217890192309758, -59.27917630098981},
+    {-47.108549986016861, 381.38359459796197, 580.22588865461455,
+     6.1583925723339163, -57.117345999888073},
+    {-47.107527332161524, 381.97417733549054, 574.80581766986245,
+     6.1009975498907973, -55.161407626021507},
+    {-47.106504678306187, 382.55931070735988, 569.56577345470191,
+     6.0455108837336669, -53.380614702251883},
+    {-47.105482024450851, 383.139170611206, 564.49010090925071,
+     5.9917665274738416, -51.7502873779666},
+    {-47.104459370595521, 383.71391807064384, 559.56529213758449,
+     5.9396212122422476, -50.250355363341384},
+    {-47.103436716740184, 384.28370122257883, 554.77959541907853,
+     5.8889502984175497, -48.864306957215163},
+    {-47.101391409029517, 385.40891224678762, 545.58555278682354,
+     5.7916075986900966, -46.381169313141491},
+    {-47.099346101318844, 386.51578668150449, 536.83902052672352,
+     5.6990071515206377, -44.215064688084794},
+    {-47.09730079360817, 387.6051817027045, 528.48516132832026,
+     5.610567404321861, -42.303770389942962},
+    {-47.095255485897503, 388.67785345471424, 520.47951086411035,
+     5.5258168311664217, -40.600920097052757},
+    {-47.093210178186837, 389.73447549407922, 512.78542213580886,
+     5.4443668226861135, -39.071160279641965},
+    {-47.091164870476163, 390.77565283557647, 505.37226656875117,
+     5.365892603833152, -37.687000294668316},
+    {-47.089119562765489, 391.8019328637663, 498.21413476360414,
+     5.2901194521117585, -36.426697982649877},
+    {-47.087074255054823, 392.81381395619979, 491.28887707255825,
+     5.2168125206868012, -35.272801101426658},
+    {-47.085028947344156, 393.81175240081467, 484.5773812926094,
+     5.1457691768069109, -34.211116992897935},
+    {-47.082983639633483, 394.79616801843099, 478.06301955534838,
+     5.0768131350210863, -33.229969409075906},
+    {-47.080938331922809, 395.76744878633667, 471.73121835410814,
+     5.0097898965859713, -32.319652466113865},
+    {-47.078893024212142, 396.72595468027419, 465.56911977253327,
+     4.9445631562863674, -31.472022768637416},
+    {-47.074802408790802, 398.60596057975999, 453.70960817889062,
+     4.8190282801289506, -29.938280353645052},
+    {-47.070711793369462, 400.43861626337895, 442.4068841967723,
+     4.699385959350324, -28.584740770862634},
+    {-47.066621177948122, 402.22606632897885, 431.59802255704545,
+     4.5849692601182497, -27.378615403490191},
+    {-47.062530562526781, 403.97022161390447, 421.23115801800793,
+     4.4752285202594946, -26.294903327652534},
+    {-47.058439947105441, 405.6727989405054, 411.26294053635024,
+     4.3697043612008537, -25.314163883499536},
+    {-47.054349331684101, 407.33535199317629, 401.65669723714387,
+     4.2680081962868401, -24.421021487440331},
+    {-47.050258716262761, 408.95929572070503, 392.38107509762375,
+     4.1698078374433951, -23.60313421191336},
+    {-47.04616810084142, 410.54592591205665, 383.40901906146746,
+     4.0748166592404171, -22.850465186060376},
+    {-47.04207748542008, 412.09643510824714, 374.71698950590616,
+     3.9827853013298951, -22.154757058967327},
+    {-47.03798686999874, 413.61192568769172, 366.28435390778213,
+     3.8934952182381943, -21.509145860917489},
+    {-47.0338962545774, 415.09342073983606, 358.09290753203862,
+     3.8067535973823192, -20.90787257133405},
+    {-47.029805639156052, 416.54187318579267, 350.12649119264915,
+     3.7223893064650584, -20.346064457760729},
+    {-47.025715023734712, 417.95817349352927, 342.37068308595877,
+     3.6402496263284698, -19.819567078598702},
+    {-47.021624408313372, 419.34315625447744, 334.81254787181308,
+     3.5601975908409766, -19.324813636283771},
+    {-47.017533792892024, 420.69760582892826, 327.44043051669013,
+     3.4821098014097842, -18.858722247703088},
+    {-47.013443177470684, 422.02226122323333, 320.24378550882443,
+     3.4058746165425351, -18.418614344946519},
+    {-47.009352562049344, 423.31782032827942, 313.21303429813827,
+     3.3313906406679079, -18.002149254738523},
+    {-47.001171331206663, 425.82425742606199, 299.61503331123197,
+     3.1873145373326159, -17.232166668184131},
+    {-46.992990100363983, 428.22180792435967, 286.58501967490395,
+     3.0492315881883436, -16.535025266237653},
+    {-46.984808869521302, 430.51490040839627, 274.07103764094126,
+     2.9165920244780343, -15.89985066927653},
+    {-46.976627638678622, 432.70757033607856, 262.02866268573672,
+     2.7889258537366048, -15.317913934356147},
+    {-46.968446407835941, 434.80351546607113, 250.4195552437636,
+     2.6658275331200336, -14.782116296524674},
+    {-46.960265176993261, 436.80614091441748, 239.21035314360279,
+     2.5469442329809984, -14.286617511413793},
+    {-46.95208394615058, 438.71859621009315, 228.371810557407,
+     2.4319667133340341, -13.826562777535866},
+    {-46.9439027153079, 440.54380608923714, 217.87811954023655,
+     2.3206221355472096, -13.397878755371444},
+    {-46.935721484465219, 442.28449632665922, 207.70636894920767,
+     2.2126683300048375, -12.997118927841543},
+    {-46.927540253622531, 443.94321558826044, 197.83610819576612,
+     2.1078891747420569, -12.621344789890058},
+    {-46.919359022779844, 445.52235405974335, 188.24899202295603,
+     2.0060908326940181, -12.268033452248869},
+    {-46.911177791937163, 447.02415943869289, 178.92848863788186,
+     1.9070986602753246, -11.935004988342312},
+    {-46.902996561094483, 448.45075075148912, 169.85963791088372,
+     1.8107546464502484, -11.62036472470491},
+    {-46.894815330251802, 449.8041303614113, 161.02884952688291,
+     1.7169152750986882, -11.322456973152004},
+    {-46.886634099409122, 451.08619446164346, 152.42373330396194,
+     1.6254497281761886, -11.039827616863496},
+    {-46.878452868566441, 452.29874229049688, 144.03295562623086,
+     1.536238365524321, -10.771193615225426},
+    {-46.870271637723761, 453.44348426237661, 135.84611723981584,
+     1.4491714309852586, -10.515417964450197},
+    {-46.86209040688108, 454.52204917321677, 127.85364864985415,
+     1.3641479449568101, -10.271488996706207},
+    {-46.8539091760384, 455.53599061168933, 120.04672011527819,
+     1.2810747515670624, -10.038503156441504},
+    {-46.845727945195719, 456.48679268538075, 112.41716382568477,
+     1.1998656948740376, -9.8156505840497541},
+    {-46.837546714353039, 457.37587515328045, 104.95740630323006,
+     1.120440903356138, -9.6022029816380066},
+    {-46.829365483510351, 458.20459804153415, 97.66040943373514,
+     1.0427261657871867, -9.3975033458817414},
+    {-46.821184252667663, 458.97426580750528, 90.519618817323533,
+     0.9666523846218833, -9.2009572376664526},
+    {-46.813003021824983, 459.6861311074623, 83.528918357644699,
+     0.89215509544113369, -9.0120253238547523},
+    {-46.804821790982302, 460.34139821517408, 76.68259019250219,
+     0.81917404295380003, -8.8302169777556543},
+    {-46.796640560139622, 460.94122613192059, 69.975279217266191,
+     0.74765280562542813, -8.6550847651461673},
+    {-46.788459329296941, 461.48673142288811, 63.401961573501801,
+     0.67753846228702586, -8.4862196745730021},
+    {-46.780278098454261, 461.97899081014253, 56.957916574031685,
+     0.60878129512352896, -8.323246976042368},
+    {-46.77209686761158, 462.41904354842984, 50.638701617103493,
+     0.5413345243044837, -8.1658226125413069},
+    {-46.7639156367689, 462.80789360664835, 44.440129709590998,
+     0.4751540702319762, -8.0136300452208342},
+    {-46.755734405926219, 463.14651167499363, 38.358249274903663,
+     0.41019833997134064, -7.8663774863363942},
+    {-46.747553175083539, 463.43583701526882, 32.389325967996442,
+     0.34642803492504459, -7.7237954648520519},
+    {-46.739371944240858, 463.67677916984155, 26.529826258771568,
+     0.28380597722217066, -7.5856346784500532},
+    {-46.731190713398171, 463.87021954277327, 20.776402578097645,
+     0.22229695264474506, -7.4516640929568911},
+    {-46.723009482555483, 464.01701286524133, 15.125879848358711,
+     0.16186756820540546, -7.3216692561950358},
+    {-46.714828251712802, 464.1179885558559, 9.5752432439316895,
+     0.10248612273963152, -7.1954507982425371},
+    {-46.706647020870122, 464.1739519854433, 4.1216270469799117,
+     0.04412248908745503, -7.0728230942241428},
+    {-46.702556405448782, 464.18529949664531, 1.4303443159279627,
+     0.015313340703562479, -7.0128012288491099},
+    {-46.698465790027441, 464.18568565470559, -1.237695518848364,
+     -0.013251993378256515, -6.9536130692207925},
+    {-46.690284559184761, 464.15395029235856, -6.5053215798664539,
+     -0.069664616967800727, -6.8376591277811833},
+    {-46.68210332834208, 464.07948588053426, -11.683727119122922,
+     -0.12514139558948909, -6.7248101929703701},
+    {-46.6739220974994, 463.96301261350493, -16.775274778176314,
+     -0.17970714720667397, -6.6149248419472899},
+    {-46.665740866656719, 463.80523179523345, -21.782221023891839,
+     -0.23338556957804049, -6.5078705268194916},
+    {-46.657559635814039, 463.60682668065556, -26.706722742415277,
+     -0.28619930993899828, -6.4035228710054666},
+    {-46.649378404971358, 463.36846326520219, -31.550843315274292,
+     -0.33817002920570494, -6.3017650326070216},
+    {-46.63301594328599, 462.77444362214464, -41.005760244444723,
+     -0.4396644674913906, -6.1055857048002782},
+    {-46.616653481600622, 462.02818274899283, -50.161811512616872,
+     -0.53802458741933834, -5.91852785770193},
+    {-46.600291019915261, 461.13445754107875, -59.03265860835662,
+     -0.6333936689700953, -5.7398754814954724},
+    {-46.5839285582299, 460.09783011457233, -67.630912455834306,
+     -0.72590391739176396, -5.5689890579070749},
+    {-46.567566096544532, 458.92266407174208, -75.968243796515651,
+     -0.81567762892113815, -5.4052953616828079},
+    {-46.551203634859164, 457.61313908205881, -84.055479077021246,
+     -0.90282820328707436, -5.2482788763654513},
+    {-46.534841173173803, 456.17326399722134, -91.902684104447289,
+     -0.98746102691575255, -5.0974745308138809},
+    {-46.518478711488441, 454.60688868454037, -99.519237324874268,
+     -1.0696742464655931, -4.9524615228302729},
+    {-46.50211624980308, 452.91771473558458, -106.91389425684844,
+     -1.1495594488917606, -4.8128580426882746},
+    {-46.485753788117719, 451.10930518405996, -114.09484435139184,
+     -1.2272022614867844, -4.6783167455933219},
+    {-46.469391326432351, 449.18509334793612, -121.06976133943694,
+     -1.3026828831150516, -4.5485208505968737},
+    {-46.453028864746983, 447.14839089486463, -127.84584795623707,
+     -1.37607655604626, -4.4231807660319244},
+    {-46.436666403061622, 445.0023952166203, -134.42987579221008,
+     -1.4474539863109874, -4.3020311594902401},
+    {-46.4039414796909, 440.39478236766553, -147.04689572688847,
+     -1.5844224761731163, -4.0713483496251657},
+    {-46.371216556320171, 435.38579186920157, -158.967635298652,
+     -1.7140766094154316, -3.8547455882713066},
+    {-46.338491632949442, 429.99751221032164, -170.23394246059527,
+     -1.8368524358650977, -3.6507503692235272},
+    {-46.30576670957872, 424.25073373107426, -180.88341389749203,
+     -1.9531413336913268, -3.4580982696473059},
+    {-46.27304178620799, 418.16507782324709, -190.94998261876879,
+     -2.0632962006366609, -3.2756965865005645},
+    {-46.240316862837261, 411.75910861225861, -200.46440489766835,
+     -2.1676365831608191, -3.1025954510416005},
+    {-46.207591939466539, 405.05043006682314, -209.45466687357768,
+     -2.2664529580763499, -2.9379646692610044},
+    {-46.17486701609581, 398.0557708985977, -217.94632645716231,
+     -2.3600103318239092, -2.7810749933372829},
+    {-46.142142092725081, 390.79105916186296, -225.96280270110432,
+     -2.4485512857966163, -2.6312828557724024},
+    {-46.109417169354359, 383.27148810996016, -233.52562218499531,
+     -2.5322985685037365, -2.4880178341166239},
+    {-46.076692245983629, 375.51157458678176, -240.65462997646145,
+     -2.6114573143804458, -2.3507722871742147},
+    {-46.0439673226129, 367.5252110101066, -247.36817120636385,
+     -2.6862169529522442, -2.2190927316523621},
+    {-46.011242399242178, 359.32571182613918, -253.68324811566461,
+     -2.756752859599406, -2.0925726240212814},
+    {-45.978517475871449, 350.92585517126781, -259.61565650972466,
+     -2.8232277894341142, -1.970846284719981},
+    {-45.94579255250072, 342.33792036073027, -265.18010483025199,
+     -2.8857931281437748, -1.8535837569972222},
+    {-45.913067629129998, 333.57372172845123, -270.39031847966146,
+     -2.9445899875802422, -1.7404864350726441},
+    {-45.880342705759269, 324.64463926397565, -275.25913157301636,
+     -2.9997501690246056, -1.6312833291512134},
+    {-45.814892859017817, 306.33533546990128, -284.0199127665486,
+     -3.0996461526226677, -1.423595099675014},
+    {-45.749443012276359, 287.49335881998462, -291.55015143613878,
+     -3.1863792457309752, -1.2287922124581701},
+    {-45.683993165534908, 268.19665362524069, -297.92761342460676,
+     -3.2607440022271348, -1.0454249322961375},
+    {-45.618543318793456, 248.51835641597498, -303.22167908830147,
+     -3.3234476270900934, -0.87226585472717988},
+    {-45.553093472051998, 228.52730236995799, -307.49459530808576,
+     -3.3751230912203765, -0.70826780539248202},
+    {-45.48764362531054, 208.28845769745126, -310.80249575210684,
+     -3.4163398121063371, -0.55253109527065469},
+    {-45.422193778569088, 187.86329142037147, -313.19623983287056,
+     -3.4476124310473253, -0.40427776952450034},
+    {-45.356743931827637, 167.3100971126085, -314.722108309291,
+     -3.4694080860646266, -0.26283115026068343},
+    {-45.291294085086179, 146.68427299631608, -315.42238443277142,
+     -3.4821524843185681, -0.12759943302606416},
+    {-45.225844238344727, 126.03856712616523, -315.33584288888233,
+     -3.4862350078754845, 0.0019375795257093318},
+    {-45.160394391603276, 105.42329310657384, -314.49816384365761,
+     -3.4820130346573395, 0.12623929224684372},
+    {-45.094944544861818, 84.886520781526755, -312.94228568653625,
+     -3.4698156173050814, 0.24571319862459975},
+    {-45.029494698120367, 64.474245543460299, -310.69870723703997,
+     -3.4499466329788646, 0.3607222242302584},
+    {-44.964044851378915, 44.230539277027326, -307.79574801418033,
+     -3.4226874943251588, 0.47159083764066456},
+    {-44.931319928008186, 34.18517954775124, -306.10531061749276,
+     -3.4063689994858164, 0.52556464685195226},
+    {-44.898595004637457, 24.197685448116388, -304.25977348839962,
+     -3.3882994941932307, 0.57861016616934047},
+    {-44.865870081266735, 14.27308287280758, -302.26215910868945,
+     -3.3685088304449913, 0.63075928310296037},
+    {-44.833145157896006, 4.4163004400807182, -300.11539092420253,
+     -3.3470258429030406, 0.68204230251945686},
+    {-44.816782696210637, -0.48514384751441564, -298.98696184541831,
+     -3.3356584727655871, 0.70736808803004181},
+    {-44.800420234525276, -5.3678273470810636, -297.82229816927418,
+     -3.3238783990217859, 0.73248804698520564},
+    {-44.767695311154554, -15.074557092691249, -295.38562038891058,
+     -3.299093446020112, 0.78212394942689001},
+    {-44.734970387783825, -24.699233642845375, -292.80801168161867,
+     -3.2726970549373422, 0.83097613879531418},
+    {-44.702245464413096, -34.237287355355555, -290.09204468378471,
+     -3.2447144619918857, 0.87906951934868416},
+    {-44.636795617671645, -53.035659752537839, -284.25494129937306,
+     -3.1840876721316094, 0.97307378299828584},
+    {-44.571345770930193, -71.43473134797631, -277.89339897074655,
+     -3.1173996899145791, 1.0643141423757119},
+    {-44.505895924188735, -89.400772508337212, -271.02542098257976,
+     -3.0448260320862204, 1.1529525896691855},
+    {-44.440446077447277, -106.9011989247323, -263.66801702750502,
+     -2.9665320704477778, 1.239137402110754},
+    {-44.374996230705825, -123.9045093139145, -255.83728513762668,
+     -2.8826738802131651, 1.3230046138730878},
+    {-44.309546383964374, -140.3802281926443, -247.54848497577979,
+     -2.7933989983856797, 1.404679298888041},
+    {-44.244096537222916, -156.29885319651311, -238.81610358022647,
+     -2.6988471035826049, 1.484276692660857},
+    {-44.178646690481465, -171.63180648061729, -229.65391449624337,
+     -2.5991506270576141, 1.5619031764502425},
+    {-44.113196843740013, -186.35138979612574, -220.07503109430547,
+     -2.4944353032706554, 1.637657143354508},
+    {-44.047746996998555, -200.43074288528271, -210.09195476252631,
+     -2.3848206671823888, 1.7116297627101746},
+    {-43.982297150257104, -213.84380487926137, -199.71661856667654,
+     -2.2704205044632269, 1.7839056566335558},
+    {-43.916847303515652, -226.56527841947741, -188.96042689140754,
+     -2.1513432599734998, 1.8545635004090095},
+    {-43.851397456774194, -238.570596254176, -177.83429150877626,
+     -2.0276924091652213, 1.9236765566637197},
+    {-43.785947610032743, -249.83589008955701, -166.34866446262268,
+     -1.8995667964544287, 1.9913131518008027},
+    {-43.720497763291291, -260.33796149835666, -154.51356810824055,
+     -1.7670609440999274, 2.057537101935385},
+    {-43.589598069808382, -278.96283112168584, -129.83307112138607,
+     -1.4892666699227128, 2.1859820312077907},
+    {-43.458698376325472, -294.27202300757608, -103.86537499082505,
+     -1.1949894827890966, 2.3094452334605506},
+    {-43.393248529584014, -300.63163912557189, -90.420030999550264,
+     -1.0418675031659017, 2.3694300001040092},
+    {-43.327798682842563, -306.10149873880783, -76.677720074466933,
+     -0.88485594012915614, 2.428309191510559},
+    {-43.262348836101111, -310.66241791275655, -62.646113206055453,
+     -0.72402579715897419, 2.486123848665196},
+    {-43.196898989359653, -314.29570610390078, -48.33261880685528,
+     -0.55944546874488221, 2.5429126852135804},
+    {-43.131449142618202, -316.98314944983269, -33.744397070409818,
+     -0.39118088704637288, 2.5987122578662194},
+    {-43.06599929587675, -318.70699496484474, -18.888373297752757,
+     -0.21929565790385802, 2.6535571216941976},
+    {-43.000549449135292, -319.44993557644455, -3.7712502817814313,
+     -0.043851187137066552, 2.7074799718781932},
+    {-42.935099602393841, -319.1950959438015, 11.600480169422681,
+     0.13509320202876504, 2.7605117732891968},
+    {-42.869649755652389, -317.92601900427144, 27.220526497418359,
+     0.31748015965338411, 2.8126818791197881},
+    {-42.804199908910931, -315.62665319849958, 43.082787380633825,
+     0.50325420720765413, 2.86401813964576},
+    {-42.673300215428029, -307.87480400980087, 75.510443222501408,
+     0.88475045099982097, 2.9642936023500264},
+    {-42.542400521945119, -295.81879907980431, 108.83810142839455,
+     1.2791720741316817, 3.0615345041494502},
+    {-42.411500828462209, -279.34365839492182, 143.02292044690904,
+     1.6861336860652532, 3.1559187571515914},
+    {-42.2806011349793, -258.33985829146798, 178.02434001578615,
+     2.1052721015892115, 3.2476080631012985},
+    {-42.14970144149639, -232.70304600665241, 213.80388396381781,
+     2.5362443463636, 3.3367498123465951},
+    {-42.018801748013487, -202.33377853267581, 250.32498551924488,
+     2.9787258929995479, 3.4234787152279917},
+    {-41.887902054530578, -167.13728303739808, 287.5528320151999,
+     3.4324090956006512, 3.5079182095018626},
+    {-41.757002361047668, -127.02323648825623, 325.45422638112819,
+     3.8970017958559549, 3.5901816793943171},
+    {-41.626102667564766, -81.905562430389821, 363.99746321741134,
+     4.372226078001769, 3.6703735154990413},
+    {-41.560652820823307, -57.44458084862783, 383.50024490104096,
+     4.6137418311785305, 3.7097229637795572},
+    {-41.495202974081856, -31.7022431355152, 403.1522175863924,
+     4.8578171534454668, 3.7485900396165639},
+    {-41.429753127340405, -4.6689027017067923, 422.94978993759997,
+     5.1044208329893008, 3.7869856552915002},
+    {-41.364303280598946, 23.6648544362337, 442.88944493111211,
+     5.3535223587198679, 3.8249203145104533},
+    {-41.298853433857488, 53.308214433359147, 462.96773724335003,
+     5.6050918941953167, 3.8624041325553145},
+    {-41.233403587116037, 84.270140227055705, 483.18129076427175,
+     5.8591002528257041, 3.8994468552151886},
+    {-41.102503893633127, 150.1844514255134, 524.00100896296431,
+     6.3743198020125149, 3.9722462558103735},
+    {-40.971604200150225, 221.47519262316226, 565.32288766668228,
+     6.8989596417194905, 4.043389743349298},
+    {-40.906154353408766, 259.15688219707692, 586.16436835383308,
+     7.1647454719119441, 4.0783614326013389},
+    {-40.873429430038044, 278.5102132452206, 596.62891929429793,
+     7.2984935153964958, 4.0957007510495638},
+    {-40.857066968352683, 288.31541604991895, 601.87198467928363,
+     7.3655799270354541, 4.1043342007448995},
+    {-40.840704506667315, 298.20646672099969, 607.12218191141289,
+     7.4328074067906824, 4.1127063055824173},
+    {-40.840704486667313, 298.20647886267074, 607.00622927568554,
+     7.4313878384963497, -70978.42384276184},
+    {-40.840702489296504, 298.20768931357674, 605.47990184206913,
+     7.4127018505711639, -5005.8864520443894},
+    {-40.840700491925688, 298.20889796680058, 604.80291577676837,
+     7.4044140831563299, -3542.9117228542896},
+    {-40.840698494554879, 298.21010544600244, 604.28320744301243,
+     7.3980518173994874, -2893.2265083923057},
+    {-40.840696497184069, 298.21131197558026, 603.84504270367734,
+     7.3926878639950706, -2505.5792547328356},
+    {-40.840694499813253, 298.21251768536962, 603.45902530197895,
+     7.3879623338033387, -2240.9045782849435},
+    {-40.840692502442444, 298.21372266301188, 603.11006461248564,
+     7.3836904770458673, -2045.469070690385},
+    {-40.840690505071635, 298.21492697288005, 602.78919103094222,
+     7.3797624816858489, -1893.5442238495223},
+    {-40.840688507700818, 298.21613066485668, 602.49055815604208,
+     7.3761067720790008, -1771.0620271679395},
+    {-40.8406845129592, 298.21853634873747, 601.94487031163271,
+     7.3694268043013453, -1583.7510129068789},
+    {-40.840680518217575, 298.22093996279176, 601.45162863326493,
+     7.3633889176378782, -1445.4622417861774},
+    {-40.840676523475949, 298.2233416891915, 600.99813331246662,
+     7.3578376323786188, -1337.9727771266284},
+    {-40.840672528734331, 298.22574166910528, 600.57610815611349,
+     7.352671625737373, -1251.3212492489897},
+    {-40.840664539251087, 298.23053682422051, 599.80503343623423,
+     7.3432330277066677, -1118.8164915911934},
+    {-40.840656549767843, 298.2353261302315, 599.10815725613134,
+     7.3347028166169004, -1020.9979163330689},
+    {-40.840648560284599, 298.24011010260466, 598.46750883155778,
+     7.3268609819964547, -944.96928871200873},
+    {-40.840640570801355, 298.24488914074959, 597.87137809238141,
+     7.3195641612906552, -883.68197608375488},
+    {-40.840624591834867, 298.25443364427662, 596.78234357261465,
+     7.306234289226901, -789.96714962965586},
+    {-40.840608612868373, 298.26396162706106, 595.79826205646771,
+     7.2941893166197698, -720.78702422765582},
+    {-40.840592633901878, 298.27347454732853, 594.89371153377272,
+     7.2831180103879047, -667.01880746597567},
+    {-40.84057665493539, 298.28297353494321, 594.05212736732653,
+     7.2728175753553925, -623.67663605621044},
+    {-40.840560675968902, 298.29245949895295, 593.26200332421547,
+     7.263147144712172, -587.77513453824974},
+    {-40.840544697002414, 298.30193319139579, 592.5149615679461,
+     7.2540041515586724, -557.40316554447963},
+    {-40.840512739069432, 298.32084621504856, 591.12623699721439,
+     7.2370080264898684, -508.4811368724657},
+    {-40.840480781136449, 298.33971673076559, 589.84999613868536,
+     7.2213889853511155, -470.45842408746097},
+    {-40.840448823203474, 298.35854793456411, 588.66281010462922,
+     7.2068601970184618, -439.8088775522873},
+    {-40.840416865270498, 298.37734239781065, 587.5484048410475,
+     7.1932224244836434, -414.42120247130714},
+    {-40.840384907337516, 298.39610224772684, 586.4949311450714,
+     7.1803306026102103, -392.94384308446945},
+    {-40.840320991471557, 298.43352504745849, 584.53699292560009,
+     7.1563711882634999, -358.34912565762573},
+    {-40.840257075605599, 298.47082800134501, 582.73813984429842,
+     7.1343593499607927, -331.46190811903688},
+    {-40.840193159739641, 298.50802014961107, 581.06523620535347,
+     7.1138894217837461, -309.78860835860269},
+    {-40.840129243873683, 298.5451087655515, 579.49526563500524,
+     7.0946796247214827, -291.83620296842344},
+    {-40.840065328007725, 298.58209986618584, 578.01146991128724,
+     7.0765247957976767, -276.64893421006616},
+    {-40.840001412141767, 298.61899853729335, 576.60119784197093,
+     7.0592700527006702, -263.58283032360015},
+    {-40.839937496275809, 298.65580915156306, 575.25462065007559,
+     7.0427950667472619, -252.18604872781594},
+    {-40.839809664543893, 298.72918100846869, 572.72276434652406,
+     7.0118197054643447, -233.1733819242354},
+    {-40.839681832811976, 298.80224100799501, 570.36903802300378,
+     6.9830249946358558, -217.84762600331024},
+    {-40.83955400108006, 298.87500972338233, 568.1608902770098,
+     6.9560124268495196, -205.15301282049123},
+    {-40.839426169348144, 298.94750417444817, 566.07462046104581,
+     6.9304918501268107, -194.4136961483475},
+    {-40.839298337616228, 299.01973874696705, 564.09233638522346,
+     6.9062442224386817, -185.17430489184488},
+    {-40.839170505884312, 299.09172580969425, 562.20013751517956,
+     6.8830993694420766, -177.11532889935526},
+    {-40.839042674152395, 299.16347614610629, 560.38696942369279,
+     6.8609219600826927, -170.00508467824412},
+    {-40.838914842420479, 299.23499926680211, 558.64386917617003,
+     6.8396022682254483, -163.67092997677238},
+    {-40.838659178956647, 299.37739687813973, 555.33953850684543,
+     6.799189171139596, -152.83362176371932},
+    {-40.838403515492814, 299.51897683946243, 552.24110892658689,
+     6.7612964928597643, -143.85684694922904},
+    {-40.838147852028982, 299.65978729548544, 549.31506116269588,
+     6.7255138890365229, -136.26270037900733},
+    {-40.837892188565149, 299.79986894036756, 546.53609064046032,
+     6.6915315819543411, -129.72917994264972},
+    {-40.83763652510131, 299.93925676302177, 543.88453804778635,
+     6.6591089045209753, -124.03035376378662},
+    {-40.83738086163747, 300.07798126826896, 541.34476922991996,
+     6.6280544663732073, -119.00239402845297},
+    {-40.837125198173638, 300.21606936048255, 538.90410796584854,
+     6.5982130885886896, -114.52322217061702},
+    {-40.836869534709805, 300.35354500101784, 536.5521071435968,
+     6.56945688120814, -110.49975581873262},
+    {-40.836613871245973, 300.49042970884739, 534.28003575601565,
+     6.5416789629099839, -106.85961516979079},
+    {-40.836102544318308, 300.76250244227941, 529.94721165098952,
+     6.4887094829367262, -100.5116284474895},
+    {-40.835591217390636, 301.0324237643772, 525.85822883778064,
+     6.4387243230830657, -95.141326599255592},
+    {-40.835079890462964, 301.30030880379343, 521.97729841466139,
+     6.3912853827496638, -90.521016076738789},
+    {-40.834568563535299, 301.56625655096536, 518.2766155128046,
+     6.3460523001046028, -86.4909363034742},
+    {-40.834057236607634, 301.83035331228399, 514.73406802216289,
+     6.3027544022824289, -82.935241582987231},
+    {-40.833545909679962, 302.09267520954506, 511.33172724069567,
+     6.2611722279974691, -79.767607849760466},
+    {-40.83303458275229, 302.35329003953791, 508.05481711059804,
+     6.2211249090607428, -76.922214761677253},
+    {-40.832523255824626, 302.61225869017096, 504.89098868324555,
+     6.1824612885174135, -74.347881132416333},
+    {-40.832011928896961, 302.86963624057819, 501.82979611455329,
+     6.1450535059161089, -72.004128294456962},
+    {-40.831500601969289, 303.12547283047405, 498.86230972268925,
+     6.1087922604861271, -69.858464518163458},
+    {-40.830477948113952, 303.6327030441131, 493.17863795488404,
+     6.0393444154829572, -66.060396845892441},
+    {-40.829455294258622, 304.13427512733836, 487.78935261520508,
+     5.9734981657200468, -62.792671031870682},
+    {-40.828432640403285, 304.63046922344449, 482.65512515348979,
+     5.9107721499436225, -59.942316707371425},
+    {-40.827409986547949, 305.12152959354353, 477.74467864547648,
+     5.8507835643123896, -57.427416591858268},
+    {-40.826387332692619, 305.60767168695122, 473.03265307733204,
+     5.793222030920929, -55.186928760160178},
+    {-40.825364678837282, 306.08908740148252, 468.49814749968004,
+     5.7378317522113438, -53.174309909069493},
+    {-40.824342024981945, 306.5659490893849, 464.12369387097038,
+     5.6843989498588332, -51.353368407512555},
+    {-40.823319371126608, 307.03841266932272, 459.89451592922478,
+     5.6327427927688012, -49.695480621670072},
+    {-40.822296717271271, 307.50662008563017, 455.79798191504312,
+     5.5827086980410163, -48.177670671801863},
+    {-40.821274063415942, 307.97070128111091, 451.8231925554237,
+     5.5341632876709745, -46.781253971660107},
+    {-40.820251409560605, 308.43077580049118, 447.96066556326412,
+     5.4869905266965873, -45.490858822008043},
+    {-40.818206101849938, 309.33933868789109, 440.54013493220685,
+     5.3963681528895133, -43.179079427552175},
+    {-40.816160794139265, 310.23310203526779, 433.48075273303255,
+     5.3101607831189677, -41.162447118292398},
+    {-40.814115486428591, 311.11275760497591, 426.73827074281269,
+     5.2278270110338498, -39.383035057726389},
+    {-40.812070178717924, 311.97891563660943, 420.27681039618813,
+     5.1489278607502236, -37.797678012271334},
+    {-40.810024871007258, 312.83211972885562, 414.06680073460529,
+     5.0731015484968687, -36.373463194113491},
+    {-40.807979563296584, 313.67285817288632, 408.08352693912786,
+     5.000045717849817, -35.084797837369415},
+    {-40.80593425558591, 314.50157275670483, 402.30608201332262,
+     4.9295046094705093, -33.911440780132715},
+    {-40.803888947875244, 315.31866572305779, 396.71659265581866,
+     4.8612595868325519, -32.837144601619862},
+    {-40.801843640164577, 316.12450535102761, 391.29963645259141,
+     4.7951220035974469, -31.848696425362636},
+    {-40.799798332453904, 316.91943049276398, 386.04179558735711,
+     4.7309277418692899, -30.935226055240935},
+    {-40.79775302474323, 317.70375430426196, 380.93130990680612,
+     4.6685329664574535, -30.087697629143793},
+    {-40.795707717032563, 318.4777673454509, 375.95780357318409,
+     4.6078107797627252, -29.298529903299016},
+    {-40.791617101611223, 319.99592557705137, 366.38588151772558,
+     4.4909457818877909, -27.870564192573564},
+    {-40.787526486189883, 321.47586712816133, 357.26340750056028,
+     4.379566969101754, -26.610364918391589},
+    {-40.783435870768542, 322.9193231833633, 348.53960138553396,
+     4.2730534338739847, -25.487406780138976},
+    {-40.779345255347202, 324.32783628304327, 340.17260767203078,
+     4.1708934454682733, -24.478414558358999},
+    {-40.775254639925862, 325.70279239525206, 332.12744207281929,
+     4.0726593249476659, -23.565289460544989},
+    {-40.771164024504522, 327.04544583161811, 324.37450839711494,
+     3.9779892990320005, -22.733717154872402},
+    {-40.767073409083181, 328.35693893872593, 316.88850331660734,
+     3.8865741003375831, -21.972207553831566},
+    {-40.762982793661841, 329.63831789493798, 309.64759178806725,
+     3.7981468794306896, -21.271416512812962},
+    {-40.758892178240501, 330.89054555066201, 302.63277560954521,
+     3.7124754800267659, -20.623656572565256},
+    {-40.754801562819161, 332.11451198786705, 295.82740253806429,
+     3.6293564340152416, -20.022537476234444},
+    {-40.75071094739782, 333.31104329489222, 289.21677951652504,
+     3.5486102302589799, -19.462697647940097},
+    {-40.746620331976473, 334.48090892667898, 282.78786422954204,
+     3.4700775417147951, -18.939600625833368},
+    {-40.742529716555133, 335.62482793089657, 276.52901642943658,
+     3.393616183791762, -18.449378661429364},
+    {-40.738439101133793, 336.74347425529959, 270.42979545676951,
+     3.3190986378420568, -17.98871109100703},
+    {-40.734348485712445, 337.8374813036209, 264.48079388041754,
+     3.2464100165144911, -17.554728697083149},
+    {-40.730257870291105, 338.90744587158116, 258.67349968035114,
+     3.1754463782689322, -17.144937741580513},
+    {-40.726167254869765, 339.95393156745206, 253.00018120605446,
+     3.1061133204942379, -16.757159060875868},
+    {-40.717986024027084, 341.97857240736681, 242.02788134077872,
+     2.9720021171720234, -16.040208350946756},
+    {-40.709804793184404, 343.91535384325294, 231.5143247565012,
+     2.8434713201481761, -15.391075998862627},
+    {-40.701623562341723, 345.76785277907845, 221.41757040048924,
+     2.7200090686965979, -14.79963788261451},
+    {-40.693442331499043, 347.53932876313019, 211.70175552194047,
+     2.6011777745092757, -14.25776726386133},
+    {-40.685261100656362, 349.23276872332536, 202.3359285178266,
+     2.4865998526744417, -13.758855090749577},
+    {-40.677079869813674, 350.85092333262509, 193.29315510277095,
+     2.3759467951165929, -13.297463990327946},
+    {-40.668898638970987, 352.39633691730211, 184.54982341109528,
+     2.2689306766012387, -12.869074036654089},
+    {-40.660717408128306, 353.87137231211909, 176.08509644742512,
+     2.1652974624130059, -12.469892846715014},
+    {-40.652536177285626, 355.27823171029928, 167.88047540290594,
+     2.0648216715284322, -12.096711612333381},
+    {-40.644354946442945, 356.61897430212576, 159.9194475728568,
+     1.9673020740959306, -11.746794488428259},
+    {-40.636173715600265, 357.89553131176734, 152.18719966311019,
+     1.8725581882809674, -11.417792572517824},
+    {-40.627992484757584, 359.10971890611052, 144.67038222576389,
+     1.7804274021173938, -11.107676264848354},
+    {-40.619811253914904, 360.26324934801573, 137.35691450067384,
+     1.6907625892456049, -10.814681540783733},
+    {-40.611630023072223, 361.35774068968237, 130.23582150012567,
+     1.6034301187386011, -10.537266875365548},
+    {-40.603448792229543, 362.39472524310531, 123.29709705427297,
+     1.5183081822087594, -10.274078410807794},
+    {-40.595267561386862, 363.37565701925018, 116.53158793248653,
+     1.4352853784775677, -10.023921565320043},
+    {-40.587086330544182, 364.30191829201254, 109.9308952062777,
+     1.3542595089358287, -9.7857377212398475},
+    {-40.578905099701494, 365.17482541517523, 103.48728981769078,
+     1.2751365464817834, -9.5585849523112909},
+    {-40.570723868858806, 365.99563399827537, 97.193639929479858,
+     1.1978297484122973, -9.341621988231827},
+    {-40.562542638016126, 366.76554352951615, 91.043348107368146,
+     1.1222588894370773, -9.1340947928366152},
+    {-40.554361407173445, 367.48570151948326, 85.030296755080016,
+     1.0483495955140285, -8.9353252669297039},
+    {-40.546180176330765, 368.15720722773131, 79.148800514146018,
+     0.97603276276503503, -8.7447016893822536},
+    {-40.537998945488084, 368.78111502476423, 73.393564571499354,
+     0.90524404855543728, -8.5616705889888518},
+    {-40.529817714645404, 369.35843743406275, 67.759648002466335,
+     0.83592342407675657, -8.3857298006844072},
+    {-40.521636483802723, 369.89014789228452, 62.242431425036024,
+     0.76801477958467346, -8.2164225074225143},
+    {-40.513455252960043, 370.37718326039391, 56.837588361225947,
+     0.70146557491011841, -8.0533321065142651},
+    {-40.505274022117362, 370.82044611388523, 51.541059799006568,
+     0.63622652905475052, -7.8960777689013346},
+    {-40.497092791274682, 371.22080683652246, 46.349031528025961,
+     0.57225134365709474, -7.7443105834679127},
+    {-40.488911560432001, 371.57910553873018, 41.257913888100859,
+     0.50949645591881465, -7.5977101974288379},
+    {-40.480730329589313, 371.89615381912881, 36.264323623657297,
+     0.44792081724313604, -7.4559818790835957},
+    {-40.472549098746626, 372.17273638532362, 31.365067582428846,
+     0.38748569438884412, -7.3188539415821259},
+    {-40.464367867903945, 372.40961254808167, 26.557128034263151,
+     0.32815449040201217, -7.1860754764062911},
+    {-40.456186637061265, 372.60751760138351, 21.837649417416106,
+     0.26989258297284729, -7.05741435350226},
+    {-40.448005406218584, 372.76716409929219, 17.203926346252597,
+     0.21266717818930597, -6.9326554517642576},
+    {-40.439824175375904, 372.88924303937023, 12.653392736554396,
+     0.15644717793134147, -6.8115990891535212},
+    {-40.431642944533223, 372.97442496128542, 8.183611923692153,
+     0.1012030593824615, -6.6940596263688716},
+    {-40.423461713690543, 373.02336096824541, 3.7922676650322087,
+     0.046906765332122097, -6.5798642218398671},
+    {-40.419371098269202, 373.03443514411629, 1.6253163107760868,
+     0.020105660560929467, -6.5239697515397754},
+    {-40.415280482847862, 373.03668367810582, -0.52284406831101449,
+     -0.0064683958896797483, -6.4688517190347321},
+    {-40.407099252005182, 373.01500811028598, -4.763822593392546,
+     -0.058947841859201801, -6.3608716497791837},
+    {-40.398918021162501, 372.95893251391948, -8.9326693839774958,
+     -0.11055579977783342, -6.2557833395564035},
+    {-40.390736790319821, 372.86903914221557, -13.031294369886396,
+     -0.16131538324660519, -6.1534551026803417},
+    {-40.382555559477133, 372.74589497738077, -17.061521723760183,
+     -0.2112486627874659, -6.0537635168644508},
+    {-40.374374328634445, 372.59005241014847, -21.025095185359685,
+     -0.26037673072308393, -5.9565927680919231},
+    {-40.366193097791765, 372.4020498774774, -24.923682967796662,
+     -0.30871976095709797, -5.8618340578742485},
+    {-40.349830636106404, 371.9316524539592, -32.532223536655792,
+     -0.40312713862477589, -5.6791494627113535},
+    {-40.333468174421043, 371.33875302493152, -39.899142312003541,
+     -0.49461581309423641, -5.5049604329180761},
+    {-40.317105712735682, 370.62721351497038, -47.035486419208553,
+     -0.5833192337061861, -5.3386002368932681},
+    {-40.300743251050321, 369.80072216414027, -53.951454306460469,
+     -0.66936053722848377, -5.1794733653589882},
+    {-40.284380789364953, 368.86280666780931, -60.656484883268774,
+     -0.75285363327816179, -5.0270460357278726},
+    {-40.268018327679584, 367.81684595643111, -67.159334956698501,
+     -0.833904147085061, -4.8808381994763881},
+    {-40.251655865994223, 366.66608079132754, -73.468146790919221,
+     -0.91261024186817696, -4.7404167792088048},
+    {-40.235293404308862, 365.41362332542087, -79.590507288169078,
+     -0.98906333909877242, -4.6053899178888571},
+    {-40.218930942623501, 364.06246575559379, -85.533500027834791,
+     -1.0633487517340683, -4.4754020659392673},
+    {-40.20256848093814, 362.61548817485948, -91.30375119019368,
+     -1.135546242940733, -4.3501297656503732},
+    {-40.186206019252772, 361.07546571719473, -96.907470221352057,
+     -1.2057305207528766, -4.2292780188637789},
+    {-40.169843557567404, 359.44507507504483, -102.35048595758005,
+     -1.2739716774214165, -4.1125771448880455},
+    {-40.153481095882043, 357.72690045869848, -107.63827881414277,
+     -1.3403355808318902, -3.9997800523187057},
+    {-40.120756172511321, 354.03710605611093, -117.76854504765566,
+     -1.4676760395700694, -3.7850078277789581},
+    {-40.088031249140592, 350.02510329807848, -127.33616510979797,
+     -1.5882067682299541, -3.5833531962492975},
+    {-40.055306325769862, 345.70874024013114, -136.37502119427205,
+     -1.7023340189328953, -3.3934448330603035},
+    {-40.02258140239914, 341.10481379658268, -144.91555906480625,
+     -1.8104224413685535, -3.2141051792843376},
+    {-39.989856479028411, 336.22917418177076, -152.98526277352971,
+     -1.9128008480570398, -3.0443165820625446},
+    {-39.957131555657682, 331.09681519734323, -160.60904808340442,
+     -2.0097669906520501, -2.883194397857185},
+    {-39.92440663228696, 325.72195274558288, -167.80959100140845,
+     -2.1015915470826365, -2.7299654272112606},
+    {-39.891681708916231, 320.11809347681464, -174.60760405253754,
+     -2.1885214733064364, -2.5839504753410392},
+    {-39.858956785545502, 314.29809511374651, -181.02207011721865,
+     -2.2707828392395948, -2.4445501369369751},
+    {-39.82623186217478, 308.2742197103131, -187.07044154379432,
+     -2.3485832427127717, -2.3112331235191204},
+    {-39.79350693880405, 302.05818087764686, -192.76881064362522,
+     -2.4221138757646106, -2.1835266127546853},
+    {-39.760782015433321, 295.6611858309472, -198.13205644547259,
+     -2.4915513025946869, -2.0610082183914025},
+    {-39.728057092062599, 289.09397296767366, -203.17397163269331,
+     -2.5570589968932325, -1.9432992686643542},
+    {-39.69533216869187, 282.36684557177153, -207.90737284234825,
+     -2.6187886772027946, -1.8300591484146946},
+    {-39.662607245321141, 275.48970214457108, -212.34419691932953,
+     -2.6768814718348986, -1.7209805115139798},
+    {-39.629882321950411, 268.47206378600782, -216.49558525388611,
+     -2.731468939209698, -1.6157852096625096},
+    {-39.597157398579682, 261.32309898649561, -220.37195795970399,
+     -2.7826739649701286, -1.5142208142158977},
+    {-39.531707551838231, 246.66623402375689, -227.33811593808218,
+     -2.8753895292781366, -1.3210861313941415},
+    {-39.46625770509678, 231.58620974339232, -233.31391529703737,
+     -2.9558657048310231, -1.139967818004086},
+    {-39.400807858355321, 216.14573657594769, -238.36255587129301,
+     -3.0248435099122712, -0.9695153323121275},
+    {-39.33535801161387, 200.40361684598284, -242.54044776981002,
+     -3.0829825890767193, -0.80858521061355926},
+    {-39.269908164872419, 184.41515486508902, -245.89822401701244,
+     -3.1308734283846946, -0.65620185882030513},
+    {-39.20445831813096, 168.23250713452927, -248.48156585094057,
+     -3.1690473036841427, -0.51152705665017162},
+    {-39.139008471389509, 151.90498352055505, -250.33188144247026,
+     -3.1979844561655422, -0.37383597466981211},
+    {-39.073558624648058, 135.47930794573813, -251.48686870693012,
+     -3.2181208668857879, -0.24249812140501134},
+    {-39.0081087779066, 118.99984538420536, -251.98098556572259,
+     -3.2298539132002153, -0.1169620656331985},
+    {-38.942658931165141, 102.50880060448546, -251.84584564404832,
+     -3.2335471248792982, 0.0032569196837500896},
+    {-38.87720908442369, 86.046393063480949, -251.11055339675767,
+     -3.2295342092517401, 0.11858693015088943},
+    {-38.811759237682239, 69.651011542220118, -249.80198965045659,
+     -3.2181224783019431, 0.22940770199014629},
+    {-38.74630939094078, 53.359351472934868, -247.94505626688496,
+     -3.199595782983871, 0.33605745198934378},
+    {-38.680859544199329, 37.206537397058348, -245.56288688021917,
+     -3.1742170387866206, 0.4388385695342143},
+    {-38.6481346208286, 29.19277169715544, -244.18162984104833,
+     -3.1590351285602769, 0.48886428003465354},
+    {-38.615409697457878, 21.226232584983862, -242.67702930365897,
+     -3.1422304101519716, 0.53802238175447781},
+    {-38.582684774087149, 13.310915799065038, -241.05155697228807,
+     -3.1238307855416894, 0.58634259489350538},
+    {-38.549959850716419, 5.4507375183186699, -239.30760414039347,
+     -3.1038632085105289, 0.63385316511130541},
+    {-38.533597389031058, 1.5425280029627901, -238.39192379550227,
+     -3.0932996131755233, 0.65731328085117047},
+    {-38.517234927345697, -2.3504630711478356, -237.447485598794,
+     -3.0823537313450267, 0.68058095699872134},
+    {-38.484510003974968, -10.088921333075554, -235.47344329918866,
+     -3.0593275486015958, 0.72655154039350212},
+    {-38.451785080604239, -17.76094485424229, -233.38764979158847,
+     -3.0348090381545556, 0.77178927017895993},
+    {-38.419060157233517, -25.362911226664998, -231.19221145255995,
+     -3.0088217997314963, 0.81631736013978962},
+    {-38.353610310492058, -40.34252032370604, -226.48051294642627,
+     -2.9525318622282346, 0.90333217584792724},
+    {-38.2881604637506, -55.000091444657748, -221.35398624470525,
+     -2.8906322942084488, 0.98776135542575672},
+    {-38.222710617009149, -69.308961646311502, -215.82738764804265,
+     -2.8232873096132436, 1.0697559080483245},
+    {-38.157260770267698, -83.243406967758006, -209.91466574569725,
+     -2.750651665085766, 1.1494540630664583},
+    {-38.091810923526239, -96.778591780038951, -203.62902783027295,
+     -2.6728714504947271, 1.2269826412348881},
+    {-38.026361076784788, -109.89052224846495, -196.98299931632297,
+     -2.5900847956311774, 1.3024582498162285},
+    {-37.960911230043337, -122.55600347944558, -189.98847704782119,
+     -2.5024225037235004, 1.3759883277092293},
+    {-37.895461383301878, -134.75259997719988, -182.65677724991076,
+     -2.4100086208528917, 1.4476720623686248},
+    {-37.830011536560427, -146.45859908155504, -174.9986787721476,
+     -2.312960949047318, 1.5176011967169858},
+    {-37.764561689818976, -157.65297709732644, -167.02446217979067,
+     -2.2113915097393959, 1.5858607413303449},
+    {-37.699111843077517, -168.31536785961617, -158.74394517340497,
+     -2.1054069633546852, 1.652529604779974},
+    {-37.633661996336059, -178.4260335086758, -150.16651475256776,
+     -1.9951089900205259, 1.7176811530318561},
+    {-37.568212149594608, -187.9658372732948, -141.30115648478551,
+     -1.8805946357272987, 1.7813837071628109},
+    {-37.502762302853156, -196.91621808381331, -132.1564811942105,
+     -1.7619566277142769, 1.8437009872845447},
+    {-37.437312456111698, -205.25916685505513, -122.74074934501294,
+     -1.6392836623743183, 1.9046925094239302},
+    {-37.306412762628796, -220.05336012063057, -103.12753808742787,
+     -1.3821690488388971, 2.0229174209225254},
+    {-37.175513069145886, -232.2145749264927, -82.521402483987032,
+     -1.1098892210377633, 2.1364631289817479},
+    {-37.110063222404435, -237.26806859789968, -71.8634957979463,
+     -0.96824809172731607, 2.1915944370834342},
+    {-37.044613375662976, -241.61651655514856, -60.977867766027558,
+     -0.82303285430005191, 2.245686398881876},
+    {-36.979163528921518, -245.24522318380716, -49.870859387664829,
+     -0.67431026865522092, 2.2987772990425608},
+    {-36.913713682180067, -248.13990079682597, -38.548597025053951,
+     -0.52214466088334965, 2.3509032523419688},
+    {-36.848263835438615, -250.28665597325113, -27.017004073399431,
+     -0.36659806000704942, 2.4020983624759484},
+    {-36.782813988697157, -251.67197663292845, -15.281811793637276,
+     -0.20773032479697126, 2.4523948667906552},
+    {-36.717364141955706, -252.2827197948159, -3.3485693808299142,
+     -0.045599261535819446, 2.5018232683910857},
+    {-36.651914295214254, -252.1060999710659, 8.7773466660921642,
+     0.11973926648680185, 2.5504124569114737},
+    {-36.586464448472796, -251.12967815312246, 21.090723814100336,
+     0.28823123704401438, 2.5981898190828656},
+    {-36.521014601731345, -249.34135134975369, 33.586505352110734,
+     0.45982437397178044, 2.6451813401040813},
+    {-36.390114908248435, -243.28219170891126, 59.105788723883727,
+     0.81211324659057893, 2.736904342727227},
+    {-36.259215214765526, -233.83815127454218, 85.297582571565087,
+     1.1762193702530839, 2.8257646701629224},
+    {-36.128315521282616, -220.92354738096083, 112.12632720864021,
+     1.551779062915186, 2.9119283379542336},
+    {-35.997415827799713, -204.45722768888422, 139.55833559588893,
+     1.9384493634694782, 2.9955462414439182},
+    {-35.866516134316804, -184.36233578090759, 167.56163276576507,
+     2.335906171347423, 3.0767559259776172},
+    {-35.735616440833894, -160.56609654972587, 196.10581352878424,
+     2.7438426010289931, 3.1556831077394878},
+    {-35.604716747350984, -132.99961915591646, 225.16191593956952,
+     3.1619675215689185, 3.2324429858562458},
+    {-35.473817053868075, -101.59771563500823, 254.70230840412694,
+     3.5900042560595282, 3.3071413789388533},
+    {-35.408367207126624, -84.439078881699373, 269.64581721837413,
+     3.8076567558317498, 3.3437482677817263},
+    {-35.342917360385172, -66.29873348841285, 284.70058864086315,
+     4.0276894198889135, 3.3798757132839605},
+    {-35.277467513643714, -47.169499903719831, 299.86349958948699,
+     4.2500712313534619, 3.4155347238567626},
+    {-35.212017666902263, -27.044400808462733, 315.13149298029572,
+     4.4747718798929457, 3.4507358851908174},
+    {-35.146567820160811, -5.9166568739893206, 330.50157536988269,
+     4.7017617347589207, 3.4854893815940833},
+    {-35.081117973419353, 16.220317329139661, 345.97081471384712,
+     4.9310118191784262, 3.5198050160082288},
+    {-35.015668126677902, 39.372917279334764, 361.53633823426918,
+     5.1624937860148981, 3.5536922287997315},
+    {-34.95021827993645, 63.547352316003654, 377.19533038965585,
+     5.3961798946215582, 3.5871601154140951},
+    {-34.819318586453541, 114.98565628170006, 408.78273310985566,
+     5.8700564759026133, 3.6528726658947952},
+    {-34.688418892970631, 170.58131804619308, 440.71157201516951,
+     6.3524309564953487, 3.7170091393174509},
+    {-34.622969046229173, 199.95180474265342, 456.79754707145787,
+     6.5967414068610646, 3.7485058632490089},
+    {-34.590244122858451, 215.03249915638804, 464.86981783868066,
+     6.7196666231603484, 3.7641146014510265},
+    {-34.57388166117309, 222.67198658910505, 468.91313819440171,
+     6.7813204023457558, 3.7718844584214475},
+    {-34.557519199487722, 230.37767151691224, 472.96119725165363,
+     6.843101128316305, 3.7793317921650482},
+    {-34.55751917948772, 230.37768097553422, 472.87094563416468,
+     6.841795314908576, -65290.635003803982},
+    {-34.557517182116911, 230.37862394421836, 471.68292652345872,
+     6.8246066989955638, -4604.7494912679276},
+    {-34.557515184746094, 230.3795655136706, 471.15599083537336,
+     6.8169830544318852, -3259.0084626055896},
+    {-34.557513187375285, 230.38050616931253, 470.75147201423232,
+     6.8111306137938401, -2661.3849772086305},
+    {-34.557511190004476, 230.38144608580839, 470.41042252044315,
+     6.8061964869811886, -2304.801359698351},
+    {-34.55750919263366, 230.3823853642171, 470.10996182450663,
+     6.8018496241146353, -2061.3360606850893},
+    {-34.557507195262851, 230.38332407274876, 469.83834416310378,
+     6.7979200801195132, -1881.5615340830941},
+    {-34.557505197892041, 230.38426226150779, 469.58858806053473,
+     6.7943068426302222, -1741.8109951879881},
+    {-34.557503200521225, 230.38519996932283, 469.35614297874446,
+     6.7909440716143123, -1629.1437555442144},
+    {-34.557499205779607, 230.38707406168189, 468.93139840202497,
+     6.7847993804424078, -1456.8426723042649},
+    {-34.557495211037981, 230.38894654295387, 468.54747522505056,
+     6.7792453180372894, -1329.6354952373736},
+    {-34.557491216296356, 230.39081755493856, 468.19448857133807,
+     6.7741388638558133, -1230.7595601734408},
+    {-34.557487221554737, 230.39268720750906, 467.86599667919711,
+     6.7693868144928722, -1151.051739692093},
+    {-34.557479232071493, 230.39642277280043, 467.26581335678634,
+     6.7607045383555429, -1029.1650759034642},
+    {-34.55747124258825, 230.40015378530248, 466.72338238190906,
+     6.7528578567798139, -939.18506067396231},
+    {-34.557463253105006, 230.40388064623085, 466.22471622124539,
+     6.745644389556789, -869.24888305174557},
+    {-34.557455263621762, 230.4076036664602, 465.76070035895913,
+     6.7389322623135985, -812.87274385241108},
+    {-34.557439284655274, 230.4150391421382, 464.91301525354169,
+     6.7266705068042976, -726.66762115088954},
+    {-34.557423305688779, 230.42246175833674, 464.14702025031596,
+     6.7155906871955491, -663.03114289427731},
+    {-34.557407326722284, 230.4298726500646, 463.44292816079178,
+     6.7054065106676015, -613.57156013134272},
+    {-34.557391347755797, 230.43727269674739, 462.78784592004968,
+     6.6959314327715269, -573.70254539840209},
+    {-34.557375368789309, 230.44466260594996, 462.17281766469989,
+     6.6870358748673073, -540.6779524390148},
+    {-34.557359389822821, 230.45204296301048, 461.59132251509783,
+     6.6786254891199377, -512.73979043205009},
+    {-34.557327431889838, 230.46677693038239, 460.51033839489048,
+     6.6629912180350939, -467.73804331717167},
+    {-34.557295473956856, 230.48147780945467, 459.51690605989762,
+     6.6486236807246639, -432.76221073139408},
+    {-34.55726351602388, 230.49614808785191, 458.59278965330753,
+     6.6352590308642689, -404.56870631453171},
+    {-34.557231558090905, 230.51078976699978, 457.72532227582889,
+     6.6227139970166586, -381.21542102568293},
+    {-34.557199600157922, 230.52540450262697, 456.90528110622057,
+     6.6108551386225836, -361.45910416093398},
+    {-34.557135684291964, 230.55455854499033, 455.38118043469325,
+     6.5888154706306858, -329.63655600012765},
+    {-34.557071768426006, 230.5836192964465, 453.98090418988147,
+     6.5685673142692789, -304.90387954649998},
+    {-34.557007852560048, 230.61259379348198, 452.6786611994907,
+     6.5497375109974314, -284.96731225232713},
+    {-34.55694393669409, 230.64148769729974, 451.45653666022116,
+     6.5320668616886097, -268.45347189940554},
+    {-34.556880020828132, 230.67030569127698, 450.30148679870223,
+     6.5153666437377504, -254.48318892189607},
+    {-34.556816104962174, 230.69905173396256, 449.2036645476403,
+     6.499494386045841, -242.46409522094783},
+    {-34.556752189096215, 230.72772922886523, 448.15541966646657,
+     6.4843394022409644, -231.98055588814543},
+    {-34.556624357364299, 230.78489009415657, 446.1844776042683,
+     6.4558458168554118, -214.49139908798489},
+    {-34.556496525632383, 230.84180819063153, 444.35218472562093,
+     6.4293581439313643, -200.39371038109681},
+    {-34.556368693900467, 230.89849953169085, 442.63320456695868,
+     6.4045098095779913, -188.71632371179837},
+    {-34.556240862168551, 230.95497736491183, 441.00908965819929,
+     6.3810339124734892, -178.83755052604042},
+    {-34.556113030436634, 231.01125288765527, 439.46591354980097,
+     6.3587289629873061, -170.33851000399176},
+    {-34.555985198704718, 231.06733572733071, 437.9928567036136,
+     6.337438423258023, -162.92529529167476},
+    {-34.555857366972802, 231.12323427744161, 436.58131485461519,
+     6.3170378066191946, -156.38478836471151},
+    {-34.555729535240886, 231.17895594073278, 435.22431165583032,
+     6.2974261795280082, -150.55818128084593},
+    {-34.555473871777053, 231.28989430638939, 432.65186750136354,
+     6.2602508231659497, -140.5892466583702},
+    {-34.555218208313221, 231.40019612225967, 430.2396913664337,
+     6.2253939299814283, -132.33175771416154},
+    {-34.554962544849388, 231.509898863003, 427.96169326817346,
+     6.1924780371663806, -125.34610501419616},
+    {-34.554706881385556, 231.61903420407904, 425.79817716874948,
+     6.1612181899034537, -119.33608922171163},
+    {-34.554451217921716, 231.72762938021538, 423.73384104807076,
+     6.1313930060087394, -114.09388286819687},
+    {-34.554195554457877, 231.83570813589697, 421.75651588963717,
+     6.1028264313799934, -109.46878598905437},
+    {-34.553939890994045, 231.94329141316075, 419.85633500324025,
+     6.0753757216650914, -105.34850239824016},
+    {-34.553684227530212, 232.05039786331105, 418.02516674098069,
+     6.0489232347606574, -101.64740857076059},
+    {-34.55342856406638, 232.15704423658616, 416.25621519823841,
+     6.023370653746376, -98.298924607414776},
+    {-34.552917237138715, 232.36901600095638, 412.88280248476553,
+     5.9746446248102067, -92.45954693089341},
+    {-34.552405910211043, 232.57931272735203, 409.69919696416332,
+     5.9286638103989109, -87.519513117472044},
+    {-34.551894583283371, 232.78802403279292, 406.67754165656203,
+     5.8850252144106392, -83.269374892837035},
+    {-34.551383256355706, 232.99522697279085, 403.7961940456351,
+     5.8434157476366311, -79.562173378200001},
+    {-34.550871929428041, 233.20098872994618, 401.03794264673746,
+     5.8035864256317238, -76.291345616068256},
+    {-34.550360602500369, 233.40536855942383, 398.38883219005584,
+     5.7653353719443512, -73.377484678396328},
+    {-34.549849275572697, 233.6084192363945, 395.83736131524142,
+     5.7284962107650186, -70.760044378733113},
+    {-34.549337948645032, 233.8101881583062, 393.37391784319487,
+     5.6929298967742206, -68.39194464105563},
+    {-34.548826621717367, 234.01071820116064, 390.99037091081016,
+     5.6585188144281853, -66.235950310509665},
+    {-34.548315294789695, 234.21004839619019, 388.67976978945308,
+     5.6251624206994357, -64.262173175065683},
+    {-34.547292640934359, 234.60524929914084, 384.25419539836122,
+     5.5612779761367834, -60.76835672239001},
+    {-34.546269987079029, 234.99604448776415, 380.05779196591658,
+     5.5007066190947027, -57.762389355650242},
+    {-34.545247333223692, 235.38265204675403, 376.0599463610194,
+     5.4430055563583402, -55.140352710720528},
+    {-34.544224679368355, 235.76526213024115, 372.23631265520322,
+     5.3878226550199937, -52.8268932613936},
+    {-34.543202025513025, 236.14404246520326, 368.56715052458674,
+     5.3348724048854717, -50.765860126724711},
+    {-34.542179371657689, 236.51914244600948, 365.03619050359737,
+     5.2839195028197086, -48.914439301995309},
+    {-34.541156717802352, 236.89069625255638, 361.62983525175599,
+     5.2347672981283466, -47.239339000468981},
+    {-34.540134063947015, 237.25882527259381, 358.33658267744352,
+     5.187249447469215, -45.714229030923221},
+    {-34.539111410091678, 237.62364001600048, 355.14659994982208,
+     5.141223752589867, -44.317974420601516},
+    {-34.538088756236348, 237.98524165037173, 352.05140279390298,
+     5.0965675211303498, -43.033387645181506},
+    {-34.537066102381011, 238.34372324914867, 349.04360991086901,
+     5.0531740142050703, -41.846328619799046},
+    {-34.535020794670345, 239.05166414758199, 343.26512170993243,
+     4.9698120025876342, -39.719670329024979},
+    {-34.532975486959671, 239.74808035900716, 337.76782500336128,
+     4.8905114639036684, -37.864514650430245},
+    {-34.530930179248998, 240.43351049940929, 332.51727476735857,
+     4.8147743637555029, -36.227575813315809},
+    {-34.528884871538331, 241.10842972304309, 327.48554101661637,
+     4.7421968916024575, -34.769146903990894},
+    {-34.526839563827664, 241.77326130666972, 322.64960371385774,
+     4.6724462445714892, -33.458952005712405},
+    {-34.524794256116991, 242.42838547170101, 317.99022294915727,
+     4.6052442860367924, -32.273448733807314},
+    {-34.522748948406317, 243.07414623770958, 313.49112292689131,
+     4.5403557433302701, -31.194017534816606},
+    {-34.52070364069565, 243.71085683868401, 309.13838937974054,
+     4.4775794925469672, -30.20571261978311},
+    {-34.518658332984984, 244.33880406793978, 304.92001590501059,
+     4.4167419973799831, -29.296379620571233},
+    {-34.51661302527431, 244.95825180969354, 300.82555656639721,
+     4.3576922849603159, -28.456019159191772},
+    {-34.514567717563637, 245.56944394327843, 296.84585583365697,
+     4.3002980402764717, -27.676319230666032},
+    {-34.51252240985297, 246.17260675640372, 292.97283580298915,
+     4.2444425290593717, -26.950305910275684},
+    {-34.50843179443163, 247.35567344718251, 285.51892914495744,
+     4.1369444263043782, -25.636606356415555},
+    {-34.504341179010289, 248.50897993203884, 278.41508217647021,
+     4.0344935254963792, -24.477237918786741},
+    {-34.500250563588949, 249.63387460344427, 271.62175901292034,
+     3.9365186422672811, -23.444120452081979},
+    {-34.496159948167609, 250.73155897953569, 265.10637146955304,
+     3.8425490238317841, -22.515843083244274},
+    {-34.492069332746269, 251.80311267176961, 258.84168057552074,
+     3.752191236751635, -21.675756688463455},
+    {-34.487978717324928, 252.84951278198244, 252.80464203048015,
+     3.6651124744443857, -20.910693442584751},
+    {-34.483888101903588, 253.87164923238095, 246.97555360317736,
+     3.5810282308267865, -20.210083527945908},
+    {-34.479797486482248, 254.87033706371335, 241.33741322046166,
+     3.4996930204575247, -19.565331172343733},
+    {-34.475706871060908, 255.84632643185483, 235.87542740067792,
+     3.4208932725128984, -18.969364585696887},
+    {-34.471616255639567, 256.80031082886148, 230.5766291076624,
+     3.3444418068146136, -18.416305274596269},
+    {-34.467525640218227, 257.7329339146288, 225.42957664961233,
+     3.2701734815940946, -17.901221031263795},
+    {-34.46343502479688, 258.64479524732093, 220.4241135542747,
+     3.1979417228096496, -17.41993867340662},
+    {-34.459344409375539, 259.53645513088418, 215.55117497354047,
+     3.1276157261264421, -16.968900171861936},
+    {-34.455253793954199, 260.40843874728154, 210.80263004942478,
+     3.0590781787596923, -16.545050764755423},
+    {-34.451163178532852, 261.26123970370287, 206.17115239853911,
+     2.9922233877869195, -16.145750979731751},
+    {-34.447072563111512, 262.09532309717298, 201.65011281672039,
+     2.9269557296526605, -15.768706752045004},
+    {-34.442981947690171, 262.91112817786376, 197.23348971441999,
+     2.863188355961249, -15.411913397993635},
+    {-34.434800716847491, 264.4895448468053, 188.69200451811699,
+     2.7398445844032135, -14.75224402948057},
+    {-34.42661948600481, 265.99956845587377, 180.50808869704463,
+     2.6216354000488664, -14.154967136364869},
+    {-34.41843825516213, 267.44398713574361, 172.64907416973966,
+     2.5080898919614039, -13.61076909643533},
+    {-34.410257024319449, 268.82534182157394, 165.08702594907481,
+     2.3988054758265762, -13.112173727132733},
+    {-34.402075793476769, 270.14596108826458, 157.79783339947642,
+     2.2934347675234998, -12.653101006431472},
+    {-34.393894562634081, 271.40798946888452, 150.76051428976652,
+     2.191675531469973, -12.228548775390674},
+    {-34.385713331791393, 272.61341074544117, 143.95667372646471,
+     2.0932628667233324, -11.834358865797491},
+    {-34.377532100948713, 273.7640673051248, 137.37007780834202,
+     1.9979630504737573, -11.46704240355348},
+    {-34.369350870106032, 274.86167637790862, 130.98631359908404,
+     1.9055686284871625, -11.123647369106109},
+    {-34.361169639263352, 275.90784377356175, 124.7925149701735,
+     1.8158944570323545, -10.801656842848159},
+    {-34.352988408420671, 276.90407559271409, 118.77713935580184,
+     1.7287744801655589, -10.49890987239562},
+    {-34.344807177577991, 277.85178828085316, 112.92978431811005,
+     1.6440590819772642, -10.213539248542846},
+    {-34.33662594673531, 278.75231731524428, 107.24103557357274,
+     1.5616128931819102, -9.9439220793929266},
+    {-34.32844471589263, 279.60692475498735, 101.70234012523572,
+     1.48131296024244, -9.688640163664255},
+    {-34.320263485049949, 280.41680583875211, 96.305899609450691,
+     1.4030472063741868, -9.4464479468807951},
+    {-34.312082254207269, 281.18309477938402, 91.044580053686772,
+     1.3267131294913339, -9.2162464031183831},
+    {-34.303901023364588, 281.90686987692828, 85.911835059956388,
+     1.2522166939766024, -8.9970615893582977},
+    {-34.295719792521901, 282.58915804989812, 80.90164004991145,
+     1.1794713821336951, -8.7880269155813675},
+    {-34.287538561679213, 283.23093886724359, 76.008435684411666,
+     1.1083973780690251, -8.5883683929367098},
+    {-34.279357330836532, 283.83314814969378, 71.227078939487456,
+     1.0389208620812447, -8.3973922862916677},
+    {-34.271176099993852, 284.39668119786484, 66.552800608920691,
+     0.97097339780137626, -8.2144747213266402},
+    {-34.262994869151171, 284.92239569550361, 61.981168230557174,
+     0.90449139760345609, -8.0390528907336236},
+    {-34.254813638308491, 285.41111432873993, 57.508053613311311,
+     0.83941565440306198, -7.8706175766319371},
+    {-34.24663240746581, 285.86362715613734, 53.129604285527058,
+     0.7756909300364484, -7.7087067625308308},
+    {-34.23845117662313, 286.28069375924525, 48.84221830084573,
+     0.71326559208077678, -7.5529001520500305},
+    {-34.230269945780449, 286.66304519911949, 44.642521931106998,
+     0.65209129232429652, -7.4028144461026564},
+    {-34.222088714937769, 287.01138580080533, 40.527349851815259,
+     0.59212268119282385, -7.2580992575449041},
+    {-34.213907484095088, 287.32639478474101, 36.493727487892869,
+     0.53331715333680596, -7.1184335640356249},
+    {-34.205726253252408, 287.60872776159874, 32.538855238501647,
+     0.47563462032044607, -6.9835226172637404},
+    {-34.19754502240972, 287.85901810492851, 28.660094342083777,
+     0.41903730696608132, -6.8530952407363701},
+    {-34.189363791567033, 288.07787821415707, 24.854954177766377,
+     0.36348956841216462, -6.7269014596832397},
+    {-34.181182560724352, 288.26590067896626, 21.121080828595087,
+     0.30895772536647281, -6.6047104158884347},
+    {-34.173001329881671, 288.42365935476084, 17.456246756610881,
+     0.25540991539052688, -6.4863085278325467},
+    {-34.164820099038991, 288.55171035775209, 13.858341460382309,
+     0.20281595834851368, -6.3714978627502123},
+    {-34.15663886819631, 288.65059298725271, 10.325363003044075,
+     0.15114723440569783, -6.2600946923464811},
+    {-34.14845763735363, 288.72083058187076, 6.8554103136889042,
+     0.10037657317486054, -6.1519282081762849},
+    {-34.140276406510949, 288.76293131560743, 3.4466761774798504,
+     0.050478152789977547, -6.0468393762365205},
+    {-34.132095175668269, 288.77738893915676, 0.097440840629839348,
+     0.001427407841920322, -5.9446799132851789},
+    {-34.123913944825588, 288.76468347117827, -3.1939338344581572,
+     -0.046799054757059491, -5.8453113698878667},
+    {-34.115732713982908, 288.72528184381235, -6.4290097206620453,
+     -0.094223532798798831, -5.7486043072852793},
+    {-34.107551483140227, 288.65963850625383, -9.6092773342367366,
+     -0.14086729941588916, -5.6544375569429288},
+    {-34.09937025229754, 288.56819598983378, -12.736160343634007,
+     -0.18675066796542777, -5.5626975531433942},
+    {-34.091189021454852, 288.45138543771833, -15.8110197180482,
+     -0.23189305172221683, -5.4732777302552602},
+    {-34.083007790612172, 288.30962710201055, -18.835157550309475,
+     -0.27631301888059062, -5.3860779773989034},
+    {-34.066645328926811, 287.95289640752861, -24.736203477957101,
+     -0.36305605144151065, -5.2179675917926902},
+    {-34.050282867241449, 287.50116517296738, -30.448664906789201,
+     -0.44711324463155583, -5.0576769204144796},
+    {-34.033920405556088, 286.95744758974348, -35.981166599496014,
+     -0.52860743297768942, -4.9045924554990021},
+    {-34.017557943870727, 286.32462224201339, -41.341671627874284,
+     -0.60765196161476975, -4.7581662200519741},
+    {-34.001195482185359, 285.60544235171551, -46.537550838628512,
+     -0.68435168497253973, -4.6179070314781123},
+    {-33.984833020499991, 284.80254496372129, -51.575643201937567,
+     -0.75880383421078779, -4.4833731479913608},
+    {-33.96847055881463, 283.91845920822664, -56.462308464841733,
+     -0.83109877389210385, -4.354166046360886},
+    {-33.952108097129269, 282.95561375646633, -61.203473276482285,
+     -0.90132066470501704, -4.2299251308718135},
+    {-33.935745635443908, 281.91634356841894, -65.804671748572602,
+     -0.969548046114588, -4.1103232131459038},
+    {-33.919383173758547, 280.80289601682506, -70.271081250845853,
+     -1.0358543504589803, -3.9950626335069526},
+    {-33.903020712073179, 279.61743645985268, -74.607554108726006,
+     -1.1003083581009283, -3.8838719189795308},
+    {-33.886658250387811, 278.36205332476464, -78.818645762777706,
+     -1.1629746016911491, -3.7765028923201536},
+    {-33.87029578870245, 277.03876275649856, -82.908639861348036,
+     -1.2239137263307056, -3.6727281618583194},
+    {-33.837570865331728, 274.1961877031431, -90.741243243732598,
+     -1.3408356587544159, -3.475143102144957},
+    {-33.804845941960998, 271.10454830052089, -98.134993786038905,
+     -1.4514929894152648, -3.2896367628734731},
+    {-33.772121018590269, 267.77776452571379, -105.11638912759184,
+     -1.5562598077528098, -3.114947088001621},
+    {-33.739396095219547, 264.22893420869286, -111.70924534861844,
+     -1.6554719152849071, -2.9499903235545193},
+    {-33.706671171848818, 260.47041453584092, -117.93506714116096,
+     -1.7494321308070628, -2.7938298624497957},
+    {-33.673946248478089, 256.51389251623533, -123.81335461192657,
+     -1.8384146856194852, -2.6456514957942003},
+    {-33.641221325107367, 252.37044626588187, -129.36185950258562,
+     -1.9226688926129938, -2.5047435696600688},
+    {-33.608496401736637, 248.05059859731529, -134.59680067045468,
+     -2.0024222306996711, -2.3704809380471006},
+    {-33.575771478365908, 243.56436411734677, -139.53304648495211,
+     -2.0778829546010331, -2.2423118824727282},
+    {-33.543046554995186, 238.92129081342335, -144.18427015031179,
+     -2.1492423163458905, -2.1197473710171053},
+    {-33.510321631624457, 234.13049693369879, -148.56308271503227,
+     -2.2166764668535723, -2.0023521778338913},
+    {-33.477596708253728, 229.20070382655982, -152.68114756932974,
+     -2.2803480921867818, -1.8897374938509852},
+    {-33.444871784883006, 224.14026529355701, -156.54927948905154,
+     -2.340407828380604, -1.7815547414594284},
+    {-33.412146861512277, 218.95719391951747, -160.177530704357,
+     -2.3969954904164927, -1.6774903679830566},
+    {-33.379421938141547, 213.65918477029018, -163.57526601472762,
+     -2.4502411443473147, -1.5772614399732166},
+    {-33.346697014770818, 208.25363678852014, -166.75122860967087,
+     -2.5002660463764812, -1.4806118966923449},
+    {-33.313972091400089, 202.74767216849935, -169.7135979651257,
+     -2.5471834685383676, -1.3873093492922268},
+    {-33.248522244658638, 191.46170203892885, -175.02775711294638,
+     -2.6321133286016121, -1.2099179461726961},
+    {-33.183072397917186, 179.85334757418397, -179.57370745820066,
+     -2.7058029061448816, -1.0436062086626376},
+    {-33.117622551175728, 167.97123093530328, -183.40112261421149,
+     -2.7689355165940266, -0.88713068290745889},
+    {-33.052172704434277, 155.86090171886389, -186.55436566756063,
+     -2.8221195522576421, -0.73943852363818519},
+    {-32.986722857692826, 143.56515774885384, -189.07328001395925,
+     -2.8658997262267523, -0.59963140906965495},
+    {-32.921273010951367, 131.12431909273823, -190.99383398977187,
+     -2.9007662298817722, -0.46693747368140698},
+    {-32.855823164209916, 118.57646377978983, -192.34865109798957,
+     -2.9271622588277797, -0.34068923465359691},
+    {-32.790373317468465, 105.9576318902309, -193.16744975673888,
+     -2.9454902493262023, -0.22030605543932119},
+    {-32.724923470727006, 93.302003314117286, -193.47741079445532,
+     -2.9561170856140291, -0.10528008370226605},
+    {-32.659473623985555, 80.642053430078832, -193.30348672626931,
+     -2.9593784785359283, 0.0048351218565690999},
+    {-32.594023777244104, 68.00869014233335, -192.66866373066159,
+     -2.9555826713419693, 0.11043386321445511},
+    {-32.528573930502645, 55.431375080075213, -191.59418490211615,
+     -2.9450135949927816, 0.21186591742769362},
+    {-32.463124083761194, 42.938231262869778, -190.09974157431773,
+     -2.9279335698533404, 0.30944283294127328},
+    {-32.397674237019743, 30.5561391376859, -188.20363814119062,
+     -2.9045856311212703, 0.40344316934658025},
+    {-32.364949313649014, 24.414819180083548, -187.11034027606686,
+     -2.8906323699564438, 0.44918124420504169},
+    {-32.332224390278284, 18.310822574137774, -185.92293474400472,
+     -2.8751955402101625, 0.49411688400877346},
+    {-32.299499466907555, 12.247196764391452, -184.64337999955285,
+     -2.8583009496591298, 0.53827746988053438},
+    {-32.266774543536826, 6.2269261467155586, -183.27357136538512,
+     -2.8399735324970004, 0.58168902508551923},
+    {-32.234049620166104, 0.25293408371805381, -181.81534409088493,
+     -2.820237392343321, 0.62437630108389985},
+    {-32.201324696795375, -5.6719151767943412, -180.27047621952519,
+     -2.7991158425458416, 0.66636285699647724},
+    {-32.168599773424646, -11.544814674234829, -178.64069127952928,
+     -2.7766314439820476, 0.70767113307145335},
+    {-32.135874850053924, -17.363012993011942, -176.9276608110039,
+     -2.7528060405473451, 0.74832251868074362},
+    {-32.070425003312465, -28.824568260395377, -173.25830362165465,
+     -2.7012162078263584, 0.82773529504842958},
+    {-32.004975156571014, -40.035619246977859, -169.27482405280864,
+     -2.6445079745368032, 0.90475356647391603},
+    {-31.939525309829563, -50.975994036430883, -164.98894798149496,
+     -2.58283343883509, 0.97951648894601384},
+    {-31.874075463088108, -61.62626708193433, -160.41176607042507,
+     -2.5163359837086179, 1.0521514478091387},
+    {-31.808625616346653, -71.967719365918086, -155.55378579252903,
+     -2.4451510050875784, 1.1227753203196902},
+    {-31.743175769605198, -81.982301781660595, -150.42497798347819,
+     -2.3694065627723595, 1.1914955760642039},
+    {-31.677725922863743, -91.652601401828022, -145.03481861379959,
+     -2.2892239639765166, 1.2584112393084357},
+    {-31.612276076122292, -100.96181034087799, -139.39232637095245,
+     -2.2047182878464056, 1.3236137333142961},
+    {-31.546826229380837, -109.89369695412583, -133.50609655724736,
+     -2.1159988581182172, 1.3871876233784064},
+    {-31.481376382639382, -118.43257914685182, -127.38433173867388,
+     -2.0231696700675519, 1.4492112726594908},
+    {-31.415926535897931, -126.56329959346418, -121.0348695200861,
+     -1.9263297770604282, 1.5097574226535815},
+    {-31.350476689156476, -134.27120268947539, -114.46520777183191,
+     -1.8255736413000574, 1.5688937083525551},
+    {-31.285026842415022, -141.54211307896333, -107.68252759020355,
+     -1.7209914527580294, 1.6266831166094662},
+    {-31.219576995673567, -148.36231561743253, -100.69371423771126,
+     -1.6126694197628859, 1.6831843949754646},
+    {-31.154127148932112, -154.71853664503976, -93.505376278139224,
+     -1.500690034279204, 1.7384524172207954},
+    {-31.088677302190657, -160.5979264583321, -86.123863094732542,
+     -1.3851323145334304, 1.7925385108697836},
+    {-31.023227455449202, -165.98804288020057, -78.555280956984149,
+     -1.2660720273187758, 1.8454907513365355},
+    {-30.892327761966296, -175.25263286825427, -62.88020671753992,
+     -1.0177317682572975, 1.9481712759871908},
+    {-30.826877915224841, -179.10412547591261, -54.784838665440404,
+     -0.88858882849085341, 1.9979817056127758},
+    {-30.76142806848339, -182.4203562800158, -46.524673838472729,
+     -0.75621771744302679, 2.0468229837735268},
+    {-30.695978221741935, -185.19070688771188, -38.104802448469869,
+     -0.6206806991653433, 2.0947304178458404},
+    {-30.63052837500048, -187.4048864410849, -29.530144600981046,
+     -0.48203779313651135, 2.1417373150873811},
+    {-30.565078528259026, -189.05292078769259, -20.805459469508296,
+     -0.34034690030769188, 2.187875128932474},
+    {-30.499628681517571, -190.12514222975625, -11.935353813033906,
+     -0.19566392000481297, 2.2331735923228515},
+    {-30.43417883477612, -190.61217981088265, -2.9242898941418862,
+     -0.048042858491723094, 2.2776608394136439},
+    {-30.40145391140539, -190.63340509293721, 1.6327446431591006,
+     0.026853068407800083, 2.2996086391801667},
+    {-30.368728988034665, -190.50495010285294, 6.2234071508184607,
+     0.10246407008456783, 2.321363516836962},
+    {-30.30327914129321, -189.79464845811682, 15.503542443234092,
+     0.25580634971790828, 2.3643068855686615},
+    {-30.237829294551759, -188.47274069656473, 24.912044953689787,
+     0.41193507495226239, 2.4065149143247817},
+    {-30.106929601068849, -183.96127537185896, 44.098451227963494,
+     0.7323638081380095, 2.4888148730511488},
+    {-29.976029907585939, -176.90739881978425, 63.752316708718666,
+     1.0633882623092972, 2.56843238823746},
+    {-29.845130214103033, -167.25181444904825, 83.844968382128059,
+     1.4046674914909218, 2.6455206021599063},
+    {-29.714230520620127, -154.93887977571512, 104.34922620722669,
+     1.7558796640352805, 2.7202187112614702},
+    {-29.583330827137218, -139.91641944494009, 125.23927656530631,
+     2.1167203466220665, 2.7926535974338433},
+    {-29.452431133654308, -122.13555385464946, 146.49056007077047,
+     2.4869009863056877, 2.8629412295799059},
+    {-29.321531440171402, -101.55054163452326, 168.07967176566626,
+     2.8661475630735973, 2.9311878728820684},
+    {-29.190631746688496, -78.118634471087816, 189.98427203650883,
+     3.2541993898104211, 2.9974911363263637},
+    {-29.125181899947041, -65.322521633610492, 201.04817076321046,
+     3.4514491867186594, 3.0299423630946705},
+    {-29.059732053205586, -51.799942969731077, 212.18300685121088,
+     3.6508080401898426, 3.0619408835552173},
+    {-28.994282206464131, -37.54633863064943, 223.38625329430127,
+     3.852246655109441, 3.0934968508143514},
+    {-28.928832359722676, -22.557312413547365, 234.65543612739799,
+     4.0557363880006854, 3.1246200277328473},
+    {-28.863382512981225, -6.828628351544598, 245.98813256317104,
+     4.26124922213359, 3.1553198065965997},
+    {-28.830657589610496, 1.3143661086980527, 251.67755481708122,
+     4.3647557124707506, 3.1705137600829048},
+    {-28.79793266623977, 9.6437925774085915, 257.38196922006136,
+     4.4687577438812811, 3.1856052275696052},
+    {-28.732482819498316, 26.863875628489506, 268.83462043610479,
+     4.6782351202463675, 3.2154849960178451},
+    {-28.667032972756864, 44.835395360280501, 280.34380666343816,
+     4.8896550774866938, 3.2449674987854449},
+    {-28.536133279273955, 83.047107325838383, 303.52288742474133,
+     5.3182203148243756, 3.3027727529580249},
+    {-28.405233585791045, 124.30622137582462, 326.90184103038087,
+     5.7542537019288007, 3.3590822737902668},
+    {-28.339783739049594, 146.08647089921402, 338.66101990259392,
+     5.975010660295732, 3.3866941248058651},
+    {-28.307058815678865, 157.26557237367737, 344.5571393921104,
+     6.08606393259877, 3.4003673226763484},
+    {-28.274333892308139, 168.63779942197036, 350.46394401261927,
+     6.1975632272624619, 3.4138138813661825},
+    {-28.274333872308137, 168.63780643080463, 350.39715115989685,
+     6.1963820746821483, -59057.617566880115},
+    {-28.274331874937324, 168.63850517157522, 349.51792486427325,
+     6.1808343767459588, -4165.157444669102},
+    {-28.274329877566515, 168.63920287679599, 349.12794878439297,
+     6.1739385211990276, -2947.8888683358655},
+    {-28.274327880195703, 168.63989990572756, 348.82857016593539,
+     6.1686447798864696, -2407.3180721597964},
+    {-28.27432588282489, 168.64059638762433, 348.57616350850753,
+     6.1641816847037285, -2084.7760424246794},
+    {-28.274323885454081, 168.64129239727498, 348.3537955437983,
+     6.1602497897926973, -1864.553384571245},
+    {-28.274321888083268, 168.64198798516892, 348.15277354311712,
+     6.1566953740074046, -1701.9411981614135},
+    {-28.274319890712455, 168.64268318838515, 347.96793070269979,
+     6.1534270682316263, -1575.5320712415282},
+    {-28.274317893341646, 168.64337803565402, 347.79589929167167,
+     6.1503853179350187, -1473.6207114633767},
+    {-28.274313898600024, 168.64476675084649, 347.4815471574787,
+     6.1448272167390048, -1317.7685041009756},
+    {-28.274309903858402, 168.64615427367681, 347.19740586603274,
+     6.1398033594208625, -1202.7052710631456},
+    {-28.27430590911678, 168.64754070908342, 346.93615988263366,
+     6.1351843790224994, -1113.2686116578043},
+    {-28.274301914375158, 168.64892613838836, 346.69304182975918,
+     6.1308859698759575, -1041.1701648011626},
+    {-28.274293924891914, 168.65169422911447, 346.24884226317727,
+     6.1230325182116969, -930.91951021312559},
+    {-28.274285935408667, 168.65445895028373, 345.84738370750046,
+     6.1159348904084307, -849.5295069606716},
+    {-28.274277945925419, 168.65722059882478, 345.4783143593811,
+     6.1094100266699769, -786.26983839337277},
+    {-28.274269956442176, 168.65997940480958, 345.13488880626346,
+     6.1033386421286879, -735.27568720056865},
+    {-28.274253977475688, 168.66548919759143, 344.50750018157612,
+     6.092247393264973, -657.30019316692676},
+    {-28.274237998509197, 168.67098947278615, 343.94056833515134,
+     6.0822252460576687, -599.73880873179507},
+    {-28.274222019542705, 168.67648107038116, 343.41944928670347,
+     6.0730132388671425, -555.0009107111099},
+    {-28.274206040576217, 168.68196464122403, 342.9346012151131,
+     6.0644426358598507, -518.93800940894914},
+    {-28.27419006160973, 168.68744070895852, 342.47939611908436,
+     6.0563962287304864, -489.06612181975061},
+    {-28.274174082643238, 168.69290970679043, 342.04900806397387,
+     6.048788676623956, -463.79508517670246},
+    {-28.274142124710259, 168.70382790602338, 341.24892277553636,
+     6.0346468032588154, -423.08943941177751},
+    {-28.27411016677728, 168.71472161500867, 340.51363251990216,
+     6.021650734742015, -391.45257731912471},
+    {-28.274078208844301, 168.72559267478073, 339.82964140403442,
+     6.0095618130131232, -365.95056406489368},
+    {-28.274046250911322, 168.73644256654711, 339.18757497626416,
+     5.9982142627592889, -344.82669553218284},
+    {-28.274014292978343, 168.7472725156758, 338.58060765818936,
+     5.9874873824031685, -326.9564088598143},
+    {-28.273950377112385, 168.76887658368864, 337.45250862737771,
+     5.9675514762971318, -298.17178328859609},
+    {-28.273886461246427, 168.79041159984726, 336.41604957690788,
+     5.9492360563521434, -275.80019187934437},
+    {-28.273822545380469, 168.81188277172444, 335.452143086033,
+     5.9322035877465922, -257.76684752765681},
+    {-28.273758629514511, 168.83329428907032, 334.54753083656499,
+     5.9162196158691183, -242.8294787104482},
+    {-28.273694713648553, 168.85464961797231, 333.69255943845434,
+     5.9011134345553184, -230.19284622412383},
+    {-28.273630797782594, 168.87595168808818, 332.87994130463665,
+     5.8867561737197063, -219.32113264972074},
+    {-28.273566881916636, 168.89720301830101, 332.10401466604048,
+     5.8730477136658941, -209.83838182664385},
+    {-28.27343905018472, 168.93956198396293, 330.64507760918292,
+     5.8472737791517924, -194.01878283670743},
+    {-28.273311218452804, 168.98174124527463, 329.28875326056146,
+     5.8233142682921502, -181.26688653618223},
+    {-28.273183386720888, 169.02375265359169, 328.01629063713347,
+     5.8008376020224421, -170.70423937667894},
+    {-28.273055554988971, 169.06560601334235, 326.81403714061139,
+     5.7796023585951408, -161.76850232000072},
+    {-28.272927723257055, 169.10730961162977, 325.67168607756133,
+     5.7594262834277812, -154.08078296899043},
+    {-28.272799891525136, 169.14887057366744, 324.58123011076992,
+     5.7401677823932857, -147.37523222981974},
+    {-28.272672059793216, 169.19029511147093, 323.53630137859346,
+     5.7217142528013287, -141.45907732522471},
+    {-28.2725442280613, 169.23158870381926, 322.53173680683926,
+     5.7039743965935221, -136.18867084629343},
+    {-28.272288564597467, 169.3138020724692, 320.62737855513399,
+     5.6703470931006148, -127.17135052604011},
+    {-28.272032901133635, 169.3955442049124, 318.84163599829049,
+     5.6388169381605691, -119.70209612522177},
+    {-28.271777237669799, 169.47684283653538, 317.1552003022407,
+     5.6090425026350603, -113.38326512607847},
+    {-28.271521574205963, 169.55772141081019, 315.55349467264068,
+     5.5807660341943119, -107.94693452619265},
+    {-28.27126591074213, 169.63820008467275, 314.02519425001873,
+     5.5537872842598768, -103.20511682434514},
+    {-28.271010247278298, 169.71829643197739, 312.56129285829883,
+     5.5279470051550366, -99.021498389637443},
+    {-28.270754583814462, 169.79802595250371, 311.15448823654935,
+     5.5031160790927585, -95.294503188313868},
+    {-28.270498920350626, 169.87740245067323, 309.79876220296558,
+     5.4791880942001301, -91.946681571636077},
+    {-28.270243256886793, 169.95643832393964, 308.48908514053704,
+     5.456074118948151, -88.917809540360764},
+    {-28.269731929959125, 170.11353204798436, 305.99147753412933,
+     5.4119982158347222, -83.635790234734358},
+    {-28.269220603031457, 170.26938559574938, 303.63435584168269,
+     5.3704055040187839, -79.167264048391104},
+    {-28.268709276103792, 170.42406529769525, 301.3971030566189,
+     5.3309314569837296, -75.322777009891652},
+    {-28.268197949176123, 170.57762818747091, 299.26370144293196,
+     5.293292872453053, -71.96939912890079},
+    {-28.267686622248455, 170.73012399170477, 297.22141264109666,
+     5.2572645334048076, -69.010740040710544},
+    {-28.26717529532079, 170.88159656986542, 295.25990819989437,
+     5.2226638338491904, -66.374973036104052},
+    {-28.266663968393122, 171.03208498549637, 293.37067579875736,
+     5.1893402795390902, -64.007331665923473},
+    {-28.266152641465453, 171.18162432200097, 291.54660129774891,
+     5.1571680977562595, -61.86523009584743},
+    {-28.265641314537785, 171.33024631637096, 289.78166687969002,
+     5.1260408998865961, -59.914987604585164},
+    {-28.265129987610116, 171.47797986000671, 288.07072814773039,
+     5.0958677401095418, -58.129569067887665},
+    {-28.264107333754783, 171.77088526791997, 284.79365970109092,
+     5.0380798575756245, -54.969159461440725},
+    {-28.26308467989945, 172.06052828381812, 281.68623280617464,
+     4.9832889084203247, -52.250033181650252},
+    {-28.262062026044113, 172.34707034444833, 278.72578955659969,
+     4.9310943642354852, -49.878191565816302},
+    {-28.261039372188776, 172.63065221404017, 275.89431048453031,
+     4.8811777028277552, -47.78547401703625},
+    {-28.260016718333443, 172.91139805746153, 273.17718480714416,
+     4.8332806652220199, -45.92108952985658},
+    {-28.258994064478109, 173.18941847065292, 270.56237059480412,
+     4.7871904070163671, -44.24631086681606},
+    {-28.257971410622773, 173.46481278844772, 268.0398036219388,
+     4.7427290467350556, -42.731024044916701},
+    {-28.256948756767436, 173.73767087738662, 265.6009704149177,
+     4.6997461173387878, -41.351412147393027},
+    {-28.255926102912102, 174.00807455252578, 263.23859297244974,
+     4.658112992186088, -40.088357562021102},
+    {-28.254903449056769, 174.2760987139923, 260.9463914067494,
+     4.6177186886734969, -38.926313320566258},
+    {-28.253880795201432, 174.54181227075358, 258.71890218546781,
+     4.5784666549136137, -37.852489002303933},
+    {-28.251835487490762, 175.06655767977844, 254.43947063452526,
+     4.5030608851447012, -35.928683610989644},
+    {-28.249790179780092, 175.58276809130336, 250.36823998155029,
+     4.431329195512971, -34.250470431605287},
+    {-28.247744872069422, 176.09084231724751, 246.47971357993214,
+     4.3628210799872447, -32.769649585233168},
+    {-28.245699564358752, 176.59113219396949, 242.75321695511622,
+     4.2971712632217702, -31.450303936712679},
+    {-28.243654256648082, 177.08395115650097, 239.17170981673615,
+     4.2340787003586682, -30.265047163444549},
+    {-28.241608948937412, 177.5695807684375, 235.72094982974988,
+     4.1732917953780193, -29.192583770949859},
+    {-28.239563641226741, 178.04827579476583, 232.38888864381192,
+     4.1145977253088466, -28.216071226576869},
+    {-28.237518333516071, 178.52026821090186, 229.16522588716157,
+     4.0578145568684336, -27.32199011715257},
+    {-28.235473025805401, 178.98577041874756, 226.04107338353833,
+     4.0027853115290712, -26.499346024797838},
+    {-28.233427718094731, 179.44497786077835, 223.00869802047481,
+     3.9493734208820332, -25.739093842754677},
+    {-28.231382410384061, 179.89807116976058, 220.06132185896428,
+     3.8974591938158398, -25.03371479125633},
+    {-28.229337102673391, 180.34521795508974, 217.19296463939119,
+     3.8469370330843238, -24.376900463634769},
+    {-28.225246487252047, 181.22228603465936, 211.67264514436073,
+     3.7497041033806884, -23.188402566446292},
+    {-28.221155871830703, 182.07731401263146, 206.41164406131404,
+     3.6570373835634844, -22.139513441059908},
+    {-28.217065256409363, 182.91130079002443, 201.38068990677579,
+     3.5684201754651501, -21.204832395778674},
+    {-28.212974640988023, 183.72513652364307, 196.55565431383596,
+     3.4834266293260407, -20.364991541556396},
+    {-28.208884025566682, 184.51962110883778, 191.91636881271236,
+     3.4017008372038391, -19.604930322134379},
+    {-28.204793410145342, 185.2954785388381, 187.44577021102987,
+     3.3229417334360818, -18.912737266509765},
+    {-28.200702794724002, 186.05336825351463, 183.12926946957057,
+     3.2468919445481297, -18.278850995146158},
+    {-28.196612179302662, 186.79389424386855, 178.9542765314439,
+     3.1733293949193451, -17.695495804851319},
+    {-28.192521563881321, 187.51761245278894, 174.90983643760123,
+     3.1020608788269208, -17.156274555675871},
+    {-28.188430948459981, 188.22503686143875, 170.98634643751174,
+     3.032917063566698, -16.655869542633894},
+    {-28.184340333038641, 188.91664454712063, 167.17533309132614,
+     2.9657485524924199, -16.189819056320186},
+    {-28.180249717617301, 189.59287992592624, 163.46927450883973,
+     2.9004227454848368, -15.75434799217186},
+    {-28.176159102195957, 190.25415834177034, 159.86145703145365,
+     2.8368213078942079, -15.346237706924462},
+    {-28.172068486774613, 190.90086912589206, 156.34585853466149,
+     2.7748381097408257, -14.962724809101777},
+    {-28.167977871353273, 191.53337822327032, 152.91705254540767,
+     2.7143775325974628, -14.601421576045176},
+    {-28.163887255931932, 192.15203046175682, 149.57012880832238,
+     2.6553530670170473, -14.260252739968436},
+    {-28.159796640510592, 192.75715152410001, 146.30062697763614,
+     2.5976861417949402, -13.937404807206349},
+    {-28.151615409667912, 193.92801725499316, 139.97797133869707,
+     2.4861445658039472, -13.340488232640135},
+    {-28.143434178825231, 195.04825845817516, 133.92048524692379,
+     2.379249177552111, -12.800019085298327},
+    {-28.135252947982551, 196.11994288521618, 128.10396696711615,
+     2.2765739338466102, -12.307571852287882},
+    {-28.127071717139867, 197.14495514991521, 122.50771980193463,
+     2.1777546030019503, -11.856383196213701},
+    {-28.118890486297182, 198.12502252564144, 117.11387924521958,
+     2.0824768904429423, -11.440952774598843},
+    {-28.110709255454502, 199.06173591744522, 111.90689767777056,
+     1.9904673457510955, -11.056755307112864},
+    {-28.102528024611821, 199.9565671114604, 106.87314373080473,
+     1.9014862939947368, -10.700029013042123},
+    {-28.094346793769141, 200.81088311093396, 102.00058658666387,
+     1.8153222663515691, -10.367617578849178},
+    {-28.08616556292646, 201.62595816291721, 97.278544189028466,
+     1.7317875587373781, -10.056850351382822},
+    {-28.077984332083776, 202.40298393326236, 92.697480224172764,
+     1.6507146511626627, -9.7654502887568899},
+    {-28.069803101241092, 203.14307818134546, 88.248838798959852,
+     1.5719532923096631, -9.4914623750934233},
+    {-28.061621870398412, 203.84729220764407, 83.924908596131829,
+     1.4953681042338891, -9.2331973309901478},
+    {-28.053440639555731, 204.51661728889377, 79.718710325324793,
+     1.4208365980770348, -8.9891869013628636},
+    {-28.045259408713051, 205.15199027129481, 75.623902764423804,
+     1.3482475177414317, -8.7581480077671223},
+    {-28.03707817787037, 205.75429845842103, 71.634703769574557,
+     1.2774994476085553, -8.5389537603310828},
+    {-28.028896947027686, 206.32438390429391, 67.74582343775991,
+     1.2084996346055636, -8.3306098300711788},
+    {-28.020715716185002, 206.8630472016531, 63.952407211402409,
+     1.141162985613229, -8.1322350481633183},
+    {-28.012534485342321, 207.37105083931269, 60.24998717457855,
+     1.0754112093303199, -7.9430453665750758},
+    {-28.004353254499641, 207.84912218971959, 56.634440143456352,
+     1.0111720779403561, -7.7623405127550438},
+    {-27.996172023656957, 208.29795617750901, 53.101951426876035,
+     0.94837878875019987, -7.5894928194090081},
+    {-27.987990792814273, 208.71821767160711, 49.648983346431734,
+     0.88696940973659988, -7.4239378224303056},
+    {-27.979809561971592, 209.11054363667913, 46.272247773382347,
+     0.82688639590086221, -7.2651663054434295},
+    {-27.971628331128912, 209.47554507421788, 42.968682072943693,
+     0.76807616568258463, -7.112717535055495},
+    {-27.963447100286231, 209.8138087790029, 39.735427952907166,
+     0.71048872856058642, -6.9661734817640113},
+    {-27.955265869443551, 210.1258989329576, 36.569812799001163,
+     0.65407735647711596, -6.8251538611626348},
+    {-27.947084638600867, 210.41235855527287, 33.469333148597727,
+     0.59879829294196685, -6.6893118612931186},
+    {-27.938903407758183, 210.67371082504985, 30.431640010639075,
+     0.54461049466581246, -6.5583304466857673},
+    {-27.930722176915502, 210.91046029054914, 27.454525785682076,
+     0.49147540138387474, -6.4319191492965295},
+    {-27.922540946072822, 211.12309397725539, 24.535912577825581,
+     0.43935673019894783, -6.309811272304044},
+    {-27.914359715230141, 211.31208240538987, 21.673841721593739,
+     0.38822029132497776, -6.1917614454238787},
+    {-27.906178484387461, 211.47788052619882, 18.8664643728108,
+     0.33803382257025866, -6.0775434806784432},
+    {-27.897997253544776, 211.62092858516297, 16.112033034211358,
+     0.28876684028213045, -5.9669484859334654},
+    {-27.889816022702092, 211.74165291931561, 13.408893904676461,
+     0.24039050479504284, -5.8597832003604591},
+    {-27.881634791859412, 211.84046669500552, 10.755479956276073,
+     0.19287749869344722, -5.7558685216148229},
+    {-27.873453561016731, 211.9177705917202, 8.1503046561993227,
+     0.14620191642843605, -5.6550381991669108},
+    {-27.865272330174051, 211.97395343692025, 5.5919562616078347,
+     0.10033916402016564, -5.5571376720780226},
+    {-27.85709109933137, 212.00939279633977, 3.0790926247311172,
+     0.055265867741751074, -5.4620230327205679},
+    {-27.848909868488686, 212.02445552368064, 0.61043645349450903,
+     0.010959790820846884, -5.369560100623846},
+    {-27.844819253067342, 212.02445748989064, -0.60769632598898482,
+     -0.010912197354666649, -5.3242835472246473},
+    {-27.840728637646002, 212.01949827322414, -1.8152290202443717,
+     -0.032600242685276455, -5.2796235928755948},
+    {-27.832547406803322, 211.99486797853569, -4.1990640069167737,
+     -0.075434417582099664, -5.1920963794031811},
+    {-27.824366175960641, 211.95090230008367, -6.5421757969563545,
+     -0.11756199144993613, -5.1068688130575204},
+    {-27.816184945117961, 211.88793004432262, -8.8456221026703421,
+     -0.15900135335098936, -5.0238381257792701},
+    {-27.80800371427528, 211.80627155656083, -11.110414133183724,
+     -0.19977007784057826, -4.9429078832781386},
+    {-27.799822483432596, 211.70623908965754, -13.337519428071117,
+     -0.23988497473355558, -4.8639874916400645},
+    {-27.783460021747231, 211.45226282566875, -17.682337113723051,
+     -0.3182169733338176, -4.7118404450793925},
+    {-27.76709756006187, 211.12835008871139, -21.887036644124876,
+     -0.3941181932461959, -4.5667730426284532},
+    {-27.750735098376506, 210.73674039883471, -25.958029050213288,
+     -0.46769984575529144, -4.4282300796800049},
+    {-27.734372636691141, 210.27957246739737, -29.901234458770851,
+     -0.53906455448739921, -4.2957156470202493},
+    {-27.71801017500578, 209.75889179809454, -33.722133593170021,
+     -0.60830725907551531, -4.1687852263142835},
+    {-27.701647713320416, 209.17665750218083, -37.425812517280988,
+     -0.67551600006963985, -4.0470390366502436},
+    {-27.685285251635051, 208.53474842952383, -41.017001676159424,
+     -0.74077260362952235, -3.9301164046565207},
+    {-27.66892278994969, 207.83496870151228, -44.50011009827,
+     -0.80415328121183638, -3.8176909771381502},
+    {-27.652560328264325, 207.07905271895328, -47.879255473095945,
+     -0.86572915680718077, -3.7094666311558933},
+    {-27.636197866578961, 206.26866970746801, -51.158290696712271,
+     -0.92556673214767859, -3.6051739645540617},
+    {-27.6198354048936, 205.40542785399631, -54.340827379828383,
+     -0.98372829857994804, -3.5045672720188925},
+    {-27.603472943208235, 204.49087808062487, -57.430256732940911,
+     -1.0402723028928047, -3.4074219292216963},
+    {-27.58711048152287, 203.52651749573337, -60.429768177949903,
+     -1.095253673240338, -3.3135321215136058},
+    {-27.554385558152145, 201.45410197756493, -66.170884163904816,
+     -1.200732348472342, -3.1347782750888036},
+    {-27.521660634781419, 199.19919585751552, -71.586245539272468,
+     -1.3005437151710779, -2.9669661377147909},
+    {-27.48893571141069, 196.77213051206391, -76.695596521378093,
+     -1.3950266632102031, -2.8089533281463259},
+    {-27.456210788039961, 194.18262460450617, -81.51668946272126,
+     -1.4844854246644672, -2.6597588283232114},
+    {-27.423485864669235, 191.43984463079934, -86.065559526848432,
+     -1.5691943750617443, -2.518534790957347},
+    {-27.39076094129851, 188.55245727504433, -90.356752369288515,
+     -1.6494020111915333, -2.3845441439655635},
+    {-27.35803601792778, 185.52867495052504, -94.403514302233219,
+     -1.7253342718090288, -2.2571426336512497},
+    {-27.325311094557055, 182.37629562954814, -98.217952240673455,
+     -1.7971973292600052, -2.1357643029329041},
+    {-27.292586171186329, 179.10273785424786, -101.81116910623074,
+     -1.86517995157447, -2.0199096540178836},
+    {-27.2598612478156, 175.71507165575468, -105.1933791455632,
+     -1.9294555131675992, -1.9091359280346647},
+    {-27.227136324444874, 172.22004597900613, -108.37400669361138,
+     -1.9901837160214275, -1.8030490682130165},
+    {-27.194411401074149, 168.6241131071703, -111.36177120080693,
+     -2.0475120707412748, -1.7012970324709842},
+    {-27.161686477703419, 164.93345049674423, -114.16476079263627,
+     -2.1015771772189522, -1.6035641955299968},
+    {-27.128961554332694, 161.15398036749767, -116.79049619979877,
+     -2.1525058370902972, -1.5095666367731992},
+    {-27.096236630961968, 157.29138733701146, -119.24598655854267,
+     -2.2004160242364477, -1.4190481528165939},
+    {-27.063511707591239, 153.35113434509665, -121.53777831213996,
+     -2.245417734869362, -1.331776866627326},
+    {-27.030786784220513, 149.33847707666894, -123.67199822990874,
+     -2.2876137349820591, -1.2475423304867708},
+    {-26.965336937479059, 141.11601360299312, -127.49035481404582,
+     -2.363967398398187, -1.0874342917693709},
+    {-26.899887090737604, 132.66236686475324, -130.74301652148293,
+     -2.4301777936923288, -0.93738273931372473},
+    {-26.834437243996149, 124.01331830951248, -133.46725710600219,
+     -2.4868652152536521, -0.79626145674460913},
+    {-26.768987397254694, 115.20234290046203, -135.69639238151089,
+     -2.5345820962100962, -0.66311680207168056},
+    {-26.703537550513239, 106.26084824748175, -137.4603683371102,
+     -2.5738231887270722, -0.53713504320863981},
+    {-26.638087703771784, 97.218378948880897, -138.78624063661493,
+     -2.6050338556578083, -0.41761695044909675},
+    {-26.57263785703033, 88.10279244273498, -139.69856911099291,
+     -2.628616885207594, -0.30395781393238963},
+    {-26.507188010288878, 78.940411323204472, -140.21974501127141,
+     -2.6449381382296098, -0.19563156788899455},
+    {-26.441738163547424, 69.756156060100054, -140.37026455597473,
+     -2.6543312638480239, -0.092178059789469149},
+    {-26.376288316805969, 60.573661281082849, -140.16895919727125,
+     -2.6571016648305461, 0.0068072465261243276},
+    {-26.310838470064517, 51.415378172909676, -139.63319071713164,
+     -2.6535298537901224, 0.10168166542667492},
+    {-26.245388623323063, 42.302665086893107, -138.77901752494898,
+     -2.6438743109641458, 0.192762183783284},
+    {-26.179938776581608, 33.255868061925042, -137.62133720544267,
+     -2.6283739312741869, 0.28033116202572878},
+    {-26.114488929840153, 24.294392682621076, -136.17400935027695,
+     -2.6072501306865603, 0.3646410787002422},
+    {-26.081764006469427, 19.851473678847153, -135.34580136183808,
+     -2.5946443140936779, 0.40564560861482718},
+    {-26.049039083098698, 15.436768453016489, -134.44996192021634,
+     -2.5807086682028708, 0.44591850266476774},
+    {-26.016314159727973, 11.052465798882386, -133.48797662724277,
+     -2.5654667261413198, 0.48548458192783839},
+    {-25.983589236357247, 6.7007066745948967, -132.46128377002972,
+     -2.5489412291178919, 0.52436743732319169},
+    {-25.950864312986518, 2.3835857133503278, -131.37127660246099,
+     -2.5311541653878411, 0.56258950754168424},
+    {-25.934501851301157, 0.23865680513643342, -130.80295375952764,
+     -2.5217942204848085, 0.58145946306211349},
+    {-25.918139389615792, -1.8968473382816462, -130.21930548432005,
+     -2.5121268067663247, 0.60017215101227839},
+    {-25.885414466245066, -6.1385862498446091, -129.00667988882731,
+     -2.4918797428770896, 0.63713571243696743},
+    {-25.852689542874337, -10.339667000157785, -127.73467028840034,
+     -2.4704329133060603, 0.67349958437240098},
+    {-25.819964619503612, -14.498166530324209, -126.40450992760215,
+     -2.4478056378148567, 0.70928226428858432},
+    {-25.787239696132886, -18.612201553026257, -125.01739649145955,
+     -2.424016644755651, 0.7445014074924452},
+    {-25.721789849391431, -26.69953700827201, -122.07693267244866,
+     -2.3730256212192979, 0.81331578553543227},
+    {-25.656340002649976, -34.587360491051363, -118.92220661936258,
+     -2.3175988197669546, 0.88006890047854835},
+    {-25.590890155908522, -42.261927606854812, -115.56166886997461,
+     -2.2578673146172936, 0.9448762678381174},
+    {-25.525440309167067, -49.710032500934361, -112.00333156896014,
+     -2.1939549369641211, 1.0078438802701211},
+    {-25.459990462425615, -56.918980324447197, -108.25480324680773,
+     -2.1259788648894511, 1.0690692043447716},
+    {-25.394540615684161, -63.876561857654508, -104.32332003530126,
+     -2.0540501522376262, 1.128642052287687},
+    {-25.329090768942706, -70.571030071733759, -100.2157737590823,
+     -1.978274204022396, 1.1866453468296541},
+    {-25.263640922201255, -76.991078437371172, -95.93873727995171,
+     -1.8987512048519182, 1.2431557943348222},
+    {-25.1981910754598, -83.12582081119703, -91.498487417883481,
+     -1.8155765059459508, 1.29824447894484},
+    {-25.132741228718345, -88.96477275082411, -86.901025728384852,
+     -1.728840975553553, 1.3519773884771862},
+    {-25.06729138197689, -94.497834126311048, -82.152097378349822,
+     -1.638631316932317, 1.404415881165064},
+    {-25.001841535235435, -99.715272910636358, -77.257208330771803,
+     -1.5450303575017097, 1.4556171009572605},
+    {-24.936391688493984, -104.60771004462809, -72.221641021617756,
+     -1.448117312316318, 1.5056343479565963},
+    {-24.870941841752529, -109.1661052830285, -67.05046868904779,
+     -1.3479680246062424, 1.5545174096230123},
+    {-24.805491995011074, -113.3817439381706, -61.748568495364701,
+     -1.2446551857907855, 1.6023128575679926},
+    {-24.740042148269623, -117.24622444639566, -56.320633565031962,
+     -1.1382485370780009, 1.6490643140942858},
+    {-24.609142454786713, -123.88960101322425, -45.104577300294444,
+     -0.91641911909695928, 1.739596411214714},
+    {-24.543692608045259, -126.65315788019174, -39.325017278832938,
+     -0.8011226734876572, 1.7834515935689199},
+    {-24.478242761303804, -129.03485812094294, -33.436563205804362,
+     -0.68298536647128594, 1.8264122403621275},
+    {-24.412792914562353, -131.02770372512529, -27.443137589669924,
+     -0.56206468644765251, 1.8685103924539073},
+    {-24.347343067820898, -132.62494914003051, -21.348533650480125,
+     -0.43841608488886402, 1.9097762760595933},
+    {-24.281893221079443, -133.82009303686596, -15.156422206848607,
+     -0.31209309070042179, 1.9502384353547155},
+    {-24.216443374337992, -134.60687051145254, -8.8703580717185488,
+     -0.18314741629479767, 1.9899238533326338},
+    {-24.150993527596537, -134.97924568864798, -2.4937859996934524,
+     -0.051629056105784756, 2.0288580621290286},
+    {-24.118268604225811, -135.0082070950146, 0.72739275037932116,
+     0.015079704980395509, 2.0480510701577006},
+    {-24.085543680855082, -134.93140470237643, 3.9699537756514012,
+     0.082413621802670894, 2.0670652438842612},
+    {-24.020093834113627, -134.45774902563559, 10.517620379924075,
+     0.21893379044562317, 2.1045683230908181},
+    {-23.954643987372172, -133.55288912689804, 17.146067480385959,
+     0.35788608441487602, 2.1413890512651075},
+    {-23.889194140630721, -132.21163843133439, 23.852238784620624,
+     0.49922652568787901, 2.1775480846887674},
+    {-23.823744293889266, -130.42900756700507, 30.633163829975377,
+     0.64291245431627453, 2.2130650558822831},
+    {-23.69284460040636, -125.5206011858748, 44.407799032212495,
+     0.93715633941757359, 2.282246612484137},
+    {-23.561944906923451, -118.79149667900531, 58.447782175508593,
+     1.2403004592022087, 2.3490726812538703},
+    {-23.431045213440541, -110.20834948037519, 72.732067356235476,
+     1.5520448766518284, 2.4136695571112918},
+    {-23.300145519957631, -99.740500247268216, 87.240658345959773,
+     1.8721054396684818, 2.4761523490081556},
+    {-23.169245826474722, -87.359843101582214, 101.95452402936259,
+     2.2002124020986167, 2.5366262509970063},
+    {-23.038346132991816, -73.040704317426872, 116.85552313357515,
+     2.5361091993976395, 2.595187638985526},
+    {-22.907446439508909, -56.759730322417546, 131.92633700592518,
+     2.8795513579896297, 2.6519250208598226},
+    {-22.841996592767455, -47.876865877712937, 139.52022238705916,
+     3.0540286139267696, 2.6796354223612884},
+    {-22.776546746026, -38.495784029762007, 147.15040939067973,
+     3.2303055206635789, 2.706919862698236},
+    {-22.711096899284545, -28.61417318892352, 154.81493873331669,
+     3.4083545022035846, 2.73378754310288},
+    {-22.64564705254309, -18.22984864475956, 162.51189231484915,
+     3.5881485730521261, 2.7602473098205929},
+    {-22.580197205801639, -7.3407499170848203, 170.23939180943037,
+     3.7696613155727876, 2.7863076719556901},
+    {-22.54747228243091, -1.7062996720571519, 174.11401984187418,
+     3.8610540831564655, 2.7991906473541674},
+    {-22.514747359060184, 4.0550618030230083, 177.99559732514518,
+     3.9528668584752689, 2.8119768182129614},
+    {-22.449297512318729, 15.959406126629037, 185.77870612823151,
+     4.1377398563649512, 2.8372626326152339},
+    {-22.383847665577278, 28.373985858853015, 193.58695142801159,
+     4.3242554702897857, 2.8621727092706486},
+    {-22.318397818835823, 41.300389313143249, 201.41860121893995,
+     4.5123893492244953, 2.8867143662572512},
+    {-22.252947972094368, 54.7400925515363, 209.27195717642147,
+     4.7021176124361723, 2.9108946586869111},
+    {-22.122048278611459, 83.164754322375487, 225.03715642416202,
+     5.0862640201752374, 2.9581981285833878},
+    {-22.056598431870007, 98.152122915037694, 232.9457622246083,
+     5.2806366073206563, 2.9813342086398986},
+    {-22.023873508499278, 105.84004218339815, 236.90587333229803,
+     5.378387985221428, 2.9927760476434639},
+    {-22.007511046813917, 109.73261471814133, 238.88729577530833,
+     5.4274037456383022, 2.9984657450358734},
+    {-21.991148585128553, 113.65761542669317, 240.86959733298272,
+     5.4765124340951896, 3.0039223711389473},
+    {-21.991148565128551, 113.6576202437799, 240.82378168839787,
+     5.4754707553172794, -52083.930404263374},
+    {-21.991146567757738, 113.65810048150041, 240.22068367111868,
+     5.4617589612930324, -3673.3302223019855},
+    {-21.991144570386929, 113.65858000889082, 239.95317977139766,
+     5.4556773751220842, -2599.8002230221223},
+    {-21.991142573016116, 113.65905907237907, 239.74781989744633,
+     5.4510087209298783, -2123.0615742663163},
+    {-21.991140575645304, 113.65953776062705, 239.57467976739011,
+     5.4470726277997992, -1838.6062265714916},
+    {-21.991138578274494, 113.66001612493183, 239.42214425005901,
+     5.4436050093056378, -1644.3880850223452},
+    {-21.991136580903682, 113.66049419992954, 239.28425069311751,
+     5.4404702961306564, -1500.9776045995684},
+    {-21.991134583532869, 113.66097201105184, 239.15745500193196,
+     5.4375879082886183, -1389.495222537186},
+    {-21.99113258616206, 113.66144957800591, 239.03944713007576,
+     5.434905323623294, -1299.6178412148865},
+    {-21.991128591420438, 113.66240404011543, 238.82381101519829,
+     5.430003513061453, -1162.169095345864},
+    {-21.991124596678816, 113.66335768429607, 238.62889760600075,
+     5.4255728613815277, -1060.6928453325283},
+    {-21.991120601937194, 113.66431058253302, 238.44968891610046,
+     5.4214992776469852, -981.81711027215511},
+    {-21.991116607195572, 113.66526279060466, 238.28291483089464,
+     5.4177084112438294, -918.23224253356864},
+    {-21.991108617712328, 113.66716530803097, 237.97820105181324,
+     5.4107822663414558, -821.000278366266},
+    {-21.991100628229081, 113.6690655139852, 237.70280489421961,
+     5.404522695628299, -749.2210187634513},
+    {-21.991092638745833, 113.67096361214513, 237.44962568458692,
+     5.398768255521496, -693.43121333310626},
+    {-21.991084649262589, 113.67285976032264, 237.21403650182248,
+     5.3934137466424783, -648.45857898598376},
+    {-21.991068670296102, 113.67664669270643, 236.78364566619655,
+     5.3836320830107329, -579.69062018270313},
+    {-21.99105269132961, 113.68042709595755, 236.39472440592104,
+     5.3747932789757753, -528.92621736518822},
+    {-21.991036712363119, 113.68420154625635, 236.03722788379733,
+     5.3666689517893396, -489.47106925837721},
+    {-21.991020733396631, 113.68797049004253, 235.70461101724871,
+     5.3591102903944847, -457.66655127360661},
+    {-21.991004754430143, 113.69173428650562, 235.39232741785514,
+     5.3520139267496356, -431.32199591689448},
+    {-21.990988775463652, 113.69549323279541, 235.09706680011325,
+     5.3453045972726283, -409.03501117278114},
+    {-21.990956817530673, 113.70299754428444, 234.54817581174868,
+     5.3328324401231235, -373.13595894202405},
+    {-21.990924859597694, 113.71048505435944, 234.04373035533152,
+     5.3213707893050648, -345.2348259690022},
+    {-21.990892901664715, 113.71795702586431, 233.57447309450345,
+     5.3107091680852534, -322.74412414812582},
+    {-21.990860943731736, 113.72541447481879, 233.13397374053457,
+     5.3007013762912036, -304.11458551557968},
+    {-21.990828985798757, 113.73285824175512, 232.71755037083182,
+     5.2912409650658514, -288.35443844831775},
+    {-21.990765069932799, 113.74770747174847, 231.94358204455875,
+     5.2736587678272064, -262.96871870035079},
+    {-21.990701154066841, 113.76250932609878, 231.23247372910691,
+     5.2575057090970478, -243.2387688819031},
+    {-21.990637238200883, 113.77726737691651, 230.57113261682704,
+     5.2424841108354059, -227.3347976314395},
+    {-21.990573322334924, 113.79198449815169, 229.9504643018148,
+     5.2283872032627619, -214.16122366126936},
+    {-21.990509406468966, 113.80666306736724, 229.36384713583109,
+     5.2150644374877224, -203.01671134538898},
+    {-21.990445490603008, 113.82130509416109, 228.8062822659725,
+     5.2024021606053035, -193.42871370748054},
+    {-21.99038157473705, 113.8359123063718, 228.27388605093859,
+     5.1903120751934511, -185.06566824439366},
+    {-21.990253743005134, 113.86502813475799, 227.27283001089447,
+     5.167580889856433, -171.11400816813742},
+    {-21.990125911273218, 113.89402065688267, 226.34216198970657,
+     5.1464498862571872, -159.86781362595616},
+    {-21.989998079541301, 113.92289800229543, 225.46901986797002,
+     5.1266266384474637, -150.55236030064654},
+    {-21.989870247809385, 113.95166689647208, 224.64403871609611,
+     5.1078982318796307, -142.67171096972916},
+    {-21.989742416077469, 113.98033302408172, 223.86014869922897,
+     5.0901039326308117, -135.89171333862706},
+    {-21.989614584345549, 114.00890127280346, 223.11185720769026,
+     5.0731188659969524, -129.97791007107787},
+    {-21.98948675261363, 114.03737590391037, 222.39479621825762,
+     5.0568437253730849, -124.76029118160939},
+    {-21.989358920881713, 114.06576067571025, 221.70542412370256,
+     5.0411979931157713, -120.112171258177},
+    {-21.989103257417881, 114.12227368893414, 220.39855081405756,
+     5.0115402213982403, -112.15953181584847},
+    {-21.988847593954048, 114.17846331026702, 219.17304627377067,
+     4.9837319881655251, -105.57216519318713},
+    {-21.988591930490212, 114.23434856589628, 218.01566552718262,
+     4.9574721795822194, -99.999382511693568},
+    {-21.988336267026376, 114.28994553794648, 216.91640952857148,
+     4.9325334780753396, -95.204897031749042},
+    {-21.988080603562544, 114.34526805412017, 215.86750989257339,
+     4.9087392798077651, -91.022918691527806},
+    {-21.987824940098712, 114.40032817022664, 214.86278873471267,
+     4.8859491404916575, -87.333229636379642},
+    {-21.987569276634876, 114.45513651934151, 213.89723697338917,
+     4.8640491880266046, -84.046247793287606},
+    {-21.98731361317104, 114.50970257158301, 212.96672634452617,
+     4.842945575146409, -81.093668636804821},
+    {-21.987057949707207, 114.56403483194076, 212.06780669404623,
+     4.8225598708823672, -78.422379294732934},
+    {-21.986546622779539, 114.67202806113686, 210.35349014485027,
+     4.7836864459403081, -73.763932732010559},
+    {-21.98603529585187, 114.77917004139547, 208.73555369806041,
+     4.7470030610167075, -69.822927961776941},
+    {-21.985523968924205, 114.88550627900081, 207.19985455458141,
+     4.7121882300247062, -66.432281068200936},
+    {-21.985012641996537, 114.99107590281589, 205.73540483918626,
+     4.678992188664548, -63.474757872856891},
+    {-21.984501315068869, 115.09591302920478, 204.33346621245363,
+     4.6472163112564449, -60.865349311959484},
+    {-21.983989988141204, 115.20004774972617, 202.98695345291594,
+     4.6166995518650831, -58.540709571976485},
+    {-21.983478661213535, 115.30350686596906, 201.69002714995472,
+     4.5873091847334821, -56.452538681837154},
+    {-21.982967334285867, 115.40631444915752, 200.4378070064414,
+     4.5589342866790181, -54.563279045637117},
+    {-21.982456007358198, 115.5084922748746, 199.22616477546217,
+     4.5314810298898154, -52.843226703732832},
+    {-21.98194468043053, 115.61006016660207, 198.05157135709916,
+     4.5048692059855595, -51.268538613772485},
+    {-21.980922026575197, 115.81143728347594, 195.80174658275965,
+     4.4539020325451544, -48.481133984099415},
+    {-21.979899372719863, 116.01057461936927, 193.66832620268187,
+     4.4055780902038935, -46.082914679933275},
+    {-21.978876718864527, 116.20758295055023, 191.6357662567236,
+     4.3595441365809684, -43.990980334751079},
+    {-21.97785406500919, 116.4025588712601, 189.69170472310861,
+     4.3155192531994206, -42.145217888177413},
+    {-21.976831411153857, 116.5955875879023, 187.82611793389088,
+     4.2732756697256153, -40.500833020982348},
+    {-21.975808757298523, 116.78674499790857, 186.03074446508163,
+     4.2326256685160173, -39.023670809004813},
+    {-21.974786103443186, 116.97609927292631, 184.29867961649097,
+     4.1934123669948615, -37.687172621344942},
+    {-21.97376344958785, 117.16371208870984, 182.62408252677932,
+     4.1555030604055379, -36.470333409098352},
+    {-21.972740795732516, 117.3496395970773, 181.0019598935788,
+     4.1187843058871492, -35.356292593381482},
+    {-21.971718141877183, 117.53393320560811, 179.42800314587825,
+     4.0831582215661122, -34.331338666274789},
+    {-21.970695488021846, 117.7166402113813, 177.89846375769261,
+     4.0485396526177491, -33.384191214461758},
+    {-21.968650180311176, 118.07746608926634, 174.95988217269553,
+     3.9820353261735377, -31.68731784846036},
+    {-21.966604872600506, 118.43243114035015, 172.16421924583881,
+     3.9187717046930528, -30.207048729841041},
+    {-21.964559564889836, 118.78180913583054, 169.49398074157793,
+     3.8583514556902982, -28.900874056324287},
+    {-21.962514257179166, 119.12584161474983, 166.93498073370307,
+     3.8004524158506787, -27.737116672162255},
+    {-21.960468949468495, 119.46474376649745, 164.47552661085342,
+     3.7448090700912422, -26.6916231056817},
+    {-21.958423641757825, 119.79870891081949, 162.10584539259395,
+     3.691199514985243, -25.745611655887053},
+    {-21.956378334047155, 120.12791197823623, 159.81766937860155,
+     3.639436043301747, -24.884227894493968},
+    {-21.954333026336485, 120.45251226062713, 157.60393016515081,
+     3.5893581912984707, -24.095548212307566},
+    {-21.952287718625815, 120.77265561781368, 155.45852827778199,
+     3.5408275044126816, -23.369875920020405},
+    {-21.950242410915145, 121.0884762711306, 153.37615676156733,
+     3.4937235291146109, -22.699233527312938},
+    {-21.948197103204475, 121.40009827841588, 151.35216404131222,
+     3.4479406971248343, -22.076989694115223},
+    {-21.946151795493805, 121.70763675969188, 149.38244586757105,
+     3.4033858705525697, -21.497580576167074},
+    {-21.942061180072461, 122.31088494536321, 145.59165246505108,
+     3.3176384677405748, -20.449130042088075},
+    {-21.937970564651117, 122.89899837291618, 141.97900268392215,
+     3.2359192539143615, -19.523818145294957},
+    {-21.933879949229777, 123.47266329289859, 138.52440519863489,
+     3.1577724852893452, -18.699241856793808},
+    {-21.929789333808436, 124.03249131423662, 135.21129794176989,
+     3.0828225452517017, -17.958318882795865},
+    {-21.925698718387096, 124.57903208749252, 132.02583625173719,
+     3.0107555053882749, -17.287765873503989},
+    {-21.921608102965756, 125.11278315882346, 128.95630647227557,
+     2.9413058080996617, -16.67707689437859},
+    {-21.917517487544416, 125.63419775822865, 125.99269289452546,
+     2.8742464324740769, -16.117818742609369},
+    {-21.913426872123075, 126.14369104781569, 123.12635170224246,
+     2.8093814906439003, -15.60313315173236},
+    {-21.909336256701735, 126.64164520097974, 120.34976127441813,
+     2.7465405584252913, -15.127377730160037},
+    {-21.905245641280395, 127.12841357966161, 117.65632806240288,
+     2.6855742681259813, -14.68586213814841},
+    {-21.901155025859055, 127.6043242058032, 115.04023363069378,
+     2.6263508361742538, -14.274651019637604},
+    {-21.897064410437714, 128.06968267337544, 112.49631266924743,
+     2.5687532940630984, -13.890414603181686},
+    {-21.892973795016371, 128.52477461185978, 110.01995463994891,
+     2.5126772559558219, -13.530313917679782},
+    {-21.888883179595027, 128.96986778632555, 107.6070236899223,
+     2.458029101051495, -13.191911527098002},
+    {-21.884792564173686, 129.40521390029704, 105.25379284812855,
+     2.404724480240982, -12.873101339233862},
+    {-21.880701948752346, 129.83105015340269, 102.95688950947316,
+     2.3526870790208774, -12.572052851575789},
+    {-21.876611333331006, 130.24760059513085, 100.7132499261314,
+     2.3018475848836242, -12.28716645117178},
+    {-21.868430102488325, 131.05368144536723, 96.374827668895549,
+     2.2035150035285209, -11.760425714906754},
+    {-21.860248871645645, 131.8250273657651, 92.218878333905877,
+     2.1092824440237861, -11.283482594835407},
+    {-21.852067640802964, 132.56306136412101, 88.228774157845834,
+     2.01877404939709, -10.848905067683587},
+    {-21.84388640996028, 133.2690806171494, 84.390293981490316,
+     1.9316684860394255, -10.450727217336439},
+    {-21.835705179117596, 133.94427418379547, 80.691161385548213,
+     1.8476884699541685, -10.084097151032818},
+    {-21.827523948274916, 134.58973740628537, 77.120690953105324,
+     1.7665927462927, -9.7450230361877992},
+    {-21.819342717432235, 135.20648375562067, 73.66951323503109,
+     1.6881698543598644, -9.4301864961961179},
+    {-21.811161486589555, 135.79545467701408, 70.329358014659633,
+     1.6122332150422427, -9.1368032203390719},
+    {-21.802980255746874, 136.35752784987599, 67.092881440256576,
+     1.5386172131805718, -8.862517289312219},
+    {-21.79479902490419, 136.89352417647828, 63.953526635292491,
+     1.4671740391415156, -8.6053199835872807},
+    {-21.786617794061506, 137.40421374053611, 60.905410185723291,
+     1.3977711171470728, -8.3634866414264941},
+    {-21.778436563218825, 137.89032092319738, 57.943228862714989,
+     1.3302889923828181, -8.1355270081929056},
+    {-21.770255332376145, 138.35252882382702, 55.06218233786857,
+     1.2646195806436307, -7.920145797316863},
+    {-21.762074101533464, 138.79148310264952, 52.257908661141137,
+     1.2006647072637893, -7.7162110700928048},
+    {-21.753892870690784, 139.20779533903047, 49.526430015454338,
+     1.1383348789535905, -7.5227286659652028},
+    {-21.7457116398481, 139.60204598127552, 46.864106814885524,
+     1.0775482447079134, -7.3388213609424238},
+    {-21.737530409005416, 139.97478694971457, 44.267598629004098,
+     1.0182297113812186, -7.1637117544204409},
+    {-21.729349178162735, 140.32654394384681, 41.73383073171135,
+     0.96031018668641133, -6.9967081209296698},
+    {-21.721167947320055, 140.65781849548128, 39.259965315268808,
+     0.90372592787103512, -6.8371926382163082},
+    {-21.712986716477371, 140.96908980277288, 36.843376597826882,
+     0.84841797857932377, -6.6846115339038246},
+    {-21.704805485634687, 141.26081637435183, 34.481629199239769,
+     0.79433167973012742, -6.5384667917992001},
+    {-21.696624254792006, 141.53343750814469, 32.1724592752891,
+     0.74141624285592167, -6.3983091342283682},
+    {-21.688443023949326, 141.78737462568253, 29.913757991881983,
+     0.68962437642134811, -6.2637320546776474},
+    {-21.680261793106645, 142.02303247957369, 27.703556993819753,
+     0.63891195729537376, -6.1343667198728395},
+    {-21.672080562263965, 142.24080024926343, 25.540015581418135,
+     0.58923774088144376, -6.0098775954392272},
+    {-21.66389933142128, 142.44105253803596, 23.421409355761103,
+     0.54056310448670553, -5.8899586768112151},
+    {-21.655718100578596, 142.62415028243385, 21.346120131995008,
+     0.49285181938678546, -5.7743302288421425},
+    {-21.647536869735916, 142.79044158375521, 19.312626951666459,
+     0.44606984775866698, -5.6627359549100724},
+    {-21.639355638893235, 142.94026247002557, 17.319498051114934,
+     0.40018516124357101, -5.5549405302138606},
+    {-21.631174408050555, 143.07393759574842, 15.365383664422145,
+     0.35516757838870627, -5.4507274451494752},
+    {-21.622993177207874, 143.19178088583115, 13.44900955724086,
+     0.31098861862050264, -5.3498971137257172},
+    {-21.61481194636519, 143.29409612929103, 11.569171202739755,
+     0.26762137073982872, -5.2522652093636353},
+    {-21.606630715522506, 143.38117752767593, 9.7247285233563527,
+     0.22504037421183792, -5.1576611964645034},
+    {-21.598449484679826, 143.45331020255702, 7.9146011325489818,
+     0.18322151176090101, -5.065927031097746},
+    {-21.590268253837145, 143.51077066593786, 6.1377640195998424,
+     0.1421419119817792, -4.9769160082599662},
+    {-21.582087022994465, 143.55382725699914, 4.3932436280402714,
+     0.10177986084847876, -4.8904917365559246},
+    {-21.573905792151784, 143.58274054822687, 2.6801142846462342,
+     0.062114721146627375, -4.8065272239817762},
+    {-21.5657245613091, 143.59776372362887, 0.99749494142400452,
+     0.023126858979122884, -4.7249040608565922},
+    {-21.561633945887756, 143.60014370490183, 0.16736265647200335,
+     0.0038810290744204666, -4.6849356473510237},
+    {-21.557543330466416, 143.59914293145908, -0.65545380232650496,
+     -0.015202423399520163, -4.6455116879322205},
+    {-21.549362099623735, 143.58711761362977, -2.2795324267766723,
+     -0.052890949073997745, -4.5682467393809612},
+    {-21.541180868781055, 143.56192081374979, -3.8755049925913765,
+     -0.08995572285937263, -4.4930124517726959},
+    {-21.532999637938374, 143.52377946555436, -5.4441014386567268,
+     -0.12641298310024862, -4.4197181313481897},
+    {-21.524818407095694, 143.47291466329054, -6.9860196963708132,
+     -0.16227824932701546, -4.3482786729118041},
+    {-21.51663717625301, 143.40954191550529, -8.5019276380996249,
+     -0.19756636616717316, -4.2786141245344824},
+    {-21.500274714567645, 143.24610810569186, -11.458244421153299,
+     -0.26646739572563916, -4.1443133855570773},
+    {-21.483912252882284, 143.03509910692546, -14.317858611051632,
+     -0.33322279579527575, -4.0162652484015178},
+    {-21.46754979119692, 142.77806049920397, -17.085198043348438,
+     -0.39793078878415994, -3.8939797009985475},
+    {-21.451187329511555, 142.47646822957145, -19.764352522890402,
+     -0.46068201771981909, -3.7770190533939849},
+    {-21.434824867826194, 142.13173384642565, -22.359109248193427,
+     -0.52156034364793413, -3.6649909636188847},
+    {-21.418462406140829, 141.74520919328401, -24.872983590894812,
+     -0.5806435382533236, -3.5575425672851329},
+    {-21.402099944455465, 141.31819063189346, -27.309245954322989,
+     -0.63800388805767305, -3.4543555102206622},
+    {-21.385737482770104, 140.85192285381669, -29.670945305450225,
+     -0.6937087236144015, -3.355141724419731},
+    {-21.369375021084739, 140.34760233078472, -31.960929870837838,
+     -0.74782088477792685, -3.2596398193207903},
+    {-21.353012559399374, 139.80638044679128, -34.181865403857081,
+     -0.80039913124133344, -3.1676119851980586},
+    {-21.336650097714013, 139.22936634880537, -36.336251363066253,
+     -0.8514985060133522, -3.0788413249284985},
+    {-21.320287636028649, 138.61762954787554, -38.42643528677457,
+     -0.90117065826632303, -2.993129545808392},
+    {-21.303925174343284, 137.97220229812334, -40.454625603929493,
+     -0.94946413097267524, -2.9102949553688586},
+    {-21.271200250972559, 136.58423209115747, -44.333231102596095,
+     -1.0420951939599434, -2.7526033128940832},
+    {-21.238475327601833, 135.07304719908674, -47.987359685643654,
+     -1.1297270389103351, -2.6045837364828213},
+    {-21.205750404231104, 133.44576561190209, -51.430698871450218,
+     -1.2126592525862334, -2.4652276254194101},
+    {-21.173025480860375, 131.70908044896933, -54.675561962930004,
+     -1.2911608218758031, -2.333668802661391},
+    {-21.140300557489649, 129.86930173582593, -57.733077237700286,
+     -1.3654743715847133, -2.2091586355530204},
+    {-21.107575634118923, 127.93239253916522, -60.613344797026762,
+     -1.4358196755445831, -2.0910462716099141},
+    {-21.074850710748194, 125.90400040696665, -63.325567593093396,
+     -1.5023965878153835, -1.9787627910931551},
+    {-21.042125787377469, 123.78948487314629, -65.878161654616221,
+     -1.5653875069536589, -1.8718083907655234},
+    {-21.009400864006743, 121.59394164094005, -68.278849415857749,
+     -1.6249594611913212, -1.7697419365308147},
+    {-20.976675940636014, 119.32222394580454, -70.534739215572074,
+     -1.6812658834789975, -1.6721723842203673},
+    {-20.943951017265288, 116.97896150915531, -72.652393395127589,
+     -1.7344481309958206, -1.5787516860891919},
+    {-20.911226093894562, 114.56857742314396, -74.637886935921898,
+     -1.7846367927157047, -1.4891688881729701},
+    {-20.878501170523833, 112.09530324957748, -76.496858197365484,
+     -1.8319528200942743, -1.4031451891826165},
+    {-20.845776247153108, 109.56319257011897, -78.234553020789477,
+     -1.8765085092831193, -1.3204297811081549},
+    {-20.813051323782382, 106.97613318737945, -79.855863231633563,
+     -1.9184083580379423, -1.2407963294294304},
+    {-20.780326400411653, 104.33785814591572, -81.365360387439779,
+     -1.9577498163317577, -1.1640399798305943},
+    {-20.747601477040927, 101.65195571689991, -82.767325471529929,
+     -1.994623946366026, -1.0899748007846259},
+    {-20.682151630299472, 96.150951533345179, -85.264484821822492,
+     -2.0613059595044629, -0.94925597782535276},
+    {-20.616701783558018, 90.499256560901927, -87.376702534303817,
+     -2.119075675916005, -0.81745467620916257},
+    {-20.551251936816563, 84.721194398633273, -89.130091324464615,
+     -2.1684832534409355, -0.69357566153842121},
+    {-20.485802090075108, 78.83947186458073, -90.548018710225733,
+     -2.2100188782477335, -0.57677612042234483},
+    {-20.420352243333653, 72.875344904572216, -91.651513492682071,
+     -2.2441217565823885, -0.46633681953883516},
+    {-20.354902396592198, 66.848760451863512, -92.459597286420802,
+     -2.2711874389017046, -0.36163967096965499},
+    {-20.289452549850743, 60.778478584806074, -92.989557374376574,
+     -2.291573839804284, -0.2621500868041145},
+    {-20.224002703109292, 54.68217840339522, -93.257173138368501,
+     -2.305606227100407, -0.16740295943496136},
+    {-20.158552856367837, 48.576550344155592, -93.276905399464752,
+     -2.3135813881104004, -0.076991418472386358},
+    {-20.093103009626383, 42.477377115606522, -93.0620558591107,
+     -2.3157711333716278, 0.0094422632985970249},
+    {-20.027653162884931, 36.399605020539525, -92.6249022377025,
+     -2.3124252623206534, 0.092214084288453693},
+    {-19.962203316143476, 30.357407106153229, -91.976813507805289,
+     -2.3037740887405813, 0.17160440370357788},
+    {-19.896753469402022, 24.364239326461192, -91.128348707184827,
+     -2.2900306034179256, 0.24786297745762734},
+    {-19.831303622660567, 18.432890697188231, -90.089342116530318,
+     -2.2713923358419121, 0.32121314940809875},
+    {-19.765853775919112, 12.575528259600317, -88.86897704413235,
+     -2.2480429646910092, 0.39185536049683461},
+    {-19.733128852548386, 9.6782340309939929, -88.193492834091401,
+     -2.2346555757350632, 0.426218092775003},
+    {-19.700403929177661, 6.8037375374141016, -87.4758500357309,
+     -2.2201537174111725, 0.45997010329497517},
+    {-19.667679005806932, 3.9534020984882785, -86.717040739376287,
+     -2.2045570479814334, 0.49313124675373143},
+    {-19.634954082436206, 1.1285590632446334, -85.918026993735154,
+     -2.1878845917595058, 0.52572042271400188},
+    {-19.618591620750841, -0.27389526120623103, -85.503736223122729,
+     -2.1791507228450668, 0.54180618238556366},
+    {-19.60222915906548, -1.6694912298422366, -85.079742200555131,
+     -2.1701547693928509, 0.55775563439517029},
+    {-19.569504235694751, -4.4394785370357805, -84.203092424934155,
+     -2.1513854262937286, 0.58925404308889451},
+    {-19.536779312324025, -7.1801618351221697, -83.288957627479192,
+     -2.1315938593558141, 0.62023201857951116},
+    {-19.5040543889533, -9.8903284863005201, -82.338192823975049,
+     -2.1107968420814527, 0.65070518591163562},
+    {-19.438604542211845, -15.214398468928646, -80.330075029469612,
+     -2.0662510741197773, 0.71019613005819937},
+    {-19.37315469547039, -20.402525608843142, -78.185120251637571,
+     -2.0178727078950627, 0.76783855657559041},
+    {-19.307704848728935, -25.445953549260565, -75.909374358074615,
+     -1.9657793340224972, 0.82373471235761664},
+    {-19.242255001987481, -30.336311405903441, -73.508574912267946,
+     -1.9100821318674823, 0.87797842087494737},
+    {-19.176805155246029, -35.065594395217566, -70.988175383785702,
+     -1.8508863913748974, 0.93065596318685562},
+    {-19.111355308504574, -39.626145964452817, -68.353366886451838,
+     -1.7882919809469116, 0.98184684848305159},
+    {-19.04590546176312, -44.010641272034881, -65.609097748778865,
+     -1.7223937680594077, 1.0316244901802554},
+    {-18.980455615021668, -48.212071885094787, -62.760091177477833,
+     -1.653281998346966, 1.0800568009733218},
+    {-18.915005768280214, -52.223731576878407, -59.810861238437724,
+     -1.5810426380820457, 1.127206718092697},
+    {-18.849555921538759, -56.039203120407024, -56.765727348895147,
+     -1.5057576842972424, 1.1731326682542207},
+    {-18.784106074797304, -59.652345986563802, -53.628827448584175,
+     -1.4275054462277059, 1.2178889803292843},
+    {-18.718656228055849, -63.057284865028585, -50.404129995669734,
+     -1.3463608012663628, 1.2615262525541611},
+    {-18.653206381314398, -66.248398935407025, -47.095444914535648,
+     -1.2623954282120871, 1.3040916800906608},
+    {-18.587756534572943, -69.220311823643655, -43.706433606501008,
+     -1.1756780202389596, 1.3456293479088297},
+    {-18.522306687831488, -71.967882185670163, -40.240618120827001,
+     -1.0862744797132553, 1.3861804932563448},
+    {-18.456856841090037, -74.486194866174074, -36.701389571578957,
+     -0.99424809672553716, 1.4257837413849876},
+    {-18.391406994348582, -76.77055258564998, -33.092015875741644,
+     -0.89965971298200154, 1.4644753177022718},
+    {-18.325957147607127, -78.816468113538207, -29.41564887919191,
+     -0.80256787250626072, 1.502289239090709},
+    {-18.260507300865672, -80.619656889350892, -25.675330929492063,
+     -0.7030289604351484, 1.5392574867751634},
+    {-18.195057454124218, -82.176030057327168, -21.874000947842763,
+     -0.60109733104702701, 1.575410162810039},
+    {-18.129607607382766, -83.481687883392155, -18.014500046738029,
+     -0.49682542603410057, 1.6107756319939237},
+    {-18.064157760641312, -84.532913526063339, -14.099576734808856,
+     -0.3902638839196092, 1.6453806507927717},
+    {-17.998707913899857, -85.326167135535059, -10.131891745913627,
+     -0.28146164142396785, 1.6792504846577252},
+    {-17.933258067158405, -85.858080257430757, -6.1140225256295979,
+     -0.17046602749854892, 1.712409014955699},
+    {-17.867808220416951, -86.12545051981283, -2.0484674048802329,
+     -0.057322850671172904, 1.7448788365854173},
+    {-17.835083297046225, -86.158975502900333, 0.0014323105113243106,
+     4.0154298341895719e-05, 1.7608622129081219},
+    {-17.802358373675496, -86.125236583852612, 2.0623505125902546,
+     0.057923519718597237, 1.7766813472256036},
+    {-17.736908526934041, -85.854553340226801, 6.2160797248646862,
+     0.17523007787477107, 1.8078368290526259},
+    {-17.671458680192586, -85.310667334820636, 10.410436946953794,
+     0.29455511102268384, 1.8383645236694777},
+    {-17.606008833451135, -84.490992408631143, 14.643203946783887,
+     0.41585813358681367, 1.8682827009048504},
+    {-17.54055898670968, -83.393085538022973, 18.912224584379338,
+     0.53909982568711057, 1.8976087220682154},
+    {-17.409659293226774, -80.353495888636132, 27.550696204128222,
+     0.79124742592885833, 1.9545495436644631},
+    {-17.278759599743864, -76.175070271659465, 36.309743340336396,
+     1.0507045696982393, 2.0093098108111587},
+    {-17.147859906260955, -70.843033880917872, 45.174090323728208,
+     1.3171932407505391, 2.0620010976346821},
+    {-17.016960212778045, -64.344560691804446, 54.129227100587997,
+     1.5904493641567761, 2.1127250395010329},
+    {-16.886060519295135, -56.668677221968338, 63.161349595831588,
+     1.8702215808020832, 2.1615744582292615},
+    {-16.755160825812229, -47.806173661928831, 72.257306588619869,
+     2.1562701587830655, 2.2086343330414011},
+    {-16.624261132329323, -37.74952158149447, 81.404552233299924,
+     2.4483660231669453, 2.2539826417318194},
+    {-16.558811285587868, -32.271478049655933, 85.993642689880787,
+     2.5966128004830344, 2.2760375943762727},
+    {-16.493361438846414, -26.492797522286185, 90.591103493171019,
+     2.746289888482162, 2.2976910921520743},
+    {-16.427911592104959, -20.412978676832203, 95.195518424463984,
+     2.8973712784713825, 2.3189512235590439},
+    {-16.362461745363504, -14.031611875061758, 99.805501865590756,
+     3.0498314807022182, 2.33982576059155},
+    {-16.297011898622053, -7.348377193182011, 104.41969780111266,
+     3.2036455041780258, 2.3603221745376239},
+    {-16.231562051880598, -0.36304251567385437, 109.03677886888789,
+     3.3587888374629609, 2.3804476508000678},
+    {-16.166112205139143, 6.9245383102381277, 113.65544545610229,
+     3.5152374304309131, 2.4002091028105936},
+    {-16.100662358397692, 14.51442726236248, 118.27442483806195,
+     3.6729676768972501, 2.4196131851021874},
+    {-16.035212511656237, 22.406603876297783, 122.89247035723709,
+     3.8319563980803095, 2.4386663055994782},
+    {-15.969762664914782, 30.600966925681888, 127.50836064021402,
+     3.9921808268430654, 2.457374637182022},
+    {-15.838862971431874, 47.895453348991843, 136.728911974368,
+     4.3162477073317138, 2.4937805145862524},
+    {-15.773413124690421, 56.994984895367061, 141.33125014019126,
+     4.4800465512109993, 2.5114893258148552},
+    {-15.740688201319694, 61.657656245811829, 143.62993794556891,
+     4.5623779630399843, 2.5202225656034534},
+    {-15.724325739634331, 64.01719371523393, 144.77860055456225,
+     4.6036505142359472, 2.5245591799954794},
+    {-15.707963277948966, 66.395522251954205, 145.92678596547572,
+     4.6449938602266005, 2.5287015355367077},
+    {-15.707963257948965, 66.395525170305859, 145.89912784352072,
+     4.6441134807750757, -44018.966089161586},
+    {-15.707961260578154, 66.395816116098061, 145.5350426979293,
+     4.6325248796982539, -3104.5406645330481},
+    {-15.707959263207343, 66.396106633063454, 145.37354956391781,
+     4.6273849813331696, -2197.2421812062171},
+    {-15.707957265836532, 66.396396869968015, 145.2495716453966,
+     4.6234392285145196, -1794.3244572732535},
+    {-15.707955268465721, 66.396686880334656, 145.14504420146304,
+     4.6201126028429327, -1553.9157873786846},
+    {-15.70795327109491, 66.396976695132622, 145.05295538972601,
+     4.6171819105371963, -1389.7714783719241},
+    {-15.707951273724099, 66.39726633526719, 144.9697056663523,
+     4.614532574622074, -1268.5674826989136},
+    {-15.707949276353286, 66.397555816094354, 144.89315552584659,
+     4.6120964925691617, -1174.3476565682668},
+    {-15.707947278982475, 66.397845149510431, 144.82191043518949,
+     4.6098292750499583, -1098.3873897830238},
+    {-15.707943284240852, 66.398423410752812, 144.69172307497828,
+     4.6056864497385117, -982.22196914388803},
+    {-15.70793928949923, 66.399001178180541, 144.57404564799504,
+     4.6019418264699716, -896.45885920543719},
+    {-15.707935294757608, 66.399578495247653, 144.46584888654723,
+     4.5984989807909864, -829.79667267310685},
+    {-15.707931300015986, 66.400155395629398, 144.36515868149249,
+     4.5952950749582655, -776.05762935936605},
+    {-15.707923310532742, 66.401308050029584, 144.18118510221345,
+     4.5894413364475319, -693.88158131265573},
+    {-15.707915321049496, 66.402459308848933, 144.01491007945285,
+     4.5841509562527598, -633.21699868560745},
+    {-15.707907331566251, 66.403609295044205, 143.86204706291733,
+     4.5792874896140825, -586.06597418618162},
+    {-15.707899342083007, 66.404758103885428, 143.71980286214043,
+     4.5747620268071412, -548.05713013471598},
+    {-15.707883363116517, 66.407052482876864, 143.45993725254422,
+     4.5664948591800947, -489.93754095657897},
+    {-15.707867384150028, 66.409342919607624, 143.22510619711534,
+     4.5590245542063901, -447.03373916234364},
+    {-15.707851405183538, 66.411629761910334, 143.00924580045438,
+     4.5521580931578525, -413.68800622350301},
+    {-15.707835426217049, 66.413913279293794, 142.80840490733542,
+     4.5457697076766568, -386.80823913588137},
+    {-15.707819447250559, 66.416193688595683, 142.61983893935667,
+     4.539772035778026, -364.54298536456952},
+    {-15.707803468284069, 66.418471169199933, 142.4415495319208,
+     4.5341014680864609, -345.70700689508453},
+    {-15.70777151035109, 66.423017929552685, 142.11010241025159,
+     4.5235602744986458, -315.36669863527749},
+    {-15.707739552418111, 66.427554544275822, 141.80548658350611,
+     4.5138731168252662, -291.78587169113433},
+    {-15.707707594485131, 66.432081775735753, 141.5221135419452,
+     4.5048621095936578, -272.77769826656379},
+    {-15.70767563655215, 66.436600237291529, 141.25610141761541,
+     4.4964036909735059, -257.03280710870951},
+    {-15.707643678619171, 66.441110436369755, 141.00462380263571,
+     4.4884078951500372, -243.71299759650333},
+    {-15.707579762753213, 66.450107702523781, 140.53721317266701,
+     4.4735476532774818, -222.25804793358273},
+    {-15.707515846887254, 66.459076357388312, 140.10775094544556,
+     4.4598952600519128, -205.58310452822334},
+    {-15.707451931021296, 66.468018557440942, 139.70833316022782,
+     4.4471991311433543, -192.14170971021937},
+    {-15.707388015155338, 66.476936037686357, 139.33346963225381,
+     4.4352845138165984, -181.00792710143361},
+    {-15.70732409928938, 66.485830233468263, 138.97916294528434,
+     4.4240241707233867, -171.58901904516193},
+    {-15.707260183423422, 66.494702357991514, 138.64239534238325,
+     4.413322047364403, -163.48560979886386},
+    {-15.707196267557464, 66.503553454369865, 138.32082230515033,
+     4.4031035185714851, -156.41747739336051},
+    {-15.707068435825548, 66.521196093020421, 137.71615473160847,
+     4.383891089997987, -144.62604297183734},
+    {-15.70694060409363, 66.538764249569013, 137.15398162857741,
+     4.3660310777781763, -135.1211534814442},
+    {-15.706812772361712, 66.556262831984213, 136.62653820372745,
+     4.3492763358120801, -127.24804568335915},
+    {-15.706684940629795, 66.5736959006055, 136.12817088283867,
+     4.3334469175829886, -120.5875748968121},
+    {-15.706557108897879, 66.591066887436952, 135.65461161958302,
+     4.31840697738697, -114.85732996159557},
+    {-15.706429277165963, 66.608378743341007, 135.20254452590325,
+     4.3040509761967654, -109.85915754283597},
+    {-15.706301445434047, 66.625634041020533, 134.7693326187501,
+     4.2902949840533164, -105.44937240514587},
+    {-15.706173613702129, 66.642835049534185, 134.35283781760461,
+     4.2770709506354452, -101.52090536946137},
+    {-15.705917950238295, 66.677082076542334, 133.56324056306144,
+     4.2520036392089704, -94.79953031296742},
+    {-15.70566228677446, 66.711133709445832, 132.82277071367332,
+     4.2284995146470736, -89.232032049278899},
+    {-15.705406623310626, 66.745001435633185, 132.12343212954994,
+     4.2063040868183181, -84.522022644937778},
+    {-15.705150959846794, 66.778694965125268, 131.4591882396023,
+     4.1852252352015817, -80.469802046227514},
+    {-15.70489529638296, 66.812222646913995, 130.82534912778851,
+     4.1651137005007373, -76.935251058975311},
+    {-15.704639632919125, 66.845591760256852, 130.2181850707052,
+     4.1458507840494994, -73.816766242319034},
+    {-15.704383969455293, 66.878808725479743, 129.63467195904593,
+     4.1273402449654419, -71.038636269829283},
+    {-15.704128305991459, 66.911879260797647, 129.072317440749,
+     4.1095027665911639, -68.543132740125969},
+    {-15.703872642527624, 66.944808501746337, 128.52903854618367,
+     4.0922720615459669, -66.285366631257176},
+    {-15.703361315599956, 67.010261266493416, 127.49291548021455,
+     4.0594148258424507, -62.348042524855835},
+    {-15.702849988672289, 67.075199527669653, 126.51499250649655,
+     4.0284086200199916, -59.017080022800059},
+    {-15.702338661744623, 67.139650765127229, 125.58673094065132,
+     3.9989817327853343, -56.151265589723451},
+    {-15.701827334816954, 67.203638608343084, 124.70149679913249,
+     3.9709230696551345, -53.651516821412677},
+    {-15.701316007889286, 67.267183660460248, 123.85401420495367,
+     3.9440647568242677, -51.445986801093468},
+    {-15.700804680961618, 67.33030409457939, 123.04000532089512,
+     3.9182706816960211, -49.481137616763526},
+    {-15.700293354033949, 67.393016097412143, 122.25594445056812,
+     3.8934286670241209, -47.716147577424763},
+    {-15.699782027106282, 67.455334207128885, 121.4988849529588,
+     3.8694449624582772, -46.119274081821061},
+    {-15.698759373250947, 67.578840176920778, 120.05616143058074,
+     3.8237467871233171, -43.334410304987138},
+    {-15.697736719395611, 67.700914043905712, 118.69583410225331,
+     3.7806671185788403, -40.978341389096123},
+    {-15.696714065540275, 67.82163362123994, 117.40582277262943,
+     3.7398216684846126, -38.951209335868178},
+    {-15.69569141168494, 67.941065827149089, 116.17674155936108,
+     3.7009118780479846, -37.182948512207474},
+    {-15.694668757829605, 68.059269016254362, 115.00112574967994,
+     3.6637003151885348, -35.622752490595026},
+    {-15.69364610397427, 68.176294666632884, 113.87292248640662,
+     3.627994467696368, -34.232761849074897},
+    {-15.692623450118935, 68.2921886350248, 112.78714293823373,
+     3.593635675282163, -32.984109326544505},
+    {-15.6916007962636, 68.40699211273602, 111.73961746206275,
+     3.560491339056675, -31.854347879166951},
+    {-15.690578142408265, 68.520742368261097, 110.72681876843018,
+     3.5284492949676389, -30.82572423589167},
+    {-15.68955548855293, 68.633473334154772, 109.74573133731872,
+     3.4974136589589486, -29.883987953141784},
+    {-15.688532834697595, 68.745216077836389, 108.7937531060808,
+     3.4673016990303496, -29.017550127742869},
+    {-15.68751018084226, 68.85599918424893, 107.8686201855411,
+     3.4380414400390737, -28.216876579809},
+    {-15.68546487313159, 69.074790247640422, 106.09118685421502,
+     3.3818311319527377, -26.782396878805489},
+    {-15.68341956542092, 69.29003626843415, 104.40014637017954,
+     3.3283604361501244, -25.530999847161542},
+    {-15.68137425771025, 69.501902747581497, 102.78493215387005,
+     3.2772935096339704, -24.426755855921559},
+    {-15.679328949999579, 69.710535717253308, 101.23697545442741,
+     3.2283580431683627, -23.442890966547669},
+    {-15.677283642288909, 69.916065293234851, 99.749213231460033,
+     3.1813296074579562, -22.558990240497941},
+    {-15.675238334578237, 70.118608380429365, 98.315741740396504,
+     3.1360206346438884, -21.759178965332072},
+    {-15.673193026867565, 70.318270774766376, 96.931566324911813,
+     3.0922724603323695, -21.030901776866575},
+    {-15.671147719156895, 70.515148824399915, 95.592416643690484,
+     3.0499494471242641, -20.364080462084601},
+    {-15.669102411446225, 70.709330762382805, 94.294607556500523,
+     3.0089345605278144, -19.750519025574167},
+    {-15.667057103735555, 70.900897789942306, 93.034932591978304,
+     2.9691259812219499, -19.183474563957439},
+    {-15.665011796024885, 71.089924967364965, 91.810581128498029,
+     2.9304344715461901, -18.657341964208189},
+    {-15.662966488314215, 71.276481954315543, 90.619073138754004,
+     2.8927813006036516, -18.16741838352424},
+    {-15.658875872892875, 71.642440622640962, 88.326018281852157,
+     2.8203179780853103, -17.280868334495143},
+    {-15.654785257471534, 71.999244406960045, 86.140796501773508,
+     2.7512608791826523, -16.49841265044914},
+    {-15.650694642050192, 72.347308745238394, 84.051264922367338,
+     2.6852247406494949, -15.801114693401333},
+    {-15.64660402662885, 72.687003961175506, 82.047412750458079,
+     2.6218920288013341, -15.174535128780226},
+    {-15.64251341120751, 73.018662926581257, 80.120870914618209,
+     2.5609973540829252, -14.607445670894501},
+    {-15.63842279578617, 73.342587014806725, 78.26455786327233,
+     2.5023162145341473, -14.090965656871369},
+    {-15.634332180364829, 73.659050806405958, 76.472417975399381,
+     2.4456566834188527, -13.617966423737247},
+    {-15.630241564943489, 73.968305864554338, 74.739224598741359,
+     2.3908531511877364, -13.182650551892907},
+    {-15.626150949522147, 74.270583804238157, 73.060429207623557,
+     2.3377615333306943, -12.780248370135398},
+    {-15.622060334100805, 74.566098816576329, 71.43204412864516,
+     2.2862555450742579, -12.406794959122109},
+    {-15.617969718679465, 74.855049766747172, 69.850550130624939,
+     2.2362237662390267, -12.058963578382677},
+    {-15.613879103258125, 75.13762195393177, 68.31282272299697,
+     2.1875673005801048, -11.733939385114898},
+    {-15.609788487836784, 75.413988600246228, 66.816072730946701,
+     2.1401978887481428, -11.429322410920278},
+    {-15.605697872415444, 75.684312120116402, 65.357797905365771,
+     2.0940363718335178, -11.143052108408943},
+    {-15.601607256994102, 75.948745210046823, 63.935743161484943,
+     2.0490114290251396, -10.873348020182032},
+    {-15.59751664157276, 76.207431790236583, 62.547867636616679,
+     2.0050585318788841, -10.61866265086247},
+    {-15.59342602615142, 76.46050782297047, 61.192317189572329,
+     1.9621190714262513, -10.377643682644033},
+    {-15.585244795308739, 76.950336509691851, 58.571573414436493,
+     1.879071332651346, -9.9319938912496166},
+    {-15.577063564466057, 77.419184913944491, 56.061618498946451,
+     1.7994925124024204, -9.528454572893045},
+    {-15.568882333623375, 77.867917138800223, 53.652385248136831,
+     1.7230647678628261, -9.1607423639544336},
+    {-15.560701102780694, 78.297321096383669, 51.335261872289145,
+     1.6495163531903954, -8.8238133009987809},
+    {-15.552519871938012, 78.708119220668351, 49.102812804074993,
+     1.5786127652751956, -8.5135651953881109},
+    {-15.544338641095329, 79.100977178018425, 46.948564857845206,
+     1.5101499633353646, -8.2266229490824649},
+    {-15.536157410252649, 79.476511032805533, 44.866840952976112,
+     1.4439490978434444, -7.9601808094448661},
+    {-15.527976179409967, 79.835293203803502, 42.852629072522689,
+     1.3798523573646739, -7.7118845348562539},
+    {-15.519794948567284, 80.177857461955512, 40.901477736636856,
+     1.3177196564833704, -7.4797420609567311},
+    {-15.511613717724604, 80.504703159413438, 39.009411712047182,
+     1.2574259655355016, -7.2620548630262149},
+    {-15.503432486881922, 80.816298835619136, 37.172863364174937,
+     1.1988591363760377, -7.0573645764806567},
+    {-15.495251256039239, 81.113085313821145, 35.388616242334351,
+     1.1419181159951091, -6.8644110222344521},
+    {-15.487070025196559, 81.395478377107921, 33.653758333592556,
+     1.0865114666247346, -6.6820988645726267},
+    {-15.478888794353876, 81.663871094723191, 31.96564303310701,
+     1.0325561304105657, -6.5094708788038211},
+    {-15.470707563511194, 81.918635855401234, 30.321856328265,
+     0.97997639098877853, -6.3456863338502654},
+    {-15.462526332668514, 82.160126153548802, 28.720189028080267,
+     0.92870299491104413, -6.1900033719220371},
+    {-15.454345101825831, 82.388678165682691, 27.158613120521601,
+     0.87867240383136602, -6.0417645401616014},
+    {-15.446163870983149, 82.604612147796914, 25.63526153133833,
+     0.82982615442453689, -5.9003848288392389},
+    {-15.437982640140467, 82.80823367901516, 24.148410704385807,
+     0.78211030765111955, -5.7653417185248061},
+    {-15.429801409297784, 82.999834772660122, 22.696465536881167,
+     0.735474972581455, -5.6361668492622634},
+    {-15.421620178455104, 83.17969487238372, 21.277946291566149,
+     0.68987389279930111, -5.512439008310464},
+    {-15.413438947612422, 83.34808174824667, 19.891477177461276,
+     0.64526408561609516, -5.3937781966840816},
+    {-15.405257716769739, 83.505252305311672, 18.535776346191231,
+     0.60160552608002449, -5.2798405836701194},
+    {-15.397076485927059, 83.651453315469311, 17.209647094992874,
+     0.55886086916313327, -5.1703141964121926},
+    {-15.388895255084377, 83.786922081621768, 15.911970103016804,
+     0.51699520463496584, -5.064915221254596},
+    {-15.380714024241694, 83.911887042074909, 14.641696556245638,
+     0.47597584004125931, -4.9633848168070331},
+    {-15.372532793399014, 84.026568321906396, 13.397842039696725,
+     0.43577210794599108, -4.8654863571035731},
+    {-15.364351562556331, 84.131178237135856, 12.17948109469871,
+     0.39635519420099363, -4.7710030378954134},
+    {-15.356170331713649, 84.22592175679813, 10.985742354752009,
+     0.35769798450542689, -4.679735790864755},
+    {-15.347989100870969, 84.310996927330848, 9.8158041864625254,
+     0.31977492692855436, -4.5915014600123971},
+    {-15.339807870028286, 84.386595263146745, 8.6688907728464049,
+     0.28256190841164752, -4.5061312021397795},
+    {-15.331626639185604, 84.452902106793346, 7.544268585296277,
+     0.24603614354963899, -4.4234690795885365},
+    {-15.323445408342923, 84.510096961665212, 6.441243198043038,
+     0.21017607419203752, -4.3433708185082027},
+    {-15.315264177500241, 84.558353799933542, 5.3591564052979201,
+     0.17496127860370483, -4.2657027101211717},
+    {-15.307082946657559, 84.597841348000813, 4.2973836066198752,
+     0.14037238909580249, -4.190340635920661},
+    {-15.298901715814878, 84.628723351559344, 3.2553314305897221,
+     0.10639101718081502, -4.1171692006104639},
+    {-15.290720484972196, 84.651158822094374, 2.2324355707490775,
+     0.072999685428267666, -4.0460809589890427},
+    {-15.282539254129514, 84.665302266472366, 1.2281588110577526,
+     0.040181765302055097, -3.9769757249795399},
+    {-15.274358023286833, 84.67130390108143, 0.24198922094807251,
+     0.007921420349684842, -3.9097599526846105},
+    {-15.266176792444151, 84.669309851838392, -0.72656149751149324,
+     -0.023796445809244719, -3.8443461807574804},
+    {-15.257995561601469, 84.659462341240129, -1.6779595257382236,
+     -0.05498623718180274, -3.7806525325734421},
+    {-15.249814330758788, 84.641899863530213, -2.6126503216329704,
+     -0.085661709217117146, -3.7186022656967319},
+    {-15.241633099916106, 84.616757348925603, -3.5310599014690776,
+     -0.11583600911796366, -3.6581233649977669},
+    {-15.233451869073424, 84.584166317770837, -4.4335960213269079,
+     -0.14552171298508793, -3.5991481745086467},
+    {-15.225270638230743, 84.544255025417257, -5.3206492675457637,
+     -0.1747308600934023, -3.5416130637314804},
+    {-15.217089407388061, 84.497148598508915, -6.1925940646192776,
+     -0.20347498456612559, -3.4854581246526104},
+    {-15.200726945702698, 84.381835966893803, -7.8925807289355827,
+     -0.25961195004449589, -3.3770661131030488},
+    {-15.184364484017333, 84.239171560159463, -9.5362619618963116,
+     -0.31401584083199308, -3.2735574473264628},
+    {-15.168002022331969, 84.070055952138375, -11.126138226017117,
+     -0.36676347384566588, -3.1745616983212237},
+    {-15.151639560646606, 83.875350335496265, -12.664525990709352,
+     -0.417925926102511, -3.0797468018393532},
+    {-15.135277098961243, 83.655879375996562, -14.153576409161328,
+     -0.46756912069131229, -2.9888140930268126},
+    {-15.118914637275878, 83.412433781141885, -15.595291618619767,
+     -0.51575433795258607, -2.9014941047782883},
+    {-15.102552175590516, 83.145772619054469, -16.991539024030786,
+     -0.56253866321658341, -2.8175429947376096},
+    {-15.086189713905153, 82.856625418072937, -18.34406386224493,
+     -0.607975380467904, -2.7367394927109197},
+    {-15.069827252219788, 82.545694073118611, -19.654500293533751,
+     -0.65211431971254474, -2.6588822812084341},
+    {-15.053464790534425, 82.21365458120583, -20.924381226354399,
+     -0.69500216453528985, -2.5837877382989149},
+    {-15.037102328849063, 81.861158625353411, -22.155147048078803,
+     -0.73668272528722478, -2.5112879849942593},
+    {-15.020739867163698, 81.488835023584755, -23.348153407221758,
+     -0.77719718248574166, -2.4412291897614278},
+    {-15.004377405478335, 81.09729105749922, -24.50467817034658,
+     -0.81658430430440698, -2.3734700910743323},
+    {-14.988014943792972, 80.68711369303837, -25.625927658340835,
+     -0.85488064144723086, -2.3078807056185311},
+    {-14.955290020422245, 79.813111711398534, -27.767101439219005,
+     -0.92833711018982412, -2.1827408697416271},
+    {-14.922565097051518, 78.871159095402717, -29.780094040719266,
+     -0.99782087888507121, -2.064955577357046},
+    {-14.88984017368079, 77.865324402067941, -31.672486478331276,
+     -1.0635603239823692, -1.9537912677896927},
+    {-14.857115250310063, 76.79944021857294, -33.451136553732425,
+     -1.1257614950868176, -1.8486138734627389},
+    {-14.824390326939335, 75.677125220388675, -35.122274277350975,
+     -1.1846110869573403, -1.7488720960740507},
+    {-14.791665403568608, 74.501803372751382, -36.691581607028581,
+     -1.2402789207960465, -1.6540839963765375},
+    {-14.758940480197881, 73.276720736759614, -38.164259548801759,
+     -1.2929200304048543, -1.5638261484412397},
+    {-14.726215556827153, 72.00496025332356, -39.545084989765854,
+     -1.342676427530376, -1.477724798156151},
+    {-14.693490633456427, 70.689454809296905, -40.838459124466091,
+     -1.3896786047380303, -1.3954486023671822},
+    {-14.6607657100857, 69.332998835867357, -42.048448949708472,
+     -1.4340468220149558, -1.3167026251305824},
+    {-14.628040786714973, 67.938258646036246, -43.17882300594902,
+     -1.4758922139854695, -1.2412233416351315},
+    {-14.595315863344247, 66.507781683411821, -44.233082313558945,
+     -1.5153177474099473, -1.1687744557800699},
+    {-14.56259093997352, 65.044004826542945, -45.214487272676038,
+     -1.5524190530053525, -1.0991433792640217},
+    {-14.529866016602792, 63.549261870291723, -46.126081153930045,
+     -1.5872851511921484, -1.0321382519542273},
+    {-14.497141093232065, 62.025790287088903, -46.970710695126783,
+     -1.619999087856532, -0.96758540783792091},
+    {-14.464416169861337, 60.475737355622968, -47.751044229327768,
+     -1.6506384934092204, -0.90532720986681581},
+    {-14.431691246490612, 58.901165731773148, -48.469587697664359,
+     -1.6792760761650449, -0.8452201918451574},
+    {-14.398966323119884, 57.30405852603451, -49.128698841881189,
+     -1.7059800592420675, -0.78713345717841166},
+    {-14.333516476378431, 54.049799529878683, -50.277388482479424,
+     -1.7538399793706005, -0.67655196981249976},
+    {-14.268066629636976, 50.727401212938759, -51.213457931570481,
+     -1.7946880702530581, -0.57273866511846128},
+    {-14.202616782895522, 47.350291494347879, -51.951561076427367,
+     -1.8289432810365485, -0.47497862100079041},
+    {-14.137166936154069, 43.930987613366881, -52.504909654981347,
+     -1.8569813135864757, -0.38266165000101665},
+    {-14.071717089412616, 40.481183654832677, -52.885476265115983,
+     -1.8791408301161183, -0.29526329713496219},
+    {-14.006267242671161, 37.011826006509672, -53.104161552756437,
+     -1.8957285561056039, -0.21232989279942902},
+    {-13.940817395929706, 33.53317883726983, -53.170933044105105,
+     -1.9070235099567905, -0.13346667579279722},
+    {-13.875367549188253, 30.054881257555774, -53.094941312148933,
+     -1.913280535593997, -0.058328267668625818},
+    {-13.8099177024468, 26.585997495956967, -52.884617862806579,
+     -1.9147332736616034, 0.013389032885006345},
+    {-13.744467855705345, 23.13506117209057, -52.547758155195893,
+     -1.9115966768179846, 0.08195353303822632},
+    {-13.67901800896389, 19.710114547427558, -52.091592439780193,
+     -1.904069151953907, 0.14760330668633101},
+    {-13.613568162222437, 16.318743479141503, -51.522846542354976,
+     -1.8923343949358751, 0.21055046273511308},
+    {-13.548118315480984, 12.96810867729495, -50.847794294936932,
+     -1.8765629702552438, 0.27098469780426132},
+    {-13.482668468739529, 9.6649737656565282, -50.072302983717989,
+     -1.8569136777268529, 0.32907627103464954},
+    {-13.449943545368802, 8.0332300960878129, -49.648624886042143,
+     -1.8456815345941573, 0.3572920751511624},
+    {-13.417218621998074, 6.4157305655548056, -49.201872925573504,
+     -1.8335347403859483, 0.3849785089853211},
+    {-13.384493698627347, 4.813219807319288, -48.732682979594891,
+     -1.8204903404225403, 0.41215244032641146},
+    {-13.35176877525662, 3.2264219563737293, -48.241672080787048,
+     -1.8065648414383901, 0.43882992596522064},
+    {-13.319043851885892, 1.6560412518938461, -47.729439278438846,
+     -1.7917742372955945, 0.46502626155076165},
+    {-13.286318928515165, 0.1027626123596809, -47.19656644784213,
+     -1.7761340331274384, 0.49075602773878302},
+    {-13.253594005144439, -1.4327478150056081, -46.643619051664935,
+     -1.7596592680279786, 0.51603313295400877},
+    {-13.220869081773712, -2.9498421289847383, -46.071146856771222,
+     -1.742364536393636, 0.5408708530562284},
+    {-13.188144158402984, -4.4478901718782664, -45.479684609663195,
+     -1.7242640080137912, 0.56528186817199133},
+    {-13.155419235032259, -5.9262790484932459, -44.869752673455586,
+     -1.7053714469991788, 0.58927829692849532},
+    {-13.089969388290804, -8.8217112891616072, -43.596492842975586,
+     -1.6652633611952286, 0.63607325128669023},
+    {-13.024519541549349, -11.631563900138296, -42.255264631454246,
+     -1.622142931900723, 0.68134259211208059},
+    {-12.959069694807896, -14.351510540462639, -40.849770369603142,
+     -1.5761073646347379, 0.72516603690236769},
+    {-12.893619848066443, -16.977461220376281, -39.383532454882179,
+     -1.5272488610244013, 0.76761689215702944},
+    {-12.828170001324988, -19.505550973604635, -37.859906830869996,
+     -1.4756550165362459, 0.80876270719372378},
+    {-12.762720154583533, -21.932129367185201, -36.282095130591664,
+     -1.4214091781038352, 0.84866584787678923},
+    {-12.69727030784208, -24.253750766798124, -34.653155643944771,
+     -1.364590766510748, 0.88738400161498521},
+    {-12.631820461100627, -26.467165285228923, -32.97601324705446,
+     -1.3052755677063042, 0.92497062316566125},
+    {-12.566370614359172, -28.569310350045232, -31.253468412594273,
+     -1.2435359966576975, 0.96147532928643387},
+    {-12.500920767617718, -30.557302833758992, -29.488205404220235,
+     -1.1794413368576113, 0.99694424903989443},
+    {-12.435470920876265, -32.428431696100958, -27.68279974478207,
+     -1.1130579581955793, 1.03142033553226},
+    {-12.370021074134812, -34.180151093477264, -25.839725036488595,
+     -1.0444495155516897, 1.0649436440137612},
+    {-12.304571227393357, -35.810073915493348, -23.961359201391062,
+     -0.97367713017282931, 1.0975515805553362},
+    {-12.239121380651902, -37.315965712591378, -22.049990202129599,
+     -0.90079955563587744, 1.1292791249179377},
+    {-12.173671533910449, -38.69573898256958, -20.107821295648982,
+     -0.82587332998255747, 1.1601590307268761},
+    {-12.108221687168996, -39.947447786942348, -18.136975866345292,
+     -0.74895291542130127, 1.1902220056379571},
+    {-12.042771840427541, -41.069282671011905, -16.139501879699235,
+     -0.67009082682771526, 1.2194968738213203},
+    {-11.977321993686086, -42.059565864000071, -14.11737599276311,
+     -0.58933775013334222, 1.2480107227820165},
+    {-11.911872146944631, -42.916746737883017, -12.072507353788479,
+     -0.50674265156905041, 1.2757890362746112},
+    {-11.846422300203177, -43.639397505526389, -10.006741119722385,
+     -0.42235287862187559, 1.3028558148451774},
+    {-11.780972453461724, -44.22620914051253, -7.9218617171887091,
+     -0.33621425347026201, 1.3292336853419271},
+    {-11.71552260672027, -44.675987502636794, -5.8195958698420336,
+     -0.24837115958035841, 1.354944000570462},
+    {-11.650072759978816, -44.98764965446167, -3.7016154125855754,
+     -0.1588666220738825, 1.3800069301270743},
+    {-11.584622913237363, -45.160220355594802, -1.569539911033351,
+     -0.067742382414532024, 1.404441543320289},
+    {-11.51917306649591, -45.192828722488798, 0.57506089726629483,
+     0.024961032096083711, 1.4282658849839467},
+    {-11.453723219754455, -45.084705042601556, 2.7306648249749004,
+     0.11920424357143844, 1.4514970448923206},
+    {-11.388273373013002, -44.835177732657684, 4.8957951070656103,
+     0.21494896314428424, 1.474151221406846},
+    {-11.322823526271549, -44.443670431610919, 7.0690184107687362,
+     0.31215793456318519, 1.49624377991354},
+    {-11.257373679530094, -43.909699219645603, 9.2489429723994618,
+     0.41079488145700127, 1.5177893065483636},
+    {-11.126473986047184, -42.412875722977347, 13.623526290722443,
+     0.61221220252735109, 1.5592940053617008},
+    {-10.995574292564276, -40.342586231271788, 18.009178611275612,
+     0.81892851305885239, 1.5987682072428069},
+    {-10.864674599081368, -37.698029301961363, 22.396097363658235,
+     1.0306842215758525, 1.6363051256503161},
+    {-10.733774905598459, -34.479652078316256, 26.77500148556069,
+     1.2472313664596946, 1.6719894095709775},
+    {-10.602875212115551, -30.689084535569492, 31.13709378393774,
+     1.4683325589062117, 1.7058980981927898},
+    {-10.471975518632643, -26.329078379693225, 35.474027388604846,
+     1.6937600420038412, 1.7381014442447069},
+    {-10.406525671891188, -23.936688360664505, 37.6305669725622,
+     1.8080273935327522, 1.7535838895083691},
+    {-10.341075825149735, -21.40345009945862, 39.777875758969223,
+     1.9232948501464668, 1.7686636267872899},
+    {-10.275625978408282, -18.72999829763468, 41.915024195194228,
+     2.0395362911840316, 1.7833478310192958},
+    {-10.210176131666827, -15.917027737305714, 44.041105788064243,
+     2.1567260554629857, 1.7976433705140451},
+    {-10.144726284925373, -12.965291794928156, 46.155236406159005,
+     2.2748389217136249, 1.8115568221566549},
+    {-10.079276438183919, -9.8756009996101177, 48.256553616881284,
+     2.3938500899761079, 1.8250944856371725},
+    {-10.013826591442466, -6.6488216337187964, 50.344216056190632,
+     2.5137351638989522, 1.8382623967778746},
+    {-9.9483767447010116, -3.2858743737357154, 52.417402829043631,
+     2.6344701338820768, 1.8510663400242533},
+    {-9.8829268979595568, 0.21226703061256375, 54.475312938724699,
+     2.7560313610116731, 1.8635118601599441},
+    {-9.8174770512181038, 3.8445770407646065, 56.517164743380597,
+     2.8783955617379431, 1.8756042733008707},
+    {-9.7520272044766507, 7.6099795790184874, 58.542195438191072,
+     3.0015397932502372, 1.8873486772192778},
+    {-9.6865773577351959, 11.507349245128651, 60.549660561715363,
+     3.1254414395071941, 1.8987499610442049},
+    {-9.6211275109937411, 15.535512501345831, 62.538833525057939,
+     3.2500781978825715, 1.9098128143811754},
+    {-9.555677664252288, 19.693248827360168, 64.509005162587428,
+     3.3754280663900524, 1.9205417358904853},
+    {-9.490227817510835, 23.979291846501805, 66.459483303028165,
+     3.5014693314527632, 1.9309410413603021},
+    {-9.4575028941401076, 26.170020355382295, 67.427125554023092,
+     3.5647425281678267, 1.9360183886398803},
+    {-9.4247779707693802, 28.392330424515801, 68.389592359921366,
+     3.6281805561907823, 1.9410716614215482},
+    {-9.4247779507693785, 28.392331792222109, 68.376737961200334,
+     3.6274986168569887, -34096.962571051095},
+    {-9.4247759533985676, 28.392468148006536, 68.207519953882411,
+     3.6185220896039882, -2404.7845486304868},
+    {-9.4247739560277566, 28.392604304477743, 68.132458221277787,
+     3.6145407061833374, -1701.9941020501303},
+    {-9.4247719586569456, 28.392740330773659, 68.074831995591254,
+     3.6114843040346676, -1389.8953265282644},
+    {-9.4247699612861346, 28.392876251773153, 68.026245541975229,
+     3.6089074758007222, -1203.6755305918823},
+    {-9.4247679639153237, 28.393012081866743, 67.983440049437618,
+     3.6066373363103632, -1076.5298594897272},
+    {-9.4247659665445127, 28.393147830771603, 67.944742600391535,
+     3.604585134611185, -982.6456155154259},
+    {-9.4247639691737, 28.393283505623412, 67.909158841985715,
+     3.6026981187062836, -909.66322204240873},
+    {-9.424761971802889, 28.393419111953204, 67.876040653379732,
+     3.6009419047638578, -850.82462446891805},
+    {-9.4247579770612653, 28.393690136070578, 67.815522125704675,
+     3.5977328166282652, -760.84322557300914},
+    {-9.4247539823196433, 28.393960930632556, 67.760817707836637,
+     3.5948321746621961, -694.41136018918519},
+    {-9.4247499875780214, 28.39423151583539, 67.710519521782714,
+     3.5921652887888968, -642.77501018952717},
+    {-9.4247459928363995, 28.394501907328724, 67.663710083239934,
+     3.5896834850864976, -601.1488868048574},
+    {-9.4247380033531556, 28.395042157376931, 67.578181212421001,
+     3.5851490613520438, -537.49552170026118},
+    {-9.4247300138699099, 28.395581758615286, 67.500877938884088,
+     3.5810510136389251, -490.50487300738791},
+    {-9.4247220243866643, 28.396120768185906, 67.429808049525235,
+     3.5772836522419018, -453.98178668979119},
+    {-9.4247140349034204, 28.39665923036889, 67.363673383212941,
+     3.5737781079478266, -424.54020706654308},
+    {-9.4246980559369309, 28.397734648913591, 67.242847809662464,
+     3.5673741169513624, -379.52086528873053},
+    {-9.4246820769704414, 28.398808234448765, 67.133657390914067,
+     3.5615873746530737, -346.28763156598359},
+    {-9.4246660980039518, 28.399880148633876, 67.03328387018756,
+     3.5562683692520696, -320.45805358538081},
+    {-9.4246501190374623, 28.400950516727843, 66.939890906512943,
+     3.5513196808917455, -299.63699711180362},
+    {-9.4246341400709728, 28.402019439508269, 66.852202927090957,
+     3.5466736391842324, -282.39033209883507},
+    {-9.4246181611044832, 28.403087000348062, 66.769291169352712,
+     3.5422809724488582, -267.79997634448102},
+    {-9.4245862031715042, 28.405218308206642, 66.615148111586095,
+     3.5341152744281321, -244.29834534592538},
+    {-9.4245542452385251, 28.407344897601739, 66.473475486574443,
+     3.5266111137382534, -226.03259658895144},
+    {-9.4245222873055443, 28.409467122860097, 66.341675961501423,
+     3.5196307005852709, -211.30881835258526},
+    {-9.4244903293725635, 28.411585269056914, 66.217945384496218,
+     3.513078324146611, -199.11277450327512},
+    {-9.4244583714395844, 28.413699572031476, 66.100970141112711,
+     3.5068842970026188, -188.79519652214779},
+    {-9.4243944555736263, 28.417917417729502, 65.883540142679465,
+     3.4953725914833531, -172.17608212462105},
+    {-9.4243305397076682, 28.422121953532571, 65.683748020327201,
+     3.4847964926304797, -159.2595595433003},
+    {-9.4242666238417101, 28.426314181746498, 65.497920265298873,
+     3.4749611232136006, -148.8477447157415},
+    {-9.424202707975752, 28.430494908789207, 65.32350520612971,
+     3.4657311196652256, -140.22340825305247},
+    {-9.4241387921097939, 28.434664801804452, 65.158644958559165,
+     3.4570079237962932, -132.92741597231262},
+    {-9.4240748762438358, 28.438824424691241, 65.001936951036328,
+     3.4487171316355365, -126.65041156941788},
+    {-9.4240109603778777, 28.442974262296875, 64.852291511291952,
+     3.4408009383666691, -121.17533512012015},
+    {-9.4238831286459614, 28.451246222599828, 64.570886007868623,
+     3.4259171684542249, -112.04149512712836},
+    {-9.4237552969140435, 28.459483518170366, 64.309232880720671,
+     3.4120810045746701, -104.67882189247548},
+    {-9.4236274651821255, 28.46768843036465, 64.063723198975609,
+     3.3991010062565903, -98.580134945538859},
+    {-9.4234996334502092, 28.475862846570084, 63.831729268628429,
+     3.3868377859350449, -93.420763994496696},
+    {-9.423371801718293, 28.484008362140095, 63.611267354076112,
+     3.3751861166338037, -88.981952620619637},
+    {-9.4232439699863768, 28.492126348793509, 63.400796260688061,
+     3.3640642470163975, -85.110210609702747},
+    {-9.4231161382544606, 28.500218002485859, 63.199090334356121,
+     3.3534071642071011, -81.694238822399427},
+    {-9.4229883065225426, 28.508284378038319, 63.005155801139857,
+     3.3431621557636881, -78.651100990318724},
+    {-9.4227326430587084, 28.524344956830333, 62.637459337239996,
+     3.3237417270552676, -73.444442574846391},
+    {-9.4224769795948742, 28.54031454026083, 62.292602360577746,
+     3.3055322127863698, -69.131592545799251},
+    {-9.42222131613104, 28.556198468951798, 61.966868176376373,
+     3.2883364812439608, -65.482966660085765},
+    {-9.4219656526672075, 28.572001257382016, 61.657450880872794,
+     3.2720057127048938, -62.343875553079776},
+    {-9.4217099892033733, 28.587726787394018, 61.362170489343214,
+     3.2564242881419618, -59.605781523837557},
+    {-9.4214543257395391, 28.603378443589847, 61.079293313835088,
+     3.2415002611096697, -57.189981422384918},
+    {-9.4211986622757067, 28.618959211313324, 60.807413637959051,
+     3.2271590812241144, -55.037828321163602},
+    {-9.4209429988118725, 28.63447174953534, 60.545372909723405,
+     3.2133393078250827, -53.104605015099999},
+    {-9.4206873353480383, 28.649918446376237, 60.292202862444711,
+     3.1999895929152644, -51.355539800264175},
+    {-9.4201760084203698, 28.68062276380337, 59.809317433961276,
+     3.1745329057811551, -48.305307214307597},
+    {-9.4196646814927032, 28.711087281754043, 59.353499619272931,
+     3.1505102159256149, -45.724783114765849},
+    {-9.4191533545650366, 28.741324780986304, 58.920779980535748,
+     3.1277110459179176, -43.504580618640013},
+    {-9.4186420276373681, 28.771346252280257, 58.508074447238265,
+     3.1059718734163848, -41.567948223961025},
+    {-9.4181307007096997, 28.801161279481988, 58.112930251669582,
+     3.0851626558596443, -39.859231479363018},
+    {-9.4176193737820313, 28.830778316696883, 57.733358562940182,
+     3.0651779537653465, -38.336958419063414},
+    {-9.4171080468543629, 28.860204894508886, 57.367720187083364,
+     3.0459308686729019, -36.969507314741762},
+    {-9.4165967199266962, 28.889447777046602, 57.014645111706876,
+     3.0273487761802924, -35.732289297868569},
+    {-9.4155740660713612, 28.947406386956242, 56.341717266576879,
+     2.9919427573514592, -33.574600790855904},
+    {-9.4145514122160243, 29.004696977062885, 55.707135194728423,
+     2.958565562797002, -31.749087605628329},
+    {-9.4135287583606893, 29.061355762796591, 55.105281652733623,
+     2.9269194935954008, -30.17839533412095},
+    {-9.4125061045053542, 29.11741389335047, 54.531792003509054,
+     2.896773260917572, -28.808247691665745},
+    {-9.4114834506500191, 29.172898535550885, 53.983194805515524,
+     2.8679429278381767, -27.599287263397652},
+    {-9.4104607967946841, 29.227833658231617, 53.456675042628333,
+     2.8402793549087586, -26.522185895410896},
+    {-9.409438142939349, 29.282240615822161, 52.94991242107811,
+     2.8136596264682736, -25.554581148803898},
+    {-9.4084154890840139, 29.336138592815566, 52.460967543844419,
+     2.7879810157571985, -24.679083984734188},
+    {-9.4073928352286789, 29.389544949065534, 51.988199697913373,
+     2.7631566263092924, -23.881941396925868},
+    {-9.4063701813733438, 29.442475492679506, 51.530206142534155,
+     2.7391121733958097, -23.152113858202728},
+    {-9.4053475275180087, 29.494944698938973, 51.085776400485635,
+     2.7157835609486902, -22.480623623769414},
+    {-9.4043248736626737, 29.546965888257045, 50.653857255135655,
+     2.6931150260979688, -21.860084663184065},
+    {-9.4022795659520035, 29.649712576645957, 49.823966694233569,
+     2.649568455433859, -20.748290105033544},
+    {-9.4002342582413334, 29.750804006116901, 49.034353153189947,
+     2.6081452762839796, -19.778344490640809},
+    {-9.3981889505306633, 29.850317344352256, 48.280099616554693,
+     2.5685852812008312, -18.922412713743931},
+    {-9.3961436428199931, 29.948320699024713, 47.557218295265969,
+     2.5306774833953574, -18.159752418049891},
+    {-9.394098335109323, 30.044874770126153, 46.862421779435735,
+     2.494247989947743, -17.474547497268798},
+    {-9.3920530273986511, 30.140034108473003, 46.192961939362483,
+     2.4591514658513756, -16.854499143162734},
+    {-9.3900077196879792, 30.233848093497723, 45.546513561861005,
+     2.4252649689714243, -16.28988005958713},
+    {-9.3879624119773091, 30.326361706081084, 44.921088414019081,
+     2.392483397499976, -15.772882027035051},
+    {-9.3859171042666389, 30.417616148579985, 44.314970539630167,
+     2.3607160625510701, -15.297155014582524},
+    {-9.3838717965559688, 30.507649348868291, 43.726666707453923,
+     2.3298840636070022, -14.857474738917043},
+    {-9.3818264888452987, 30.59649637486789, 43.154867887438066,
+     2.2999182482615654, -14.449498400266798},
+    {-9.3797811811346286, 30.684189779061644, 42.598418895379147,
+     2.2707576047219802, -14.069582223736184},
+    {-9.3756905657132883, 30.856235044221513, 41.527578321661608,
+     2.214641045936772, -13.382052487212356},
+    {-9.371599950291948, 31.024005190194426, 40.507169480445462,
+     2.1611661666791253, -12.775195816228839},
+    {-9.367509334870606, 31.187694553483365, 39.531533538100412,
+     2.1100343818684042, -12.234339216874883},
+    {-9.363418719449264, 31.347476444164084, 38.596004229499016,
+     2.0609995871128333, -11.748294125108258},
+    {-9.3593281040279237, 31.503506713242654, 37.696679675608152,
+     2.0138560832900407, -11.308359886370564},
+    {-9.3552374886065834, 31.655926524755216, 36.830257545373129,
+     1.9684298549463555, -10.907654810041972},
+    {-9.3511468731852432, 31.80486454714276, 35.993913306162895,
+     1.9245721297232943, -10.540654699578218},
+    {-9.3470562577639029, 31.950438711661544, 35.185208544739339,
+     1.8821545294281077, -10.202866858871264},
+    {-9.3429656423425609, 32.092757642044916, 34.402020748782725,
+     1.8410653568537103, -9.8905949470645655},
+    {-9.3388750269212188, 32.231921830520982, 33.642488709483636,
+     1.8012067091861854, -9.6007662003283318},
+    {-9.3347844114998786, 32.368024615308137, 32.904969495754074,
+     1.762492203634461, -9.330802368856693},
+    {-9.3306937960785383, 32.501153000731627, 32.188004135824386,
+     1.7248451636764788, -9.0785218710641011},
+    {-9.3266031806571981, 32.631388351158989, 31.490289944082356,
+     1.6881971567843308, -8.842064616468992},
+    {-9.3225125652358578, 32.758806982666471, 30.810657984544342,
+     1.6524868037957339, -8.6198335408415989},
+    {-9.3184219498145158, 32.883480671070473, 30.148054551207821,
+     1.6176588006839463, -8.4104486330662969},
+    {-9.3143313343931737, 33.005477090940424, 29.501525823110534,
+     1.5836631081705315, -8.2127104171090419},
+    {-9.3102407189718335, 33.124860197216876, 28.870205053004881,
+     1.5504542752678221, -8.0255706735716021},
+    {-9.302059488129153, 33.356025651229601, 27.650092795757335,
+     1.486235001562991, -7.6795123302081034},
+    {-9.2938782572864707, 33.577425988245565, 26.482155035011939,
+     1.4247095938796988, -7.3661155468164683},
+    {-9.2856970264437884, 33.789468274387957, 25.361681040363049,
+     1.3656315173830305, -7.080509357891887},
+    {-9.2775157956011078, 33.992523916055312, 24.284639299902583,
+     1.308789973250007, -6.818783399217148},
+    {-9.2693345647584255, 34.18693366007674, 23.247547372514042,
+     1.2540030360377823, -6.577757259392464},
+    {-9.2611533339157432, 34.373011660376207, 22.247372182370967,
+     1.201112398220302, -6.3548141028406206},
+    {-9.2529721030730627, 34.551048824240041, 21.281452476241075,
+     1.149979284449218, -6.1477784161354414},
+    {-9.2447908722303804, 34.721315594619306, 20.347437701315158,
+     1.1004812322166773, -5.9548246828568319},
+    {-9.2366096413876981, 34.884064285250695, 19.44323924136366,
+     1.0525095243952807, -5.7744081452759435},
+    {-9.2284284105450176, 35.039531057115376, 18.566991086133097,
+     1.0059671192181117, -5.6052116050903509},
+    {-9.2202471797023353, 35.187937604201473, 17.717017793769035,
+     0.96076696472800016, -5.446104049141403},
+    {-9.212065948859653, 35.329492601433074, 16.891808157463323,
+     0.91683061385130082, -5.2961081140691153},
+    {-9.2038847180169725, 35.464392956300479, 16.089993381199605,
+     0.874087077041654, -5.154374241446134},
+    {-9.1957034871742902, 35.592824897216104, 15.310328854693488,
+     0.83247186449887023, -5.0201599558306311},
+    {-9.1875222563316079, 35.714964925035218, 14.551678827053863,
+     0.79192618102369927, -4.8928131072510723},
+    {-9.1793410254889274, 35.830980649152707, 13.813003434380613,
+     0.75239624478625788, -4.771758211782303},
+    {-9.1711597946462451, 35.941031525597417, 13.093347653588287,
+     0.71383270746365457, -4.6564852352333244},
+    {-9.1629785638035628, 36.045269511463999, 12.39183184370289,
+     0.67619015789550352, -4.5465403197234524},
+    {-9.1547973329608805, 36.143839647506617, 11.70764360414233,
+     0.63942669500668226, -4.4415180675022148},
+    {-9.1466161021181982, 36.236880578758239, 11.04003073235595,
+     0.60350355853457482, -4.3410550820821321},
+    {-9.1384348712755177, 36.324525021412292, 10.38829510448347,
+     0.56838480827480586, -4.2448245314965529},
+    {-9.1302536404328354, 36.406900182924979, 9.7517873351942672,
+     0.53403704427273535, -4.1525315478408418},
+    {-9.1220724095901531, 36.484128141194837, 9.1299020986466175,
+     0.50042916174663521, -4.0639093151858416},
+    {-9.1138911787474726, 36.556326187841336, 8.5220740130921779,
+     0.46753213561319767, -3.9787157273408926},
+    {-9.1057099479047903, 36.623607139826284, 7.9277740082042616,
+     0.4353188303581112, -3.8967305198849851},
+    {-9.097528717062108, 36.686079623106309, 7.3465061075995655,
+     0.40376383169978025, -3.8177527989195359},
+    {-9.0893474862194275, 36.743848331457322, 6.7778045699152774,
+     0.37284329706787345, -3.7415989032684571},
+    {-9.0811662553767452, 36.797014263216468, 6.2212313407233051,
+     0.34253482238803085, -3.6681005482182067},
+    {-9.0729850245340629, 36.845674938299545, 5.6763737748948877,
+     0.31281732304999554, -3.5971032079966934},
+    {-9.0648037936913823, 36.889924597589804, 5.1428425950918424,
+     0.2836709272555345, -3.5284647015269153},
+    {-9.0566225628487, 36.929854386469756, 4.6202700570963318,
+     0.25507688020748526, -3.4620539519345401},
+    {-9.0484413320060177, 36.965552524113001, 4.1083082968952747,
+     0.22701745782245528, -3.3977498951281553},
+    {-9.0402601011633372, 36.997104459921971, 3.6066278379517969,
+     0.19947588883464101, -3.3354405167295691},
+    {-9.0320788703206549, 37.024593018340184, 3.1149162400626378,
+     0.1724362843142474, -3.2750219998864831},
+    {-9.0238976394779726, 37.048098533137953, 2.6328768737018158,
+     0.14588357375550451, -3.2163979691869051},
+    {-9.0157164086352921, 37.067698972131929, 2.1602278058706998,
+     0.11980344700070782, -3.1594788181223197},
+    {-9.0075351777926098, 37.083470053208963, 1.6967007852818996,
+     0.094182301361696918, -3.1041811094017233},
+    {-8.9993539469499275, 37.095485352409547, 1.242040316246074,
+     0.069007193381199761, -3.0504270389689667},
+    {-8.991172716107247, 37.103816404772324, 0.79600281194850209,
+     0.044265794745689951, -2.998143955875761},
+    {-8.9829914852645647, 37.108532798544793, 0.35835581893949858,
+     0.019946351921146476, -2.9472639312579725},
+    {-8.9748102544218824, 37.109702263314851, -0.071122694359756836,
+     -0.0039623508655636892, -2.8977233705875345},
+    {-8.9666290235792019, 37.107390752563894, -0.49264499149045871,
+     -0.027471025632652416, -2.8494626641559835},
+    {-8.9584477927365196, 37.101662521086276, -0.90641416974970224,
+     -0.050589911931206426, -2.8024258714121877},
+    {-8.9502665618938373, 37.092580197677769, -1.3126247149260271,
+     -0.073328805675720643, -2.7565604353454041},
+    {-8.9420853310511568, 37.08020485347182, -1.7114630134084798,
+     -0.095697085749420749, -2.7118169235905234},
+    {-8.9339041002084745, 37.06459606623325, -2.103107825612359,
+     -0.11770373859079607, -2.6681487933497259},
+    {-8.9175416385231117, 37.0239093668932, -2.8654965005231636,
+     -0.16066628094812777, -2.5838656902320234},
+    {-8.9011791768377471, 36.970969071980441, -3.6010841792524464,
+     -0.20228129934868785, -2.5033889104561462},
+    {-8.8848167151523825, 36.906203798814673, -4.3110672412837099,
+     -0.24260867609860265, -2.4264306028198779},
+    {-8.8684542534670197, 36.8300233132234, -4.9965551111669892,
+     -0.28170383295452212, -2.3527327030565752},
+    {-8.8520917917816568, 36.742819878815304, -5.6585790432985705,
+     -0.31961818609653564, -2.282063080542672},
+    {-8.8357293300962922, 36.644969471894207, -6.2980997916680028,
+     -0.35639954305839777, -2.214212277489497},
+    {-8.8193668684109277, 36.536832878824214, -6.916014333184032,
+     -0.39209245042043245, -2.1489907358567977},
+    {-8.8030044067255648, 36.418756690161842, -7.5131617838286555,
+     -0.42673849953366721, -2.0862264280364746},
+    {-8.786641945040202, 36.291074203787524, -8.0903286232765375,
+     -0.46037659630840466, -2.025762823601319},
+    {-8.7702794833548374, 36.154106247534791, -8.6482533245106605,
+     -0.49304320010121849, -1.9674571371858436},
+    {-8.7539170216694728, 36.008161930375188, -9.1876304694147315,
+     -0.52477253592144202, -1.9111788126744689},
+    {-8.73755455998411, 35.853539329999009, -9.7091144185942095,
+     -0.55559678351306718, -1.8568082069228944},
+    {-8.7211920982987472, 35.690526123587858, -10.213322593205607,
+     -0.58554624632095487, -1.8042354426884595},
+    {-8.7048296366133826, 35.519400167727582, -10.70083841791398,
+     -0.6146495028980915, -1.7533594056422863},
+    {-8.672104713242657, 35.153875495341843, -11.627972348868424,
+     -0.67042388978029965, -1.6563316971037381},
+    {-8.6393797898719296, 34.759011058473298, -12.494597944637684,
+     -0.72311891874954282, -1.5650605183794497},
+    {-8.6066548665012022, 34.336725723077265, -13.304397743685533,
+     -0.77291339957576732, -1.4789749930593199},
+    {-8.5739299431304765, 33.888823620612662, -14.060709495321335,
+     -0.81996876511610206, -1.3975815817203903},
+    {-8.5412050197597491, 33.417004669982674, -14.766571312234396,
+     -0.86443138164184685, -1.3204510916946421},
+    {-8.5084800963890217, 32.922873747270913, -15.424759429262778,
+     -0.90643447798679155, -1.2472082595108285},
+    {-8.4757551730182943, 32.407948720779856, -16.037820000975085,
+     -0.94609976772511417, -1.1775233245788486},
+    {-8.4430302496475669, 31.873667527484169, -16.608096053207401,
+     -0.98353882208941901, -1.1111051592456926},
+    {-8.4103053262768412, 31.32139443456709, -17.137750464830894,
+     -1.0188542389350808, -1.0476956263984356},
+    {-8.3775804029061138, 30.752425604147188, -17.628785674379348,
+     -1.0521406436316665, -0.98706491344613378},
+    {-8.3448554795353864, 30.167994058976596, -18.083060666671006,
+     -1.0834855505297385, -0.92900764901523192},
+    {-8.3121305561646608, 29.569274130532655, -18.502305686458914,
+     -1.112970108051103, -0.87333965171500427},
+    {-8.2794056327939334, 28.957385457760239, -18.888135041652443,
+     -1.1406697460768409, -0.81989519283006818},
+    {-8.246680709423206, 28.333396593969269, -19.242058292093144,
+     -1.1666547408647632, -0.76852467957146775},
+    {-8.2139557860524786, 27.698328270622174, -19.565490067035732,
+     -1.1909907099973966, -0.71909268456345532},
+    {-8.1812308626817511, 27.05315635949772, -19.859758712260547,
+     -1.2137390476810634, -0.67147626200170518},
+    {-8.1485059393110255, 26.398814568703003, -20.126113933769446,
+     -1.23495730896351, -0.62556350244071135},
+    {-8.1157810159402981, 25.736196903034884, -20.365733577513957,
+     -1.254699550019486, -0.58125228722730526},
+    {-8.0503311691988451, 24.389524769213107, -20.769153763925985,
+     -1.2899564829947794, -0.49706864452463584},
+    {-7.9848813224573902, 23.019578960260034, -21.078218536200065,
+     -1.3198830192327222, -0.41826662142147392},
+    {-7.9194314757159363, 21.632289529908714, -21.300302951298544,
+     -1.3448126305918282, -0.34428817332731848},
+    {-7.8539816289744824, 20.23312748974946, -21.442077147550819,
+     -1.3650450281452069, -0.27465691232209372},
+    {-7.7885317822330284, 18.827147650752121, -21.509603842866355,
+     -1.380851002748261, -0.20896331419118985},
+    {-7.7230819354915745, 17.419025664841818, -21.508418746045184,
+     -1.3924764055138936, -0.14685307980932832},
+    {-7.6576320887501197, 16.013090263471284, -21.443597426844015,
+     -1.4001454482480917, -0.088017885135892468},
+    {-7.5921822420086658, 14.613351487076143, -21.319811349798556,
+     -1.4040634609528266, -0.032187960931105979},
+    {-7.5267323952672118, 13.223525543425952, -21.141375158453201,
+     -1.4044192119642009, 0.020873910990316172},
+    {-7.4612825485257579, 11.847056812186795, -20.912286836168029,
+     -1.4013868728439989, 0.07137729406106337},
+    {-7.395832701784304, 10.487137418390748, -20.636262022829506,
+     -1.395127692507893, 0.11950811958270099},
+    {-7.33038285504285, 9.1467247228432473, -20.316763502773568,
+     -1.3857914316710547, 0.16543201425886925},
+    {-7.2649330083013961, 7.8285570179399242, -19.957026676282702,
+     -1.3735175984058265, 0.20929707037212725},
+    {-7.1994831615599413, 6.5351676695993008, -19.560081669588978,
+     -1.3584365176396089, 0.25123616576050617},
+    {-7.1340333148184873, 5.2688979073054698, -19.128772615152663,
+     -1.340670261198476, 0.29136891764790301},
+    {-7.0685834680770334, 4.0319084327912762, -18.665774536861505,
+     -1.3203334601026802, 0.32980333676923834},
+    {-7.035858544706306, 3.425022280600841, -18.423185508874543,
+     -1.3092350700211222, 0.34841460193202894},
+    {-7.0031336213355795, 2.8261899920235569, -18.173608197633111,
+     -1.2975340169339216, 0.36663723468858006},
+    {-6.970408697964853, 2.2356354390534579, -17.9173357447178,
+     -1.2852428402045577, 0.38448206512496969},
+    {-6.9376837745941256, 1.6535730338955479, -17.654653205167953,
+     -1.2723737329899274, 0.4019594267124979},
+    {-6.9049588512233981, 1.0802079881236351, -17.385837878636472,
+     -1.2589385580158892, 0.4190791850542479},
+    {-6.8722339278526716, 0.51573656131618217, -17.111159621882098,
+     -1.2449488624457177, 0.43585076460514838},
+    {-6.8395090044819451, -0.039653700256705969, -16.830881143884046,
+     -1.2304158919050134, 0.45228317353230013},
+    {-6.8067840811112177, -0.58578373432197051, -16.545258284759438,
+     -1.2153506037213979, 0.46838502686668138},
+    {-6.7740591577404903, -1.1224827421804864, -16.254540279570442,
+     -1.1997636794326578, 0.4841645680833358},
+    {-6.7413342343697638, -1.6495879766814716, -15.958970008021147,
+     -1.1836655366126587, 0.49962968923459139},
+    {-6.7086093109990372, -2.1669445381456707, -15.658784230967356,
+     -1.1670663400605357, 0.51478794974958331},
+    {-6.6758843876283098, -2.6744051778264444, -15.354213814590501,
+     -1.1499760123950615, 0.52964659400324554},
+    {-6.6104345408868559, -3.6590868219512056, -14.732814320150519,
+     -1.1143605030066575, 0.5584925334996137},
+    {-6.544984694145402, -4.6026009075936551, -14.096508375221759,
+     -1.0768939144984802, 0.58621976042811597},
+    {-6.479534847403948, -5.5040264027811823, -13.446951055405272,
+     -1.0376478691825268, 0.6128764356702987},
+    {-6.4140850006624941, -6.3625480730451409, -12.785721077159353,
+     -0.99669096027249016, 0.63850702239262358},
+    {-6.3486351539210402, -7.1774516469483238, -12.114325705757166,
+     -0.95408898228110672, 0.66315263389769785},
+    {-6.2831853071795862, -7.9481192878000115, -11.434205213032925,
+     -0.90990513999065414, 0.68685134148837224},
+    {-6.2177354604381323, -8.6740253437945203, -10.746736934876793,
+     -0.8642002384353229, 0.70963844765120687},
+    {-6.1522856136966784, -9.3547323517952261, -10.05323897194287,
+     -0.81703285601383635, 0.73154672906710294},
+    {-6.0868357669552244, -9.9898872727243297, -9.3549735714974034,
+     -0.76845950257805107, 0.75260665329174048},
+    {-6.0213859202137705, -10.579217938754335, -8.6531502235985993,
+     -0.7185347641105353, 0.77284657239233956},
+    {-5.9559360734723157, -11.122529694616821, -7.9489285007350219,
+     -0.66731143540471127, 0.79229289636058942},
+    {-5.8904862267308618, -11.619702217063669, -7.243420666551053,
+     -0.61484064198984223, 0.81097024872849865},
+    {-5.8250363799894078, -12.070686498152954, -6.5376940762661802,
+     -0.56117195239543449, 0.82890160648179501},
+    {-5.759586533247953, -12.475501979356201, -5.8327733887794695,
+     -0.50635348172208505, 0.84610842608377779},
+    {-5.6941366865064991, -12.834233824791152, -5.1296426081773534,
+     -0.45043198737511536, 0.86261075718294111},
+    {-5.6286868397650451, -13.147030322914681, -4.4292469703846074,
+     -0.39345295772126265, 0.87842734537324307},
+    {-5.5632369930235912, -13.414100407017127, -3.7324946889710451,
+     -0.33546069434500697, 0.89357572520086059},
+    {-5.4977871462821373, -13.635711285712146, -3.0402585726135509,
+     -0.27649838850795788, 0.90807230446109377},
+    {-5.4323372995406833, -13.812186175399898, -2.3533775253866738,
+     -0.21660819235080056, 0.92193244069977431},
+    {-5.3668874527992294, -13.943902127369132, -1.6726579398875405,
+     -0.15583128532117116, 0.93517051072192126},
+    {-5.3014376060577755, -14.031287942810811, -0.99887499217209463,
+     -0.09420793626154475, 0.94779997381378367},
+    {-5.2359877593163215, -14.074822169598805, -0.33277384657037579,
+     -0.031777561547797338, 0.95983342930060311},
+    {-5.2032628359455941, -14.080307610341672, -0.0028288847823487733,
+     -0.00027183758264199594, 0.96563036933842283},
+    {-5.1705379125748676, -14.07503117517958, 0.32492922235644944,
+     0.031421220369181907, 0.97128266898945981},
+    {-5.1050880658334137, -14.032487290355473, 0.97354578416890136,
+     0.095350537700270646, 0.98215872498297552},
+    {-5.0396382190919589, -13.947807019179368, 1.6124142772989165,
+     0.15997321704467915, 0.99247191329397633},
+    {-4.9741883723505049, -13.821649310515241, 2.2408990988493653,
+     0.22525273784418925, 1.0022318736424358},
+    {-4.908738525609051, -13.654713887180614, 2.8583897546019887,
+     0.2911531893265118, 1.0114476057731319},
+    {-4.8432886788675971, -13.447739628868103, 3.4643000648440809,
+     0.35763922972004886, 1.0201275025946301},
+    {-4.7778388321261431, -13.201503005331837, 4.058067422030069,
+     0.42467604754095745, 1.0282793804067512},
+    {-4.7123889853846892, -12.916816556561992, 4.6391520966576936,
+     0.49222932476986331, 1.0359105064541074},
+    {-4.6469391386432353, -12.594527416902016, 5.2070365880663889,
+     0.5602652017502735, 1.0430276240168723},
+    {-4.5814892919017813, -12.235515880263842, 5.7612250171607027,
+     0.62875024365376309, 1.0496369752264749},
+    {-4.5160394451603274, -11.840694003804956, 6.3012425583283633,
+     0.69765140836858408, 1.0557443217728315},
+    {-4.4505895984188735, -11.411004247557001, 6.8266349080643822,
+     0.76693601567864489, 1.0613549636508186},
+    {-4.3851397516774195, -10.947418147704379, 7.3369677880314592,
+     0.83657171760887394, 1.0664737560765678},
+    {-4.3196899049359656, -10.45093502131652, 7.8318264804864635,
+     0.9065264698210509, 1.071105124688708},
+    {-4.2542400581945117, -9.9225807004724071, 8.3108153941838943,
+     0.97676850395120651, 1.0752530791354802},
+    {-4.1887902114530577, -9.3634062938548457, 8.7735576590334077,
+     1.0472663007859173, 1.0789212251357256},
+    {-4.1233403647116038, -8.7744869739710563, 9.2196947479399842,
+     1.1179885641801524, 1.0821127750896842},
+    {-4.057890517970149, -8.1569207882798125, 9.6488861243945099,
+     1.1889041956239257, 1.0848305573044612},
+    {-3.9924406712286951, -7.5118274925674946, 10.060808914511107,
+     1.259982269368932, 1.0870770238884284},
+    {-3.9269908244872411, -6.8403474050295907, 10.455157602325597,
+     1.3311920080295525, 1.0888542573589408},
+    {-3.8615409777457872, -6.1436402795639369, 10.831643747279237,
+     1.4025027585751941, 1.0901639759981649},
+    {-3.7960911310043333, -5.4228841968468302, 11.189995722913872,
+     1.4738839686329304, 1.0910075379826072},
+    {-3.7306412842628793, -4.6792744718510351, 11.52995847589956,
+     1.5453051630207477, 1.0913859443027891},
+    {-3.6651914375214254, -3.9140225764867673, 11.851293304605296,
+     1.6167359204325351, 1.0912998404805283},
+    {-3.5997415907799715, -3.1283550761164558, 12.15377765650698,
+     1.6881458501960926, 1.0907495170821842},
+    {-3.5342917440385175, -2.3235125787295767, 12.437204943806664,
+     1.7595045690250635, 1.0897349090168567},
+    {-3.4688418972970636, -1.5007486956058169, 12.701384376712461,
+     1.8307816776846235, 1.0882555935990208},
+    {-3.4033920505556097, -0.66132901232293895, 12.946140813901472,
+     1.9019467374891459, 1.0863107873448519},
+    {-3.3706671271848827, -0.2357717642083352, 13.06118492330671,
+     1.9374777203548967, 1.0851634805770787},
+    {-3.3379422038141557, 0.19346993100136206, 13.171314629757507,
+     1.972969246547631, 1.0838993414608644},
+    {-3.2724923570727014, 1.0623616513049743, 13.376761598043835,
+     2.0438186156696743, 1.0810197359718947},
+    {-3.207042510331247, 1.9440507271147522, 13.562352791737448,
+     2.1144641438408356, 1.0776700724229784},
+    {-3.17431758696052, 2.3892872558523428, 13.647666345747284,
+     2.1497008367734289, 1.0758182699841465},
+    {-3.1415926635897931, 2.8372337970245369, 13.727974498816895,
+     2.1848749931715203, 1.0739001338199765},
+    {-3.1415926435897932, 2.8372340715675568, 13.725500603408587,
+     2.1844812743966888, -19685.938455872001},
+    {-3.1415906462189822, 2.8372614445370097, 13.69292807526867,
+     2.1792985810784424, -1388.449360662652},
+    {-3.1415886488481708, 2.8372887791361818, 13.678475945985806,
+     2.1769998358952676, -982.69292405410158},
+    {-3.1415866514773594, 2.837316088669906, 13.667379291537635,
+     2.1752351292157464, -802.50247159903017},
+    {-3.1415846541065484, 2.8373433779266977, 13.658022350095212,
+     2.17374730492174, -694.98830400206805},
+    {-3.1415826567357374, 2.8373706496749387, 13.649777962086196,
+     2.1724365476776923, -621.58061237854395},
+    {-3.141580659364926, 2.8373979057869541, 13.642324173626136,
+     2.1712516170735445, -567.37642467255057},
+    {-3.1415786619941146, 2.8374251476329078, 13.635469620878627,
+     2.1701620567131563, -525.23993360161387},
+    {-3.1415766646233036, 2.8374523762793862, 13.629089572499435,
+     2.169148015067405, -491.26937289687373},
+    {-3.1415726698816813, 2.8375067972494761, 13.617429890814757,
+     2.1672950655201015, -439.31844082354399},
+    {-3.1415686751400589, 2.8375611739897511, 13.606889152636615,
+     2.1656201980098344, -400.96385242847896},
+    {-3.1415646803984365, 2.8376155103873413, 13.597196410171039,
+     2.1640802901512348, -371.15146955654012},
+    {-3.1415606856568141, 2.8376698094545945, 13.588175092289262,
+     2.1626472400052248, -347.11850222881412},
+    {-3.1415526961735694, 2.83777830487087, 13.571689419692955,
+     2.1600289303157889, -310.36800689502326},
+    {-3.1415447066903246, 2.8378866752189031, 13.556786813620647,
+     2.1576625640166318, -283.23775542124594},
+    {-3.1415367172070798, 2.8379949314969903, 13.54308386810416,
+     2.1554871209884134, -262.15096909643739},
+    {-3.1415287277238346, 2.8381030822255098, 13.530330748522553,
+     2.1534628394638027, -245.15270459198101},
+    {-3.1415127487573447, 2.8383190932781894, 13.507026976843173,
+     2.1497647880286346, -219.16048222756828},
+    {-3.1414967697908551, 2.8385347507557603, 13.485962531728715,
+     2.1464231097437261, -199.97300088028697},
+    {-3.1414807908243656, 2.8387500857712693, 13.466595027029157,
+     2.1433514835364229, -185.06004365757988},
+    {-3.1414648118578761, 2.8389651224339318, 13.448571049169637,
+     2.1404936637211756, -173.03877468875251},
+    {-3.1414488328913865, 2.8391798801399895, 13.431645106332555,
+     2.1378105805355552, -163.08119549587866},
+    {-3.141432853924897, 2.8393943749367105, 13.415638451694845,
+     2.1352737867583871, -154.65724880943696},
+    {-3.141400895991918, 2.8398226281539922, 13.385873338447333,
+     2.1305579551349583, -141.08820256449414},
+    {-3.1413689380589389, 2.8402499701030073, 13.358508520886886,
+     2.126224073690171, -130.54212473276002},
+    {-3.1413369801259594, 2.8406764689862589, 13.333044114949864,
+     2.1221925885861572, -122.0410285963376},
+    {-3.1413050221929799, 2.8411021796759202, 13.309132889615565,
+     2.1184082404586602, -114.99934025259039},
+    {-3.1412730642600009, 2.8415271475709947, 13.286522021607428,
+     2.1148307946825016, -109.04220114582178},
+    {-3.1412091483940427, 2.842375003081171, 13.244480474431473,
+     2.1081818893216284, -99.446625869506434},
+    {-3.1411452325280842, 2.8432202845344294, 13.205834351179551,
+     2.1020731888527031, -91.988785955051256},
+    {-3.1410813166621256, 2.8440631848865929, 13.169876608012943,
+     2.0963921784119761, -85.977073763629548},
+    {-3.1410174007961671, 2.8449038593909819, 13.136116113780057,
+     2.0910607038423903, -80.997390495725966},
+    {-3.1409534849302085, 2.8457424364936554, 13.104195267403504,
+     2.0860218609214263, -76.784650379337435},
+    {-3.1408895690642504, 2.846579024768376, 13.073844100682777,
+     2.0812326911222483, -73.160243050758396},
+    {-3.1408256531982919, 2.8474137175714325, 13.044852868966791,
+     2.0766598196374355, -69.998846248810835},
+    {-3.1406978214663752, 2.849077732748718, 12.990314551718349,
+     2.0680618273637736, -64.724744962091066},
+    {-3.1405699897344581, 2.8507350280591073, 12.939580211096736,
+     2.0600687539829043, -60.473275397609719},
+    {-3.140442158002541, 2.8523860428733885, 12.891955133344885,
+     2.0525700657299693, -56.951607979548349},
+    {-3.1403143262706243, 2.8540311407248398, 12.846933473993612,
+     2.0454852825593384, -53.972287824145901},
+    {-3.1401864945387077, 2.8556706289263953, 12.804133340791292,
+     2.0387536477626012, -51.409011020386551},
+    {-3.1400586628067906, 2.8573047717398015, 12.763258025658137,
+     2.0323279588428931, -49.173156196323959},
+    {-3.1399308310748735, 2.8589337995833413, 12.724071559776398,
+     2.0261706776866553, -47.200461777478473},
+    {-3.1398029993429564, 2.8605579157109977, 12.686382610493427,
+     2.0202513681826875, -45.443042065588585},
+    {-3.1395473358791226, 2.8637921185355739, 12.614892384574171,
+     2.0090304484996406, -42.43609901034354},
+    {-3.1392916724152888, 2.8670086243120387, 12.547804490529876,
+     1.9985088675873057, -39.945252066783141},
+    {-3.1390360089514546, 2.8702084625479092, 12.484403241186657,
+     1.9885727983982053, -37.837941655578156},
+    {-3.1387803454876209, 2.8733925036607624, 12.424148294441652,
+     1.9791363088377432, -36.024850994918324},
+    {-3.1385246820237871, 2.8765614962364512, 12.366619814810274,
+     1.9701326367833463, -34.443310503584463},
+    {-3.1382690185599533, 2.8797160930964583, 12.311483894735014,
+     1.9615086886949453, -33.047876673767327},
+    {-3.1380133550961196, 2.8828568701596402, 12.258469775387059,
+     1.9532214156258065, -31.804686262148962},
+    {-3.137502028168452, 2.889098964950962, 12.157950911929461,
+     1.9375208052099311, -29.677496946473134},
+    {-3.1369907012407845, 2.8952913070348996, 12.063672195538388,
+     1.9228096836192092, -27.915303893162022},
+    {-3.136479374313117, 2.9014368153800549, 11.974620617426625,
+     1.9089270465948853, -26.42436295604799},
+    {-3.1359680473854494, 2.9075379585790717, 11.890031280347419,
+     1.8957513438729858, -25.141509923953254},
+    {-3.1354567204577819, 2.9135968602777367, 11.809309813134711,
+     1.8831881390808245, -24.022424788274407},
+    {-3.1349453935301144, 2.9196153729559149, 11.731983446630842,
+     1.8711623288308714, -23.034969465855131},
+    {-3.1344340666024468, 2.9255951313235635, 11.657668782865041,
+     1.8596130170798759, -22.155195265304783},
+    {-3.1339227396747793, 2.9315375920438371, 11.586049782236399,
+     1.8484900146962036, -21.36484138394551},
+    {-3.1334114127471113, 2.9374440640008714, 11.516862267848383,
+     1.8377513755449317, -20.649708098073791},
+    {-3.1323887588917758, 2.9491536743338398, 11.384920076365969,
+     1.817290405612664, -19.402396388253862},
+    {-3.1313661050364408, 2.9607322574354606, 11.260407132684477,
+     1.7980023342804621, -18.346959169935126},
+    {-3.1303434511811057, 2.9721868322371701, 11.142239625069719,
+     1.7797151972039451, -17.438722192408434},
+    {-3.1293207973257706, 2.9835234400427186, 11.029575193894532,
+     1.7622953842444176, -16.64633841475322},
+    {-3.1282981434704356, 2.9947473534751023, 10.921743680006388,
+     1.7456366335802875, -15.947076383415887},
+    {-3.1272754896151, 3.0058632277012602, 10.818201498237052,
+     1.7296527814964806, -15.323996638756672},
+    {-3.1262528357597645, 3.0168752129791292, 10.718500472949035,
+     1.7142728109423926, -14.76418258230013},
+    {-3.1252301819044295, 3.0277870403757245, 10.622265898256405,
+     1.699437366207613, -14.25758993608811},
+    {-3.1242075280490944, 3.038602088377222, 10.529180689735917,
+     1.6850962356381689, -13.796274413086481},
+    {-3.1231848741937593, 3.0493234355421714, 10.438973679552527,
+     1.6712064927388131, -13.373858932936132},
+    {-3.1211395664830888, 3.0704960874919993, 10.266288348792775,
+     1.6446378205959027, -12.625902491496802},
+    {-3.1190942587724182, 3.0913250477918059, 10.102671251897188,
+     1.6194879689005128, -11.982116612607452},
+    {-3.1170489510617481, 3.1118275916480265, 9.9469260243818276,
+     1.5955678240140638, -11.420324310478836},
+    {-3.1150036433510775, 3.1320188103818793, 9.7981004783274113,
+     1.5727269692350587, -10.924443055995576},
+    {-3.1129583356404069, 3.1519120403692646, 9.6554219491136486,
+     1.550843427386783, -10.482487578763916},
+    {-3.1109130279297368, 3.1715191823093014, 9.5182531272452717,
+     1.5298166553983539, -10.085318481309898},
+    {-3.1088677202190662, 3.1908509444818089, 9.3860609584838137,
+     1.5095626130117923, -9.7258283886408847},
+    {-3.1068224125083956, 3.2099170318095829, 9.2583941747880676,
+     1.4900102010196645, -9.3983956156287718},
+    {-3.1047771047977255, 3.2287262953314335, 9.1348666967088921,
+     1.4710986309762846, -9.0985072743857689},
+    {-3.1027317970870549, 3.2472868521727896, 9.0151451337124335,
+     1.4527754448799191, -8.8224930232114769},
+    {-3.1006864893763844, 3.265606183088992, 8.8989392093556585,
+     1.4349949986632522, -8.5673330113364763},
+    {-3.0986411816657142, 3.2836912127315969, 8.7859943156456328,
+     1.4177172832452012, -8.3305167594301732},
+    {-3.0965958739550437, 3.3015483763643276, 8.6760856447777748,
+     1.400906995606191, -8.1099377433314235},
+    {-3.0925052585337029, 3.3366027270218503, 8.464599560033534,
+     1.368566720569941, -7.7106240918227584},
+    {-3.0884146431123618, 3.3708128544563851, 8.2631216686463471,
+     1.3377610559958935, -7.3580073684286482},
+    {-3.0843240276910211, 3.404217365529397, 8.0705480455600345,
+     1.3083171503873716, -7.0436024776400261},
+    {-3.0802334122696804, 3.4368507630872442, 7.8859673948649656,
+     1.2800925026415715, -6.7609384629478013},
+    {-3.0761427968483392, 3.4687441384986513, 7.7086168629945169,
+     1.2529679816704831, -6.5049826122218128},
+    {-3.0720521814269981, 3.4999257101561847, 7.5378501034184504,
+     1.2268427842780076, -6.2717538422678158},
+    {-3.0679615660056574, 3.5304212494523086, 7.3731136781899798,
+     1.2016307113960083, -6.0580559740820252},
+    {-3.0638709505843167, 3.5602544228086326, 7.2139292797139083,
+     1.1772573643054591, -5.8612892982867502},
+    {-3.0597803351629755, 3.5894470699488736, 7.0598801077664088,
+     1.1536579973788172, -5.6793146439893878},
+    {-3.0556897197416348, 3.6180194329407329, 6.9106002722077564,
+     1.1307758486670012, -5.5103534930939979},
+    {-3.0515991043202941, 3.6459903467066845, 6.7657664378504618,
+     1.1085608244333018, -5.3529133616529503},
+    {-3.047508488898953, 3.6733773989630394, 6.6250911571117159,
+     1.0869684500050929, -5.2057312255748061},
+    {-3.0434178734776123, 3.7001970656358614, 6.4883174912025163,
+     1.065959023857038, -5.0677300501999865},
+    {-3.0393272580562716, 3.7264648263990443, 6.3552146276894765,
+     1.0454969287765676, -4.93798498114512},
+    {-3.0352366426349304, 3.7521952639443357, 6.2255742775082288,
+     1.0255500658597285, -4.815696756965731},
+    {-3.027055411792249, 3.802098519086937, 5.9759431493276578,
+     0.98708849630695084, -4.5907992235745727},
+    {-3.0188741809495672, 3.850008549563591, 5.7381063212452386,
+     0.9503718898679564, -4.3884499432198103},
+    {-3.0106929501068853, 3.8960171994000588, 5.510958798083526,
+     0.91523096001667603, -4.2050803560857828},
+    {-3.0025117192642035, 3.9402079827512138, 5.2935627589877674,
+     0.88152241422141886, -4.037867048186162},
+    {-2.9943304884215216, 3.9826573069157551, 5.085113826290006,
+     0.84912367655359455, -3.8845428364291852},
+    {-2.9861492575788402, 4.0234354553091336, 4.8849156360223969,
+     0.81792891357062802, -3.7432632904179073},
+    {-2.9779680267361583, 4.0626073879694262, 4.6923603384726063,
+     0.78784599034386138, -3.6125104348579069},
+    {-2.9697867958934765, 4.1002334011030106, 4.5069134191030278,
+     0.75879410355905674, -3.4910219800225186},
+    {-2.9616055650507951, 4.1363696761846347, 4.3281017227574043,
+     0.73070191618902702, -3.3777384483846666},
+    {-2.9534243342081132, 4.1710687414063576, 4.1555038904456447,
+     0.70350606960104145, -3.2717630828515372},
+    {-2.9452431033654314, 4.2043798627576807, 3.9887426390011655,
+     0.6771499837217787, -3.1723310378562108},
+    {-2.9370618725227495, 4.2363493780129327, 3.8274784665232549,
+     0.65158287987234231, -3.0787854151504264},
+    {-2.9288806416800677, 4.2670209839716886, 3.6714044737948908,
+     0.62675897773848777, -2.9905584164744274},
+    {-2.9206994108373858, 4.2964359850827663, 3.520242068494646,
+     0.60263682997172363, -2.9071563698113683},
+    {-2.912518179994704, 4.3246335099102886, 3.3737373745657346,
+     0.57917876663208834, -2.8281477220031705},
+    {-2.9043369491520221, 4.3516507006340728, 3.2316582099112936,
+     0.55635042808218915, -2.753153327188818},
+    {-2.8961557183093403, 4.377522879771953, 3.0937915259354298,
+     0.53412036969846732, -2.6818385295725196},
+    {-2.8879744874666589, 4.4022836975588113, 2.9599412252824009,
+     0.51245972534176909, -2.6139066613403079},
+    {-2.879793256623977, 4.4259652627805597, 2.8299262914850773,
+     0.49134191924642545, -2.5490936661067649},
+    {-2.8716120257812952, 4.4485982594075484, 2.7035791775615112,
+     0.47074241807194234, -2.4871636245899693},
+    {-2.8634307949386137, 4.4702120509427967, 2.5807444109234874,
+     0.45063851647562053, -2.4279050088269196},
+    {-2.8552495640959319, 4.4908347741353216, 2.4612773800297116,
+     0.43100915082514596, -2.3711275287204119},
+    {-2.84706833325325, 4.5104934234014298, 2.3450432745706036,
+     0.41183473666243214, -2.3166594632765505},
+    {-2.8388871024105682, 4.5292139271272225, 2.2319161560141878,
+     0.39309702631693483, -2.2643453908532361},
+    {-2.8307058715678863, 4.5470212168348381, 2.1217781393720814,
+     0.37477898369512685, -2.2140442497569697},
+    {-2.8225246407252045, 4.5639392900512128, 2.0145186702855002,
+     0.35686467377799408, -2.1656276738101621},
+    {-2.8143434098825226, 4.5799912676104029, 1.9100338841544571,
+     0.33933916476706488, -2.1189785579556331},
+    {-2.7979809481971589, 4.6095853453380098, 1.7090029928498598,
+     0.30539932624470384, -2.0305633090332833},
+    {-2.7816184865117957, 4.6359727658186047, 1.51796816031385,
+     0.27285700171942195, -1.9480436139588515},
+    {-2.7652560248264324, 4.6593117491925788, 1.3362883833917123,
+     0.24162109609282698, -1.8707803011939153},
+    {-2.7488935631410687, 4.6797505732626945, 1.1633877170585039,
+     0.21161017884758326, -1.7982280322886111},
+    {-2.732531101455705, 4.6974285604245329, 0.99874609465000996,
+     0.18275109368708495, -1.7299182759047205},
+    {-2.7161686397703417, 4.7124769281518741, 0.84189176538853072,
+     0.1549778156373447, -1.6654459144684446},
+    {-2.6998061780849785, 4.7250195266191204, 0.69239501262539949,
+     0.12823050377574285, -1.6044586012747288},
+    {-2.6834437163996148, 4.7351734822144103, 0.54986289617289086,
+     0.10245471011977171, -1.5466482242283961},
+    {-2.6752624855569329, 4.7393896227318653, 0.48109473391710361,
+     0.089915426339361587, -1.5188484702987741},
+    {-2.6670812547142511, 4.743049762032479, 0.41393482087799666,
+     0.077600714291388415, -1.4917440003016909},
+    {-2.6589000238715697, 4.7461668902341723, 0.3483425201383632,
+     0.065505005267394154, -1.4653058759234954},
+    {-2.6507187930288878, 4.7487536715311336, 0.28427877734163698,
+     0.053622960324810828, -1.4395068447176755},
+    {-2.6425375621862059, 4.7508224567722781, 0.22170603173291506,
+     0.041949457011595845, -1.4143212156412011},
+    {-2.6343563313435245, 4.7523852953400372, 0.16058813362538016,
+     0.030479577063039161, -1.3897247456538553},
+    {-2.6261751005008427, 4.7534539463780821, 0.10089026773055214,
+     0.019208594985024259, -1.3656945362363151},
+    {-2.6179938696581608, 4.7540398894095013, 0.042578881848034766,
+     0.0081319674468134668, -1.3422089388170266},
+    {-2.609812638815479, 4.7541543343992219, -0.014378379538989922,
+     -0.0027546765858095981, -1.3192474682149038},
+    {-2.6016314079727971, 4.753808231287489, -0.070012737171319214,
+     -0.013455545039309288, -1.2967907233065883},
+    {-2.5934501771301157, 4.7530122790333476, -0.12435433479341265,
+     -0.023974691299260244, -1.2748203142158265},
+    {-2.5852689462874339, 4.7517769342026419, -0.17743229313885087,
+     -0.034316022206055556, -1.2533187954001868},
+    {-2.5689064846020706, 4.7480287296798389, -0.27990895962166895,
+     -0.054480176935095298, -1.2116570035018024},
+    {-2.5525440229167069, 4.7426427227103432, -0.3776570825343557,
+     -0.073976605132713744, -1.1716824477754906},
+    {-2.5361815612313432, 4.7356946228599455, -0.47087755751083576,
+     -0.092831988984696287, -1.1332838635822746},
+    {-2.5198190995459799, 4.7272569542076708, -0.55975904405341959,
+     -0.11107127574242864, -1.0963602399225358},
+    {-2.5034566378606167, 4.7173992465957646, -0.64447903964787145,
+     -0.1287178355520919, -1.0608196335220255},
+    {-2.487094176175253, 4.7061882103143615, -0.72520483322415796,
+     -0.14579360125787541, -1.0265781466188437},
+    {-2.4707317144898893, 4.6936878960592363, -0.80209435423901032,
+     -0.16231919263735436, -0.99355904238153492},
+    {-2.454369252804526, 4.6799598417572312, -0.87529693111390383,
+     -0.17831402714031949, -0.96169197656648342},
+    {-2.4380067911191627, 4.6650632076400509, -0.94495397066807862,
+     -0.19379641888411211, -0.93091232777142152},
+    {-2.421644329433799, 4.6490549007788031, -1.0111995684529052,
+     -0.20878366739539581, -0.90116061166274131},
+    {-2.4052818677484353, 4.6319896901413173, -1.0741610584527612,
+     -0.22329213736980327, -0.87238196700195259},
+    {-2.3889194060630716, 4.6139203130986637, -1.1339595094132711,
+     -0.23733733053850301, -0.84452570328984167},
+    {-2.3725569443777079, 4.5948975742033635, -1.1907101740476993,
+     -0.25093395057795076, -0.81754490147814773},
+    {-2.3561944826923447, 4.5749704369692292, -1.2445228965212012,
+     -0.26409596187050027, -0.79139606053962108},
+    {-2.3234695593216177, 4.5325901230624384, -1.3437490385851556,
+     -0.2891686342939413, -0.74143549981303269},
+    {-2.2907446359508903, 4.4871373639575669, -1.4324217983813934,
+     -0.31265418587061183, -0.69435328336886704},
+    {-2.2580197125801633, 4.4389456033210655, -1.5112590756664921,
+     -0.33464257801798086, -0.64989651877981414},
+    {-2.2252947892094364, 4.3883257606137702, -1.580920764004665,
+     -0.35521603062898166, -0.60784406082187159},
+    {-2.1925698658387094, 4.3355680163130854, -1.6420154736954,
+     -0.37444997746224395, -0.56800157679036878},
+    {-2.1598449424679824, 4.2809433941340966, -1.6951062488316795,
+     -0.39241387552912443, -0.53019752159496114},
+    {-2.1271200190972555, 4.22470517010498, -1.7407154580747717,
+     -0.40917189496752682, -0.49427983076990317},
+    {-2.0943950957265285, 4.1670901331379175, -1.7793290018208237,
+     -0.42478351039195617, -0.46011318479469288},
+    {-2.0616701723558015, 4.1083197175088157, -1.811399950034869,
+     -0.43930401048705159, -0.4275767316446944},
+    {-2.0289452489850746, 4.0486010243160884, -1.8373517029771003,
+     -0.45278493934131198, -0.39656217958213713},
+    {-1.9962203256143476, 3.9881277462844018, -1.857580749778702,
+     -0.46527448046272685, -0.36697219115898222},
+    {-1.9634954022436206, 3.927081008007133, -1.8724590861949293,
+     -0.47681779240616828, -0.33871902386206026},
+    {-1.9307704788728937, 3.8656301319496604, -1.8823363420244026,
+     -0.48745730334639131, -0.31172337395046845},
+    {-1.8980455555021667, 3.8039333390058769, -1.8875416600036399,
+     -0.4972329706555047, -0.2859133886550555},
+    {-1.8653206321314397, 3.7421383911465074, -1.8883853609888419,
+     -0.50618251051859298, -0.2612238186422402},
+    {-1.8325957087607128, 3.6803831826700595, -1.8851604245613025,
+     -0.51434160179173849, -0.23759528794001253},
+    {-1.7998707853899858, 3.6187962856818512, -1.8781438095617937,
+     -0.52174406763173509, -0.21497366271749241},
+    {-1.7671458620192586, 3.5574974546888263, -1.8675976352595114,
+     -0.52842203787452779, -0.19330950365133642},
+    {-1.7016960152778045, 3.4362016957197588, -1.836897137394609,
+     -0.53972540362760757, -0.1526765000023258},
+    {-1.6362461685363505, 3.3172945768705593, -1.7948967800747668,
+     -0.54848005593202764, -0.11537798683834533},
+    {-1.5707963217948964, 3.2014604918910696, -1.7432547256377902,
+     -0.55489521507340667, -0.081145873913573613},
+    {-1.5053464750534422, 3.0892805897163509, -1.6834709903724883,
+     -0.55916395935119267, -0.049753741018880894},
+    {-1.4398966283119883, 2.9812425253270693, -1.6169052125739802,
+     -0.56146572635200265, -0.021010206377045038},
+    {-1.3744467815705343, 2.8777491501042998, -1.5447913996510194,
+     -0.56196842990378937, 0.0052462475335219218},
+    {-1.3089969348290804, 2.7791263198227902, -1.4682502275308991,
+     -0.56083027716280054, 0.029151307601865285},
+    {-1.2435470880876265, 2.6856299654247464, -1.3882993332210327,
+     -0.5582013526146451, 0.050817950941008418},
+    {-1.1780972413461723, 2.5974525462951656, -1.305861941654145,
+     -0.55422502312371946, 0.070338814738141561},
+    {-1.1126473946047182, 2.5147289860212365, -1.2217740915566948,
+     -0.54903920931336259, 0.087787925780321435},
+    {-1.0471975478632642, 2.4375421753334603, -1.1367906654460558,
+     -0.5427775627271092, 0.10322185826380763},
+    {-0.98174770112181031, 2.3659281151152869, -1.0515903811890224,
+     -0.53557058498196897, 0.11668035058416876},
+    {-0.91629785438035638, 2.2998807633776348, -0.96677986322485554,
+     -0.52754672435560679, 0.12818637342248662},
+    {-0.85084800763890245, 2.2393566435089838, -0.88289687767706027,
+     -0.5188334871507152, 0.13774559719799467},
+    {-0.78539816089744852, 2.1842792666175979, -0.80041278461699727,
+     -0.50955860636494998, 0.14534514932820472},
+    {-0.71994831415599447, 2.1345434182803689, -0.71973423017920757,
+     -0.4998513198985417, 0.15095146872591847},
+    {-0.65449846741454043, 2.0900193596081267, -0.64120406813337993,
+     -0.48984382703470852, 0.1545069355723698},
+    {-0.58904862067308639, 2.0505569944494488, -0.56510146092064928,
+     -0.4796730194147017, 0.15592473922552397},
+    {-0.52359877393163234, 2.0159900594385474, -0.49164105794364221,
+     -0.46948262908636706, 0.15508106731470958},
+    {-0.4581489271901783, 1.9861404026040537, -0.42097107362733366,
+     -0.45942601700406027, 0.15180298597016917},
+    {-0.42542400381945128, 1.9729267197744369, -0.38670985897446691,
+     -0.45449934124848473, 0.14917900556839594},
+    {-0.39269908044872426, 1.9608224313845979, -0.35316997006633166,
+     -0.44966997333273101, 0.14584894468524678},
+    {-0.35997415707799724, 1.9498039502354427, -0.32034946451786511,
+     -0.44496175380786229, 0.14176650910085445},
+    {-0.32724923370727022, 1.9398478361502018, -0.28824124981935278,
+     -0.4404001906345017, 0.13687568742376674},
+    {-0.29452431033654319, 1.9309309697516215, -0.25683275117505172,
+     -0.43601282162680804, 0.13110786436810046},
+    {-0.26179938696581617, 1.923030738397171, -0.22610549674694139,
+     -0.43182969098484669, 0.1243776345558896},
+    {-0.2290744635950891, 1.9161252373951521, -0.19603459307404217,
+     -0.4278839945698879, 0.11657649489751762},
+    {-0.19634954022436202, 1.9101934907219968, -0.16658804942924255,
+     -0.42421298577752709, 0.10756287654404678},
+    {-0.16362461685363494, 1.9052156971696526, -0.13772588554008891,
+     -0.42085930646758096, 0.097145402385870452},
+    {-0.13089969348290786, 1.9011735106561289, -0.10939891160448721,
+     -0.41787306254759066, 0.085052398288156972},
+    {-0.11453723179754433, 1.8994980142290872, -0.09541781608826462,
+     -0.41653624149449009, 0.07825670934476131},
+    {-0.098174770112180787, 1.8980503684150327, -0.081546975734948832,
+     -0.41531533835917328, 0.070869724999154532},
+    {-0.081812308426817248, 1.896828846903821, -0.067776717570837003,
+     -0.41422078703148091, 0.062793567857261146},
+    {-0.06544984674145371, 1.8958318905426936, -0.05409625175011832,
+     -0.41326492301666146, 0.053890237112529923},
+    {-0.049087385056090171, 1.8950581273360236, -0.04049344662297296,
+     -0.41246286165684659, 0.043950520164771301},
+    {-0.032724923370726633, 1.8945063969950984, -0.026954483925331497,
+     -0.41183417941083772, 0.032618717849585942},
+    {-0.024543692528044864, 1.8943134970835318, -0.020204026706650443,
+     -0.41159305356283088, 0.026229539879073636},
+    {-0.016362461685363094, 1.8941757829337578, -0.013463258650632911,
+     -0.41140688086916527, 0.019145107643901628},
+    {-0.0081812308426813252, 1.8940931856119814, -0.0067295967187079074,
+     -0.41128265710336209, 0.010990296863421218},
+    {-0.0040906154213404405, 1.8940725403393772, -0.0033645086990121407,
+     -0.41124725163110493, 0.0062040035391802374},
+    {-0.0020453077106699982, 1.8940673793091116, -0.0016822136939631076,
+     -0.41123731289607546, 0.0034564272717132749},
+    {4.4408920985006262e-16, 1.8940656589951859, -3.6524873500103957e-16,
+     -0.41123351671205671, 3.9877013279793315e-15},
+    {0, 1.8940656589944915, 0,
+     -0.4112335167120566, 0},
+    {0.001953125, 1.8940640902706383, -0.0016063673164708038,
+     -0.41123003301652578, 0.003323163697518569},
+    {0.00390625, 1.894059384169644, -0.0032126633125163931,
+     -0.41122090400209832, 0.0059694270425279979},
+    {0.0078125, 1.8940405607300423, -0.0064248180335456833,
+     -0.41118835414692373, 0.010585060526036808},
+    {0.015625, 1.8939652805889267, -0.012846063103969121,
+     -0.41107401932701187, 0.018462591100840725},
+    {0.0234375, 1.8938398573117687, -0.019261054104313353,
+     -0.41090248755868486, 0.025318305083760859},
+    {0.03125, 1.8936643488703697, -0.025667508443816687,
+     -0.41068013510106699, 0.03151057959567883},
+    {0.046875, 1.89316339073812, -0.038446851988403911,
+     -0.41009975454297504, 0.042515849297148363},
+    {0.0625, 1.8924631788292072, -0.051169795604167699,
+     -0.40935836483334159, 0.052195611136077034},
+    {0.078125, 1.8915646927713048, -0.063824023068469751,
+     -0.40847374763820637, 0.060890811584226864},
+    {0.09375, 1.890469092764673, -0.076398674360730889,
+     -0.40745959659056474, 0.068802512928176282},
+    {0.109375, 1.8891776993797695, -0.088884042281674791,
+     -0.40632705043051331, 0.076063775428752242},
+    {0.125, 1.8876919771928085, -0.10127137346081458,
+     -0.40508549384325832, 0.082769344588740301},
+    {0.15625, 1.8841440442137789, -0.12572087019039926,
+     -0.40230678460927766, 0.094781617484888447},
+    {0.1875, 1.8798394125538143, -0.14969164953120992,
+     -0.39917773208322643, 0.10524504894661307},
+    {0.21875, 1.8747937893697009, -0.17313724229240776,
+     -0.39574226809693203, 0.11442932034260241},
+    {0.25, 1.8690242145332483, -0.19601859878237415,
+     -0.39203719756474831, 0.12252744548678397},
+    {0.28125, 1.8625488478603758, -0.21830292608767565,
+     -0.38809409082253449, 0.12968488785032262},
+    {0.3125, 1.8553867878888479, -0.2399628105232329,
+     -0.38394049683717263, 0.13601555145077213},
+    {0.34375, 1.8475579149508079, -0.26097552848870981,
+     -0.37960076871085063, 0.14161130306382028},
+    {0.375, 1.8390827536073002, -0.28132248857529912,
+     -0.37509665143373216, 0.14654799949159886},
+    {0.40625, 1.8299823509643167, -0.30098876894925231,
+     -0.37044771562984896, 0.15088948958988749},
+    {0.4375, 1.8202781682670799, -0.31996272622690403,
+     -0.36567168711646175, 0.1546903760168602},
+    {0.46875, 1.8099919838276965, -0.33823565948207612,
+     -0.36078470344754787, 0.15799798259616496},
+    {0.5, 1.7991458057434311, -0.35580151776447666,
+     -0.35580151776447666, 0.16085379363540045},
+    {0.53125, 1.7877617931907386, -0.37265664264706433,
+     -0.35073566366782527, 0.16329453108887679},
+    {0.5625, 1.7758621852991239, -0.38879953946769225,
+     -0.34559959063794865, 0.16535297661255033},
+    {0.625, 1.7506051597205221, -0.4189522798886694,
+     -0.33516182391093552, 0.16843811067921019},
+    {0.6875, 1.7235519429042707, -0.44628375146744348,
+     -0.32457000106723161, 0.17031377370985107},
+    {0.75, 1.6948774933754081, -0.47084133120987681,
+     -0.31389422080658452, 0.17115089557243321},
+    {0.8125, 1.6647531926608403, -0.49269144637946882,
+     -0.30319473623351928, 0.17109468700157426},
+    {0.875, 1.6333457719782603, -0.5119159174264325,
+     -0.29252338138653289, 0.1702701074908807},
+    {0.9375, 1.600816450430145, -0.52860882857598346,
+     -0.28192470857385782, 0.16878576370694207},
+    {1, 1.5673202547938492, -0.54287383323915284,
+     -0.27143691661957642, 0.16673677050137192},
+    {1.0625, 1.5330054959742636, -0.55482182543559777,
+     -0.26109262373439895, 0.16420690540799288},
+    {1.125, 1.4980133809510567, -0.56456892459797026,
+     -0.25091952204354234, 0.16127026958786278},
+    {1.1875, 1.4624777419939097, -0.57223473230479327,
+     -0.24094093991780768, 0.15799259631103929},
+    {1.25, 1.4265248672179893, -0.57794082739074248,
+     -0.231176330956297, 0.15443230276558931},
+    {1.3125, 1.3902734184881802, -0.58180947159454244,
+     -0.22164170346458759, 0.15064135159780151},
+    {1.375, 1.3538344242597271, -0.58396250212567713,
+     -0.2123500007729735, 0.14666596904050155},
+    {1.4375, 1.3173113363369013, -0.58452039072448336,
+     -0.20331144025199421, 0.1425472531996467},
+    {1.5, 1.2808001407040044, -0.58360145126708196,
+     -0.19453381708902734, 0.13832169686785506},
+    {1.5625, 1.2443895136673826, -0.58132117993939048,
+     -0.18602277758060495, 0.13402164275857562},
+    {1.625, 1.208161015463536, -0.57779171361938986,
+     -0.17778206572904304, 0.1296756844362561},
+    {1.6875, 1.1721893143714965, -0.5731213934653121,
+     -0.16981374621194431, 0.12530902288637411},
+    {1.75, 1.1365424351244695, -0.5674144218798477,
+     -0.16211840625138504, 0.12094378624359015},
+    {1.8125, 1.1012820261178458, -0.5607706020558082,
+     -0.15469533849815398, 0.11659931841702253},
+    {1.875, 1.0664636405910699, -0.55328515024051439,
+     -0.14754270673080383, 0.11229244103881646},
+    {1.9375, 1.0321370274881358, -0.54504857170762877,
+     -0.14065769592454935, 0.10803769218909341},
+    {2, 0.99834642831111409, -0.53614659221185978,
+     -0.13403664805296495, 0.10384754462660532},
+    {2.0625, 0.96513087670797337, -0.52666013743418971,
+     -0.12767518483253085, 0.09973260571462067},
+    {2.125, 0.93252449803739557, -0.51666535360994092,
+     -0.12156831849645668, 0.095701800827992026},
+    {2.1875, 0.9005568065049715, -0.50623366317339435,
+     -0.11571055158249015, 0.091762541724849281},
+    {2.25, 0.86925299788675847, -0.49543184985368349,
+     -0.11009596663415189, 0.087920881138859278},
+    {2.3125, 0.83863423613964061, -0.48432216821905072,
+     -0.10471830664195692, 0.084181654676035556},
+    {2.375, 0.80871793251665314, -0.47296247319163998,
+     -0.099571046987713685, 0.080548610969173706},
+    {2.4375, 0.77951801607470772, -0.46140636554365871,
+     -0.094647459598699218, 0.077024530942237796},
+    {2.5, 0.75104519467882536, -0.44970334983901494,
+     -0.089940669967802991, 0.073611336958319298},
+    {2.5625, 0.72330720582954389, -0.43789900170320617,
+     -0.085443707649406078, 0.070310192562066359},
+    {2.625, 0.69630905681294164, -0.42603514168940754,
+     -0.081149550797982389, 0.06712159347626033},
+    {2.6875, 0.67005325384920578, -0.41415001336153218,
+     -0.077051165276564124, 0.064045450469175896},
+    {2.75, 0.64454002002405653, -0.40227846353670293,
+     -0.073141538824855079, 0.061081164672106697},
+    {2.8125, 0.61976750193992569, -0.39045212292165637,
+     -0.069413710741627804, 0.058227695893232644},
+    {2.875, 0.59573196510337501, -0.37869958564144723,
+     -0.065860797502860391, 0.055483624443624036},
+    {3, 0.54984858616048948, -0.35551617419376685,
+     -0.05925269569896114, 0.050316426704153497},
+    {3.125, 0.50682911398082175, -0.33290289018605701,
+     -0.053264462429769122, 0.045562610320737378},
+    {3.1875, 0.48636891688303974, -0.32185418749994932,
+     -0.050486931372541073, 0.043334557296980922},
+    {3.25, 0.46659335511991845, -0.31099672202296352,
+     -0.047845649541994391, 0.041202176093804929},
+    {3.3125, 0.44749009015512936, -0.30034254892834877,
+     -0.045334724366543212, 0.039162672447726109},
+    {3.375, 0.42904608549039802, -0.289901970563399,
+     -0.042948440083466523, 0.037213186699502361},
+    {3.4375, 0.4112477120076275, -0.27968367015750412,
+     -0.040681261113818784, 0.035350816111974631},
+    {3.5, 0.39408084516105363, -0.2696948389032166,
+     -0.038527834129030943, 0.033572634462201455},
+    {3.5625, 0.37753095442323475, -0.25994129642197905,
+     -0.036482988971505835, 0.031875709162237732},
+    {3.625, 0.36158318542024276, -0.25042760467757519,
+     -0.034541738576217264, 0.030257116143980984},
+    {3.6875, 0.34622243514163026, -0.24115717544301687,
+     -0.032699278026171778, 0.028713952725490797},
+    {3.75, 0.33143342063473757, -0.23213237146158297,
+     -0.030950982861544397, 0.027243348659104445},
+    {3.8125, 0.31720074156759603, -0.22335460147096037,
+     -0.029292406750289886, 0.025842475545527238},
+    {3.875, 0.30350893703786913, -0.21482440928172988,
+     -0.027719278616997405, 0.024508554782876876},
+    {3.9375, 0.29034253700154949, -0.20654155711860817,
+     -0.026227499316648657, 0.023238864205392812},
+    {4, 0.27768610865818238, -0.19850510344551592,
+     -0.02481313793068949, 0.022030743553172302},
+    {4.0625, 0.26552429814427936, -0.19071347550438569,
+     -0.023472427754385933, 0.020881598901842515},
+    {4.125, 0.25384186784682616, -0.18316453680313327,
+     -0.022201762036743428, 0.019788906169491957},
+    {4.1875, 0.24262372965946749, -0.17585564979093929,
+     -0.020997689527276334, 0.018750213807436703},
+    {4.25, 0.23185497445302283, -0.16878373395933549,
+     -0.019856909877568881, 0.017763144771450062},
+    {4.3125, 0.22152089806410588, -0.16194531960594688,
+     -0.018776268939819929, 0.016825397860899278},
+    {4.375, 0.21160702404350845, -0.15533659749445775,
+     -0.017752753999366599, 0.015934748504774592},
+    {4.4375, 0.20209912342738556, -0.14895346463974485,
+     -0.016783488973492376, 0.01508904906581943},
+    {4.5, 0.19298323176079804, -0.14279156644139954,
+     -0.015865729604599949, 0.014286228726838166},
+    {4.5625, 0.1842456636006245, -0.13684633538229524,
+     -0.014996858672032353, 0.013524293016728415},
+    {4.625, 0.17587302469212715, -0.13111302650161261,
+     -0.014174381243417578, 0.012801323027818685},
+    {4.6875, 0.1678522220361916, -0.1255867498440138,
+     -0.013395919983361473, 0.012115474370650274},
+    {4.75, 0.16017047200725026, -0.12026250007857767,
+     -0.012659210534587123, 0.011464975907388153},
+    {4.8125, 0.15281530670819882, -0.11513518347280308,
+     -0.011962096984187333, 0.010848128300541797},
+    {4.875, 0.14577457872028041, -0.11019964239857782,
+     -0.011302527425495161, 0.010263302409590943},
+    {4.9375, 0.13903646438921427, -0.10545067753854558,
+     -0.010678549624156514, 0.0097089375644087688},
+    {5, 0.1325894657910483, -0.10088306795290826,
+     -0.010088306795290826, 0.0091835397410260939},
+    {5.0625, 0.12642241151249153, -0.096491589158382463,
+     -0.0095300334971241945, 0.0086856796622568448},
+    {5.125, 0.1205244563527974, -0.092271029362886586,
+     -0.0090020516451596675, 0.0082139908429767414},
+    {5.1875, 0.11488508006965541, -0.088216203991566766,
+     -0.0085027666497895678, 0.0077671675973934777},
+    {5.25, 0.10949408526486998, -0.084321968632040264,
+     -0.0080306636792419304, 0.0073439630234389906},
+    {5.3125, 0.10434159450758607, -0.080583230519243584,
+     -0.0075843040488699845, 0.0069431869774343354},
+    {5.375, 0.099418046784863698, -0.076994958673056488,
+     -0.0071623217370285104, 0.0065637040504034098},
+    {5.4375, 0.094714193353268292, -0.073552192794934551,
+     -0.0067634200271204179, 0.0062044315558240186},
+    {5.5, 0.090221093075371628, -0.070250051023128451,
+     -0.0063863682748298593, 0.0058643375371878956},
+    {5.5625, 0.085930107301784575, -0.0670837366397182,
+     -0.0060299987990757933, 0.0055424388024778483},
+    {5.625, 0.081832894362896466, -0.064048543816623116,
+     -0.0056932038948109441, 0.005237798991545973},
+    {5.6875, 0.07792140373780837, -0.061139862481985018,
+     -0.0053749329654492325, 0.0049495266813791494},
+    {5.75, 0.074187869932350201, -0.05835318238284367,
+     -0.0050741897724211884, 0.0046767735333535605},
+    {5.8125, 0.0706248061363621, -0.055684096414833406,
+     -0.0047900297991254545, 0.0044187324857982513},
+    {5.875, 0.067224997688180604, -0.053128303284718188,
+     -0.0045215577263589945, 0.0041746359944983755},
+    {5.9375, 0.063981495397192056, -0.050681609566942974,
+     -0.0042679250161636187, 0.0039437543231622971},
+    {6, 0.060887608748998935, -0.048339931211000844,
+     -0.0040283276009167373, 0.0037253938853448257},
+    {6.0625, 0.057936899037615952, -0.046099294552294959,
+     -0.003802003674416079, 0.0035188956388540779},
+    {6.125, 0.055123172444961413, -0.043955836875294495,
+     -0.0035882315816566936, 0.0033236335332643792},
+    {6.1875, 0.052440473101004713, -0.041905806574140732,
+     -0.0033863278039709681, 0.0031390130108060518},
+    {6.25, 0.049883076144191588, -0.039945562952438451,
+     -0.003195645036195076, 0.0029644695605997801},
+    {6.3125, 0.047445480800994914, -0.03807157570076488,
+     -0.0030155703525358321, 0.0027994673259422089},
+    {6.375, 0.045122403514596544, -0.036280424087424823,
+     -0.0028455234578372408, 0.0026434977641266308},
+    {6.4375, 0.04290877112627061, -0.034568795895174913,
+     -0.0026849550209844591, 0.0024960783580941798},
+    {6.5, 0.040799714133025293, -0.032933486134015429,
+     -0.0025333450872319558, 0.0023567513790515447},
+    {6.5625, 0.038790560032002, -0.031371395557700806,
+     -0.0023902015663010137, 0.002225082699059472},
+    {6.625, 0.03687682675934336, -0.029879529009335243,
+     -0.0022550587931573769, 0.0021006606524874996},
+    {6.6875, 0.035054216242726054, -0.028454993619292098,
+     -0.0021274761584517458, 0.0019830949451423597},
+    {6.75, 0.033318608069762355, -0.027094996876716293,
+     -0.0020070368056826883, 0.0018720156098082333},
+    {6.8125, 0.031666053274203645, -0.025796844594025019,
+     -0.0018933463922220198, 0.001767072006883188},
+    {6.875, 0.030092768259196045, -0.024557938782112692,
+     -0.0017860319114263777, 0.0016679318687570187},
+    {6.9375, 0.028595128854997702, -0.023375775452375704,
+     -0.001684740573144195, 0.001574280386548336},
+    {7, 0.02716966450983074, -0.022247942360199651,
+     -0.0015891387400142607, 0.0014858193378024876},
+    {7.0625, 0.025813052632289796, -0.021172116703186656,
+     -0.0014989109170397634, 0.0014022662537446085},
+    {7.125, 0.024522113070181529, -0.020146062786135021,
+     -0.0014137587920094751, 0.0013233536246830557},
+    {7.1875, 0.023293802740922371, -0.019167629663616289,
+     -0.001333400324425481, 0.0012488281421660764},
+    {7.25, 0.022125210412507059, -0.018234748769912254,
+     -0.0012575688806836037, 0.001178449976508179},
+    {7.3125, 0.02101355162267356, -0.017345431545079726,
+     -0.0011860124133387846, 0.0011119920883212583},
+    {7.375, 0.019956163756206322, -0.016497767064988286,
+     -0.0011184926823720872, 0.0010492395727080925},
+    {7.4375, 0.018950501267180741, -0.015689919682331917,
+     -0.0010547845164592885, 0.00098998903480221356},
+    {7.5, 0.017994131045257596, -0.014920126684833722,
+     -0.00099467511232224806, 0.0009340479953669897},
+    {7.5625, 0.017084727931818686, -0.014186695976146694,
+     -0.00093796337032374833, 0.00088123432519824469},
+    {7.625, 0.016220070374983235, -0.013488003784296309,
+     -0.00088445926454402024, 0.00083137570710785282},
+    {7.6875, 0.015398036236240559, -0.012822492401905437,
+     -0.00083398324565238618, 0.00078430912430030449},
+    {7.75, 0.014616598723330803, -0.012188667961891077,
+     -0.00078636567496071462, 0.00073988037398987655},
+    {7.8125, 0.013873822475024901, -0.011585098251815237,
+     -0.00074144628811617522, 0.00069794360514236679},
+    {7.875, 0.013167859773308761, -0.01101041056961145,
+     -0.00069907368695945713, 0.00065836087926204152},
+    {7.9375, 0.012496946885494567, -0.010463289622986423,
+     -0.00065910485814087703, 0.00062100175318147589},
+    {8, 0.011859400548598562, -0.0099424754744130359,
+     -0.00062140471715081474, 0.0005857428828488023},
+    {8.0625, 0.011253614566200975, -0.009446761533281783,
+     -0.00058584567648259118, 0.00055246764714363518},
+    {8.125, 0.010678056536926194, -0.0089749925964617491,
+     -0.00055230723670533842, 0.00052106579078930266},
+    {8.1875, 0.010131264705924781, -0.0085260629382350149,
+     -0.00052067559928152768, 0.00049143308546489113},
+    {8.25, 0.0096118449270889521, -0.0080989144503098767,
+     -0.00049084330001878036, 0.00046347100825587696},
+    {8.3125, 0.0091184677443572008, -0.0076925348323838398,
+     -0.00046270886209827606, 0.00043708643661671603},
+    {8.375, 0.0086498655892965817, -0.0073059558335187838,
+     -0.00043617646767276323, 0.00041219135905264044},
+    {8.4375, 0.0082048300710070177, -0.0069382515444003237,
+     -0.00041115564707557473, 0.00038870260076086059},
+    {8.5, 0.0077822093922701556, -0.0065885367403867544,
+     -0.00038756098472863263, 0.00036654156350357509},
+    {8.5625, 0.0073809058514421244, -0.0062559652751018246,
+     -0.00036531184088185839, 0.00034563397901641322},
+    {8.625, 0.0069998734513604041, -0.0059397285241925887,
+     -0.00034433208835899063, 0.00032590967528622802},
+    {8.6875, 0.0066381155999528704, -0.005639053878756183,
+     -0.00032454986352553573, 0.00030730235506156231},
+    {8.75, 0.0062946829052544567, -0.0053532032878354646,
+     -0.00030589733073345512, 0.0002897493859874524},
+    {8.8125, 0.0059686710619117848, -0.0050814718492930644,
+     -0.00028831045953435827, 0.00027319160178370142},
+    {8.875, 0.0056592188196990826, -0.004823186448295198,
+     -0.00027172881398846186, 0.00025757311391221281},
+    {8.9375, 0.0053655060384591221, -0.0045777044425680908,
+     -0.00025609535343038269, 0.0002428411332044418},
+    {9, 0.0050867518258687879, -0.0043444123935330592,
+     -0.00024135624408516993, 0.00022894580094462099},
+    {9.125, 0.0045711811170906485, -0.0039120831300728364,
+     -0.00021436071945604585, 0.00020347934803578065},
+    {9.25, 0.004106978426233151, -0.0035218298044869868,
+     -0.00019036917862091821, 0.00018082762618000715},
+    {9.375, 0.0036891366449990936, -0.0031696769714535584,
+     -0.00016904943847752312, 0.00016068200555168931},
+    {9.5, 0.0033131227514596826, -0.0028520094741692897,
+     -0.00015010576179838367, 0.00014276735082720173},
+    {9.625, 0.0029748347023826676, -0.002565541799035021,
+     -0.00013327489865116993, 0.00012683843563117525},
+    {9.75, 0.002670562031288991, -0.0023072897651068721,
+     -0.00011832255205676267, 0.00011267673354803911},
+    {9.875, 0.0023969498317103145, -0.0020745444093480669,
+     -0.00010504022325812997, 0.00010008754725313462},
+    {10, 0.0021509658769531433, -0.0018648479308152671,
+     -9.324239654076336e-05, 8.8897441068550308e-05},
+    {10.125, 0.0019298706336787189, -0.0016759715602270246,
+     -8.2764027665532079e-05, 7.8951945662803229e-05},
+    {10.25, 0.0017311899161457226, -0.0015058952256022924,
+     -7.3458303687916706e-05, 7.0113506715587591e-05},
+    {10.375, 0.0015526899849100475, -0.0013527888895838816,
+     -6.5194645281150914e-05, 6.2259652183341757e-05},
+    {10.5, 0.0013923548749027815, -0.0012149954394756659,
+     -5.7856925689317425e-05, 5.5281355351491439e-05},
+    {10.625, 0.0012483657800423477, -0.0010910150167581256,
+     -5.1341883141558854e-05, 4.9081573166878021e-05},
+    {10.75, 0.0011190822974204652, -0.00097949067877012817,
+     -4.5557705989308285e-05, 4.3573941429790716e-05},
+    {10.875, 0.0010030254004836897, -0.00087919529124540305,
+     -4.0422772011282898e-05, 3.8681610308503839e-05},
+    {11, 0.00089886197081370236, -0.00078901955638214008,
+     -3.5864525290097275e-05, 3.4336205338326005e-05},
+    {11.125, 0.0008053907599904239, -0.00070796108703336381,
+     -3.1818475821724218e-05, 3.0476900598581856e-05},
+    {11.25, 0.00072152966152118705, -0.00063511444337955724,
+     -2.8227308594646987e-05, 2.7049592140099288e-05},
+    {11.375, 0.00064630416613751, -0.00056966205404150301,
+     -2.5040090287538595e-05, 2.4006160976875977e-05},
+    {11.5, 0.00057883690305278489, -0.00051086594897932329,
+     -2.2211562999101011e-05, 2.1303816071676427e-05},
+    {11.625, 0.00051833816838134481, -0.00045806023668099353,
+     -1.9701515556171766e-05, 1.8904508748312203e-05},
+    {11.75, 0.00046409735238746145, -0.00041064426305529255,
+     -1.7474223959799683e-05, 1.6774410864185399e-05},
+    {11.875, 0.00041547517274517759, -0.00036807639410125234,
+     -1.5497953435842203e-05, 1.4883449885283032e-05},
+    {12, 0.00037189666126999658, -0.00032986836882490116,
+     -1.3744515367704215e-05, 1.3204894731245961e-05},
+    {12.125, 0.0003328448150957396, -0.00029558017301417166,
+     -1.2188873113986461e-05, 1.1714986908631095e-05},
+    {12.25, 0.0002978548637452535, -0.00026481538836761433,
+     -1.0808791361943442e-05, 1.0392612033509247e-05},
+    {12.375, 0.00026650908479167548, -0.00023721697510738123,
+     -9.5845242467628781e-06, 9.2190073668542624e-06},
+    {12.5, 0.00023843212706143972, -0.00021246344959938219,
+     -8.4985379839752876e-06, 8.1775014539123258e-06},
+    {12.625, 0.00021328678360245487, -0.00019026542166236015,
+     -7.5352642242518868e-06, 7.253282377427891e-06},
+    {12.75, 0.00019077018058957863, -0.00017036245918274488,
+     -6.680880752264505e-06, 6.4331915092480647e-06},
+    {12.875, 0.00017061033659234229, -0.00015252025037407481,
+     -5.9231165193815464e-06, 5.7055399799427935e-06},
+    {13, 0.00015256306464203381, -0.00013652803653948072,
+     -5.2510783284415656e-06, 5.0599453857352553e-06},
+    {13.25, 0.00012195192878856977, -0.00010935461819479288,
+     -4.1265893658412408e-06, 3.9790741551374532e-06},
+    {13.5, 9.7439513016848336e-05, -8.7544389561880937e-05,
+     -3.2423847985881828e-06, 3.1285150820203987e-06},
+    {13.75, 7.7820702443202709e-05, -7.0049254162328356e-05,
+     -2.5472456059028495e-06, 2.4593337739793064e-06},
+    {14, 6.2126222259698786e-05, -5.6023519345315162e-05,
+     -2.0008399766183986e-06, 1.9329584354136956e-06},
+    {14.25, 4.9577010399742133e-05, -4.4785373496809536e-05,
+     -1.5714166139231415e-06, 1.5189939506039648e-06},
+    {14.5, 3.9547302545307288e-05, -3.5785562422565325e-05,
+     -1.2339849111229421e-06, 1.1934949498335934e-06},
+    {14.75, 3.1534784534134997e-05, -2.8581951030470422e-05,
+     -9.6887969594814992e-07, 9.3760201716121561e-07},
+    {15, 2.5136474241186646e-05, -2.2818888643266632e-05,
+     -7.6062962144222103e-07, 7.3646507624396053e-07},
+    {15.25, 2.0029273944830579e-05, -1.8210489297036736e-05,
+     -5.9706522285366343e-07, 5.7839378036531423e-07},
+    {15.5, 1.5954271451602593e-05, -1.4527098368131825e-05,
+     -4.6861607639134921e-07, 4.5418726624694203e-07},
+    {15.75, 1.2704104878462816e-05, -1.1584349124316308e-05,
+     -3.6775711505766057e-07, 3.5660557321739799e-07},
+    {16, 1.0112784233975976e-05, -9.2343218575586104e-06,
+     -2.8857255804870658e-07, 2.7995291075446255e-07},
+    {16.25, 8.0474997530360606e-06, -7.358407992584971e-06,
+     -2.264125536179991e-07, 2.1974920172577222e-07},
+    {16.5, 6.4020441900531126e-06, -5.861555249724993e-06,
+     -1.776228863553028e-07, 1.7247127318220753e-07},
+    {16.75, 5.0915197137522103e-06, -4.6676303292568884e-06,
+     -1.3933224863453397e-07, 1.3534897985050849e-07},
+    {17, 4.0480973227182514e-06, -3.7156849892974148e-06,
+     -1.0928485262639456e-07, 1.0620464110371118e-07},
+    {17.25, 3.21760335065464e-06, -2.9569517417687675e-06,
+     -8.5708746138225145e-08, 8.3326619888004047e-08},
+    {17.5, 2.5567914860606709e-06, -2.3524282993083255e-06,
+     -6.7212237123095016e-08, 6.5369806634693189e-08},
+    {17.75, 2.0311539141827902e-06, -1.8709367050096759e-06,
+     -5.2702442394638758e-08, 5.1277299542607297e-08},
+    {18, 1.6131607636107547e-06, -1.4875648714576279e-06,
+     -4.1321246429378553e-08, 4.0218779601211932e-08},
+    {18.25, 1.2808634507775346e-06, -1.1824159578051591e-06,
+     -3.2394957748086551e-08, 3.154203156464394e-08},
+    {18.5, 1.0167673306084024e-06, -9.396053749425018e-07,
+     -2.5394739863310859e-08, 2.473481403354219e-08},
+    {18.75, 8.0692990941041121e-07, -7.4645684661427806e-07,
+     -1.9905515909714081e-08, 1.9394875014322893e-08},
+    {19, 6.4024792684038916e-07, -5.9285837514471914e-07,
+     -1.5601536188018925e-08, 1.5206377165393561e-08},
+    {19.25, 5.0788136246013613e-07, -4.7074657892187109e-07,
+     -1.2227183868100547e-08, 1.1921365793005661e-08},
+    {19.5, 4.0279153873657058e-07, -3.7369402391484385e-07,
+     -9.5818980490985609e-09, 9.3452033865546215e-09},
+    {19.75, 3.1937621022632859e-07, -2.9657913984805825e-07,
+     -7.5083326543812211e-09, 7.3251235692113259e-09},
+    {20, 2.5318218504434771e-07, -2.3532231861233842e-07,
+     -5.8830579653084603e-09, 5.7412378069436465e-09}};
+
+} // namespace ThermalFunctions
+} // namespace BSMPT
@@ -12,8 +12,13 @@
 #include <BSMPT/ThermalFunctions/ThermalFunctions.h>
 #include <BSMPT/ThermalFunctions/thermalcoefficientcalculator.h>
 #include <BSMPT/models/SMparam.h>
+#include <algorithm>
+#include <array>
 #include <complex>
 #include <map>
+#include <vector>
+
+#include <Eigen/Core>
 
 #include <iostream>
 
@@ -89,6 +94,15 @@ double JbosonIntegrand(const double &x, const double &k, int diff)
           (complex<double>(2, 0) * TmpSqrt *
            (complex<double>(1, 0) - exp(-TmpSqrt)));
   }
+  else if (diff == 2)
+  {
+    complex<double> ExpTerm = exp(-TmpSqrt);
+    res = -kcomplex * kcomplex * ExpTerm *
+          (complex<double>(1, 0) - ExpTerm + TmpSqrt) /
+          (complex<double>(4, 0) * TmpSqrt * TmpSqrt * TmpSqrt *
+           (complex<double>(1, 0) - ExpTerm) *
+           (complex<double>(1, 0) - ExpTerm));
+  }
   else
   {
     (void)x;
@@ -115,6 +129,15 @@ double JfermionIntegrand(const double &x, const double &k, int diff)
           (complex<double>(2, 0) * TmpSqrt *
            (complex<double>(1, 0) + exp(-TmpSqrt)));
   }
+  else if (diff == 2)
+  {
+    complex<double> ExpTerm = exp(-TmpSqrt);
+    res = kcomplex * kcomplex * ExpTerm *
+          (complex<double>(1, 0) + ExpTerm + TmpSqrt) /
+          (complex<double>(4, 0) * TmpSqrt * TmpSqrt * TmpSqrt *
+           (complex<double>(1, 0) + ExpTerm) *
+           (complex<double>(1, 0) + ExpTerm));
+  }
   else
   {
     (void)x;
@@ -220,6 +243,20 @@ double JfermionInterpolatedLow(const double &x, const int &n, int diff)
     }
     res += sum;
   }
+  else if (diff == 2)
+  {
+    res = (-6 * cf + 3) / 96.0;
+    res += (log(x) + 1) / 16.0;
+    double sum = 0;
+    for (int l = 2; l <= n; l++)
+    {
+      double Kl =
+          FermionInterpolatedLowCoefficientCalculator.GetCoefficentAtOrder(l);
+      sum += -Kl * pow(-1 / 4.0, l) * pow(x, l - 1) * (l + 1) * l *
+             pow(M_PI, 2 - 2 * l);
+    }
+    res += sum;
+  }
 
   return res;
 }
@@ -269,6 +306,21 @@ double JbosonInterpolatedLow(const double &x, const int &n, int diff)
     }
     res += sum;
   }
+  else if (diff == 2)
+  {
+    res = (6 * cb - 3) / 96.0;
+    res += -(log(x) + 1) / 16.0;
+    res += -M_PI / (8 * sqrt(x));
+    double sum = 0;
+    for (int l = 2; l <= n; l++)
+    {
+      double Kl =
+          BosonInterpolatedLowCoefficientCalculator.GetCoefficentAtOrder(l);
+      sum += Kl * pow(-1 / 4.0, l) * pow(x, l - 1) * (l + 1) * l *
+             pow(M_PI, 2 - 2 * l);
+    }
+    res += sum;
+  }
   return res;
 }
 
@@ -297,10 +349,24 @@ double JInterpolatedHigh(const double &x, const int &n, int diff)
     {
       double Kl =
           JInterpolatedHighCoefficientCalculator.GetCoefficentAtOrder(l);
-      sum += Kl * pow(x, (1 - l) / 2) * (2 * l + 2 * sqrt(x) - 3);
+      sum += Kl * pow(x, (1 - l) / 2.0) * (2 * l + 2 * sqrt(x) - 3);
     }
     res = exp(-sqrt(x)) * sqrt(2 * M_PI) / (8 * pow(x, 3.0 / 4.0)) * sum;
   }
+  else if (diff == 2)
+  {
+    double sum = 0;
+    for (int l = 0; l <= n; l++)
+    {
+      double Kl =
+          JInterpolatedHighCoefficientCalculator.GetCoefficentAtOrder(l);
+      double Exponent = 0.75 - l / 2.0;
+      sum += Kl * pow(x, Exponent - 2) *
+             (-x / 4 + (4 * Exponent - 1) * sqrt(x) / 4 -
+              Exponent * (Exponent - 1));
+    }
+    res = exp(-sqrt(x)) * sqrt(M_PI / 2) * sum;
+  }
   return res;
 }
 
@@ -338,31 +404,395 @@ double JbosonInterpolated(const double &x, int diff)
   return res;
 }
 
-tk::spline JbosonNegativeSpline(NegLinearIntTransposed[0],
-                                NegLinearIntTransposed[1],
-                                tk::spline::cspline,
-                                false,
-                                tk::spline::first_deriv,
-                                -pow(M_PI, 2) / 12,
-                                tk::spline::first_deriv,
-                                3.816357189);
-
 double JbosonInterpolatedNegative(const double &x, int diff)
 {
   if (x >= 0) return 0;
-  double PotVal = 0;
+  // knots at -x = 0, 1, ..., C_NegLine - 1, linear extrapolation beyond
+  const double z = -x;
+  const std::size_t Index =
+      std::min(static_cast<std::size_t>(z), std::size_t(C_NegLine - 1));
+  const auto &Segment = JbosonNegativeSpline[Index];
+  const double h      = z - Index;
+  double PotVal       = 0;
 
   if (diff == 0)
   {
-    PotVal = JbosonNegativeSpline(-x) + 3.533375127e-06;
+    PotVal = ((Segment.d * h + Segment.c) * h + Segment.b) * h + Segment.y +
+             3.533375127e-06;
   }
   else if (diff == 1)
   {
-    PotVal = -JbosonNegativeSpline.deriv(1, -x);
+    PotVal = -((3 * Segment.d * h + 2 * Segment.c) * h + Segment.b);
+  }
+  else if (diff == 2)
+  {
+    PotVal = 6 * Segment.d * h + 2 * Segment.c;
   }
 
   return PotVal;
 }
 
+namespace
+{
+/**
+ * @brief The LowExpansion struct holds the low x expansion of J_+ or J_- for
+ * one derivative in the form Poly(x) + Root * x^{3/2 - diff} + Log * x^{2 -
+ * diff} log(x), with the polynomial in Horner order (highest power first)
+ */
+struct LowExpansion
+{
+  std::array<double, 6> Poly{};
+  double Root{0};
+  double Log{0};
+};
+
+/**
+ * @brief The HighExpansion struct holds the sums over the coefficients of
+ * JInterpolatedHigh with n = 3 as polynomials in y = x^{-1/2} in Horner order
+ */
+struct HighExpansion
+{
+  std::array<double, 4> Sum{}, FirstDerivative{}, SecondDerivativeLinear{},
+      SecondDerivativeConstant{};
+};
+
+/**
+ * Low x expansion of JbosonInterpolatedLow(x, 3, diff)
+ */
+LowExpansion MakeBosonLowExpansion(int diff)
+{
+  const int n     = 3;
+  const double cb = 1.5 + 2 * std::log(4 * M_PI) - 2 * C_euler_gamma;
+  std::array<double, 6> Coefficients{};
+  LowExpansion res;
+  if (diff == 0)
+  {
+    Coefficients[0] = -std::pow(M_PI, 4) / 45.0;
+    Coefficients[1] = std::pow(M_PI, 2) / 12.0;
+    Coefficients[2] = cb / 32.0;
+    res.Root        = -M_PI / 6;
+    res.Log         = -1 / 32.0;
+  }
+  else if (diff == 1)
+  {
+    Coefficients[0] = std::pow(M_PI, 2) / 12.0;
+    Coefficients[1] = (6 * cb - 3) / 96.0;
+    res.Root        = -M_PI / 4.0;
+    res.Log         = -1 / 16.0;
+  }
+  else if (diff == 2)
+  {
+    Coefficients[0] = (6 * cb - 3) / 96.0 - 1 / 16.0;
+    res.Root        = -M_PI / 8;
+    res.Log         = -1 / 16.0;
+  }
+  for (int l = 2; l <= n; l++)
+  {
+    double Kl =
+        BosonInterpolatedLowCoefficientCalculator.GetCoefficentAtOrder(l);
+    double Factor = Kl * std::pow(-1 / 4.0, l) * std::pow(M_PI, 2 - 2 * l);
+    if (diff == 0) Coefficients[l + 1] += Factor;
+    if (diff == 1) Coefficients[l] += Factor * (l + 1);
+    if (diff == 2) Coefficients[l - 1] += Factor * (l + 1) * l;
+  }
+  std::copy(Coefficients.rbegin(), Coefficients.rend(), res.Poly.begin());
+  return res;
+}
+
+/**
+ * Low x expansion of JfermionInterpolated(x, diff) for x < C_FermionTheta,
+ * i.e. -JfermionInterpolatedLow(x, 4, diff) - C_FermionShift for diff = 0
+ */
+LowExpansion MakeFermionLowExpansion(int diff)
+{
+  const int n     = 4;
+  const double cf = 1.5 + 2 * log(4 * M_PI) - 2 * C_euler_gamma - 2 * log(4);
+  std::array<double, 6> Coefficients{};
+  LowExpansion res;
+  if (diff == 0)
+  {
+    Coefficients[0] = 7 * std::pow(M_PI, 4) / 360.0 - C_FermionShift;
+    Coefficients[1] = -std::pow(M_PI, 2) / 24;
+    Coefficients[2] = cf / 32.0;
+    res.Log         = -1 / 32.0;
+  }
+  else if (diff == 1)
+  {
+    Coefficients[0] = -std::pow(M_PI, 2) / 24.0;
+    Coefficients[1] = (6 * cf - 3) / 96;
+    res.Log         = -1 / 16.0;
+  }
+  else if (diff == 2)
+  {
+    Coefficients[0] = (6 * cf - 3) / 96.0 - 1 / 16.0;
+    res.Log         = -1 / 16.0;
+  }
+  for (int l = 2; l <= n; l++)
+  {
+    double Kl =
+        FermionInterpolatedLowCoefficientCalculator.GetCoefficentAtOrder(l);
+    double Factor = Kl * std::pow(-1 / 4.0, l) * std::pow(M_PI, 2 - 2 * l);
+    if (diff == 0) Coefficients[l + 1] += Factor;
+    if (diff == 1) Coefficients[l] += Factor * (l + 1);
+    if (diff == 2) Coefficients[l - 1] += Factor * (l + 1) * l;
+  }
+  std::copy(Coefficients.rbegin(), Coefficients.rend(), res.Poly.begin());
+  return res;
+}
+
+HighExpansion MakeHighExpansion()
+{
+  const int n = 3;
+  HighExpansion res;
+  for (int l = 0; l <= n; l++)
+  {
+    double Kl = JInterpolatedHighCoefficientCalculator.GetCoefficentAtOrder(l);
+    double Exponent                     = 0.75 - l / 2.0;
+    res.Sum[n - l]                      = Kl;
+    res.FirstDerivative[n - l]          = Kl * (2 * l - 3);
+    res.SecondDerivativeLinear[n - l]   = Kl * (4 * Exponent - 1) / 4;
+    res.SecondDerivativeConstant[n - l] = Kl * Exponent * (Exponent - 1);
+  }
+  return res;
+}
+
+const std::array<LowExpansion, 3> BosonLowExpansion{
+    MakeBosonLowExpansion(0),
+    MakeBosonLowExpansion(1),
+    MakeBosonLowExpansion(2)};
+const std::array<LowExpansion, 3> FermionLowExpansion{
+    MakeFermionLowExpansion(0),
+    MakeFermionLowExpansion(1),
+    MakeFermionLowExpansion(2)};
+const HighExpansion JHighExpansion = MakeHighExpansion();
+
+/**
+ * The expansions are evaluated for PacketSize arguments at once with the
+ * vectorised square root, exponential and logarithm of Eigen
+ */
+constexpr std::size_t PacketSize = 4;
+using Packet                     = Eigen::Array<double, PacketSize, 1>;
+
+template <std::size_t N>
+inline Packet Horner(const std::array<double, N> &Coefficients,
+                     const Packet &x)
+{
+  Packet res = Packet::Constant(Coefficients[0]);
+  for (std::size_t k = 1; k < N; k++)
+  {
+    res = res * x + Coefficients[k];
+  }
+  return res;
+}
+
+/**
+ * Evaluates the low x expansion for n arguments, x and out must hold n
+ * rounded up to a multiple of PacketSize entries
+ */
+template <int diff>
+void EvaluateLow(const double *x,
+                 double *out,
+                 std::size_t n,
+                 const LowExpansion &Expansion)
+{
+  for (std::size_t i = 0; i < n; i += PacketSize)
+  {
+    const Packet X = Eigen::Map<const Packet>(x + i);
+    // J is finite at x = 0, the log terms vanish there
+    const Packet LogX  = (X == 0).select(Packet::Ones(), X).log();
+    const Packet RootX = X.sqrt();
+    Packet Root, Log;
+    if constexpr (diff == 0)
+    {
+      Root = X * RootX;
+      Log  = X.square() * LogX;
+    }
+    else if constexpr (diff == 1)
+    {
+      Root = RootX;
+      Log  = X * LogX;
+    }
+    else
+    {
+      Root = RootX.inverse();
+      Log  = LogX;
+    }
+    Eigen::Map<Packet>(out + i) = Horner(Expansion.Poly, X) +
+                                  Expansion.Root * Root + Expansion.Log * Log;
+  }
+}
+
+/**
+ * Evaluates the high x expansion for n arguments, see EvaluateLow
+ */
+template <int diff>
+void EvaluateHigh(const double *x,
+                  double *out,
+                  std::size_t n,
+                  double Sign,
+                  double Shift)
+{
+  const auto &C = JHighExpansion;
+  for (std::size_t i = 0; i < n; i += PacketSize)
+  {
+    const Packet X        = Eigen::Map<const Packet>(x + i);
+    const Packet Root     = X.sqrt();
+    const Packet y        = Root.inverse();
+    const Packet Exp      = (-Root).exp();
+    const Packet Sum      = Horner(C.Sum, y);
+    const Packet RootRoot = Root.sqrt();
+    Packet res;
+    if constexpr (diff == 0)
+    {
+      res = -std::sqrt(M_PI / 2) * Exp * Root * RootRoot * Sum;
+    }
+    else if constexpr (diff == 1)
+    {
+      res = std::sqrt(2 * M_PI) / 8 * Exp / (Root * RootRoot) *
+            (Root * Horner(C.FirstDerivative, y) + 2 * X * Sum);
+    }
+    else
+    {
+      res = std::sqrt(M_PI / 2) * Exp / (X * RootRoot) *
+            (-X / 4 * Sum + Root * Horner(C.SecondDerivativeLinear, y) -
+             Horner(C.SecondDerivativeConstant, y));
+    }
+    Eigen::Map<Packet>(out + i) = Sign * res + Shift;
+  }
+}
+
+/**
+ * @brief The BatchBuffers struct holds the indices and arguments of the
+ * regions of JbosonBatch and JfermionBatch, one instance per thread
+ */
+struct BatchBuffers
+{
+  std::vector<std::size_t> Low, High, Negative;
+  std::vector<double> Arguments, Results;
+};
+
+BatchBuffers &GetBatchBuffers()
+{
+  thread_local BatchBuffers Buffers;
+  return Buffers;
+}
+
+/**
+ * Evaluates Kernel(Arguments, Results, n) for the arguments x[Index] and
+ * writes the results to out[Index]. The buffers are padded with x = 1 to a
+ * multiple of PacketSize.
+ */
+template <typename KernelType>
+void EvaluateRegion(const std::vector<std::size_t> &Index,
+                    const double *x,
+                    double *out,
+                    BatchBuffers &Buffers,
+                    const KernelType &Kernel)
+{
+  if (Index.empty()) return;
+  const std::size_t Padded =
+      (Index.size() + PacketSize - 1) / PacketSize * PacketSize;
+  Buffers.Arguments.resize(Padded);
+  Buffers.Results.resize(Padded);
+  for (std::size_t i = 0; i < Index.size(); i++)
+  {
+    Buffers.Arguments[i] = x[Index[i]];
+  }
+  std::fill(Buffers.Arguments.begin() + Index.size(),
+            Buffers.Arguments.end(),
+            1);
+  Kernel(Buffers.Arguments.data(), Buffers.Results.data(), Index.size());
+  for (std::size_t i = 0; i < Index.size(); i++)
+  {
+    out[Index[i]] = Buffers.Results[i];
+  }
+}
+template <int diff>
+void BosonBatch(const double *x, double *out, std::size_t n)
+{
+  auto &Buffers = GetBatchBuffers();
+  Buffers.Low.clear();
+  Buffers.High.clear();
+  Buffers.Negative.clear();
+  for (std::size_t i = 0; i < n; i++)
+  {
+    if (x[i] >= C_BosonTheta)
+      Buffers.High.push_back(i);
+    else if (x[i] >= 0)
+      Buffers.Low.push_back(i);
+    else
+      Buffers.Negative.push_back(i);
+  }
+
+  EvaluateRegion(Buffers.Low,
+                 x,
+                 out,
+                 Buffers,
+                 [](const double *X, double *Y, std::size_t m)
+                 { EvaluateLow<diff>(X, Y, m, BosonLowExpansion[diff]); });
+  EvaluateRegion(
+      Buffers.High,
+      x,
+      out,
+      Buffers,
+      [](const double *X, double *Y, std::size_t m)
+      { EvaluateHigh<diff>(X, Y, m, 1, (diff == 0) ? -C_BosonShift : 0); });
+  for (const auto &i : Buffers.Negative)
+  {
+    out[i] = JbosonInterpolatedNegative(x[i], diff);
+  }
+}
+
+template <int diff>
+void FermionBatch(const double *x, double *out, std::size_t n)
+{
+  auto &Buffers = GetBatchBuffers();
+  Buffers.Low.clear();
+  Buffers.High.clear();
+  for (std::size_t i = 0; i < n; i++)
+  {
+    if (x[i] >= C_FermionTheta)
+      Buffers.High.push_back(i);
+    else
+      Buffers.Low.push_back(i);
+  }
+
+  EvaluateRegion(Buffers.Low,
+                 x,
+                 out,
+                 Buffers,
+                 [](const double *X, double *Y, std::size_t m)
+                 { EvaluateLow<diff>(X, Y, m, FermionLowExpansion[diff]); });
+  EvaluateRegion(Buffers.High,
+                 x,
+                 out,
+                 Buffers,
+                 [](const double *X, double *Y, std::size_t m)
+                 { EvaluateHigh<diff>(X, Y, m, -1, 0); });
+}
+} // namespace
+
+void JbosonBatch(const double *x, double *out, std::size_t n, int diff)
+{
+  switch (diff)
+  {
+  case 0: BosonBatch<0>(x, out, n); break;
+  case 1: BosonBatch<1>(x, out, n); break;
+  case 2: BosonBatch<2>(x, out, n); break;
+  default: std::fill(out, out + n, 0);
+  }
+}
+
+void JfermionBatch(const double *x, double *out, std::size_t n, int diff)
+{
+  switch (diff)
+  {
+  case 0: FermionBatch<0>(x, out, n); break;
+  case 1: FermionBatch<1>(x, out, n); break;
+  case 2: FermionBatch<2>(x, out, n); break;
+  default: std::fill(out, out + n, 0);
+  }
+}
+
 } // namespace ThermalFunctions
 } // namespace BSMPT
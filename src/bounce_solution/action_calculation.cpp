@@ -68,6 +68,35 @@ BounceActionInt::BounceActionInt(
   SetPath(InitPath_In);
 }
 
+BounceActionInt::BounceActionInt(
+    std::vector<std::vector<double>> InitPath_In,
+    std::vector<double> TrueVacuum_In,
+    std::vector<double> FalseVacuum_In,
+    std::function<double(std::vector<double>)> &V_In,
+    const std::function<std::vector<std::vector<double>>(std::vector<double>)>
+        &Hessian_In,
+    double T_In,
+    int MaxPathIntegrations_In,
+    const BatchFunction &VBatch_In)
+{
+  // Initialization of the class when the Hessian is provided
+  this->dim    = InitPath_In.at(0).size();
+  this->Vfalse = V_In(FalseVacuum_In);
+  this->V = [&](std::vector<double> vev) { return V_In(vev) - this->Vfalse; };
+  // Use numerical derivative
+  this->dV = [=](auto const &arg)
+  { return NablaNumerical(arg, this->V, this->eps); };
+  this->Hessian             = Hessian_In;
+  this->VBatch              = VBatch_In;
+  this->TrueVacuum          = TrueVacuum_In;
+  this->FalseVacuum         = FalseVacuum_In;
+  this->InitPath            = InitPath_In;
+  this->T                   = T_In;
+  this->MaxPathIntegrations = MaxPathIntegrations_In;
+  // Set Spline path
+  SetPath(InitPath_In);
+}
+
 void BounceActionInt::SetPath(std::vector<std::vector<double>> InitPath_In)
 {
   // Method to be called when the path is changed manually
@@ -103,7 +132,21 @@ void BounceActionInt::RasterizedVdl(double l_start)
   for (int it = 0; it <= 1000; it++)
   {
     l_temp.push_back(l_start + it / 1000.0 * (Spline.L - l_start));
-    dVdl_temp.push_back(Calc_dVdl(l_temp.back()));
+  }
+  if (VBatch)
+  {
+    // Evaluate the finite differences stencils of all gradients at once
+    std::vector<std::vector<double>> phi_temp;
+    for (const auto &l : l_temp)
+      phi_temp.push_back(Spline(l));
+    const auto gradients = NablaNumerical(phi_temp, VBatch, this->eps);
+    for (std::size_t i = 0; i < l_temp.size(); i++)
+      dVdl_temp.push_back(gradients[i] * Spline.dl(l_temp[i]));
+  }
+  else
+  {
+    for (const auto &l : l_temp)
+      dVdl_temp.push_back(Calc_dVdl(l));
   }
   // Set the not-a-knot boundary conditions
   RasterizeddVdl.set_boundary(
@@ -858,6 +901,11 @@ void BounceActionInt::Solve1DBounce(
   int mode = 0; // Binary search. 0 = linear, 1 = log
   for (int i = 0; i < maxiter; i++)
   {
+    if (BudgetExhausted(Budget))
+    {
+      StateOfBounceActionInt = ActionStatus::BudgetExhausted;
+      return;
+    }
     if (mode == 0)
     {
       l0            = (lmax + lmin) / 2.0; // Perform binary search
@@ -1393,6 +1441,13 @@ void BounceActionInt::PathDeformation(std::vector<double> &l,
                        "----------------\tPath deformation\t----------------");
   for (int it_maxpath = 0; it_maxpath < MaxSinglePathDeformations; it_maxpath++)
   {
+    if (BudgetExhausted(Budget))
+    {
+      StateOfBounceActionInt = ActionStatus::BudgetExhausted;
+      BSMPT::Logger::Write(BSMPT::LoggingLevel::BounceDetailed,
+                           "Evaluation budget used up during path deformation");
+      return;
+    }
     NoBestPathCounter++;
     reductor = ReductorCalculator(MaximumGradient) / stepsize;
 
@@ -1653,6 +1708,7 @@ void BounceActionInt::CalculateAction(
                                "\t---------------------------------\n");
       // Deform path
       PathDeformation(l, rho_l_spl);
+      if (StateOfBounceActionInt == ActionStatus::BudgetExhausted) return;
 
       // Solves 1D bounce equation
       Solve1DBounce(rho,
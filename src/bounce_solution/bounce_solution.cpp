@@ -49,6 +49,13 @@ BounceSolution::BounceSolution(
     CalculateOptimalDiscreteSymmetry();
     BounceSolution::GWInitialScan();
   }
+
+  if (IsBudgetExhausted())
+  {
+    Logger::Write(LoggingLevel::BounceDetailed,
+                  "Evaluation budget used up during the bounce solution.");
+    status_bounce_sol = StatusGW::BudgetExhausted;
+  }
 }
 
 BounceSolution::BounceSolution(
@@ -71,6 +78,11 @@ BounceSolution::BounceSolution(
 {
 }
 
+bool BounceSolution::IsBudgetExhausted() const
+{
+  return MinTracer and BudgetExhausted(MinTracer->Budget.get());
+}
+
 void BounceSolution::CalculateOptimalDiscreteSymmetry()
 {
   std::stringstream ss;
@@ -131,6 +143,7 @@ void BounceSolution::GWInitialScan()
 
   for (double T = Tc - dT; T >= phase_pair.T_low + dT; T -= dT)
   {
+    if (IsBudgetExhausted()) return;
     Logger::Write(LoggingLevel::BounceDetailed, "T = " + std::to_string(T));
 
     // Check if transition is energetically viable
@@ -144,7 +157,8 @@ void BounceSolution::GWInitialScan()
     std::function<double(std::vector<double>)> V = [&](std::vector<double> vev)
     {
       // Potential wrapper
-      return modelPointer->VEff(modelPointer->MinimizeOrderVEV(vev), T);
+      if (MinTracer->Budget) MinTracer->Budget->Consume();
+      return modelPointer->VEff(vev, T);
     };
     if (last_action < 0)
     {
@@ -158,9 +172,20 @@ void BounceSolution::GWInitialScan()
                                  TrueVacuum,
                                  FalseVacuum);
     }
-    BounceActionInt bc(
-        path, TrueVacuum, FalseVacuum, V, T, MaxPathIntegrations);
+    BounceActionInt bc(path,
+                       TrueVacuum,
+                       FalseVacuum,
+                       V,
+                       MinTracer->GetHessian(
+                           T, BounceActionInt::DefaultEps, false),
+                       T,
+                       MaxPathIntegrations,
+                       MinTracer->GetPotentialBatch(T, false));
+    bc.Budget = MinTracer->Budget.get();
     bc.CalculateAction();
+    if (bc.StateOfBounceActionInt ==
+        BounceActionInt::ActionStatus::BudgetExhausted)
+      return;
 
     last_path        = bc.Path;
     last_TrueVacuum  = bc.TrueVacuum;
@@ -188,6 +213,7 @@ void BounceSolution::CalculateActionAt(double T, bool smart)
 {
   // Action outside allowed range
   if (T < Tm or T > Tc) return;
+  if (IsBudgetExhausted()) return;
   Logger::Write(LoggingLevel::BounceDetailed, " T = " + std::to_string(T));
   // Find the closest solution to our goal temperature
   if (SolutionList.size() > 0)
@@ -212,7 +238,8 @@ void BounceSolution::CalculateActionAt(double T, bool smart)
     std::function<double(std::vector<double>)> V = [&](std::vector<double> vev)
     {
       // Potential wrapper
-      return modelPointer->VEff(modelPointer->MinimizeOrderVEV(vev), T);
+      if (MinTracer->Budget) MinTracer->Budget->Consume();
+      return modelPointer->VEff(vev, T);
     };
     std::vector<std::vector<double>> path;
 
@@ -225,9 +252,20 @@ void BounceSolution::CalculateActionAt(double T, bool smart)
     else
       path = {TrueVacuum, FalseVacuum};
 
-    BounceActionInt bc(
-        path, TrueVacuum, FalseVacuum, V, T, MaxPathIntegrations);
+    BounceActionInt bc(path,
+                       TrueVacuum,
+                       FalseVacuum,
+                       V,
+                       MinTracer->GetHessian(
+                           T, BounceActionInt::DefaultEps, false),
+                       T,
+                       MaxPathIntegrations,
+                       MinTracer->GetPotentialBatch(T, false));
+    bc.Budget = MinTracer->Budget.get();
     bc.CalculateAction();
+    if (bc.StateOfBounceActionInt ==
+        BounceActionInt::ActionStatus::BudgetExhausted)
+      return;
     if (bc.Action / T > 0)
     {
       SolutionList.insert(std::upper_bound(SolutionList.begin(),
@@ -247,13 +285,25 @@ void BounceSolution::CalculateActionAt(double T, bool smart)
     std::function<double(std::vector<double>)> V = [&](std::vector<double> vev)
     {
       // Potential wrapper
-      return modelPointer->VEff(modelPointer->MinimizeOrderVEV(vev), T);
+      if (MinTracer->Budget) MinTracer->Budget->Consume();
+      return modelPointer->VEff(vev, T);
     };
     std::vector<std::vector<double>> path = {TrueVacuum, FalseVacuum};
 
-    BounceActionInt bc(
-        path, TrueVacuum, FalseVacuum, V, T, MaxPathIntegrations);
+    BounceActionInt bc(path,
+                       TrueVacuum,
+                       FalseVacuum,
+                       V,
+                       MinTracer->GetHessian(
+                           T, BounceActionInt::DefaultEps, false),
+                       T,
+                       MaxPathIntegrations,
+                       MinTracer->GetPotentialBatch(T, false));
+    bc.Budget = MinTracer->Budget.get();
     bc.CalculateAction();
+    if (bc.StateOfBounceActionInt ==
+        BounceActionInt::ActionStatus::BudgetExhausted)
+      return;
     if (bc.Action / T > 0)
     {
       SolutionList.push_back(bc);
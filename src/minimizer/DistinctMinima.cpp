@@ -0,0 +1,75 @@
+// SPDX-FileCopyrightText: 2021 Philipp Basler, Margarete Mühlleitner and Jonas
+// Müller
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file
+ */
+
+#include <BSMPT/minimizer/DistinctMinima.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace BSMPT
+{
+namespace Minimizer
+{
+
+DistinctMinima::DistinctMinima(double Tolerance) : Tolerance{Tolerance}
+{
+}
+
+double DistinctMinima::Key(const std::vector<double> &Point)
+{
+  return Point.empty() ? 0 : Point.front();
+}
+
+bool DistinctMinima::Insert(const std::vector<double> &Point,
+                            const double &PotVal)
+{
+  const double Position = Key(Point);
+  auto Begin            = Index.lower_bound(Position - Tolerance);
+  auto End              = Index.upper_bound(Position + Tolerance);
+  for (auto Entry = Begin; Entry != End; ++Entry)
+  {
+    auto &Cluster = Minima.at(Entry->second);
+    if (Cluster.Point.size() != Point.size()) continue;
+    bool Same = true;
+    for (std::size_t i = 0; i < Point.size() and Same; i++)
+    {
+      Same = std::abs(Cluster.Point.at(i) - Point.at(i)) <= Tolerance;
+    }
+    if (not Same) continue;
+
+    Cluster.Multiplicity++;
+    if (PotVal < Cluster.PotVal)
+    {
+      // the cluster is re-indexed at the first VEV of the deeper point
+      const std::size_t ClusterIndex = Entry->second;
+      Index.erase(Entry);
+      Index.emplace(Position, ClusterIndex);
+      Cluster.Point  = Point;
+      Cluster.PotVal = PotVal;
+    }
+    return false;
+  }
+
+  Index.emplace(Position, Minima.size());
+  Minima.push_back(DistinctMinimum{Point, PotVal, 1});
+  return true;
+}
+
+std::vector<DistinctMinimum> DistinctMinima::SortedByPotential() const
+{
+  auto res = Minima;
+  std::stable_sort(res.begin(),
+                   res.end(),
+                   [](const DistinctMinimum &a, const DistinctMinimum &b)
+                   { return a.PotVal < b.PotVal; });
+  return res;
+}
+
+} // namespace Minimizer
+} // namespace BSMPT
@@ -32,7 +32,8 @@ using namespace libcmaes;
 
 LibCMAESReturn min_cmaes_gen_all(const Class_Potential_Origin &model,
                                  const double &Temp,
-                                 const std::vector<double> &Start)
+                                 const std::vector<double> &Start,
+                                 const CancellationToken *Token)
 {
 
   const auto dim = model.get_nVEV();
@@ -57,32 +58,43 @@ LibCMAESReturn min_cmaes_gen_all(const Class_Potential_Origin &model,
   FitFunc cmafunc = [&](const double *v, const int &N)
   {
     (void)N;
+    // libcmaes has no way to stop from outside, the exception unwinds it
+    if (IsCancelled(Token)) throw MinimizerCancelled();
+    CountEvaluations(Token);
     std::vector<double> vev;
     for (std::size_t i{0}; i < dim; ++i)
       vev.push_back(v[i]);
-    auto minOrdVEV = model.MinimizeOrderVEV(vev);
-    auto VeffVal   = model.VEff(minOrdVEV, Temp);
-    return VeffVal;
+    return model.VEff(vev, Temp);
   };
 
-  CMASolutions cmasols = cmaes<>(cmafunc, cmaparams);
+  try
+  {
+    CMASolutions cmasols = cmaes<>(cmafunc, cmaparams);
 
-  Candidate bcand = cmasols.best_candidate();
+    Candidate bcand = cmasols.best_candidate();
 
-  std::vector<double> xsol = bcand.get_x();
+    std::vector<double> xsol = bcand.get_x();
 
-  std::vector<double> sol;
+    std::vector<double> sol;
 
-  for (std::size_t i = 0; i < dim; i++)
-  {
-    sol.push_back(xsol.at(i));
-  }
+    for (std::size_t i = 0; i < dim; i++)
+    {
+      sol.push_back(xsol.at(i));
+    }
 
-  LibCMAESReturn res;
-  res.CMAESStatus = cmasols.run_status();
-  res.result      = sol;
+    LibCMAESReturn res;
+    res.CMAESStatus = cmasols.run_status();
+    res.result      = sol;
 
-  return res;
+    return res;
+  }
+  catch (MinimizerCancelled &)
+  {
+    LibCMAESReturn res;
+    res.CMAESStatus = -1;
+    res.Cancelled   = true;
+    return res;
+  }
 }
 
 LibCMAESReturn
@@ -121,8 +133,7 @@ CMAES_Minimize_Plane_gen_all(const struct PointerContainerMinPlane &params,
       vMinTilde[i] = v[i];
     auto vev = TransformCoordinates(vMinTilde, params);
 
-    double res = params.modelPointer->VEff(
-        params.modelPointer->MinimizeOrderVEV(vev), params.Temp);
+    double res = params.modelPointer->VEff(vev, params.Temp);
     return res;
   };
 
@@ -22,20 +22,31 @@ namespace LibNLOPT
 double
 NLOPTVEff(const std::vector<double> &x, std::vector<double> &grad, void *data)
 {
-  auto settings = *static_cast<ShareInformationNLOPT *>(data);
-  (void)grad;
-  auto PotVEV = settings.model.MinimizeOrderVEV(x);
-  return settings.model.VEff(PotVEV, settings.Temp);
+  const auto &settings = *static_cast<ShareInformationNLOPT *>(data);
+  if (IsCancelled(settings.Token)) throw nlopt::forced_stop();
+  CountEvaluations(settings.Token);
+  if (not grad.empty())
+  {
+    auto &Workspace = settings.model.GetThreadWorkspace();
+    auto &Gradient  = Workspace.Gradient;
+    settings.model.VEffGradient(x, settings.Temp, Gradient, Workspace);
+    const auto &VevOrder = settings.model.Get_VevOrder();
+    for (std::size_t i = 0; i < grad.size(); i++)
+    {
+      grad[i] = Gradient.at(VevOrder.at(i));
+    }
+  }
+  return settings.model.VEff(x, settings.Temp);
 }
 
-NLOPTReturnType MinimizeUsingNLOPT(const Class_Potential_Origin &model,
-                                   const double &Temp)
+namespace
+{
+/**
+ * Sets the bounds of the search region of the global minimisation, which
+ * contains the tree-level minimum
+ */
+void SetSearchBounds(nlopt::opt &opt, const Class_Potential_Origin &model)
 {
-  ShareInformationNLOPT settings(model, Temp);
-  std::vector<double> VEV(model.get_nVEV());
-
-  nlopt::opt opt(nlopt::GN_ORIG_DIRECT_L,
-                 static_cast<unsigned int>(model.get_nVEV()));
   std::vector<double> LowerBound(model.get_nVEV(), -300),
       UpperBound(model.get_nVEV(), 300);
   for (std::size_t i{0}; i < model.get_nVEV(); ++i)
@@ -51,6 +62,49 @@ NLOPTReturnType MinimizeUsingNLOPT(const Class_Potential_Origin &model,
   }
   opt.set_lower_bounds(LowerBound);
   opt.set_upper_bounds(UpperBound);
+}
+
+/**
+ * Local minimisation with Algorithm starting from VEV
+ */
+NLOPTReturnType LocalMinimum(ShareInformationNLOPT &settings,
+                             std::vector<double> VEV,
+                             nlopt::algorithm Algorithm)
+{
+  nlopt::opt opt(Algorithm, static_cast<unsigned int>(VEV.size()));
+  opt.set_min_objective(NLOPTVEff, &settings);
+  opt.set_xtol_rel(1e-4);
+  opt.set_maxeval(1000);
+
+  double minf;
+  try
+  {
+    auto result  = opt.optimize(VEV, minf);
+    bool Success = (result == nlopt::SUCCESS) or
+                   (result == nlopt::FTOL_REACHED) or
+                   (result == nlopt::XTOL_REACHED);
+    return NLOPTReturnType(VEV, minf, result, Success);
+  }
+  catch (std::exception &e)
+  {
+    // e.g. nlopt::roundoff_limited in the line search
+    (void)e;
+    return NLOPTReturnType(
+        std::vector<double>(), 0, nlopt::result::FORCED_STOP, false);
+  }
+}
+} // namespace
+
+NLOPTReturnType MinimizeUsingNLOPT(const Class_Potential_Origin &model,
+                                   const double &Temp,
+                                   const CancellationToken *Token)
+{
+  ShareInformationNLOPT settings(model, Temp, Token);
+  std::vector<double> VEV(model.get_nVEV());
+
+  nlopt::opt opt(nlopt::GN_ORIG_DIRECT_L,
+                 static_cast<unsigned int>(model.get_nVEV()));
+  SetSearchBounds(opt, model);
 
   opt.set_min_objective(NLOPTVEff, &settings);
   opt.set_xtol_rel(1e-4);
@@ -75,6 +129,47 @@ NLOPTReturnType MinimizeUsingNLOPT(const Class_Potential_Origin &model,
   }
 }
 
+NLOPTReturnType MinimizeUsingNLOPTGradient(const Class_Potential_Origin &model,
+                                           const double &Temp,
+                                           nlopt::algorithm LocalAlgorithm,
+                                           const CancellationToken *Token)
+{
+  ShareInformationNLOPT settings(model, Temp, Token);
+  std::vector<double> VEV(model.get_nVEV());
+  const auto dim = static_cast<unsigned int>(model.get_nVEV());
+
+  nlopt::opt local(LocalAlgorithm, dim);
+  local.set_xtol_rel(1e-4);
+  local.set_maxeval(200);
+
+  nlopt::opt opt(nlopt::G_MLSL_LDS, dim);
+  SetSearchBounds(opt, model);
+  opt.set_local_optimizer(local);
+  opt.set_min_objective(NLOPTVEff, &settings);
+  opt.set_xtol_rel(1e-4);
+  opt.set_maxeval(1000);
+
+  double minf;
+  try
+  {
+    // MLSL only stops once the evaluation budget is used up
+    opt.optimize(VEV, minf);
+  }
+  catch (std::exception &e)
+  {
+    (void)e;
+    return NLOPTReturnType(
+        std::vector<double>(), 0, nlopt::result::FORCED_STOP, false);
+  }
+
+  auto res = LocalMinimum(settings, VEV, LocalAlgorithm);
+  if (not res.Success)
+  {
+    res = LocalMinimum(settings, VEV, nlopt::LN_COBYLA);
+  }
+  return res;
+}
+
 double NLOPTVEffPlane(const std::vector<double> &x,
                       std::vector<double> &grad,
                       void *data)
@@ -83,8 +178,7 @@ double NLOPTVEffPlane(const std::vector<double> &x,
   auto params = *static_cast<PointerContainerMinPlane *>(data);
   std::vector<double> vMinTilde(std::begin(x), std::end(x));
   auto vev = TransformCoordinates(vMinTilde, params);
-  return params.modelPointer->VEff(params.modelPointer->MinimizeOrderVEV(vev),
-                                   params.Temp);
+  return params.modelPointer->VEff(vev, params.Temp);
 }
 
 NLOPTReturnType
@@ -28,10 +28,10 @@
 #include <time.h>                              // for time, NULL, std::size_t
 #include <vector>                              // for vector
 
+#include <BSMPT/utility/ThreadPool.h>
+
 #include <atomic>
 #include <mutex>
-#include <queue>
-#include <thread>
 
 namespace BSMPT
 {
@@ -42,20 +42,123 @@ double GSL_VEFF_gen_all(const gsl_vector *v, void *p)
 {
 
   struct GSL_params *params = static_cast<GSL_params *>(p);
+  CountEvaluations(params->Token);
+
+  // The VEV buffer of the thread local workspace avoids an allocation per
+  // function call
+  auto &vMin = params->model.GetThreadWorkspace().VEVInput;
+  for (std::size_t i = 0; i < vMin.size(); i++)
+  {
+    vMin[i] = gsl_vector_get(v, i);
+  }
+
+  double res = params->model.VEff(vMin, params->Temp, 0);
+
+  return res;
+}
 
-  std::vector<double> vMin;
-  auto nVEVs = params->model.get_nVEV();
+void GSL_NablaVEFF_gen_all(const gsl_vector *v, void *p, gsl_vector *df)
+{
+  struct GSL_params *params = static_cast<GSL_params *>(p);
+  CountEvaluations(params->Token);
 
-  for (std::size_t i = 0; i < nVEVs; i++)
+  auto &Workspace = params->model.GetThreadWorkspace();
+  auto &vMin      = Workspace.VEVInput;
+  for (std::size_t i = 0; i < vMin.size(); i++)
   {
-    vMin.push_back(gsl_vector_get(v, i));
+    vMin[i] = gsl_vector_get(v, i);
   }
 
-  auto vIn = params->model.MinimizeOrderVEV(vMin);
+  auto &Gradient = Workspace.Gradient;
+  params->model.VEffGradient(vMin, params->Temp, Gradient, Workspace);
+  const auto &VevOrder = params->model.Get_VevOrder();
 
-  double res = params->model.VEff(vIn, params->Temp, 0);
+  for (std::size_t i = 0; i < vMin.size(); i++)
+  {
+    gsl_vector_set(df, i, Gradient.at(VevOrder.at(i)));
+  }
+}
 
-  return res;
+void GSL_VEFF_NablaVEFF_gen_all(const gsl_vector *v,
+                                void *p,
+                                double *f,
+                                gsl_vector *df)
+{
+  *f = GSL_VEFF_gen_all(v, p);
+  GSL_NablaVEFF_gen_all(v, p, df);
+}
+
+int GSL_Minimize_Gradient_From_S_gen_all(struct GSL_params &params,
+                                         std::vector<double> &sol,
+                                         const std::vector<double> &start)
+{
+  gsl_set_error_handler_off();
+
+  const gsl_multimin_fdfminimizer_type *T =
+      gsl_multimin_fdfminimizer_vector_bfgs2;
+  gsl_multimin_fdfminimizer *s = nullptr;
+  gsl_vector *x;
+  gsl_multimin_function_fdf minex_func;
+
+  double gtol = GSL_Tolerance;
+
+  std::size_t iter = 0;
+  int status;
+
+  std::size_t dim = params.model.get_nVEV();
+
+  /* Starting point */
+  x = gsl_vector_alloc(dim);
+  for (std::size_t k = 0; k < dim; k++)
+    gsl_vector_set(x, k, start.at(k));
+
+  /* Initialize method and iterate */
+  minex_func.n      = dim;
+  minex_func.f      = &GSL_VEFF_gen_all;
+  minex_func.df     = &GSL_NablaVEFF_gen_all;
+  minex_func.fdf    = &GSL_VEFF_NablaVEFF_gen_all;
+  minex_func.params = &params;
+  s                 = gsl_multimin_fdfminimizer_alloc(T, dim);
+  gsl_multimin_fdfminimizer_set(s, &minex_func, x, 1.0, 0.1);
+
+  do
+  {
+    iter++;
+    status = gsl_multimin_fdfminimizer_iterate(s);
+
+    // No further progress possible. Close to a minimum the line search
+    // resolves it to machine precision, but it also stops at kinks of the
+    // potential far from a stationary point. The point is only accepted if
+    // the gradient vanishes, otherwise the status stays a failure and the
+    // simplex algorithm takes over.
+    if (status == GSL_ENOPROG)
+    {
+      if (gsl_multimin_test_gradient(s->gradient, gtol) == GSL_SUCCESS)
+        status = GSL_SUCCESS;
+      break;
+    }
+    if (status) break;
+
+    status = gsl_multimin_test_gradient(s->gradient, gtol);
+
+  } while (status == GSL_CONTINUE && iter < params.MaxIter &&
+           not IsCancelled(params.Token));
+
+  if (status == GSL_SUCCESS)
+  {
+    for (std::size_t k = 0; k < dim; k++)
+      sol.push_back(gsl_vector_get(s->x, k));
+  }
+  else
+  {
+    for (std::size_t k = 0; k < dim; k++)
+      sol.push_back(0);
+  }
+
+  gsl_vector_free(x);
+  gsl_multimin_fdfminimizer_free(s);
+
+  return status;
 }
 
 int GSL_Minimize_From_S_gen_all(struct GSL_params &params,
@@ -70,8 +173,7 @@ int GSL_Minimize_From_S_gen_all(struct GSL_params &params,
   gsl_vector *ss, *x;
   gsl_multimin_function minex_func;
 
-  double ftol         = GSL_Tolerance;
-  std::size_t MaxIter = 600;
+  double ftol = GSL_Tolerance;
 
   std::size_t iter = 0;
   int status;
@@ -103,7 +205,8 @@ int GSL_Minimize_From_S_gen_all(struct GSL_params &params,
     size   = gsl_multimin_fminimizer_size(s);
     status = gsl_multimin_test_size(size, ftol);
 
-  } while (status == GSL_CONTINUE && iter < MaxIter);
+  } while (status == GSL_CONTINUE && iter < params.MaxIter &&
+           not IsCancelled(params.Token));
 
   if (status == GSL_SUCCESS)
   {
@@ -149,15 +252,45 @@ GSL_Minimize_gen_all(const Class_Potential_Origin &model,
   return result;
 }
 
+int GSL_Minimize_Gradient_Polished_From_S_gen_all(
+    struct GSL_params &params,
+    std::vector<double> &sol,
+    const std::vector<double> &start)
+{
+  auto status = GSL_Minimize_Gradient_From_S_gen_all(params, sol, start);
+  if (status == GSL_SUCCESS) return status;
+  // The line search fails e.g. close to kinks of the potential, where the
+  // simplex algorithm still converges
+  sol.clear();
+  return GSL_Minimize_From_S_gen_all(params, sol, start);
+}
+
+namespace
+{
+/**
+ * Multistart of the local minimisation LocalMinimizer from random starting
+ * points, see GSL_Minimize_gen_all. The starting points of Continuation are
+ * tried first.
+ */
 std::pair<std::vector<double>, bool>
-GSL_Minimize_gen_all(const Class_Potential_Origin &model,
-                     const double &Temp,
-                     const int &seed,
-                     std::vector<std::vector<double>> &saveAllMinima,
-                     const std::size_t &MaxSol,
-                     bool UseMultiThreading)
+Multistart(const Class_Potential_Origin &model,
+           const double &Temp,
+           const int &seed,
+           std::vector<std::vector<double>> &saveAllMinima,
+           const std::size_t &MaxSol,
+           bool UseMultiThreading,
+           const CancellationToken *Token,
+           const MinimumContinuation *Continuation,
+           int (*LocalMinimizer)(struct GSL_params &,
+                                 std::vector<double> &,
+                                 const std::vector<double> &))
 {
   struct GSL_params params(model, Temp);
+  params.Token = Token;
+  if (Token != nullptr and Token->GetEvaluationBudget() != nullptr)
+  {
+    params.MaxIter = Token->GetEvaluationBudget()->GetMaxIterationsPerStart();
+  }
 
   std::size_t dim = model.get_nVEV();
 
@@ -166,7 +299,12 @@ GSL_Minimize_gen_all(const Class_Potential_Origin &model,
   std::size_t MaxTries = 600; // 600;
   std::size_t nCol     = dim + 2;
 
-  std::queue<std::vector<double>> StartingPoints;
+  std::vector<std::vector<double>> StartingPoints;
+  if (Continuation != nullptr)
+  {
+    StartingPoints = Continuation->StartingPoints(Temp);
+  }
+  const std::size_t NumContinued = StartingPoints.size();
   for (std::size_t i{0}; i < MaxTries; ++i)
   {
     std::vector<double> start(dim);
@@ -179,102 +317,106 @@ GSL_Minimize_gen_all(const Class_Potential_Origin &model,
                                        std::numeric_limits<double>::digits>(
                    randGen));
     }
-    StartingPoints.push(start);
+    StartingPoints.push_back(start);
   }
 
-  struct MinimizeParams
-  {
-    std::vector<double> start;
-    std::vector<double> sol;
-    int GSL_status;
-  };
-
+  // Starting points are handed out through NextStart, every solution is
+  // stored together with the index of its starting point
+  std::atomic<std::size_t> NextStart{0};
   std::atomic<std::size_t> FoundSolutions{0};
-  std::vector<std::thread> MinThreads;
   std::mutex WriteResultLock;
-  std::queue<std::vector<double>> Results;
-
-  auto thread_Job = [](std::atomic<std::size_t> &mFoundSolutions,
-                       std::size_t mMaxSol,
-                       std::queue<std::vector<double>> &mStartingPoints,
-                       GSL_params &mparams,
-                       std::mutex &mWriteResultLock,
-                       std::queue<std::vector<double>> &mResults,
-                       bool UseLock = true)
+  std::vector<std::pair<std::size_t, std::vector<double>>> Results;
+
+  auto Job = [&](std::size_t End)
   {
-    while (mFoundSolutions < mMaxSol and not mStartingPoints.empty())
+    while (FoundSolutions < MaxSol and not IsCancelled(Token))
     {
-      std::vector<double> start;
-      {
-        std::unique_lock<std::mutex> lock;
-        if (UseLock)
-        {
-          lock = std::unique_lock<std::mutex>(mWriteResultLock);
-        }
-        start = mStartingPoints.front();
-        mStartingPoints.pop();
-      }
+      const std::size_t Index = NextStart++;
+      if (Index >= End) break;
 
       std::vector<double> sol;
-      auto status = GSL_Minimize_From_S_gen_all(mparams, sol, start);
+      auto status = LocalMinimizer(params, sol, StartingPoints.at(Index));
       if (status == GSL_SUCCESS)
       {
-        std::unique_lock<std::mutex> lock;
-        if (UseLock)
+        std::lock_guard<std::mutex> lock(WriteResultLock);
+        if (FoundSolutions < MaxSol)
         {
-          lock = std::unique_lock<std::mutex>(mWriteResultLock);
+          ++FoundSolutions;
+          Results.emplace_back(Index, sol);
         }
-        ++mFoundSolutions;
-        mResults.push(sol);
       }
     }
   };
-
-  if (UseMultiThreading)
+  // Runs the starting points up to End
+  auto RunStarts = [&](std::size_t End)
   {
-
-    for (std::size_t i = 0; i < Num_threads; ++i)
+    if (UseMultiThreading)
     {
-      MinThreads.push_back(std::thread(
-          [&]()
-          {
-            thread_Job(FoundSolutions,
-                       MaxSol,
-                       StartingPoints,
-                       params,
-                       WriteResultLock,
-                       Results);
-          }));
+      TaskGroup Tasks;
+      for (std::size_t i = 0; i < ThreadPool::Global().Size(); ++i)
+      {
+        Tasks.Run([&Job, End]() { Job(End); });
+      }
+      Tasks.Wait();
     }
+    else
+    {
+      Job(End);
+    }
+  };
 
-    for (auto &thr : MinThreads)
+  // The continued minima are minimised first, the random starting points are
+  // only needed if they are not confirmed
+  bool Confirmed = false;
+  if (NumContinued > 0)
+  {
+    RunStarts(NumContinued);
+    if (Continuation->GetSkipRandomStarts())
     {
-      if (thr.joinable()) thr.join();
+      std::vector<std::vector<double>> ContinuedMinima;
+      for (const auto &Result : Results)
+      {
+        ContinuedMinima.push_back(Result.second);
+      }
+      Confirmed = Continuation->Confirms(Temp, ContinuedMinima);
     }
+    NextStart = NumContinued;
+  }
+  if (Confirmed)
+  {
+    Logger::Write(LoggingLevel::MinimizerDetailed,
+                  "Continued minima confirmed at T = " + std::to_string(Temp) +
+                      ", skipping the random starting points");
   }
   else
   {
-    thread_Job(FoundSolutions,
-               MaxSol,
-               StartingPoints,
-               params,
-               WriteResultLock,
-               Results,
-               false);
+    RunStarts(StartingPoints.size());
   }
 
-  while (not Results.empty())
+  // independent of the order in which the workers finished
+  std::sort(Results.begin(), Results.end());
+
+  // The potential at all found minima is evaluated in a single batch
+  const std::size_t FirstResult = saveAllMinima.size();
+  Eigen::MatrixXd ResultPoints(Results.size(), dim);
+  std::vector<double> ResultVEff;
+  for (std::size_t k = 0; k < Results.size(); k++)
   {
-    auto res = Results.front();
-    Results.pop();
-    auto vpot = model.MinimizeOrderVEV(res);
+    const auto &res = Results.at(k).second;
     std::vector<double> row(nCol);
     for (std::size_t i = 0; i < dim; ++i)
-      row.at(i) = res.at(i);
-    row.at(dim)     = model.EWSBVEV(vpot);
-    row.at(dim + 1) = model.VEff(vpot, Temp, 0);
+    {
+      row.at(i)          = res.at(i);
+      ResultPoints(k, i) = res.at(i);
+    }
+    row.at(dim) = model.EWSBVEV(model.MinimizeOrderVEV(res));
     saveAllMinima.push_back(row);
   }
+  model.VEffBatch(ResultPoints, Temp, ResultVEff);
+  for (std::size_t k = 0; k < ResultVEff.size(); k++)
+  {
+    saveAllMinima.at(FirstResult + k).at(dim + 1) = ResultVEff.at(k);
+  }
 
   if (saveAllMinima.size() == 0)
   {
@@ -308,6 +450,61 @@ GSL_Minimize_gen_all(const Class_Potential_Origin &model,
     solV.push_back(saveAllMinima[minIndex][k]);
   return std::make_pair(solV, true);
 }
+} // namespace
+
+std::pair<std::vector<double>, bool>
+GSL_Minimize_gen_all(const Class_Potential_Origin &model,
+                     const double &Temp,
+                     const int &seed,
+                     std::vector<std::vector<double>> &saveAllMinima,
+                     const std::size_t &MaxSol,
+                     bool UseMultiThreading,
+                     const CancellationToken *Token,
+                     const MinimumContinuation *WarmStart)
+{
+  return Multistart(model,
+                    Temp,
+                    seed,
+                    saveAllMinima,
+                    MaxSol,
+                    UseMultiThreading,
+                    Token,
+                    WarmStart,
+                    &GSL_Minimize_From_S_gen_all);
+}
+
+std::pair<std::vector<double>, bool>
+GSL_Minimize_Gradient_gen_all(const Class_Potential_Origin &model,
+                              const double &Temp,
+                              const int &seed,
+                              const std::size_t &MaxSol,
+                              bool UseMultiThreading)
+{
+  std::vector<std::vector<double>> saveAllMinima;
+  return GSL_Minimize_Gradient_gen_all(
+      model, Temp, seed, saveAllMinima, MaxSol, UseMultiThreading);
+}
+
+std::pair<std::vector<double>, bool>
+GSL_Minimize_Gradient_gen_all(const Class_Potential_Origin &model,
+                              const double &Temp,
+                              const int &seed,
+                              std::vector<std::vector<double>> &saveAllMinima,
+                              const std::size_t &MaxSol,
+                              bool UseMultiThreading,
+                              const CancellationToken *Token,
+                              const MinimumContinuation *WarmStart)
+{
+  return Multistart(model,
+                    Temp,
+                    seed,
+                    saveAllMinima,
+                    MaxSol,
+                    UseMultiThreading,
+                    Token,
+                    WarmStart,
+                    &GSL_Minimize_Gradient_Polished_From_S_gen_all);
+}
 
 } // namespace Minimizer
 } // namespace BSMPT
@@ -164,7 +164,9 @@ MinimizePlane(const std::vector<double> &basepoint,
 
   auto dimensionnames = modelPointer->addLegendTemp();
 
-  if (UseMinimizer.UseGSL)
+  // The gradient in the plane is not available, the gradient-based
+  // minimizers fall back to their derivative-free counterparts
+  if (UseMinimizer.UseGSL or UseMinimizer.UseGSLGradient)
   {
     // Find the minimum provided by GSL
     auto GSLResult = GSL_Minimize_Plane_gen_all(params, 3, 50);
@@ -194,7 +196,7 @@ MinimizePlane(const std::vector<double> &basepoint,
 #endif
 
 #ifdef NLopt_FOUND
-  if (UseMinimizer.UseNLopt)
+  if (UseMinimizer.UseNLopt or UseMinimizer.UseNLoptGradient)
   {
     auto NLOPTResult = LibNLOPT::MinimizePlaneUsingNLOPT(params);
     PotValues.push_back(NLOPTResult.PotVal);
@@ -229,8 +231,7 @@ double GSL_VEFF_Minimize_Plane(const gsl_vector *v, void *p)
     vMinTilde.push_back(gsl_vector_get(v, i));
   }
   auto vMin  = TransformCoordinates(vMinTilde, *params);
-  auto vIn   = params->modelPointer->MinimizeOrderVEV(vMin);
-  double res = params->modelPointer->VEff(vIn, params->Temp, 0);
+  double res = params->modelPointer->VEff(vMin, params->Temp, 0);
   return res;
 }
 
@@ -8,13 +8,17 @@
 #include <BSMPT/models/ClassPotentialOrigin.h> // for Class_Potential_Origin
 #include <BSMPT/models/IncludeAllModels.h>     // for FChoose
 #include <BSMPT/utility/Logger.h>
+#include <BSMPT/utility/ThreadPool.h>
 #include <BSMPT/utility/utility.h>
 #include <algorithm> // for copy, max
-#include <iostream>  // for operator<<, cout, endl
-#include <math.h>    // for abs, log10
+#include <functional>
+#include <iostream> // for operator<<, cout, endl
+#include <map>
+#include <math.h> // for abs, log10
 #include <memory>
+#include <mutex>
 #include <random>
-#include <thread>
+#include <sstream>
 #include <time.h> // for time, NULL
 #include <vector>
 
@@ -40,6 +44,13 @@
  *
  * WhichMinimizer = 2 -> Use the local Minimization of GSL
  *
+ * WhichMinimizer = 4 -> Use the global Minimization of NLopt
+ *
+ * WhichMinimizer = 8 -> Use the local Minimization of GSL with the analytic
+ * gradient
+ *
+ * WhichMinimizer = 16 -> Use the local Minimization of NLopt with the analytic
+ * gradient
  *
  *
  *
@@ -68,199 +79,409 @@ MinimizersToUse GetMinimizers(int WhichMinimizer)
   bool UseGSL = (WhichMinimizer % 2 != 0);
   WhichMinimizer /= 2;
   bool UseNLopt = (WhichMinimizer % 2 != 0);
+  WhichMinimizer /= 2;
+  bool UseGSLGradient = (WhichMinimizer % 2 != 0);
+  WhichMinimizer /= 2;
+  bool UseNLoptGradient = (WhichMinimizer % 2 != 0);
 
 #ifndef libcmaes_FOUND
   UseCMAES = false;
 #endif
 
 #ifndef NLopt_FOUND
-  UseNLopt = false;
+  UseNLopt         = false;
+  UseNLoptGradient = false;
 #endif
 
-  return MinimizersToUse(UseCMAES, UseGSL, UseNLopt);
+  return MinimizersToUse(
+      UseCMAES, UseGSL, UseNLopt, UseGSLGradient, UseNLoptGradient);
 }
 
-std::vector<double>
-Minimize_gen_all(const std::shared_ptr<Class_Potential_Origin> &modelPointer,
-                 const double &Temp,
-                 std::vector<double> &Check,
-                 const std::vector<double> &start,
-                 const int &WhichMinimizer,
-                 bool UseMultithreading)
+namespace
 {
-  std::vector<double> PotValues;
-  std::vector<std::vector<double>> Minima;
-
-  auto UseMinimizer = GetMinimizers(WhichMinimizer);
+/**
+ * Candidate for the global minimum found by one of the minimizers
+ */
+struct Candidate
+{
+  MinimizerBackend Backend;
+  std::vector<double> Minimum;
+  double PotVal;
+};
 
-  bool CheckZero = true; // Check if zero is the global minimum explicitly
-  if (CheckZero)
+/**
+ * Checks if the candidates a and b agree within the tolerances of Settings.
+ * If Reduce is set, both minima are mapped to the representative of their
+ * orbit first, otherwise the VEVs are compared as they are.
+ */
+bool Agree(const Candidate &a,
+           const Candidate &b,
+           const MinimizerRaceSettings &Settings,
+           const SymmetryReduction &Reduce)
+{
+  if (std::abs(a.PotVal - b.PotVal) >
+      Settings.PotentialTolerance * std::max(1.0, std::abs(a.PotVal)))
+  {
+    return false;
+  }
+  auto MinA = a.Minimum;
+  auto MinB = b.Minimum;
+  if (Reduce)
   {
-    PotValues.push_back(modelPointer->VEff(
-        std::vector<double>(modelPointer->get_NHiggs(), 0), Temp));
-    Minima.push_back(std::vector<double>(modelPointer->get_nVEV(), 0));
+    Reduce(MinA);
+    Reduce(MinB);
   }
+  for (std::size_t i = 0; i < MinA.size(); i++)
+  {
+    if (std::abs(MinA.at(i) - MinB.at(i)) > Settings.VEVTolerance)
+    {
+      return false;
+    }
+  }
+  return true;
+}
 
+/**
+ * Returns the minimizers selected by WhichMinimizer, adjusted to the model
+ */
+MinimizersToUse
+SelectMinimizers(const std::shared_ptr<Class_Potential_Origin> &modelPointer,
+                 int WhichMinimizer)
+{
+  auto UseMinimizer = GetMinimizers(WhichMinimizer);
   if (modelPointer->get_nVEV() <= 2)
   {
     UseMinimizer.UseCMAES = false;
     UseMinimizer.UseGSL   = true;
   }
+  return UseMinimizer;
+}
 
-  std::vector<double> solGSLMin, solGSLMinPot;
+/**
+ * Candidate at the origin, which is always checked explicitly
+ */
+Candidate
+OriginCandidate(const std::shared_ptr<Class_Potential_Origin> &modelPointer,
+                const double &Temp)
+{
+  return Candidate{
+      MinimizerBackend::Origin,
+      std::vector<double>(modelPointer->get_nVEV(), 0),
+      modelPointer->VEff(std::vector<double>(modelPointer->get_NHiggs(), 0),
+                         Temp)};
+}
 
-  bool gslMinSuc = false;
-  std::thread thread_GSL;
-  if (UseMinimizer.UseGSL)
+/**
+ * Runs the minimizers selected in UseMinimizer as tasks of the shared thread
+ * pool, which also executes the multistart of GSL. The candidates are
+ * returned in a fixed order independent of the order in which the minimizers
+ * finished. If WarmStart is given, its minima are used as starting points of
+ * GSL and all minima found at Temp are added to it afterwards. If Race is
+ * given, Token is cancelled as soon as the candidates of two minimizers agree
+ * after both were mapped with Reduce and Agreement is set. If LocalMinima is
+ * given, all local minima found by GSL and the candidates of the other
+ * minimizers are stored in it.
+ */
+std::vector<Candidate>
+RunMinimizers(const std::shared_ptr<Class_Potential_Origin> &modelPointer,
+              const double &Temp,
+              const std::vector<double> &start,
+              const MinimizersToUse &UseMinimizer,
+              bool UseMultithreading,
+              std::vector<double> &Check,
+              MinimumContinuation *WarmStart                = nullptr,
+              CancellationToken *Token                      = nullptr,
+              const MinimizerRaceSettings *Race             = nullptr,
+              bool *Agreement                               = nullptr,
+              std::vector<std::vector<double>> *LocalMinima = nullptr,
+              const SymmetryReduction &Reduce               = nullptr)
+{
+  std::map<MinimizerBackend, Candidate> Found;
+  std::mutex FoundLock;
+  bool Agreed = false;
+  auto Report = [&](const Candidate &Result)
   {
-
-    if (UseMinimizer.UseCMAES or UseMinimizer.UseNLopt)
-    {
-      if (UseMultithreading)
-      {
-        thread_GSL = std::thread(
-            [&solGSLMin, &gslMinSuc, &modelPointer, &Temp]()
-            {
-              std::tie(solGSLMin, gslMinSuc) = GSL_Minimize_gen_all(
-                  *modelPointer,
-                  Temp,
-                  5); // If additionally CMAES is minimising
-                      // GSL does not need as much solutions
-            });
-      }
-      else
-      {
-        std::tie(solGSLMin, gslMinSuc) =
-            GSL_Minimize_gen_all(*modelPointer, Temp, 5, UseMultithreading);
-      }
-    }
-    else
+    std::lock_guard<std::mutex> lock(FoundLock);
+    if (Race != nullptr and not Agreed)
     {
-      std::size_t MaxSol = 50;
-      if (UseMultithreading)
+      for (const auto &Entry : Found)
       {
-        thread_GSL = std::thread(
-            [&solGSLMin, &gslMinSuc, &modelPointer, &Temp, &MaxSol]()
-            {
-              std::tie(solGSLMin, gslMinSuc) =
-                  GSL_Minimize_gen_all(*modelPointer, Temp, 5, MaxSol);
-            });
-      }
-      else
-      {
-        std::tie(solGSLMin, gslMinSuc) = GSL_Minimize_gen_all(
-            *modelPointer, Temp, 5, MaxSol, UseMultithreading);
+        if (Agree(Result, Entry.second, *Race, Reduce))
+        {
+          Agreed = true;
+          Token->Cancel();
+          std::stringstream ss;
+          ss << MinimizerBackendToString.at(Result.Backend) << " and "
+             << MinimizerBackendToString.at(Entry.second.Backend)
+             << " agree at T = " << Temp
+             << ", cancelling the remaining minimizers" << std::endl;
+          Logger::Write(LoggingLevel::MinimizerDetailed, ss.str());
+          break;
+        }
       }
     }
-  }
-#ifdef libcmaes_FOUND
-  std::thread thread_CMAES;
-  LibCMAES::LibCMAESReturn LibCMAES;
-  if (UseMinimizer.UseCMAES)
+    Found.emplace(Result.Backend, Result);
+  };
+  auto PotentialAt = [&](const std::vector<double> &Minimum)
+  { return modelPointer->VEff(modelPointer->MinimizeOrderVEV(Minimum), Temp); };
+
+  TaskGroup Minimizers;
+  auto Launch = [&](std::function<void()> Job)
   {
+    if (IsCancelled(Token)) return;
     if (UseMultithreading)
     {
-      thread_CMAES = std::thread(
-          [&modelPointer, &Temp, &start, &LibCMAES]() {
-            LibCMAES = LibCMAES::min_cmaes_gen_all(*modelPointer, Temp, start);
-          });
+      Minimizers.Run(std::move(Job));
     }
     else
     {
-      LibCMAES = LibCMAES::min_cmaes_gen_all(*modelPointer, Temp, start);
+      Job();
     }
+  };
+
+  // If additionally CMAES or NLopt are minimising GSL does not need as many
+  // solutions
+  bool OnlyGSL = not(UseMinimizer.UseCMAES or UseMinimizer.UseNLopt or
+                     UseMinimizer.UseNLoptGradient);
+  std::size_t MaxSolGSL = OnlyGSL ? 50 : 20;
+  std::vector<std::vector<double>> GSLMinima, GSLGradientMinima;
+  if (UseMinimizer.UseGSL)
+  {
+    Launch(
+        [&]()
+        {
+          auto Result = GSL_Minimize_gen_all(*modelPointer,
+                                             Temp,
+                                             5,
+                                             GSLMinima,
+                                             MaxSolGSL,
+                                             UseMultithreading,
+                                             Token,
+                                             WarmStart);
+          if (Result.second)
+          {
+            Report({MinimizerBackend::GSL,
+                    Result.first,
+                    PotentialAt(Result.first)});
+          }
+        });
+  }
+  if (UseMinimizer.UseGSLGradient)
+  {
+    Launch(
+        [&]()
+        {
+          auto Result = GSL_Minimize_Gradient_gen_all(*modelPointer,
+                                                      Temp,
+                                                      5,
+                                                      GSLGradientMinima,
+                                                      MaxSolGSL,
+                                                      UseMultithreading,
+                                                      Token,
+                                                      WarmStart);
+          if (Result.second)
+          {
+            Report({MinimizerBackend::GSLGradient,
+                    Result.first,
+                    PotentialAt(Result.first)});
+          }
+        });
   }
-#else
-  (void)start;
-#endif
 
-#ifdef NLopt_FOUND
-  LibNLOPT::NLOPTReturnType NLOPTResult;
-  std::thread thread_NLopt;
-  if (UseMinimizer.UseNLopt)
+#ifdef libcmaes_FOUND
+  int CMAESStatus = 0;
+  if (UseMinimizer.UseCMAES)
   {
-    if (UseMultithreading)
-    {
-      thread_NLopt = std::thread(
-          [&NLOPTResult, &modelPointer, &Temp]()
-          { NLOPTResult = LibNLOPT::MinimizeUsingNLOPT(*modelPointer, Temp); });
-    }
-    else
-    {
-      NLOPTResult = LibNLOPT::MinimizeUsingNLOPT(*modelPointer, Temp);
-    }
+    Launch(
+        [&]()
+        {
+          auto Result =
+              LibCMAES::min_cmaes_gen_all(*modelPointer, Temp, start, Token);
+          if (Result.Cancelled) return;
+          CMAESStatus = Result.CMAESStatus;
+          Report({MinimizerBackend::CMAES,
+                  Result.result,
+                  PotentialAt(Result.result)});
+        });
   }
+#else
+  (void)start;
+  (void)Check;
 #endif
 
 #ifdef NLopt_FOUND
-  if (UseMultithreading and thread_NLopt.joinable())
+  if (UseMinimizer.UseNLopt)
   {
-    Logger::Write(LoggingLevel::MinimizerDetailed, "Waiting for NLopt thread");
-    thread_NLopt.join();
+    Launch(
+        [&]()
+        {
+          auto Result =
+              LibNLOPT::MinimizeUsingNLOPT(*modelPointer, Temp, Token);
+          if (Result.Success)
+          {
+            Report({MinimizerBackend::NLopt, Result.Minimum, Result.PotVal});
+          }
+        });
   }
-
-  if (NLOPTResult.Success)
+  if (UseMinimizer.UseNLoptGradient)
   {
-    PotValues.push_back(NLOPTResult.PotVal);
-    Minima.push_back(NLOPTResult.Minimum);
-    std::stringstream ss;
-    ss << "NLopt candidate at T = " << Temp << " :  " << NLOPTResult.Minimum
-       << " with potential value " << NLOPTResult.PotVal << std::endl;
-    Logger::Write(LoggingLevel::MinimizerDetailed, ss.str());
+    Launch(
+        [&]()
+        {
+          auto Result = LibNLOPT::MinimizeUsingNLOPTGradient(
+              *modelPointer, Temp, nlopt::LD_LBFGS, Token);
+          if (Result.Success)
+          {
+            Report({MinimizerBackend::NLoptGradient,
+                    Result.Minimum,
+                    Result.PotVal});
+          }
+        });
   }
 #endif
 
+  Logger::Write(LoggingLevel::MinimizerDetailed, "Waiting for the minimizers");
+  Minimizers.Wait();
+
 #ifdef libcmaes_FOUND
-  if (UseMultithreading and thread_CMAES.joinable())
+  if (Found.count(MinimizerBackend::CMAES) != 0) Check.push_back(CMAESStatus);
+#endif
+  if (Agreement != nullptr) *Agreement = Agreed;
+
+  // ties between the candidates are resolved in favour of the first one
+  const std::vector<MinimizerBackend> Order{MinimizerBackend::NLopt,
+                                            MinimizerBackend::NLoptGradient,
+                                            MinimizerBackend::CMAES,
+                                            MinimizerBackend::GSL,
+                                            MinimizerBackend::GSLGradient};
+  std::vector<Candidate> Candidates;
+  for (const auto &Backend : Order)
   {
-    Logger::Write(LoggingLevel::MinimizerDetailed, "Waiting for CMAES Thread");
-    thread_CMAES.join();
-    auto errC          = LibCMAES.CMAESStatus;
-    auto solCMAES      = LibCMAES.result;
-    auto solCMAESPotIn = modelPointer->MinimizeOrderVEV(solCMAES);
-    PotValues.push_back(modelPointer->VEff(solCMAESPotIn, Temp));
-    Minima.push_back(solCMAES);
-    Check.push_back(errC);
+    auto Entry = Found.find(Backend);
+    if (Entry == Found.end()) continue;
+    Candidates.push_back(Entry->second);
 
     std::stringstream ss;
-    ss << "CMAES candidate at T = " << Temp << " : " << solCMAES
-       << " with potential value = " << PotValues.at(PotValues.size() - 1)
-       << std::endl;
+    ss << MinimizerBackendToString.at(Backend) << " candidate at T = " << Temp
+       << " : " << Entry->second.Minimum << " with potential value "
+       << Entry->second.PotVal << std::endl;
     Logger::Write(LoggingLevel::MinimizerDetailed, ss.str());
   }
-#endif
 
-  if (UseMultithreading and thread_GSL.joinable())
+  if (WarmStart != nullptr or LocalMinima != nullptr)
   {
-    Logger::Write(LoggingLevel::MinimizerDetailed, "Waiting for GSL thread");
-    thread_GSL.join();
+    // the rows of saveAllMinima contain the VEVs followed by the EW VEV and
+    // the potential value
+    std::vector<std::vector<double>> Minima;
+    for (const auto &Row : GSLMinima)
+    {
+      Minima.emplace_back(Row.begin(), Row.end() - 2);
+    }
+    for (const auto &Row : GSLGradientMinima)
+    {
+      Minima.emplace_back(Row.begin(), Row.end() - 2);
+    }
+    for (const auto &Entry : Candidates)
+    {
+      Minima.push_back(Entry.Minimum);
+    }
+    if (WarmStart != nullptr) WarmStart->Insert(Temp, Minima);
+    if (LocalMinima != nullptr) *LocalMinima = std::move(Minima);
   }
+  return Candidates;
+}
 
-  if (gslMinSuc)
+/**
+ * Returns the index of the candidate with the lowest potential value
+ */
+std::size_t BestCandidate(const std::vector<Candidate> &Candidates)
+{
+  std::size_t minIndex = 0;
+  for (std::size_t i = 1; i < Candidates.size(); i++)
   {
-    solGSLMinPot = modelPointer->MinimizeOrderVEV(solGSLMin);
-    PotValues.push_back(modelPointer->VEff(solGSLMinPot, Temp));
-    Minima.push_back(solGSLMin);
+    if (Candidates.at(i).PotVal < Candidates.at(minIndex).PotVal) minIndex = i;
+  }
+  return minIndex;
+}
+} // namespace
 
+std::vector<double>
+Minimize_gen_all(const std::shared_ptr<Class_Potential_Origin> &modelPointer,
+                 const double &Temp,
+                 std::vector<double> &Check,
+                 const std::vector<double> &start,
+                 const int &WhichMinimizer,
+                 bool UseMultithreading,
+                 bool UseGradientRefinement,
+                 MinimumContinuation *WarmStart,
+                 EvaluationBudget *Budget)
+{
+  const auto UseMinimizer = SelectMinimizers(modelPointer, WhichMinimizer);
+  CancellationToken Token(Budget);
+
+  std::vector<Candidate> Candidates{OriginCandidate(modelPointer, Temp)};
+  for (const auto &Result : RunMinimizers(modelPointer,
+                                          Temp,
+                                          start,
+                                          UseMinimizer,
+                                          UseMultithreading,
+                                          Check,
+                                          WarmStart,
+                                          &Token))
+  {
+    Candidates.push_back(Result);
+  }
+  if (Token.BudgetExhausted())
+  {
     std::stringstream ss;
-    ss << "GSL found a minimum at T = " << Temp << ": (" << solGSLMin
-       << ") with Potential value = " << PotValues.at(PotValues.size() - 1)
-       << std::endl;
+    ss << "Evaluation budget used up at T = " << Temp << " after "
+       << Budget->Evaluations() << " evaluations" << std::endl;
     Logger::Write(LoggingLevel::MinimizerDetailed, ss.str());
   }
 
-  std::size_t minIndex = 0;
-  for (std::size_t i = 1; i < PotValues.size(); i++)
+  const auto &Best = Candidates.at(BestCandidate(Candidates));
+  auto sol         = Best.Minimum;
+  {
+    std::stringstream ss;
+    ss << "Global minimum candidate at T = " << Temp << " found by "
+       << MinimizerBackendToString.at(Best.Backend) << std::endl;
+    Logger::Write(LoggingLevel::MinimizerDetailed, ss.str());
+  }
+
+  if (UseGradientRefinement and not Token.BudgetExhausted())
   {
-    if (PotValues.at(i) < PotValues.at(minIndex)) minIndex = i;
+    struct GSL_params params(*modelPointer, Temp);
+    params.Token = &Token;
+    std::vector<double> solRefined;
+    auto status = GSL_Minimize_Gradient_From_S_gen_all(params, solRefined, sol);
+    if (status == GSL_SUCCESS)
+    {
+      double PotRefined =
+          modelPointer->VEff(modelPointer->MinimizeOrderVEV(solRefined), Temp);
+      if (PotRefined <= Best.PotVal)
+      {
+        std::stringstream ss;
+        ss << "Gradient refinement at T = " << Temp << " moved the candidate "
+           << sol << " to " << solRefined << " with potential value "
+           << PotRefined << std::endl;
+        Logger::Write(LoggingLevel::MinimizerDetailed, ss.str());
+        sol = solRefined;
+      }
+    }
   }
 
-  auto sol   = Minima.at(minIndex);
   auto EWVEV = modelPointer->EWSBVEV(modelPointer->MinimizeOrderVEV(sol));
   if (EWVEV <= 0.5) modelPointer->SetEWVEVZero(sol);
 
-  solGSLMin.clear();
-  if (UseMinimizer.UseGSL and gslMinSuc)
+  bool GSLFound = std::any_of(
+      Candidates.begin(),
+      Candidates.end(),
+      [](const Candidate &Entry)
+      {
+        return Entry.Backend == MinimizerBackend::GSL or
+               Entry.Backend == MinimizerBackend::GSLGradient;
+      });
+  if (GSLFound)
     Check.push_back(1);
   else
     Check.push_back(-1);
@@ -268,15 +489,129 @@ Minimize_gen_all(const std::shared_ptr<Class_Potential_Origin> &modelPointer,
   return sol;
 }
 
+MinimizerRaceResult Minimize_gen_all_race(
+    const std::shared_ptr<Class_Potential_Origin> &modelPointer,
+    const double &Temp,
+    const std::vector<double> &start,
+    const int &WhichMinimizer,
+    const MinimizerRaceSettings &Settings,
+    bool UseMultithreading,
+    const SymmetryReduction &Reduce)
+{
+  const auto UseMinimizer = SelectMinimizers(modelPointer, WhichMinimizer);
+  CancellationToken Token(Settings.Budget);
+
+  MinimizerRaceResult res;
+  std::vector<double> Check;
+  std::vector<Candidate> Candidates{OriginCandidate(modelPointer, Temp)};
+  for (const auto &Result : RunMinimizers(modelPointer,
+                                          Temp,
+                                          start,
+                                          UseMinimizer,
+                                          UseMultithreading,
+                                          Check,
+                                          nullptr,
+                                          &Token,
+                                          &Settings,
+                                          &res.Agreement,
+                                          nullptr,
+                                          Reduce))
+  {
+    Candidates.push_back(Result);
+  }
+  res.BudgetExhausted = not res.Agreement and Token.BudgetExhausted();
+
+  const auto &Best = Candidates.at(BestCandidate(Candidates));
+  res.Minimum      = Best.Minimum;
+  res.PotVal       = Best.PotVal;
+  res.Winner       = Best.Backend;
+
+  auto EWVEV =
+      modelPointer->EWSBVEV(modelPointer->MinimizeOrderVEV(res.Minimum));
+  if (EWVEV <= 0.5) modelPointer->SetEWVEVZero(res.Minimum);
+
+  std::stringstream ss;
+  ss << "Minimizer race at T = " << Temp << " won by "
+     << MinimizerBackendToString.at(res.Winner);
+  if (res.Agreement) ss << " after two minimizers agreed";
+  if (res.BudgetExhausted) ss << " after the time budget was used up";
+  ss << std::endl;
+  Logger::Write(LoggingLevel::MinimizerDetailed, ss.str());
+
+  return res;
+}
+
+std::vector<DistinctMinimum> Minimize_gen_all_distinct(
+    const std::shared_ptr<Class_Potential_Origin> &modelPointer,
+    const double &Temp,
+    const std::vector<double> &start,
+    const int &WhichMinimizer,
+    const SymmetryReduction &Reduce,
+    const double &Tolerance,
+    bool UseMultithreading)
+{
+  const auto UseMinimizer = SelectMinimizers(modelPointer, WhichMinimizer);
+
+  std::vector<double> Check;
+  std::vector<std::vector<double>> LocalMinima;
+  RunMinimizers(modelPointer,
+                Temp,
+                start,
+                UseMinimizer,
+                UseMultithreading,
+                Check,
+                nullptr,
+                nullptr,
+                nullptr,
+                nullptr,
+                &LocalMinima);
+  if (Reduce)
+  {
+    for (auto &Point : LocalMinima)
+    {
+      Reduce(Point);
+    }
+  }
+
+  // The potential at all minima is evaluated in a single batch
+  const std::size_t dim = modelPointer->get_nVEV();
+  Eigen::MatrixXd Points(LocalMinima.size(), dim);
+  for (std::size_t k = 0; k < LocalMinima.size(); k++)
+  {
+    for (std::size_t i = 0; i < dim; i++)
+    {
+      Points(k, i) = LocalMinima.at(k).at(i);
+    }
+  }
+  std::vector<double> PotVals;
+  modelPointer->VEffBatch(Points, Temp, PotVals, UseMultithreading);
+
+  DistinctMinima Distinct(Tolerance);
+  for (std::size_t k = 0; k < LocalMinima.size(); k++)
+  {
+    Distinct.Insert(LocalMinima.at(k), PotVals.at(k));
+  }
+
+  std::stringstream ss;
+  ss << "Found " << Distinct.size() << " distinct minima among "
+     << LocalMinima.size() << " local minima at T = " << Temp << std::endl;
+  Logger::Write(LoggingLevel::MinimizerDetailed, ss.str());
+
+  return Distinct.SortedByPotential();
+}
+
 EWPTReturnType
 PTFinder_gen_all(const std::shared_ptr<Class_Potential_Origin> &modelPointer,
                  const double &TempStart,
                  const double &TempEnd,
                  const int &WhichMinimizer,
-                 bool UseMultithreading)
+                 bool UseMultithreading,
+                 bool SkipRandomStarts,
+                 EvaluationBudget *Budget)
 {
 
   EWPTReturnType result;
+  MinimumContinuation WarmStart(SkipRandomStarts);
 
   std::size_t dim = modelPointer->get_nVEV();
 
@@ -299,10 +634,22 @@ PTFinder_gen_all(const std::shared_ptr<Class_Potential_Origin> &modelPointer,
                             checkEnde,
                             startEnde,
                             WhichMinimizer,
-                            UseMultithreading);
+                            UseMultithreading,
+                            false,
+                            &WarmStart,
+                            Budget);
   solEndPot = modelPointer->MinimizeOrderVEV(solEnd);
   vEnd      = modelPointer->EWSBVEV(solEndPot);
 
+  if (BudgetExhausted(Budget))
+  {
+    result.Tc         = TempEnd;
+    result.vc         = vEnd;
+    result.StatusFlag = MinimizerStatus::BUDGETEXHAUSTED;
+    result.EWMinimum  = solEnd;
+    return result;
+  }
+
   if (vEnd > C_threshold)
   {
     result.Tc         = TempEnd;
@@ -319,10 +666,22 @@ PTFinder_gen_all(const std::shared_ptr<Class_Potential_Origin> &modelPointer,
                               checkStart,
                               startStart,
                               WhichMinimizer,
-                              UseMultithreading);
+                              UseMultithreading,
+                              false,
+                              &WarmStart,
+                              Budget);
   solStartPot = modelPointer->MinimizeOrderVEV(solStart);
   vStart      = modelPointer->EWSBVEV(solStartPot);
 
+  if (BudgetExhausted(Budget))
+  {
+    result.Tc         = TempStart;
+    result.vc         = vStart;
+    result.StatusFlag = MinimizerStatus::BUDGETEXHAUSTED;
+    result.EWMinimum  = solStart;
+    return result;
+  }
+
   if (vStart <= C_threshold or vStart >= 255.0)
   {
     result.Tc         = TempEnd;
@@ -356,10 +715,22 @@ PTFinder_gen_all(const std::shared_ptr<Class_Potential_Origin> &modelPointer,
                                 checkMitte,
                                 startMitte,
                                 WhichMinimizer,
-                                UseMultithreading);
+                                UseMultithreading,
+                                false,
+                                &WarmStart,
+                                Budget);
     solMittePot = modelPointer->MinimizeOrderVEV(solMitte);
     vMitte      = modelPointer->EWSBVEV(solMittePot);
 
+    if (BudgetExhausted(Budget))
+    {
+      result.Tc         = TM;
+      result.vc         = vMitte;
+      result.StatusFlag = MinimizerStatus::BUDGETEXHAUSTED;
+      result.EWMinimum  = solMitte;
+      return result;
+    }
+
     if (vMitte >= 255.0)
     {
       result.Tc         = TM;
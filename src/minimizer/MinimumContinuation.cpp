@@ -0,0 +1,164 @@
+// SPDX-FileCopyrightText: 2021 Philipp Basler, Margarete Mühlleitner and Jonas
+// Müller
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file
+ */
+
+#include <BSMPT/minimizer/MinimumContinuation.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace BSMPT
+{
+namespace Minimizer
+{
+
+namespace
+{
+/**
+ * Largest absolute difference of the entries of a and b
+ */
+double MaxDistance(const std::vector<double> &a, const std::vector<double> &b)
+{
+  double res = 0;
+  for (std::size_t i = 0; i < a.size(); i++)
+  {
+    res = std::max(res, std::abs(a.at(i) - b.at(i)));
+  }
+  return res;
+}
+} // namespace
+
+MinimumContinuation::MinimumContinuation(bool SkipRandomStarts,
+                                         bool Extrapolate,
+                                         double ConfirmationTolerance,
+                                         double DistinctTolerance)
+    : SkipRandomStarts{SkipRandomStarts}
+    , Extrapolate{Extrapolate}
+    , ConfirmationTolerance{ConfirmationTolerance}
+    , DistinctTolerance{DistinctTolerance}
+{
+}
+
+void MinimumContinuation::AddDistinct(std::vector<std::vector<double>> &Points,
+                                      const std::vector<double> &Point) const
+{
+  for (const auto &Known : Points)
+  {
+    if (MaxDistance(Known, Point) <= DistinctTolerance) return;
+  }
+  Points.push_back(Point);
+}
+
+void MinimumContinuation::Insert(
+    const double &Temp,
+    const std::vector<std::vector<double>> &Minima)
+{
+  if (Minima.empty()) return;
+  auto &Known = Cache[Temp];
+  for (const auto &Minimum : Minima)
+  {
+    AddDistinct(Known, Minimum);
+  }
+}
+
+std::pair<MinimumContinuation::MinimaAtTemperature::const_iterator,
+          MinimumContinuation::MinimaAtTemperature::const_iterator>
+MinimumContinuation::Neighbours(const double &Temp) const
+{
+  // the two closest temperatures are among the two below and the two above
+  std::vector<MinimaAtTemperature::const_iterator> Close;
+  auto Above = Cache.lower_bound(Temp);
+  auto Below = Above;
+  for (std::size_t i = 0; i < 2 and Above != Cache.end(); i++, Above++)
+  {
+    Close.push_back(Above);
+  }
+  for (std::size_t i = 0; i < 2 and Below != Cache.begin(); i++)
+  {
+    Close.push_back(--Below);
+  }
+  std::sort(Close.begin(),
+            Close.end(),
+            [&Temp](const auto &a, const auto &b)
+            { return std::abs(a->first - Temp) < std::abs(b->first - Temp); });
+
+  auto Closest = Close.size() > 0 ? Close.at(0) : Cache.end();
+  auto Second  = Close.size() > 1 ? Close.at(1) : Cache.end();
+  return std::make_pair(Closest, Second);
+}
+
+std::vector<std::vector<double>>
+MinimumContinuation::Predictions(const double &Temp) const
+{
+  std::vector<std::vector<double>> res;
+  auto [Closest, Second] = Neighbours(Temp);
+  if (Closest == Cache.end()) return res;
+
+  for (const auto &Minimum : Closest->second)
+  {
+    if (not Extrapolate or Second == Cache.end())
+    {
+      AddDistinct(res, Minimum);
+      continue;
+    }
+    // the same phase at the second temperature is the closest minimum there
+    const std::vector<double> *Partner = &Second->second.front();
+    for (const auto &Candidate : Second->second)
+    {
+      if (MaxDistance(Candidate, Minimum) < MaxDistance(*Partner, Minimum))
+      {
+        Partner = &Candidate;
+      }
+    }
+    double Slope = (Temp - Closest->first) / (Second->first - Closest->first);
+    std::vector<double> Prediction(Minimum);
+    for (std::size_t i = 0; i < Prediction.size(); i++)
+    {
+      Prediction.at(i) += Slope * (Partner->at(i) - Minimum.at(i));
+    }
+    AddDistinct(res, Prediction);
+  }
+  return res;
+}
+
+std::vector<std::vector<double>>
+MinimumContinuation::StartingPoints(const double &Temp) const
+{
+  auto res               = Predictions(Temp);
+  auto [Closest, Second] = Neighbours(Temp);
+  for (const auto &Neighbour : {Closest, Second})
+  {
+    if (Neighbour == Cache.end()) continue;
+    for (const auto &Minimum : Neighbour->second)
+    {
+      AddDistinct(res, Minimum);
+    }
+  }
+  return res;
+}
+
+bool MinimumContinuation::Confirms(
+    const double &Temp,
+    const std::vector<std::vector<double>> &Minima) const
+{
+  auto Continued = Predictions(Temp);
+  if (Continued.empty()) return false;
+  for (const auto &Prediction : Continued)
+  {
+    bool Confirmed = std::any_of(
+        Minima.begin(),
+        Minima.end(),
+        [&](const std::vector<double> &Minimum)
+        { return MaxDistance(Prediction, Minimum) <= ConfirmationTolerance; });
+    if (not Confirmed) return false;
+  }
+  return true;
+}
+
+} // namespace Minimizer
+} // namespace BSMPT
@@ -9,6 +9,10 @@
 
 #include <BSMPT/minimum_tracer/minimum_tracer.h>
 #include <BSMPT/utility/NumericalDerivatives.h>
+#include <BSMPT/utility/ThreadPool.h>
+
+#include <limits>
+#include <map>
 
 using namespace Eigen;
 
@@ -121,6 +125,69 @@ std::vector<double> MinimumTracer::LocateMinimum(
   return (new_guess);
 }
 
+std::function<std::vector<std::vector<double>>(std::vector<double>)>
+MinimumTracer::GetHessian(const double &T,
+                          const double &eps,
+                          const bool &Normalised)
+{
+  const double Normalisation = Normalised ? 1 + T * T : 1;
+  if (not UseAnalyticHessian or C_UseParwani)
+  {
+    std::function<double(std::vector<double>)> V =
+        [this, T, Normalisation](std::vector<double> vev)
+    {
+      // Potential wrapper
+      if (Budget) Budget->Consume();
+      return this->modelPointer->VEff(vev, T) / Normalisation;
+    };
+    return GetHessian(V, eps);
+  }
+
+  return [this, T, Normalisation](auto const &arg)
+  {
+    // Booked as the 1 + 2 dim^2 evaluations of the finite-difference stencil
+    // it replaces, so the budget does not depend on UseAnalyticHessian
+    if (Budget) Budget->Consume(1 + 2 * arg.size() * arg.size());
+    const auto &VevOrder   = this->modelPointer->Get_VevOrder();
+    const auto FullHessian = this->modelPointer->VEffHessian(
+        this->modelPointer->MinimizeOrderVEV(arg), T);
+    std::vector<std::vector<double>> result(arg.size(),
+                                            std::vector<double>(arg.size()));
+    for (std::size_t i = 0; i < arg.size(); i++)
+    {
+      for (std::size_t j = 0; j < arg.size(); j++)
+      {
+        result[i][j] = FullHessian[VevOrder[i]][VevOrder[j]] / Normalisation;
+      }
+    }
+    return result;
+  };
+}
+
+std::function<std::vector<std::vector<double>>(std::vector<double>)>
+MinimumTracer::GetHessian(const std::function<double(std::vector<double>)> &V,
+                          const double &eps)
+{
+  return [=](auto const &arg) { return HessianNumerical(arg, V, eps); };
+}
+
+BatchFunction MinimumTracer::GetPotentialBatch(const double &T,
+                                               const bool &Normalised)
+{
+  return [this, &T, Normalised](const Eigen::MatrixXd &Points)
+  {
+    if (Budget) Budget->Consume(Points.rows());
+    std::vector<double> res;
+    this->modelPointer->VEffBatch(Points, T, res, UseMultithreading);
+    if (Normalised)
+    {
+      for (auto &V : res)
+        V /= 1 + T * T;
+    }
+    return res;
+  };
+}
+
 double MinimumTracer::SmallestEigenvalue(
     const std::vector<double> &point,
     const std::function<std::vector<std::vector<double>>(std::vector<double>)>
@@ -154,30 +221,19 @@ MinimumTracer::FindZeroSmallestEigenvalue(std::vector<double> point_1,
   double ev_1, ev_2, ev_m, T_m; // Eigenvalues of phases and middle temperature
   int dim = this->modelPointer->get_nVEV();
   std::vector<double> point_m;
-  std::function<double(std::vector<double>)> V_1, V_2, V_m;
   std::function<std::vector<double>(std::vector<double>)> dV_1, dV_2, dV_m;
   std::function<std::vector<std::vector<double>>(std::vector<double>)>
       Hessian_1, Hessian_2, Hessian_m;
 
   // Define potential 1
-  V_1 = [&](std::vector<double> vev)
-  {
-    // Potential wrapper
-    std::vector<double> res = this->modelPointer->MinimizeOrderVEV(vev);
-    return this->modelPointer->VEff(res, T_1) / (1 + T_1 * T_1);
-  };
-  dV_1      = [&](auto const &arg) { return NablaNumerical(arg, V_1, eps); };
-  Hessian_1 = [&](auto const &arg) { return HessianNumerical(arg, V_1, eps); };
+  dV_1      = [=, VBatch = GetPotentialBatch(T_1)](auto const &arg)
+  { return NablaNumerical(arg, VBatch, eps); };
+  Hessian_1 = GetHessian(T_1, eps);
 
   // Define potential 2
-  V_2 = [&](std::vector<double> vev)
-  {
-    // Potential wrapper
-    std::vector<double> res = this->modelPointer->MinimizeOrderVEV(vev);
-    return this->modelPointer->VEff(res, T_2) / (1 + T_2 * T_2);
-  };
-  dV_2      = [=](auto const &arg) { return NablaNumerical(arg, V_2, eps); };
-  Hessian_2 = [=](auto const &arg) { return HessianNumerical(arg, V_2, eps); };
+  dV_2      = [=, VBatch = GetPotentialBatch(T_2)](auto const &arg)
+  { return NablaNumerical(arg, VBatch, eps); };
+  Hessian_2 = GetHessian(T_2, eps);
 
   // Initial guess for middle point
   point_m = point_1;
@@ -207,15 +263,9 @@ MinimumTracer::FindZeroSmallestEigenvalue(std::vector<double> point_1,
   {
     T_m = (T_1 + T_2) / 2.;
     // Define potential in the middle
-    V_m = [&](std::vector<double> vev)
-    {
-      // Potential wrapper
-      std::vector<double> res = this->modelPointer->MinimizeOrderVEV(vev);
-      return this->modelPointer->VEff(res, T_m) / (1 + T_m * T_m);
-    };
-    dV_m      = [=](auto const &arg) { return NablaNumerical(arg, V_m, eps); };
-    Hessian_m = [=](auto const &arg)
-    { return HessianNumerical(arg, V_m, eps); };
+    dV_m      = [=, VBatch = GetPotentialBatch(T_m)](auto const &arg)
+    { return NablaNumerical(arg, VBatch, eps); };
+    Hessian_m = GetHessian(T_m, eps);
     point_m =
         LocateMinimum(point_m, dV_m, Hessian_m, 1e-3 * dim / (1 + T_m * T_m));
     ev_m = SmallestEigenvalue(point_m, Hessian_m);
@@ -251,6 +301,105 @@ MinimumTracer::FindZeroSmallestEigenvalue(std::vector<double> point_1,
   return CandidatePoint;
 }
 
+std::vector<double>
+MinimumTracer::PhaseTangent(const std::vector<double> &point, const double &T)
+{
+  double eps = 0.1;
+  int dim    = point.size();
+  // Central difference of the gradient in the temperature, shifted to stay at
+  // non-negative temperatures. Every point of the stencil is evaluated at both
+  // temperatures at once, so the temperature independent parts of the
+  // potential are only calculated once per point.
+  double T_1 = std::max(T - 0.5, 0.);
+  double T_2 = T_1 + 1;
+  BatchFunction DeltaV = [this, T_1, T_2](const Eigen::MatrixXd &Points)
+  {
+    if (Budget) Budget->Consume(2 * Points.rows());
+    std::vector<double> res(Points.rows()), v(Points.cols()), Potentials;
+    for (Eigen::Index row = 0; row < Points.rows(); row++)
+    {
+      for (Eigen::Index col = 0; col < Points.cols(); col++)
+      {
+        v[col] = Points(row, col);
+      }
+      this->modelPointer->VEffMultiT(
+          v, {T_1, T_2}, Potentials, this->modelPointer->GetThreadWorkspace());
+      res[row] = Potentials[1] - Potentials[0];
+    }
+    return res;
+  };
+  std::vector<double> dVdT = NablaNumerical(point, DeltaV, eps) / (T_2 - T_1);
+  std::vector<std::vector<double>> Hess = GetHessian(T, eps, false)(point);
+
+  Eigen::MatrixXd HessMatrix(dim, dim);
+  for (int m = 0; m < dim; m++)
+  {
+    for (int n = 0; n < dim; n++)
+    {
+      HessMatrix(m, n) = Hess[m][n];
+    }
+    // The same shift as in LocateMinimum keeps the flat directions fixed
+    HessMatrix(m, m) += HessianDiagonalShift;
+  }
+
+  std::vector<double> tangent(dim, 0);
+  if (HessMatrix.determinant() == 0) return tangent;
+
+  Eigen::VectorXd EigenDerivative =
+      Eigen::Map<Eigen::VectorXd, Eigen::Unaligned>(dVdT.data(), dVdT.size());
+  Eigen::VectorXd delta =
+      HessMatrix.colPivHouseholderQr().solve(-1 * EigenDerivative);
+  for (int j = 0; j < dim; j++)
+  {
+    tangent[j] = delta(j);
+  }
+  return tangent;
+}
+
+PhaseStepController::PhaseStepController(const double &Tolerance,
+                                         const double &MaxStep,
+                                         const double &MinStep)
+    : Tolerance{Tolerance}
+    , MaxStep{MaxStep}
+    , MinStep{MinStep}
+{
+}
+
+double PhaseStepController::Accepted(const double &dT,
+                                     const double &Error,
+                                     const double &T,
+                                     const double &SEV)
+{
+  // The step grows by at most a factor of two and shrinks by at most five
+  double Factor = Error > 0 ? 0.9 * std::sqrt(Tolerance / Error) : 2;
+  double Step   = std::min(std::abs(dT) * std::clamp(Factor, 0.2, 2.), MaxStep);
+
+  if (not std::isnan(SEV))
+  {
+    if (HasPrevious and SEV > 0 and T != PreviousT)
+    {
+      // Decrease of the smallest eigenvalue per unit temperature in the
+      // tracing direction
+      double Decrease = (PreviousSEV - SEV) / std::abs(T - PreviousT);
+      if (Decrease > 0)
+      {
+        Step = std::min(Step, std::max(0.5 * SEV / Decrease, MinStep));
+      }
+    }
+    HasPrevious = true;
+    PreviousT   = T;
+    PreviousSEV = SEV;
+  }
+  return std::copysign(Step, dT);
+}
+
+double PhaseStepController::Rejected(const double &dT,
+                                     const double &Error) const
+{
+  double Factor = Error > 0 ? 0.9 * std::sqrt(Tolerance / Error) : 0.1;
+  return dT * std::clamp(Factor, 0.1, 0.5);
+}
+
 std::vector<Minimum>
 MinimumTracer::TrackPhase(double &globMinEndT,
                           const std::vector<double> &point_In,
@@ -287,6 +436,14 @@ MinimumTracer::TrackPhase(double &globMinEndT,
   }
   initialdT = dT;
 
+  // Temperature, tangent and prediction of the last accepted minimum for the
+  // predictor-corrector mode
+  double pointT = currentT;
+  std::vector<double> tangent, guess;
+  PhaseStepController StepController(PredictorTolerance * dim,
+                                     PredictorMaxStepFactor * abs(initialdT),
+                                     1e-3 * abs(initialdT));
+
   // Reduce the VEV into the same sector
   ReduceVEV(point);
 
@@ -297,19 +454,32 @@ MinimumTracer::TrackPhase(double &globMinEndT,
      << " | Starting minimum at = " << point << "\n";
   while ((finalT - currentT) / dT >= 0)
   {
+    if (BudgetExhausted(Budget.get()))
+    {
+      ss << "\nEvaluation budget used up at T = " << currentT << " GeV.";
+      break;
+    }
     std::function<double(std::vector<double>)> V = [&](std::vector<double> vev)
     {
       // Potential wrapper
-      std::vector<double> res = this->modelPointer->MinimizeOrderVEV(vev);
-      return this->modelPointer->VEff(res, currentT) /
+      if (Budget) Budget->Consume();
+      return this->modelPointer->VEff(vev, currentT) /
              (1 + currentT * currentT);
     };
-    dV      = [=](auto const &arg) { return NablaNumerical(arg, V, eps); };
-    Hessian = [=](auto const &arg) { return HessianNumerical(arg, V, eps); };
+    dV      = [=, VBatch = GetPotentialBatch(currentT)](auto const &arg)
+    { return NablaNumerical(arg, VBatch, eps); };
+    Hessian = GetHessian(currentT, eps);
 
-    // Locate the minimum
+    // Locate the minimum, in the predictor-corrector mode starting from the
+    // minimum predicted along the tangent of the phase
+    guess = point;
+    if (UsePredictorCorrector and currentT != pointT)
+    {
+      if (tangent.empty()) tangent = PhaseTangent(point, pointT);
+      guess = point + (currentT - pointT) * tangent;
+    }
     new_point =
-        LocateMinimum(point, dV, Hessian, 1e-4 * GradientThreshold * dim);
+        LocateMinimum(guess, dV, Hessian, 1e-4 * GradientThreshold * dim);
 
     // Reduce the VEV into the same sector
     ReduceVEV(new_point);
@@ -321,8 +491,14 @@ MinimumTracer::TrackPhase(double &globMinEndT,
     // by the dimension of the VEV space
     LengthGradient =
         L2NormVector(dV(new_point)) / dim; // (1 + currentT * currentT) *
-    // Compare minimum and previous iteration
-    Distance = L2NormVector(new_point - point);
+    // Compare minimum and previous iteration, or the prediction in the
+    // predictor-corrector mode
+    if (UsePredictorCorrector)
+    {
+      ReduceVEV(guess);
+      ConvertToNonFlatDirections(guess);
+    }
+    Distance = L2NormVector(new_point - guess);
     // Compute difference in energy between both minimum
     PotentialDifference = V(new_point) - V(point);
 
@@ -363,8 +539,16 @@ MinimumTracer::TrackPhase(double &globMinEndT,
         return MinimumList;
       }
 
-      currentT -= dT;
-      dT /= 10.;
+      if (UsePredictorCorrector)
+      {
+        dT       = StepController.Rejected(dT, Distance);
+        currentT = pointT;
+      }
+      else
+      {
+        currentT -= dT;
+        dT /= 10.;
+      }
     }
     else if (unprotected)
     {
@@ -372,22 +556,32 @@ MinimumTracer::TrackPhase(double &globMinEndT,
       newMinimum.temp      = currentT;
       newMinimum.potential = V(new_point) * (1 + currentT * currentT);
       MinimumList.push_back(newMinimum);
-      point = new_point;
+      point  = new_point;
+      pointT = currentT;
+      tangent.clear();
       // Sucess minimum!
       ss << "\033[1;32m.\033[0m";
-      dT *=
-          .5 * ThresholdDistance / Distance; // Try to predict the best stepsize
-      if (abs(initialdT) <= abs(dT)) dT = initialdT;
+      if (UsePredictorCorrector)
+      {
+        dT = StepController.Accepted(dT, Distance, currentT);
+      }
+      else
+      {
+        dT *= .5 * ThresholdDistance /
+              Distance; // Try to predict the best stepsize
+        if (abs(initialdT) <= abs(dT)) dT = initialdT;
+      }
     }
     else
     {
       // It is a nearby stationary point!
-      if (SmallestEigenvalue(new_point, Hessian) < 0)
+      double SEV = SmallestEigenvalue(new_point, Hessian);
+      if (SEV < 0)
       {
         if (IsInMin == -1)
         {
-          zeroTemp = FindZeroSmallestEigenvalue(
-              point, currentT - dT, new_point, currentT);
+          zeroTemp =
+              FindZeroSmallestEigenvalue(point, pointT, new_point, currentT);
           if (zeroTemp.back() > 0)
           {
             currentT = zeroTemp.back();
@@ -425,8 +619,7 @@ MinimumTracer::TrackPhase(double &globMinEndT,
         {
           ss << "Calculation of phase tracker failed. T  = " << currentT
              << " GeV\t|\t Final T = " << finalT << " GeV\t|\t"
-             << LengthGradient << "\t|\t"
-             << SmallestEigenvalue(new_point, Hessian) << "\t";
+             << LengthGradient << "\t|\t" << SEV << "\t";
           // Sucess saddle point!
           ss << "\033[1;31m.\033[0m";
           if (output) Logger::Write(LoggingLevel::MinTracerDetailed, ss.str());
@@ -467,13 +660,22 @@ MinimumTracer::TrackPhase(double &globMinEndT,
           MinimumList.push_back(newMinimum);
           // Sucess minimum!
           ss << "\033[1;32m.\033[0m";
-          dT *= .5 * ThresholdDistance /
-                Distance; // Try to predict the best stepsize
-          if (abs(initialdT) <= abs(dT)) dT = initialdT;
+          if (UsePredictorCorrector)
+          {
+            dT = StepController.Accepted(dT, Distance, currentT, SEV);
+          }
+          else
+          {
+            dT *= .5 * ThresholdDistance /
+                  Distance; // Try to predict the best stepsize
+            if (abs(initialdT) <= abs(dT)) dT = initialdT;
+          }
         }
         IsInMin = -1;
       }
-      point = new_point;
+      point  = new_point;
+      pointT = currentT;
+      tangent.clear();
     }
 
     // Make sure that or step is not bigger than it should be and we overshot
@@ -526,6 +728,14 @@ MinimumTracer::TrackPhase(const std::vector<double> &point_In,
   }
   initialdT = dT;
 
+  // Temperature, tangent and prediction of the last accepted minimum for the
+  // predictor-corrector mode
+  double pointT = currentT;
+  std::vector<double> tangent, guess;
+  PhaseStepController StepController(PredictorTolerance * dim,
+                                     PredictorMaxStepFactor * abs(initialdT),
+                                     1e-3 * abs(initialdT));
+
   // Reduce the VEV into the same sector
   ReduceVEV(point);
 
@@ -536,19 +746,32 @@ MinimumTracer::TrackPhase(const std::vector<double> &point_In,
      << " | Starting minimum at = " << point << "\n";
   while ((finalT - currentT) / dT >= 0)
   {
+    if (BudgetExhausted(Budget.get()))
+    {
+      ss << "\nEvaluation budget used up at T = " << currentT << " GeV.";
+      break;
+    }
     std::function<double(std::vector<double>)> V = [&](std::vector<double> vev)
     {
       // Potential wrapper
-      std::vector<double> res = this->modelPointer->MinimizeOrderVEV(vev);
-      return this->modelPointer->VEff(res, currentT) /
+      if (Budget) Budget->Consume();
+      return this->modelPointer->VEff(vev, currentT) /
              (1 + currentT * currentT);
     };
-    dV      = [=](auto const &arg) { return NablaNumerical(arg, V, eps); };
-    Hessian = [=](auto const &arg) { return HessianNumerical(arg, V, eps); };
+    dV      = [=, VBatch = GetPotentialBatch(currentT)](auto const &arg)
+    { return NablaNumerical(arg, VBatch, eps); };
+    Hessian = GetHessian(currentT, eps);
 
-    // Locate the minimum
+    // Locate the minimum, in the predictor-corrector mode starting from the
+    // minimum predicted along the tangent of the phase
+    guess = point;
+    if (UsePredictorCorrector and currentT != pointT)
+    {
+      if (tangent.empty()) tangent = PhaseTangent(point, pointT);
+      guess = point + (currentT - pointT) * tangent;
+    }
     new_point =
-        LocateMinimum(point, dV, Hessian, 1e-4 * GradientThreshold * dim);
+        LocateMinimum(guess, dV, Hessian, 1e-4 * GradientThreshold * dim);
 
     // Reduce the VEV into the same sector
     ReduceVEV(new_point);
@@ -560,8 +783,14 @@ MinimumTracer::TrackPhase(const std::vector<double> &point_In,
     // by the dimension of the VEV space
     LengthGradient =
         L2NormVector(dV(new_point)) / dim; // (1 + currentT * currentT) *
-    // Compare minimum and previous iteration
-    Distance = L2NormVector(new_point - point);
+    // Compare minimum and previous iteration, or the prediction in the
+    // predictor-corrector mode
+    if (UsePredictorCorrector)
+    {
+      ReduceVEV(guess);
+      ConvertToNonFlatDirections(guess);
+    }
+    Distance = L2NormVector(new_point - guess);
     // Compute difference in energy between both minimum
     PotentialDifference = V(new_point) - V(point);
 
@@ -602,8 +831,16 @@ MinimumTracer::TrackPhase(const std::vector<double> &point_In,
         return MinimumList;
       }
 
-      currentT -= dT;
-      dT /= 10.;
+      if (UsePredictorCorrector)
+      {
+        dT       = StepController.Rejected(dT, Distance);
+        currentT = pointT;
+      }
+      else
+      {
+        currentT -= dT;
+        dT /= 10.;
+      }
     }
     else if (unprotected)
     {
@@ -611,22 +848,32 @@ MinimumTracer::TrackPhase(const std::vector<double> &point_In,
       newMinimum.temp      = currentT;
       newMinimum.potential = V(new_point) * (1 + currentT * currentT);
       MinimumList.push_back(newMinimum);
-      point = new_point;
+      point  = new_point;
+      pointT = currentT;
+      tangent.clear();
       // Sucess minimum!
       ss << "\033[1;32m.\033[0m";
-      dT *=
-          .5 * ThresholdDistance / Distance; // Try to predict the best stepsize
-      if (abs(initialdT) <= abs(dT)) dT = initialdT;
+      if (UsePredictorCorrector)
+      {
+        dT = StepController.Accepted(dT, Distance, currentT);
+      }
+      else
+      {
+        dT *= .5 * ThresholdDistance /
+              Distance; // Try to predict the best stepsize
+        if (abs(initialdT) <= abs(dT)) dT = initialdT;
+      }
     }
     else
     {
       // It is a nearby stationary point!
-      if (SmallestEigenvalue(new_point, Hessian) < 0)
+      double SEV = SmallestEigenvalue(new_point, Hessian);
+      if (SEV < 0)
       {
         if (IsInMin == -1)
         {
-          zeroTemp = FindZeroSmallestEigenvalue(
-              point, currentT - dT, new_point, currentT);
+          zeroTemp =
+              FindZeroSmallestEigenvalue(point, pointT, new_point, currentT);
           if (zeroTemp.back() > 0)
           {
             currentT = zeroTemp.back();
@@ -647,8 +894,7 @@ MinimumTracer::TrackPhase(const std::vector<double> &point_In,
         {
           ss << "Calculation of Tc or phase tracker failed. T  = " << currentT
              << " GeV\t|\t Final T = " << finalT << " GeV\t|\t"
-             << LengthGradient << "\t|\t"
-             << SmallestEigenvalue(new_point, Hessian) << "\t";
+             << LengthGradient << "\t|\t" << SEV << "\t";
           // Sucess saddle point!
           ss << "\033[1;31m.\033[0m";
           if (output) Logger::Write(LoggingLevel::MinTracerDetailed, ss.str());
@@ -672,13 +918,22 @@ MinimumTracer::TrackPhase(const std::vector<double> &point_In,
           MinimumList.push_back(newMinimum);
           // Sucess minimum!
           ss << "\033[1;32m.\033[0m";
-          dT *= .5 * ThresholdDistance /
-                Distance; // Try to predict the best stepsize
-          if (abs(initialdT) <= abs(dT)) dT = initialdT;
+          if (UsePredictorCorrector)
+          {
+            dT = StepController.Accepted(dT, Distance, currentT, SEV);
+          }
+          else
+          {
+            dT *= .5 * ThresholdDistance /
+                  Distance; // Try to predict the best stepsize
+            if (abs(initialdT) <= abs(dT)) dT = initialdT;
+          }
         }
         IsInMin = -1;
       }
-      point = new_point;
+      point  = new_point;
+      pointT = currentT;
+      tangent.clear();
     }
 
     // Make sure that or step is not bigger than it should be and we overshot
@@ -973,9 +1228,8 @@ void MinimumTracer::FindDiscreteSymmetries()
   std::function<double(Eigen::VectorXd)> V = [&](Eigen::VectorXd vev)
   {
     // Potential wrapper at T=0 for tree-level potential
-    std::vector<double> res = this->modelPointer->MinimizeOrderVEV(
-        std::vector<double>(vev.data(), vev.data() + vev.size()));
-    return this->modelPointer->VEff(res, 0, 0, 0);
+    return this->modelPointer->VEff(
+        std::vector<double>(vev.data(), vev.data() + vev.size()), 0, 0, 0);
   };
 
   // Generate random VEV
@@ -1075,7 +1329,10 @@ MinimumTracer::GetGlobalMinimum(const double &Temp,
                                   check,
                                   start,
                                   this->WhichMinimizer,
-                                  this->UseMultithreading));
+                                  this->UseMultithreading,
+                                  false,
+                                  nullptr,
+                                  this->Budget.get()));
 }
 
 std::vector<double>
@@ -1092,6 +1349,43 @@ std::vector<double> MinimumTracer::GetGlobalMinimum(const double &Temp)
       Temp, std::vector<double>(modelPointer->get_NHiggs(), 0));
 }
 
+std::vector<Minimum> MinimumTracer::GetDistinctMinima(const double &Temp,
+                                                     const double &Tolerance)
+{
+  auto Reduce = [this](std::vector<double> &vev)
+  {
+    ReduceVEV(vev);
+    ConvertToNonFlatDirections(vev);
+  };
+  auto Distinct = Minimizer::Minimize_gen_all_distinct(
+      this->modelPointer,
+      Temp,
+      std::vector<double>(modelPointer->get_NHiggs(), 0),
+      this->WhichMinimizer,
+      Reduce,
+      Tolerance,
+      this->UseMultithreading);
+
+  std::vector<Minimum> res;
+  for (const auto &Entry : Distinct)
+  {
+    Minimum min;
+    min.point     = Entry.Point;
+    min.temp      = Temp;
+    min.potential = Entry.PotVal;
+    res.push_back(min);
+  }
+  if (res.size() > 0) res.front().is_glob_min = true;
+  return res;
+}
+
+std::vector<double>
+MinimumTracer::PotentialMultiT(const std::vector<double> &point,
+                               const std::vector<double> &Temps)
+{
+  return modelPointer->VEffMultiT(point, Temps);
+}
+
 void MinimumTracer::IsGlobMin(Minimum &min)
 {
   double num_error = 1;
@@ -1201,13 +1495,12 @@ int MinimumTracer::IsThereEWSymmetryRestoration()
     // wrappers for potential, first and second numerical derivative
     V = [&](std::vector<double> vev)
     {
-      std::vector<double> res = this->modelPointer->MinimizeOrderVEV(vev);
       if (C_UseParwani)
-        return this->modelPointer->VEff(res, T) / (1 + T * T * log(T * T));
-      return this->modelPointer->VEff(res, T) / (1 + T * T);
+        return this->modelPointer->VEff(vev, T) / (1 + T * T * log(T * T));
+      return this->modelPointer->VEff(vev, T) / (1 + T * T);
     };
     dV      = [=](auto const &arg) { return NablaNumerical(arg, V, eps); };
-    Hessian = [=](auto const &arg) { return HessianNumerical(arg, V, eps); };
+    Hessian = C_UseParwani ? GetHessian(V, eps) : GetHessian(T, eps);
 
     ActualSmallestEigenvalue = SmallestEigenvalue(point, Hessian);
 
@@ -1299,29 +1592,44 @@ void CoexPhases::CalculateTc()
   auto deltaV = [&](double T)
   { return true_phase.Get(T).potential - false_phase.Get(T).potential; };
 
-  /// Ploting deltaV
-  std::stringstream ss;
-  AsciiPlotter plotter("dV(T) = V(True Vacuum) - V(False Vacuum) | Phase " +
-                           std::to_string(false_phase.id) + " -> Phase " +
-                           std::to_string(true_phase.id),
-                       100,
-                       35);
-  std::vector<double> plotT, plotDeltaV, plot0;
-  for (double T = T_low; T <= T_high; T += (T_high - T_low) / 100)
-  {
-    plotT.push_back(T);
-    plotDeltaV.push_back(deltaV(T));
-    plot0.push_back(0);
-  }
-  plotter.addPlot(plotT, plot0, "", '.');
-  plotter.addPlot(plotT, plotDeltaV, "dV", '*');
-
-  plotter.xlabel("T (GeV)");
-  plotter.ylabel("dV (GeV)");
-  plotter.show(ss);
-  Logger::Write(LoggingLevel::MinTracerDetailed, ss.str());
+  // The plot is only built if it is written to the log
+  if (Logger::GetLoggingLevelStatus(LoggingLevel::MinTracerDetailed))
+  {
+    /// Ploting deltaV
+    std::stringstream ss;
+    AsciiPlotter plotter("dV(T) = V(True Vacuum) - V(False Vacuum) | Phase " +
+                             std::to_string(false_phase.id) + " -> Phase " +
+                             std::to_string(true_phase.id),
+                         100,
+                         35);
+    std::vector<double> plotT, plotDeltaV, plot0;
+    for (double T = T_low; T <= T_high; T += (T_high - T_low) / 100)
+    {
+      plotT.push_back(T);
+      plot0.push_back(0);
+    }
+    // The plot only needs the potentials of the already tracked minima, no
+    // new minima are located
+    const auto plotVTrue  = true_phase.GetPotentials(plotT);
+    const auto plotVFalse = false_phase.GetPotentials(plotT);
+    for (std::size_t i = 0; i < plotVTrue.size() and i < plotVFalse.size();
+         i++)
+    {
+      plotDeltaV.push_back(plotVTrue[i] - plotVFalse[i]);
+    }
+    plotter.addPlot(plotT, plot0, "", '.');
+    plotter.addPlot(plotT, plotDeltaV, "dV", '*');
+
+    plotter.xlabel("T (GeV)");
+    plotter.ylabel("dV (GeV)");
+    plotter.show(ss);
+    Logger::Write(LoggingLevel::MinTracerDetailed, ss.str());
+  }
 
-  if (deltaV(T_high) > 0 and deltaV(T_low) > 0)
+  const double deltaVHigh = deltaV(T_high);
+  const double deltaVLow  = deltaV(T_low);
+
+  if (deltaVHigh > 0 and deltaVLow > 0)
   {
     Logger::Write(LoggingLevel::MinTracerDetailed,
                   "True vacuum candidate is never energetically viable.");
@@ -1329,7 +1637,7 @@ void CoexPhases::CalculateTc()
     crit_status = BSMPT::StatusCrit::FalseLower;
     crit_temp   = -1;
   }
-  else if (deltaV(T_high) < 0 and deltaV(T_low) < 0)
+  else if (deltaVHigh < 0 and deltaVLow < 0)
   {
     Logger::Write(LoggingLevel::MinTracerDetailed,
                   "True vacuum candidate is always energetically "
@@ -1339,31 +1647,44 @@ void CoexPhases::CalculateTc()
     crit_status = BSMPT::StatusCrit::TrueLower;
     crit_temp   = T_high;
   }
-  else if (deltaV(T_high) > 0 and deltaV(T_low) < 0)
-  {
-    // Binary search
-    double binaryLowT    = T_low;
-    double binaryMiddleT = T_low;
-    double binaryHighT   = T_high;
-    while (abs(binaryHighT / binaryLowT - 1) > 1e-10)
+  else if (deltaVHigh > 0 and deltaVLow < 0)
+  {
+    // Estimate Tc on the interpolated phases without tracking them
+    const double FalseTolerance = false_phase.InterpolationTolerance;
+    const double TrueTolerance  = true_phase.InterpolationTolerance;
+    false_phase.InterpolationTolerance = std::numeric_limits<double>::max();
+    true_phase.InterpolationTolerance  = std::numeric_limits<double>::max();
+    const double Estimate =
+        FindRootIllinois(deltaV, T_low, T_high, deltaVLow, deltaVHigh, 1e-6);
+    false_phase.InterpolationTolerance = FalseTolerance;
+    true_phase.InterpolationTolerance  = TrueTolerance;
+
+    // Final bracket around the estimate, widened until it contains the sign
+    // change. The ends of the overlap always do.
+    double Width = 1e-4 * (T_high - T_low);
+    double BracketLowT, BracketHighT, deltaVBracketLow, deltaVBracketHigh;
+    do
     {
-      binaryMiddleT = (binaryHighT + binaryLowT) / 2;
-
-      if (deltaV(binaryMiddleT) > 0)
-      {
-        binaryHighT = binaryMiddleT;
-      }
-      else
-      {
-        binaryLowT = binaryMiddleT;
-      }
-    }
+      BracketLowT  = std::max(T_low, Estimate - Width);
+      BracketHighT = std::min(T_high, Estimate + Width);
+      deltaVBracketLow =
+          BracketLowT == T_low ? deltaVLow : deltaV(BracketLowT);
+      deltaVBracketHigh =
+          BracketHighT == T_high ? deltaVHigh : deltaV(BracketHighT);
+      Width *= 10;
+    } while (deltaVBracketLow > 0 or deltaVBracketHigh < 0);
+
+    const double Tc = FindRootIllinois(deltaV,
+                                       BracketLowT,
+                                       BracketHighT,
+                                       deltaVBracketLow,
+                                       deltaVBracketHigh);
     Logger::Write(LoggingLevel::MinTracerDetailed,
                   "Critical temperature identified at Tc = " +
-                      std::to_string(binaryMiddleT) + " GeV");
+                      std::to_string(Tc) + " GeV");
 
     crit_status = BSMPT::StatusCrit::Success;
-    crit_temp   = binaryMiddleT;
+    crit_temp   = Tc;
   }
   else
   {
@@ -1377,6 +1698,48 @@ void CoexPhases::CalculateTc()
   return;
 }
 
+double FindRootIllinois(const std::function<double(double)> &f,
+                        double a,
+                        double b,
+                        double fa,
+                        double fb,
+                        const double &rel_precision,
+                        const int &max_iter)
+{
+  if (fa == 0) return a;
+  if (fb == 0) return b;
+  if (fa * fb > 0)
+  {
+    throw std::runtime_error(
+        "FindRootIllinois() requires a sign change in the bracket.");
+  }
+  // b is the end replaced last, the root lies between a and b
+  for (int iter = 0; iter < max_iter; iter++)
+  {
+    if (std::abs(b - a) <= rel_precision * std::max(std::abs(a), std::abs(b)))
+    {
+      break;
+    }
+    double c  = b - fb * (b - a) / (fb - fa);
+    double fc = f(c);
+    if (fc == 0) return c;
+    if (fc * fb < 0)
+    {
+      // the root lies between b and c
+      a  = b;
+      fa = fb;
+    }
+    else
+    {
+      // a is kept again, the Illinois modification
+      fa /= 2;
+    }
+    b  = c;
+    fb = fc;
+  }
+  return b;
+}
+
 std::vector<std::vector<double>>
 Create1DimGrid(const std::vector<double> &point,
                const int k,
@@ -1602,10 +1965,23 @@ Phase::Phase(const double &initialT,
              const double &LowT,
              const double &HighT,
              std::shared_ptr<MinimumTracer> &MinTracerIn)
+    : Phase(initialT,
+            LowT,
+            HighT,
+            MinTracerIn->ConvertToVEVDim(
+                MinTracerIn->GetGlobalMinimum(initialT)),
+            MinTracerIn)
 {
-  MinTracer = MinTracerIn;
-  std::vector<double> phase_start =
-      MinTracer->ConvertToVEVDim(MinTracer->GetGlobalMinimum(initialT));
+}
+
+Phase::Phase(const double &initialT,
+             const double &LowT,
+             const double &HighT,
+             const std::vector<double> &GlobalMinimum,
+             std::shared_ptr<MinimumTracer> &MinTracerIn)
+{
+  MinTracer                       = MinTracerIn;
+  std::vector<double> phase_start = GlobalMinimum;
 
   // Reduce the VEV into the same sector
   MinTracer->ReduceVEV(phase_start);
@@ -1672,24 +2048,34 @@ Minimum Phase::Get(double T)
                   "Tried to Get() the minimum outside temperature range of "
                   "the phase.");
   }
+  if (MinimumPhaseVector.size() == 0) return Minimum();
 
-  double error = 1e100;
-  Minimum bestGuess;
-  // Compute minimum closes to the desired temperature
-  for (auto min = MinimumPhaseVector.begin(); min < MinimumPhaseVector.end();
-       ++min)
+  Minimum Key;
+  Key.temp   = T;
+  auto Above = std::lower_bound(
+      MinimumPhaseVector.begin(), MinimumPhaseVector.end(), Key);
+  if (Above != MinimumPhaseVector.end() and Above->temp == T)
   {
-    if (abs(T - min->temp) < error)
-    {
-      error     = abs(T - min->temp);
-      bestGuess = *min;
-    }
+    // Minimum already in the list
+    return *Above;
   }
-  if (error == 0)
+  if (InterpolationTolerance > 0 and Above != MinimumPhaseVector.begin() and
+      Above != MinimumPhaseVector.end())
   {
-    // Minimum already in the list
-    return bestGuess;
+    double ErrorEstimate;
+    Minimum Interpolated = Interpolate(T, ErrorEstimate);
+    if (ErrorEstimate <= InterpolationTolerance) return Interpolated;
+  }
+
+  // Minimum closest to the desired temperature
+  auto Closest = Above;
+  if (Above == MinimumPhaseVector.end() or
+      (Above != MinimumPhaseVector.begin() and
+       T - std::prev(Above)->temp < Above->temp - T))
+  {
+    Closest = std::prev(Above);
   }
+  Minimum bestGuess = *Closest;
   std::vector<Minimum> MinimumList = MinTracer->TrackPhase(
       bestGuess.point, bestGuess.temp, T, (T - bestGuess.temp), false, true);
   // Check if the TrackPhase fails
@@ -1716,52 +2102,108 @@ Minimum Phase::Get(double T)
   return bestGuess;
 }
 
-void Phase::Add(Minimum min)
+Minimum Phase::Interpolate(const double &T, double &ErrorEstimate)
 {
-  // Check if phase is already there
-  for (std::size_t i = 0; i < MinimumPhaseVector.size(); i++)
+  Minimum Key;
+  Key.temp   = T;
+  auto Above = std::lower_bound(
+      MinimumPhaseVector.begin(), MinimumPhaseVector.end(), Key);
+  if (Above == MinimumPhaseVector.begin() or Above == MinimumPhaseVector.end())
+  {
+    throw std::runtime_error(
+        "Phase::Interpolate() requires a temperature inside the temperature "
+        "range of the phase.");
+  }
+  auto Below = std::prev(Above);
+  for (auto Knot : {Below, Above})
+  {
+    if (Knot->tangent.empty())
+    {
+      Knot->tangent = MinTracer->PhaseTangent(Knot->point, Knot->temp);
+    }
+  }
+
+  // Cubic Hermite basis in s = (T - T_below) / h
+  const double h = Above->temp - Below->temp;
+  const double s = (T - Below->temp) / h;
+  Minimum res;
+  res.temp  = T;
+  res.point = (2 * s * s * s - 3 * s * s + 1) * Below->point +
+              (s * s * s - 2 * s * s + s) * h * Below->tangent +
+              (-2 * s * s * s + 3 * s * s) * Above->point +
+              (s * s * s - s * s) * h * Above->tangent;
+  res.potential = MinTracer->PotentialMultiT(res.point, {T}).front();
+
+  // The spline differs from the quadratic interpolation anchored at the
+  // closer minimum by Mismatch * s * (1 - s) * min(s, 1 - s)
+  std::vector<double> Mismatch = h * (Below->tangent + Above->tangent) -
+                                 2. * (Above->point - Below->point);
+  ErrorEstimate = L2NormVector(Mismatch) * s * (1 - s) * std::min(s, 1 - s);
+  return res;
+}
+
+std::vector<double> Phase::GetPotentials(const std::vector<double> &Temps)
+{
+  std::vector<double> res;
+  if (MinimumPhaseVector.empty()) return res;
+  res.reserve(Temps.size());
+
+  // Index of the closest minimum for each temperature. MinimumPhaseVector is
+  // sorted by temperature
+  std::vector<std::size_t> Closest(Temps.size());
+  std::size_t k = 0;
+  for (std::size_t i = 0; i < Temps.size(); i++)
   {
-    if (min.temp == MinimumPhaseVector[i].temp)
+    while (k + 1 < MinimumPhaseVector.size() and
+           abs(Temps[i] - MinimumPhaseVector[k + 1].temp) <
+               abs(Temps[i] - MinimumPhaseVector[k].temp))
     {
-      return;
+      k++;
     }
+    Closest[i] = k;
   }
+
+  for (std::size_t begin = 0, end = 0; begin < Temps.size(); begin = end)
+  {
+    while (end < Temps.size() and Closest[end] == Closest[begin])
+    {
+      end++;
+    }
+    const auto Potentials = MinTracer->PotentialMultiT(
+        MinimumPhaseVector[Closest[begin]].point,
+        std::vector<double>(Temps.begin() + begin, Temps.begin() + end));
+    res.insert(res.end(), Potentials.begin(), Potentials.end());
+  }
+  return res;
+}
+
+void Phase::Add(Minimum min)
+{
+  auto pos = std::lower_bound(
+      MinimumPhaseVector.begin(), MinimumPhaseVector.end(), min);
+  // Check if phase is already there
+  if (pos != MinimumPhaseVector.end() and pos->temp == min.temp) return;
   // If the list is empty add that value in.
   if (MinimumPhaseVector.size() == 0)
   {
     MinimumPhaseVector = {min};
     return;
   }
-  // Temperature is the lowest yet.
-  if (min.temp < MinimumPhaseVector[0].temp)
+  if (pos == MinimumPhaseVector.begin())
   {
-    // update EdgeOfPhase
+    // Temperature is the lowest yet, update EdgeOfPhase
     MinimumPhaseVector.front().EdgeOfPhase = 0;
     min.EdgeOfPhase                        = -1;
-    // insert min to begin of phase vector
-    MinimumPhaseVector.insert(MinimumPhaseVector.begin(), min);
-    T_low = min.temp;
-    return;
+    T_low                                  = min.temp;
   }
-  // Is the temperature in the middle of other temperatures?
-  for (std::size_t i = 0; i < MinimumPhaseVector.size() - 1; i++)
+  else if (pos == MinimumPhaseVector.end())
   {
-    if (min.temp > MinimumPhaseVector[i].temp and
-        min.temp < MinimumPhaseVector[i + 1].temp)
-    {
-      MinimumPhaseVector.insert(MinimumPhaseVector.begin() + i + 1, min);
-      return;
-    }
+    // Temperature is the biggest yet, update EdgeOfPhase
+    MinimumPhaseVector.back().EdgeOfPhase = 0;
+    min.EdgeOfPhase                       = 1;
+    T_high                                = min.temp;
   }
-  // If not, it is the biggest temperature yet, add it to the end and update
-  // EdgeOfPhase
-  MinimumPhaseVector.back().EdgeOfPhase = 0;
-  min.EdgeOfPhase                       = 1;
-
-  MinimumPhaseVector.push_back(min);
-  T_high = min.temp;
-
-  return;
+  MinimumPhaseVector.insert(pos, min);
 }
 
 void Vacuum::MultiStepPTMode0(const std::vector<double> &LowTempPoint_in,
@@ -1770,24 +2212,33 @@ void Vacuum::MultiStepPTMode0(const std::vector<double> &LowTempPoint_in,
   auto LowTempPoint  = LowTempPoint_in;
   auto HighTempPoint = HighTempPoint_in;
 
-  Logger::Write(LoggingLevel::MinTracerDetailed,
-                "Low-temperature phase starts at " +
-                    vec_to_string(LowTempPoint) + "\n");
-  Phase LowTempPhase(LowTempPoint, T_low, T_high, MinTracer);
+  Phase LowTempPhase, HighTempPhase;
+  TraceConcurrently(
+      {[&]()
+       {
+         Logger::Write(LoggingLevel::MinTracerDetailed,
+                       "Low-temperature phase starts at " +
+                           vec_to_string(LowTempPoint) + "\n");
+         LowTempPhase = Phase(LowTempPoint, T_low, T_high, MinTracer);
+         Logger::Write(LoggingLevel::MinTracerDetailed,
+                       "Low-temperature phase exists until T = " +
+                           std::to_string(LowTempPhase.T_high) + " GeV");
+       },
+       [&]()
+       {
+         Logger::Write(LoggingLevel::MinTracerDetailed,
+                       "High-temperature phase starts at T = " +
+                           vec_to_string(HighTempPoint) + " GeV");
+         HighTempPhase = Phase(HighTempPoint, T_high, T_low, MinTracer);
+         Logger::Write(LoggingLevel::MinTracerDetailed,
+                       "High-temperature phase exists until T = " +
+                           std::to_string(HighTempPhase.T_low) + " GeV");
+       }});
+
   T_high_lowTempPhase = LowTempPhase.T_high;
-  Logger::Write(LoggingLevel::MinTracerDetailed,
-                "Low-temperature phase exists until T = " +
-                    std::to_string(T_high_lowTempPhase) + " GeV");
   if (LowTempPhase.MinimumPhaseVector.size() > 1) addPhase(LowTempPhase);
 
-  Logger::Write(LoggingLevel::MinTracerDetailed,
-                "High-temperature phase starts at T = " +
-                    vec_to_string(HighTempPoint) + " GeV");
-  Phase HighTempPhase(HighTempPoint, T_high, T_low, MinTracer);
   T_low_highTempPhase = HighTempPhase.T_low;
-  Logger::Write(LoggingLevel::MinTracerDetailed,
-                "High-temperature phase exists until T = " +
-                    std::to_string(T_low_highTempPhase) + " GeV");
   if (HighTempPhase.MinimumPhaseVector.size() > 1) addPhase(HighTempPhase);
 
   if (LowTempPhase.MinimumPhaseVector.size() > 1 and
@@ -1909,31 +2360,40 @@ void Vacuum::MultiStepPTMode1(const std::vector<double> &LowTempPoint_in,
   auto LowTempPoint  = LowTempPoint_in;
   auto HighTempPoint = HighTempPoint_in;
 
-  Logger::Write(LoggingLevel::MinTracerDetailed,
-                "Low-temperature phase starts at T = " +
-                    vec_to_string(LowTempPoint) + " GeV");
-  Phase LowTempPhase(LowTempPoint, T_low, T_high, MinTracer);
+  Phase LowTempPhase, HighTempPhase;
+  TraceConcurrently(
+      {[&]()
+       {
+         Logger::Write(LoggingLevel::MinTracerDetailed,
+                       "Low-temperature phase starts at T = " +
+                           vec_to_string(LowTempPoint) + " GeV");
+         LowTempPhase = Phase(LowTempPoint, T_low, T_high, MinTracer);
+         if (LowTempPhase.MinimumPhaseVector.size() > 1)
+         {
+           Logger::Write(LoggingLevel::MinTracerDetailed,
+                         "Low-temperature phase exists until T = " +
+                             std::to_string(LowTempPhase.T_high) + " GeV");
+         }
+       },
+       [&]()
+       {
+         Logger::Write(LoggingLevel::MinTracerDetailed,
+                       "High-temperature phase starts at " +
+                           vec_to_string(HighTempPoint) + "\n");
+         HighTempPhase = Phase(HighTempPoint, T_high, T_low, MinTracer);
+         if (HighTempPhase.MinimumPhaseVector.size() > 1)
+         {
+           Logger::Write(LoggingLevel::MinTracerDetailed,
+                         "High-temperature phase exists until T = " +
+                             std::to_string(HighTempPhase.T_low) + " GeV");
+         }
+       }});
+
   T_high_lowTempPhase = LowTempPhase.T_high;
-  if (LowTempPhase.MinimumPhaseVector.size() > 1)
-  {
-    addPhase(LowTempPhase);
-    Logger::Write(LoggingLevel::MinTracerDetailed,
-                  "Low-temperature phase exists until T = " +
-                      std::to_string(T_high_lowTempPhase) + " GeV");
-  }
+  if (LowTempPhase.MinimumPhaseVector.size() > 1) addPhase(LowTempPhase);
 
-  Logger::Write(LoggingLevel::MinTracerDetailed,
-                "High-temperature phase starts at " +
-                    vec_to_string(HighTempPoint) + "\n");
-  Phase HighTempPhase(HighTempPoint, T_high, T_low, MinTracer);
   T_low_highTempPhase = HighTempPhase.T_low;
-  if (HighTempPhase.MinimumPhaseVector.size() > 1)
-  {
-    addPhase(HighTempPhase);
-    Logger::Write(LoggingLevel::MinTracerDetailed,
-                  "High-temperature phase exists until T = " +
-                      std::to_string(T_low_highTempPhase) + " GeV");
-  }
+  if (HighTempPhase.MinimumPhaseVector.size() > 1) addPhase(HighTempPhase);
 
   bool whole_temp_region_traced = DoPhasesOverlap(LowTempPhase, HighTempPhase);
   bool sides_traced             = whole_temp_region_traced;
@@ -1975,11 +2435,20 @@ void Vacuum::MultiStepPTMode1(const std::vector<double> &LowTempPoint_in,
     bool error_detected         = false;
 
     while (not whole_temp_region_traced and global_minimum_overlap and
-           not error_detected)
-    {
-      Phase LowTempPhaseMiddle(tmp_high_lowTempPhase, T_low, T_high, MinTracer);
-      Phase HighTempPhaseMiddle(
-          tmp_low_highTempPhase, T_low, T_high, MinTracer);
+           not error_detected and not BudgetExhausted(MinTracer->Budget.get()))
+    {
+      Phase LowTempPhaseMiddle, HighTempPhaseMiddle;
+      TraceConcurrently(
+          {[&]()
+           {
+             LowTempPhaseMiddle =
+                 Phase(tmp_high_lowTempPhase, T_low, T_high, MinTracer);
+           },
+           [&]()
+           {
+             HighTempPhaseMiddle =
+                 Phase(tmp_low_highTempPhase, T_low, T_high, MinTracer);
+           }});
 
       if (LowTempPhaseMiddle.MinimumPhaseVector.size() > 1)
         addPhase(LowTempPhaseMiddle);
@@ -2083,8 +2552,20 @@ void Vacuum::MultiStepPTMode2(const std::vector<double> &LowTempPoint_in,
   auto LowTempPoint  = LowTempPoint_in;
   auto HighTempPoint = HighTempPoint_in;
 
-  double T_low_newglob;
-  Phase LowTempPhase(LowTempPoint, T_low, T_high, T_low_newglob, MinTracer);
+  double T_low_newglob, T_high_newglob;
+  Phase LowTempPhase, HighTempPhase;
+  TraceConcurrently(
+      {[&]()
+       {
+         LowTempPhase =
+             Phase(LowTempPoint, T_low, T_high, T_low_newglob, MinTracer);
+       },
+       [&]()
+       {
+         HighTempPhase =
+             Phase(HighTempPoint, T_high, T_low, T_high_newglob, MinTracer);
+       }});
+
   T_high_lowTempPhase = LowTempPhase.T_high;
   Logger::Write(LoggingLevel::MinTracerDetailed,
                 "Low-temperature phase exists in T = [" +
@@ -2095,8 +2576,6 @@ void Vacuum::MultiStepPTMode2(const std::vector<double> &LowTempPoint_in,
                     std::to_string(T_low_newglob) + "] GeV\n");
   if (LowTempPhase.MinimumPhaseVector.size() > 1) addPhase(LowTempPhase);
 
-  double T_high_newglob;
-  Phase HighTempPhase(HighTempPoint, T_high, T_low, T_high_newglob, MinTracer);
   T_low_highTempPhase = HighTempPhase.T_low;
   Logger::Write(LoggingLevel::MinTracerDetailed,
                 "High-temperature phase exists until T = [" +
@@ -2120,27 +2599,46 @@ void Vacuum::MultiStepPTMode2(const std::vector<double> &LowTempPoint_in,
   while (tmp_T_low_newglob <
          tmp_T_high_newglob) // glob min not found in whole temp range
   {
+    if (BudgetExhausted(MinTracer->Budget.get())) break;
     Logger::Write(LoggingLevel::MinTracerDetailed,
                   "Searching for phases in range T = [ " +
                       std::to_string(tmp_T_low_newglob) + ", " +
                       std::to_string(tmp_T_high_newglob) + " ] GeV\n");
 
-    // Low-temperature phase
-    LowTempPoint = MinTracer->ConvertToVEVDim(
-        MinTracer->GetGlobalMinimum(tmp_T_low_newglob));
+    // The low- and high-temperature phases are traced independently
+    Phase LowTempPhaseMiddle, HighTempPhaseMiddle;
+    tmp_T_low_newglob_old  = tmp_T_low_newglob;
+    tmp_T_high_newglob_old = tmp_T_high_newglob;
+    TraceConcurrently(
+        {[&]()
+         {
+           LowTempPoint = MinTracer->ConvertToVEVDim(
+               MinTracer->GetGlobalMinimum(tmp_T_low_newglob_old));
+           LowTempPhaseMiddle = Phase(tmp_T_low_newglob_old,
+                                      LowTempPoint,
+                                      T_low,
+                                      T_high,
+                                      tmp_T_low_newglob,
+                                      MinTracer);
+         },
+         [&]()
+         {
+           HighTempPoint = MinTracer->ConvertToVEVDim(
+               MinTracer->GetGlobalMinimum(tmp_T_high_newglob_old));
+           HighTempPhaseMiddle = Phase(tmp_T_high_newglob_old,
+                                       HighTempPoint,
+                                       T_low,
+                                       T_high,
+                                       tmp_T_high_newglob,
+                                       MinTracer);
+         }});
 
+    // Low-temperature phase
     Logger::Write(
         LoggingLevel::MinTracerDetailed,
-        "Intermediate phase at T = " + std::to_string(tmp_T_low_newglob) +
+        "Intermediate phase at T = " + std::to_string(tmp_T_low_newglob_old) +
             " GeV with " + vec_to_string(LowTempPoint) + "\n");
 
-    tmp_T_low_newglob_old = tmp_T_low_newglob;
-    Phase LowTempPhaseMiddle(tmp_T_low_newglob_old,
-                             LowTempPoint,
-                             T_low,
-                             T_high,
-                             tmp_T_low_newglob,
-                             MinTracer);
     if (LowTempPhaseMiddle.T_low < LowTempPhaseMiddle.T_high)
     {
       Logger::Write(LoggingLevel::MinTracerDetailed,
@@ -2156,21 +2654,11 @@ void Vacuum::MultiStepPTMode2(const std::vector<double> &LowTempPoint_in,
     }
 
     // High-temperature phase
-    HighTempPoint = MinTracer->ConvertToVEVDim(
-        MinTracer->GetGlobalMinimum(tmp_T_high_newglob));
-
     Logger::Write(
         LoggingLevel::MinTracerDetailed,
-        "Intermediate phase at T = " + std::to_string(tmp_T_high_newglob) +
+        "Intermediate phase at T = " + std::to_string(tmp_T_high_newglob_old) +
             " GeV with " + vec_to_string(HighTempPoint) + "\n");
 
-    tmp_T_high_newglob_old = tmp_T_high_newglob;
-    Phase HighTempPhaseMiddle(tmp_T_high_newglob_old,
-                              HighTempPoint,
-                              T_low,
-                              T_high,
-                              tmp_T_high_newglob,
-                              MinTracer);
     if (HighTempPhaseMiddle.T_low < HighTempPhaseMiddle.T_high)
     {
       Logger::Write(LoggingLevel::MinTracerDetailed,
@@ -2271,13 +2759,15 @@ Vacuum::Vacuum(const double &T_lowIn,
                std::shared_ptr<Class_Potential_Origin> &modelPointerIn,
                const int &UseMultiStepPTMode,
                const int &num_pointsIn,
-               const bool &do_only_tracing)
+               const bool &do_only_tracing,
+               const int &num_refinementsIn)
 {
-  T_low        = T_lowIn;
-  T_high       = T_highIn;
-  MinTracer    = MinTracerIn;
-  modelPointer = modelPointerIn;
-  num_points   = num_pointsIn;
+  T_low           = T_lowIn;
+  T_high          = T_highIn;
+  MinTracer       = MinTracerIn;
+  modelPointer    = modelPointerIn;
+  num_points      = num_pointsIn;
+  num_refinements = num_refinementsIn;
 
   status_vacuum =
       StatusTracing::Success; // flipped to error code if error encountered
@@ -2351,6 +2841,14 @@ Vacuum::Vacuum(const double &T_lowIn,
     }
   }
 
+  if (BudgetExhausted(MinTracer->Budget.get()))
+  {
+    Logger::Write(LoggingLevel::MinTracerDetailed,
+                  "Evaluation budget used up during the phase tracing.");
+    status_vacuum = StatusTracing::BudgetExhausted;
+    return;
+  }
+
   // trace EW minimum (still at least a local minimum)
   Minimum EWMin;
   EWMin.temp  = 0;
@@ -2422,6 +2920,9 @@ Vacuum::Vacuum(const double &T_lowIn,
 
 void Vacuum::MultiStepPTTracer(const double &Temp, const double &deltaT)
 {
+  // the phases traced so far are kept, the constructor sets the status
+  if (BudgetExhausted(MinTracer->Budget.get())) return;
+
   if (Temp <= T_low)
   {
     auto glob_min = MinTracer->GetGlobalMinimum(T_low);
@@ -2433,35 +2934,52 @@ void Vacuum::MultiStepPTTracer(const double &Temp, const double &deltaT)
     }
     else
     {
-      // low temperature phase
-      Phase phase(T_low, T_low, T_high, MinTracer);
+      // low temperature phase, seeded with the global minimum found above
+      Phase phase(T_low,
+                  T_low,
+                  T_high,
+                  MinTracer->ConvertToVEVDim(glob_min),
+                  MinTracer);
       addPhase(phase);
       print(phase);
 
-      // test equally-spaced point grid
+      // test equally-spaced point grid, refined between neighbouring points
+      // in different phases. If the grid is refined it includes T_low and
+      // T_high, so phase boundaries next to the outer points are refined as
+      // well. Without refinements only the intermediate points are scanned.
+      GridPhases.clear();
+      std::vector<double> Temps;
       for (int i = 1; i <= num_points; i++)
       {
-        Minimum min;
-        min.temp = T_low + (T_high - T_low) / (num_points + 1) * i;
-        min.point =
-            MinTracer->ConvertToVEVDim(MinTracer->GetGlobalMinimum(min.temp));
-        MinTracer->ReduceVEV(min.point);
-        MinTracer->ConvertToNonFlatDirections(min.point);
-
-        if (MinimumFoundAlready(min) == -1) // found new phase
+        Temps.push_back(T_low + (T_high - T_low) / (num_points + 1) * i);
+      }
+      if (num_refinements > 0)
+      {
+        GridPhases[T_low] =
+            MergeGridPoint(T_low, MinTracer->ConvertToVEVDim(glob_min));
+        Temps.push_back(T_high);
+      }
+      for (int level = 0; level <= num_refinements and Temps.size() > 0;
+           level++)
+      {
+        if (BudgetExhausted(MinTracer->Budget.get())) break;
+        const auto GlobalMinima = ScanGlobalMinima(Temps);
+        // merge in ascending temperature, independent of the order in which
+        // the minimisations finished
+        for (std::size_t i = 0; i < Temps.size(); i++)
         {
-          Logger::Write(
-              LoggingLevel::MinTracerDetailed,
-              "-------------------------------------------------------");
-          Phase inter_phase(min.temp, T_high, T_low, MinTracer);
-          addPhase(inter_phase);
-          print(inter_phase);
+          GridPhases[Temps.at(i)] =
+              MergeGridPoint(Temps.at(i), GlobalMinima.at(i));
         }
-        else
+        Temps.clear();
+        for (auto Lower = GridPhases.begin(), Upper = std::next(Lower);
+             Upper != GridPhases.end();
+             ++Lower, ++Upper)
         {
-          Logger::Write(LoggingLevel::MinTracerDetailed,
-                        "Point at T = " + std::to_string(min.temp) +
-                            " GeV belongs to already traced phase.");
+          if (Lower->second != Upper->second)
+          {
+            Temps.push_back(0.5 * (Lower->first + Upper->first));
+          }
         }
       }
     }
@@ -2486,8 +3004,10 @@ void Vacuum::MultiStepPTTracer(const double &Temp, const double &deltaT)
   }
 
   Minimum min;
+  const auto GlobalMinimum =
+      MinTracer->ConvertToVEVDim(MinTracer->GetGlobalMinimum(Temp));
   min.temp  = Temp;
-  min.point = MinTracer->ConvertToVEVDim(MinTracer->GetGlobalMinimum(Temp));
+  min.point = GlobalMinimum;
 
   // Reduce the VEV into the same sector
   MinTracer->ReduceVEV(min.point);
@@ -2498,7 +3018,8 @@ void Vacuum::MultiStepPTTracer(const double &Temp, const double &deltaT)
   {
     Logger::Write(LoggingLevel::MinTracerDetailed,
                   "-------------------------------------------------------");
-    Phase phase(Temp, T_high, T_low, MinTracer);
+    // the global minimum is reused instead of minimising again
+    Phase phase(Temp, T_high, T_low, GlobalMinimum, MinTracer);
     addPhase(phase);
     print(phase);
 
@@ -2513,6 +3034,97 @@ void Vacuum::MultiStepPTTracer(const double &Temp, const double &deltaT)
   return;
 }
 
+std::vector<std::vector<double>>
+Vacuum::ScanGlobalMinima(const std::vector<double> &Temps)
+{
+  std::vector<std::vector<double>> res(Temps.size());
+  auto Minimise = [&](std::size_t i)
+  {
+    res.at(i) =
+        MinTracer->ConvertToVEVDim(MinTracer->GetGlobalMinimum(Temps.at(i)));
+  };
+  if (not MinTracer->GetUseMultithreading())
+  {
+    for (std::size_t i = 0; i < Temps.size(); i++)
+    {
+      Minimise(i);
+    }
+    return res;
+  }
+  TaskGroup Scan;
+  for (std::size_t i = 0; i < Temps.size(); i++)
+  {
+    Scan.Run([&Minimise, i]() { Minimise(i); });
+  }
+  Scan.Wait();
+  return res;
+}
+
+int Vacuum::MergeGridPoint(const double &Temp,
+                           const std::vector<double> &GlobalMinimum)
+{
+  Minimum min;
+  min.temp  = Temp;
+  min.point = GlobalMinimum;
+  MinTracer->ReduceVEV(min.point);
+  MinTracer->ConvertToNonFlatDirections(min.point);
+
+  int PhaseIndex = MinimumFoundAlready(min);
+  if (PhaseIndex != -1)
+  {
+    Logger::Write(LoggingLevel::MinTracerDetailed,
+                  "Point at T = " + std::to_string(Temp) +
+                      " GeV belongs to already traced phase.");
+    return PhaseIndex;
+  }
+
+  // found new phase
+  Logger::Write(LoggingLevel::MinTracerDetailed,
+                "-------------------------------------------------------");
+  Phase inter_phase(Temp, T_high, T_low, GlobalMinimum, MinTracer);
+  addPhase(inter_phase);
+  print(inter_phase);
+  return MinimumFoundAlready(min);
+}
+
+void Vacuum::TraceConcurrently(
+    const std::vector<std::function<void()>> &Traces)
+{
+  if (not MinTracer->GetUseMultithreading())
+  {
+    for (const auto &Trace : Traces)
+    {
+      Trace();
+    }
+    return;
+  }
+  // The messages of each trace are collected and written in the order of
+  // Traces, as if they had run one after another
+  std::vector<std::string> Logs(Traces.size());
+  TaskGroup Tracing;
+  for (std::size_t i = 0; i < Traces.size(); i++)
+  {
+    Tracing.Run(
+        [&Traces, &Logs, i]()
+        {
+          LogBuffer Buffer(Logs.at(i));
+          Traces.at(i)();
+        });
+  }
+  try
+  {
+    Tracing.Wait();
+  }
+  catch (...)
+  {
+    for (const auto &Log : Logs)
+      Logger::WriteBuffered(Log);
+    throw;
+  }
+  for (const auto &Log : Logs)
+    Logger::WriteBuffered(Log);
+}
+
 void Vacuum::print(const Phase &phase)
 {
   if (phase.MinimumPhaseVector.size() > 1)
@@ -0,0 +1,68 @@
+// SPDX-FileCopyrightText: 2021 Philipp Basler, Margarete Mühlleitner and Jonas
+// Müller
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file
+ * Detection of the block structure of mass matrices
+ */
+
+#include <BSMPT/models/BlockEigenSolver.h>
+
+#include <algorithm>
+#include <numeric>
+
+namespace BSMPT
+{
+
+MatrixBlocks FindMatrixBlocks(
+    const Eigen::Matrix<bool, Eigen::Dynamic, Eigen::Dynamic> &Pattern)
+{
+  const std::size_t Dimension = Pattern.rows();
+  std::vector<std::size_t> Parent(Dimension);
+  std::iota(Parent.begin(), Parent.end(), 0);
+
+  auto Find = [&Parent](std::size_t i)
+  {
+    while (Parent[i] != i)
+    {
+      Parent[i] = Parent[Parent[i]];
+      i         = Parent[i];
+    }
+    return i;
+  };
+
+  for (std::size_t i = 0; i < Dimension; i++)
+  {
+    for (std::size_t j = i + 1; j < Dimension; j++)
+    {
+      if (Pattern(i, j) or Pattern(j, i))
+      {
+        const auto Root1 = Find(i);
+        const auto Root2 = Find(j);
+        if (Root1 != Root2)
+        {
+          Parent[std::max(Root1, Root2)] = std::min(Root1, Root2);
+        }
+      }
+    }
+  }
+
+  MatrixBlocks res;
+  res.Dimension = Dimension;
+  std::vector<std::size_t> BlockOfRoot(Dimension, Dimension);
+  for (std::size_t i = 0; i < Dimension; i++)
+  {
+    const auto Root = Find(i);
+    if (BlockOfRoot[Root] == Dimension)
+    {
+      BlockOfRoot[Root] = res.Blocks.size();
+      res.Blocks.emplace_back();
+    }
+    res.Blocks[BlockOfRoot[Root]].push_back(i);
+  }
+  return res;
+}
+
+} // namespace BSMPT
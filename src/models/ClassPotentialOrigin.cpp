@@ -5,7 +5,9 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include <gsl/gsl_sf_gamma.h>
+#include <array>
 #include <iomanip>
+#include <map>
 #include <random>
 
 #include "Eigen/Dense"
@@ -13,13 +15,16 @@
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_sf_zeta.h>
 
-#include <BSMPT/ThermalFunctions/NegativeBosonSpline.h>
+#include <BSMPT/ThermalFunctions/ThermalFunctionChebyshev.h>
+#include <BSMPT/ThermalFunctions/ThermalFunctionTable.h>
 #include <BSMPT/ThermalFunctions/ThermalFunctions.h>
 #include <BSMPT/minimizer/Minimizer.h>
 #include <BSMPT/models/ClassPotentialOrigin.h>
+#include <BSMPT/models/FixedDimensionKernel.h>
 #include <BSMPT/models/IncludeAllModels.h>
 #include <BSMPT/models/ModelTestfunctions.h>
 #include <BSMPT/utility/Logger.h>
+#include <BSMPT/utility/ThreadPool.h>
 #include <BSMPT/utility/utility.h>
 using namespace Eigen;
 
@@ -53,6 +58,7 @@ void Class_Potential_Origin::set_All(const std::vector<double> &par,
 
   set_gen(par);
   if (!SetCurvatureDone) SetCurvatureArrays();
+  if (!SparseCurvatureDone) SetSparseCurvatureArrays();
   set_CT_Pot_Par(parCT);
   CalculateDebye();
   CalculateDebyeGauge();
@@ -109,6 +115,50 @@ Class_Potential_Origin::CWTerm(double MassSquared, double cb, int diff) const
   return PotVal;
 }
 
+double Class_Potential_Origin::Jboson(double Ratio, int diff) const
+{
+  if (ThermalDerivatives == ThermalDerivativeMethod::NumericalIntegration)
+  {
+    return ThermalFunctions::JbosonNumericalIntegration(Ratio, diff);
+  }
+  if (ThermalDerivatives == ThermalDerivativeMethod::Chebyshev)
+  {
+    return ThermalFunctions::JbosonChebyshev(Ratio, diff);
+  }
+  return ThermalFunctions::JbosonTabulated(Ratio, diff);
+}
+
+double Class_Potential_Origin::Jfermion(double Ratio, int diff) const
+{
+  if (ThermalDerivatives == ThermalDerivativeMethod::NumericalIntegration)
+  {
+    return ThermalFunctions::JfermionNumericalIntegration(Ratio, diff);
+  }
+  if (ThermalDerivatives == ThermalDerivativeMethod::Chebyshev)
+  {
+    return ThermalFunctions::JfermionChebyshev(Ratio, diff);
+  }
+  return ThermalFunctions::JfermionTabulated(Ratio, diff);
+}
+
+double Class_Potential_Origin::JbosonPotential(double Ratio, int diff) const
+{
+  if (ThermalValues == ThermalFunctionMethod::Chebyshev)
+  {
+    return ThermalFunctions::JbosonChebyshev(Ratio, diff);
+  }
+  return ThermalFunctions::JbosonInterpolated(Ratio, diff);
+}
+
+double Class_Potential_Origin::JfermionPotential(double Ratio, int diff) const
+{
+  if (ThermalValues == ThermalFunctionMethod::Chebyshev)
+  {
+    return ThermalFunctions::JfermionChebyshev(Ratio, diff);
+  }
+  return ThermalFunctions::JfermionInterpolated(Ratio, diff);
+}
+
 double Class_Potential_Origin::boson(double MassSquared,
                                      double Temp,
                                      double cb,
@@ -121,20 +171,18 @@ double Class_Potential_Origin::boson(double MassSquared,
   if (diff == 0)
   {
     res += std::pow(Temp, 4) / (2 * std::pow(M_PI, 2)) *
-           ThermalFunctions::JbosonInterpolated(Ratio);
+           JbosonPotential(Ratio);
   }
   else if (diff == 1)
   {
     res += std::pow(Temp, 2) / (2 * std::pow(M_PI, 2)) *
-           ThermalFunctions::JbosonNumericalIntegration(Ratio, 1);
+           Jboson(Ratio, 1);
   }
   else if (diff == -1)
   {
     res += 1.0 / (2 * std::pow(M_PI, 2)) *
-           (4 * std::pow(Temp, 3) *
-                ThermalFunctions::JbosonNumericalIntegration(Ratio, 0) -
-            2 * Temp * MassSquared *
-                ThermalFunctions::JbosonNumericalIntegration(Ratio, 1));
+           (4 * std::pow(Temp, 3) * Jboson(Ratio, 0) -
+            2 * Temp * MassSquared * Jboson(Ratio, 1));
   }
   return res;
 }
@@ -149,24 +197,144 @@ Class_Potential_Origin::fermion(double MassSquared, double Temp, int diff) const
   if (diff == 0)
   {
     res += std::pow(Temp, 4) / (2 * std::pow(M_PI, 2)) *
-           ThermalFunctions::JfermionInterpolated(Ratio);
+           JfermionPotential(Ratio);
   }
   else if (diff == 1)
   {
     res += std::pow(Temp, 2) / (2 * std::pow(M_PI, 2)) *
-           ThermalFunctions::JfermionNumericalIntegration(Ratio, 1);
+           Jfermion(Ratio, 1);
   }
   else if (diff == -1)
   {
     res += 1.0 / (2 * std::pow(M_PI, 2)) *
-           (4 * std::pow(Temp, 3) *
-                ThermalFunctions::JfermionNumericalIntegration(Ratio) -
-            2 * Temp * MassSquared *
-                ThermalFunctions::JfermionNumericalIntegration(Ratio, 1));
+           (4 * std::pow(Temp, 3) * Jfermion(Ratio, 0) -
+            2 * Temp * MassSquared * Jfermion(Ratio, 1));
+  }
+  return res;
+}
+
+double Class_Potential_Origin::OneLoopSum(OneLoopTerms &Terms,
+                                          double Temp) const
+{
+  double res = 0;
+  for (std::size_t i = 0; i < Terms.BosonMassSquared.size(); i++)
+  {
+    res += Terms.BosonDegrees[i] *
+           CWTerm(std::abs(Terms.BosonMassSquared[i]), Terms.BosonCb[i], 0);
+  }
+  for (std::size_t i = 0; i < Terms.FermionMassSquared.size(); i++)
+  {
+    res += Terms.FermionDegrees[i] *
+           CWTerm(std::abs(Terms.FermionMassSquared[i]), C_CWcbFermion, 0);
+  }
+  if (Temp == 0) return res;
+
+  const double Temp2 = std::pow(Temp, 2);
+  double Thermal     = 0;
+
+  Terms.Ratios.resize(Terms.BosonMassSquared.size());
+  Terms.Values.resize(Terms.BosonMassSquared.size());
+  for (std::size_t i = 0; i < Terms.Ratios.size(); i++)
+  {
+    Terms.Ratios[i] = Terms.BosonMassSquared[i] / Temp2;
+  }
+  if (ThermalValues == ThermalFunctionMethod::Chebyshev)
+  {
+    for (std::size_t i = 0; i < Terms.Ratios.size(); i++)
+    {
+      Terms.Values[i] = ThermalFunctions::JbosonChebyshev(Terms.Ratios[i]);
+    }
+  }
+  else
+  {
+    ThermalFunctions::JbosonBatch(
+        Terms.Ratios.data(), Terms.Values.data(), Terms.Ratios.size());
+  }
+  for (std::size_t i = 0; i < Terms.Values.size(); i++)
+  {
+    Thermal += Terms.BosonDegrees[i] * Terms.Values[i];
+  }
+
+  Terms.Ratios.resize(Terms.FermionMassSquared.size());
+  Terms.Values.resize(Terms.FermionMassSquared.size());
+  for (std::size_t i = 0; i < Terms.Ratios.size(); i++)
+  {
+    Terms.Ratios[i] = Terms.FermionMassSquared[i] / Temp2;
+  }
+  if (ThermalValues == ThermalFunctionMethod::Chebyshev)
+  {
+    for (std::size_t i = 0; i < Terms.Ratios.size(); i++)
+    {
+      Terms.Values[i] = ThermalFunctions::JfermionChebyshev(Terms.Ratios[i]);
+    }
+  }
+  else
+  {
+    ThermalFunctions::JfermionBatch(
+        Terms.Ratios.data(), Terms.Values.data(), Terms.Ratios.size());
+  }
+  for (std::size_t i = 0; i < Terms.Values.size(); i++)
+  {
+    Thermal += Terms.FermionDegrees[i] * Terms.Values[i];
   }
+
+  res += std::pow(Temp, 4) / (2 * std::pow(M_PI, 2)) * Thermal;
   return res;
 }
 
+std::pair<double, double>
+Class_Potential_Origin::BosonMassDerivatives(double MassSquared,
+                                             double Temp,
+                                             double cb) const
+{
+  double First = 0, Second = 0;
+  const double AbsMassSquared = std::abs(MassSquared);
+  const bool IsMassive        = AbsMassSquared >= C_threshold;
+  if (IsMassive)
+  {
+    // The Coleman-Weinberg potential is evaluated with |m^2|
+    const double Sign = (MassSquared < 0) ? -1 : 1;
+    First             = Sign * CWTerm(AbsMassSquared, cb, 1);
+    Second = 1.0 / (32 * M_PI * M_PI) * (FCW(AbsMassSquared) - cb + 1.5);
+  }
+  if (Temp == 0) return std::make_pair(First, Second);
+  double Ratio = MassSquared / std::pow(Temp, 2);
+  First += std::pow(Temp, 2) / (2 * std::pow(M_PI, 2)) *
+           JbosonPotential(Ratio, 1);
+  if (IsMassive)
+  {
+    Second += 1.0 / (2 * std::pow(M_PI, 2)) *
+              ThermalFunctions::JbosonInterpolated(Ratio, 2);
+  }
+  return std::make_pair(First, Second);
+}
+
+std::pair<double, double>
+Class_Potential_Origin::FermionMassDerivatives(double MassSquared,
+                                               double Temp) const
+{
+  double First = 0, Second = 0;
+  const double AbsMassSquared = std::abs(MassSquared);
+  const bool IsMassive        = AbsMassSquared >= C_threshold;
+  if (IsMassive)
+  {
+    const double Sign = (MassSquared < 0) ? -1 : 1;
+    First             = Sign * CWTerm(AbsMassSquared, C_CWcbFermion, 1);
+    Second            = 1.0 / (32 * M_PI * M_PI) *
+             (FCW(AbsMassSquared) - C_CWcbFermion + 1.5);
+  }
+  if (Temp == 0) return std::make_pair(First, Second);
+  double Ratio = MassSquared / std::pow(Temp, 2);
+  First += std::pow(Temp, 2) / (2 * std::pow(M_PI, 2)) *
+           JfermionPotential(Ratio, 1);
+  if (IsMassive)
+  {
+    Second += 1.0 / (2 * std::pow(M_PI, 2)) *
+              ThermalFunctions::JfermionInterpolated(Ratio, 2);
+  }
+  return std::make_pair(First, Second);
+}
+
 std::vector<double> Class_Potential_Origin::FirstDerivativeOfEigenvalues(
     const Ref<MatrixXcd> M,
     const Ref<MatrixXcd> MDiff) const
@@ -959,62 +1127,155 @@ Class_Potential_Origin::SecondDerivativeOfEigenvaluesNonRepeated(
   return res;
 }
 
-void Class_Potential_Origin::CalculatePhysicalCouplings()
+namespace
 {
-  if (!SetCurvatureDone) SetCurvatureArrays();
-  const double ZeroMass = std::pow(10, -5);
-  MatrixXd MassHiggs(NHiggs, NHiggs), MassGauge(NGauge, NGauge);
-  MatrixXcd MassQuark(NQuarks, NQuarks), MassLepton(NLepton, NLepton);
-  MassHiggs  = MatrixXd::Zero(NHiggs, NHiggs);
-  MassGauge  = MatrixXd::Zero(NGauge, NGauge);
-  MassQuark  = MatrixXcd::Zero(NQuarks, NQuarks);
-  MassLepton = MatrixXcd::Zero(NLepton, NLepton);
-
-  MassSquaredGauge.resize(NGauge);
-  MassSquaredHiggs.resize(NHiggs);
-  MassSquaredQuark.resize(NQuarks);
-  MassSquaredLepton.resize(NLepton);
-  HiggsRotationMatrix.resize(NHiggs);
-  for (std::size_t i = 0; i < NHiggs; i++)
-    HiggsRotationMatrix[i].resize(NHiggs);
-
-  for (std::size_t i = 0; i < NHiggs; i++)
+/**
+ * Adds the rotated entries of the sparse tensor In to Out, i.e.
+ * Out[a][b][c] += R0(a, i) R1(b, j) R2(c, k) In[i][j][k]. Vanishing entries of
+ * the rotation matrices are skipped.
+ */
+template <typename Tensor, typename Scalar>
+void AddRotatedSparse(Tensor &Out,
+                      const SparseTensor<Scalar, 3> &In,
+                      const MatrixXd &R0,
+                      const MatrixXd &R1,
+                      const MatrixXd &R2)
+{
+  for (std::size_t n = 0; n < In.size(); n++)
   {
-    for (std::size_t j = 0; j < NHiggs; j++)
+    const auto &Index = In.Indices[n];
+    for (long a = 0; a < R0.rows(); a++)
     {
-      MassHiggs(i, j) += Curvature_Higgs_L2[i][j];
-      for (std::size_t k = 0; k < NHiggs; k++)
+      const double Fac0 = R0(a, Index[0]);
+      if (Fac0 == 0) continue;
+      for (long b = 0; b < R1.rows(); b++)
       {
-        MassHiggs(i, j) += Curvature_Higgs_L3[i][j][k] * HiggsVev[k];
-        for (std::size_t l = 0; l < NHiggs; l++)
-          MassHiggs(i, j) +=
-              0.5 * Curvature_Higgs_L4[i][j][k][l] * HiggsVev[k] * HiggsVev[l];
+        const double Fac1 = Fac0 * R1(b, Index[1]);
+        if (Fac1 == 0) continue;
+        for (long c = 0; c < R2.rows(); c++)
+        {
+          Out[a][b][c] += Fac1 * R2(c, Index[2]) * In.Values[n];
+        }
       }
     }
   }
+}
 
-  for (std::size_t a = 0; a < NGauge; a++)
+/**
+ * Adds the rotated entries of the sparse tensor In to Out, i.e.
+ * Out[a][b][c][d] += R0(a, i) R1(b, j) R2(c, k) R3(d, l) In[i][j][k][l].
+ * Vanishing entries of the rotation matrices are skipped.
+ */
+template <typename Tensor, typename Scalar>
+void AddRotatedSparse(Tensor &Out,
+                      const SparseTensor<Scalar, 4> &In,
+                      const MatrixXd &R0,
+                      const MatrixXd &R1,
+                      const MatrixXd &R2,
+                      const MatrixXd &R3)
+{
+  for (std::size_t n = 0; n < In.size(); n++)
   {
-    for (std::size_t b = 0; b < NGauge; b++)
+    const auto &Index = In.Indices[n];
+    for (long a = 0; a < R0.rows(); a++)
     {
-      for (std::size_t i = 0; i < NHiggs; i++)
+      const double Fac0 = R0(a, Index[0]);
+      if (Fac0 == 0) continue;
+      for (long b = 0; b < R1.rows(); b++)
       {
-        for (std::size_t j = 0; j < NHiggs; j++)
+        const double Fac1 = Fac0 * R1(b, Index[1]);
+        if (Fac1 == 0) continue;
+        for (long c = 0; c < R2.rows(); c++)
         {
-          MassGauge(a, b) += 0.5 * Curvature_Gauge_G2H2[a][b][i][j] *
-                             HiggsVev[i] * HiggsVev[j];
+          const double Fac2 = Fac1 * R2(c, Index[2]);
+          if (Fac2 == 0) continue;
+          for (long d = 0; d < R3.rows(); d++)
+          {
+            Out[a][b][c][d] += Fac2 * R3(d, Index[3]) * In.Values[n];
+          }
         }
       }
     }
   }
+}
+
+/**
+ * Calculates the Lambda_{(F)}^{IJk} and Lambda_{(F)}^{IJkm} tensors from the
+ * non-vanishing entries of Y^{IJk} and the fermion mass matrix MIJ
+ */
+void CalculateFermionLambdas(
+    const SparseTensor<std::complex<double>, 3> &F2H1,
+    const MatrixXcd &MIJ,
+    std::vector<std::vector<std::vector<std::complex<double>>>> &Lambda3,
+    std::vector<std::vector<std::vector<std::vector<std::complex<double>>>>>
+        &Lambda4)
+{
+  for (auto &I : Lambda3)
+    for (auto &J : I)
+      std::fill(J.begin(), J.end(), 0);
+  for (auto &I : Lambda4)
+    for (auto &J : I)
+      for (auto &k : J)
+        std::fill(k.begin(), k.end(), 0);
+
+  const std::size_t NFermion = MIJ.rows();
+  for (std::size_t n = 0; n < F2H1.size(); n++)
+  {
+    const auto &Index = F2H1.Indices[n];
+    const auto &Value = F2H1.Values[n];
+    const auto I = Index[0], J = Index[1], k = Index[2];
+    for (std::size_t l = 0; l < NFermion; l++)
+    {
+      Lambda3[I][l][k] += std::conj(Value) * MIJ(J, l);
+      Lambda3[l][J][k] += std::conj(MIJ(l, I)) * Value;
+    }
+    for (std::size_t m = 0; m < F2H1.size(); m++)
+    {
+      const auto &IndexM = F2H1.Indices[m];
+      if (IndexM[0] != J) continue;
+      const auto Product = std::conj(Value) * F2H1.Values[m];
+      Lambda4[I][IndexM[1]][k][IndexM[2]] += Product;
+      Lambda4[I][IndexM[1]][IndexM[2]][k] += Product;
+    }
+  }
+}
+} // namespace
+
+void Class_Potential_Origin::CalculatePhysicalCouplings()
+{
+  if (!SetCurvatureDone) SetCurvatureArrays();
+  if (!SparseCurvatureDone) SetSparseCurvatureArrays();
+  using vec2 = std::vector<std::vector<double>>;
+  using vec3 = std::vector<std::vector<std::vector<double>>>;
+  using vec4 = std::vector<std::vector<std::vector<std::vector<double>>>>;
+
+  using vec1Complex = std::vector<std::complex<double>>;
+  using vec2Complex = std::vector<std::vector<std::complex<double>>>;
+  using vec3Complex =
+      std::vector<std::vector<std::vector<std::complex<double>>>>;
+  using vec4Complex =
+      std::vector<std::vector<std::vector<std::vector<std::complex<double>>>>>;
+
+  const double ZeroMass = std::pow(10, -5);
+
+  MassSquaredGauge.resize(NGauge);
+  MassSquaredHiggs.resize(NHiggs);
+  MassSquaredQuark.resize(NQuarks);
+  MassSquaredLepton.resize(NLepton);
+  HiggsRotationMatrix.resize(NHiggs);
+  for (std::size_t i = 0; i < NHiggs; i++)
+    HiggsRotationMatrix[i].resize(NHiggs);
+
+  MatrixXd MassHiggs = HiggsMassMatrix(HiggsVev, 0, 0);
+  MatrixXd MassGauge = GaugeMassMatrix(HiggsVev, 0);
 
   MatrixXcd MIJQuarks = QuarkMassMatrix(HiggsVev);
 
-  MassQuark = MIJQuarks.conjugate() * MIJQuarks;
+  MatrixXcd MassQuark = MIJQuarks.conjugate() * MIJQuarks;
 
   MatrixXcd MIJLeptons = LeptonMassMatrix(HiggsVev);
 
-  MassLepton = MIJLeptons.conjugate() * MIJLeptons;
+  MatrixXcd MassLepton = MIJLeptons.conjugate() * MIJLeptons;
 
   MatrixXd HiggsRot(NHiggs, NHiggs), GaugeRot(NGauge, NGauge),
       QuarkRot(NQuarks, NQuarks), LepRot(NLepton, NLepton);
@@ -1060,371 +1321,138 @@ void Class_Potential_Origin::CalculatePhysicalCouplings()
   for (std::size_t i = 0; i < NLepton; i++)
     MassSquaredLepton[i] = esLepton.eigenvalues().real()[i];
 
-  for (std::size_t a = 0; a < NGauge; a++)
-  {
-    for (std::size_t b = 0; b < NGauge; b++)
-    {
-      for (std::size_t i = 0; i < NHiggs; i++)
-      {
-        LambdaGauge_3[a][b][i] = 0;
-        for (std::size_t j = 0; j < NHiggs; j++)
-          LambdaGauge_3[a][b][i] +=
-              Curvature_Gauge_G2H2[a][b][i][j] * HiggsVev[j];
-      }
-    }
-  }
-  for (std::size_t a = 0; a < NHiggs; a++)
-  {
-    for (std::size_t b = 0; b < NHiggs; b++)
-    {
-      for (std::size_t i = 0; i < NHiggs; i++)
-      {
-        LambdaHiggs_3[a][b][i] = Curvature_Higgs_L3[a][b][i];
+  // The Lambda tensors are built from the non-vanishing curvature entries
+  const auto &L3   = SparseCurvature.HiggsL3;
+  const auto &L4   = SparseCurvature.HiggsL4;
+  const auto &G2H2 = SparseCurvature.GaugeG2H2;
 
-        for (std::size_t j = 0; j < NHiggs; j++)
-        {
-          LambdaHiggs_3[a][b][i] +=
-              Curvature_Higgs_L4[a][b][i][j] * HiggsVev[j];
-        }
-      }
-    }
+  LambdaGauge_3 = vec3{NGauge, vec2{NGauge, std::vector<double>(NHiggs, 0)}};
+  for (std::size_t n = 0; n < G2H2.size(); n++)
+  {
+    const auto &Index = G2H2.Indices[n];
+    LambdaGauge_3[Index[0]][Index[1]][Index[2]] +=
+        G2H2.Values[n] * HiggsVev[Index[3]];
   }
 
-  for (std::size_t i = 0; i < NQuarks; i++)
+  LambdaHiggs_3 = vec3{NHiggs, vec2{NHiggs, std::vector<double>(NHiggs, 0)}};
+  for (std::size_t n = 0; n < L3.size(); n++)
   {
-    for (std::size_t j = 0; j < NQuarks; j++)
-    {
-      for (std::size_t k = 0; k < NHiggs; k++)
-      {
-        LambdaQuark_3[i][j][k] = 0;
-        for (std::size_t l = 0; l < NQuarks; l++)
-        {
-          LambdaQuark_3[i][j][k] +=
-              conj(Curvature_Quark_F2H1[i][l][k]) * MIJQuarks(l, j);
-          LambdaQuark_3[i][j][k] +=
-              conj(MIJQuarks(i, l)) * Curvature_Quark_F2H1[l][j][k];
-        }
-        for (std::size_t m = 0; m < NHiggs; m++)
-        {
-          LambdaQuark_4[i][j][k][m] = 0;
-          for (std::size_t l = 0; l < NQuarks; l++)
-          {
-            LambdaQuark_4[i][j][k][m] += conj(Curvature_Quark_F2H1[i][l][k]) *
-                                         Curvature_Quark_F2H1[l][j][m];
-            LambdaQuark_4[i][j][k][m] += conj(Curvature_Quark_F2H1[i][l][m]) *
-                                         Curvature_Quark_F2H1[l][j][k];
-          }
-        }
-      }
-    }
+    const auto &Index = L3.Indices[n];
+    LambdaHiggs_3[Index[0]][Index[1]][Index[2]] += L3.Values[n];
   }
-
-  for (std::size_t i = 0; i < NLepton; i++)
+  for (std::size_t n = 0; n < L4.size(); n++)
   {
-    for (std::size_t j = 0; j < NLepton; j++)
-    {
-      for (std::size_t k = 0; k < NHiggs; k++)
-      {
-        LambdaLepton_3[i][j][k] = 0;
-        for (std::size_t l = 0; l < NLepton; l++)
-        {
-          LambdaLepton_3[i][j][k] +=
-              conj(Curvature_Lepton_F2H1[i][l][k]) * MIJLeptons(l, j);
-          LambdaLepton_3[i][j][k] +=
-              conj(MIJLeptons(i, l)) * Curvature_Lepton_F2H1[l][j][k];
-        }
-        for (std::size_t m = 0; m < NHiggs; m++)
-        {
-          LambdaLepton_4[i][j][k][m] = 0;
-          for (std::size_t l = 0; l < NLepton; l++)
-          {
-            LambdaLepton_4[i][j][k][m] += conj(Curvature_Lepton_F2H1[i][l][k]) *
-                                          Curvature_Lepton_F2H1[l][j][m];
-            LambdaLepton_4[i][j][k][m] += conj(Curvature_Lepton_F2H1[i][l][m]) *
-                                          Curvature_Lepton_F2H1[l][j][k];
-          }
-        }
-      }
-    }
+    const auto &Index = L4.Indices[n];
+    LambdaHiggs_3[Index[0]][Index[1]][Index[2]] +=
+        L4.Values[n] * HiggsVev[Index[3]];
   }
 
+  CalculateFermionLambdas(
+      SparseCurvature.QuarkF2H1, MIJQuarks, LambdaQuark_3, LambdaQuark_4);
+  CalculateFermionLambdas(
+      SparseCurvature.LeptonF2H1, MIJLeptons, LambdaLepton_3, LambdaLepton_4);
+
   // Rotate and save std::size_to corresponding vectors
 
-  Couplings_Higgs_Quartic.resize(NHiggs);
-  Couplings_Higgs_Triple.resize(NHiggs);
+  Couplings_Higgs_Triple =
+      vec3{NHiggs, vec2{NHiggs, std::vector<double>(NHiggs, 0)}};
+  Couplings_Higgs_Quartic =
+      vec4{NHiggs, vec3{NHiggs, vec2{NHiggs, std::vector<double>(NHiggs, 0)}}};
+  AddRotatedSparse(Couplings_Higgs_Triple,
+                   MakeSparse(LambdaHiggs_3),
+                   HiggsRot,
+                   HiggsRot,
+                   HiggsRot);
+  AddRotatedSparse(
+      Couplings_Higgs_Quartic, L4, HiggsRot, HiggsRot, HiggsRot, HiggsRot);
+
+  // Gauge Rot
+  Couplings_Gauge_Higgs_21 =
+      vec3{NGauge, vec2{NGauge, std::vector<double>(NHiggs, 0)}};
+  Couplings_Gauge_Higgs_22 =
+      vec4{NGauge, vec3{NGauge, vec2{NHiggs, std::vector<double>(NHiggs, 0)}}};
+  AddRotatedSparse(Couplings_Gauge_Higgs_21,
+                   MakeSparse(LambdaGauge_3),
+                   GaugeRot,
+                   GaugeRot,
+                   HiggsRot);
+  AddRotatedSparse(
+      Couplings_Gauge_Higgs_22, G2H2, GaugeRot, GaugeRot, HiggsRot, HiggsRot);
+
+  // Quark
+  Couplings_Quark_Higgs_21 =
+      vec3Complex{NQuarks, vec2Complex{NQuarks, vec1Complex(NHiggs, 0)}};
+  Couplings_Quark_Higgs_22 = vec4Complex{
+      NQuarks,
+      vec3Complex{NQuarks, vec2Complex{NHiggs, vec1Complex(NHiggs, 0)}}};
+  AddRotatedSparse(Couplings_Quark_Higgs_21,
+                   MakeSparse(LambdaQuark_3),
+                   QuarkRot,
+                   QuarkRot,
+                   HiggsRot);
+  AddRotatedSparse(Couplings_Quark_Higgs_22,
+                   MakeSparse(LambdaQuark_4),
+                   QuarkRot,
+                   QuarkRot,
+                   HiggsRot,
+                   HiggsRot);
+
+  // Lepton
+  Couplings_Lepton_Higgs_21 =
+      vec3Complex{NLepton, vec2Complex{NLepton, vec1Complex(NHiggs, 0)}};
+  Couplings_Lepton_Higgs_22 = vec4Complex{
+      NLepton,
+      vec3Complex{NLepton, vec2Complex{NHiggs, vec1Complex(NHiggs, 0)}}};
+  AddRotatedSparse(Couplings_Lepton_Higgs_21,
+                   MakeSparse(LambdaLepton_3),
+                   LepRot,
+                   LepRot,
+                   HiggsRot);
+  AddRotatedSparse(Couplings_Lepton_Higgs_22,
+                   MakeSparse(LambdaLepton_4),
+                   LepRot,
+                   LepRot,
+                   HiggsRot,
+                   HiggsRot);
+
   for (std::size_t i = 0; i < NHiggs; i++)
   {
-    Couplings_Higgs_Quartic[i].resize(NHiggs);
-    Couplings_Higgs_Triple[i].resize(NHiggs);
     for (std::size_t j = 0; j < NHiggs; j++)
     {
-      Couplings_Higgs_Quartic[i][j].resize(NHiggs);
-      Couplings_Higgs_Triple[i][j].resize(NHiggs);
-      for (std::size_t k = 0; k < NHiggs; k++)
-        Couplings_Higgs_Quartic[i][j][k].resize(NHiggs);
+      HiggsRotationMatrix[i][j] = HiggsRot(i, j);
     }
   }
 
-  Couplings_Gauge_Higgs_22.resize(NGauge);
-  Couplings_Gauge_Higgs_21.resize(NGauge);
-  for (std::size_t a = 0; a < NGauge; a++)
-  {
-    Couplings_Gauge_Higgs_22[a].resize(NGauge);
-    Couplings_Gauge_Higgs_21[a].resize(NGauge);
-    for (std::size_t b = 0; b < NGauge; b++)
-    {
-      Couplings_Gauge_Higgs_22[a][b].resize(NHiggs);
-      Couplings_Gauge_Higgs_21[a][b].resize(NHiggs);
-      for (std::size_t i = 0; i < NHiggs; i++)
-      {
-        Couplings_Gauge_Higgs_22[a][b][i].resize(NHiggs);
-      }
-    }
-  }
+  CalcCouplingsdone = true;
 
-  Couplings_Quark_Higgs_22.resize(NQuarks);
-  Couplings_Quark_Higgs_21.resize(NQuarks);
-  for (std::size_t a = 0; a < NQuarks; a++)
-  {
-    Couplings_Quark_Higgs_22[a].resize(NQuarks);
-    Couplings_Quark_Higgs_21[a].resize(NQuarks);
-    for (std::size_t b = 0; b < NQuarks; b++)
-    {
-      Couplings_Quark_Higgs_22[a][b].resize(NHiggs);
-      Couplings_Quark_Higgs_21[a][b].resize(NHiggs);
-      for (std::size_t i = 0; i < NHiggs; i++)
-        Couplings_Quark_Higgs_22[a][b][i].resize(NHiggs);
-    }
-  }
+  return;
+}
 
-  Couplings_Lepton_Higgs_22.resize(NLepton);
-  Couplings_Lepton_Higgs_21.resize(NLepton);
-  for (std::size_t a = 0; a < NLepton; a++)
+std::vector<double> Class_Potential_Origin::WeinbergFirstDerivative() const
+{
+  std::vector<double> res;
+  if (!CalcCouplingsdone)
   {
-    Couplings_Lepton_Higgs_22[a].resize(NLepton);
-    Couplings_Lepton_Higgs_21[a].resize(NLepton);
-    for (std::size_t b = 0; b < NLepton; b++)
-    {
-      Couplings_Lepton_Higgs_22[a][b].resize(NHiggs);
-      Couplings_Lepton_Higgs_21[a][b].resize(NHiggs);
-      for (std::size_t i = 0; i < NHiggs; i++)
-        Couplings_Lepton_Higgs_22[a][b][i].resize(NHiggs);
-    }
+    //        CalculatePhysicalCouplings();
+    std::string retmes = __func__;
+    retmes += " tries to use Physical couplings but they are not initialised.";
+    throw std::runtime_error(retmes);
   }
+  const double NumZero = std::pow(10, -10);
+  VectorXd FirstDeriv(NHiggs), FirstDerivGauge(NHiggs), FirstDerivHiggs(NHiggs),
+      FirstDerivQuark(NHiggs), FirstDerivLepton(NHiggs);
+  FirstDeriv       = VectorXd::Zero(NHiggs);
+  FirstDerivGauge  = VectorXd::Zero(NHiggs);
+  FirstDerivHiggs  = VectorXd::Zero(NHiggs);
+  FirstDerivQuark  = VectorXd::Zero(NHiggs);
+  FirstDerivLepton = VectorXd::Zero(NHiggs);
+  double epsilon   = 1.0 / (16 * M_PI * M_PI);
 
   for (std::size_t i = 0; i < NHiggs; i++)
   {
-    for (std::size_t j = 0; j < NHiggs; j++)
+    for (std::size_t a = 0; a < NGauge; a++)
     {
-      for (std::size_t k = 0; k < NHiggs; k++)
-      {
-        Couplings_Higgs_Triple[i][j][k] = 0;
-        for (std::size_t is = 0; is < NHiggs; is++)
-        {
-          for (std::size_t js = 0; js < NHiggs; js++)
-          {
-            for (std::size_t ks = 0; ks < NHiggs; ks++)
-            {
-              Couplings_Higgs_Triple[i][j][k] +=
-                  HiggsRot(i, is) * HiggsRot(j, js) * HiggsRot(k, ks) *
-                  LambdaHiggs_3[is][js][ks];
-            }
-          }
-        }
-        for (std::size_t l = 0; l < NHiggs; l++)
-        {
-          Couplings_Higgs_Quartic[i][j][k][l] = 0;
-          for (std::size_t is = 0; is < NHiggs; is++)
-          {
-            for (std::size_t js = 0; js < NHiggs; js++)
-            {
-              for (std::size_t ks = 0; ks < NHiggs; ks++)
-              {
-                for (std::size_t ls = 0; ls < NHiggs; ls++)
-                {
-                  Couplings_Higgs_Quartic[i][j][k][l] +=
-                      HiggsRot(i, is) * HiggsRot(j, js) * HiggsRot(k, ks) *
-                      HiggsRot(l, ls) * Curvature_Higgs_L4[is][js][ks][ls];
-                }
-              }
-            }
-          }
-        }
-      }
-    }
-  }
-
-  // Gauge Rot
-  for (std::size_t a = 0; a < NGauge; a++)
-  {
-    for (std::size_t b = 0; b < NGauge; b++)
-    {
-      for (std::size_t i = 0; i < NHiggs; i++)
-      {
-        Couplings_Gauge_Higgs_21[a][b][i] = 0;
-        for (std::size_t as = 0; as < NGauge; as++)
-        {
-          for (std::size_t bs = 0; bs < NGauge; bs++)
-          {
-            for (std::size_t is = 0; is < NHiggs; is++)
-              Couplings_Gauge_Higgs_21[a][b][i] +=
-                  GaugeRot(a, as) * GaugeRot(b, bs) * HiggsRot(i, is) *
-                  LambdaGauge_3[as][bs][is];
-          }
-        }
-        for (std::size_t j = 0; j < NHiggs; j++)
-        {
-          Couplings_Gauge_Higgs_22[a][b][i][j] = 0;
-          for (std::size_t as = 0; as < NGauge; as++)
-          {
-            for (std::size_t bs = 0; bs < NGauge; bs++)
-            {
-              for (std::size_t is = 0; is < NHiggs; is++)
-              {
-                for (std::size_t js = 0; js < NHiggs; js++)
-                {
-                  double RotFac = GaugeRot(a, as) * GaugeRot(b, bs) *
-                                  HiggsRot(i, is) * HiggsRot(j, js);
-                  Couplings_Gauge_Higgs_22[a][b][i][j] +=
-                      RotFac * Curvature_Gauge_G2H2[as][bs][is][js];
-                }
-              }
-            }
-          }
-        }
-      }
-    }
-  }
-
-  // Quark
-
-  for (std::size_t a = 0; a < NQuarks; a++)
-  {
-    for (std::size_t b = 0; b < NQuarks; b++)
-    {
-      for (std::size_t i = 0; i < NHiggs; i++)
-      {
-        Couplings_Quark_Higgs_21[a][b][i] = 0;
-        for (std::size_t as = 0; as < NQuarks; as++)
-        {
-          for (std::size_t bs = 0; bs < NQuarks; bs++)
-          {
-            for (std::size_t is = 0; is < NHiggs; is++)
-            {
-              double RotFac =
-                  QuarkRot(a, as) * QuarkRot(b, bs) * HiggsRot(i, is);
-              Couplings_Quark_Higgs_21[a][b][i] +=
-                  RotFac * LambdaQuark_3[as][bs][is];
-            }
-          }
-        }
-        for (std::size_t j = 0; j < NHiggs; j++)
-        {
-          Couplings_Quark_Higgs_22[a][b][i][j] = 0;
-          for (std::size_t as = 0; as < NQuarks; as++)
-          {
-            for (std::size_t bs = 0; bs < NQuarks; bs++)
-            {
-              for (std::size_t is = 0; is < NHiggs; is++)
-              {
-                for (std::size_t js = 0; js < NHiggs; js++)
-                {
-                  double RotFac = QuarkRot(a, as) * QuarkRot(b, bs) *
-                                  HiggsRot(i, is) * HiggsRot(j, js);
-                  Couplings_Quark_Higgs_22[a][b][i][j] +=
-                      RotFac * LambdaQuark_4[as][bs][is][js];
-                }
-              }
-            }
-          }
-        }
-      }
-    }
-  }
-
-  // Lepton
-
-  for (std::size_t a = 0; a < NLepton; a++)
-  {
-    for (std::size_t b = 0; b < NLepton; b++)
-    {
-      for (std::size_t i = 0; i < NHiggs; i++)
-      {
-        Couplings_Lepton_Higgs_21[a][b][i] = 0;
-        for (std::size_t as = 0; as < NLepton; as++)
-        {
-          for (std::size_t bs = 0; bs < NLepton; bs++)
-          {
-            for (std::size_t is = 0; is < NHiggs; is++)
-            {
-              double RotFac = LepRot(a, as) * LepRot(b, bs) * HiggsRot(i, is);
-              Couplings_Lepton_Higgs_21[a][b][i] +=
-                  RotFac * LambdaLepton_3[as][bs][is];
-            }
-          }
-        }
-        for (std::size_t j = 0; j < NHiggs; j++)
-        {
-          Couplings_Lepton_Higgs_22[a][b][i][j] = 0;
-          for (std::size_t as = 0; as < NLepton; as++)
-          {
-            for (std::size_t bs = 0; bs < NLepton; bs++)
-            {
-              for (std::size_t is = 0; is < NHiggs; is++)
-              {
-                for (std::size_t js = 0; js < NHiggs; js++)
-                {
-                  double RotFac = LepRot(a, as) * LepRot(b, bs) *
-                                  HiggsRot(i, is) * HiggsRot(j, js);
-                  Couplings_Lepton_Higgs_22[a][b][i][j] +=
-                      RotFac * LambdaLepton_4[as][bs][is][js];
-                }
-              }
-            }
-          }
-        }
-      }
-    }
-  }
-
-  for (std::size_t i = 0; i < NHiggs; i++)
-  {
-    for (std::size_t j = 0; j < NHiggs; j++)
-    {
-      HiggsRotationMatrix[i][j] = HiggsRot(i, j);
-    }
-  }
-
-  CalcCouplingsdone = true;
-
-  return;
-}
-
-std::vector<double> Class_Potential_Origin::WeinbergFirstDerivative() const
-{
-  std::vector<double> res;
-  if (!CalcCouplingsdone)
-  {
-    //        CalculatePhysicalCouplings();
-    std::string retmes = __func__;
-    retmes += " tries to use Physical couplings but they are not initialised.";
-    throw std::runtime_error(retmes);
-  }
-  const double NumZero = std::pow(10, -10);
-  VectorXd FirstDeriv(NHiggs), FirstDerivGauge(NHiggs), FirstDerivHiggs(NHiggs),
-      FirstDerivQuark(NHiggs), FirstDerivLepton(NHiggs);
-  FirstDeriv       = VectorXd::Zero(NHiggs);
-  FirstDerivGauge  = VectorXd::Zero(NHiggs);
-  FirstDerivHiggs  = VectorXd::Zero(NHiggs);
-  FirstDerivQuark  = VectorXd::Zero(NHiggs);
-  FirstDerivLepton = VectorXd::Zero(NHiggs);
-  double epsilon   = 1.0 / (16 * M_PI * M_PI);
-
-  for (std::size_t i = 0; i < NHiggs; i++)
-  {
-    for (std::size_t a = 0; a < NGauge; a++)
-    {
-      if (MassSquaredGauge[a] != 0)
+      if (MassSquaredGauge[a] != 0)
       {
         FirstDerivGauge[i] +=
             MassSquaredGauge[a] * Couplings_Gauge_Higgs_21[a][a][i] *
@@ -2336,6 +2364,12 @@ MatrixXd Class_Potential_Origin::HiggsMassMatrix(const std::vector<double> &v,
         std::to_string(NHiggs) + std::string(".");
     throw std::runtime_error(ErrorString);
   }
+  if (v.size() == nVEV and nVEV != NHiggs and diff == 0 and
+      SparseCurvatureDone)
+  {
+    FillHiggsMassMatrix(v, Temp, res);
+    return res;
+  }
   if (v.size() == nVEV and nVEV != NHiggs)
   {
     std::stringstream ss;
@@ -2361,60 +2395,142 @@ MatrixXd Class_Potential_Origin::HiggsMassMatrix(const std::vector<double> &v,
 
   if (diff == 0)
   {
-    for (std::size_t i = 0; i < NHiggs; i++)
+    FillHiggsMassMatrix(v, Temp, res);
+  }
+  else if (static_cast<size_t>(diff) <= NHiggs and diff > 0)
+  {
+    std::size_t x0 = diff - 1;
+    if (UseMassMatricesSimplified)
     {
-      for (std::size_t j = i; j < NHiggs; j++)
+      HiggsMassMatrixDerivativeSimplified(v, x0, res);
+    }
+    else if (SparseCurvatureDone)
+    {
+      res            = MatrixXd::Zero(NHiggs, NHiggs);
+      const auto &L3 = SparseCurvature.HiggsL3;
+      const auto &L4 = SparseCurvature.HiggsL4;
+      for (std::size_t n = 0; n < L3.size(); n++)
       {
-        res(i, j) = Curvature_Higgs_L2[i][j];
-        for (std::size_t k = 0; k < NHiggs; k++)
+        const auto &Index = L3.Indices[n];
+        if (Index[2] != x0) continue;
+        res(Index[0], Index[1]) += L3.Values[n];
+      }
+      for (std::size_t n = 0; n < L4.size(); n++)
+      {
+        const auto &Index = L4.Indices[n];
+        if (Index[2] != x0) continue;
+        res(Index[0], Index[1]) += L4.Values[n] * v[Index[3]];
+      }
+    }
+    else
+    {
+      for (std::size_t i = 0; i < NHiggs; i++)
+      {
+        for (std::size_t j = 0; j < NHiggs; j++)
         {
-          res(i, j) += Curvature_Higgs_L3[i][j][k] * v[k];
-          for (std::size_t l = 0; l < NHiggs; l++)
+          res(i, j) = Curvature_Higgs_L3[i][j][x0];
+          for (std::size_t k = 0; k < NHiggs; k++)
           {
-            res(i, j) += 0.5 * Curvature_Higgs_L4[i][j][k][l] * v[k] * v[l];
+            res(i, j) += Curvature_Higgs_L4[i][j][x0][k] * v[k];
           }
         }
+      }
+    }
+  }
+  else if (diff == -1)
+  {
+    for (std::size_t i = 0; i < NHiggs; i++)
+    {
+      for (std::size_t j = 0; j < NHiggs; j++)
+      {
+        res(i, j) = 2 * DebyeHiggs[i][j] * Temp;
+      }
+    }
+  }
+  return res;
+}
 
-        if (Temp != 0)
+void Class_Potential_Origin::FillHiggsMassMatrix(const std::vector<double> &v,
+                                                 double Temp,
+                                                 MatrixXd &res) const
+{
+  if (v.size() == nVEV and nVEV != NHiggs)
+  {
+    SparseCurvature.HiggsVEV.EvaluateInto(v, res);
+    if (Temp != 0)
+    {
+      for (std::size_t i = 0; i < NHiggs; i++)
+      {
+        for (std::size_t j = 0; j < NHiggs; j++)
         {
           res(i, j) += DebyeHiggs[i][j] * std::pow(Temp, 2);
         }
       }
     }
-    for (std::size_t i{1}; i < NHiggs; ++i)
+    return;
+  }
+
+  res.resize(NHiggs, NHiggs);
+  if (UseMassMatricesSimplified)
+  {
+    HiggsMassMatrixSimplified(v, res);
+  }
+  else if (SparseCurvatureDone)
+  {
+    // only the upper triangle is filled, it is mirrored below
+    res            = SparseCurvature.HiggsL2;
+    const auto &L3 = SparseCurvature.HiggsL3;
+    const auto &L4 = SparseCurvature.HiggsL4;
+    for (std::size_t n = 0; n < L3.size(); n++)
     {
-      for (std::size_t j{0}; j < i; ++j)
-      {
-        res(i, j) = res(j, i);
-      }
+      const auto &Index = L3.Indices[n];
+      if (Index[0] > Index[1]) continue;
+      res(Index[0], Index[1]) += L3.Values[n] * v[Index[2]];
+    }
+    for (std::size_t n = 0; n < L4.size(); n++)
+    {
+      const auto &Index = L4.Indices[n];
+      if (Index[0] > Index[1]) continue;
+      res(Index[0], Index[1]) +=
+          0.5 * L4.Values[n] * v[Index[2]] * v[Index[3]];
     }
   }
-  else if (static_cast<size_t>(diff) <= NHiggs and diff > 0)
+  else
   {
-    std::size_t x0 = diff - 1;
     for (std::size_t i = 0; i < NHiggs; i++)
     {
-      for (std::size_t j = 0; j < NHiggs; j++)
+      for (std::size_t j = i; j < NHiggs; j++)
       {
-        res(i, j) = Curvature_Higgs_L3[i][j][x0];
+        res(i, j) = Curvature_Higgs_L2[i][j];
         for (std::size_t k = 0; k < NHiggs; k++)
         {
-          res(i, j) += Curvature_Higgs_L4[i][j][x0][k] * v[k];
+          res(i, j) += Curvature_Higgs_L3[i][j][k] * v[k];
+          for (std::size_t l = 0; l < NHiggs; l++)
+          {
+            res(i, j) += 0.5 * Curvature_Higgs_L4[i][j][k][l] * v[k] * v[l];
+          }
         }
       }
     }
   }
-  else if (diff == -1)
+
+  if (Temp != 0)
   {
     for (std::size_t i = 0; i < NHiggs; i++)
     {
-      for (std::size_t j = 0; j < NHiggs; j++)
+      for (std::size_t j = i; j < NHiggs; j++)
       {
-        res(i, j) = 2 * DebyeHiggs[i][j] * Temp;
+        res(i, j) += DebyeHiggs[i][j] * std::pow(Temp, 2);
       }
     }
   }
-  return res;
+  for (std::size_t i{1}; i < NHiggs; ++i)
+  {
+    for (std::size_t j{0}; j < i; ++j)
+    {
+      res(i, j) = res(j, i);
+    }
+  }
 }
 
 std::vector<double>
@@ -2522,7 +2638,8 @@ Class_Potential_Origin::GaugeMassesSquared(const std::vector<double> &v,
         std::to_string(NHiggs) + std::string(".");
     throw std::runtime_error(ErrorString);
   }
-  if (v.size() == nVEV and nVEV != NHiggs)
+  if (v.size() == nVEV and nVEV != NHiggs and
+      not(diff == 0 and SparseCurvatureDone))
   {
     std::stringstream ss;
     ss << __func__
@@ -2545,34 +2662,8 @@ Class_Potential_Origin::GaugeMassesSquared(const std::vector<double> &v,
     retmes += "was called while the model was not initialised correctly.\n";
     throw std::runtime_error(retmes);
   }
-  MatrixXd MassMatrix(NGauge, NGauge);
-  double ZeroMass = std::pow(10, -5);
-  for (std::size_t a = 0; a < NGauge; a++)
-  {
-    for (std::size_t b = 0; b < NGauge; b++)
-    {
-      MassMatrix(a, b) = 0;
-      for (std::size_t i = 0; i < NHiggs; i++)
-      {
-        for (std::size_t j = 0; j < NHiggs; j++)
-          MassMatrix(a, b) +=
-              0.5 * Curvature_Gauge_G2H2[a][b][i][j] * v.at(i) * v.at(j);
-      }
-
-      if (Temp != 0)
-      {
-        MassMatrix(a, b) += DebyeGauge[a][b] * std::pow(Temp, 2);
-      }
-    }
-  }
-
-  for (std::size_t a{1}; a < NGauge; ++a)
-  {
-    for (std::size_t b{0}; b < a; ++b)
-    {
-      MassMatrix(a, b) = MassMatrix(b, a);
-    }
-  }
+  MatrixXd MassMatrix = GaugeMassMatrix(v, Temp);
+  double ZeroMass     = std::pow(10, -5);
 
   if (diff == 0)
   {
@@ -2591,13 +2682,20 @@ Class_Potential_Origin::GaugeMassesSquared(const std::vector<double> &v,
   {
     std::size_t i = diff - 1;
     MatrixXd Diff(NGauge, NGauge);
-    Diff = MatrixXd::Zero(NGauge, NGauge);
-    for (std::size_t a = 0; a < NGauge; a++)
+    if (UseMassMatricesSimplified)
     {
-      for (std::size_t b = 0; b < NGauge; b++)
+      GaugeMassMatrixDerivativeSimplified(v, i, Diff);
+    }
+    else
+    {
+      Diff = MatrixXd::Zero(NGauge, NGauge);
+      for (std::size_t a = 0; a < NGauge; a++)
       {
-        for (std::size_t j = 0; j < NHiggs; j++)
-          Diff(a, b) += Curvature_Gauge_G2H2[a][b][i][j] * v[j];
+        for (std::size_t b = 0; b < NGauge; b++)
+        {
+          for (std::size_t j = 0; j < NHiggs; j++)
+            Diff(a, b) += Curvature_Gauge_G2H2[a][b][i][j] * v[j];
+        }
       }
     }
     MatrixXcd MassCast(NGauge, NGauge);
@@ -2627,13 +2725,87 @@ Class_Potential_Origin::GaugeMassesSquared(const std::vector<double> &v,
   return res;
 }
 
-std::vector<double>
-Class_Potential_Origin::QuarkMassesSquared(const std::vector<double> &v,
-                                           const int &diff) const
+MatrixXd Class_Potential_Origin::GaugeMassMatrix(const std::vector<double> &v,
+                                                 double Temp) const
 {
-  std::vector<double> res;
-  MatrixXcd MassMatrix(NQuarks, NQuarks), MIJ(NQuarks, NQuarks);
-  MIJ             = QuarkMassMatrix(v);
+  if (v.size() == nVEV and nVEV != NHiggs and not SparseCurvatureDone)
+  {
+    return GaugeMassMatrix(MinimizeOrderVEV(v), Temp);
+  }
+  MatrixXd MassMatrix(NGauge, NGauge);
+  FillGaugeMassMatrix(v, Temp, MassMatrix);
+  return MassMatrix;
+}
+
+void Class_Potential_Origin::FillGaugeMassMatrix(const std::vector<double> &v,
+                                                 double Temp,
+                                                 MatrixXd &MassMatrix) const
+{
+  if (v.size() == nVEV and nVEV != NHiggs)
+  {
+    SparseCurvature.GaugeVEV.EvaluateInto(v, MassMatrix);
+  }
+  else if (UseMassMatricesSimplified)
+  {
+    MassMatrix.resize(NGauge, NGauge);
+    GaugeMassMatrixSimplified(v, MassMatrix);
+  }
+  else if (SparseCurvatureDone)
+  {
+    MassMatrix.setZero(NGauge, NGauge);
+    const auto &G2H2 = SparseCurvature.GaugeG2H2;
+    for (std::size_t n = 0; n < G2H2.size(); n++)
+    {
+      const auto &Index = G2H2.Indices[n];
+      if (Index[0] > Index[1]) continue;
+      MassMatrix(Index[0], Index[1]) +=
+          0.5 * G2H2.Values[n] * v.at(Index[2]) * v.at(Index[3]);
+    }
+  }
+  else
+  {
+    MassMatrix.setZero(NGauge, NGauge);
+    for (std::size_t a = 0; a < NGauge; a++)
+    {
+      for (std::size_t b = a; b < NGauge; b++)
+      {
+        for (std::size_t i = 0; i < NHiggs; i++)
+        {
+          for (std::size_t j = 0; j < NHiggs; j++)
+            MassMatrix(a, b) +=
+                0.5 * Curvature_Gauge_G2H2[a][b][i][j] * v.at(i) * v.at(j);
+        }
+      }
+    }
+  }
+
+  if (Temp != 0)
+  {
+    for (std::size_t a = 0; a < NGauge; a++)
+    {
+      for (std::size_t b = a; b < NGauge; b++)
+      {
+        MassMatrix(a, b) += DebyeGauge[a][b] * std::pow(Temp, 2);
+      }
+    }
+  }
+
+  for (std::size_t a{1}; a < NGauge; ++a)
+  {
+    for (std::size_t b{0}; b < a; ++b)
+    {
+      MassMatrix(a, b) = MassMatrix(b, a);
+    }
+  }
+}
+
+std::vector<double>
+Class_Potential_Origin::QuarkMassesSquared(const std::vector<double> &v,
+                                           const int &diff) const
+{
+  std::vector<double> res;
+  MatrixXcd MassMatrix(NQuarks, NQuarks), MIJ(NQuarks, NQuarks);
+  MIJ             = QuarkMassMatrix(v);
   double ZeroMass = std::pow(10, -10);
 
   MassMatrix = MIJ.conjugate() * MIJ;
@@ -2654,15 +2826,24 @@ Class_Potential_Origin::QuarkMassesSquared(const std::vector<double> &v,
   {
     std::size_t m = diff - 1;
     MatrixXcd Diff(NQuarks, NQuarks);
-    Diff = MatrixXcd::Zero(NQuarks, NQuarks);
-    for (std::size_t a = 0; a < NQuarks; a++)
+    if (UseMassMatricesSimplified)
+    {
+      MatrixXcd DiffMIJ(NQuarks, NQuarks);
+      QuarkMassMatrixDerivativeSimplified(v, m, DiffMIJ);
+      Diff = DiffMIJ.conjugate() * MIJ + MIJ.conjugate() * DiffMIJ;
+    }
+    else
     {
-      for (std::size_t b = 0; b < NQuarks; b++)
+      Diff = MatrixXcd::Zero(NQuarks, NQuarks);
+      for (std::size_t a = 0; a < NQuarks; a++)
       {
-        for (std::size_t i = 0; i < NQuarks; i++)
+        for (std::size_t b = 0; b < NQuarks; b++)
         {
-          Diff(a, b) += std::conj(Curvature_Quark_F2H1[a][i][m]) * MIJ(i, b);
-          Diff(a, b) += std::conj(MIJ(a, i)) * Curvature_Quark_F2H1[i][b][m];
+          for (std::size_t i = 0; i < NQuarks; i++)
+          {
+            Diff(a, b) += std::conj(Curvature_Quark_F2H1[a][i][m]) * MIJ(i, b);
+            Diff(a, b) += std::conj(MIJ(a, i)) * Curvature_Quark_F2H1[i][b][m];
+          }
         }
       }
     }
@@ -2753,14 +2934,25 @@ Class_Potential_Origin::LeptonMassesSquared(const std::vector<double> &v,
 
     auto k         = diff - 1;
     MatrixXcd Diff = MatrixXcd::Zero(NLepton, NLepton);
-    for (std::size_t I{0}; I < NLepton; ++I)
+    if (UseMassMatricesSimplified)
+    {
+      MatrixXcd DiffMIJ(NLepton, NLepton);
+      LeptonMassMatrixDerivativeSimplified(v, k, DiffMIJ);
+      Diff = DiffMIJ.conjugate() * MIJ + MIJ.conjugate() * DiffMIJ;
+    }
+    else
     {
-      for (std::size_t J{0}; J < NLepton; ++J)
+      for (std::size_t I{0}; I < NLepton; ++I)
       {
-        for (std::size_t L{0}; L < NLepton; ++L)
+        for (std::size_t J{0}; J < NLepton; ++J)
         {
-          Diff(I, J) += std::conj(Curvature_Lepton_F2H1[I][L][k]) * MIJ(L, J);
-          Diff(I, J) += std::conj(MIJ(I, L)) * Curvature_Lepton_F2H1[L][J][k];
+          for (std::size_t L{0}; L < NLepton; ++L)
+          {
+            Diff(I, J) +=
+                std::conj(Curvature_Lepton_F2H1[I][L][k]) * MIJ(L, J);
+            Diff(I, J) +=
+                std::conj(MIJ(I, L)) * Curvature_Lepton_F2H1[L][J][k];
+          }
         }
       }
     }
@@ -2823,12 +3015,91 @@ Class_Potential_Origin::LeptonMassesSquared(const std::vector<double> &v,
   return res;
 }
 
+namespace
+{
+/**
+ * Evaluates the polynomial
+ * L1^i v_i + 1/2 L2^{ij} v_i v_j + 1/6 L3^{ijk} v_i v_j v_k
+ * + 1/24 L4^{ijkl} v_i v_j v_k v_l
+ * or its derivative with respect to the field diff - 1 for a VEV configuration
+ * given in the nVEV dimensional VEV subspace
+ */
+double VEVSubspacePolynomial(
+    const std::vector<std::size_t> &VevOrder,
+    const std::vector<double> &L1,
+    const std::vector<std::vector<double>> &L2,
+    const std::vector<std::vector<std::vector<double>>> &L3,
+    const std::vector<std::vector<std::vector<std::vector<double>>>> &L4,
+    const std::vector<double> &v,
+    int diff)
+{
+  const std::size_t nVEV = VevOrder.size();
+  double res             = 0;
+  if (diff == 0)
+  {
+    for (std::size_t a = 0; a < nVEV; a++)
+    {
+      if (v[a] == 0) continue;
+      const auto i = VevOrder[a];
+      res += L1[i] * v[a];
+      for (std::size_t b = 0; b < nVEV; b++)
+      {
+        if (v[b] == 0) continue;
+        const auto j = VevOrder[b];
+        res += 0.5 * L2[i][j] * v[a] * v[b];
+        for (std::size_t c = 0; c < nVEV; c++)
+        {
+          const auto k = VevOrder[c];
+          res += 1.0 / 6.0 * L3[i][j][k] * v[a] * v[b] * v[c];
+          for (std::size_t d = 0; d < nVEV; d++)
+          {
+            res += 1.0 / 24.0 * L4[i][j][k][VevOrder[d]] * v[a] * v[b] *
+                   v[c] * v[d];
+          }
+        }
+      }
+    }
+  }
+  else if (diff > 0 and static_cast<std::size_t>(diff) <= L1.size())
+  {
+    const std::size_t i = diff - 1;
+    res                 = L1[i];
+    for (std::size_t b = 0; b < nVEV; b++)
+    {
+      const auto j = VevOrder[b];
+      res += L2[i][j] * v[b];
+      for (std::size_t c = 0; c < nVEV; c++)
+      {
+        const auto k = VevOrder[c];
+        res += 0.5 * L3[i][j][k] * v[b] * v[c];
+        for (std::size_t d = 0; d < nVEV; d++)
+        {
+          res += 1.0 / 6.0 * L4[i][j][k][VevOrder[d]] * v[b] * v[c] * v[d];
+        }
+      }
+    }
+  }
+  return res;
+}
+} // namespace
+
 double Class_Potential_Origin::VTree(const std::vector<double> &v,
                                      int diff,
                                      bool ForceExplicitCalculation) const
 {
   double res = 0;
 
+  if (v.size() == nVEV and nVEV != NHiggs)
+  {
+    return VEVSubspacePolynomial(VevOrder,
+                                 Curvature_Higgs_L1,
+                                 Curvature_Higgs_L2,
+                                 Curvature_Higgs_L3,
+                                 Curvature_Higgs_L4,
+                                 v,
+                                 diff);
+  }
+
   if (not ForceExplicitCalculation)
   {
     res = VTreeSimplified(v);
@@ -2895,6 +3166,16 @@ double Class_Potential_Origin::CounterTerm(const std::vector<double> &v,
 {
 
   double res = 0;
+  if (v.size() == nVEV and nVEV != NHiggs)
+  {
+    return VEVSubspacePolynomial(VevOrder,
+                                 Curvature_Higgs_CT_L1,
+                                 Curvature_Higgs_CT_L2,
+                                 Curvature_Higgs_CT_L3,
+                                 Curvature_Higgs_CT_L4,
+                                 v,
+                                 diff);
+  }
   if (not ForceExplicitCalculation and UseVCounterSimplified)
   {
     res = VCounterSimplified(v);
@@ -2960,6 +3241,10 @@ double Class_Potential_Origin::VEff(const std::vector<double> &v,
         std::to_string(NHiggs) + std::string(".");
     throw std::runtime_error(ErrorString);
   }
+  if (diff == 0)
+  {
+    return VEff(v, Temp, GetThreadWorkspace(), Order);
+  }
   if (v.size() == nVEV and nVEV != NHiggs)
   {
     std::stringstream ss;
@@ -2973,7 +3258,7 @@ double Class_Potential_Origin::VEff(const std::vector<double> &v,
     Logger::Write(LoggingLevel::Default, ss.str());
     std::vector<double> Transformedv;
     Transformedv = MinimizeOrderVEV(v);
-    return VEff(Transformedv, Temp, diff);
+    return VEff(Transformedv, Temp, diff, Order);
   }
 
   double resOut = 0;
@@ -2988,10 +3273,226 @@ double Class_Potential_Origin::VEff(const std::vector<double> &v,
   return resOut;
 }
 
+double Class_Potential_Origin::VEff(const std::vector<double> &v,
+                                    double Temp,
+                                    EvaluationWorkspace &Workspace,
+                                    int Order) const
+{
+  if (v.size() != nVEV and v.size() != NHiggs)
+  {
+    std::string ErrorString =
+        std::string("You have called ") + std::string(__func__) +
+        std::string(
+            " with an invalid vev configuration. Your vev is of dimension ") +
+        std::to_string(v.size()) + std::string(" and it should be ") +
+        std::to_string(NHiggs) + std::string(".");
+    throw std::runtime_error(ErrorString);
+  }
+  Workspace.Resize(NHiggs, NGauge, NQuarks, NLepton, nVEV);
+
+  double resOut = VTree(v);
+  if (Order != 0 and not UseTreeLevel)
+  {
+    resOut += CounterTerm(v);
+    resOut += V1Loop(v, Temp, Workspace);
+  }
+  return resOut;
+}
+
+std::vector<double>
+Class_Potential_Origin::VEffMultiT(const std::vector<double> &v,
+                                   const std::vector<double> &Temps,
+                                   int Order) const
+{
+  std::vector<double> res;
+  VEffMultiT(v, Temps, res, GetThreadWorkspace(), Order);
+  return res;
+}
+
+void Class_Potential_Origin::VEffMultiT(const std::vector<double> &v,
+                                        const std::vector<double> &Temps,
+                                        std::vector<double> &res,
+                                        EvaluationWorkspace &Workspace,
+                                        int Order) const
+{
+  if (v.size() != nVEV and v.size() != NHiggs)
+  {
+    std::string ErrorString =
+        std::string("You have called ") + std::string(__func__) +
+        std::string(
+            " with an invalid vev configuration. Your vev is of dimension ") +
+        std::to_string(v.size()) + std::string(" and it should be ") +
+        std::to_string(NHiggs) + std::string(".");
+    throw std::runtime_error(ErrorString);
+  }
+  Workspace.Resize(NHiggs, NGauge, NQuarks, NLepton, nVEV);
+
+  double TemperatureIndependent = VTree(v);
+  if (Order == 0 or UseTreeLevel)
+  {
+    res.assign(Temps.size(), TemperatureIndependent);
+    return;
+  }
+  TemperatureIndependent += CounterTerm(v);
+  V1LoopMultiT(v, Temps, res, Workspace);
+  for (auto &Value : res)
+  {
+    Value += TemperatureIndependent;
+  }
+}
+
+void Class_Potential_Origin::VEffBatch(const Eigen::MatrixXd &Points,
+                                       double Temp,
+                                       std::vector<double> &res,
+                                       bool UseMultithreading,
+                                       int Order) const
+{
+  res.resize(Points.rows());
+  auto Evaluate = [&](Eigen::Index begin, Eigen::Index end)
+  {
+    auto &Workspace = GetThreadWorkspace();
+    std::vector<double> v(Points.cols());
+    for (Eigen::Index row = begin; row < end; row++)
+    {
+      for (Eigen::Index col = 0; col < Points.cols(); col++)
+      {
+        v[col] = Points(row, col);
+      }
+      res[row] = VEff(v, Temp, Workspace, Order);
+    }
+  };
+
+  // Every task of the thread pool gets at least MinPointsPerTask
+  // configurations to keep the scheduling overhead small
+  const Eigen::Index MinPointsPerTask = 16;
+  Eigen::Index NTasks                 = 1;
+  if (UseMultithreading)
+  {
+    NTasks = std::min<Eigen::Index>(ThreadPool::Global().Size(),
+                                    Points.rows() / MinPointsPerTask);
+  }
+  if (NTasks <= 1)
+  {
+    Evaluate(0, Points.rows());
+    return;
+  }
+
+  TaskGroup Tasks;
+  for (Eigen::Index t = 0; t < NTasks; t++)
+  {
+    Tasks.Run([&, t]()
+              { Evaluate(t * Points.rows() / NTasks,
+                         (t + 1) * Points.rows() / NTasks); });
+  }
+  Tasks.Wait();
+}
+
+EvaluationWorkspace &Class_Potential_Origin::GetThreadWorkspace() const
+{
+  // One workspace per set of dimensions, a thread alternating between models
+  // of different sizes then keeps the buffers of each of them
+  thread_local std::map<std::array<std::size_t, 5>, EvaluationWorkspace>
+      Workspaces;
+  auto &Workspace = Workspaces[{{NHiggs, NGauge, NQuarks, NLepton, nVEV}}];
+  Workspace.Resize(NHiggs, NGauge, NQuarks, NLepton, nVEV);
+  return Workspace;
+}
+
+namespace
+{
+/**
+ * Expands the nVEV dimensional VEV configuration v into Workspace.VEV, see
+ * MinimizeOrderVEV(), and returns it. If v already has NHiggs entries it is
+ * returned unchanged.
+ */
+const std::vector<double> &ExpandVEV(const std::vector<std::size_t> &VevOrder,
+                                     const std::vector<double> &v,
+                                     EvaluationWorkspace &Workspace)
+{
+  if (v.size() == Workspace.NHiggs) return v;
+  std::fill(Workspace.VEV.begin(), Workspace.VEV.end(), 0);
+  for (std::size_t a = 0; a < VevOrder.size(); a++)
+  {
+    Workspace.VEV[VevOrder[a]] = v[a];
+  }
+  return Workspace.VEV;
+}
+
+/**
+ * Calculates the eigenvalues of the hermitian matrix Matrix. Inside the VEV
+ * subspace they are calculated block by block with BlockSolver, otherwise with
+ * Solver.
+ */
+template <typename SolverType, typename BlockSolverType, typename MatrixType>
+const VectorXd &MassEigenvalues(bool InVEVSubspace,
+                                SolverType &Solver,
+                                BlockSolverType &BlockSolver,
+                                const MatrixType &Matrix,
+                                const MatrixBlocks &Blocks)
+{
+  if (InVEVSubspace and not Blocks.IsTrivial())
+  {
+    BlockSolver.compute(Matrix, Blocks);
+    return BlockSolver.eigenvalues();
+  }
+  Solver.compute(Matrix, EigenvaluesOnly);
+  return Solver.eigenvalues();
+}
+
+/**
+ * Eigenvalues and eigenvectors of a mass matrix, see MassEigensystem()
+ */
+template <typename MatrixType> struct Eigensystem
+{
+  const VectorXd &Eigenvalues;
+  const MatrixType &Eigenvectors;
+};
+
+/**
+ * Calculates the eigenvalues and eigenvectors of the hermitian matrix Matrix,
+ * see MassEigenvalues()
+ */
+template <typename SolverType, typename BlockSolverType, typename MatrixType>
+Eigensystem<MatrixType> MassEigensystem(bool InVEVSubspace,
+                                        SolverType &Solver,
+                                        BlockSolverType &BlockSolver,
+                                        const MatrixType &Matrix,
+                                        const MatrixBlocks &Blocks)
+{
+  if (InVEVSubspace and not Blocks.IsTrivial())
+  {
+    BlockSolver.compute(Matrix, Blocks, ComputeEigenvectors);
+    return {BlockSolver.eigenvalues(), BlockSolver.eigenvectors()};
+  }
+  Solver.compute(Matrix, ComputeEigenvectors);
+  return {Solver.eigenvalues(), Solver.eigenvectors()};
+}
+
+/**
+ * Checks if the NHiggs dimensional VEV configuration v vanishes in all
+ * NonVEVDirections, i.e. if the mass matrices have the block structure found
+ * in SetMassMatrixBlocks()
+ */
+bool IsInVEVSubspace(const std::vector<double> &v,
+                     const std::vector<std::size_t> &NonVEVDirections)
+{
+  for (const auto &i : NonVEVDirections)
+  {
+    if (v[i] != 0) return false;
+  }
+  return true;
+}
+} // namespace
+
 double Class_Potential_Origin::V1Loop(const std::vector<double> &v,
                                       double Temp,
                                       int diff) const
 {
+  if (diff == 0 and not C_UseParwani)
+  {
+    return V1Loop(v, Temp, GetThreadWorkspace());
+  }
+
   double res = 0;
 
   /**
@@ -3008,58 +3509,18 @@ double Class_Potential_Origin::V1Loop(const std::vector<double> &v,
 
   if (diff == 0)
   {
-    if (C_UseParwani)
-    {
-      for (std::size_t k = 0; k < NHiggs; k++)
-        res += boson(HiggsMassesVec[k], Temp, C_CWcbHiggs, 0);
-      for (std::size_t k = 0; k < NGauge; k++)
-        res += boson(GaugeMassesVec[k], Temp, C_CWcbGB, 0);
-      for (std::size_t k = 0; k < NGauge; k++)
-        res += 2 * boson(GaugeMassesZeroTempVec[k], Temp, C_CWcbGB, 0);
-      for (std::size_t k = 0; k < NQuarks; k++)
-        res += -6 * fermion(QuarkMassesVec[k], Temp, 0);
-      for (std::size_t k = 0; k < NLepton; k++)
-        res += -2 * fermion(LeptonMassesVec[k], Temp, 0);
-    }
-    else
-    {
-      HiggsMassesZeroTempVec = HiggsMassesSquared(v, 0);
-      for (std::size_t k = 0; k < NHiggs; k++)
-      {
-        res += boson(HiggsMassesZeroTempVec[k], Temp, C_CWcbHiggs, 0);
-      }
-      for (std::size_t k = 0; k < NGauge; k++)
-      {
-        res += 3 * boson(GaugeMassesZeroTempVec[k], Temp, C_CWcbGB, 0);
-      }
-      double AddContQuark = 0;
-      for (std::size_t k = 0; k < NQuarks; k++)
-      {
-        AddContQuark += -2 * fermion(QuarkMassesVec[k], Temp, 0);
-      }
-      res += NColour * AddContQuark;
-      for (std::size_t k = 0; k < NLepton; k++)
-      {
-        res += -2 * fermion(LeptonMassesVec[k], Temp, 0);
-      }
-
-      double VDebye = 0;
-      for (std::size_t k = 0; k < NHiggs; k++)
-      {
-        if (HiggsMassesVec[k] > 0) VDebye += std::pow(HiggsMassesVec[k], 1.5);
-        if (HiggsMassesZeroTempVec[k] > 0)
-          VDebye += -std::pow(HiggsMassesZeroTempVec[k], 1.5);
-      }
-      for (std::size_t k = 0; k < NGauge; k++)
-      {
-        if (GaugeMassesVec[k] > 0) VDebye += std::pow(GaugeMassesVec[k], 1.5);
-        if (GaugeMassesZeroTempVec[k] > 0)
-          VDebye += -std::pow(GaugeMassesZeroTempVec[k], 1.5);
-      }
-
-      VDebye *= -Temp / (12 * M_PI);
-      res += VDebye;
-    }
+    // without the Parwani resummation this is handled by the workspace
+    // overload above
+    for (std::size_t k = 0; k < NHiggs; k++)
+      res += boson(HiggsMassesVec[k], Temp, C_CWcbHiggs, 0);
+    for (std::size_t k = 0; k < NGauge; k++)
+      res += boson(GaugeMassesVec[k], Temp, C_CWcbGB, 0);
+    for (std::size_t k = 0; k < NGauge; k++)
+      res += 2 * boson(GaugeMassesZeroTempVec[k], Temp, C_CWcbGB, 0);
+    for (std::size_t k = 0; k < NQuarks; k++)
+      res += -6 * fermion(QuarkMassesVec[k], Temp, 0);
+    for (std::size_t k = 0; k < NLepton; k++)
+      res += -2 * fermion(LeptonMassesVec[k], Temp, 0);
   }
   else if (diff > 0 and static_cast<size_t>(diff) <= NHiggs)
   {
@@ -3146,78 +3607,993 @@ double Class_Potential_Origin::V1Loop(const std::vector<double> &v,
         }
       }
 
-      VDebye *= -Temp / (12 * M_PI);
-      res += VDebye;
+      VDebye *= -Temp / (12 * M_PI);
+      res += VDebye;
+    }
+  }
+  else if (diff == -1)
+  {
+    if (C_UseParwani)
+    {
+      for (std::size_t k = 0; k < NHiggs; k++)
+      {
+        res += HiggsMassesVec.at(k + NHiggs) *
+               boson(HiggsMassesVec[k], Temp, C_CWcbHiggs, 0);
+        res += boson(HiggsMassesVec[k], Temp, C_CWcbHiggs, -1);
+      }
+      for (std::size_t k = 0; k < NGauge; k++)
+      {
+        res += GaugeMassesVec.at(k + NGauge) *
+               boson(GaugeMassesVec[k], Temp, C_CWcbGB, 0);
+        res += boson(GaugeMassesVec.at(k), Temp, C_CWcbGB, -1);
+      }
+      for (std::size_t k = 0; k < NGauge; k++)
+      {
+        res += 2 * boson(GaugeMassesZeroTempVec[k], Temp, C_CWcbGB, -1);
+      }
+      for (std::size_t k = 0; k < NQuarks; k++)
+      {
+        res += -6 * fermion(QuarkMassesVec[k], Temp, -1);
+      }
+      for (std::size_t k = 0; k < NLepton; k++)
+      {
+        res += -2 * fermion(LeptonMassesVec[k], Temp, -1);
+      }
+    }
+    else
+    {
+      HiggsMassesZeroTempVec = HiggsMassesSquared(v, 0, diff);
+      for (std::size_t k = 0; k < NHiggs; k++)
+      {
+        res += boson(HiggsMassesZeroTempVec[k], Temp, C_CWcbHiggs, -1);
+      }
+      for (std::size_t k = 0; k < NGauge; k++)
+      {
+        res += 3 * boson(GaugeMassesZeroTempVec[k], Temp, C_CWcbGB, -1);
+      }
+      double AddContQuark = 0;
+      for (std::size_t k = 0; k < NQuarks; k++)
+        AddContQuark += -2 * fermion(QuarkMassesVec[k], Temp, -1);
+      for (std::size_t k = 0; k < NColour; k++)
+        res += AddContQuark;
+      for (std::size_t k = 0; k < NLepton; k++)
+        res += -2 * fermion(LeptonMassesVec[k], Temp, -1);
+
+      double VDebye = 0;
+      for (std::size_t k = 0; k < NHiggs; k++)
+      {
+        if (HiggsMassesVec[k] > 0) VDebye += std::pow(HiggsMassesVec[k], 1.5);
+        if (HiggsMassesZeroTempVec[k] > 0)
+          VDebye += -std::pow(HiggsMassesZeroTempVec[k], 1.5);
+      }
+      for (std::size_t k = 0; k < NGauge; k++)
+      {
+        if (GaugeMassesVec[k] > 0) VDebye += std::pow(GaugeMassesVec[k], 1.5);
+        if (GaugeMassesZeroTempVec[k] > 0)
+          VDebye += -std::pow(GaugeMassesZeroTempVec[k], 1.5);
+      }
+
+      VDebye *= -1.0 / (12 * M_PI);
+      res += VDebye;
+    }
+  }
+
+  return res;
+}
+
+double Class_Potential_Origin::V1Loop(const std::vector<double> &v,
+                                      double Temp,
+                                      EvaluationWorkspace &Workspace) const
+{
+  if (!SetCurvatureDone)
+  {
+    std::string retmes = __func__;
+    retmes += "was called while the model was not initialised correctly.\n";
+    throw std::runtime_error(retmes);
+  }
+  Workspace.Resize(NHiggs, NGauge, NQuarks, NLepton, nVEV);
+  if (C_UseParwani)
+  {
+    return V1Loop(ExpandVEV(VevOrder, v, Workspace), Temp, 0);
+  }
+  if (Kernel and SparseCurvatureDone and v.size() == nVEV)
+  {
+    return Kernel->V1Loop(v, Temp, *this, Workspace);
+  }
+  const bool InVEVSubspace = CalculateMassEigenvalues(v, Workspace);
+  return V1LoopFromEigenvalues(Temp, InVEVSubspace, Workspace);
+}
+
+void Class_Potential_Origin::V1LoopMultiT(const std::vector<double> &v,
+                                          const std::vector<double> &Temps,
+                                          std::vector<double> &res,
+                                          EvaluationWorkspace &Workspace) const
+{
+  if (!SetCurvatureDone)
+  {
+    std::string retmes = __func__;
+    retmes += "was called while the model was not initialised correctly.\n";
+    throw std::runtime_error(retmes);
+  }
+  Workspace.Resize(NHiggs, NGauge, NQuarks, NLepton, nVEV);
+  res.resize(Temps.size());
+  if (C_UseParwani)
+  {
+    for (std::size_t n = 0; n < Temps.size(); n++)
+    {
+      res[n] = V1Loop(ExpandVEV(VevOrder, v, Workspace), Temps[n], 0);
+    }
+    return;
+  }
+  const bool InVEVSubspace = CalculateMassEigenvalues(v, Workspace);
+  for (std::size_t n = 0; n < Temps.size(); n++)
+  {
+    res[n] = V1LoopFromEigenvalues(Temps[n], InVEVSubspace, Workspace);
+  }
+}
+
+bool Class_Potential_Origin::CalculateMassEigenvalues(
+    const std::vector<double> &v,
+    EvaluationWorkspace &Workspace) const
+{
+  // The mass matrices can only be built in the VEV subspace from the sparse
+  // storage
+  const auto &vEval =
+      SparseCurvatureDone ? v : ExpandVEV(VevOrder, v, Workspace);
+
+  // Inside the VEV subspace the mass matrices are block diagonal, see
+  // SetMassMatrixBlocks()
+  const bool InVEVSubspace =
+      v.size() == nVEV or
+      IsInVEVSubspace(v, SparseCurvature.NonVEVDirections);
+
+  FillHiggsMassMatrix(vEval, 0, Workspace.HiggsMass);
+  Workspace.HiggsEigenvalues = MassEigenvalues(InVEVSubspace,
+                                               Workspace.HiggsSolver,
+                                               Workspace.HiggsBlockSolver,
+                                               Workspace.HiggsMass,
+                                               SparseCurvature.HiggsBlocks);
+
+  FillGaugeMassMatrix(vEval, 0, Workspace.GaugeMass);
+  Workspace.GaugeEigenvalues = MassEigenvalues(InVEVSubspace,
+                                               Workspace.GaugeSolver,
+                                               Workspace.GaugeBlockSolver,
+                                               Workspace.GaugeMass,
+                                               SparseCurvature.GaugeBlocks);
+
+  FillQuarkMassMatrix(vEval, Workspace.QuarkMIJ);
+  Workspace.QuarkMass.noalias() =
+      Workspace.QuarkMIJ.conjugate() * Workspace.QuarkMIJ;
+  Workspace.QuarkEigenvalues = MassEigenvalues(InVEVSubspace,
+                                               Workspace.QuarkSolver,
+                                               Workspace.QuarkBlockSolver,
+                                               Workspace.QuarkMass,
+                                               SparseCurvature.QuarkBlocks);
+
+  FillLeptonMassMatrix(vEval, Workspace.LeptonMIJ);
+  Workspace.LeptonMass.noalias() =
+      Workspace.LeptonMIJ.conjugate() * Workspace.LeptonMIJ;
+  Workspace.LeptonEigenvalues = MassEigenvalues(InVEVSubspace,
+                                                Workspace.LeptonSolver,
+                                                Workspace.LeptonBlockSolver,
+                                                Workspace.LeptonMass,
+                                                SparseCurvature.LeptonBlocks);
+
+  return InVEVSubspace;
+}
+
+double Class_Potential_Origin::V1LoopFromEigenvalues(
+    double Temp,
+    bool InVEVSubspace,
+    EvaluationWorkspace &Workspace) const
+{
+  const double ZeroMassBoson   = std::pow(10, -5);
+  const double ZeroMassFermion = std::pow(10, -10);
+
+  auto CleanEigenvalue = [](double EV, double ZeroMass)
+  { return (std::abs(EV) < ZeroMass) ? 0 : EV; };
+
+  double VDebye = 0;
+  auto &Terms   = Workspace.OneLoop;
+  Terms.Clear();
+
+  // Higgs bosons
+  for (std::size_t i = 0; i < NHiggs; i++)
+  {
+    double m2 = CleanEigenvalue(Workspace.HiggsEigenvalues[i], ZeroMassBoson);
+    Terms.AddBoson(m2, C_CWcbHiggs, 1);
+    if (m2 > 0) VDebye += -std::pow(m2, 1.5);
+  }
+  if (Temp != 0)
+  {
+    Workspace.HiggsMassThermal = Workspace.HiggsMass;
+    for (std::size_t i = 0; i < NHiggs; i++)
+    {
+      for (std::size_t j = 0; j < NHiggs; j++)
+      {
+        Workspace.HiggsMassThermal(i, j) +=
+            DebyeHiggs[i][j] * std::pow(Temp, 2);
+      }
+    }
+    const auto &EV = MassEigenvalues(InVEVSubspace,
+                                     Workspace.HiggsSolver,
+                                     Workspace.HiggsBlockSolver,
+                                     Workspace.HiggsMassThermal,
+                                     SparseCurvature.HiggsBlocks);
+    for (std::size_t i = 0; i < NHiggs; i++)
+    {
+      double m2 = CleanEigenvalue(EV[i], ZeroMassBoson);
+      if (m2 > 0) VDebye += std::pow(m2, 1.5);
+    }
+  }
+
+  // Gauge bosons
+  for (std::size_t a = 0; a < NGauge; a++)
+  {
+    double m2 = CleanEigenvalue(Workspace.GaugeEigenvalues[a], ZeroMassBoson);
+    Terms.AddBoson(m2, C_CWcbGB, 3);
+    if (m2 > 0) VDebye += -std::pow(m2, 1.5);
+  }
+  if (Temp != 0)
+  {
+    Workspace.GaugeMassThermal = Workspace.GaugeMass;
+    for (std::size_t a = 0; a < NGauge; a++)
+    {
+      for (std::size_t b = 0; b < NGauge; b++)
+      {
+        Workspace.GaugeMassThermal(a, b) +=
+            DebyeGauge[a][b] * std::pow(Temp, 2);
+      }
+    }
+    const auto &EV = MassEigenvalues(InVEVSubspace,
+                                     Workspace.GaugeSolver,
+                                     Workspace.GaugeBlockSolver,
+                                     Workspace.GaugeMassThermal,
+                                     SparseCurvature.GaugeBlocks);
+    for (std::size_t a = 0; a < NGauge; a++)
+    {
+      double m2 = CleanEigenvalue(EV[a], ZeroMassBoson);
+      if (m2 > 0) VDebye += std::pow(m2, 1.5);
+    }
+  }
+
+  // Quarks
+  for (std::size_t a = 0; a < NQuarks; a++)
+  {
+    double m2 =
+        CleanEigenvalue(Workspace.QuarkEigenvalues[a], ZeroMassFermion);
+    Terms.AddFermion(m2, -2.0 * NColour);
+  }
+
+  // Leptons
+  for (std::size_t a = 0; a < NLepton; a++)
+  {
+    double m2 =
+        CleanEigenvalue(Workspace.LeptonEigenvalues[a], ZeroMassFermion);
+    Terms.AddFermion(m2, -2);
+  }
+
+  VDebye *= -Temp / (12 * M_PI);
+
+  return OneLoopSum(Terms, Temp) + VDebye;
+}
+
+std::vector<double>
+Class_Potential_Origin::VEffGradient(const std::vector<double> &v,
+                                     double Temp,
+                                     int Order) const
+{
+  std::vector<double> res(NHiggs);
+  VEffGradient(v, Temp, res, GetThreadWorkspace(), Order);
+  return res;
+}
+
+void Class_Potential_Origin::VEffGradient(const std::vector<double> &v,
+                                          double Temp,
+                                          std::vector<double> &Gradient,
+                                          EvaluationWorkspace &Workspace,
+                                          int Order) const
+{
+  if (v.size() != nVEV and v.size() != NHiggs)
+  {
+    std::string ErrorString =
+        std::string("You have called ") + std::string(__func__) +
+        std::string(
+            " with an invalid vev configuration. Your vev is of dimension ") +
+        std::to_string(v.size()) + std::string(" and it should be ") +
+        std::to_string(NHiggs) + std::string(".");
+    throw std::runtime_error(ErrorString);
+  }
+  Workspace.Resize(NHiggs, NGauge, NQuarks, NLepton, nVEV);
+
+  Gradient.resize(NHiggs);
+  if (Order != 0 and not UseTreeLevel)
+  {
+    V1LoopGradient(
+        ExpandVEV(VevOrder, v, Workspace), Temp, Workspace, Gradient);
+    for (std::size_t k = 0; k < NHiggs; k++)
+    {
+      Gradient[k] += VTree(v, k + 1) + CounterTerm(v, k + 1);
+    }
+  }
+  else
+  {
+    for (std::size_t k = 0; k < NHiggs; k++)
+    {
+      Gradient[k] = VTree(v, k + 1);
+    }
+  }
+}
+
+std::vector<double>
+Class_Potential_Origin::V1LoopGradient(const std::vector<double> &v,
+                                       double Temp) const
+{
+  std::vector<double> res(NHiggs, 0);
+  V1LoopGradient(v, Temp, GetThreadWorkspace(), res);
+  return res;
+}
+
+void Class_Potential_Origin::V1LoopGradient(
+    const std::vector<double> &v,
+    double Temp,
+    EvaluationWorkspace &Workspace,
+    std::vector<double> &Gradient) const
+{
+  Workspace.Resize(NHiggs, NGauge, NQuarks, NLepton, nVEV);
+  if (C_UseParwani)
+  {
+    // The Parwani resummation is only available component-wise
+    for (std::size_t k = 0; k < NHiggs; k++)
+    {
+      Gradient[k] = V1Loop(v, Temp, k + 1);
+    }
+    return;
+  }
+
+  /**
+   * For each sector the one-loop potential has the form sum_i f(m_i^2), so
+   * its derivative w.r.t. v_k is sum_i f'(m_i^2) (U^dagger dM/dv_k U)_{ii} =
+   * Tr(dM/dv_k P) with P = U diag(f'(m_i^2)) U^dagger. Within a degenerate
+   * subspace f' is constant, hence no special treatment of repeated
+   * eigenvalues is needed.
+   */
+  const double ZeroMassBoson   = std::pow(10, -5);
+  const double ZeroMassFermion = std::pow(10, -10);
+  const double DebyeFactor     = Temp / (12 * M_PI);
+
+  auto CleanEigenvalue = [](double EV, double ZeroMass)
+  { return (std::abs(EV) < ZeroMass) ? 0 : EV; };
+
+  // Inside the VEV subspace the mass matrices are diagonalised block by block,
+  // see SetMassMatrixBlocks()
+  const bool InVEVSubspace =
+      IsInVEVSubspace(v, SparseCurvature.NonVEVDirections);
+
+  // Higgs bosons
+  auto &HiggsWeights = Workspace.HiggsWeights;
+  auto &PHiggs       = Workspace.PHiggs;
+  FillHiggsMassMatrix(v, 0, Workspace.HiggsMass);
+  {
+    const auto Higgs = MassEigensystem(InVEVSubspace,
+                                       Workspace.HiggsSolver,
+                                       Workspace.HiggsBlockSolver,
+                                       Workspace.HiggsMass,
+                                       SparseCurvature.HiggsBlocks);
+    for (std::size_t i = 0; i < NHiggs; i++)
+    {
+      double m2 = CleanEigenvalue(Higgs.Eigenvalues[i], ZeroMassBoson);
+      HiggsWeights(i) = BosonMassDerivatives(m2, Temp, C_CWcbHiggs).first;
+      if (m2 > 0) HiggsWeights(i) += 1.5 * DebyeFactor * std::sqrt(m2);
+    }
+    Workspace.HiggsScaled.noalias() =
+        Higgs.Eigenvectors * HiggsWeights.asDiagonal();
+    PHiggs.noalias() = Workspace.HiggsScaled * Higgs.Eigenvectors.transpose();
+  }
+  if (Temp != 0)
+  {
+    Workspace.HiggsMassThermal = Workspace.HiggsMass;
+    for (std::size_t i = 0; i < NHiggs; i++)
+    {
+      for (std::size_t j = 0; j < NHiggs; j++)
+      {
+        Workspace.HiggsMassThermal(i, j) +=
+            DebyeHiggs[i][j] * std::pow(Temp, 2);
+      }
+    }
+    const auto Higgs = MassEigensystem(InVEVSubspace,
+                                       Workspace.HiggsSolver,
+                                       Workspace.HiggsBlockSolver,
+                                       Workspace.HiggsMassThermal,
+                                       SparseCurvature.HiggsBlocks);
+    for (std::size_t i = 0; i < NHiggs; i++)
+    {
+      double m2 = CleanEigenvalue(Higgs.Eigenvalues[i], ZeroMassBoson);
+      HiggsWeights(i) = (m2 > 0) ? -1.5 * DebyeFactor * std::sqrt(m2) : 0;
+    }
+    Workspace.HiggsScaled.noalias() =
+        Higgs.Eigenvectors * HiggsWeights.asDiagonal();
+    PHiggs.noalias() += Workspace.HiggsScaled * Higgs.Eigenvectors.transpose();
+  }
+
+  // Gauge bosons
+  auto &GaugeWeights = Workspace.GaugeWeights;
+  auto &PGauge       = Workspace.PGauge;
+  FillGaugeMassMatrix(v, 0, Workspace.GaugeMass);
+  {
+    const auto Gauge = MassEigensystem(InVEVSubspace,
+                                       Workspace.GaugeSolver,
+                                       Workspace.GaugeBlockSolver,
+                                       Workspace.GaugeMass,
+                                       SparseCurvature.GaugeBlocks);
+    for (std::size_t a = 0; a < NGauge; a++)
+    {
+      double m2 = CleanEigenvalue(Gauge.Eigenvalues[a], ZeroMassBoson);
+      GaugeWeights(a) = 3 * BosonMassDerivatives(m2, Temp, C_CWcbGB).first;
+      if (m2 > 0) GaugeWeights(a) += 1.5 * DebyeFactor * std::sqrt(m2);
+    }
+    Workspace.GaugeScaled.noalias() =
+        Gauge.Eigenvectors * GaugeWeights.asDiagonal();
+    PGauge.noalias() = Workspace.GaugeScaled * Gauge.Eigenvectors.transpose();
+  }
+  if (Temp != 0)
+  {
+    FillGaugeMassMatrix(v, Temp, Workspace.GaugeMassThermal);
+    const auto Gauge = MassEigensystem(InVEVSubspace,
+                                       Workspace.GaugeSolver,
+                                       Workspace.GaugeBlockSolver,
+                                       Workspace.GaugeMassThermal,
+                                       SparseCurvature.GaugeBlocks);
+    for (std::size_t a = 0; a < NGauge; a++)
+    {
+      double m2 = CleanEigenvalue(Gauge.Eigenvalues[a], ZeroMassBoson);
+      GaugeWeights(a) = (m2 > 0) ? -1.5 * DebyeFactor * std::sqrt(m2) : 0;
+    }
+    Workspace.GaugeScaled.noalias() =
+        Gauge.Eigenvectors * GaugeWeights.asDiagonal();
+    PGauge.noalias() += Workspace.GaugeScaled * Gauge.Eigenvectors.transpose();
+  }
+
+  // Quarks, the mass matrix is M^* M with M = Y^{IJ} + Y^{IJk} v_k
+  auto &QuarkMIJ     = Workspace.QuarkMIJ;
+  auto &QuarkWeights = Workspace.QuarkWeights;
+  FillQuarkMassMatrix(v, QuarkMIJ);
+  Workspace.QuarkMass.noalias() = QuarkMIJ.conjugate() * QuarkMIJ;
+  const auto Quark = MassEigensystem(InVEVSubspace,
+                                     Workspace.QuarkSolver,
+                                     Workspace.QuarkBlockSolver,
+                                     Workspace.QuarkMass,
+                                     SparseCurvature.QuarkBlocks);
+  for (std::size_t a = 0; a < NQuarks; a++)
+  {
+    double m2 = CleanEigenvalue(Quark.Eigenvalues[a], ZeroMassFermion);
+    QuarkWeights(a) = -2.0 * NColour * FermionMassDerivatives(m2, Temp).first;
+  }
+  Workspace.QuarkScaled.noalias() =
+      Quark.Eigenvectors * QuarkWeights.asDiagonal();
+  Workspace.PQuark.noalias() =
+      Workspace.QuarkScaled * Quark.Eigenvectors.adjoint();
+  Workspace.QuarkProjected1.noalias() = QuarkMIJ * Workspace.PQuark;
+  Workspace.QuarkProjected2.noalias() = Workspace.PQuark * QuarkMIJ.conjugate();
+
+  // Leptons
+  auto &LeptonMIJ     = Workspace.LeptonMIJ;
+  auto &LeptonWeights = Workspace.LeptonWeights;
+  FillLeptonMassMatrix(v, LeptonMIJ);
+  Workspace.LeptonMass.noalias() = LeptonMIJ.conjugate() * LeptonMIJ;
+  const auto Lepton = MassEigensystem(InVEVSubspace,
+                                      Workspace.LeptonSolver,
+                                      Workspace.LeptonBlockSolver,
+                                      Workspace.LeptonMass,
+                                      SparseCurvature.LeptonBlocks);
+  for (std::size_t a = 0; a < NLepton; a++)
+  {
+    double m2 = CleanEigenvalue(Lepton.Eigenvalues[a], ZeroMassFermion);
+    LeptonWeights(a) = -2.0 * FermionMassDerivatives(m2, Temp).first;
+  }
+  Workspace.LeptonScaled.noalias() =
+      Lepton.Eigenvectors * LeptonWeights.asDiagonal();
+  Workspace.PLepton.noalias() =
+      Workspace.LeptonScaled * Lepton.Eigenvectors.adjoint();
+  Workspace.LeptonProjected1.noalias() = LeptonMIJ * Workspace.PLepton;
+  Workspace.LeptonProjected2.noalias() =
+      Workspace.PLepton * LeptonMIJ.conjugate();
+
+  const auto &QuarkProjected1  = Workspace.QuarkProjected1;
+  const auto &QuarkProjected2  = Workspace.QuarkProjected2;
+  const auto &LeptonProjected1 = Workspace.LeptonProjected1;
+  const auto &LeptonProjected2 = Workspace.LeptonProjected2;
+
+  std::fill(Gradient.begin(), Gradient.end(), 0);
+  if (SparseCurvatureDone)
+  {
+    // Contract the derivatives of the mass matrices entry by entry
+    const auto &L3 = SparseCurvature.HiggsL3;
+    for (std::size_t n = 0; n < L3.size(); n++)
+    {
+      const auto &Index = L3.Indices[n];
+      Gradient[Index[2]] += L3.Values[n] * PHiggs(Index[0], Index[1]);
+    }
+    const auto &L4 = SparseCurvature.HiggsL4;
+    for (std::size_t n = 0; n < L4.size(); n++)
+    {
+      const auto &Index = L4.Indices[n];
+      Gradient[Index[2]] +=
+          L4.Values[n] * v[Index[3]] * PHiggs(Index[0], Index[1]);
+    }
+    const auto &G2H2 = SparseCurvature.GaugeG2H2;
+    for (std::size_t n = 0; n < G2H2.size(); n++)
+    {
+      const auto &Index = G2H2.Indices[n];
+      Gradient[Index[2]] +=
+          G2H2.Values[n] * v[Index[3]] * PGauge(Index[0], Index[1]);
+    }
+    const auto &QuarkF2H1 = SparseCurvature.QuarkF2H1;
+    for (std::size_t n = 0; n < QuarkF2H1.size(); n++)
+    {
+      const auto &Index = QuarkF2H1.Indices[n];
+      const auto &Value = QuarkF2H1.Values[n];
+      Gradient[Index[2]] +=
+          (std::conj(Value) * QuarkProjected1(Index[1], Index[0]) +
+           Value * QuarkProjected2(Index[1], Index[0]))
+              .real();
+    }
+    const auto &LeptonF2H1 = SparseCurvature.LeptonF2H1;
+    for (std::size_t n = 0; n < LeptonF2H1.size(); n++)
+    {
+      const auto &Index = LeptonF2H1.Indices[n];
+      const auto &Value = LeptonF2H1.Values[n];
+      Gradient[Index[2]] +=
+          (std::conj(Value) * LeptonProjected1(Index[1], Index[0]) +
+           Value * LeptonProjected2(Index[1], Index[0]))
+              .real();
+    }
+    return;
+  }
+
+  for (std::size_t k = 0; k < NHiggs; k++)
+  {
+    for (std::size_t i = 0; i < NHiggs; i++)
+    {
+      for (std::size_t j = 0; j < NHiggs; j++)
+      {
+        double Diff = Curvature_Higgs_L3[i][j][k];
+        for (std::size_t l = 0; l < NHiggs; l++)
+        {
+          Diff += Curvature_Higgs_L4[i][j][k][l] * v[l];
+        }
+        Gradient[k] += Diff * PHiggs(i, j);
+      }
+    }
+    for (std::size_t a = 0; a < NGauge; a++)
+    {
+      for (std::size_t b = 0; b < NGauge; b++)
+      {
+        double Diff = 0;
+        for (std::size_t j = 0; j < NHiggs; j++)
+        {
+          Diff += Curvature_Gauge_G2H2[a][b][k][j] * v[j];
+        }
+        Gradient[k] += Diff * PGauge(a, b);
+      }
+    }
+    std::complex<double> FermionContribution = 0;
+    for (std::size_t a = 0; a < NQuarks; a++)
+    {
+      for (std::size_t i = 0; i < NQuarks; i++)
+      {
+        FermionContribution +=
+            std::conj(Curvature_Quark_F2H1[a][i][k]) * QuarkProjected1(i, a) +
+            Curvature_Quark_F2H1[a][i][k] * QuarkProjected2(i, a);
+      }
+    }
+    for (std::size_t a = 0; a < NLepton; a++)
+    {
+      for (std::size_t i = 0; i < NLepton; i++)
+      {
+        FermionContribution +=
+            std::conj(Curvature_Lepton_F2H1[a][i][k]) * LeptonProjected1(i, a) +
+            Curvature_Lepton_F2H1[a][i][k] * LeptonProjected2(i, a);
+      }
+    }
+    Gradient[k] += FermionContribution.real();
+  }
+}
+
+namespace
+{
+/**
+ * Adds sum_ij F_ij Re[A_k(i,j) A_l(j,i)] to Hessian(k,l), where A_k is the
+ * derivative of a mass matrix w.r.t. v_k rotated into the eigenbasis U of the
+ * mass matrix and F_ij the divided difference of the first derivatives
+ * First_i = f'(m_i^2). For (nearly) degenerate eigenvalues the limit
+ * f''(m_i^2) is used instead. As the A_k are hermitian, the sum is the real
+ * part of R^dagger diag(F) R, where the columns of R are the flattened A_k.
+ */
+template <typename MatrixType, typename EigenvectorType>
+void AddEigenvalueMixing(const EigenvectorType &U,
+                         HessianBuffers<MatrixType> &Buffers,
+                         MatrixXd &Hessian)
+{
+  const double DegeneracyThreshold = 1e-6;
+  const auto &Eigenvalues          = Buffers.Eigenvalues;
+  const auto nSize                 = Eigenvalues.size();
+  for (Eigen::Index j = 0; j < nSize; j++)
+  {
+    for (Eigen::Index i = 0; i < nSize; i++)
+    {
+      double Difference = Eigenvalues(i) - Eigenvalues(j);
+      double Scale      = std::max(
+          {1.0, std::abs(Eigenvalues(i)), std::abs(Eigenvalues(j))});
+      if (std::abs(Difference) > DegeneracyThreshold * Scale)
+      {
+        Buffers.Mixing(i + nSize * j) =
+            (Buffers.First(i) - Buffers.First(j)) / Difference;
+      }
+      else
+      {
+        Buffers.Mixing(i + nSize * j) =
+            0.5 * (Buffers.Second(i) + Buffers.Second(j));
+      }
+    }
+  }
+
+  for (Eigen::Index k = 0; k < Buffers.Derivatives.cols(); k++)
+  {
+    if (Buffers.Derivatives.col(k).isZero(0))
+    {
+      Buffers.Rotated.col(k).setZero();
+      continue;
+    }
+    Eigen::Map<const MatrixType> Derivative(
+        Buffers.Derivatives.col(k).data(), nSize, nSize);
+    Eigen::Map<MatrixType> Rotated(Buffers.Rotated.col(k).data(), nSize, nSize);
+    Buffers.Product.noalias() = Derivative * U;
+    Rotated.noalias()         = U.adjoint() * Buffers.Product;
+  }
+  Buffers.Weighted.noalias()   = Buffers.Mixing.asDiagonal() * Buffers.Rotated;
+  Buffers.Contracted.noalias() = Buffers.Rotated.adjoint() * Buffers.Weighted;
+  Hessian += Buffers.Contracted.real();
+}
+} // namespace
+
+std::vector<std::vector<double>>
+Class_Potential_Origin::VEffHessian(const std::vector<double> &v,
+                                    double Temp,
+                                    int Order) const
+{
+  if (v.size() != nVEV and v.size() != NHiggs)
+  {
+    std::string ErrorString =
+        std::string("You have called ") + std::string(__func__) +
+        std::string(
+            " with an invalid vev configuration. Your vev is of dimension ") +
+        std::to_string(v.size()) + std::string(" and it should be ") +
+        std::to_string(NHiggs) + std::string(".");
+    throw std::runtime_error(ErrorString);
+  }
+  if (v.size() == nVEV and nVEV != NHiggs)
+  {
+    std::stringstream ss;
+    ss << __func__
+       << " is being called with a wrong sized vev configuration. It "
+          "has the dimension of "
+       << nVEV << " while it should have " << NHiggs
+       << ". For now this is transformed but please fix this to reduce "
+          "the runtime."
+       << std::endl;
+    Logger::Write(LoggingLevel::Default, ss.str());
+    return VEffHessian(MinimizeOrderVEV(v), Temp, Order);
+  }
+
+  MatrixXd Hessian = HiggsMassMatrix(v, 0, 0);
+  if (Order != 0 and not UseTreeLevel)
+  {
+    Hessian += HessianCT(v) + V1LoopHessian(v, Temp);
+  }
+
+  std::vector<std::vector<double>> res(NHiggs, std::vector<double>(NHiggs));
+  for (std::size_t i = 0; i < NHiggs; i++)
+  {
+    for (std::size_t j = 0; j < NHiggs; j++)
+    {
+      res[i][j] = Hessian(i, j);
+    }
+  }
+  return res;
+}
+
+MatrixXd Class_Potential_Origin::V1LoopHessian(const std::vector<double> &v,
+                                               double Temp) const
+{
+  MatrixXd res(NHiggs, NHiggs);
+  V1LoopHessian(v, Temp, GetThreadWorkspace(), res);
+  return res;
+}
+
+void Class_Potential_Origin::V1LoopHessian(const std::vector<double> &v,
+                                           double Temp,
+                                           EvaluationWorkspace &Workspace,
+                                           MatrixXd &Hessian) const
+{
+  Workspace.Resize(NHiggs, NGauge, NQuarks, NLepton, nVEV);
+  Hessian.setZero(NHiggs, NHiggs);
+
+  if (C_UseParwani)
+  {
+    // The Parwani resummation is only available component-wise, so we use
+    // central differences of the gradient
+    const double eps = 1e-3;
+    for (std::size_t l = 0; l < NHiggs; l++)
+    {
+      auto vPlus  = v;
+      auto vMinus = v;
+      vPlus[l] += eps;
+      vMinus[l] -= eps;
+      auto GradPlus  = V1LoopGradient(vPlus, Temp);
+      auto GradMinus = V1LoopGradient(vMinus, Temp);
+      for (std::size_t k = 0; k < NHiggs; k++)
+      {
+        Hessian(k, l) = (GradPlus[k] - GradMinus[k]) / (2 * eps);
+      }
+    }
+    Hessian = 0.5 * (Hessian + Hessian.transpose()).eval();
+    return;
+  }
+
+  if (not SparseCurvatureDone)
+  {
+    std::string retmes = __func__;
+    retmes += " was called while the model was not initialised correctly.\n";
+    throw std::runtime_error(retmes);
+  }
+
+  // Inside the VEV subspace the mass matrices are evaluated from their
+  // expansion in the VEV directions, see CurvatureStorage, and diagonalised
+  // block by block, see SetMassMatrixBlocks()
+  const bool InVEVSubspace =
+      IsInVEVSubspace(v, SparseCurvature.NonVEVDirections);
+  const bool UseExpansion = InVEVSubspace and nVEV != NHiggs;
+  if (UseExpansion)
+  {
+    for (std::size_t a = 0; a < nVEV; a++)
+    {
+      Workspace.VEVSubspace[a] = v[VevOrder[a]];
     }
   }
-  else if (diff == -1)
+  const auto &vEval = UseExpansion ? Workspace.VEVSubspace : v;
+
+  const double ZeroMassBoson   = std::pow(10, -5);
+  const double ZeroMassFermion = std::pow(10, -10);
+  const double DebyeFactor     = Temp / (12 * M_PI);
+
+  auto CleanEigenvalue = [](double EV, double ZeroMass)
+  { return (std::abs(EV) < ZeroMass) ? 0 : EV; };
+
+  // First and second derivative of T/(12 pi) (m^2)^{3/2}
+  auto DebyeDerivatives = [&](double m2)
   {
-    if (C_UseParwani)
+    if (Temp == 0 or m2 <= 0) return std::make_pair(0.0, 0.0);
+    double Second =
+        (m2 >= C_threshold) ? 0.75 * DebyeFactor / std::sqrt(m2) : 0;
+    return std::make_pair(1.5 * DebyeFactor * std::sqrt(m2), Second);
+  };
+
+  // Higgs bosons, both mass matrices share the field derivatives
+  // d_k M_ij = L3_ijk + L4_ijkl v_l and d_k d_l M_ij = L4_ijkl
+  const auto &L3 = SparseCurvature.HiggsL3;
+  const auto &L4 = SparseCurvature.HiggsL4;
+  auto &Higgs    = Workspace.HiggsHessian;
+  Higgs.Derivatives.setZero();
+  for (std::size_t n = 0; n < L3.size(); n++)
+  {
+    const auto &Index = L3.Indices[n];
+    Higgs.Derivatives(Index[0] + NHiggs * Index[1], Index[2]) += L3.Values[n];
+  }
+  for (std::size_t n = 0; n < L4.size(); n++)
+  {
+    const auto &Index = L4.Indices[n];
+    if (v[Index[3]] == 0) continue;
+    Higgs.Derivatives(Index[0] + NHiggs * Index[1], Index[2]) +=
+        L4.Values[n] * v[Index[3]];
+  }
+
+  FillHiggsMassMatrix(vEval, 0, Workspace.HiggsMass);
+  Workspace.PHiggs.setZero();
+  for (int UseThermal = 0; UseThermal < 2; UseThermal++)
+  {
+    if (UseThermal and Temp == 0) break;
+    if (UseThermal)
     {
-      for (std::size_t k = 0; k < NHiggs; k++)
+      Workspace.HiggsMassThermal = Workspace.HiggsMass;
+      for (std::size_t i = 0; i < NHiggs; i++)
       {
-        res += HiggsMassesVec.at(k + NHiggs) *
-               boson(HiggsMassesVec[k], Temp, C_CWcbHiggs, 0);
-        res += boson(HiggsMassesVec[k], Temp, C_CWcbHiggs, -1);
+        for (std::size_t j = 0; j < NHiggs; j++)
+        {
+          Workspace.HiggsMassThermal(i, j) +=
+              DebyeHiggs[i][j] * std::pow(Temp, 2);
+        }
       }
-      for (std::size_t k = 0; k < NGauge; k++)
+    }
+    const auto System = MassEigensystem(InVEVSubspace,
+                                        Workspace.HiggsSolver,
+                                        Workspace.HiggsBlockSolver,
+                                        UseThermal ? Workspace.HiggsMassThermal
+                                                   : Workspace.HiggsMass,
+                                        SparseCurvature.HiggsBlocks);
+    for (std::size_t i = 0; i < NHiggs; i++)
+    {
+      double m2 = CleanEigenvalue(System.Eigenvalues[i], ZeroMassBoson);
+      auto Debye           = DebyeDerivatives(m2);
+      Higgs.Eigenvalues(i) = m2;
+      if (UseThermal)
       {
-        res += GaugeMassesVec.at(k + NGauge) *
-               boson(GaugeMassesVec[k], Temp, C_CWcbGB, 0);
-        res += boson(GaugeMassesVec.at(k), Temp, C_CWcbGB, -1);
+        Higgs.First(i)  = -Debye.first;
+        Higgs.Second(i) = -Debye.second;
       }
-      for (std::size_t k = 0; k < NGauge; k++)
+      else
       {
-        res += 2 * boson(GaugeMassesZeroTempVec[k], Temp, C_CWcbGB, -1);
+        auto Boson      = BosonMassDerivatives(m2, Temp, C_CWcbHiggs);
+        Higgs.First(i)  = Boson.first + Debye.first;
+        Higgs.Second(i) = Boson.second + Debye.second;
       }
-      for (std::size_t k = 0; k < NQuarks; k++)
+    }
+    AddEigenvalueMixing(System.Eigenvectors, Higgs, Hessian);
+    Workspace.HiggsScaled.noalias() =
+        System.Eigenvectors * Higgs.First.asDiagonal();
+    Workspace.PHiggs.noalias() +=
+        Workspace.HiggsScaled * System.Eigenvectors.transpose();
+  }
+  for (std::size_t n = 0; n < L4.size(); n++)
+  {
+    const auto &Index = L4.Indices[n];
+    Hessian(Index[2], Index[3]) +=
+        L4.Values[n] * Workspace.PHiggs(Index[0], Index[1]);
+  }
+
+  // Gauge bosons, d_k M_ab = G2H2_abkl v_l and d_k d_l M_ab = G2H2_abkl
+  const auto &G2H2 = SparseCurvature.GaugeG2H2;
+  auto &Gauge      = Workspace.GaugeHessian;
+  Gauge.Derivatives.setZero();
+  for (std::size_t n = 0; n < G2H2.size(); n++)
+  {
+    const auto &Index = G2H2.Indices[n];
+    if (v[Index[3]] == 0) continue;
+    Gauge.Derivatives(Index[0] + NGauge * Index[1], Index[2]) +=
+        G2H2.Values[n] * v[Index[3]];
+  }
+
+  Workspace.PGauge.setZero();
+  for (int UseThermal = 0; UseThermal < 2; UseThermal++)
+  {
+    if (UseThermal and Temp == 0) break;
+    auto &Mass = UseThermal ? Workspace.GaugeMassThermal : Workspace.GaugeMass;
+    FillGaugeMassMatrix(vEval, UseThermal ? Temp : 0, Mass);
+    const auto System = MassEigensystem(InVEVSubspace,
+                                        Workspace.GaugeSolver,
+                                        Workspace.GaugeBlockSolver,
+                                        Mass,
+                                        SparseCurvature.GaugeBlocks);
+    for (std::size_t a = 0; a < NGauge; a++)
+    {
+      double m2 = CleanEigenvalue(System.Eigenvalues[a], ZeroMassBoson);
+      auto Debye           = DebyeDerivatives(m2);
+      Gauge.Eigenvalues(a) = m2;
+      if (UseThermal)
       {
-        res += -6 * fermion(QuarkMassesVec[k], Temp, -1);
+        Gauge.First(a)  = -Debye.first;
+        Gauge.Second(a) = -Debye.second;
       }
-      for (std::size_t k = 0; k < NLepton; k++)
+      else
       {
-        res += -2 * fermion(LeptonMassesVec[k], Temp, -1);
+        auto Boson      = BosonMassDerivatives(m2, Temp, C_CWcbGB);
+        Gauge.First(a)  = 3 * Boson.first + Debye.first;
+        Gauge.Second(a) = 3 * Boson.second + Debye.second;
       }
     }
-    else
+    AddEigenvalueMixing(System.Eigenvectors, Gauge, Hessian);
+    Workspace.GaugeScaled.noalias() =
+        System.Eigenvectors * Gauge.First.asDiagonal();
+    Workspace.PGauge.noalias() +=
+        Workspace.GaugeScaled * System.Eigenvectors.transpose();
+  }
+  for (std::size_t n = 0; n < G2H2.size(); n++)
+  {
+    const auto &Index = G2H2.Indices[n];
+    Hessian(Index[2], Index[3]) +=
+        G2H2.Values[n] * Workspace.PGauge(Index[0], Index[1]);
+  }
+
+  // Fermions, the mass matrix is M^* M with M = Y^{IJ} + Y^{IJk} v_k, so
+  // d_k (M^* M) = Y_k^* M + M^* Y_k and d_k d_l (M^* M) = Y_k^* Y_l + Y_l^* Y_k
+  auto AddFermions = [&](const MatrixXcd &MIJ,
+                         const SparseTensor<std::complex<double>, 3> &F2H1,
+                         double DOF,
+                         MatrixXcd &Mass,
+                         SelfAdjointEigenSolver<MatrixXcd> &Solver,
+                         BlockEigenvalueSolver<MatrixXcd> &BlockSolver,
+                         const MatrixBlocks &Blocks,
+                         MatrixXcd &Scaled,
+                         MatrixXcd &P,
+                         HessianBuffers<MatrixXcd> &Buffers)
+  {
+    const auto nSize = MIJ.rows();
+    Mass.noalias()   = MIJ.conjugate() * MIJ;
+    const auto System =
+        MassEigensystem(InVEVSubspace, Solver, BlockSolver, Mass, Blocks);
+    for (Eigen::Index a = 0; a < nSize; a++)
     {
-      HiggsMassesZeroTempVec = HiggsMassesSquared(v, 0, diff);
-      for (std::size_t k = 0; k < NHiggs; k++)
-      {
-        res += boson(HiggsMassesZeroTempVec[k], Temp, C_CWcbHiggs, -1);
-      }
-      for (std::size_t k = 0; k < NGauge; k++)
+      double m2    = CleanEigenvalue(System.Eigenvalues[a], ZeroMassFermion);
+      auto Fermion = FermionMassDerivatives(m2, Temp);
+      Buffers.Eigenvalues(a) = m2;
+      Buffers.First(a)       = DOF * Fermion.first;
+      Buffers.Second(a)      = DOF * Fermion.second;
+    }
+
+    Buffers.Derivatives.setZero();
+    for (std::size_t n = 0; n < F2H1.size(); n++)
+    {
+      const auto &Index = F2H1.Indices[n];
+      const auto &Value = F2H1.Values[n];
+      for (Eigen::Index c = 0; c < nSize; c++)
       {
-        res += 3 * boson(GaugeMassesZeroTempVec[k], Temp, C_CWcbGB, -1);
+        Buffers.Derivatives(Index[0] + nSize * c, Index[2]) +=
+            std::conj(Value) * MIJ(Index[1], c);
+        Buffers.Derivatives(c + nSize * Index[1], Index[2]) +=
+            std::conj(MIJ(c, Index[0])) * Value;
       }
-      double AddContQuark = 0;
-      for (std::size_t k = 0; k < NQuarks; k++)
-        AddContQuark += -2 * fermion(QuarkMassesVec[k], Temp, -1);
-      for (std::size_t k = 0; k < NColour; k++)
-        res += AddContQuark;
-      for (std::size_t k = 0; k < NLepton; k++)
-        res += -2 * fermion(LeptonMassesVec[k], Temp, -1);
+    }
+    AddEigenvalueMixing(System.Eigenvectors, Buffers, Hessian);
 
-      double VDebye = 0;
-      for (std::size_t k = 0; k < NHiggs; k++)
+    // Tr(P Y_k^* Y_l), the columns of Rotated are reused for P Y_k^*
+    Scaled.noalias() = System.Eigenvectors * Buffers.First.asDiagonal();
+    P.noalias()      = Scaled * System.Eigenvectors.adjoint();
+    Buffers.Rotated.setZero();
+    for (std::size_t n = 0; n < F2H1.size(); n++)
+    {
+      const auto &Index = F2H1.Indices[n];
+      for (Eigen::Index a = 0; a < nSize; a++)
       {
-        if (HiggsMassesVec[k] > 0) VDebye += std::pow(HiggsMassesVec[k], 1.5);
-        if (HiggsMassesZeroTempVec[k] > 0)
-          VDebye += -std::pow(HiggsMassesZeroTempVec[k], 1.5);
+        Buffers.Rotated(a + nSize * Index[1], Index[2]) +=
+            P(a, Index[0]) * std::conj(F2H1.Values[n]);
       }
-      for (std::size_t k = 0; k < NGauge; k++)
+    }
+    Buffers.Contracted.setZero();
+    for (std::size_t k = 0; k < NHiggs; k++)
+    {
+      for (std::size_t n = 0; n < F2H1.size(); n++)
       {
-        if (GaugeMassesVec[k] > 0) VDebye += std::pow(GaugeMassesVec[k], 1.5);
-        if (GaugeMassesZeroTempVec[k] > 0)
-          VDebye += -std::pow(GaugeMassesZeroTempVec[k], 1.5);
+        const auto &Index = F2H1.Indices[n];
+        Buffers.Contracted(k, Index[2]) +=
+            Buffers.Rotated(Index[1] + nSize * Index[0], k) * F2H1.Values[n];
       }
-
-      VDebye *= -1.0 / (12 * M_PI);
-      res += VDebye;
     }
-  }
-
-  return res;
+    Hessian += (Buffers.Contracted + Buffers.Contracted.transpose()).real();
+  };
+
+  FillQuarkMassMatrix(vEval, Workspace.QuarkMIJ);
+  AddFermions(Workspace.QuarkMIJ,
+              SparseCurvature.QuarkF2H1,
+              -2.0 * NColour,
+              Workspace.QuarkMass,
+              Workspace.QuarkSolver,
+              Workspace.QuarkBlockSolver,
+              SparseCurvature.QuarkBlocks,
+              Workspace.QuarkScaled,
+              Workspace.PQuark,
+              Workspace.QuarkHessian);
+
+  FillLeptonMassMatrix(vEval, Workspace.LeptonMIJ);
+  AddFermions(Workspace.LeptonMIJ,
+              SparseCurvature.LeptonF2H1,
+              -2.0,
+              Workspace.LeptonMass,
+              Workspace.LeptonSolver,
+              Workspace.LeptonBlockSolver,
+              SparseCurvature.LeptonBlocks,
+              Workspace.LeptonScaled,
+              Workspace.PLepton,
+              Workspace.LeptonHessian);
 }
 
 void Class_Potential_Origin::CalculateDebye(bool forceCalculation)
@@ -3287,6 +4663,7 @@ void Class_Potential_Origin::CalculateDebye(bool forceCalculation)
       }
     }
   }
+  SetMassMatrixBlocks();
 }
 
 void Class_Potential_Origin::CalculateDebyeGauge()
@@ -3298,7 +4675,11 @@ void Class_Potential_Origin::CalculateDebyeGauge()
   }
 
   bool Done = CalculateDebyeGaugeSimplified();
-  if (Done) return;
+  if (Done)
+  {
+    SetMassMatrixBlocks();
+    return;
+  }
 
   std::size_t nGaugeHiggs = 0;
 
@@ -3327,6 +4708,7 @@ void Class_Potential_Origin::CalculateDebyeGauge()
       if (std::abs(DebyeGauge[i][j]) <= 1e-5) DebyeGauge[i][j] = 0;
     }
   }
+  SetMassMatrixBlocks();
 }
 
 void Class_Potential_Origin::initVectors()
@@ -3469,9 +4851,221 @@ void Class_Potential_Origin::sym4Dim(
   }
 }
 
+void Class_Potential_Origin::SetSparseCurvatureArrays()
+{
+  SparseCurvature.HiggsL2 = MatrixXd::Zero(NHiggs, NHiggs);
+  for (std::size_t i = 0; i < NHiggs; i++)
+  {
+    for (std::size_t j = 0; j < NHiggs; j++)
+    {
+      SparseCurvature.HiggsL2(i, j) = Curvature_Higgs_L2[i][j];
+    }
+  }
+  SparseCurvature.HiggsL3   = MakeSparse(Curvature_Higgs_L3);
+  SparseCurvature.HiggsL4   = MakeSparse(Curvature_Higgs_L4);
+  SparseCurvature.GaugeG2H2 = MakeSparse(Curvature_Gauge_G2H2);
+
+  SparseCurvature.QuarkF2 = MatrixXcd::Zero(NQuarks, NQuarks);
+  for (std::size_t i = 0; i < NQuarks; i++)
+  {
+    for (std::size_t j = 0; j < NQuarks; j++)
+    {
+      SparseCurvature.QuarkF2(i, j) = Curvature_Quark_F2[i][j];
+    }
+  }
+  SparseCurvature.QuarkF2H1 = MakeSparse(Curvature_Quark_F2H1);
+
+  SparseCurvature.LeptonF2 = MatrixXcd::Zero(NLepton, NLepton);
+  for (std::size_t i = 0; i < NLepton; i++)
+  {
+    for (std::size_t j = 0; j < NLepton; j++)
+    {
+      SparseCurvature.LeptonF2(i, j) = Curvature_Lepton_F2[i][j];
+    }
+  }
+  SparseCurvature.LeptonF2H1 = MakeSparse(Curvature_Lepton_F2H1);
+
+  // Mass matrices contracted with the VEV directions, the symmetric quadratic
+  // coefficients with a < b collect both orderings
+  auto &HiggsVEV = SparseCurvature.HiggsVEV;
+  auto &GaugeVEV = SparseCurvature.GaugeVEV;
+
+  HiggsVEV.Dimension = nVEV;
+  HiggsVEV.Constant  = SparseCurvature.HiggsL2;
+  HiggsVEV.Linear.assign(nVEV, MatrixXd::Zero(NHiggs, NHiggs));
+  HiggsVEV.Quadratic.clear();
+  GaugeVEV.Dimension = nVEV;
+  GaugeVEV.Constant  = MatrixXd::Zero(NGauge, NGauge);
+  GaugeVEV.Linear.clear();
+  GaugeVEV.Quadratic.clear();
+  for (std::size_t a = 0; a < nVEV; a++)
+  {
+    const std::size_t k = VevOrder[a];
+    for (std::size_t i = 0; i < NHiggs; i++)
+    {
+      for (std::size_t j = 0; j < NHiggs; j++)
+      {
+        HiggsVEV.Linear[a](i, j) = Curvature_Higgs_L3[i][j][k];
+      }
+    }
+    for (std::size_t b = a; b < nVEV; b++)
+    {
+      const std::size_t l   = VevOrder[b];
+      const double Symmetry = a == b ? 0.5 : 1;
+      MatrixXd HiggsQuadratic(NHiggs, NHiggs);
+      for (std::size_t i = 0; i < NHiggs; i++)
+      {
+        for (std::size_t j = 0; j < NHiggs; j++)
+        {
+          HiggsQuadratic(i, j) = Symmetry * Curvature_Higgs_L4[i][j][k][l];
+        }
+      }
+      HiggsVEV.Quadratic.push_back(HiggsQuadratic);
+      MatrixXd GaugeQuadratic(NGauge, NGauge);
+      for (std::size_t c = 0; c < NGauge; c++)
+      {
+        for (std::size_t d = 0; d < NGauge; d++)
+        {
+          GaugeQuadratic(c, d) = Symmetry * Curvature_Gauge_G2H2[c][d][k][l];
+        }
+      }
+      GaugeVEV.Quadratic.push_back(GaugeQuadratic);
+    }
+  }
+
+  auto SetFermionVEV = [&](VEVSubspaceExpansion<MatrixXcd> &FermionVEV,
+                           const MatrixXcd &F2,
+                           const auto &F2H1)
+  {
+    FermionVEV.Dimension = nVEV;
+    FermionVEV.Constant  = F2;
+    FermionVEV.Linear.assign(nVEV, MatrixXcd::Zero(F2.rows(), F2.cols()));
+    FermionVEV.Quadratic.clear();
+    for (std::size_t a = 0; a < nVEV; a++)
+    {
+      for (long I = 0; I < F2.rows(); I++)
+      {
+        for (long J = 0; J < F2.cols(); J++)
+        {
+          FermionVEV.Linear[a](I, J) = F2H1[I][J][VevOrder[a]];
+        }
+      }
+    }
+  };
+  SetFermionVEV(SparseCurvature.QuarkVEV,
+                SparseCurvature.QuarkF2,
+                Curvature_Quark_F2H1);
+  SetFermionVEV(SparseCurvature.LeptonVEV,
+                SparseCurvature.LeptonF2,
+                Curvature_Lepton_F2H1);
+
+  SparseCurvatureDone = true;
+  SetMassMatrixBlocks();
+}
+
+void Class_Potential_Origin::SetMassMatrixBlocks()
+{
+  if (not SparseCurvatureDone) return;
+  using Pattern = Eigen::Matrix<bool, Eigen::Dynamic, Eigen::Dynamic>;
+
+  auto &NonVEVDirections = SparseCurvature.NonVEVDirections;
+  NonVEVDirections.clear();
+  for (std::size_t i = 0; i < NHiggs; i++)
+  {
+    if (std::find(VevOrder.begin(), VevOrder.end(), i) == VevOrder.end())
+    {
+      NonVEVDirections.push_back(i);
+    }
+  }
+
+  auto AddPattern = [](Pattern &Entries, const auto &Matrix)
+  {
+    for (long i = 0; i < Entries.rows(); i++)
+    {
+      for (long j = 0; j < Entries.cols(); j++)
+      {
+        if (Matrix(i, j) != 0.) Entries(i, j) = true;
+      }
+    }
+  };
+  auto AddExpansionPattern = [&](Pattern &Entries, const auto &Expansion)
+  {
+    AddPattern(Entries, Expansion.Constant);
+    for (const auto &Coefficient : Expansion.Linear)
+      AddPattern(Entries, Coefficient);
+    for (const auto &Coefficient : Expansion.Quadratic)
+      AddPattern(Entries, Coefficient);
+  };
+  auto AddDebyePattern = [](Pattern &Entries, const auto &Debye)
+  {
+    for (std::size_t i = 0; i < Debye.size(); i++)
+    {
+      for (std::size_t j = 0; j < Debye[i].size(); j++)
+      {
+        if (Debye[i][j] != 0) Entries(i, j) = true;
+      }
+    }
+  };
+  // M^* M couples a and b if both couple to a common index
+  auto SquaredPattern = [](const Pattern &Entries)
+  {
+    Pattern res = Pattern::Constant(Entries.rows(), Entries.cols(), false);
+    for (long a = 0; a < Entries.rows(); a++)
+    {
+      for (long b = 0; b < Entries.cols(); b++)
+      {
+        for (long i = 0; i < Entries.cols(); i++)
+        {
+          if (Entries(a, i) and Entries(i, b)) res(a, b) = true;
+        }
+      }
+    }
+    return res;
+  };
+
+  Pattern HiggsPattern = Pattern::Constant(NHiggs, NHiggs, false);
+  AddExpansionPattern(HiggsPattern, SparseCurvature.HiggsVEV);
+  AddDebyePattern(HiggsPattern, DebyeHiggs);
+  SparseCurvature.HiggsBlocks = FindMatrixBlocks(HiggsPattern);
+
+  Pattern GaugePattern = Pattern::Constant(NGauge, NGauge, false);
+  AddExpansionPattern(GaugePattern, SparseCurvature.GaugeVEV);
+  AddDebyePattern(GaugePattern, DebyeGauge);
+  SparseCurvature.GaugeBlocks = FindMatrixBlocks(GaugePattern);
+
+  Pattern QuarkPattern = Pattern::Constant(NQuarks, NQuarks, false);
+  AddExpansionPattern(QuarkPattern, SparseCurvature.QuarkVEV);
+  SparseCurvature.QuarkBlocks = FindMatrixBlocks(SquaredPattern(QuarkPattern));
+
+  Pattern LeptonPattern = Pattern::Constant(NLepton, NLepton, false);
+  AddExpansionPattern(LeptonPattern, SparseCurvature.LeptonVEV);
+  SparseCurvature.LeptonBlocks =
+      FindMatrixBlocks(SquaredPattern(LeptonPattern));
+
+  if (Kernel) Kernel->Update(SparseCurvature, DebyeHiggs, DebyeGauge, NColour);
+}
+
+void Class_Potential_Origin::SetV1LoopKernel(
+    std::unique_ptr<V1LoopKernel> KernelIn)
+{
+  if (KernelIn and KernelIn->Dimensions() !=
+                       std::array<std::size_t, 4>{
+                           {NHiggs, NGauge, NQuarks, NLepton}})
+  {
+    throw std::runtime_error("The dimensions of the V1LoopKernel do not match "
+                             "the mass matrices of the model.");
+  }
+  if (KernelIn and SparseCurvatureDone)
+  {
+    KernelIn->Update(SparseCurvature, DebyeHiggs, DebyeGauge, NColour);
+  }
+  Kernel = std::move(KernelIn);
+}
+
 void Class_Potential_Origin::resetbools()
 {
   SetCurvatureDone          = false;
+  SparseCurvatureDone       = false;
   CalcCouplingsdone         = false;
   CalculatedTripleCopulings = false;
   parStored.clear();
@@ -3615,6 +5209,13 @@ void Class_Potential_Origin::CheckImplementation(
         ModelTests::CheckVCounterSimplified(*this)));
   }
 
+  if (UseMassMatricesSimplified)
+  {
+    TestNames.push_back("Checking the simplified mass matrices");
+    TestResults.push_back(ModelTests::TestResultsToString(
+        ModelTests::CheckMassMatricesSimplified(*this)));
+  }
+
   TestNames.push_back("Checking second derivative of CW+CT");
   TestResults.push_back(ModelTests::TestResultsToString(
       ModelTests::CheckCTConditionsSecondDerivative(*this)));
@@ -3748,6 +5349,18 @@ void Class_Potential_Origin::SetUseTreeLevel(bool val)
   UseTreeLevel = val;
 }
 
+void Class_Potential_Origin::SetThermalDerivativeMethod(
+    ThermalDerivativeMethod Method)
+{
+  ThermalDerivatives = Method;
+}
+
+void Class_Potential_Origin::SetThermalFunctionMethod(
+    ThermalFunctionMethod Method)
+{
+  ThermalValues = Method;
+}
+
 std::pair<std::vector<double>, std::vector<double>>
 Class_Potential_Origin::initModel(std::string linestr)
 {
@@ -3809,6 +5422,11 @@ Class_Potential_Origin::QuarkMassMatrix(const std::vector<double> &v) const
         std::to_string(NHiggs) + std::string(".");
     throw std::runtime_error(ErrorString);
   }
+  if (v.size() == nVEV and nVEV != NHiggs and SparseCurvatureDone)
+  {
+    FillQuarkMassMatrix(v, MIJ);
+    return MIJ;
+  }
   if (v.size() == nVEV and nVEV != NHiggs)
   {
     std::stringstream ss;
@@ -3832,21 +5450,118 @@ Class_Potential_Origin::QuarkMassMatrix(const std::vector<double> &v) const
     throw std::runtime_error(retmes);
   }
 
-  MIJ = MatrixXcd::Zero(NQuarks, NQuarks);
+  FillQuarkMassMatrix(v, MIJ);
+  return MIJ;
+}
+
+namespace
+{
+[[noreturn]] void ThrowMissingSimplified(const std::string &Function)
+{
+  throw std::runtime_error(
+      Function + " is not implemented by the model but "
+                 "UseMassMatricesSimplified is set.");
+}
+} // namespace
+
+void Class_Potential_Origin::HiggsMassMatrixSimplified(
+    const std::vector<double> &,
+    MatrixXd &) const
+{
+  ThrowMissingSimplified(__func__);
+}
+
+void Class_Potential_Origin::HiggsMassMatrixDerivativeSimplified(
+    const std::vector<double> &,
+    std::size_t,
+    MatrixXd &) const
+{
+  ThrowMissingSimplified(__func__);
+}
+
+void Class_Potential_Origin::GaugeMassMatrixSimplified(
+    const std::vector<double> &,
+    MatrixXd &) const
+{
+  ThrowMissingSimplified(__func__);
+}
+
+void Class_Potential_Origin::GaugeMassMatrixDerivativeSimplified(
+    const std::vector<double> &,
+    std::size_t,
+    MatrixXd &) const
+{
+  ThrowMissingSimplified(__func__);
+}
+
+void Class_Potential_Origin::QuarkMassMatrixSimplified(
+    const std::vector<double> &,
+    MatrixXcd &) const
+{
+  ThrowMissingSimplified(__func__);
+}
+
+void Class_Potential_Origin::QuarkMassMatrixDerivativeSimplified(
+    const std::vector<double> &,
+    std::size_t,
+    MatrixXcd &) const
+{
+  ThrowMissingSimplified(__func__);
+}
+
+void Class_Potential_Origin::LeptonMassMatrixSimplified(
+    const std::vector<double> &,
+    MatrixXcd &) const
+{
+  ThrowMissingSimplified(__func__);
+}
+
+void Class_Potential_Origin::LeptonMassMatrixDerivativeSimplified(
+    const std::vector<double> &,
+    std::size_t,
+    MatrixXcd &) const
+{
+  ThrowMissingSimplified(__func__);
+}
+
+void Class_Potential_Origin::FillQuarkMassMatrix(const std::vector<double> &v,
+                                                 MatrixXcd &res) const
+{
+  if (v.size() == nVEV and nVEV != NHiggs)
+  {
+    SparseCurvature.QuarkVEV.EvaluateInto(v, res);
+    return;
+  }
+
+  res.resize(NQuarks, NQuarks);
+  if (UseMassMatricesSimplified)
+  {
+    QuarkMassMatrixSimplified(v, res);
+    return;
+  }
+  if (SparseCurvatureDone)
+  {
+    res              = SparseCurvature.QuarkF2;
+    const auto &F2H1 = SparseCurvature.QuarkF2H1;
+    for (std::size_t n = 0; n < F2H1.size(); n++)
+    {
+      const auto &Index = F2H1.Indices[n];
+      res(Index[0], Index[1]) += F2H1.Values[n] * v[Index[2]];
+    }
+    return;
+  }
 
   for (std::size_t i = 0; i < NQuarks; i++)
   {
     for (std::size_t j = 0; j < NQuarks; j++)
     {
-      MIJ(i, j) = Curvature_Quark_F2[i][j];
+      res(i, j) = Curvature_Quark_F2[i][j];
       for (std::size_t k = 0; k < NHiggs; k++)
       {
-        MIJ(i, j) += Curvature_Quark_F2H1[i][j][k] * v[k];
+        res(i, j) += Curvature_Quark_F2H1[i][j][k] * v[k];
       }
     }
   }
-
-  return MIJ;
 }
 
 std::vector<std::complex<double>>
@@ -3885,6 +5600,11 @@ Class_Potential_Origin::LeptonMassMatrix(const std::vector<double> &v) const
         std::to_string(NHiggs) + std::string(".");
     throw std::runtime_error(ErrorString);
   }
+  if (v.size() == nVEV and nVEV != NHiggs and SparseCurvatureDone)
+  {
+    FillLeptonMassMatrix(v, res);
+    return res;
+  }
   if (v.size() == nVEV and nVEV != NHiggs)
   {
     std::stringstream ss;
@@ -3908,6 +5628,37 @@ Class_Potential_Origin::LeptonMassMatrix(const std::vector<double> &v) const
     throw std::runtime_error(retmes);
   }
 
+  FillLeptonMassMatrix(v, res);
+  return res;
+}
+
+void Class_Potential_Origin::FillLeptonMassMatrix(const std::vector<double> &v,
+                                                  MatrixXcd &res) const
+{
+  if (v.size() == nVEV and nVEV != NHiggs)
+  {
+    SparseCurvature.LeptonVEV.EvaluateInto(v, res);
+    return;
+  }
+
+  res.resize(NLepton, NLepton);
+  if (UseMassMatricesSimplified)
+  {
+    LeptonMassMatrixSimplified(v, res);
+    return;
+  }
+  if (SparseCurvatureDone)
+  {
+    res              = SparseCurvature.LeptonF2;
+    const auto &F2H1 = SparseCurvature.LeptonF2H1;
+    for (std::size_t n = 0; n < F2H1.size(); n++)
+    {
+      const auto &Index = F2H1.Indices[n];
+      res(Index[0], Index[1]) += F2H1.Values[n] * v[Index[2]];
+    }
+    return;
+  }
+
   for (std::size_t i = 0; i < NLepton; i++)
   {
     for (std::size_t j = 0; j < NLepton; j++)
@@ -3919,8 +5670,6 @@ Class_Potential_Origin::LeptonMassMatrix(const std::vector<double> &v) const
       }
     }
   }
-
-  return res;
 }
 
 std::vector<std::complex<double>>
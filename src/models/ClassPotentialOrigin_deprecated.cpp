@@ -16,6 +16,7 @@
 #include <BSMPT/ThermalFunctions/ThermalFunctions.h>
 #include <BSMPT/minimizer/Minimizer.h>
 #include <BSMPT/models/ClassPotentialOrigin.h>
+#include <BSMPT/models/FixedDimensionKernel.h>
 #include <BSMPT/models/IncludeAllModels.h>
 #include <BSMPT/utility/Logger.h>
 #include <BSMPT/utility/utility.h>
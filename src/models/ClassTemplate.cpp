@@ -60,6 +60,10 @@ Class_Template::Class_Template(const ISMConstants &smConstants)
   // Set UseVCounterSimplified to use the counterterm potential defined in
   // VCounterSimplified
   UseVCounterSimplified = false;
+
+  // Set UseMassMatricesSimplified to use the mass matrices defined in
+  // HiggsMassMatrixSimplified etc. instead of contracting the curvature tensors
+  UseMassMatricesSimplified = true;
 }
 
 Class_Template::~Class_Template()
@@ -440,6 +444,106 @@ double Class_Template::VCounterSimplified(const std::vector<double> &v) const
   return res;
 }
 
+/*
+ * The simplified mass matrices below were generated with
+ * tools/ModelGeneration/sympy, see ModelGenerator.printMassMatrices and
+ * ModelGenerator.printMassMatrixDerivatives. The field dependent mass matrices
+ * are given for all NHiggs fields and the matrices are already sized.
+ */
+void Class_Template::HiggsMassMatrixSimplified(const std::vector<double> &v,
+                                               MatrixXd &res) const
+{
+  res.setZero();
+  const double phi = v[0];
+  res(0, 0)        = (1.0 / 2.0) * lambda * std::pow(phi, 2) + ms;
+}
+
+void Class_Template::HiggsMassMatrixDerivativeSimplified(
+    const std::vector<double> &v,
+    std::size_t k,
+    MatrixXd &res) const
+{
+  res.setZero();
+  switch (k)
+  {
+  case 0:
+  {
+    const double phi = v[0];
+    res(0, 0)        = lambda * phi;
+    break;
+  }
+  default: break;
+  }
+}
+
+void Class_Template::GaugeMassMatrixSimplified(const std::vector<double> &v,
+                                               MatrixXd &res) const
+{
+  res.setZero();
+  const double phi = v[0];
+  res(0, 0)        = 2 * std::pow(g, 2) * std::pow(phi, 2);
+}
+
+void Class_Template::GaugeMassMatrixDerivativeSimplified(
+    const std::vector<double> &v,
+    std::size_t k,
+    MatrixXd &res) const
+{
+  res.setZero();
+  switch (k)
+  {
+  case 0:
+  {
+    const double phi = v[0];
+    res(0, 0)        = 4 * std::pow(g, 2) * phi;
+    break;
+  }
+  default: break;
+  }
+}
+
+void Class_Template::QuarkMassMatrixSimplified(const std::vector<double> &v,
+                                               MatrixXcd &res) const
+{
+  res.setZero();
+  const double phi                = v[0];
+  const std::complex<double> cse0 = phi * yt;
+  res(0, 1)                       = cse0;
+  res(1, 0)                       = cse0;
+}
+
+void Class_Template::QuarkMassMatrixDerivativeSimplified(
+    const std::vector<double> &,
+    std::size_t k,
+    MatrixXcd &res) const
+{
+  res.setZero();
+  switch (k)
+  {
+  case 0:
+  {
+    res(0, 1) = yt;
+    res(1, 0) = yt;
+    break;
+  }
+  default: break;
+  }
+}
+
+void Class_Template::LeptonMassMatrixSimplified(const std::vector<double> &,
+                                                MatrixXcd &res) const
+{
+  res.setZero();
+}
+
+void Class_Template::LeptonMassMatrixDerivativeSimplified(
+    const std::vector<double> &,
+    std::size_t,
+    MatrixXcd &res) const
+{
+  res.setZero();
+}
+
 void Class_Template::Debugging(const std::vector<double> &input,
                                std::vector<double> &output) const
 {
@@ -19,6 +19,7 @@
 
 #include <BSMPT/models/ClassTemplate.h>
 #include <BSMPT/models/ClassPotentialVDM.h>
+#include <BSMPT/models/FixedDimensionKernel.h>
 #include <BSMPT/utility/Logger.h>
 
 namespace BSMPT
@@ -31,32 +32,43 @@ std::unique_ptr<Class_Potential_Origin> FChoose(ModelIDs choice)
   return FChoose(choice, GetSMConstants());
 }
 
+namespace
+{
+/**
+ * @brief MakeModel creates the model ModelType and attaches the
+ * FixedDimensionKernel matching its dimensions
+ */
+template <typename ModelType, int NHiggs, int NGauge, int NQuarks, int NLepton>
+std::unique_ptr<Class_Potential_Origin>
+MakeModel(const ISMConstants &smConstants)
+{
+  auto model = std::make_unique<ModelType>(smConstants);
+  model->SetV1LoopKernel(
+      std::make_unique<
+          FixedDimensionKernel<NHiggs, NGauge, NQuarks, NLepton>>());
+  return model;
+}
+} // namespace
+
 std::unique_ptr<Class_Potential_Origin> FChoose(ModelIDs choice,
                                                 const ISMConstants &smConstants)
 {
   using namespace Models;
   switch (choice)
   {
-  case ModelIDs::SM: return std::make_unique<Class_SM>(smConstants); break;
+  case ModelIDs::SM: return MakeModel<Class_SM, 4, 4, 12, 9>(smConstants);
   case ModelIDs::R2HDM:
-    return std::make_unique<Class_Potential_R2HDM>(smConstants);
-    break;
+    return MakeModel<Class_Potential_R2HDM, 8, 4, 12, 9>(smConstants);
   case ModelIDs::C2HDM:
-    return std::make_unique<Class_Potential_C2HDM>(smConstants);
-    break;
+    return MakeModel<Class_Potential_C2HDM, 8, 4, 12, 9>(smConstants);
   case ModelIDs::N2HDM:
-    return std::make_unique<Class_Potential_N2HDM>(smConstants);
-    break;
-  case ModelIDs::CXSM: return std::make_unique<Class_CxSM>(smConstants); break;
+    return MakeModel<Class_Potential_N2HDM, 9, 4, 12, 9>(smConstants);
+  case ModelIDs::CXSM: return MakeModel<Class_CxSM, 6, 4, 12, 9>(smConstants);
   case ModelIDs::CPINTHEDARK:
-    return std::make_unique<Class_Potential_CPintheDark>(smConstants);
-    break;
+    return MakeModel<Class_Potential_CPintheDark, 9, 4, 12, 9>(smConstants);
   case ModelIDs::TEMPLATE:
-    return std::make_unique<Class_Template>(smConstants);
-    break;
-  case ModelIDs::VDM:
-    return std::make_unique<Class_VDM>(smConstants);
-    break;
+    return MakeModel<Class_Template, 1, 4, 12, 9>(smConstants);
+  case ModelIDs::VDM: return MakeModel<Class_VDM, 6, 5, 12, 9>(smConstants);
   default: throw std::runtime_error("Invalid model");
   }
 }
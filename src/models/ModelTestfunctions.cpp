@@ -643,6 +643,154 @@ TestResults CheckVCounterSimplified(const Class_Potential_Origin &point)
   return result;
 }
 
+TestResults CheckMassMatricesSimplified(const Class_Potential_Origin &point)
+{
+  using namespace Eigen;
+  const std::size_t NHiggs  = point.get_NHiggs();
+  const std::size_t NGauge  = point.get_NGauge();
+  const std::size_t NQuarks = point.get_NQuarks();
+  const std::size_t NLepton = point.get_NLepton();
+
+  const auto &L2         = point.Get_Curvature_Higgs_L2();
+  const auto &L3         = point.Get_Curvature_Higgs_L3();
+  const auto &L4         = point.Get_Curvature_Higgs_L4();
+  const auto &G2H2       = point.Get_Curvature_Gauge_G2H2();
+  const auto &QuarkF2    = point.Get_Curvature_Quark_F2();
+  const auto &QuarkF2H1  = point.Get_Curvature_Quark_F2H1();
+  const auto &LeptonF2   = point.Get_Curvature_Lepton_F2();
+  const auto &LeptonF2H1 = point.Get_Curvature_Lepton_F2H1();
+
+  std::default_random_engine randGen(0);
+  double RNDMax = 500;
+  std::vector<double> v(NHiggs);
+  double Difference = 0;
+
+  auto RelativeDifference = [](const auto &Simplified, const auto &Tensor)
+  {
+    double Norm = Simplified.norm() + Tensor.norm();
+    return (Norm == 0) ? 0 : (Simplified - Tensor).norm() / Norm;
+  };
+
+  for (int n = 0; n < 10; n++)
+  {
+    for (std::size_t i = 0; i < NHiggs; i++)
+      v.at(i) =
+          RNDMax *
+          (-1 +
+           2 * std::generate_canonical<double,
+                                       std::numeric_limits<double>::digits>(
+                   randGen));
+
+    MatrixXd Higgs(NHiggs, NHiggs), HiggsTensor(NHiggs, NHiggs);
+    MatrixXd Gauge(NGauge, NGauge), GaugeTensor(NGauge, NGauge);
+    MatrixXcd Quark(NQuarks, NQuarks), QuarkTensor(NQuarks, NQuarks);
+    MatrixXcd Lepton(NLepton, NLepton), LeptonTensor(NLepton, NLepton);
+
+    point.HiggsMassMatrixSimplified(v, Higgs);
+    point.GaugeMassMatrixSimplified(v, Gauge);
+    point.QuarkMassMatrixSimplified(v, Quark);
+    point.LeptonMassMatrixSimplified(v, Lepton);
+    for (std::size_t i = 0; i < NHiggs; i++)
+    {
+      for (std::size_t j = 0; j < NHiggs; j++)
+      {
+        HiggsTensor(i, j) = L2[i][j];
+        for (std::size_t k = 0; k < NHiggs; k++)
+        {
+          HiggsTensor(i, j) += L3[i][j][k] * v[k];
+          for (std::size_t l = 0; l < NHiggs; l++)
+            HiggsTensor(i, j) += 0.5 * L4[i][j][k][l] * v[k] * v[l];
+        }
+      }
+    }
+    for (std::size_t a = 0; a < NGauge; a++)
+    {
+      for (std::size_t b = 0; b < NGauge; b++)
+      {
+        GaugeTensor(a, b) = 0;
+        for (std::size_t i = 0; i < NHiggs; i++)
+        {
+          for (std::size_t j = 0; j < NHiggs; j++)
+            GaugeTensor(a, b) += 0.5 * G2H2[a][b][i][j] * v[i] * v[j];
+        }
+      }
+    }
+    for (std::size_t a = 0; a < NQuarks; a++)
+    {
+      for (std::size_t b = 0; b < NQuarks; b++)
+      {
+        QuarkTensor(a, b) = QuarkF2[a][b];
+        for (std::size_t k = 0; k < NHiggs; k++)
+          QuarkTensor(a, b) += QuarkF2H1[a][b][k] * v[k];
+      }
+    }
+    for (std::size_t a = 0; a < NLepton; a++)
+    {
+      for (std::size_t b = 0; b < NLepton; b++)
+      {
+        LeptonTensor(a, b) = LeptonF2[a][b];
+        for (std::size_t k = 0; k < NHiggs; k++)
+          LeptonTensor(a, b) += LeptonF2H1[a][b][k] * v[k];
+      }
+    }
+    Difference += RelativeDifference(Higgs, HiggsTensor) +
+                  RelativeDifference(Gauge, GaugeTensor) +
+                  RelativeDifference(Quark, QuarkTensor) +
+                  RelativeDifference(Lepton, LeptonTensor);
+
+    for (std::size_t k = 0; k < NHiggs; k++)
+    {
+      point.HiggsMassMatrixDerivativeSimplified(v, k, Higgs);
+      point.GaugeMassMatrixDerivativeSimplified(v, k, Gauge);
+      point.QuarkMassMatrixDerivativeSimplified(v, k, Quark);
+      point.LeptonMassMatrixDerivativeSimplified(v, k, Lepton);
+      for (std::size_t i = 0; i < NHiggs; i++)
+      {
+        for (std::size_t j = 0; j < NHiggs; j++)
+        {
+          HiggsTensor(i, j) = L3[i][j][k];
+          for (std::size_t l = 0; l < NHiggs; l++)
+            HiggsTensor(i, j) += L4[i][j][k][l] * v[l];
+        }
+      }
+      for (std::size_t a = 0; a < NGauge; a++)
+      {
+        for (std::size_t b = 0; b < NGauge; b++)
+        {
+          GaugeTensor(a, b) = 0;
+          for (std::size_t j = 0; j < NHiggs; j++)
+            GaugeTensor(a, b) += G2H2[a][b][k][j] * v[j];
+        }
+      }
+      for (std::size_t a = 0; a < NQuarks; a++)
+      {
+        for (std::size_t b = 0; b < NQuarks; b++)
+          QuarkTensor(a, b) = QuarkF2H1[a][b][k];
+      }
+      for (std::size_t a = 0; a < NLepton; a++)
+      {
+        for (std::size_t b = 0; b < NLepton; b++)
+          LeptonTensor(a, b) = LeptonF2H1[a][b][k];
+      }
+      Difference += RelativeDifference(Higgs, HiggsTensor) +
+                    RelativeDifference(Gauge, GaugeTensor) +
+                    RelativeDifference(Quark, QuarkTensor) +
+                    RelativeDifference(Lepton, LeptonTensor);
+    }
+  }
+
+  if (Difference > 1e-8)
+  {
+    Logger::Write(LoggingLevel::Default,
+                  "You provided simplified versions of the mass matrices but "
+                  "they yield different results for the same input compared "
+                  "to the contraction of the curvature tensors. Recheck your "
+                  "implementation of the simplified mass matrices.");
+    return TestResults::Fail;
+  }
+  return TestResults::Pass;
+}
+
 TestResults CheckCKMUnitarity(const ISMConstants &SMConstants)
 {
   using namespace Eigen;
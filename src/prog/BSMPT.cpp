@@ -15,6 +15,7 @@
 #include <BSMPT/minimizer/Minimizer.h>
 #include <BSMPT/models/ClassPotentialOrigin.h> // for Class_Potential_Origin
 #include <BSMPT/models/IncludeAllModels.h>
+#include <BSMPT/utility/EvaluationBudget.h>
 #include <BSMPT/utility/Logger.h>
 #include <BSMPT/utility/utility.h>
 #include <algorithm> // for copy, max
@@ -43,6 +44,8 @@ struct CLIOptions
   bool UseNLopt{Minimizer::UseNLoptDefault};
   int WhichMinimizer{Minimizer::WhichMinimizerDefault};
   bool UseMultithreading{true};
+  unsigned int MaxEvaluations{0};
+  double MaxWallTime{0};
 
   CLIOptions(const BSMPT::parser &argparser);
   bool good() const;
@@ -116,8 +119,14 @@ try
         modelPointer->write();
       }
 
-      auto EWPT = Minimizer::PTFinder_gen_all(
-          modelPointer, 0, 300, args.WhichMinimizer, args.UseMultithreading);
+      EvaluationBudget Budget(args.MaxEvaluations, args.MaxWallTime);
+      auto EWPT = Minimizer::PTFinder_gen_all(modelPointer,
+                                              0,
+                                              300,
+                                              args.WhichMinimizer,
+                                              args.UseMultithreading,
+                                              false,
+                                              &Budget);
       std::vector<double> vevsymmetricSolution, checksym, startpoint;
       for (const auto &el : EWPT.EWMinimum)
         startpoint.push_back(0.5 * el);
@@ -194,6 +203,14 @@ try
                         dimensionnames.at(1) + " < " + std::to_string(C_PT) +
                             " found.");
         }
+        else if (EWPT.StatusFlag ==
+                 Minimizer::MinimizerStatus::BUDGETEXHAUSTED)
+        {
+          Logger::Write(LoggingLevel::Default,
+                        "The evaluation budget was used up after " +
+                            std::to_string(Budget.Evaluations()) +
+                            " evaluations.");
+        }
       }
       if (PrintErrorLines)
       {
@@ -285,6 +302,22 @@ CLIOptions::CLIOptions(const BSMPT::parser &argparser)
   {
   }
 
+  try
+  {
+    MaxEvaluations = argparser.get_value<unsigned int>("maxEvaluations");
+  }
+  catch (BSMPT::parserException &)
+  {
+  }
+
+  try
+  {
+    MaxWallTime = argparser.get_value<double>("maxWallTime");
+  }
+  catch (BSMPT::parserException &)
+  {
+  }
+
   WhichMinimizer = Minimizer::CalcWhichMinimizer(UseGSL, UseCMAES, UseNLopt);
 }
 
@@ -352,6 +385,14 @@ BSMPT::parser prepare_parser()
       "y/n Turns on additional information in the terminal during "
       "the calculation.",
       false);
+  argparser.add_argument("maxEvaluations",
+                         "Maximal number of evaluations of the effective "
+                         "potential per parameter point, 0 means no limit.",
+                         false);
+  argparser.add_argument("maxWallTime",
+                         "Maximal wall time in seconds per parameter point, 0 "
+                         "means no limit.",
+                         false);
 
   std::stringstream ss;
   ss << "BSMPT calculates the strength of the electroweak phase transition"
@@ -46,7 +46,11 @@ struct CLIOptions
   double perc_prbl{.71};
   double compl_prbl{.01};
   int num_check_pts{10};
+  int num_refinements{0};
   int CheckNLOStability{1};
+  unsigned int MaxEvaluations{0};
+  double MaxWallTime{0};
+  bool UsePredictorCorrector{false};
 
   CLIOptions(const BSMPT::parser &argparser);
   bool good() const;
@@ -136,6 +140,10 @@ try
                        args.WhichMinimizer,
                        args.UseMultithreading,
                        false};
+      input.max_evaluations         = args.MaxEvaluations;
+      input.max_wall_time           = args.MaxWallTime;
+      input.use_predictor_corrector = args.UsePredictorCorrector;
+      input.num_refinements         = args.num_refinements;
 
       TransitionTracer trans(input);
 
@@ -334,6 +342,11 @@ bool CLIOptions::good() const
     Logger::Write(LoggingLevel::Default, "Invalid choice for num_check_pts.");
     return false;
   }
+  if (num_refinements < 0)
+  {
+    Logger::Write(LoggingLevel::Default, "Invalid choice for num_refinements.");
+    return false;
+  }
   if (CheckEWSymmetryRestoration > 2 or CheckEWSymmetryRestoration < 0)
   {
     Logger::Write(LoggingLevel::Default,
@@ -457,6 +470,16 @@ CLIOptions::CLIOptions(const BSMPT::parser &argparser)
        << "\n";
   }
 
+  try
+  {
+    num_refinements = argparser.get_value<int>("num_refinements");
+  }
+  catch (BSMPT::parserException &)
+  {
+    ss << "--num_refinements not set, using default value: "
+       << num_refinements << "\n";
+  }
+
   try
   {
     UserDefined_vwall = argparser.get_value<double>("vwall");
@@ -538,6 +561,33 @@ CLIOptions::CLIOptions(const BSMPT::parser &argparser)
        << MaxPathIntegrations << "\n";
   }
 
+  try
+  {
+    MaxEvaluations = argparser.get_value<unsigned int>("maxevaluations");
+  }
+  catch (BSMPT::parserException &)
+  {
+    ss << "--maxevaluations not set, using default value: no limit\n";
+  }
+
+  try
+  {
+    MaxWallTime = argparser.get_value<double>("maxwalltime");
+  }
+  catch (BSMPT::parserException &)
+  {
+    ss << "--maxwalltime not set, using default value: no limit\n";
+  }
+
+  try
+  {
+    UsePredictorCorrector = (argparser.get_value("tracingmode") == "pc");
+  }
+  catch (BSMPT::parserException &)
+  {
+    ss << "--tracingmode not set, using default value: fixed\n";
+  }
+
   WhichMinimizer = Minimizer::CalcWhichMinimizer(UseGSL, UseCMAES, UseNLopt);
 
   Logger::Write(LoggingLevel::ProgDetailed, ss.str());
@@ -566,6 +616,10 @@ BSMPT::parser prepare_parser()
   argparser.add_subtext("auto: automatic mode");
   argparser.add_argument(
       "num_pts", "intermediate grid-size for default mode", "10", false);
+  argparser.add_argument("num_refinements",
+                         "refinements of the grid at phase boundaries",
+                         "0",
+                         false);
   argparser.add_argument(
       "vwall", "wall velocity: >0 user defined", "0.95", false);
   argparser.add_subtext("-1: approximation");
@@ -589,6 +643,18 @@ BSMPT::parser prepare_parser()
                          "7",
                          false);
   argparser.add_subtext("number of path deformations + 1");
+  argparser.add_argument("maxevaluations",
+                         "max. evaluations of the potential per point",
+                         "0",
+                         false);
+  argparser.add_subtext("0: no limit");
+  argparser.add_argument(
+      "maxwalltime", "max. wall time per point [s]", "0", false);
+  argparser.add_subtext("0: no limit");
+  argparser.add_argument(
+      "tracingmode", "temperature steps of the phase tracing", "fixed", false);
+  argparser.add_subtext("fixed: capped at the initial step size");
+  argparser.add_subtext("pc: adaptive predictor-corrector steps");
 
   std::string GSLhelp   = Minimizer::UseGSLDefault ? "true" : "false";
   std::string CMAEShelp = Minimizer::UseLibCMAESDefault ? "true" : "false";
@@ -117,6 +117,23 @@ try
 
   double temp = args.Temperature;
 
+  // Evaluates the potential on all points of a grid with one call of
+  // VEffBatch
+  auto VEffGrid = [&](const std::vector<std::vector<double>> &grid)
+  {
+    Eigen::MatrixXd Points(grid.size(), modelPointer->get_nVEV());
+    for (std::size_t row = 0; row < grid.size(); row++)
+    {
+      for (std::size_t col = 0; col < grid.at(row).size(); col++)
+      {
+        Points(row, col) = grid.at(row).at(col);
+      }
+    }
+    std::vector<double> res;
+    modelPointer->VEffBatch(Points, temp, res, true);
+    return res;
+  };
+
   if (args.use_slice_plotter)
   {
     if ((args.min_end.size() == args.min_start.size()) and
@@ -136,12 +153,11 @@ try
 
       auto grid_points =
           Create1DimGrid(args.min_start, args.min_end, args.npoints);
-      for (auto point : grid_points)
+      auto grid_potential = VEffGrid(grid_points);
+      for (std::size_t k = 0; k < grid_points.size(); k++)
       {
-        outfile << point << sep
-                << modelPointer->VEff(modelPointer->MinimizeOrderVEV(point),
-                                      temp)
-                << sep << temp << std::endl;
+        outfile << grid_points.at(k) << sep << grid_potential.at(k) << sep
+                << temp << std::endl;
       }
     }
     else
@@ -190,6 +206,20 @@ try
 
     std::vector<double> vevStartIni = vevStart;
 
+    const double VEffStart =
+        modelPointer->VEff(modelPointer->MinimizeOrderVEV(vevStart), temp);
+    auto WriteGrid = [&](const std::vector<std::vector<double>> &grid)
+    {
+      auto grid_potential = VEffGrid(grid);
+      for (std::size_t k = 0; k < grid.size(); k++)
+      {
+        outfile << grid.at(k) << sep;
+        outfile << vevStart << sep;
+        outfile << grid_potential.at(k) << sep;
+        outfile << VEffStart << sep << temp << std::endl;
+      }
+    };
+
     std::vector<int> npoints = {args.npoints1,
                                 args.npoints2,
                                 args.npoints3,
@@ -216,17 +246,7 @@ try
 
       if (modelPointer->get_nVEV() == 1)
       {
-        for (std::vector<double> a1 : res_vec_outer)
-        {
-          outfile << a1 << sep;
-          outfile << vevStart << sep;
-          outfile << modelPointer->VEff(modelPointer->MinimizeOrderVEV(a1),
-                                        temp)
-                  << sep;
-          outfile << modelPointer->VEff(
-                         modelPointer->MinimizeOrderVEV(vevStart), temp)
-                  << sep << temp << std::endl;
-        }
+        WriteGrid(res_vec_outer);
       }
       else if (i + 1 < modelPointer->get_nVEV())
       {
@@ -237,17 +257,7 @@ try
 
           if (modelPointer->get_nVEV() == 2)
           {
-            for (std::vector<double> a2 : res_vec_inner_1)
-            {
-              outfile << a2 << sep;
-              outfile << vevStart << sep;
-              outfile << modelPointer->VEff(modelPointer->MinimizeOrderVEV(a2),
-                                            temp)
-                      << sep;
-              outfile << modelPointer->VEff(
-                             modelPointer->MinimizeOrderVEV(vevStart), temp)
-                      << sep << temp << std::endl;
-            }
+            WriteGrid(res_vec_inner_1);
           }
           else if (i + 2 < modelPointer->get_nVEV())
           {
@@ -258,17 +268,7 @@ try
 
               if (modelPointer->get_nVEV() == 3)
               {
-                for (std::vector<double> a3 : res_vec_inner_2)
-                {
-                  outfile << a3 << sep;
-                  outfile << vevStart << sep;
-                  outfile << modelPointer->VEff(
-                                 modelPointer->MinimizeOrderVEV(a3), temp)
-                          << sep;
-                  outfile << modelPointer->VEff(
-                                 modelPointer->MinimizeOrderVEV(vevStart), temp)
-                          << sep << temp << std::endl;
-                }
+                WriteGrid(res_vec_inner_2);
               }
               else if (i + 3 < modelPointer->get_nVEV())
               {
@@ -279,18 +279,7 @@ try
 
                   if (modelPointer->get_nVEV() == 4)
                   {
-                    for (std::vector<double> a4 : res_vec_inner_3)
-                    {
-                      outfile << a4 << sep;
-                      outfile << vevStart << sep;
-                      outfile << modelPointer->VEff(
-                                     modelPointer->MinimizeOrderVEV(a4), temp)
-                              << sep;
-                      outfile
-                          << modelPointer->VEff(
-                                 modelPointer->MinimizeOrderVEV(vevStart), temp)
-                          << sep << temp << std::endl;
-                    }
+                    WriteGrid(res_vec_inner_3);
                   }
                   else if (i + 4 < modelPointer->get_nVEV())
                   {
@@ -301,20 +290,7 @@ try
 
                       if (modelPointer->get_nVEV() == 5)
                       {
-                        for (std::vector<double> a5 : res_vec_inner_4)
-                        {
-                          outfile << a5 << sep;
-                          outfile << vevStart << sep;
-                          outfile
-                              << modelPointer->VEff(
-                                     modelPointer->MinimizeOrderVEV(a5), temp)
-                              << sep;
-                          outfile
-                              << modelPointer->VEff(
-                                     modelPointer->MinimizeOrderVEV(vevStart),
-                                     temp)
-                              << sep << temp << std::endl;
-                        }
+                        WriteGrid(res_vec_inner_4);
                       }
                       else if (i + 5 < modelPointer->get_nVEV())
                       {
@@ -325,20 +301,7 @@ try
 
                           if (modelPointer->get_nVEV() == 6)
                           {
-                            for (std::vector<double> a6 : res_vec_inner_5)
-                            {
-                              outfile << a6 << sep;
-                              outfile << vevStart << sep;
-                              outfile << modelPointer->VEff(
-                                             modelPointer->MinimizeOrderVEV(a6),
-                                             temp)
-                                      << sep;
-                              outfile << modelPointer->VEff(
-                                             modelPointer->MinimizeOrderVEV(
-                                                 vevStart),
-                                             temp)
-                                      << sep << temp << std::endl;
-                            }
+                            WriteGrid(res_vec_inner_5);
                           }
                           else if (i + 6 < modelPointer->get_nVEV())
                           {
@@ -39,6 +39,7 @@ struct CLIOptions
   bool UseNLopt{Minimizer::UseNLoptDefault};
   int WhichMinimizer{Minimizer::WhichMinimizerDefault};
   bool UseMultithreading{true};
+  bool SkipRandomStarts{false};
 
   CLIOptions(const BSMPT::parser &argparser);
   bool good() const;
@@ -108,13 +109,37 @@ try
   }
 
   std::vector<double> Check;
-  double vev{0.0};
+  // The minima of the previous temperatures are continued to the next one
+  Minimizer::MinimumContinuation WarmStart(args.SkipRandomStarts);
 
   outfile << std::setprecision(16);
 
   outfile << "T" << sep << "v" << sep << modelPointer->addLegendVEV() << sep
           << "Veff(v,T)" << std::endl;
 
+  // The global minimum often stays at the same point over a range of
+  // temperatures, e.g. in the symmetric phase. The potential is then only
+  // evaluated once for the whole range, which is written as soon as the
+  // minimum moves on.
+  std::vector<double> Temps;
+  std::vector<double> RangeSolution;
+  auto WriteRange = [&]()
+  {
+    if (Temps.empty()) return;
+    solPot          = modelPointer->MinimizeOrderVEV(RangeSolution);
+    const auto vev  = modelPointer->EWSBVEV(solPot);
+    auto Potentials = modelPointer->VEffMultiT(solPot, Temps);
+    for (std::size_t i = 0; i < Temps.size(); i++)
+    {
+      outfile << Temps[i] << sep;
+      outfile << vev << sep;
+      outfile << RangeSolution;
+      outfile << sep << Potentials[i];
+      outfile << std::endl;
+    }
+    Temps.clear();
+  };
+
   for (double Temp = args.TemperatureStart; Temp <= args.TemperatureEnd;
        Temp += args.TemperatureStep)
   {
@@ -129,22 +154,22 @@ try
     }
     sol.clear();
     Check.clear();
-    solPot.clear();
-    sol    = Minimizer::Minimize_gen_all(modelPointer,
+    sol = Minimizer::Minimize_gen_all(modelPointer,
                                       Temp,
                                       Check,
                                       start,
                                       args.WhichMinimizer,
-                                      args.UseMultithreading);
-    solPot = modelPointer->MinimizeOrderVEV(sol);
-    vev    = modelPointer->EWSBVEV(solPot);
-
-    outfile << Temp << sep;
-    outfile << vev << sep;
-    outfile << sol;
-    outfile << sep << modelPointer->VEff(solPot, Temp, 0);
-    outfile << std::endl;
+                                      args.UseMultithreading,
+                                      false,
+                                      &WarmStart);
+    if (sol != RangeSolution)
+    {
+      WriteRange();
+      RangeSolution = sol;
+    }
+    Temps.push_back(Temp);
   }
+  WriteRange();
   outfile.close();
 
   return EXIT_SUCCESS;
@@ -250,6 +275,14 @@ CLIOptions::CLIOptions(const BSMPT::parser &argparser)
   {
   }
 
+  try
+  {
+    SkipRandomStarts = argparser.get_value<bool>("skipRandomStarts");
+  }
+  catch (BSMPT::parserException &)
+  {
+  }
+
   WhichMinimizer = Minimizer::CalcWhichMinimizer(UseGSL, UseCMAES, UseNLopt);
 }
 
@@ -280,6 +313,11 @@ BSMPT::parser prepare_parser()
       "y/n Turns on additional information in the terminal during "
       "the calculation.",
       false);
+  argparser.add_argument(
+      "skipRandomStarts",
+      "Skips the random starting points of GSL once the minima continued "
+      "from the previous temperature are confirmed",
+      false);
 
   std::stringstream ss;
   ss << "VEVEVO calculates the evolution of the global minimum with "
@@ -18,6 +18,12 @@ TransitionTracer::TransitionTracer(user_input &input)
 
   std::shared_ptr<MinimumTracer> mintracer(new MinimumTracer(
       input.modelPointer, input.which_minimizer, input.use_multithreading));
+  if (input.max_evaluations > 0 or input.max_wall_time > 0)
+  {
+    mintracer->Budget = std::make_shared<EvaluationBudget>(
+        input.max_evaluations, input.max_wall_time);
+  }
+  mintracer->UsePredictorCorrector = input.use_predictor_corrector;
 
   // initialize legend
   output_store.legend = mintracer->GetLegend(0, input.gw_calculation);
@@ -90,7 +96,9 @@ TransitionTracer::TransitionTracer(user_input &input)
                  mintracer,
                  input.modelPointer,
                  input.multistepmode,
-                 input.num_points);
+                 input.num_points,
+                 false,
+                 input.num_refinements);
 
       vec_coex = vac.CoexPhasesList;
 
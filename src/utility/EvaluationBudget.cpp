@@ -0,0 +1,32 @@
+// SPDX-FileCopyrightText: 2021 Philipp Basler, Margarete Mühlleitner and Jonas
+// Müller
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <BSMPT/utility/EvaluationBudget.h>
+
+namespace BSMPT
+{
+
+EvaluationBudget::EvaluationBudget(std::size_t MaxEvaluations,
+                                   double MaxWallTime,
+                                   std::size_t MaxIterationsPerStart)
+    : MaxEvaluations{MaxEvaluations}
+    , MaxWallTime{MaxWallTime}
+    , MaxIterationsPerStart{MaxIterationsPerStart}
+    , Start{Clock::now()}
+{
+}
+
+double EvaluationBudget::ElapsedTime() const
+{
+  return std::chrono::duration<double>(Clock::now() - Start).count();
+}
+
+bool EvaluationBudget::Exhausted() const
+{
+  if (MaxEvaluations > 0 and Evaluations() >= MaxEvaluations) return true;
+  return MaxWallTime > 0 and ElapsedTime() >= MaxWallTime;
+}
+
+} // namespace BSMPT
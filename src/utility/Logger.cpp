@@ -19,6 +19,14 @@
 namespace BSMPT
 {
 
+namespace
+{
+/**
+ * Innermost LogBuffer of the calling thread, nullptr if there is none
+ */
+thread_local LogBuffer *CurrentBuffer = nullptr;
+} // namespace
+
 static std::map<std::string, LoggingLevel> LoggingPrefixes{
     {"--logginglevel::default=", LoggingLevel::Default},
     {"--logginglevel::debug=", LoggingLevel::Debug},
@@ -115,8 +123,30 @@ void SetLogger(const std::vector<std::string> &args)
   }
 }
 
+LogBuffer::LogBuffer(std::string &Text) : Text{Text}, Previous{CurrentBuffer}
+{
+  CurrentBuffer = this;
+}
+
+LogBuffer::~LogBuffer()
+{
+  CurrentBuffer = Previous;
+}
+
+void BSMPTLogger::Emit(const std::string &Text)
+{
+  if (CurrentBuffer != nullptr)
+  {
+    CurrentBuffer->Text += Text;
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mLock);
+  mOstream << Text << std::flush;
+}
+
 void BSMPTLogger::SetOStream(std::ostream &Ostream)
 {
+  std::lock_guard<std::mutex> lock(mLock);
   mfilestream.close();
   mOstream.rdbuf(Ostream.rdbuf());
 }
@@ -144,6 +174,7 @@ void BSMPTLogger::SetLevel(LoggingLevel level, bool enable)
 
 void BSMPTLogger::SetOStream(const std::string &file)
 {
+  std::lock_guard<std::mutex> lock(mLock);
   mfilestream = std::ofstream(file);
   mOstream.rdbuf(mfilestream.rdbuf());
 }
@@ -1,4 +1,5 @@
 #include <BSMPT/utility/NumericalDerivatives.h>
+#include <array>
 
 namespace BSMPT
 {
@@ -79,4 +80,118 @@ HessianNumerical(const std::vector<double> &phi,
 
   return result;
 }
-} // namespace BSMPT
\ No newline at end of file
+
+std::vector<std::vector<double>>
+NablaNumerical(const std::vector<std::vector<double>> &phis,
+               const BatchFunction &f,
+               const double &eps)
+{
+  if (phis.empty()) return {};
+  const std::size_t dim = phis.front().size();
+  const std::array<double, 4> Shifts{2 * eps, eps, -eps, -2 * eps};
+
+  // Four stencil points per direction and point, in the order of Shifts
+  Eigen::MatrixXd Stencil(Shifts.size() * dim * phis.size(), dim);
+  Eigen::Index row = 0;
+  for (const auto &phi : phis)
+  {
+    for (std::size_t i = 0; i < dim; i++)
+    {
+      for (const auto &Shift : Shifts)
+      {
+        for (std::size_t j = 0; j < dim; j++)
+        {
+          Stencil(row, j) = phi[j];
+        }
+        Stencil(row, i) += Shift;
+        row++;
+      }
+    }
+  }
+
+  const auto Values = f(Stencil);
+  std::vector<std::vector<double>> result(phis.size(),
+                                          std::vector<double>(dim));
+  std::size_t n = 0;
+  for (auto &gradient : result)
+  {
+    for (std::size_t i = 0; i < dim; i++, n += Shifts.size())
+    {
+      gradient[i] = (-Values[n] + 8 * Values[n + 1] - 8 * Values[n + 2] +
+                     Values[n + 3]) /
+                    (12 * eps);
+    }
+  }
+  return result;
+}
+
+std::vector<double> NablaNumerical(const std::vector<double> &phi,
+                                   const BatchFunction &f,
+                                   const double &eps)
+{
+  return NablaNumerical(std::vector<std::vector<double>>{phi}, f, eps).front();
+}
+
+std::vector<std::vector<double>> HessianNumerical(
+    const std::vector<double> &phi, const BatchFunction &V, double eps)
+{
+  const std::size_t dim = phi.size();
+
+  // The stencil consists of phi, phi +- 2 eps e_i and
+  // phi +- eps e_i +- eps e_j for j > i
+  Eigen::MatrixXd Stencil(1 + 2 * dim + 2 * dim * (dim - 1), dim);
+  for (Eigen::Index row = 0; row < Stencil.rows(); row++)
+  {
+    for (std::size_t j = 0; j < dim; j++)
+    {
+      Stencil(row, j) = phi[j];
+    }
+  }
+  Eigen::Index row = 1;
+  for (std::size_t i = 0; i < dim; i++)
+  {
+    Stencil(row++, i) += 2 * eps;
+    Stencil(row++, i) -= 2 * eps;
+    for (std::size_t j = i + 1; j < dim; j++)
+    {
+      for (const double si : {eps, -eps})
+      {
+        for (const double sj : {eps, -eps})
+        {
+          Stencil(row, i) += si;
+          Stencil(row, j) += sj;
+          row++;
+        }
+      }
+    }
+  }
+
+  const auto Values = V(Stencil);
+  std::vector<std::vector<double>> result(dim, std::vector<double>(dim));
+  std::size_t n = 1;
+  for (std::size_t i = 0; i < dim; i++)
+  {
+    double val = 0;
+    val += Values[n++];
+    val -= 2 * Values[0];
+    val += Values[n++];
+
+    result[i][i] = val / (4 * eps * eps);
+
+    for (std::size_t j = i + 1; j < dim; j++)
+    {
+      // F(x+h, y+h) - F(x+h, y-h) - F(x-h, y+h) + F(x-h, y-h)
+      double r = 0;
+      r += Values[n++];
+      r -= Values[n++];
+      r -= Values[n++];
+      r += Values[n++];
+
+      result[i][j] = r / (4 * eps * eps);
+      result[j][i] = r / (4 * eps * eps);
+    }
+  }
+
+  return result;
+}
+} // namespace BSMPT
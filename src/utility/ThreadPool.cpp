@@ -0,0 +1,229 @@
+// SPDX-FileCopyrightText: 2021 Philipp Basler, Margarete Mühlleitner and Jonas
+// Müller
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file
+ */
+
+#include <BSMPT/utility/ThreadPool.h>
+
+#include <algorithm>
+
+namespace BSMPT
+{
+
+namespace
+{
+/**
+ * Pool and index of the worker running on this thread, nullptr for threads
+ * outside of any pool
+ */
+thread_local const ThreadPool *WorkerPool = nullptr;
+thread_local std::size_t WorkerIndex      = 0;
+} // namespace
+
+ThreadPool::ThreadPool(std::size_t NumThreads)
+{
+  NumThreads = std::max<std::size_t>(NumThreads, 1);
+  for (std::size_t i = 0; i < NumThreads; i++)
+  {
+    Queues.push_back(std::make_unique<TaskQueue>());
+  }
+  for (std::size_t i = 0; i < NumThreads; i++)
+  {
+    Workers.emplace_back([this, i]() { WorkerLoop(i); });
+  }
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(SleepLock);
+    Stop = true;
+  }
+  WakeUp.notify_all();
+  for (auto &Worker : Workers)
+  {
+    Worker.join();
+  }
+}
+
+ThreadPool &ThreadPool::Global()
+{
+  static ThreadPool Pool(std::thread::hardware_concurrency());
+  return Pool;
+}
+
+std::size_t ThreadPool::CurrentWorker() const
+{
+  return WorkerPool == this ? WorkerIndex : Size();
+}
+
+void ThreadPool::Submit(std::function<void()> Task,
+                        const std::shared_ptr<GroupQueue> &Group)
+{
+  std::size_t Index = CurrentWorker();
+  if (Index == Size()) Index = NextQueue++ % Size();
+  QueuedTask Queued{Group, nullptr};
+  if (Group)
+  {
+    {
+      std::lock_guard<std::mutex> lock(Group->Lock);
+      Group->Tasks.push_back(std::move(Task));
+    }
+    Group->Changed.notify_all();
+  }
+  else
+  {
+    Queued.Run = std::move(Task);
+  }
+  // Pending is checked by the sleeping workers under SleepLock, taking it
+  // below ensures that the notification is not lost
+  Pending++;
+  {
+    std::lock_guard<std::mutex> lock(Queues[Index]->Lock);
+    Queues[Index]->Tasks.push_back(std::move(Queued));
+  }
+  {
+    std::lock_guard<std::mutex> lock(SleepLock);
+  }
+  WakeUp.notify_one();
+}
+
+bool ThreadPool::TakeTask(QueuedTask &Queued, std::function<void()> &Task)
+{
+  if (not Queued.Group)
+  {
+    Task = std::move(Queued.Run);
+    return true;
+  }
+  std::lock_guard<std::mutex> lock(Queued.Group->Lock);
+  if (Queued.Group->Tasks.empty()) return false;
+  Task = std::move(Queued.Group->Tasks.front());
+  Queued.Group->Tasks.pop_front();
+  return true;
+}
+
+bool ThreadPool::TryPop(std::size_t Index, std::function<void()> &Task)
+{
+  for (std::size_t i = 0; i < Size(); i++)
+  {
+    auto &Queue = *Queues[(Index + i) % Size()];
+    while (true)
+    {
+      QueuedTask Queued;
+      {
+        std::lock_guard<std::mutex> lock(Queue.Lock);
+        if (Queue.Tasks.empty()) break;
+        // the own queue is used from the back, the others from the front
+        if (i == 0)
+        {
+          Queued = std::move(Queue.Tasks.back());
+          Queue.Tasks.pop_back();
+        }
+        else
+        {
+          Queued = std::move(Queue.Tasks.front());
+          Queue.Tasks.pop_front();
+        }
+      }
+      Pending--;
+      if (TakeTask(Queued, Task)) return true;
+    }
+  }
+  return false;
+}
+
+void ThreadPool::WorkerLoop(std::size_t Index)
+{
+  WorkerPool  = this;
+  WorkerIndex = Index;
+  std::function<void()> Task;
+  while (true)
+  {
+    if (TryPop(Index, Task))
+    {
+      Task();
+      Task = nullptr;
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(SleepLock);
+    WakeUp.wait(lock, [this]() { return Stop or Pending > 0; });
+    if (Stop and Pending == 0) return;
+  }
+}
+
+TaskGroup::TaskGroup(ThreadPool &Pool)
+    : Pool{Pool}
+    , Queue{std::make_shared<ThreadPool::GroupQueue>()}
+{
+}
+
+TaskGroup::~TaskGroup()
+{
+  WaitForTasks();
+}
+
+void TaskGroup::Run(std::function<void()> Task)
+{
+  {
+    std::lock_guard<std::mutex> lock(Queue->Lock);
+    Outstanding++;
+  }
+  Pool.Submit(
+      [this, Queue = Queue, Task = std::move(Task)]()
+      {
+        std::exception_ptr TaskError;
+        try
+        {
+          Task();
+        }
+        catch (...)
+        {
+          TaskError = std::current_exception();
+        }
+        // The group may be destroyed as soon as Outstanding is zero and the
+        // lock is released, so nothing but the captured queue is touched
+        // afterwards
+        std::lock_guard<std::mutex> lock(Queue->Lock);
+        if (TaskError and not Error) Error = TaskError;
+        if (--Outstanding == 0) Queue->Changed.notify_all();
+      },
+      Queue);
+}
+
+void TaskGroup::WaitForTasks()
+{
+  // Tasks of this group are taken from the back of its queue. Tasks added by
+  // other threads while waiting, e.g. by tasks of this group running on the
+  // workers, notify Changed and are picked up immediately.
+  std::unique_lock<std::mutex> lock(Queue->Lock);
+  while (Outstanding > 0)
+  {
+    if (Queue->Tasks.empty())
+    {
+      Queue->Changed.wait(lock);
+      continue;
+    }
+    auto Task = std::move(Queue->Tasks.back());
+    Queue->Tasks.pop_back();
+    lock.unlock();
+    Task();
+    lock.lock();
+  }
+}
+
+void TaskGroup::Wait()
+{
+  WaitForTasks();
+  std::exception_ptr TaskError;
+  {
+    std::lock_guard<std::mutex> lock(Queue->Lock);
+    std::swap(TaskError, Error);
+  }
+  if (TaskError) std::rethrow_exception(TaskError);
+}
+
+} // namespace BSMPT
@@ -116,6 +116,35 @@ public:
                0.0322634 * pow(v[0], 4);
     return r;
   }
+
+  std::vector<double> VEffMultiT(const std::vector<double> &v,
+                                 const std::vector<double> &Temps,
+                                 int Order = 1) const override
+  {
+    std::vector<double> res;
+    for (const auto &Temp : Temps)
+    {
+      res.push_back(VEff(v, Temp, 0, Order));
+    }
+    return res;
+  }
+
+  void VEffBatch(const Eigen::MatrixXd &Points,
+                 double Temp,
+                 std::vector<double> &res,
+                 bool UseMultithreading = false,
+                 int Order              = 1) const override
+  {
+    (void)UseMultithreading;
+    res.resize(Points.rows());
+    for (Eigen::Index row = 0; row < Points.rows(); row++)
+    {
+      std::vector<double> v(Points.cols());
+      for (Eigen::Index col = 0; col < Points.cols(); col++)
+        v[col] = Points(row, col);
+      res[row] = VEff(v, Temp, 0, Order);
+    }
+  }
 };
 
 int main()
@@ -12,6 +12,7 @@
 #include <BSMPT/models/ModelTestfunctions.h>
 
 #include "C2HDM.h"
+#include <algorithm>
 #include <fstream>
 
 const std::vector<double> example_point_C2HDM{/* lambda_1 = */ 3.29771,
@@ -49,6 +50,121 @@ TEST_CASE("Checking NLOVEV for C2HDM", "[c2hdm]")
   }
 }
 
+TEST_CASE("Checking NLOVEV for C2HDM with the gradient-based GSL minimizer",
+          "[c2hdm]")
+{
+  using namespace BSMPT;
+  const auto SMConstants = GetSMConstants();
+  std::shared_ptr<BSMPT::Class_Potential_Origin> modelPointer =
+      ModelID::FChoose(ModelID::ModelIDs::C2HDM, SMConstants);
+  modelPointer->initModel(example_point_C2HDM);
+  std::vector<double> Check;
+  auto sol = Minimizer::Minimize_gen_all(
+      modelPointer,
+      0,
+      Check,
+      modelPointer->get_vevTreeMin(),
+      Minimizer::CalcWhichMinimizer(false, false, false, true));
+  for (std::size_t i{0}; i < sol.size(); ++i)
+  {
+    auto expected = std::abs(modelPointer->get_vevTreeMin(i));
+    auto res      = std::abs(sol.at(i));
+    REQUIRE(res == Approx(expected).margin(1e-4));
+  }
+}
+
+TEST_CASE("Checking the minimizer race for C2HDM", "[c2hdm]")
+{
+  using namespace BSMPT;
+  const auto SMConstants = GetSMConstants();
+  std::shared_ptr<BSMPT::Class_Potential_Origin> modelPointer =
+      ModelID::FChoose(ModelID::ModelIDs::C2HDM, SMConstants);
+  modelPointer->initModel(example_point_C2HDM);
+  const int WhichMinimizer =
+      Minimizer::CalcWhichMinimizer(true, false, false, true);
+
+  // minima related by a sign flip of all VEVs are the same, the largest VEV
+  // is chosen to be positive
+  auto Reduce = [](std::vector<double> &vev)
+  {
+    auto Largest = std::max_element(vev.begin(),
+                                    vev.end(),
+                                    [](const double &a, const double &b)
+                                    { return std::abs(a) < std::abs(b); });
+    if (*Largest < 0)
+    {
+      for (auto &v : vev)
+        v = -v;
+    }
+  };
+
+  Minimizer::MinimizerRaceSettings Settings;
+  auto res = Minimizer::Minimize_gen_all_race(modelPointer,
+                                              0,
+                                              modelPointer->get_vevTreeMin(),
+                                              WhichMinimizer,
+                                              Settings,
+                                              true,
+                                              Reduce);
+  REQUIRE(res.Agreement);
+  REQUIRE(not res.BudgetExhausted);
+  REQUIRE((res.Winner == Minimizer::MinimizerBackend::GSL or
+           res.Winner == Minimizer::MinimizerBackend::GSLGradient));
+  for (std::size_t i{0}; i < res.Minimum.size(); ++i)
+  {
+    auto expected = std::abs(modelPointer->get_vevTreeMin(i));
+    REQUIRE(std::abs(res.Minimum.at(i)) == Approx(expected).margin(1e-4));
+  }
+
+  Settings.Budget = 1e-9;
+  res             = Minimizer::Minimize_gen_all_race(modelPointer,
+                                             0,
+                                             modelPointer->get_vevTreeMin(),
+                                             WhichMinimizer,
+                                             Settings,
+                                             true,
+                                             Reduce);
+  REQUIRE(res.BudgetExhausted);
+  REQUIRE(not res.Agreement);
+}
+
+TEST_CASE("Checking the distinct minima for C2HDM", "[c2hdm]")
+{
+  using namespace BSMPT;
+  const auto SMConstants = GetSMConstants();
+  std::shared_ptr<BSMPT::Class_Potential_Origin> modelPointer =
+      ModelID::FChoose(ModelID::ModelIDs::C2HDM, SMConstants);
+  modelPointer->initModel(example_point_C2HDM);
+
+  // minima related by a sign flip of all VEVs are the same, the largest VEV
+  // is chosen to be positive
+  auto Reduce = [](std::vector<double> &vev)
+  {
+    auto Largest = std::max_element(vev.begin(),
+                                    vev.end(),
+                                    [](const double &a, const double &b)
+                                    { return std::abs(a) < std::abs(b); });
+    if (*Largest < 0)
+    {
+      for (auto &v : vev)
+        v = -v;
+    }
+  };
+  auto Minima = Minimizer::Minimize_gen_all_distinct(
+      modelPointer, 0, modelPointer->get_vevTreeMin(), 2, Reduce);
+  REQUIRE(Minima.size() > 0);
+  for (std::size_t i{0}; i < Minima.front().Point.size(); ++i)
+  {
+    auto expected = std::abs(modelPointer->get_vevTreeMin(i));
+    REQUIRE(std::abs(Minima.front().Point.at(i)) ==
+            Approx(expected).margin(1e-4));
+  }
+  for (std::size_t i{1}; i < Minima.size(); ++i)
+  {
+    REQUIRE(Minima.at(i - 1).PotVal <= Minima.at(i).PotVal);
+  }
+}
+
 TEST_CASE("Checking EWPT for C2HDM", "[c2hdm]")
 {
   using namespace BSMPT;
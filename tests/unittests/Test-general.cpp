@@ -8,6 +8,8 @@
 
 using Approx = Catch::Approx;
 
+#include <BSMPT/minimizer/DistinctMinima.h>
+#include <BSMPT/minimizer/MinimumContinuation.h>
 #include <BSMPT/models/IncludeAllModels.h>
 #include <BSMPT/models/ModelTestfunctions.h>
 #include <BSMPT/models/SMparam.h>
@@ -40,3 +42,56 @@ TEST_CASE("Check no model ids are set twice", "[general]")
   }
   REQUIRE(foundException == std::string());
 }
+
+TEST_CASE("Check the continuation of minima in the temperature", "[general]")
+{
+  using namespace BSMPT;
+  Minimizer::MinimumContinuation WarmStart(true);
+  REQUIRE(WarmStart.StartingPoints(120).empty());
+
+  WarmStart.Insert(100, {{10, 200}, {0, 0}, {10, 200.001}});
+  WarmStart.Insert(110, {{10, 190}, {0, 0}});
+  REQUIRE(WarmStart.NumberOfTemperatures() == 2);
+
+  // predictions extrapolated from T = 100 and T = 110 come first, followed by
+  // the distinct minima at both temperatures
+  std::vector<std::vector<double>> expected{
+      {10, 180}, {0, 0}, {10, 190}, {10, 200}};
+  auto Starts = WarmStart.StartingPoints(120);
+  REQUIRE(Starts.size() == expected.size());
+  for (std::size_t i = 0; i < expected.size(); i++)
+  {
+    for (std::size_t j = 0; j < 2; j++)
+    {
+      REQUIRE(Starts.at(i).at(j) == Approx(expected.at(i).at(j)));
+    }
+  }
+
+  REQUIRE(WarmStart.Confirms(120, {{0, 0.1}, {10, 180.5}}));
+  REQUIRE(not WarmStart.Confirms(120, {{10, 180.5}}));
+  REQUIRE(not WarmStart.Confirms(120, {{0, 0}, {10, 170}}));
+}
+
+TEST_CASE("Check the clustering of distinct minima", "[general]")
+{
+  using namespace BSMPT;
+  Minimizer::DistinctMinima Minima(1e-2);
+  REQUIRE(Minima.Insert({0, 246}, -2));
+  REQUIRE(Minima.Insert({0, 0}, 0));
+  REQUIRE(not Minima.Insert({0.005, 245.995}, -2.5));
+  REQUIRE(not Minima.Insert({0, 246.005}, -1));
+  // close in the first VEV but not in the second one
+  REQUIRE(Minima.Insert({0, 100}, -1));
+  REQUIRE(Minima.size() == 3);
+
+  auto Sorted = Minima.SortedByPotential();
+  REQUIRE(Sorted.at(0).PotVal == Approx(-2.5));
+  REQUIRE(Sorted.at(0).Point.at(1) == Approx(245.995));
+  REQUIRE(Sorted.at(0).Multiplicity == 3);
+  REQUIRE(Sorted.at(1).Point.at(1) == Approx(100));
+  REQUIRE(Sorted.at(2).Point.at(1) == Approx(0));
+  REQUIRE(Sorted.at(2).Multiplicity == 1);
+
+  // the cluster is found at the first VEV of its deeper point
+  REQUIRE(not Minima.Insert({0.012, 245.99}, -2));
+}
@@ -65,6 +65,25 @@ TEST_CASE("Test almost_the_same", "[gw]")
   REQUIRE(not almost_the_same({0, 1}, {0, 0.991}, false, 0.01, 0));
 }
 
+TEST_CASE("Test FindRootIllinois", "[gw]")
+{
+  using namespace BSMPT;
+
+  int Evaluations = 0;
+  std::function<double(double)> f = [&Evaluations](double x)
+  {
+    Evaluations++;
+    return x * x * x - 2;
+  };
+  double Root = FindRootIllinois(f, 0, 3, -2, 25);
+  REQUIRE(Root == Approx(std::cbrt(2.)).epsilon(1e-10));
+  // the bisection needs 35 evaluations for this precision
+  REQUIRE(Evaluations < 20);
+
+  REQUIRE(FindRootIllinois(f, 0, std::cbrt(2.), -2, 0) == std::cbrt(2.));
+  REQUIRE_THROWS(FindRootIllinois(f, 2, 3, 6, 25));
+}
+
 TEST_CASE("Test I_alpha", "[gw]")
 {
   // Tests bounce solver with analytical derivative
@@ -415,6 +434,121 @@ TEST_CASE("Checking phase tracking for SM", "[gw]")
   REQUIRE(vac.PhasesList.size() == 2);
 }
 
+TEST_CASE("Check the sorted insertion of minima into a phase", "[gw]")
+{
+  using namespace BSMPT;
+  Phase phase;
+  for (double T : {2., 1., 3., 1.5, 2.})
+  {
+    Minimum min;
+    min.point     = {T};
+    min.temp      = T;
+    min.potential = 0;
+    phase.Add(min);
+  }
+
+  REQUIRE(phase.MinimumPhaseVector.size() == 4);
+  REQUIRE(phase.T_low == 1);
+  REQUIRE(phase.T_high == 3);
+  const std::vector<double> Temps{1, 1.5, 2, 3};
+  const std::vector<int> Edges{-1, 0, 0, 1};
+  for (std::size_t i = 0; i < Temps.size(); i++)
+  {
+    REQUIRE(phase.MinimumPhaseVector.at(i).temp == Temps.at(i));
+    REQUIRE(phase.MinimumPhaseVector.at(i).EdgeOfPhase == Edges.at(i));
+  }
+}
+
+TEST_CASE("Checking the interpolation of phases for SM", "[gw]")
+{
+  const std::vector<double> example_point_SM{
+      /* muSq = */ -7823.7540500000005,
+      /* lambda = */ 0.12905349405143487};
+
+  using namespace BSMPT;
+  const auto SMConstants = GetSMConstants();
+  std::shared_ptr<BSMPT::Class_Potential_Origin> modelPointer =
+      ModelID::FChoose(ModelID::ModelIDs::SM, SMConstants);
+  modelPointer->initModel(example_point_SM);
+
+  std::shared_ptr<MinimumTracer> MinTracer(
+      new MinimumTracer(modelPointer, Minimizer::WhichMinimizerDefault, false));
+  auto start = MinTracer->ConvertToVEVDim(MinTracer->GetGlobalMinimum(0));
+  Phase phase(start, 0, 300, MinTracer);
+  REQUIRE(phase.MinimumPhaseVector.size() > 4);
+
+  // temperature between two minima in the broken phase
+  const auto Knot = phase.MinimumPhaseVector.at(1);
+  double T = 0.5 * (Knot.temp + phase.MinimumPhaseVector.at(2).temp);
+  auto Tracked = MinTracer->TrackPhase(
+      Knot.point, Knot.temp, T, T - Knot.temp, false, true);
+  REQUIRE(Tracked.back().temp == Approx(T));
+
+  const std::size_t NumberOfMinima = phase.MinimumPhaseVector.size();
+  double ErrorEstimate;
+  auto Interpolated = phase.Interpolate(T, ErrorEstimate);
+  REQUIRE(ErrorEstimate >= 0);
+  phase.InterpolationTolerance = ErrorEstimate;
+  auto Result                  = phase.Get(T);
+  // the interpolation does not track the phase again
+  REQUIRE(phase.MinimumPhaseVector.size() == NumberOfMinima);
+  REQUIRE(Result.point == Interpolated.point);
+  REQUIRE(L2NormVector(Result.point - Tracked.back().point) <=
+          ErrorEstimate + 1e-2);
+  REQUIRE(Result.potential == Approx(Tracked.back().potential).epsilon(1e-4));
+
+  // without interpolation the phase is tracked to T
+  phase.InterpolationTolerance = 0;
+  phase.Get(T);
+  REQUIRE(phase.MinimumPhaseVector.size() > NumberOfMinima);
+}
+
+TEST_CASE("Checking phase tracking for SM with the predictor-corrector mode",
+          "[gw]")
+{
+  const std::vector<double> example_point_SM{
+      /* muSq = */ -7823.7540500000005,
+      /* lambda = */ 0.12905349405143487};
+
+  using namespace BSMPT;
+  const auto SMConstants = GetSMConstants();
+  std::shared_ptr<BSMPT::Class_Potential_Origin> modelPointer =
+      ModelID::FChoose(ModelID::ModelIDs::SM, SMConstants);
+  modelPointer->initModel(example_point_SM);
+
+  std::shared_ptr<MinimumTracer> MinTracer(
+      new MinimumTracer(modelPointer, Minimizer::WhichMinimizerDefault, false));
+  auto start = MinTracer->ConvertToVEVDim(MinTracer->GetGlobalMinimum(0));
+  auto Fixed = MinTracer->TrackPhase(start, 0, 300, 1, false);
+  MinTracer->UsePredictorCorrector = true;
+  auto Adaptive = MinTracer->TrackPhase(start, 0, 300, 1, false);
+
+  REQUIRE(Adaptive.size() > 1);
+  REQUIRE(Adaptive.size() < Fixed.size());
+  // both end at the same temperature, where the broken phase disappears
+  REQUIRE(Adaptive.back().temp == Approx(Fixed.back().temp).epsilon(1e-2));
+
+  Vacuum vac(0, 300, MinTracer, modelPointer, -1, 10, true);
+  REQUIRE(vac.PhasesList.size() == 2);
+}
+
+TEST_CASE("Check the step controller of the predictor-corrector mode", "[gw]")
+{
+  using namespace BSMPT;
+  PhaseStepController Controller(0.1, 10, 1e-3);
+  // small errors enlarge the step by at most a factor of two
+  REQUIRE(Controller.Accepted(1, 1e-6, 100, 1) == Approx(2));
+  REQUIRE(Controller.Accepted(-4, 0.1, 100, 1) == Approx(-3.6));
+  REQUIRE(Controller.Accepted(8, 1e-6, 110, 1) == Approx(10));
+  // the smallest eigenvalue decreases by 0.05 per GeV
+  REQUIRE(Controller.Accepted(8, 1e-6, 118, 0.6) == Approx(6));
+  REQUIRE(Controller.Accepted(8, 1e-6, 119, 1e-6) == Approx(1e-3));
+
+  REQUIRE(Controller.Rejected(2, 10) == Approx(0.2));
+  REQUIRE(Controller.Rejected(2, 0.1) == Approx(1));
+  REQUIRE(Controller.Rejected(2, std::nan("")) == Approx(0.2));
+}
+
 TEST_CASE("Checking phase tracking for BP1 - Mode auto", "[gw]")
 {
   const std::vector<double> example_point_R2HDM{
@@ -438,6 +572,47 @@ TEST_CASE("Checking phase tracking for BP1 - Mode auto", "[gw]")
   Vacuum vac(0, 300, MinTracer, modelPointer, -1, 10, true);
 
   REQUIRE(vac.PhasesList.size() == 2);
+  // without refinements only the equally-spaced intermediate points are
+  // scanned
+  REQUIRE(vac.GridPhases.size() == 10);
+  int i = 1;
+  for (const auto &[Temp, PhaseIndex] : vac.GridPhases)
+  {
+    REQUIRE(Temp == Approx(300. / 11 * i).epsilon(1e-12));
+    i++;
+  }
+}
+
+TEST_CASE("Checking phase tracking for BP1 with a refined concurrent grid",
+          "[gw]")
+{
+  const std::vector<double> example_point_R2HDM{
+      /* lambda_1 = */ 6.9309437685026,
+      /* lambda_2 = */ 0.26305141403285998,
+      /* lambda_3 = */ 1.2865950045595,
+      /* lambda_4 = */ 4.7721306931875001,
+      /* lambda_5 = */ 4.7275722046239004,
+      /* m_{12}^2 = */ 18933.440789693999,
+      /* tan(beta) = */ 16.577896825227999,
+      /* Yukawa Type = */ 1};
+
+  using namespace BSMPT;
+  const auto SMConstants = GetSMConstants();
+  std::shared_ptr<BSMPT::Class_Potential_Origin> modelPointer =
+      ModelID::FChoose(ModelID::ModelIDs::R2HDM, SMConstants);
+  modelPointer->initModel(example_point_R2HDM);
+
+  std::shared_ptr<MinimumTracer> MinTracer(
+      new MinimumTracer(modelPointer, Minimizer::WhichMinimizerDefault, true));
+  // a coarse grid, refined three times at the phase boundary
+  Vacuum vac(0, 300, MinTracer, modelPointer, -1, 3, true, 3);
+
+  REQUIRE(vac.PhasesList.size() == 2);
+  // T_low, the three equally-spaced points and T_high, plus at least one
+  // midpoint added by a refinement
+  REQUIRE(vac.GridPhases.count(0) == 1);
+  REQUIRE(vac.GridPhases.count(300) == 1);
+  REQUIRE(vac.GridPhases.size() > 5);
 }
 
 TEST_CASE("Checking phase tracking for BP1 - Mode 0", "[gw]")
@@ -614,6 +789,42 @@ TEST_CASE("Checking phase tracking for BP2 - Mode 2", "[gw]")
   REQUIRE(vac.PhasesList.size() == 2);
 }
 
+TEST_CASE("Checking concurrent phase tracking for BP2 - Mode 2", "[gw]")
+{
+  const std::vector<double> example_point_R2HDM{
+      /* lambda_1 = */ 6.8467197321288999,
+      /* lambda_2 = */ 0.25889890874393001,
+      /* lambda_3 = */ 1.4661775278406,
+      /* lambda_4 = */ 4.4975594646125998,
+      /* lambda_5 = */ 4.4503516057569996,
+      /* m_{12}^2 = */ 6629.9728323804002,
+      /* tan(beta) = */ 45.319927369307997,
+      /* Yukawa Type = */ 1};
+
+  using namespace BSMPT;
+  const auto SMConstants = GetSMConstants();
+  std::shared_ptr<BSMPT::Class_Potential_Origin> modelPointer =
+      ModelID::FChoose(ModelID::ModelIDs::R2HDM, SMConstants);
+  modelPointer->initModel(example_point_R2HDM);
+
+  std::shared_ptr<MinimumTracer> SerialTracer(
+      new MinimumTracer(modelPointer, Minimizer::WhichMinimizerDefault, false));
+  std::shared_ptr<MinimumTracer> ConcurrentTracer(
+      new MinimumTracer(modelPointer, Minimizer::WhichMinimizerDefault, true));
+  Vacuum Serial(0, 300, SerialTracer, modelPointer, 2, 10, true);
+  Vacuum Concurrent(0, 300, ConcurrentTracer, modelPointer, 2, 10, true);
+
+  // the phases are added in the same order as in the serial tracing
+  REQUIRE(Concurrent.PhasesList.size() == Serial.PhasesList.size());
+  for (std::size_t i = 0; i < Serial.PhasesList.size(); i++)
+  {
+    REQUIRE(Concurrent.PhasesList.at(i).T_low ==
+            Approx(Serial.PhasesList.at(i).T_low).margin(1));
+    REQUIRE(Concurrent.PhasesList.at(i).T_high ==
+            Approx(Serial.PhasesList.at(i).T_high).margin(1));
+  }
+}
+
 TEST_CASE("Checking phase tracking for BP3 with Mode 0", "[gw]")
 {
   const std::vector<double> example_point_CXSM{/* v = */ 245.34120667410863,
@@ -13,8 +13,11 @@
 using Approx = Catch::Approx;
 
 #include "C2HDM.h"
+#include <BSMPT/models/BlockEigenSolver.h>
 #include <BSMPT/models/ClassPotentialOrigin.h>
+#include <BSMPT/models/FixedDimensionKernel.h>
 #include <BSMPT/models/IncludeAllModels.h>
+#include <BSMPT/models/ModelTestfunctions.h>
 
 namespace
 {
@@ -119,3 +122,454 @@ TEST_CASE("Check f_{abcd}", "[origin]")
     REQUIRE(result == Approx(expected).margin(1e-4));
   }
 }
+
+TEST_CASE("Check VEffGradient against numerical derivatives", "[origin]")
+{
+  using namespace BSMPT;
+  const auto SMConstants = GetSMConstants();
+  std::shared_ptr<BSMPT::Class_Potential_Origin> modelPointer =
+      ModelID::FChoose(ModelID::ModelIDs::C2HDM, SMConstants);
+  modelPointer->initModel(example_point_C2HDM);
+
+  // Point in the VEV subspace at which all Higgs masses are positive
+  auto vevMin = modelPointer->get_vevTreeMin();
+  for (auto &el : vevMin)
+    el *= 1.5;
+  vevMin.at(0) += 20;
+  vevMin.at(3) += 30;
+  const auto vev = modelPointer->MinimizeOrderVEV(vevMin);
+
+  for (const double Temp : {0., 100.})
+  {
+    const auto gradient = modelPointer->VEffGradient(vev, Temp);
+    REQUIRE(gradient.size() == modelPointer->get_NHiggs());
+
+    for (const auto &k : modelPointer->Get_VevOrder())
+    {
+      const double h = 1e-3 * std::max(1.0, std::abs(vev.at(k)));
+      auto vevPlus   = vev;
+      auto vevMinus  = vev;
+      vevPlus.at(k) += h;
+      vevMinus.at(k) -= h;
+      const double expected = (modelPointer->VEff(vevPlus, Temp) -
+                               modelPointer->VEff(vevMinus, Temp)) /
+                              (2 * h);
+      REQUIRE(gradient.at(k) == Approx(expected).epsilon(1e-2).margin(1));
+    }
+  }
+}
+
+TEST_CASE("Check VEffHessian against numerical derivatives", "[origin]")
+{
+  using namespace BSMPT;
+  const auto SMConstants = GetSMConstants();
+  std::shared_ptr<BSMPT::Class_Potential_Origin> modelPointer =
+      ModelID::FChoose(ModelID::ModelIDs::C2HDM, SMConstants);
+  modelPointer->initModel(example_point_C2HDM);
+
+  const auto NHiggs = modelPointer->get_NHiggs();
+
+  // The origin has a degenerate spectrum with negative mass eigenvalues, at
+  // the second point all Higgs masses are positive. Goldstone modes with
+  // m^2 = 0 are avoided as the Coleman-Weinberg potential is not twice
+  // differentiable there.
+  for (const double Scale : {0., 1.5})
+  {
+    auto vevMin = modelPointer->get_vevTreeMin();
+    for (auto &el : vevMin)
+      el *= Scale;
+    if (Scale != 0)
+    {
+      vevMin.at(0) += 20;
+      vevMin.at(3) += 30;
+    }
+    const auto vev = modelPointer->MinimizeOrderVEV(vevMin);
+
+    for (const double Temp : {0., 100.})
+    {
+      const auto hessian = modelPointer->VEffHessian(vev, Temp);
+      REQUIRE(hessian.size() == NHiggs);
+
+      for (std::size_t k = 0; k < NHiggs; k++)
+      {
+        const double h = 1e-3 * std::max(1.0, std::abs(vev.at(k)));
+        auto vevPlus   = vev;
+        auto vevMinus  = vev;
+        vevPlus.at(k) += h;
+        vevMinus.at(k) -= h;
+        const auto gradientPlus  = modelPointer->VEffGradient(vevPlus, Temp);
+        const auto gradientMinus = modelPointer->VEffGradient(vevMinus, Temp);
+        for (std::size_t l = 0; l < NHiggs; l++)
+        {
+          const double expected =
+              (gradientPlus.at(l) - gradientMinus.at(l)) / (2 * h);
+          REQUIRE(hessian.at(k).at(l) ==
+                  Approx(expected).epsilon(1e-4).margin(1e-2));
+        }
+      }
+    }
+  }
+}
+
+TEST_CASE("Check mass matrices from the sparse curvature storage", "[origin]")
+{
+  using namespace BSMPT;
+  const auto SMConstants = GetSMConstants();
+  std::shared_ptr<BSMPT::Class_Potential_Origin> modelPointer =
+      ModelID::FChoose(ModelID::ModelIDs::C2HDM, SMConstants);
+  modelPointer->initModel(example_point_C2HDM);
+
+  const auto NHiggs  = modelPointer->get_NHiggs();
+  const auto NGauge  = modelPointer->get_NGauge();
+  const auto NQuarks = modelPointer->get_NQuarks();
+  const auto &L2     = modelPointer->Get_Curvature_Higgs_L2();
+  const auto &L3     = modelPointer->Get_Curvature_Higgs_L3();
+  const auto &L4     = modelPointer->Get_Curvature_Higgs_L4();
+  const auto &G2H2   = modelPointer->Get_Curvature_Gauge_G2H2();
+  const auto &F2     = modelPointer->Get_Curvature_Quark_F2();
+  const auto &F2H1   = modelPointer->Get_Curvature_Quark_F2H1();
+
+  std::vector<double> vev(NHiggs);
+  for (std::size_t i = 0; i < NHiggs; i++)
+    vev.at(i) = 10.0 * (i + 1);
+
+  const auto HiggsMass = modelPointer->HiggsMassMatrix(vev, 0, 0);
+  for (std::size_t i = 0; i < NHiggs; i++)
+  {
+    for (std::size_t j = 0; j < NHiggs; j++)
+    {
+      double expected = L2[i][j];
+      for (std::size_t k = 0; k < NHiggs; k++)
+      {
+        expected += L3[i][j][k] * vev[k];
+        for (std::size_t l = 0; l < NHiggs; l++)
+          expected += 0.5 * L4[i][j][k][l] * vev[k] * vev[l];
+      }
+      REQUIRE(HiggsMass(i, j) == Approx(expected).epsilon(1e-12).margin(1e-8));
+    }
+  }
+
+  for (std::size_t x = 0; x < NHiggs; x++)
+  {
+    const auto HiggsDiff = modelPointer->HiggsMassMatrix(vev, 0, x + 1);
+    for (std::size_t i = 0; i < NHiggs; i++)
+    {
+      for (std::size_t j = 0; j < NHiggs; j++)
+      {
+        double expected = L3[i][j][x];
+        for (std::size_t k = 0; k < NHiggs; k++)
+          expected += L4[i][j][x][k] * vev[k];
+        REQUIRE(HiggsDiff(i, j) ==
+                Approx(expected).epsilon(1e-12).margin(1e-8));
+      }
+    }
+  }
+
+  const auto GaugeMass = modelPointer->GaugeMassMatrix(vev, 0);
+  for (std::size_t a = 0; a < NGauge; a++)
+  {
+    for (std::size_t b = 0; b < NGauge; b++)
+    {
+      double expected = 0;
+      for (std::size_t i = 0; i < NHiggs; i++)
+      {
+        for (std::size_t j = 0; j < NHiggs; j++)
+          expected += 0.5 * G2H2[a][b][i][j] * vev[i] * vev[j];
+      }
+      REQUIRE(GaugeMass(a, b) == Approx(expected).epsilon(1e-12).margin(1e-8));
+    }
+  }
+
+  const auto QuarkMass = modelPointer->QuarkMassMatrix(vev);
+  for (std::size_t i = 0; i < NQuarks; i++)
+  {
+    for (std::size_t j = 0; j < NQuarks; j++)
+    {
+      std::complex<double> expected = F2[i][j];
+      for (std::size_t k = 0; k < NHiggs; k++)
+        expected += F2H1[i][j][k] * vev[k];
+      REQUIRE(std::abs(QuarkMass(i, j) - expected) == Approx(0).margin(1e-8));
+    }
+  }
+}
+
+TEST_CASE("Check VEff evaluated in the VEV subspace", "[origin]")
+{
+  using namespace BSMPT;
+  const auto SMConstants = GetSMConstants();
+  std::shared_ptr<BSMPT::Class_Potential_Origin> modelPointer =
+      ModelID::FChoose(ModelID::ModelIDs::C2HDM, SMConstants);
+  modelPointer->initModel(example_point_C2HDM);
+
+  auto vevMin = modelPointer->get_vevTreeMin();
+  vevMin.at(0) += 20;
+  vevMin.at(3) += 30;
+  const auto vev = modelPointer->MinimizeOrderVEV(vevMin);
+
+  for (const double Temp : {0., 100.})
+  {
+    for (const int Order : {0, 1})
+    {
+      const double expected = modelPointer->VEff(vev, Temp, 0, Order);
+      const double result   = modelPointer->VEff(vevMin, Temp, 0, Order);
+      REQUIRE(result == Approx(expected).epsilon(1e-10));
+    }
+
+    const auto HiggsExpected = modelPointer->HiggsMassMatrix(vev, Temp);
+    const auto HiggsResult   = modelPointer->HiggsMassMatrix(vevMin, Temp);
+    REQUIRE((HiggsResult - HiggsExpected).norm() ==
+            Approx(0).margin(1e-8 * HiggsExpected.norm()));
+
+    const auto GaugeExpected = modelPointer->GaugeMassMatrix(vev, Temp);
+    const auto GaugeResult   = modelPointer->GaugeMassMatrix(vevMin, Temp);
+    REQUIRE((GaugeResult - GaugeExpected).norm() ==
+            Approx(0).margin(1e-8 * GaugeExpected.norm()));
+  }
+}
+
+TEST_CASE("Check VEff and VEffGradient with a reused workspace", "[origin]")
+{
+  using namespace BSMPT;
+  const auto SMConstants = GetSMConstants();
+  std::shared_ptr<BSMPT::Class_Potential_Origin> modelPointer =
+      ModelID::FChoose(ModelID::ModelIDs::C2HDM, SMConstants);
+  modelPointer->initModel(example_point_C2HDM);
+
+  EvaluationWorkspace Workspace;
+  std::vector<double> Gradient;
+  auto vevMin = modelPointer->get_vevTreeMin();
+  for (std::size_t step = 0; step < 3; step++)
+  {
+    vevMin.at(0) += 20;
+    vevMin.at(3) -= 10;
+    const auto vev = modelPointer->MinimizeOrderVEV(vevMin);
+    for (const double Temp : {0., 100.})
+    {
+      const double expected = modelPointer->VEff(vev, Temp);
+      REQUIRE(modelPointer->VEff(vev, Temp, Workspace) ==
+              Approx(expected).epsilon(1e-12));
+      REQUIRE(modelPointer->VEff(vevMin, Temp, Workspace) ==
+              Approx(expected).epsilon(1e-10));
+
+      const auto GradientExpected = modelPointer->VEffGradient(vev, Temp);
+      modelPointer->VEffGradient(vevMin, Temp, Gradient, Workspace);
+      REQUIRE(Gradient.size() == GradientExpected.size());
+      for (std::size_t i = 0; i < Gradient.size(); i++)
+      {
+        REQUIRE(Gradient.at(i) ==
+                Approx(GradientExpected.at(i)).epsilon(1e-10).margin(1e-6));
+      }
+    }
+  }
+}
+
+TEST_CASE("Check the thread workspaces of models with different dimensions",
+          "[origin]")
+{
+  using namespace BSMPT;
+  const auto SMConstants = GetSMConstants();
+  std::shared_ptr<BSMPT::Class_Potential_Origin> modelPointer =
+      ModelID::FChoose(ModelID::ModelIDs::C2HDM, SMConstants);
+  modelPointer->initModel(example_point_C2HDM);
+  std::shared_ptr<BSMPT::Class_Potential_Origin> otherPointer =
+      ModelID::FChoose(ModelID::ModelIDs::SM, SMConstants);
+
+  const auto vev =
+      modelPointer->MinimizeOrderVEV(modelPointer->get_vevTreeMin());
+  auto &Workspace         = modelPointer->GetThreadWorkspace();
+  const double expected   = modelPointer->VEff(vev, 100);
+  const double *HiggsMass = Workspace.HiggsMass.data();
+
+  // evaluations of a model with different dimensions on the same thread
+  // must neither resize nor overwrite the workspace of the first model
+  auto &OtherWorkspace = otherPointer->GetThreadWorkspace();
+  REQUIRE(&OtherWorkspace != &Workspace);
+  REQUIRE(OtherWorkspace.NHiggs == otherPointer->get_NHiggs());
+
+  REQUIRE(modelPointer->VEff(vev, 100) == expected);
+  REQUIRE(&modelPointer->GetThreadWorkspace() == &Workspace);
+  REQUIRE(Workspace.HiggsMass.data() == HiggsMass);
+  REQUIRE(&otherPointer->GetThreadWorkspace() == &OtherWorkspace);
+}
+
+TEST_CASE("Check the fixed dimension kernel against the generic evaluation",
+          "[origin]")
+{
+  using namespace BSMPT;
+  const auto SMConstants = GetSMConstants();
+  std::shared_ptr<BSMPT::Class_Potential_Origin> modelPointer =
+      ModelID::FChoose(ModelID::ModelIDs::C2HDM, SMConstants);
+  modelPointer->initModel(example_point_C2HDM);
+  std::shared_ptr<BSMPT::Class_Potential_Origin> genericPointer =
+      ModelID::FChoose(ModelID::ModelIDs::C2HDM, SMConstants);
+  genericPointer->SetV1LoopKernel(nullptr);
+  genericPointer->initModel(example_point_C2HDM);
+
+  auto vevMin = modelPointer->get_vevTreeMin();
+  vevMin.at(0) += 20;
+  vevMin.at(3) += 30;
+  const auto vev = modelPointer->MinimizeOrderVEV(vevMin);
+
+  for (const double Temp : {0., 100.})
+  {
+    const double expected = genericPointer->VEff(vev, Temp);
+    REQUIRE(modelPointer->VEff(vev, Temp) == Approx(expected).epsilon(1e-10));
+    REQUIRE(modelPointer->VEff(vevMin, Temp) ==
+            Approx(expected).epsilon(1e-10));
+  }
+
+  REQUIRE_THROWS_AS(modelPointer->SetV1LoopKernel(
+                        std::make_unique<FixedDimensionKernel<4, 4, 12, 9>>()),
+                    std::runtime_error);
+  REQUIRE_THROWS_AS(genericPointer->SetV1LoopKernel(
+                        std::make_unique<FixedDimensionKernel<8, 5, 12, 9>>()),
+                    std::runtime_error);
+
+  std::shared_ptr<BSMPT::Class_Potential_Origin> uninitialisedPointer =
+      ModelID::FChoose(ModelID::ModelIDs::C2HDM, SMConstants);
+  REQUIRE_THROWS_AS(uninitialisedPointer->SetV1LoopKernel(
+                        std::make_unique<FixedDimensionKernel<9, 4, 12, 9>>()),
+                    std::runtime_error);
+  REQUIRE_NOTHROW(uninitialisedPointer->SetV1LoopKernel(
+      std::make_unique<FixedDimensionKernel<8, 4, 12, 9>>()));
+}
+
+TEST_CASE("Check VEffMultiT against VEff", "[origin]")
+{
+  using namespace BSMPT;
+  const auto SMConstants = GetSMConstants();
+  std::shared_ptr<BSMPT::Class_Potential_Origin> modelPointer =
+      ModelID::FChoose(ModelID::ModelIDs::C2HDM, SMConstants);
+  modelPointer->initModel(example_point_C2HDM);
+
+  auto vevMin = modelPointer->get_vevTreeMin();
+  vevMin.at(0) += 20;
+  vevMin.at(3) += 30;
+  vevMin.at(1) = 5;
+  const auto vev = modelPointer->MinimizeOrderVEV(vevMin);
+  const std::vector<double> Temps{0, 50, 100, 150, 250};
+
+  for (const auto &point : {vevMin, vev})
+  {
+    for (const int Order : {0, 1})
+    {
+      auto result = modelPointer->VEffMultiT(point, Temps, Order);
+      REQUIRE(result.size() == Temps.size());
+      for (std::size_t n = 0; n < Temps.size(); n++)
+      {
+        REQUIRE(result.at(n) ==
+                Approx(modelPointer->VEff(point, Temps.at(n), 0, Order))
+                    .epsilon(1e-12));
+      }
+    }
+  }
+}
+
+TEST_CASE("Check VEffBatch against VEff", "[origin]")
+{
+  using namespace BSMPT;
+  const auto SMConstants = GetSMConstants();
+  std::shared_ptr<BSMPT::Class_Potential_Origin> modelPointer =
+      ModelID::FChoose(ModelID::ModelIDs::C2HDM, SMConstants);
+  modelPointer->initModel(example_point_C2HDM);
+
+  const auto vevMin = modelPointer->get_vevTreeMin();
+  Eigen::MatrixXd Points(64, vevMin.size());
+  for (Eigen::Index row = 0; row < Points.rows(); row++)
+  {
+    for (Eigen::Index col = 0; col < Points.cols(); col++)
+    {
+      Points(row, col) = vevMin.at(col) + 3 * row - 7 * col;
+    }
+  }
+
+  for (const bool UseMultithreading : {false, true})
+  {
+    std::vector<double> result;
+    modelPointer->VEffBatch(Points, 100, result, UseMultithreading);
+    REQUIRE(result.size() == static_cast<std::size_t>(Points.rows()));
+    for (Eigen::Index row = 0; row < Points.rows(); row++)
+    {
+      std::vector<double> vev(Points.cols());
+      for (Eigen::Index col = 0; col < Points.cols(); col++)
+      {
+        vev.at(col) = Points(row, col);
+      }
+      REQUIRE(result.at(row) == Approx(modelPointer->VEff(vev, 100)));
+    }
+  }
+}
+
+TEST_CASE("Check the simplified mass matrices of the template model",
+          "[origin]")
+{
+  using namespace BSMPT;
+  const auto SMConstants = GetSMConstants();
+  std::shared_ptr<BSMPT::Class_Potential_Origin> modelPointer =
+      ModelID::FChoose(ModelID::ModelIDs::TEMPLATE, SMConstants);
+  const double lambda = 0.26;
+  const double ms     = -lambda * std::pow(SMConstants.C_vev0, 2) / 6;
+  modelPointer->initModel(std::vector<double>{ms, lambda});
+
+  REQUIRE(modelPointer->UseMassMatricesSimplified);
+  auto result = ModelTests::CheckMassMatricesSimplified(*modelPointer);
+  REQUIRE(result == ModelTests::TestResults::Pass);
+}
+
+TEST_CASE("Check the block structured eigenvalue solver", "[origin]")
+{
+  using namespace BSMPT;
+  // Blocks {3}, {0, 5}, {1, 4, 7} and {2, 6, 8, 9, 10}
+  const std::vector<std::vector<std::size_t>> Blocks{
+      {3}, {0, 5}, {1, 4, 7}, {2, 6, 8, 9, 10}};
+  const std::size_t Dimension = 11;
+
+  Eigen::MatrixXcd Matrix = Eigen::MatrixXcd::Zero(Dimension, Dimension);
+  Eigen::Matrix<bool, Eigen::Dynamic, Eigen::Dynamic> Pattern =
+      Eigen::Matrix<bool, Eigen::Dynamic, Eigen::Dynamic>::Constant(
+          Dimension, Dimension, false);
+  double Seed = 1;
+  for (const auto &Block : Blocks)
+  {
+    for (std::size_t i = 0; i < Block.size(); i++)
+    {
+      Matrix(Block[i], Block[i]) = 100 * std::sin(Seed++);
+      for (std::size_t j = i + 1; j < Block.size(); j++)
+      {
+        const std::complex<double> Entry(10 * std::cos(Seed), std::sin(Seed));
+        Seed++;
+        Matrix(Block[i], Block[j])  = Entry;
+        Matrix(Block[j], Block[i])  = std::conj(Entry);
+        Pattern(Block[i], Block[j]) = true;
+      }
+    }
+  }
+
+  const auto Found = FindMatrixBlocks(Pattern);
+  REQUIRE(Found.Dimension == Dimension);
+  REQUIRE(Found.Blocks.size() == Blocks.size());
+
+  BlockEigenvalueSolver<Eigen::MatrixXcd> BlockSolver;
+  BlockSolver.compute(Matrix, Found);
+  std::vector<double> Result(BlockSolver.eigenvalues().data(),
+                             BlockSolver.eigenvalues().data() + Dimension);
+  std::sort(Result.begin(), Result.end());
+
+  Eigen::SelfAdjointEigenSolver<Eigen::MatrixXcd> Solver(
+      Matrix, Eigen::EigenvaluesOnly);
+  for (std::size_t i = 0; i < Dimension; i++)
+  {
+    REQUIRE(Result.at(i) ==
+            Approx(Solver.eigenvalues()[i]).epsilon(1e-10).margin(1e-10));
+  }
+
+  BlockSolver.compute(Matrix, Found, Eigen::ComputeEigenvectors);
+  const Eigen::MatrixXcd &Vectors = BlockSolver.eigenvectors();
+  const Eigen::MatrixXcd Residual =
+      Matrix * Vectors - Vectors * BlockSolver.eigenvalues().asDiagonal();
+  const Eigen::MatrixXcd Orthogonality =
+      Vectors.adjoint() * Vectors -
+      Eigen::MatrixXcd::Identity(Dimension, Dimension);
+  REQUIRE(Residual.norm() <= 1e-10 * Matrix.norm());
+  REQUIRE(Orthogonality.norm() <= 1e-12);
+}
@@ -7,8 +7,12 @@
 #include <catch2/catch_test_macros.hpp>
 
 using Approx = Catch::Approx;
+#include <BSMPT/ThermalFunctions/ThermalFunctionChebyshev.h>
+#include <BSMPT/ThermalFunctions/ThermalFunctionTable.h>
+#include <BSMPT/ThermalFunctions/ThermalFunctions.h>
 #include <BSMPT/ThermalFunctions/thermalcoefficientcalculator.h>
 #include <cmath>
+#include <vector>
 #include <gsl/gsl_sf_gamma.h>
 #include <gsl/gsl_sf_zeta.h>
 
@@ -98,3 +102,162 @@ TEST_CASE("Check JInterpolatedHighCoefficientCalculator", "[thermal]")
                 el.first) == Approx(el.second).margin(1e-4));
   }
 }
+
+TEST_CASE("Check derivatives of the interpolated thermal functions",
+          "[thermal]")
+{
+  using namespace BSMPT::ThermalFunctions;
+  // Covers the negative, low and high x regions of the interpolations
+  for (const double x : {-5., -0.5, 0.3, 1., 3., 10., 50.})
+  {
+    const double h = 1e-5 * std::max(1., std::abs(x));
+    REQUIRE(JbosonInterpolated(x, 1) ==
+            Approx((JbosonInterpolated(x + h) - JbosonInterpolated(x - h)) /
+                   (2 * h))
+                .epsilon(1e-5));
+    REQUIRE(JbosonInterpolated(x, 2) ==
+            Approx((JbosonInterpolated(x + h, 1) -
+                    JbosonInterpolated(x - h, 1)) /
+                   (2 * h))
+                .epsilon(1e-5));
+    if (x > 0)
+    {
+      REQUIRE(JfermionInterpolated(x, 1) ==
+              Approx((JfermionInterpolated(x + h) -
+                      JfermionInterpolated(x - h)) /
+                     (2 * h))
+                  .epsilon(1e-5));
+      REQUIRE(JfermionInterpolated(x, 2) ==
+              Approx((JfermionInterpolated(x + h, 1) -
+                      JfermionInterpolated(x - h, 1)) /
+                     (2 * h))
+                  .epsilon(1e-5));
+    }
+  }
+}
+
+TEST_CASE("Check tabulated thermal functions", "[thermal]")
+{
+  using namespace BSMPT::ThermalFunctions;
+  REQUIRE(JbosonTabulated(0) == Approx(-std::pow(M_PI, 4) / 45));
+  REQUIRE(JbosonTabulated(0, 1) == Approx(std::pow(M_PI, 2) / 12));
+  REQUIRE(JfermionTabulated(0) == Approx(7 * std::pow(M_PI, 4) / 360));
+  REQUIRE(JfermionTabulated(0, 1) == Approx(-std::pow(M_PI, 2) / 24));
+
+  for (const double x : {0.3, 1., 3., 10., 50., 300.})
+  {
+    for (int diff = 0; diff <= 1; diff++)
+    {
+      REQUIRE(JbosonTabulated(x, diff) ==
+              Approx(JbosonNumericalIntegration(x, diff))
+                  .epsilon(1e-6)
+                  .margin(1e-9));
+      REQUIRE(JfermionTabulated(x, diff) ==
+              Approx(JfermionNumericalIntegration(x, diff))
+                  .epsilon(1e-6)
+                  .margin(1e-9));
+    }
+  }
+
+  // x, J_-, dJ_-/dx, J_+, dJ_+/dx for x < 0, from an integration with 25
+  // digits along k = t exp(i pi/4)
+  const std::vector<std::vector<double>> Negative{
+      {-0.5, -2.52825757256, 0.647682335763, 2.12540109813, -0.497907254877},
+      {-5, -3.35103285661, -0.183016910806, 4.40523988024, -0.348594621592},
+      {-30, 17.4311455021, -0.563304967434, -13.6959980423, -0.257781424886},
+      {-100, -2.69710312088, -1.48557385856, -5.94969563209, 2.53917099376},
+      {-2000, -70.9318332132, 4.71178477343, -28.6770489124, -3.26124988016}};
+  for (const auto &Row : Negative)
+  {
+    REQUIRE(JbosonTabulated(Row[0]) == Approx(Row[1]).epsilon(1e-6));
+    REQUIRE(JbosonTabulated(Row[0], 1) == Approx(Row[2]).epsilon(1e-6));
+    REQUIRE(JfermionTabulated(Row[0]) == Approx(Row[3]).epsilon(1e-6));
+    REQUIRE(JfermionTabulated(Row[0], 1) == Approx(Row[4]).epsilon(1e-6));
+  }
+}
+
+TEST_CASE("Check batch evaluation of the interpolated thermal functions",
+          "[thermal]")
+{
+  using namespace BSMPT::ThermalFunctions;
+  const std::vector<double> x{
+      -5, -0.5, 0, 1e-8, 0.3, 1, 3, 9.4, 9.5, 10, 50, 400};
+  std::vector<double> res(x.size());
+  for (int diff = 0; diff <= 2; diff++)
+  {
+    JbosonBatch(x.data(), res.data(), x.size(), diff);
+    for (std::size_t i = 0; i < x.size(); i++)
+    {
+      if (diff == 2 and x[i] == 0) continue;
+      REQUIRE(res[i] ==
+              Approx(JbosonInterpolated(x[i], diff)).epsilon(1e-12));
+    }
+    JfermionBatch(x.data(), res.data(), x.size(), diff);
+    for (std::size_t i = 0; i < x.size(); i++)
+    {
+      if (x[i] < 0 or (diff == 2 and x[i] == 0)) continue;
+      REQUIRE(res[i] ==
+              Approx(JfermionInterpolated(x[i], diff)).epsilon(1e-12));
+    }
+  }
+}
+
+TEST_CASE("Check Chebyshev representation of the thermal functions",
+          "[thermal]")
+{
+  using namespace BSMPT::ThermalFunctions;
+  REQUIRE(JbosonChebyshev(0) == Approx(-std::pow(M_PI, 4) / 45));
+  REQUIRE(JbosonChebyshev(0, 1) == Approx(std::pow(M_PI, 2) / 12));
+  REQUIRE(JfermionChebyshev(0) == Approx(7 * std::pow(M_PI, 4) / 360));
+  REQUIRE(JfermionChebyshev(0, 1) == Approx(-std::pow(M_PI, 2) / 24));
+
+  for (const double x : {0.3, 1., 3., 10., 50., 300.})
+  {
+    for (int diff = 0; diff <= 1; diff++)
+    {
+      REQUIRE(JbosonChebyshev(x, diff) ==
+              Approx(JbosonNumericalIntegration(x, diff))
+                  .epsilon(1e-6)
+                  .margin(1e-9));
+      REQUIRE(JfermionChebyshev(x, diff) ==
+              Approx(JfermionNumericalIntegration(x, diff))
+                  .epsilon(1e-6)
+                  .margin(1e-9));
+    }
+  }
+
+  // same references as in "Check tabulated thermal functions"
+  const std::vector<std::vector<double>> Negative{
+      {-0.5, -2.52825757256, 0.647682335763, 2.12540109813, -0.497907254877},
+      {-5, -3.35103285661, -0.183016910806, 4.40523988024, -0.348594621592},
+      {-30, 17.4311455021, -0.563304967434, -13.6959980423, -0.257781424886},
+      {-100, -2.69710312088, -1.48557385856, -5.94969563209, 2.53917099376},
+      {-2000, -70.9318332132, 4.71178477343, -28.6770489124, -3.26124988016}};
+  for (const auto &Row : Negative)
+  {
+    REQUIRE(JbosonChebyshev(Row[0]) ==
+            Approx(Row[1]).epsilon(1e-9).margin(1e-9));
+    REQUIRE(JbosonChebyshev(Row[0], 1) ==
+            Approx(Row[2]).epsilon(1e-9).margin(1e-9));
+    REQUIRE(JfermionChebyshev(Row[0]) ==
+            Approx(Row[3]).epsilon(1e-9).margin(1e-9));
+    REQUIRE(JfermionChebyshev(Row[0], 1) ==
+            Approx(Row[4]).epsilon(1e-9).margin(1e-9));
+  }
+
+  // J and dJ/dx are continuous at the ends of the pieces
+  auto CheckSeams = [](const double (*Table)[C_ChebyshevColumns],
+                       std::size_t Pieces,
+                       double (*J)(const double &, int))
+  {
+    for (std::size_t i = 1; i < Pieces; i++)
+    {
+      const double x     = Table[i][0];
+      const double Below = std::nextafter(x, -INFINITY);
+      REQUIRE(J(Below, 0) == Approx(J(x, 0)).margin(1e-10));
+      REQUIRE(J(Below, 1) == Approx(J(x, 1)).margin(1e-6));
+    }
+  };
+  CheckSeams(BosonChebyshev, C_BosonChebyshevPieces, JbosonChebyshev);
+  CheckSeams(FermionChebyshev, C_FermionChebyshevPieces, JfermionChebyshev);
+}
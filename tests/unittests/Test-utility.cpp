@@ -8,8 +8,17 @@
 
 using Approx = Catch::Approx;
 
+#include <BSMPT/utility/EvaluationBudget.h>
+#include <BSMPT/utility/NumericalDerivatives.h>
+#include <BSMPT/utility/ThreadPool.h>
 #include <BSMPT/utility/utility.h>
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+
 TEST_CASE("Check vector . vector product", "[utility]")
 {
   using namespace BSMPT;
@@ -80,6 +89,179 @@ TEST_CASE("Check L2NormVector", "[utility]")
   REQUIRE(BSMPT::L2NormVector(v1) == Approx(15.096874).margin(1e-10));
 }
 
+TEST_CASE("Check batched numerical derivatives", "[utility]")
+{
+  using namespace BSMPT;
+  std::function<double(std::vector<double>)> f = [](std::vector<double> x)
+  { return x[0] * x[0] * x[1] + std::pow(x[1], 3) - 2 * x[0] * x[2]; };
+  BatchFunction fBatch = [&](const Eigen::MatrixXd &Points)
+  {
+    std::vector<double> res;
+    for (Eigen::Index row = 0; row < Points.rows(); row++)
+    {
+      res.push_back(
+          f({Points(row, 0), Points(row, 1), Points(row, 2)}));
+    }
+    return res;
+  };
+
+  const std::vector<std::vector<double>> points{{1.5, -0.3, 2.0},
+                                                {-4.0, 2.5, 0.7}};
+  const auto gradients = NablaNumerical(points, fBatch, 0.1);
+  REQUIRE(gradients.size() == points.size());
+  for (std::size_t k = 0; k < points.size(); k++)
+  {
+    const auto expected = NablaNumerical(points[k], f, 0.1);
+    const auto hessian  = HessianNumerical(points[k], fBatch, 0.1);
+    const auto expectedHessian = HessianNumerical(points[k], f, 0.1);
+    for (std::size_t i = 0; i < 3; i++)
+    {
+      REQUIRE(gradients[k][i] == Approx(expected[i]).margin(1e-10));
+      for (std::size_t j = 0; j < 3; j++)
+      {
+        REQUIRE(hessian[i][j] ==
+                Approx(expectedHessian[i][j]).margin(1e-10));
+      }
+    }
+  }
+}
+
+TEST_CASE("Check nested task groups of the thread pool", "[utility]")
+{
+  using namespace BSMPT;
+  // a small pool, so the outer tasks occupy all workers and the inner groups
+  // can only finish because waiting threads execute queued tasks
+  ThreadPool Pool(2);
+  std::atomic<int> Sum{0};
+  TaskGroup Outer(Pool);
+  for (int i = 0; i < 8; i++)
+  {
+    Outer.Run(
+        [&Pool, &Sum, i]()
+        {
+          TaskGroup Inner(Pool);
+          for (int j = 0; j < 10; j++)
+          {
+            Inner.Run([&Sum, i, j]() { Sum += i * 10 + j; });
+          }
+          Inner.Wait();
+        });
+  }
+  Outer.Wait();
+  REQUIRE(Sum == 3160);
+
+  TaskGroup Failing(Pool);
+  Failing.Run([]() { throw std::runtime_error("task failed"); });
+  REQUIRE_THROWS_AS(Failing.Wait(), std::runtime_error);
+}
+
+TEST_CASE("Check that a task group only helps with its own tasks",
+          "[utility]")
+{
+  using namespace BSMPT;
+  // The sibling task blocks until the inner group has finished. If a thread
+  // waiting for the inner group executed the sibling, the inner Wait could
+  // not return and the sibling would run into its timeout.
+  ThreadPool Pool(1);
+  std::mutex Lock;
+  std::condition_variable InnerFinished;
+  bool InnerDone       = false;
+  bool SiblingSawInner = false;
+  std::atomic<int> Sum{0};
+  TaskGroup Outer(Pool);
+  Outer.Run(
+      [&]()
+      {
+        std::unique_lock<std::mutex> lock(Lock);
+        SiblingSawInner = InnerFinished.wait_for(
+            lock, std::chrono::seconds(10), [&]() { return InnerDone; });
+      });
+  Outer.Run(
+      [&]()
+      {
+        TaskGroup Inner(Pool);
+        for (int j = 0; j < 10; j++)
+        {
+          Inner.Run([&Sum, j]() { Sum += j; });
+        }
+        Inner.Wait();
+        {
+          std::lock_guard<std::mutex> lock(Lock);
+          InnerDone = true;
+        }
+        InnerFinished.notify_all();
+      });
+  Outer.Wait();
+  REQUIRE(Sum == 45);
+  REQUIRE(SiblingSawInner);
+}
+
+TEST_CASE("Check that a waiting thread picks up tasks added to its group",
+          "[utility]")
+{
+  using namespace BSMPT;
+  // The only worker runs the first task, which adds a second task to the
+  // group and blocks until it has finished. Only the thread waiting for the
+  // group can execute the second task.
+  ThreadPool Pool(1);
+  std::mutex Lock;
+  std::condition_variable SecondFinished;
+  bool SecondDone     = false;
+  bool FirstSawSecond = false;
+  TaskGroup Group(Pool);
+  Group.Run(
+      [&]()
+      {
+        Group.Run(
+            [&]()
+            {
+              {
+                std::lock_guard<std::mutex> lock(Lock);
+                SecondDone = true;
+              }
+              SecondFinished.notify_all();
+            });
+        std::unique_lock<std::mutex> lock(Lock);
+        FirstSawSecond = SecondFinished.wait_for(
+            lock, std::chrono::seconds(10), [&]() { return SecondDone; });
+      });
+  Group.Wait();
+  REQUIRE(FirstSawSecond);
+}
+
+TEST_CASE("Check the evaluation budget", "[utility]")
+{
+  using namespace BSMPT;
+  EvaluationBudget Unlimited;
+  Unlimited.Consume(1000000);
+  REQUIRE(not Unlimited.Exhausted());
+  REQUIRE(not BudgetExhausted(nullptr));
+  REQUIRE(Unlimited.GetMaxIterationsPerStart() == 600);
+
+  EvaluationBudget Budget(100);
+  TaskGroup Workers;
+  for (int i = 0; i < 4; i++)
+  {
+    Workers.Run(
+        [&Budget]()
+        {
+          for (int j = 0; j < 20; j++)
+            Budget.Consume();
+        });
+  }
+  Workers.Wait();
+  REQUIRE(Budget.Evaluations() == 80);
+  REQUIRE(not BudgetExhausted(&Budget));
+  Budget.Consume(20);
+  REQUIRE(BudgetExhausted(&Budget));
+
+  EvaluationBudget Timed(0, 1e-9);
+  while (Timed.ElapsedTime() <= 1e-9)
+  {
+  }
+  REQUIRE(Timed.Exhausted());
+}
+
 TEST_CASE("Check Li2 function", "[utility]")
 {
   using namespace BSMPT;
@@ -272,7 +272,7 @@ def setAdditionalCTEquations():
 
 
 parser = argparse.ArgumentParser()
-parser.add_argument('-s','--show',choices=['ct','tensor','treeSimpl','CTSimpl'],required=True,help='The part of the model to be printed')
+parser.add_argument('-s','--show',choices=['ct','tensor','treeSimpl','CTSimpl','massMatrices'],required=True,help='The part of the model to be printed')
 
 if __name__ == "__main__":
     args = parser.parse_args()
@@ -297,4 +297,8 @@ if __name__ == "__main__":
         G2HDM.printTreeSimplified()
     
     if method == 'CTSimpl':
-        G2HDM.printVCTSimplified()
\ No newline at end of file
+        G2HDM.printVCTSimplified()
+
+    if method == 'massMatrices':
+        G2HDM.printMassMatrices()
+        G2HDM.printMassMatrixDerivatives()
\ No newline at end of file
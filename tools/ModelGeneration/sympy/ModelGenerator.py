@@ -1,4 +1,4 @@
-from sympy import symbols, Matrix, diff, simplify, Symbol, linsolve, I, hessian, zeros, expand
+from sympy import symbols, Matrix, diff, simplify, Symbol, linsolve, I, hessian, zeros, expand, cse, numbered_symbols
 from sympy.printing.cxx import cxxcode
 
 class ModelGenerator:
@@ -377,4 +377,63 @@ class ModelGenerator:
                 vevCounter+=1
 
         VS = simplify(expand(self._VCT.subs(self._VEVAtFiniteTemp)))
-        print(self.convertToCPP(VS,"res"))
\ No newline at end of file
+        print(self.convertToCPP(VS,"res"))
+
+    def _calcMassMatrices(self):
+        # The field dependent mass matrices as used in Class_Potential_Origin:
+        # the Hessian of the tree-level potential, the second derivative of the
+        # gauge potential w.r.t. the gauge fields and M^{IJ} of the fermions
+        HiggsMass = hessian(self._VHiggs, self._HiggsFields).applyfunc(expand)
+        GaugeMass = Matrix(self._nGauge, self._nGauge, lambda a, b: expand(diff(self._VGauge, self._GaugeFields[a], self._GaugeFields[b])))
+        QuarkMass = Matrix(self._nQuarks, self._nQuarks, lambda a, b: expand(diff(self._VQuarks, self._QuarkFields[a], self._QuarkFields[b])))
+        LeptonMass = Matrix(self._nLeptons, self._nLeptons, lambda a, b: expand(diff(self._VLep, self._LeptonFields[a], self._LeptonFields[b])))
+        return [("Higgs", HiggsMass, "double"), ("Gauge", GaugeMass, "double"), ("Quark", QuarkMass, "std::complex<double>"), ("Lepton", LeptonMass, "std::complex<double>")]
+
+    def _printMatrixWithCSE(self, matrix, scalarType):
+        n, m = matrix.shape
+        entries = [(i, j, matrix[i, j]) for i in range(n) for j in range(m) if matrix[i, j] != 0]
+        if len(entries) == 0:
+            return
+
+        usedSymbols = set()
+        for i, j, val in entries:
+            usedSymbols |= val.free_symbols
+        for i in range(self._nHiggs):
+            if self._HiggsFields[i] in usedSymbols:
+                print("const double " + self.convertToCPP(self._HiggsFields[i]) + " = v[" + str(i) + "];")
+
+        subexpressions, reduced = cse([val for i, j, val in entries], symbols=numbered_symbols('cse'))
+        for sym, val in subexpressions:
+            print("const " + scalarType + " " + self.convertToCPP(sym) + " = " + self.convertToCPP(val) + ";")
+        for (i, j, val), reducedVal in zip(entries, reduced):
+            print("res(" + str(i) + ", " + str(j) + ") = " + self.convertToCPP(reducedVal) + ";")
+
+    def printMassMatrices(self):
+        for name, matrix, scalarType in self._calcMassMatrices():
+            print("")
+            print("//Begin of " + name + "MassMatrixSimplified")
+            print("res.setZero();")
+            self._printMatrixWithCSE(matrix, scalarType)
+            print("//End of " + name + "MassMatrixSimplified")
+            print("")
+
+    def printMassMatrixDerivatives(self):
+        for name, matrix, scalarType in self._calcMassMatrices():
+            print("")
+            print("//Begin of " + name + "MassMatrixDerivativeSimplified")
+            print("res.setZero();")
+            print("switch (k)")
+            print("{")
+            for k in range(self._nHiggs):
+                derivative = matrix.diff(self._HiggsFields[k]).applyfunc(expand)
+                if derivative.is_zero_matrix:
+                    continue
+                print("case " + str(k) + ":")
+                print("{")
+                self._printMatrixWithCSE(derivative, scalarType)
+                print("break;")
+                print("}")
+            print("default: break;")
+            print("}")
+            print("//End of " + name + "MassMatrixDerivativeSimplified")
+            print("")
@@ -129,7 +129,7 @@ toyModel.setQuark(QuarkBase, VQuark)
 
 
 parser = argparse.ArgumentParser()
-parser.add_argument('-s','--show',choices=['ct','tensor','treeSimpl','CTSimpl'],required=True,help='The part of the model to be printed')
+parser.add_argument('-s','--show',choices=['ct','tensor','treeSimpl','CTSimpl','massMatrices'],required=True,help='The part of the model to be printed')
 
 if __name__ == "__main__":
     args = parser.parse_args()
@@ -154,4 +154,8 @@ if __name__ == "__main__":
         toyModel.printTreeSimplified()
     
     if method == 'CTSimpl':
-        toyModel.printVCTSimplified()
\ No newline at end of file
+        toyModel.printVCTSimplified()
+
+    if method == 'massMatrices':
+        toyModel.printMassMatrices()
+        toyModel.printMassMatrixDerivatives()
\ No newline at end of file
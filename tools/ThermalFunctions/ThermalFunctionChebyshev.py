@@ -0,0 +1,252 @@
+# SPDX-FileCopyrightText: 2021 Philipp Basler, Margarete Mühlleitner and Jonas
+# Müller
+#
+# SPDX-License-Identifier: GPL-3.0-or-later
+
+"""
+Generates src/ThermalFunctions/ThermalFunctionChebyshevData.cpp, the piecewise
+Chebyshev representation used by ThermalFunctions::JbosonChebyshev and
+ThermalFunctions::JfermionChebyshev.
+
+The thermal integrals are computed as in ThermalFunctionTables.py. J is
+analytic in x except at x = 0 and at the branch points x_b, where it behaves
+like c (x - x_b)^{3/2} on the right, and at x = 0, where it contains the term
+-x^2 log|x| / 32. These terms are subtracted on every segment between two
+non-analytic points and the analytic remainder G is approximated on pieces
+[xa, xb] as
+    G(x) = H(x) + (1 - t^2)^2 sum_k c_k T_k(t),  t in [-1, 1],
+where H is the cubic Hermite interpolation of G and dG/dx at the ends of the
+piece. The correction and its derivative vanish at the ends, so J and dJ/dx
+are continuous across the pieces by construction. The c_k interpolate the
+correction at the Chebyshev nodes, which is close to the minimax
+approximation of the given degree. Pieces are bisected until J and dJ/dx
+agree with the integrals within the accuracy target.
+
+Usage: python3 ThermalFunctionChebyshev.py [--output FILE] [--tolerance T]
+[--degree N] [--jobs N]
+"""
+
+import argparse
+import math
+import multiprocessing
+import os
+
+from ThermalFunctionTables import (C_TableMinRatio, C_TableMaxRatio,
+                                   Branchpoints, J)
+
+# Has to match C_ChebyshevDegree in ThermalFunctionChebyshev.h
+DefaultDegree = 12
+# Distance to a branch point on its analytic side at which J is integrated,
+# the value at the branch point follows from a linear extrapolation
+BranchOffset = 1e-9
+# Smallest piece which is still bisected
+MinWidth = 1e-6
+
+
+def JHigh(x, diff):
+    """JInterpolatedHigh(x, 3, diff) from ThermalFunctions.cpp"""
+    K = [math.gamma(2.5 + l) / (2**l * math.factorial(l) * math.gamma(2.5 - l))
+         for l in range(4)]
+    if diff == 0:
+        return (-math.exp(-math.sqrt(x)) * math.sqrt(math.pi / 2 * x**1.5) *
+                sum(K[l] * x**(-l / 2) for l in range(4)))
+    return (math.exp(-math.sqrt(x)) * math.sqrt(2 * math.pi) /
+            (8 * x**0.75) * sum(K[l] * x**((1 - l) / 2) *
+                                (2 * l + 2 * math.sqrt(x) - 3)
+                                for l in range(4)))
+
+
+class Segment:
+    """Interval between two non-analytic points and its singular terms"""
+
+    def __init__(self, Low, High, boson, BranchPoint, BranchCoefficient,
+                 LogCoefficient):
+        self.Low, self.High, self.boson = Low, High, boson
+        self.BranchPoint = BranchPoint
+        self.BranchCoefficient = BranchCoefficient
+        self.LogCoefficient = LogCoefficient
+
+    def Singular(self, x):
+        """Returns the singular terms and their derivative at x"""
+        d = max(x - self.BranchPoint, 0)
+        S = self.BranchCoefficient * d**1.5
+        dS = 1.5 * self.BranchCoefficient * d**0.5
+        if x != 0:
+            S += self.LogCoefficient * x * x * math.log(abs(x))
+            dS += self.LogCoefficient * (2 * x * math.log(abs(x)) + x)
+        return S, dS
+
+    def Exact(self, x):
+        """Returns (J, dJ/dx) at x"""
+        if x == 0:
+            if self.boson:
+                return (-math.pi**4 / 45, math.pi**2 / 12)
+            return (7 * math.pi**4 / 360, -math.pi**2 / 24)
+        if x == C_TableMaxRatio:
+            # the large x expansion is used above, match it at the seam
+            Sign = 1 if self.boson else -1
+            return (Sign * JHigh(x, 0), Sign * JHigh(x, 1))
+        if x in Branchpoints(self.boson):
+            # J is analytic on the left of the branch point
+            x0 = x - BranchOffset
+            J0, J1 = J(x0, 0, self.boson), J(x0, 1, self.boson)
+            return (J0 + BranchOffset * J1, J1)
+        return (J(x, 0, self.boson), J(x, 1, self.boson))
+
+    def Analytic(self, x):
+        """Returns (G, dG/dx) at x"""
+        Value, Derivative = self.Exact(x)
+        S, dS = self.Singular(x)
+        return (Value - S, Derivative - dS)
+
+
+def Chebyshev(t, Degree):
+    """T_k(t) and T_k'(t) for k = 0..Degree"""
+    T, dT = [1.0, t], [0.0, 1.0]
+    for k in range(1, Degree):
+        T.append(2 * t * T[k] - T[k - 1])
+        dT.append(2 * T[k] + 2 * t * dT[k] - dT[k - 1])
+    return T[:Degree + 1], dT[:Degree + 1]
+
+
+def Evaluate(Piece, x):
+    """Returns (G, dG/dx) of the representation at x"""
+    xa, xb, Ga, dGa, Gb, dGb = Piece[:6]
+    c = Piece[9:]
+    w = xb - xa
+    u = (x - xa) / w
+    t = 2 * u - 1
+    H = ((2 * u**3 - 3 * u**2 + 1) * Ga + (u**3 - 2 * u**2 + u) * w * dGa +
+         (-2 * u**3 + 3 * u**2) * Gb + (u**3 - u**2) * w * dGb)
+    dH = ((6 * u**2 - 6 * u) * Ga / w + (3 * u**2 - 4 * u + 1) * dGa +
+          (-6 * u**2 + 6 * u) * Gb / w + (3 * u**2 - 2 * u) * dGb)
+    T, dT = Chebyshev(t, len(c) - 1)
+    g = sum(ck * Tk for ck, Tk in zip(c, T))
+    dg = sum(ck * dTk for ck, dTk in zip(c, dT))
+    Weight = (1 - t * t)**2
+    dWeight = -4 * t * (1 - t * t)
+    return (H + Weight * g, dH + (dWeight * g + Weight * dg) * 2 / w)
+
+
+def Fit(Seg, xa, xb, Ends, Degree):
+    """Piece on [xa, xb] with the Chebyshev coefficients of the correction"""
+    Piece = [xa, xb, Ends[0][0], Ends[0][1], Ends[1][0], Ends[1][1],
+             Seg.BranchPoint, Seg.BranchCoefficient, Seg.LogCoefficient]
+    Hermite = Piece + [0.0] * (Degree + 1)
+    Residual = []
+    for j in range(Degree + 1):
+        t = math.cos(math.pi * (j + 0.5) / (Degree + 1))
+        x = xa + (t + 1) / 2 * (xb - xa)
+        Residual.append((Seg.Analytic(x)[0] - Evaluate(Hermite, x)[0]) /
+                        (1 - t * t)**2)
+    for k in range(Degree + 1):
+        ck = 2 / (Degree + 1) * sum(r * math.cos(k * math.pi * (j + 0.5) /
+                                                 (Degree + 1))
+                                    for j, r in enumerate(Residual))
+        Piece.append(ck / 2 if k == 0 else ck)
+    return Piece
+
+
+def Accurate(Seg, Piece, Tolerance, Degree):
+    xa, xb = Piece[0], Piece[1]
+    NTest = 3 * Degree
+    for j in range(1, NTest):
+        x = xa + (math.cos(math.pi * j / NTest) + 1) / 2 * (xb - xa)
+        Exact = Seg.Exact(x)
+        S, dS = Seg.Singular(x)
+        Value, Derivative = Evaluate(Piece, x)
+        if abs(Value + S - Exact[0]) > Tolerance * max(1, abs(Exact[0])):
+            return False
+        if abs(Derivative + dS - Exact[1]) > Tolerance * max(1, abs(Exact[1])):
+            return False
+    return True
+
+
+def Refine(Seg, xa, xb, Ends, Tolerance, Degree):
+    """Pieces covering [xa, xb], bisected until accurate"""
+    Piece = Fit(Seg, xa, xb, Ends, Degree)
+    if xb - xa < 2 * MinWidth or Accurate(Seg, Piece, Tolerance, Degree):
+        return [Piece]
+    xm = (xa + xb) / 2
+    Mid = Seg.Analytic(xm)
+    return (Refine(Seg, xa, xm, (Ends[0], Mid), Tolerance, Degree) +
+            Refine(Seg, xm, xb, (Mid, Ends[1]), Tolerance, Degree))
+
+
+def Pieces(args):
+    Seg, Tolerance, Degree = args
+    return Refine(Seg, Seg.Low, Seg.High,
+                  (Seg.Analytic(Seg.Low), Seg.Analytic(Seg.High)),
+                  Tolerance, Degree)
+
+
+def Table(boson, Tolerance, Degree, Jobs):
+    # x = 0 is a branch point of J_- with half the coefficient
+    Points = sorted(Branchpoints(boson) + ([0] if boson else []))
+    Bounds = sorted(set([C_TableMinRatio, 0, C_TableMaxRatio] + Points))
+    Segments = []
+    for Low, High in zip(Bounds[:-1], Bounds[1:]):
+        BranchPoint, BranchCoefficient = Low, 0
+        Left = [x for x in Points if x <= Low]
+        if Left:
+            BranchPoint = Left[-1]
+            BranchCoefficient = -math.pi / (6 if BranchPoint == 0 else 3)
+        LogCoefficient = -1 / 32 if 0 in (Low, High) else 0
+        Segments.append((Segment(Low, High, boson, BranchPoint,
+                                 BranchCoefficient, LogCoefficient),
+                         Tolerance, Degree))
+    with multiprocessing.Pool(Jobs) as Pool:
+        return [Piece for Result in Pool.map(Pieces, Segments)
+                for Piece in Result]
+
+
+def Format(Name, Pieces, Degree):
+    def Row(Piece):
+        Values = ["{:.17g}".format(v) for v in Piece]
+        Lines = [", ".join(Values[i:i + 3]) for i in range(0, len(Values), 3)]
+        return "    {" + ",\n     ".join(Lines) + "}"
+
+    return ("const std::size_t C_{0}Pieces = {1};\n\n"
+            "const double {0}[{1}][{2}] = {{\n{3}}};\n"
+            .format(Name, len(Pieces), Degree + 10,
+                    ",\n".join(Row(p) for p in Pieces)))
+
+
+def main():
+    Parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    Parser.add_argument("--output",
+                        default=os.path.join(
+                            os.path.dirname(__file__), "..", "..", "src",
+                            "ThermalFunctions",
+                            "ThermalFunctionChebyshevData.cpp"))
+    Parser.add_argument("--tolerance", type=float, default=1e-9)
+    Parser.add_argument("--degree", type=int, default=DefaultDegree)
+    Parser.add_argument("--jobs", type=int,
+                        default=multiprocessing.cpu_count())
+    Args = Parser.parse_args()
+
+    Boson = Table(True, Args.tolerance, Args.degree, Args.jobs)
+    Fermion = Table(False, Args.tolerance, Args.degree, Args.jobs)
+    with open(Args.output, "w") as File:
+        File.write(
+            "// SPDX-FileCopyrightText: 2021 Philipp Basler, Margarete "
+            "Mühlleitner and Jonas\n// Müller\n//\n"
+            "// SPDX-License-Identifier: GPL-3.0-or-later\n\n"
+            "/**\n * @file\n * Generated by "
+            "tools/ThermalFunctions/ThermalFunctionChebyshev.py with\n"
+            " * tolerance = {0:g} and degree = {1}, do not edit.\n */\n\n"
+            "#include <BSMPT/ThermalFunctions/ThermalFunctionChebyshev.h>\n\n"
+            "namespace BSMPT\n{{\nnamespace ThermalFunctions\n{{\n\n"
+            "static_assert(C_ChebyshevDegree == {1},\n"
+            "              \"C_ChebyshevDegree does not match the generated "
+            "data\");\n\n"
+            .format(Args.tolerance, Args.degree))
+        File.write(Format("BosonChebyshev", Boson, Args.degree))
+        File.write("\n")
+        File.write(Format("FermionChebyshev", Fermion, Args.degree))
+        File.write("\n} // namespace ThermalFunctions\n"
+                   "} // namespace BSMPT\n")
+
+
+if __name__ == "__main__":
+    main()
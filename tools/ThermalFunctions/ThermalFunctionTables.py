@@ -0,0 +1,232 @@
+# SPDX-FileCopyrightText: 2021 Philipp Basler, Margarete Mühlleitner and Jonas
+# Müller
+#
+# SPDX-License-Identifier: GPL-3.0-or-later
+
+"""
+Generates src/ThermalFunctions/ThermalFunctionTableData.cpp, the interpolation
+tables used by ThermalFunctions::JbosonTabulated and
+ThermalFunctions::JfermionTabulated.
+
+The thermal integrals
+    J_-(x) = int_0^inf dk k^2 log(1 - exp(-sqrt(k^2 + x)))
+    J_+(x) = int_0^inf dk k^2 log(1 + exp(-sqrt(k^2 + x)))
+and their derivatives w.r.t. x are integrated numerically. The real k axis is
+rotated to k = t exp(i pi/4), where the integrands are smooth for every real x
+(all poles and branch points lie on the real or imaginary k axis). For x < 0
+the real part of the result is the real part of the integral along the real k
+axis, as used by the numerical integration in ThermalFunctions.cpp.
+
+The tables store cubic Hermite data in s = sign(x) sqrt(|x|). The knots on
+every segment between two non-analytic points of J are bisected until both
+J and dJ/dx agree with the integrals within the requested tolerance at all
+interval midpoints.
+
+Usage: python3 ThermalFunctionTables.py [--output FILE] [--reltol R]
+[--abstol A] [--jobs N]
+"""
+
+import argparse
+import cmath
+import math
+import multiprocessing
+import os
+
+C_TableMinRatio = -3000
+C_TableMaxRatio = 400
+# Inset of the segment boundaries next to the branch points in s, where
+# d^2J/dx^2 diverges
+BranchInset = 1e-8
+# Smallest interval in s which is still bisected
+MinWidth = 1e-6
+# Upper limit of the integration along the rotated contour, the integrands
+# fall off as exp(-t/sqrt(2))
+UpperLimit = 120
+
+Rotation = cmath.exp(1j * math.pi / 4)
+
+
+def GaussLegendre(n):
+    """Nodes and weights of the n point Gauss-Legendre rule on [0, 1]"""
+    res = []
+    for i in range(1, n + 1):
+        x = math.cos(math.pi * (i - 0.25) / (n + 0.5))
+        for _ in range(100):
+            p0, p1 = 1.0, x
+            for k in range(2, n + 1):
+                p0, p1 = p1, ((2 * k - 1) * x * p1 - (k - 1) * p0) / k
+            dp = n * (x * p1 - p0) / (x * x - 1)
+            dx = p1 / dp
+            x -= dx
+            if abs(dx) < 1e-16:
+                break
+        res.append(((1 - x) / 2, 1 / ((1 - x * x) * dp * dp)))
+    return res
+
+
+Nodes = GaussLegendre(24)
+
+
+def Integrand(x, t, diff, boson):
+    k = t * Rotation
+    z = cmath.sqrt(k * k + x)
+    if boson:
+        if diff == 0:
+            f = cmath.log(1 - cmath.exp(-z))
+        else:
+            e = cmath.exp(z) - 1
+            if diff == 1:
+                f = 1 / (2 * z * e)
+            else:
+                f = -(e + z * (e + 1)) / (4 * z**3 * e * e)
+    else:
+        if diff == 0:
+            f = cmath.log(1 + cmath.exp(-z))
+        else:
+            e = cmath.exp(z) + 1
+            if diff == 1:
+                f = -1 / (2 * z * e)
+            else:
+                f = (e + z * (e - 1)) / (4 * z**3 * e * e)
+    return k * k * f * Rotation
+
+
+def Branchpoints(boson):
+    res = []
+    n = 1 if boson else 0
+    while True:
+        x = -((2 * n if boson else 2 * n + 1) * math.pi) ** 2
+        if x <= C_TableMinRatio:
+            return res
+        res.append(x)
+        n += 1
+
+
+def J(x, diff, boson):
+    """Real part of the thermal integral or its derivatives at x"""
+    # the integrands vary on the scale of the square root of the distance to
+    # the closest non-analytic point, resolved by geometrically growing panels
+    Distance = min([abs(x - xb) for xb in Branchpoints(boson) + [0]])
+    Edges = [0.0, min(math.sqrt(Distance), 1) * 1e-4]
+    while Edges[-1] < UpperLimit:
+        Edges.append(min(2 * Edges[-1], UpperLimit))
+    res = 0
+    for Low, High in zip(Edges[:-1], Edges[1:]):
+        for Node, Weight in Nodes:
+            res += (High - Low) * Weight * Integrand(
+                x, Low + (High - Low) * Node, diff, boson)
+    return res.real
+
+
+def Knot(s, boson, side=0):
+    """Returns (s, J, dJ/ds, dJ/dx, d^2J/(dx ds)) at s"""
+    if s == 0:
+        # limits at x = 0 from below (side = -1) and above (side = 1)
+        if boson:
+            return (0, -math.pi**4 / 45, 0, math.pi**2 / 12,
+                    -math.pi / 4 if side > 0 else 0)
+        return (0, 7 * math.pi**4 / 360, 0, -math.pi**2 / 24, 0)
+    x = s * abs(s)
+    J1 = J(x, 1, boson)
+    return (s, J(x, 0, boson), 2 * abs(s) * J1, J1,
+            2 * abs(s) * J(x, 2, boson))
+
+
+def Hermite(Low, High, s, Column):
+    h = High[0] - Low[0]
+    t = (s - Low[0]) / h
+    return ((2 * t**3 - 3 * t**2 + 1) * Low[Column] +
+            (t**3 - 2 * t**2 + t) * h * Low[Column + 1] +
+            (-2 * t**3 + 3 * t**2) * High[Column] +
+            (t**3 - t**2) * h * High[Column + 1])
+
+
+def Accurate(Low, High, Mid, RelTol, AbsTol):
+    for Column in (1, 3):
+        Error = abs(Hermite(Low, High, Mid[0], Column) - Mid[Column])
+        if Error > AbsTol + RelTol * abs(Mid[Column]):
+            return False
+    return True
+
+
+def Refine(Low, High, boson, RelTol, AbsTol):
+    """Knots in the interval (Low, High], bisected until accurate"""
+    Mid = Knot((Low[0] + High[0]) / 2, boson)
+    if High[0] - Low[0] < 2 * MinWidth or Accurate(Low, High, Mid, RelTol,
+                                                   AbsTol):
+        return [High]
+    return (Refine(Low, Mid, boson, RelTol, AbsTol) +
+            Refine(Mid, High, boson, RelTol, AbsTol))
+
+
+def Segment(args):
+    sLow, sHigh, boson, RelTol, AbsTol = args
+    NInitial = max(8, int(sHigh - sLow) * 4)
+    Knots = [Knot(sLow, boson, 1)]
+    for i in range(1, NInitial + 1):
+        s = sLow + (sHigh - sLow) * i / NInitial
+        High = Knot(s, boson, -1)
+        Knots += Refine(Knots[-1], High, boson, RelTol, AbsTol)
+    return Knots
+
+
+def Table(boson, RelTol, AbsTol, Jobs):
+    def ToS(x):
+        return -math.sqrt(-x) if x < 0 else math.sqrt(x)
+
+    Bounds = [ToS(C_TableMinRatio)]
+    for x in reversed(Branchpoints(boson)):
+        Bounds += [ToS(x) - BranchInset, ToS(x) + BranchInset]
+    Bounds += [0, 0, ToS(C_TableMaxRatio)]
+    Segments = [(Bounds[i], Bounds[i + 1], boson, RelTol, AbsTol)
+                for i in range(0, len(Bounds), 2)]
+    with multiprocessing.Pool(Jobs) as Pool:
+        return [Knot for Knots in Pool.map(Segment, Segments)
+                for Knot in Knots]
+
+
+def Format(Name, Knots):
+    def Row(Knot):
+        Values = ["{:.17g}".format(v) for v in Knot]
+        return ("    {" + ", ".join(Values[:3]) + ",\n     " +
+                ", ".join(Values[3:]) + "}")
+
+    return ("const std::size_t C_{0}Rows = {1};\n\n"
+            "const double {0}[{1}][5] = {{\n{2}}};\n"
+            .format(Name, len(Knots), ",\n".join(Row(k) for k in Knots)))
+
+
+def main():
+    Parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    Parser.add_argument("--output",
+                        default=os.path.join(os.path.dirname(__file__), "..",
+                                             "..", "src", "ThermalFunctions",
+                                             "ThermalFunctionTableData.cpp"))
+    Parser.add_argument("--reltol", type=float, default=1e-7)
+    Parser.add_argument("--abstol", type=float, default=1e-9)
+    Parser.add_argument("--jobs", type=int,
+                        default=multiprocessing.cpu_count())
+    Args = Parser.parse_args()
+
+    Boson = Table(True, Args.reltol, Args.abstol, Args.jobs)
+    Fermion = Table(False, Args.reltol, Args.abstol, Args.jobs)
+    with open(Args.output, "w") as File:
+        File.write(
+            "// SPDX-FileCopyrightText: 2021 Philipp Basler, Margarete "
+            "Mühlleitner and Jonas\n// Müller\n//\n"
+            "// SPDX-License-Identifier: GPL-3.0-or-later\n\n"
+            "/**\n * @file\n * Generated by "
+            "tools/ThermalFunctions/ThermalFunctionTables.py with\n"
+            " * reltol = {0:g} and abstol = {1:g}, do not edit.\n */\n\n"
+            "#include <BSMPT/ThermalFunctions/ThermalFunctionTable.h>\n\n"
+            "namespace BSMPT\n{{\nnamespace ThermalFunctions\n{{\n\n"
+            .format(Args.reltol, Args.abstol))
+        File.write(Format("BosonTable", Boson))
+        File.write("\n")
+        File.write(Format("FermionTable", Fermion))
+        File.write("\n} // namespace ThermalFunctions\n"
+                   "} // namespace BSMPT\n")
+
+
+if __name__ == "__main__":
+    main()